@@ -1,5 +1,6 @@
 #include <inc/x86.h>
 #include <inc/elf.h>
+#include <inc/bootinfo.h>
 
 /**********************************************************************
  * This a dirt simple boot loader, whose sole job is to boot
@@ -30,48 +31,81 @@
  **********************************************************************/
 
 #define SECTSIZE	512
+#define MAXSECTS	256	// most sectors one ATA read command can transfer
 #define ELFHDR		((struct Elf *) 0x10000) // scratch space
 
-void readsect(void*, uint32_t);
-void readseg(uint32_t, uint32_t, uint32_t);
+// the kernel's entry point, which never returns
+typedef void (*entry_t)(void) __attribute__((noreturn));
+
+static void waitdisk(void);
+static void readsect(uint32_t, uint32_t);
+static void readseg(uint32_t, uint32_t, uint32_t);
 
 void
 bootmain(void)
 {
-	struct Proghdr *ph, *eph;
+	struct Proghdr *ph, *ph0, *eph;
+	uint32_t pa, end_pa, offset;
 
 	// read 1st page off disk
 	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
 
 	// is this a valid ELF?
 	if (ELFHDR->e_magic != ELF_MAGIC)
-		goto bad;
-
-	// load each program segment (ignores ph flags)
-	ph = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
-	eph = ph + ELFHDR->e_phnum;
-	for (; ph < eph; ph++)
+		while (1)
+			/* do nothing */;
+
+	// load each program segment (ignores ph flags).
+	// Consecutive segments that lie at the same distance from each
+	// other on disk as in memory are merged into one run [pa, end_pa)
+	// so the whole run is read with as few disk commands as possible.
+	// The gap between them gets filled with whatever the file holds
+	// there, which is harmless.  Only p_filesz bytes of a segment come
+	// from disk; its BSS is zeroed below.
+	ph0 = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+	eph = ph0 + ELFHDR->e_phnum;
+	// The run starts out as the first segment's, empty, so that
+	// segment extends it rather than flushing a read of nothing.
+	pa = end_pa = ph0->p_pa;
+	offset = ph0->p_offset;
+	for (ph = ph0; ph < eph; ph++) {
+		// Nothing to read for the likes of GNU_STACK, which would
+		// otherwise end the run and leave an empty one behind
+		if (ph->p_filesz == 0)
+			continue;
 		// p_pa is the load address of this segment (as well
 		// as the physical address)
-		readseg(ph->p_pa, ph->p_memsz, ph->p_offset);
+		if (ph->p_pa - ph->p_offset != pa - offset
+		    || ph->p_pa < end_pa) {
+			readseg(pa, end_pa - pa, offset);
+			pa = ph->p_pa;
+			offset = ph->p_offset;
+		}
+		end_pa = ph->p_pa + ph->p_filesz;
+	}
+	readseg(pa, end_pa - pa, offset);
+
+	// Zero each segment's BSS, [p_filesz, p_memsz).  Do this after
+	// all the reads, which scribble on whatever lies past each run.
+	for (ph = ph0; ph < eph; ph++)
+		stosb((uint8_t *) ph->p_pa + ph->p_filesz, 0,
+		      ph->p_memsz - ph->p_filesz);
+
+	// boot.S already told the kernel (with BI_BSSZERO in the struct
+	// Bootinfo) that it need not clear its BSS again.
 
 	// call the entry point from the ELF header
 	// note: does not return!
-	((void (*)(void)) (ELFHDR->e_entry))();
-
-bad:
-	outw(0x8A00, 0x8A00);
-	outw(0x8A00, 0x8E00);
-	while (1)
-		/* do nothing */;
+	((entry_t) (ELFHDR->e_entry))();
 }
 
 // Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
 // Might copy more than asked
-void
+static void
 readseg(uint32_t pa, uint32_t count, uint32_t offset)
 {
-	uint32_t end_pa;
+	uint32_t end_pa, nsect;
+	int first;
 
 	end_pa = pa + count;
 
@@ -81,21 +115,35 @@ readseg(uint32_t pa, uint32_t count, uint32_t offset)
 	// translate from bytes to sectors, and kernel starts at sector 1
 	offset = (offset / SECTSIZE) + 1;
 
-	// If this is too slow, we could read lots of sectors at a time.
+	// Read up to MAXSECTS sectors with each disk command: the first
+	// command fetches nsect % MAXSECTS sectors (the drive only looks
+	// at the low 8 bits of the count, and takes 0 to mean 256), after
+	// which the number left is a multiple of MAXSECTS.
 	// We'd write more to memory than asked, but it doesn't matter --
 	// we load in increasing order.
-	while (pa < end_pa) {
+	nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+	for (first = 1; pa < end_pa; pa += SECTSIZE, offset++, nsect--) {
+		if (first || nsect % MAXSECTS == 0)
+			readsect(offset, nsect);
+		first = 0;
+
+		// the disk is busy again while it fetches each sector
+		waitdisk();
+
 		// Since we haven't enabled paging yet and we're using
 		// an identity segment mapping (see boot.S), we can
 		// use physical addresses directly.  This won't be the
 		// case once JOS enables the MMU.
-		readsect((uint8_t*) pa, offset);
-		pa += SECTSIZE;
-		offset++;
+		insl(0x1F0, (uint8_t*) pa, SECTSIZE/4);
 	}
+
+	// Append the low half of the TSC to the struct Bootinfo.
+	asm volatile("rdtsc; movl %0, %%edi; stosl; movl %%edi, %0"
+		     : "+m" (BOOTINFO->bi_tscend)
+		     : : "eax", "edx", "edi", "memory");
 }
 
-void
+static void
 waitdisk(void)
 {
 	// wait for disk reaady
@@ -103,23 +151,19 @@ waitdisk(void)
 		/* do nothing */;
 }
 
-void
-readsect(void *dst, uint32_t offset)
+// Start reading 'nsect' (1 to MAXSECTS) consecutive sectors at sector
+// 'offset' with a single disk command.  The caller then collects each
+// sector from the data port.
+static void
+readsect(uint32_t offset, uint32_t nsect)
 {
 	// wait for disk to be ready
 	waitdisk();
 
-	outb(0x1F2, 1);		// count = 1
+	outb(0x1F2, nsect);	// count; 0 means 256
 	outb(0x1F3, offset);
 	outb(0x1F4, offset >> 8);
 	outb(0x1F5, offset >> 16);
 	outb(0x1F6, (offset >> 24) | 0xE0);
 	outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
-
-	// wait for disk to be ready
-	waitdisk();
-
-	// read a sector
-	insl(0x1F0, dst, SECTSIZE/4);
 }
-
@@ -0,0 +1,324 @@
+/*
+ * Build the compressed kernel disk image (see inc/zimage.h).
+ *
+ *	mkzimage boot zboot kernel image
+ *
+ * writes the boot sector 'boot', the second stage 'zboot' and an LZ4
+ * payload holding every loadable segment of the ELF file 'kernel' to
+ * the disk image 'image', followed by 'kernel' itself for the sake of
+ * its debug information.  This runs on the build host.
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <inc/elf.h>
+#include <inc/zimage.h>
+
+#define SECTSIZE	512
+
+// LZ4 block format limits: a match is at least MINMATCH bytes and at
+// most 65535 bytes back, the last match must start at least MFLIMIT
+// bytes before the end of the input and the last LASTLITERALS bytes
+// are always literals.
+#define MINMATCH	4
+#define MFLIMIT		12
+#define LASTLITERALS	5
+#define MAXOFFSET	65535
+#define HASHLOG		14
+
+void
+panic(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+	exit(1);
+}
+
+static uint8_t *
+readfile(const char *name, size_t *size)
+{
+	FILE *f;
+	uint8_t *buf;
+	long n;
+
+	if ((f = fopen(name, "rb")) == NULL)
+		panic("open %s: %m", name);
+	fseek(f, 0, SEEK_END);
+	n = ftell(f);
+	rewind(f);
+	if ((buf = malloc(n + 1)) == NULL)
+		panic("out of memory");
+	if (fread(buf, 1, n, f) != (size_t) n)
+		panic("read %s: %m", name);
+	fclose(f);
+	*size = n;
+	return buf;
+}
+
+static uint32_t
+read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static uint8_t *
+putlen(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = len;
+	return op;
+}
+
+// Emit one sequence: 'nlit' literals from 'lit', then (if mlen != 0)
+// a match of 'mlen' bytes 'off' bytes back.
+static uint8_t *
+putseq(uint8_t *op, const uint8_t *lit, size_t nlit, size_t off, size_t mlen)
+{
+	uint8_t *token = op++;
+
+	*token = (nlit < 15 ? nlit : 15) << 4;
+	if (nlit >= 15)
+		op = putlen(op, nlit - 15);
+	memcpy(op, lit, nlit);
+	op += nlit;
+	if (mlen == 0)
+		return op;
+
+	*op++ = off;
+	*op++ = off >> 8;
+	mlen -= MINMATCH;
+	*token |= mlen < 15 ? mlen : 15;
+	if (mlen >= 15)
+		op = putlen(op, mlen - 15);
+	return op;
+}
+
+// Greedy single-pass LZ4 block compressor.
+// 'dst' must hold at least lz4_bound(n) bytes.  Returns the block size.
+static size_t
+lz4_compress(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	static int32_t htab[1 << HASHLOG];
+	const uint8_t *ip, *anchor, *ref, *mflimit, *matchlimit;
+	uint8_t *op;
+	uint32_t h;
+	size_t len;
+
+	memset(htab, 0xFF, sizeof(htab));
+	ip = anchor = src;
+	op = dst;
+	mflimit = src + (n > MFLIMIT ? n - MFLIMIT : 0);
+	matchlimit = src + (n > LASTLITERALS ? n - LASTLITERALS : 0);
+
+	while (ip < mflimit) {
+		h = (read32(ip) * 2654435761U) >> (32 - HASHLOG);
+		ref = htab[h] < 0 ? NULL : src + htab[h];
+		htab[h] = ip - src;
+		if (ref == NULL || ip - ref > MAXOFFSET
+		    || read32(ref) != read32(ip)) {
+			ip++;
+			continue;
+		}
+
+		for (len = MINMATCH; ip + len < matchlimit; len++)
+			if (ref[len] != ip[len])
+				break;
+		op = putseq(op, anchor, ip - anchor, ip - ref, len);
+		ip += len;
+		anchor = ip;
+	}
+	op = putseq(op, anchor, src + n - anchor, 0, 0);
+	return op - dst;
+}
+
+static size_t
+lz4_bound(size_t n)
+{
+	return n + n / 255 + 16;
+}
+
+// Decode 'block' the same way boot/zboot.c does, check that it
+// reproduces 'orig', and return how far the compressed data must sit
+// past the start of the output so that decoding in place never
+// overwrites input that has not been consumed yet.
+static size_t
+lz4_check(const uint8_t *block, size_t size, const uint8_t *orig, size_t n)
+{
+	const uint8_t *in = block, *end = block + size;
+	size_t out = 0, need = 0, len, off, token;
+
+#define NEED()	do { \
+		if (out > (size_t) (in - block) \
+		    && out - (in - block) > need) \
+			need = out - (in - block); \
+	} while (0)
+
+	while (in < end) {
+		token = *in++;
+		if ((len = token >> 4) == 15)
+			do
+				len += *in;
+			while (*in++ == 255);
+		NEED();
+		if (out + len > n || memcmp(orig + out, in, len) != 0)
+			panic("lz4: bad literals at %zu", out);
+		out += len;
+		in += len;
+		if (in >= end)
+			break;
+
+		off = in[0] | (in[1] << 8);
+		in += 2;
+		if ((len = token & 15) == 15)
+			do
+				len += *in;
+			while (*in++ == 255);
+		len += MINMATCH;
+		if (off == 0 || off > out || out + len > n)
+			panic("lz4: bad match at %zu", out);
+		out += len;
+		NEED();
+	}
+	if (out != n)
+		panic("lz4: decoded %zu bytes, expected %zu", out, n);
+	return (need + 3) & ~3;
+#undef NEED
+}
+
+static void
+writeat(FILE *f, long off, const void *buf, size_t n, const char *name)
+{
+	if (fseek(f, off, SEEK_SET) < 0 || fwrite(buf, 1, n, f) != n)
+		panic("write %s: %m", name);
+}
+
+int
+main(int argc, char **argv)
+{
+	static uint8_t sector[SECTSIZE];
+	uint8_t *boot, *zboot, *kern, *blk;
+	size_t bootsz, zbootsz, kernsz, size, rawsz, packsz;
+	struct Elf *elf;
+	struct Proghdr *ph;
+	struct Zimage z;
+	struct Zseg *zs, t;
+	uint32_t offset;
+	FILE *img;
+	int i, j;
+
+	if (argc != 5)
+		panic("usage: mkzimage boot zboot kernel image");
+
+	boot = readfile(argv[1], &bootsz);
+	zboot = readfile(argv[2], &zbootsz);
+	kern = readfile(argv[3], &kernsz);
+	if (bootsz != SECTSIZE)
+		panic("%s: not a boot sector", argv[1]);
+	if (zbootsz > (ZIMAGE_SECT - 1) * SECTSIZE)
+		panic("%s too large: %zu bytes (max %d)", argv[2], zbootsz,
+		      (ZIMAGE_SECT - 1) * SECTSIZE);
+
+	elf = (struct Elf *) kern;
+	if (kernsz < sizeof(*elf) || elf->e_magic != ELF_MAGIC)
+		panic("%s: not an ELF file", argv[3]);
+
+	memset(&z, 0, sizeof(z));
+	z.z_magic = ZIMAGE_MAGIC;
+	z.z_entry = elf->e_entry;
+	for (i = 0; i < elf->e_phnum; i++) {
+		ph = (struct Proghdr *) (kern + elf->e_phoff) + i;
+		if (ph->p_type != ELF_PROG_LOAD || ph->p_memsz == 0)
+			continue;
+		if (z.z_nseg == ZIMAGE_MAXSEG)
+			panic("%s: too many segments", argv[3]);
+		if (ph->p_offset + ph->p_filesz > kernsz)
+			panic("%s: truncated segment", argv[3]);
+		zs = &z.z_seg[z.z_nseg++];
+		zs->zs_pa = ph->p_pa;
+		zs->zs_filesz = ph->p_filesz;
+		zs->zs_memsz = ph->p_memsz;
+		// borrow zs_offset to remember the file offset until the
+		// segments are laid out below
+		zs->zs_offset = ph->p_offset;
+	}
+
+	// zboot unpacks in this order; keep it increasing so that
+	// in-place decoding only ever scribbles on later segments.
+	for (i = 0; i < z.z_nseg; i++)
+		for (j = i + 1; j < z.z_nseg; j++)
+			if (z.z_seg[j].zs_pa < z.z_seg[i].zs_pa) {
+				t = z.z_seg[i];
+				z.z_seg[i] = z.z_seg[j];
+				z.z_seg[j] = t;
+			}
+
+	if ((img = fopen(argv[4], "wb")) == NULL)
+		panic("open %s: %m", argv[4]);
+	writeat(img, 0, boot, bootsz, argv[4]);
+	writeat(img, SECTSIZE, zboot, zbootsz, argv[4]);
+
+	rawsz = packsz = 0;
+	offset = SECTSIZE;	// the header takes the first sector
+	for (i = 0; i < z.z_nseg; i++) {
+		zs = &z.z_seg[i];
+		if ((blk = malloc(lz4_bound(zs->zs_filesz))) == NULL)
+			panic("out of memory");
+		size = lz4_compress(kern + zs->zs_offset, zs->zs_filesz, blk);
+		if (size < zs->zs_filesz) {
+			zs->zs_flags = ZSEG_LZ4;
+			zs->zs_inplace = lz4_check(blk, size,
+						   kern + zs->zs_offset,
+						   zs->zs_filesz);
+			writeat(img, ZIMAGE_SECT * SECTSIZE + offset,
+				blk, size, argv[4]);
+		} else {
+			// doesn't compress; store it as is
+			size = zs->zs_filesz;
+			zs->zs_inplace = 0;
+			writeat(img, ZIMAGE_SECT * SECTSIZE + offset,
+				kern + zs->zs_offset, size, argv[4]);
+		}
+		free(blk);
+		zs->zs_offset = offset;
+		zs->zs_size = size;
+		offset += (size + SECTSIZE - 1) & ~(SECTSIZE - 1);
+		rawsz += zs->zs_filesz;
+		packsz += size;
+	}
+
+	// The kernel reads its stabs from this copy, with their section
+	// headers; it's not loaded at boot.
+	z.z_elfoffset = offset;
+	writeat(img, ZIMAGE_SECT * SECTSIZE + offset, kern, kernsz, argv[4]);
+	offset += (kernsz + SECTSIZE - 1) & ~(SECTSIZE - 1);
+
+	if (sizeof(z) > SECTSIZE)
+		panic("struct Zimage does not fit in a sector");
+	memcpy(sector, &z, sizeof(z));
+	writeat(img, ZIMAGE_SECT * SECTSIZE, sector, SECTSIZE, argv[4]);
+
+	// pad the image out to a whole number of sectors
+	if (offset > SECTSIZE) {
+		memset(sector, 0, SECTSIZE);
+		writeat(img, ZIMAGE_SECT * SECTSIZE + offset - 1,
+			sector, 1, argv[4]);
+	}
+	if (fclose(img) != 0)
+		panic("write %s: %m", argv[4]);
+
+	fprintf(stderr, "kernel payload is %zu bytes (%zu uncompressed)\n",
+		packsz, rawsz);
+	return 0;
+}
@@ -0,0 +1,170 @@
+#include <inc/x86.h>
+#include <inc/zimage.h>
+#include <inc/bootinfo.h>
+
+/**********************************************************************
+ * Second boot stage for the compressed kernel image.
+ *
+ * boot/main.c loads this program from sector 1 exactly as it would
+ * load the kernel, and calls zbootmain() on the boot loader's stack.
+ * zbootmain() then reads the payload that boot/mkzimage.c put at
+ * sector ZIMAGE_SECT (see inc/zimage.h) and unpacks each kernel
+ * segment to its physical load address.
+ *
+ * Compressed segments are decoded in place: the LZ4 block is read
+ * from disk to the tail end of the segment's own memory, at the
+ * offset mkzimage picked so that the decoder's output never catches
+ * up with input it has not consumed yet.  So no staging buffer is
+ * needed and no memory beyond the kernel itself (plus a few bytes of
+ * margin) is touched.
+ **********************************************************************/
+
+#define SECTSIZE	512
+#define MAXSECTS	256	// most sectors one ATA read command can transfer
+#define ZHDR		((struct Zimage *) 0x10000) // scratch space
+
+static void readsect(void*, uint32_t, uint32_t);
+static uint8_t *lz4_decode(uint8_t *, const uint8_t *, uint32_t);
+static void stamp(void);
+
+void
+zbootmain(void)
+{
+	struct Zseg *zs, *ezs;
+	uint8_t *src;
+
+	// our timestamps follow those boot/main.c took loading us
+	BOOTINFO->bi_zbootidx = (uint32_t *) BOOTINFO->bi_tscend
+		- BOOTINFO->bi_tsc;
+	BOOTINFO->bi_flags |= BI_ZBOOT;
+
+	readsect(ZHDR, ZIMAGE_SECT, 1);
+
+	if (ZHDR->z_magic != ZIMAGE_MAGIC || ZHDR->z_nseg > ZIMAGE_MAXSEG)
+		goto bad;
+
+	// mkzimage sorts the segments by address, so unpacking one
+	// segment never clobbers another that is already in place.
+	zs = ZHDR->z_seg;
+	ezs = zs + ZHDR->z_nseg;
+	for (; zs < ezs; zs++) {
+		src = (uint8_t *) zs->zs_pa + zs->zs_inplace;
+		readsect(src, ZIMAGE_SECT + zs->zs_offset / SECTSIZE,
+			 (zs->zs_size + SECTSIZE - 1) / SECTSIZE);
+		if ((zs->zs_flags & ZSEG_LZ4)
+		    && lz4_decode((uint8_t *) zs->zs_pa, src, zs->zs_size)
+		       != (uint8_t *) zs->zs_pa + zs->zs_filesz)
+			goto bad;
+		// the BSS is not in the payload at all
+		stosb((uint8_t *) zs->zs_pa + zs->zs_filesz, 0,
+		      zs->zs_memsz - zs->zs_filesz);
+		stamp();
+	}
+
+	// boot.S already told the kernel it need not clear its BSS
+	// again; tell it where the ELF file with its debug information is
+	BOOTINFO->bi_flags |= BI_ELFSECT;
+	BOOTINFO->bi_elfsect = ZIMAGE_SECT + ZHDR->z_elfoffset / SECTSIZE;
+
+	// call the entry point from the payload header
+	// note: does not return!
+	((void (*)(void)) (ZHDR->z_entry))();
+
+bad:
+	outw(0x8A00, 0x8A00);
+	outw(0x8A00, 0x8E00);
+	while (1)
+		/* do nothing */;
+}
+
+// Append the low half of the TSC to the struct Bootinfo, if it has room.
+static void
+stamp(void)
+{
+	uint32_t *p = (uint32_t *) BOOTINFO->bi_tscend;
+
+	if (p < BOOTINFO->bi_tsc + BI_NTSC) {
+		*p++ = read_tsc();
+		BOOTINFO->bi_tscend = (uint32_t) p;
+	}
+}
+
+// Decode the LZ4 block 'src' of 'size' bytes into 'dst'.
+// Returns a pointer just past the last byte written.
+//
+// Each sequence is a token byte (literal length in the high nibble,
+// match length minus 4 in the low nibble; 15 means more length bytes
+// follow), the literals, then a 2-byte little-endian match offset.
+// The last sequence stops after its literals.
+static uint8_t *
+lz4_decode(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+	const uint8_t *end, *match;
+	uint32_t token, len;
+
+	end = src + size;
+	while (src < end) {
+		token = *src++;
+
+		if ((len = token >> 4) == 15)
+			do
+				len += *src;
+			while (*src++ == 255);
+		// copy forward one byte at a time: when decoding in place,
+		// each byte written may be the one just read
+		while (len-- > 0)
+			*dst++ = *src++;
+		if (src >= end)
+			break;
+
+		match = dst - (src[0] | (src[1] << 8));
+		src += 2;
+		if ((len = token & 15) == 15)
+			do
+				len += *src;
+			while (*src++ == 255);
+		// matches may overlap their own output
+		for (len += 4; len > 0; len--)
+			*dst++ = *match++;
+	}
+	return dst;
+}
+
+static void
+waitdisk(void)
+{
+	// wait for disk ready
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+		/* do nothing */;
+}
+
+// Read 'nsect' consecutive sectors starting at sector 'offset' into
+// 'dst', using as few disk commands as possible.
+static void
+readsect(void *dst, uint32_t offset, uint32_t nsect)
+{
+	uint8_t *p;
+	uint32_t i, n;
+
+	p = dst;
+	while (nsect > 0) {
+		n = nsect < MAXSECTS ? nsect : MAXSECTS;
+
+		// wait for disk to be ready
+		waitdisk();
+
+		outb(0x1F2, n);		// count; 0 means 256
+		outb(0x1F3, offset);
+		outb(0x1F4, offset >> 8);
+		outb(0x1F5, offset >> 16);
+		outb(0x1F6, (offset >> 24) | 0xE0);
+		outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+		for (i = 0; i < n; i++, p += SECTSIZE) {
+			waitdisk();
+			insl(0x1F0, p, SECTSIZE/4);
+		}
+		nsect -= n;
+		offset += n;
+	}
+}
@@ -0,0 +1,50 @@
+#ifndef JOS_INC_BOOTINFO_H
+#define JOS_INC_BOOTINFO_H
+
+// Our boot loaders (boot/boot.S, boot/main.c and boot/zboot.c) leave a
+// struct Bootinfo at physical address BOOTINFO_PA, in otherwise unused
+// conventional memory, to tell the kernel what they have already done
+// for it and when (see kern/boottime.c).  A kernel started some other
+// way (e.g., by GRUB) finds no BOOTINFO_MAGIC there and must assume
+// nothing.
+
+#define BOOTINFO_PA	0x6000
+#define BOOTINFO_MAGIC	0x544F4F42U	/* "BOOT" in little endian */
+
+#ifndef __ASSEMBLER__
+
+#define BI_NTSC		16
+
+// boot/boot.S fills in the fields up to bi_tscend itself, in order, so
+// their layout must not change.
+struct Bootinfo {
+	uint32_t bi_magic;	// BOOTINFO_MAGIC if a JOS loader filled it in
+	uint32_t bi_flags;	// BI_*
+	uint32_t bi_elfsect;	// first disk sector of the kernel ELF file
+	uint64_t bi_tsc0;	// TSC as boot.S called bootmain
+	uint32_t bi_tscend;	// address just past the last bi_tsc[] entry
+	uint32_t bi_tsc[BI_NTSC]; // low 32 bits of the TSC after each
+				// readseg in boot/main.c (which has no
+				// room to check for overflow, but makes
+				// only a few), then after each segment
+				// zboot unpacks
+	uint32_t bi_zbootidx;	// first of bi_tsc[] that zboot took
+};
+
+// The loaders run with paging off and use this directly;
+// the kernel finds it at KERNBASE + BOOTINFO_PA.
+#define BOOTINFO	((struct Bootinfo *) BOOTINFO_PA)
+
+#endif /* !__ASSEMBLER__ */
+
+// Values for Bootinfo::bi_flags
+#define BI_BSSZERO	0x1	// [p_filesz, p_memsz) of every segment is zero
+				// by the time the loader enters the kernel;
+				// a promise about the loader, which may set
+				// it before doing the work (boot/boot.S does)
+#define BI_ELFSECT	0x2	// bi_elfsect is valid; if not, the kernel ELF
+				// file starts at sector 1 (see boot/main.c)
+#define BI_TSC		0x4	// bi_tsc0 and bi_tscend (and bi_tsc) are valid
+#define BI_ZBOOT	0x8	// bi_zbootidx is valid
+
+#endif /* !JOS_INC_BOOTINFO_H */
@@ -138,10 +138,48 @@
 // The location of the user-level STABS data structure
 #define USTABDATA	(PTSIZE / 2)
 
+// Physical address of startup code for non-boot CPUs (APs)
+#define MPENTRY_PADDR	0x7000
+
 #ifndef __ASSEMBLER__
 
 typedef uint32_t pte_t;
 typedef uint32_t pde_t;
 
+/*
+ * Page descriptor structures, mapped at UPAGES.
+ * Read/write to the kernel, read-only to user programs.
+ *
+ * Each struct PageInfo stores metadata for one physical page.
+ * Is it NOT the physical page itself, but there is a one-to-one
+ * correspondence between physical pages and struct PageInfo's.
+ * You can map a struct PageInfo * to the corresponding physical address
+ * with page2pa() in kern/pmap.h.
+ *
+ * Free pages are kept by the buddy allocator in kern/pmap.c in blocks
+ * of 2^order contiguous pages; only the first page of a block is on a
+ * free list, and only its pp_order and pp_flags are meaningful.
+ */
+struct PageInfo {
+	// Next and previous block on the free list.
+	struct PageInfo *pp_link;
+	struct PageInfo *pp_prev;
+
+	// pp_ref is the count of pointers (usually in page table entries)
+	// to this page, for pages allocated using page_alloc.
+	// Pages allocated at boot time using pmap.c's
+	// boot_alloc do not have valid reference count fields.
+
+	uint16_t pp_ref;
+
+	// Log2 of the size in pages of the block this page heads.
+	uint8_t pp_order;
+	uint8_t pp_flags;
+};
+
+// pp_flags
+#define PP_FREE		0x01	// heads a block on a buddy free list
+#define PP_MAG		0x02	// cached in a per-CPU magazine
+
 #endif /* !__ASSEMBLER__ */
 #endif /* !JOS_INC_MEMLAYOUT_H */
@@ -1,6 +1,7 @@
 #ifndef JOS_INC_STDIO_H
 #define JOS_INC_STDIO_H
 
+#include <inc/types.h>
 #include <inc/stdarg.h>
 
 #ifndef NULL
@@ -15,12 +16,54 @@ int	iscons(int fd);
 // lib/printfmt.c
 void	printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
 void	vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list);
+
+// A format that is parsed once, the first time it is printed, and
+// from then on replayed from pf_ops without looking at the format
+// again.  pf_fmt must stay put, as string constants do.  Formats that
+// can't be replayed (too many conversions, or a '*' width followed by
+// more of the specification) just go through vprintfmt every time.
+#define PRINTFMT_MAXOPS	16
+
+struct Printfspec {
+	char ps_conv;		// conversion character, or 0
+	char ps_padc;
+	uint8_t ps_lflag;
+	uint8_t ps_altflag;
+	int ps_width;
+	int ps_precision;
+	uint8_t ps_nstar;	// '*' arguments to take first,
+	uint8_t ps_wstar;	//   which of them is the width (from 1),
+	uint8_t ps_pstar;	//   and which the precision
+};
+
+struct Printfop {
+	uint16_t po_off;	// offset and length in the format of
+	uint16_t po_len;	//   the literal text before po_spec
+	struct Printfspec po_spec;
+};
+
+struct Printfmt {
+	const char *pf_fmt;
+	int pf_nops;		// 0 until parsed; -1 if it can't be
+	struct Printfop pf_ops[PRINTFMT_MAXOPS];
+};
+
+void	vprintfmtc(void (*putch)(int, void*), void *putdat, struct Printfmt *pf, va_list);
 int	snprintf(char *str, int size, const char *fmt, ...);
 int	vsnprintf(char *str, int size, const char *fmt, va_list);
 
 // lib/printf.c
 int	cprintf(const char *fmt, ...);
 int	vcprintf(const char *fmt, va_list);
+int	cprintfc(struct Printfmt *pf, ...);
+int	vcprintfc(struct Printfmt *pf, va_list);
+
+// cprintf for hot call sites: the format, which must be a string
+// constant, is parsed only the first time through (see struct Printfmt).
+#define cprintf_cached(fmt, ...) ({					\
+	static struct Printfmt __pf = { (fmt) };			\
+	cprintfc(&__pf, ##__VA_ARGS__);					\
+})
 
 // lib/fprintf.c
 int	printf(const char *fmt, ...);
@@ -22,4 +22,6 @@ void *	memfind(const void *s, int c, size_t len);
 
 long	strtol(const char *s, char **endptr, int base);
 
+void	string_init(void);
+
 #endif /* not JOS_INC_STRING_H */
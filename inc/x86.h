@@ -60,6 +60,15 @@ insl(int port, void *addr, int cnt)
 		     : "memory", "cc");
 }
 
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+	asm volatile("cld\n\trep\n\tstosb"
+		     : "=D" (addr), "=c" (cnt)
+		     : "0" (addr), "1" (cnt), "a" (data)
+		     : "memory", "cc");
+}
+
 static inline void
 outb(int port, uint8_t data)
 {
@@ -248,6 +257,20 @@ read_tsc(void)
 	return tsc;
 }
 
+static inline uint64_t
+rdmsr(uint32_t msr)
+{
+	uint64_t val;
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+	return val;
+}
+
+static inline void
+wrmsr(uint32_t msr, uint64_t val)
+{
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
 static inline uint32_t
 xchg(volatile uint32_t *addr, uint32_t newval)
 {
@@ -0,0 +1,40 @@
+#ifndef JOS_INC_ZIMAGE_H
+#define JOS_INC_ZIMAGE_H
+
+// Layout of the compressed kernel disk image (obj/kern/kernelz.img).
+// boot/mkzimage.c builds it; boot/zboot.c unpacks it.
+//
+//	sector 0			boot loader (boot.S and main.c)
+//	sectors 1 .. ZIMAGE_SECT-1	second stage (boot/zboot.c), as ELF
+//	sector ZIMAGE_SECT onward	struct Zimage, then segment data,
+//					then a copy of the kernel ELF file
+//
+// zboot never reads the copy of the ELF file; it is there so that the
+// kernel can find its debug information (see kern/kdebug.c).
+
+#define ZIMAGE_MAGIC	0x5A534F4AU	/* "JOSZ" in little endian */
+#define ZIMAGE_SECT	32		// first sector of the payload
+#define ZIMAGE_MAXSEG	8
+
+struct Zseg {
+	uint32_t zs_pa;		// physical load address
+	uint32_t zs_filesz;	// size of the segment's contents
+	uint32_t zs_memsz;	// size of the segment in memory
+	uint32_t zs_flags;	// ZSEG_*
+	uint32_t zs_offset;	// payload offset of the data (sector aligned)
+	uint32_t zs_size;	// size of the data on disk
+	uint32_t zs_inplace;	// read the data to zs_pa + zs_inplace
+};
+
+// Values for Zseg::zs_flags
+#define ZSEG_LZ4	0x1	// data is an LZ4 block, not raw contents
+
+struct Zimage {
+	uint32_t z_magic;	// must equal ZIMAGE_MAGIC
+	uint32_t z_entry;	// kernel entry point (physical)
+	uint32_t z_nseg;
+	struct Zseg z_seg[ZIMAGE_MAXSEG];
+	uint32_t z_elfoffset;	// payload offset of the ELF file (sector aligned)
+};
+
+#endif /* !JOS_INC_ZIMAGE_H */
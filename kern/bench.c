@@ -0,0 +1,205 @@
+// Microbenchmarks.
+//
+// bench_run() times the string routines, cprintf on each console
+// device, and debuginfo_eip() with the TSC.  It prints one line per
+// benchmark,
+//
+//	bench: <name> <cycles>
+//
+// with the cycles one operation took, and "bench: done" at the end.
+// grade-bench parses these lines and compares them with a baseline,
+// so the names and the format have to stay put.
+//
+// A string benchmark runs its operation in BENCH_NTRIAL batches with
+// interrupts disabled and keeps the fastest batch.  cprintf has to
+// run with interrupts enabled, since the serial port is drained by
+// its interrupt, so the time for one long batch is reported instead.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/bench.h>
+#include <kern/console.h>
+#include <kern/kdebug.h>
+#include <kern/monitor.h>
+#include <kern/pmap.h>
+#include <kern/trap.h>
+
+#define BENCH_NTRIAL	5	// batches per string benchmark
+#define BENCH_BATCH	65536	// bytes a string benchmark batch covers
+#define BENCH_ORDER	3	// 2^BENCH_ORDER pages per buffer
+#define BENCH_NLINE	64	// lines per cprintf benchmark
+#define BENCH_NLOOKUP	1000	// debuginfo_eip calls
+
+enum { B_MEMSET, B_MEMMOVE, B_MEMCMP };
+
+static const char * const opnames[] = {
+	[B_MEMSET] = "memset",
+	[B_MEMMOVE] = "memmove",
+	[B_MEMCMP] = "memcmp",
+};
+
+static const size_t sizes[] = { 16, 64, 256, 1024, 4096, 16384 };
+
+// destination and source misalignment
+static const int aligns[][2] = { { 0, 0 }, { 1, 0 }, { 0, 3 } };
+
+static const char *prefix;
+static char *bufa, *bufb;
+static volatile int sinkhole;	// keeps memcmp's result alive
+
+static bool
+selected(const char *name)
+{
+	return !prefix || strncmp(name, prefix, strlen(prefix)) == 0;
+}
+
+static void
+report(const char *name, uint64_t cycles)
+{
+	cprintf("bench: %s %llu\n", name, cycles);
+}
+
+// Cycles one 'op' of 'n' bytes takes, at the given misalignments.
+static uint64_t
+time_string(int op, size_t n, int da, int sa)
+{
+	char *dst = bufa + da, *src = bufb + sa;
+	uint64_t t, best = ~0ULL;
+	uint32_t eflags;
+	int trial, i, iters;
+
+	iters = MAX(BENCH_BATCH / n, 16);
+	eflags = read_eflags();
+	asm volatile("cli");
+	for (trial = 0; trial < BENCH_NTRIAL; trial++) {
+		t = read_tsc();
+		switch (op) {
+		case B_MEMSET:
+			for (i = 0; i < iters; i++)
+				memset(dst, 0, n);
+			break;
+		case B_MEMMOVE:
+			for (i = 0; i < iters; i++)
+				memmove(dst, src, n);
+			break;
+		case B_MEMCMP:
+			// equal all the way, so the whole length is compared
+			for (i = 0; i < iters; i++)
+				sinkhole = memcmp(dst, src, n);
+			break;
+		}
+		t = read_tsc() - t;
+		best = MIN(best, t);
+	}
+	write_eflags(eflags);
+	return best / iters;
+}
+
+static void
+bench_string(void)
+{
+	char name[32];
+	int op, s, a;
+
+	for (op = 0; op < ARRAY_SIZE(opnames); op++)
+		for (s = 0; s < ARRAY_SIZE(sizes); s++)
+			for (a = 0; a < ARRAY_SIZE(aligns); a++) {
+				// memset has no source
+				if (op == B_MEMSET && aligns[a][1])
+					continue;
+				snprintf(name, sizeof(name), "%s/%u/%d,%d",
+					 opnames[op], sizes[s],
+					 aligns[a][0], aligns[a][1]);
+				if (!selected(name))
+					continue;
+				memset(bufa, 0, PGSIZE << BENCH_ORDER);
+				memset(bufb, 0, PGSIZE << BENCH_ORDER);
+				report(name, time_string(op, sizes[s],
+							 aligns[a][0],
+							 aligns[a][1]));
+			}
+}
+
+// Print BENCH_NLINE typical lines to each console device by itself,
+// and to none at all, which leaves the cost of formatting.
+static void
+bench_cprintf(void)
+{
+	char name[32];
+	uint64_t t;
+	int i, line, mask;
+
+	mask = cons_getsinks();
+	for (i = -1; i < NCONSSINK; i++) {
+		if (i >= 0 && !cons_sink(i)->cs_present)
+			continue;
+		snprintf(name, sizeof(name), "cprintf/%s",
+			 i < 0 ? "none" : cons_sink(i)->cs_name);
+		if (!selected(name))
+			continue;
+		cons_setsinks(i < 0 ? 0 : 1 << i);
+		t = read_tsc();
+		for (line = 0; line < BENCH_NLINE; line++)
+			cprintf("# bench line %2d: %08x %08x %5d %s\n", line,
+				(uint32_t) t, (uint32_t) bufa, line * 1000, name);
+		t = read_tsc() - t;
+		cons_setsinks(mask);
+		report(name, t / BENCH_NLINE);
+	}
+}
+
+static void
+bench_debuginfo(void)
+{
+	const uintptr_t eips[] = {
+		(uintptr_t) mon_backtrace + 8, (uintptr_t) vprintfmt + 16,
+		(uintptr_t) memset + 4, (uintptr_t) debuginfo_eip + 32,
+		(uintptr_t) page_alloc + 8, (uintptr_t) print_trapframe + 12,
+		(uintptr_t) cons_write + 4, (uintptr_t) bench_run + 8,
+	};
+	struct Eipdebuginfo info;
+	uint64_t t;
+	int i;
+
+	if (!selected("debuginfo_eip"))
+		return;
+	// the first call may have to read the debug info from disk
+	debuginfo_eip(eips[0], &info);
+	t = read_tsc();
+	for (i = 0; i < BENCH_NLOOKUP; i++)
+		debuginfo_eip(eips[i % ARRAY_SIZE(eips)], &info);
+	t = read_tsc() - t;
+	report("debuginfo_eip", t / BENCH_NLOOKUP);
+}
+
+// Run the benchmarks whose names start with 'pfx', or all of them if
+// it is NULL.
+void
+bench_run(const char *pfx)
+{
+	struct PageInfo *pa, *pb;
+
+	pa = page_alloc_order(BENCH_ORDER, 0);
+	pb = page_alloc_order(BENCH_ORDER, 0);
+	if (!pa || !pb) {
+		cprintf("bench: out of memory\n");
+		if (pa)
+			page_free(pa);
+		if (pb)
+			page_free(pb);
+		return;
+	}
+	bufa = page2kva(pa);
+	bufb = page2kva(pb);
+	prefix = pfx;
+
+	bench_string();
+	bench_debuginfo();
+	bench_cprintf();
+	cprintf("bench: done\n");
+
+	page_free(pa);
+	page_free(pb);
+}
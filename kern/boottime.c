@@ -0,0 +1,105 @@
+// Boot-phase timing.
+//
+// Every stage of the boot notes the TSC as it goes: boot/boot.S before
+// bootmain, boot/main.c after each disk read and boot/zboot.c after
+// each segment it unpacks, all in the struct Bootinfo (inc/bootinfo.h);
+// then kern/entry.S once paging is on and i386_init() and monitor()
+// with boot_stamp().  boottime_print() puts them on one timeline,
+// counted from the TSC's zero.  That is the CPU's reset if nothing
+// wrote the TSC since, so the first step is the time the BIOS took.
+
+#include <inc/stdio.h>
+#include <inc/memlayout.h>
+#include <inc/bootinfo.h>
+
+#include <kern/boottime.h>
+#include <kern/kclock.h>
+
+// In .data, not the BSS, since BT_ENTRY and BT_INIT are stamped
+// before i386_init() clears the BSS.
+uint64_t boot_tsc[NBOOTTSC] __attribute__((section(".data")));
+
+static const char * const phasenames[] = {
+	[BT_ENTRY] = "kernel entry",
+	[BT_INIT] = "i386_init",
+	[BT_BSS] = "BSS cleared",
+	[BT_CONS] = "console up",
+	[BT_MONITOR] = "monitor prompt",
+};
+
+static uint64_t hz;
+static uint64_t last;
+
+// Print 'cycles' in milliseconds, or in cycles if the TSC's rate is
+// unknown.
+static void
+print_time(uint64_t cycles)
+{
+	uint64_t us;
+
+	if (!hz) {
+		cprintf(" %12llu", cycles);
+		return;
+	}
+	us = cycles * 1000000 / hz;
+	cprintf(" %8llu.%03llu", us / 1000, us % 1000);
+}
+
+static void
+print_step(const char *name, int n, uint64_t tsc)
+{
+	char buf[24];
+
+	if (n)
+		snprintf(buf, sizeof(buf), "%s %d", name, n);
+	else
+		snprintf(buf, sizeof(buf), "%s", name);
+	cprintf("  %-18s", buf);
+	print_time(tsc);
+	print_time(tsc - last);
+	cprintf("\n");
+	last = tsc;
+}
+
+// Print the time from reset to each stamp, and since the one before.
+void
+boottime_print(void)
+{
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO_PA);
+	uint32_t ntsc, zidx, i;
+	uint64_t tsc;
+
+	hz = kclock_tsc_hz();
+	if (hz)
+		cprintf("TSC runs at %llu.%03llu MHz (timed against the PIT)\n",
+			hz / 1000000, hz / 1000 % 1000);
+	else
+		cprintf("TSC rate unknown; times are in cycles\n");
+	cprintf("  %-18s %12s %12s\n", "step", hz ? "at ms" : "at",
+		hz ? "took ms" : "took");
+
+	last = 0;
+	if (bi->bi_magic == BOOTINFO_MAGIC && (bi->bi_flags & BI_TSC)) {
+		ntsc = (bi->bi_tscend - BOOTINFO_PA
+			- offsetof(struct Bootinfo, bi_tsc)) / sizeof(uint32_t);
+		ntsc = MIN(ntsc, BI_NTSC);
+		zidx = (bi->bi_flags & BI_ZBOOT) ? bi->bi_zbootidx : ntsc;
+
+		print_step("bootmain", 0, bi->bi_tsc0);
+		// The loaders keep only the low 32 bits, which is enough
+		// as long as each step takes under 2^32 cycles.
+		tsc = bi->bi_tsc0;
+		for (i = 0; i < ntsc; i++) {
+			tsc += (uint32_t) (bi->bi_tsc[i] - (uint32_t) tsc);
+			if (i < zidx)
+				print_step("boot read", i + 1, tsc);
+			else
+				print_step("zboot segment", i - zidx + 1, tsc);
+		}
+	} else
+		cprintf("  (no loader timestamps)\n");
+
+	for (i = 0; i < NBOOTTSC; i++)
+		if (boot_tsc[i])
+			print_step(phasenames[i], 0, boot_tsc[i]);
+}
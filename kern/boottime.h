@@ -0,0 +1,27 @@
+#ifndef JOS_KERN_BOOTTIME_H
+#define JOS_KERN_BOOTTIME_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/x86.h>
+
+// Points in the kernel's own boot that boot_stamp() marks.
+// kern/entry.S stamps BT_ENTRY itself and relies on it being 0.
+enum {
+	BT_ENTRY,		// paging enabled
+	BT_INIT,		// i386_init called
+	BT_BSS,			// BSS cleared
+	BT_CONS,		// console initialized
+	BT_MONITOR,		// first monitor prompt
+	NBOOTTSC
+};
+
+extern uint64_t boot_tsc[NBOOTTSC];
+
+#define boot_stamp(phase)	(boot_tsc[phase] = read_tsc())
+
+void boottime_print(void);
+
+#endif /* !JOS_KERN_BOOTTIME_H */
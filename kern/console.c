@@ -6,12 +6,21 @@
 #include <inc/string.h>
 #include <inc/assert.h>
 #include <inc/consc.h>
+#include <inc/trap.h>
 
 #include <kern/console.h>
+#include <kern/picirq.h>
 
 static void cons_intr(int (*proc)(void));
 static void cons_putc(int c);
 
+static struct Conssink sinks[NCONSSINK] = {
+	[CONS_SERIAL] = { "serial" },
+	[CONS_LPT] = { "lpt" },
+	[CONS_CGA] = { "cga" },
+};
+static int cons_mask;	// 1 << CONS_* for each device in use
+
 // Stupid I/O delay routine necessitated by historical PC design flaws
 static void
 delay(void)
@@ -32,8 +41,14 @@ delay(void)
 #define COM_DLM		1	// Out: Divisor Latch High (DLAB=1)
 #define COM_IER		1	// Out: Interrupt Enable Register
 #define   COM_IER_RDI	0x01	//   Enable receiver data interrupt
+#define   COM_IER_TXRDY	0x02	//   Enable transmit buffer empty interrupt
 #define COM_IIR		2	// In:	Interrupt ID Register
+#define   COM_IIR_NOPEND 0x01	//   No interrupt pending
+#define   COM_IIR_FIFO	0xC0	//   FIFOs enabled (16550A only)
 #define COM_FCR		2	// Out: FIFO Control Register
+#define   COM_FCR_ENABLE 0x01	//   Enable the FIFOs
+#define   COM_FCR_RXCLR	0x02	//   Clear the receive FIFO
+#define   COM_FCR_TXCLR	0x04	//   Clear the transmit FIFO
 #define COM_LCR		3	// Out: Line Control Register
 #define	  COM_LCR_DLAB	0x80	//   Divisor latch access bit
 #define	  COM_LCR_WLEN8	0x03	//   Wordlength: 8 bits
@@ -46,8 +61,25 @@ delay(void)
 #define   COM_LSR_TXRDY	0x20	//   Transmit buffer avail
 #define   COM_LSR_TSRE	0x40	//   Transmitter off
 
+#define COM_TXFIFO	16	// Bytes the 16550A takes per TXRDY
+
 static bool serial_exists;
 
+// Output waiting to be sent.  The TXRDY interrupt refills the UART's
+// transmit FIFO from here, so cprintf need not wait on the line speed.
+// rpos and wpos count bytes ever read and written, and are taken
+// modulo SERIAL_TXBUFSIZE (a power of 2) to index buf.
+#define SERIAL_TXBUFSIZE 1024
+
+static struct {
+	uint8_t buf[SERIAL_TXBUFSIZE];
+	uint32_t rpos;
+	uint32_t wpos;
+} serial_tx;
+
+static int serial_txfifo = 1;	// COM_TXFIFO if the FIFOs work
+static bool serial_txintr;	// COM_IER_TXRDY is on
+
 static int
 serial_proc_data(void)
 {
@@ -56,31 +88,110 @@ serial_proc_data(void)
 	return inb(COM1+COM_RX);
 }
 
-void
-serial_intr(void)
+// Move as many bytes from serial_tx to the UART as its transmit FIFO
+// holds.  The caller has seen COM_LSR_TXRDY, or given up waiting.
+static void
+serial_tx_fill(void)
 {
-	if (serial_exists)
-		cons_intr(serial_proc_data);
+	int i;
+
+	for (i = 0; i < serial_txfifo && serial_tx.rpos != serial_tx.wpos; i++)
+		outb(COM1 + COM_TX,
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
 }
 
 static void
-serial_putc(int c)
+serial_tx_wait(void)
 {
 	int i;
 
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+		sinks[CONS_SERIAL].cs_stalls++;
 	for (i = 0;
 	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
 	     i++)
 		delay();
+}
+
+// Refill the transmit FIFO if it has drained, and leave the TXRDY
+// interrupt on exactly as long as serial_tx has more to send.
+// Called with interrupts disabled.
+static void
+serial_tx_start(void)
+{
+	bool more;
+
+	if (inb(COM1 + COM_LSR) & COM_LSR_TXRDY)
+		serial_tx_fill();
+	more = serial_tx.rpos != serial_tx.wpos;
+	if (more != serial_txintr) {
+		serial_txintr = more;
+		outb(COM1 + COM_IER, COM_IER_RDI | (more ? COM_IER_TXRDY : 0));
+	}
+}
+
+void
+serial_intr(void)
+{
+	if (!serial_exists)
+		return;
+	// The PIC only sees the rising edge of the UART's interrupt
+	// line, so keep going until nothing is pending any more.
+	do {
+		cons_intr(serial_proc_data);
+		serial_tx_start();
+	} while (!(inb(COM1 + COM_IIR) & COM_IIR_NOPEND));
+}
+
+// Queue 'n' bytes from 'buf' for output.
+static void
+serial_write(const char *buf, int n)
+{
+	uint32_t eflags;
+	int i;
+
+	eflags = read_eflags();
+	asm volatile("cli");
 
-	outb(COM1 + COM_TX, c);
+	for (i = 0; i < n; i++) {
+		if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+			// full: make room the slow way
+			serial_tx_wait();
+			serial_tx_fill();
+		}
+		serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = buf[i];
+	}
+	sinks[CONS_SERIAL].cs_bytes += n;
+
+	if (serial_exists && (eflags & FL_IF))
+		serial_tx_start();
+	else {
+		// No interrupt is coming to drain the buffer (we are in
+		// an interrupt handler, in panic, or early in boot), so
+		// push everything out synchronously, in order.
+		while (serial_tx.rpos != serial_tx.wpos) {
+			serial_tx_wait();
+			serial_tx_fill();
+		}
+	}
+
+	write_eflags(eflags);
+}
+
+static void
+serial_putc(int c)
+{
+	char ch = c;
+
+	serial_write(&ch, 1);
 }
 
 static void
 serial_init(void)
 {
-	// Turn off the FIFO
-	outb(COM1+COM_FCR, 0);
+	// Turn on and clear the FIFOs; receive interrupts still come
+	// for every byte
+	outb(COM1+COM_FCR, COM_FCR_ENABLE | COM_FCR_RXCLR | COM_FCR_TXCLR);
 
 	// Set speed; requires DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_DLAB);
@@ -90,17 +201,23 @@ serial_init(void)
 	// 8 data bits, 1 stop bit, parity off; turn off DLAB latch
 	outb(COM1+COM_LCR, COM_LCR_WLEN8 & ~COM_LCR_DLAB);
 
-	// No modem controls
-	outb(COM1+COM_MCR, 0);
-	// Enable rcv interrupts
+	// No modem controls, but OUT2 gates the UART's interrupt
+	// line on PCs
+	outb(COM1+COM_MCR, COM_MCR_OUT2);
+	// Enable rcv interrupts; serial_tx_start turns on xmit
+	// interrupts when there is something to send
 	outb(COM1+COM_IER, COM_IER_RDI);
 
 	// Clear any preexisting overrun indications and interrupts
 	// Serial port doesn't exist if COM_LSR returns 0xFF
 	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
-	(void) inb(COM1+COM_IIR);
+	if ((inb(COM1+COM_IIR) & COM_IIR_FIFO) == COM_IIR_FIFO)
+		serial_txfifo = COM_TXFIFO;
 	(void) inb(COM1+COM_RX);
 
+	// Enable serial interrupts
+	if (serial_exists)
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
 }
 
 
@@ -116,9 +233,28 @@ lpt_putc(int c)
 
 	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
 		delay();
+	if (i > 0)
+		sinks[CONS_LPT].cs_stalls++;
+	if (i == 12800) {
+		// Nothing is listening (or it's off): stop paying for
+		// the timeout on every byte.  "console lpt" turns it
+		// back on.
+		cons_mask &= ~(1 << CONS_LPT);
+		return;
+	}
 	outb(0x378+0, c);
 	outb(0x378+2, 0x08|0x04|0x01);
 	outb(0x378+2, 0x08);
+	sinks[CONS_LPT].cs_bytes++;
+}
+
+static void
+lpt_init(void)
+{
+	// The data register reads back the last byte written to it,
+	// if there is a parallel port at all
+	outb(0x378+0, 0xAA);
+	sinks[CONS_LPT].cs_present = (inb(0x378+0) == 0xAA);
 }
 
 
@@ -126,9 +262,36 @@ lpt_putc(int c)
 
 /***** Text-mode CGA/VGA display output *****/
 
+// The display adapter has 32KB of text memory, much more than one
+// screen.  Output runs down through the first CRT_VROWS rows of it;
+// scrolling just moves the 6845's start address a line further, and
+// only when the screen reaches the end of those rows is it copied back
+// to the top.  The lines that scroll off the screen stay in video
+// memory until then, and are saved in crt_hist when the copy happens,
+// so Shift-PgUp can show them.  The last CRT_SIZE cells of video
+// memory hold the screen cga_scrollback draws from crt_hist.
+//
+// A monochrome adapter has only 4KB, just the screen: output runs
+// through crt_vend = CRT_SIZE cells there, so every scroll is a copy,
+// and there is no room to show the history.
+#define CRT_VROWS	(0x8000 / (2 * CRT_COLS) - CRT_ROWS)
+#define CRT_VIEW	(CRT_VROWS * CRT_COLS)
+#define CRT_NHIST	256		// lines of history kept in RAM
+
 static unsigned addr_6845;
 static uint16_t *crt_buf;
-static uint16_t crt_pos;
+static uint16_t crt_vend;	// end of the cells output runs through
+static uint16_t crt_pos;	// cursor, as an offset into crt_buf
+static uint16_t crt_start;	// first cell on the screen
+static uint16_t crt_shown;	// start address the 6845 has
+static uint32_t crt_nscrolled;	// lines ever scrolled off the screen
+static int crt_back;		// lines cga_scrollback is showing above them
+
+// Lines saved from video memory, oldest first: line i (counting the
+// lines that scrolled off the screen since boot) is in row
+// i % CRT_NHIST, and video memory row r holds line crt_nhist + r.
+static uint16_t crt_hist[CRT_NHIST][CRT_COLS];
+static uint32_t crt_nhist;
 
 static void
 cga_init(void)
@@ -143,9 +306,11 @@ cga_init(void)
 	if (*cp != 0xA55A) {
 		cp = (uint16_t*) (KERNBASE + MONO_BUF);
 		addr_6845 = MONO_BASE;
+		crt_vend = CRT_SIZE;
 	} else {
 		*cp = was;
 		addr_6845 = CGA_BASE;
+		crt_vend = CRT_VIEW;
 	}
 
 	/* Extract cursor location */
@@ -156,12 +321,57 @@ cga_init(void)
 
 	crt_buf = (uint16_t*) cp;
 	crt_pos = pos;
+
+	/* Show the screen from the start of video memory */
+	outb(addr_6845, 12);
+	outb(addr_6845 + 1, 0);
+	outb(addr_6845, 13);
+	outb(addr_6845 + 1, 0);
+	crt_start = crt_shown = 0;
+	sinks[CONS_CGA].cs_present = 1;
 }
 
+// Program the 6845 to show video memory from cell 'start' on.
+static void
+cga_show(uint16_t start)
+{
+	if (start == crt_shown)
+		return;
+	outb(addr_6845, 12);
+	outb(addr_6845 + 1, start >> 8);
+	outb(addr_6845, 13);
+	outb(addr_6845 + 1, start);
+	crt_shown = start;
+}
 
+// Scroll the screen up a line.
+static void
+cga_scroll(void)
+{
+	uint32_t i, top = crt_start / CRT_COLS;
+
+	if (crt_start + CRT_SIZE + CRT_COLS > crt_vend) {
+		// Out of video memory: save the lines above the screen
+		// and the one leaving it now, and start over at the top.
+		for (i = 0; i <= top; i++, crt_nhist++)
+			memmove(crt_hist[crt_nhist % CRT_NHIST],
+				crt_buf + i * CRT_COLS,
+				CRT_COLS * sizeof(uint16_t));
+		memmove(crt_buf, crt_buf + crt_start + CRT_COLS,
+			(CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+		crt_pos -= crt_start + CRT_COLS;
+		crt_start = 0;
+	} else
+		crt_start += CRT_COLS;
+
+	for (i = crt_start + CRT_SIZE - CRT_COLS; i < crt_start + CRT_SIZE; i++)
+		crt_buf[i] = 0x0700 | ' ';
+	crt_nscrolled++;
+}
 
+// Put 'c' on the screen, but leave the cursor alone; see cga_cursor().
 static void
-cga_putc(int c)
+cga_emit(int c)
 {
 	// if no attribute given, then use black on white
 	if (!cons_c)
@@ -171,7 +381,7 @@ cga_putc(int c)
 
 	switch (c & 0xff) {
 	case '\b':
-		if (crt_pos > 0) {
+		if (crt_pos > crt_start) {
 			crt_pos--;
 			crt_buf[crt_pos] = (c & ~0xff) | ' ';
 		}
@@ -183,26 +393,30 @@ cga_putc(int c)
 		crt_pos -= (crt_pos % CRT_COLS);
 		break;
 	case '\t':
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
-		cons_putc(' ');
-		break;
+		// the other devices get the tab itself
+		cga_emit((c & ~0xff) | ' ');
+		cga_emit((c & ~0xff) | ' ');
+		cga_emit((c & ~0xff) | ' ');
+		cga_emit((c & ~0xff) | ' ');
+		cga_emit((c & ~0xff) | ' ');
+		return;
 	default:
 		crt_buf[crt_pos++] = c;		/* write the character */
 		break;
 	}
 
-	// What is the purpose of this?
-	if (crt_pos >= CRT_SIZE) {
-		int i;
+	if (crt_pos >= crt_start + CRT_SIZE)
+		cga_scroll();
 
-		memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
-		for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
-			crt_buf[i] = 0x0700 | ' ';
-		crt_pos -= CRT_COLS;
-	}
+	sinks[CONS_CGA].cs_bytes++;
+}
+
+static void
+cga_cursor(void)
+{
+	// new output brings the screen back from the scrollback
+	crt_back = 0;
+	cga_show(crt_start);
 
 	/* move that little blinky thing */
 	outb(addr_6845, 14);
@@ -211,6 +425,67 @@ cga_putc(int c)
 	outb(addr_6845 + 1, crt_pos);
 }
 
+static void
+cga_putc(int c)
+{
+	uint32_t eflags;
+
+	// keep the keyboard's scrollback keys away while we draw
+	eflags = read_eflags();
+	asm volatile("cli");
+	cga_emit(c);
+	cga_cursor();
+	write_eflags(eflags);
+}
+
+// Moving the cursor costs four port writes, so only do it once
+// 'buf' is all on the screen.
+static void
+cga_write(const char *buf, int n)
+{
+	uint32_t eflags;
+	int i;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	for (i = 0; i < n; i++)
+		cga_emit((uint8_t) buf[i]);
+	cga_cursor();
+	write_eflags(eflags);
+}
+
+// Show the screen 'lines' further back in the history (or forward,
+// if negative), as far as there is any.
+static void
+cga_scrollback(int lines)
+{
+	uint32_t i, line, maxback;
+
+	if (crt_vend < CRT_VIEW)
+		return;		// no room past the screen to draw on
+	maxback = crt_nscrolled - crt_nhist;
+	maxback += crt_nhist < CRT_NHIST ? crt_nhist : CRT_NHIST;
+	crt_back += lines;
+	if (crt_back < 0)
+		crt_back = 0;
+	if (crt_back > maxback)
+		crt_back = maxback;
+
+	// The screen's worth starting at 'line' is all in video memory
+	// unless some of it has been moved to crt_hist.
+	line = crt_nscrolled - crt_back;
+	if (line >= crt_nhist) {
+		cga_show(crt_start - crt_back * CRT_COLS);
+		return;
+	}
+	for (i = 0; i < CRT_ROWS; i++, line++)
+		memmove(crt_buf + CRT_VIEW + i * CRT_COLS,
+			line < crt_nhist ? crt_hist[line % CRT_NHIST]
+			: crt_buf + (line - crt_nhist) * CRT_COLS,
+			CRT_COLS * sizeof(uint16_t));
+	cga_show(CRT_VIEW);
+}
+
 
 /***** Keyboard input code *****/
 
@@ -358,6 +633,12 @@ kbd_proc_data(void)
 	}
 
 	// Process special keys
+	// Shift-PgUp, Shift-PgDn: look through the display's history
+	if ((shift & SHIFT) && (c == KEY_PGUP || c == KEY_PGDN)) {
+		cga_scrollback(c == KEY_PGUP ? CRT_ROWS / 2 : -CRT_ROWS / 2);
+		return 0;
+	}
+
 	// Ctrl-Alt-Del: reboot
 	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
 		cprintf("Rebooting!\n");
@@ -376,6 +657,9 @@ kbd_intr(void)
 static void
 kbd_init(void)
 {
+	// Drain the kbd buffer so that QEMU generates interrupts.
+	kbd_intr();
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_KBD));
 }
 
 
@@ -413,31 +697,103 @@ cons_intr(int (*proc)(void))
 int
 cons_getc(void)
 {
+	uint32_t eflags;
 	int c;
 
-	// poll for any pending input characters,
-	// so that this function works even when interrupts are disabled
-	// (e.g., when called from the kernel monitor).
-	serial_intr();
-	kbd_intr();
+	// keep the interrupt handlers off cons while we look at it
+	eflags = read_eflags();
+	asm volatile("cli");
+
+	// With interrupts on, the keyboard and serial interrupts fill
+	// the buffer.  Otherwise (e.g., when the kernel monitor runs
+	// after a panic) poll for any pending input characters.
+	if (!(eflags & FL_IF)) {
+		serial_intr();
+		kbd_intr();
+	}
 
 	// grab the next character from the input buffer.
+	c = 0;
 	if (cons.rpos != cons.wpos) {
 		c = cons.buf[cons.rpos++];
 		if (cons.rpos == CONSBUFSIZE)
 			cons.rpos = 0;
-		return c;
 	}
-	return 0;
+	write_eflags(eflags);
+	return c;
+}
+
+// Halt until an interrupt arrives, unless input already has.
+// Call with interrupts enabled.
+static void
+cons_wait(void)
+{
+	asm volatile("cli");
+	// sti takes effect only after the next instruction, so an
+	// interrupt that comes in after the check still ends the hlt
+	if (cons.rpos == cons.wpos)
+		asm volatile("sti; hlt");
+	else
+		asm volatile("sti");
 }
 
 // output a character to the console
 static void
 cons_putc(int c)
 {
-	serial_putc(c);
-	lpt_putc(c);
-	cga_putc(c);
+	if (cons_mask & (1 << CONS_SERIAL))
+		serial_putc(c);
+	if (cons_mask & (1 << CONS_LPT))
+		lpt_putc(c);
+	if (cons_mask & (1 << CONS_CGA))
+		cga_putc(c);
+}
+
+// Output 'n' bytes from 'buf' to the console.  This is cheaper than
+// cons_putc for each byte: the serial port takes them all into its
+// buffer at once and the display moves its cursor only at the end.
+void
+cons_write(const char *buf, int n)
+{
+	int i;
+
+	if (cons_mask & (1 << CONS_SERIAL))
+		serial_write(buf, n);
+	// lpt_putc may give up on the printer part way through
+	for (i = 0; i < n && (cons_mask & (1 << CONS_LPT)); i++)
+		lpt_putc((uint8_t) buf[i]);
+	if (cons_mask & (1 << CONS_CGA))
+		cga_write(buf, n);
+}
+
+// return the set of output devices in use, as 1 << CONS_* bits
+int
+cons_getsinks(void)
+{
+	return cons_mask;
+}
+
+// Send console output to the devices in 'mask' (1 << CONS_* bits)
+// only.  Devices cons_init did not find are left out.
+// Returns the new set.
+int
+cons_setsinks(int mask)
+{
+	int i;
+
+	for (i = 0; i < NCONSSINK; i++)
+		if (!sinks[i].cs_present)
+			mask &= ~(1 << i);
+	cons_mask = mask;
+	return mask;
+}
+
+// return the description and counters of output device 'sink'
+const struct Conssink *
+cons_sink(int sink)
+{
+	assert(sink >= 0 && sink < NCONSSINK);
+	return &sinks[sink];
 }
 
 // initialize the console devices
@@ -447,6 +803,10 @@ cons_init(void)
 	cga_init();
 	kbd_init();
 	serial_init();
+	lpt_init();
+
+	sinks[CONS_SERIAL].cs_present = serial_exists;
+	cons_setsinks(~0);
 
 	if (!serial_exists)
 		cprintf("Serial port does not exist!\n");
@@ -467,7 +827,8 @@ getchar(void)
 	int c;
 
 	while ((c = cons_getc()) == 0)
-		/* do nothing */;
+		if (read_eflags() & FL_IF)
+			cons_wait();
 	return c;
 }
 
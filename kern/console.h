@@ -17,8 +17,25 @@
 #define CRT_COLS	80
 #define CRT_SIZE	(CRT_ROWS * CRT_COLS)
 
+// Console output devices, as bit numbers in the cons_setsinks() mask
+#define CONS_SERIAL	0	// COM1
+#define CONS_LPT	1	// parallel port
+#define CONS_CGA	2	// text-mode display
+#define NCONSSINK	3
+
+struct Conssink {
+	const char *cs_name;
+	bool cs_present;	// cons_init found the device
+	uint32_t cs_bytes;	// bytes sent to the device
+	uint32_t cs_stalls;	// times output had to wait for the device
+};
+
 void cons_init(void);
 int cons_getc(void);
+void cons_write(const char *buf, int n);
+int cons_getsinks(void);
+int cons_setsinks(int mask);
+const struct Conssink *cons_sink(int sink);
 
 void kbd_intr(void); // irq 1
 void serial_intr(void); // irq 4
@@ -0,0 +1,538 @@
+// Driver for the boot disk, the master drive on the primary IDE channel.
+//
+// Requests wait on a queue kept in C-LOOK elevator order: ascending
+// sector numbers from where the last command left the head, then the
+// ones it has already passed, again in ascending order.
+//
+// When the disk sits behind a PCI bus-master IDE controller, the drive
+// moves the data itself (DMA) and interrupts when it is done, so the
+// CPU is free in the meantime.  Queued requests that continue each
+// other on disk in the same direction then go out as a single command,
+// each request's buffer described by its own entries in the PRD
+// (physical region descriptor) table.  Without a bus master, the
+// driver falls back to programmed I/O as in boot/main.c: requests are
+// carried out one at a time as they are submitted, with the CPU
+// copying every word.
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/trap.h>
+
+#include <kern/ide.h>
+#include <kern/pmap.h>
+#include <kern/picirq.h>
+#include <kern/spinlock.h>
+
+// Task file of the primary channel
+#define IDE_DATA	0x1F0
+#define IDE_NSECT	0x1F2
+#define IDE_LBA0	0x1F3
+#define IDE_LBA1	0x1F4
+#define IDE_LBA2	0x1F5
+#define IDE_DRIVE	0x1F6	// 0xE0 | LBA bits 24-27 selects the master
+#define IDE_CMD		0x1F7	// status when read
+#define IDE_CTL		0x3F6	// device control
+#define   IDE_CTL_NIEN	  0x02	//   drive interrupts off
+
+// Status bits
+#define IDE_BSY		0x80
+#define IDE_DRDY	0x40
+#define IDE_DF		0x20
+#define IDE_DRQ		0x08
+#define IDE_ERR		0x01
+
+// Commands
+#define IDE_CMD_READ		0x20
+#define IDE_CMD_WRITE		0x30
+#define IDE_CMD_READ_DMA	0xC8
+#define IDE_CMD_WRITE_DMA	0xCA
+#define IDE_CMD_IDENTIFY	0xEC
+
+// Bus-master registers of the primary channel, from the I/O base in BAR4
+#define BM_CMD		0x0
+#define   BM_CMD_START	  0x01
+#define   BM_CMD_READ	  0x08	//   transfer to memory
+#define BM_STATUS	0x2
+#define   BM_ST_ERR	  0x02	//   write 1 to clear
+#define   BM_ST_IRQ	  0x04	//   the drive interrupted; write 1 to clear
+#define BM_PRDT		0x4
+
+// PCI configuration space, through configuration mechanism #1
+#define PCI_CONF_ADDR	0xCF8
+#define PCI_CONF_DATA	0xCFC
+#define PCI_ID		0x00
+#define PCI_COMMAND	0x04
+#define   PCI_CMD_IO	  0x0001
+#define   PCI_CMD_MASTER  0x0004
+#define PCI_CLASS	0x08
+#define PCI_HEADER	0x0C
+#define   PCI_HDR_MULTIFN 0x00800000
+#define PCI_BAR4	0x20
+
+// A PRD table entry.  A region may not cross a 64KB boundary in
+// physical memory; a count of 0 means 64KB.
+struct Prd {
+	uint32_t prd_pa;
+	uint16_t prd_count;
+	uint16_t prd_flags;
+};
+#define PRD_EOT		0x8000	// last entry in the table
+
+#define IDE_NPRD	32
+#define IDE_NBATCH	8	// requests ide_read/ide_write keep in flight
+
+// The table must not cross 64KB either; aligning it to its size
+// makes sure of that.
+static struct Prd prdt[IDE_NPRD]
+	__attribute__((aligned(IDE_NPRD * sizeof(struct Prd))));
+
+static uint16_t bmbase;		// bus-master I/O base, 0 for PIO
+static uint32_t nsectors;	// size of the disk, 0 if there is none
+
+static struct spinlock ide_spinlock = SPINLOCK_INIT("ide_lock");
+static struct Idereq *queue;	// requests not yet started
+static struct Idereq *active;	// requests of the command in progress
+static uint32_t headpos;	// sector after the last one transferred
+
+static uint32_t
+ide_lock(void)
+{
+	uint32_t eflags = read_eflags();
+
+	asm volatile("cli");
+	spin_lock(&ide_spinlock);
+	return eflags;
+}
+
+static void
+ide_unlock(uint32_t eflags)
+{
+	spin_unlock(&ide_spinlock);
+	write_eflags(eflags);
+}
+
+static uint32_t
+pci_conf_read(int dev, int func, int reg)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+	return inl(PCI_CONF_DATA);
+}
+
+static void
+pci_conf_write(int dev, int func, int reg, uint32_t v)
+{
+	outl(PCI_CONF_ADDR, 0x80000000 | (dev << 11) | (func << 8) | reg);
+	outl(PCI_CONF_DATA, v);
+}
+
+// Look on PCI bus 0 for an IDE controller that can bus-master and has
+// its primary channel at the legacy ports and IRQ, where the boot disk
+// is.  Enable its bus mastering and return its bus-master I/O base,
+// or 0 if there is no such controller.
+static uint16_t
+pci_find_busmaster(void)
+{
+	int dev, func, nfunc;
+	uint32_t class, bar;
+
+	for (dev = 0; dev < 32; dev++) {
+		if ((pci_conf_read(dev, 0, PCI_ID) & 0xFFFF) == 0xFFFF)
+			continue;
+		nfunc = pci_conf_read(dev, 0, PCI_HEADER) & PCI_HDR_MULTIFN
+			? 8 : 1;
+		for (func = 0; func < nfunc; func++) {
+			if ((pci_conf_read(dev, func, PCI_ID) & 0xFFFF) == 0xFFFF)
+				continue;
+			// Mass storage, IDE; in the programming interface
+			// byte, bit 7 is bus mastering and bit 0 a
+			// primary channel in native (PCI) mode.
+			class = pci_conf_read(dev, func, PCI_CLASS);
+			if ((class >> 16) != 0x0101 || !(class & 0x8000)
+			    || (class & 0x100))
+				continue;
+			bar = pci_conf_read(dev, func, PCI_BAR4);
+			if (!(bar & 1) || !(bar & 0xFFFC))
+				continue;
+			// The top half of the register is status, whose
+			// bits are cleared by writing ones.
+			pci_conf_write(dev, func, PCI_COMMAND,
+				       (pci_conf_read(dev, func, PCI_COMMAND)
+					& 0xFFFF) | PCI_CMD_IO | PCI_CMD_MASTER);
+			return bar & 0xFFFC;
+		}
+	}
+	return 0;
+}
+
+// Wait for the drive to finish what it is doing.
+// Returns -E_IO if it reports an error.
+static int
+ide_wait_ready(void)
+{
+	int r;
+
+	while (((r = inb(IDE_CMD)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+		/* do nothing */;
+	return (r & (IDE_DF|IDE_ERR)) ? -E_IO : 0;
+}
+
+// Ask the drive for its parameters.  Fills in nsectors and returns
+// whether the drive can do DMA, or -E_IO if there is no drive.
+static int
+ide_identify(void)
+{
+	uint16_t id[256];
+	int i, r = 0;
+
+	outb(IDE_DRIVE, 0xE0);
+	outb(IDE_CMD, IDE_CMD_IDENTIFY);
+	// An empty channel reads as 0 or, with nothing driving the bus,
+	// as 0xFF, which looks busy forever.
+	for (i = 0; i < 100000 && ((r = inb(IDE_CMD)) & IDE_BSY); i++)
+		/* do nothing */;
+	if ((r & (IDE_BSY|IDE_DF|IDE_ERR)) || !(r & IDE_DRQ))
+		return -E_IO;
+	insw(IDE_DATA, id, 256);
+
+	// Words 60-61 count the sectors reachable with 28-bit LBA;
+	// bit 8 of word 49 says the drive supports DMA.
+	nsectors = id[60] | (uint32_t) id[61] << 16;
+	return (id[49] & 0x100) != 0;
+}
+
+static void
+ide_command(uint32_t secno, uint32_t nsecs, int cmd)
+{
+	outb(IDE_NSECT, nsecs);		// 0 means 256
+	outb(IDE_LBA0, secno);
+	outb(IDE_LBA1, secno >> 8);
+	outb(IDE_LBA2, secno >> 16);
+	outb(IDE_DRIVE, 0xE0 | ((secno >> 24) & 0x0F));
+	outb(IDE_CMD, cmd);
+}
+
+// Carry out a request with programmed I/O.
+static int
+ide_pio(struct Idereq *req)
+{
+	uint8_t *p = req->ir_buf;
+	uint32_t i;
+	int r;
+
+	if ((r = ide_wait_ready()) < 0)
+		return r;
+	ide_command(req->ir_secno, req->ir_nsecs,
+		    req->ir_write ? IDE_CMD_WRITE : IDE_CMD_READ);
+	for (i = 0; i < req->ir_nsecs; i++, p += SECTSIZE) {
+		if ((r = ide_wait_ready()) < 0)
+			return r;
+		if (req->ir_write)
+			outsl(IDE_DATA, p, SECTSIZE / 4);
+		else
+			insl(IDE_DATA, p, SECTSIZE / 4);
+	}
+	// A write is over only once the last sector is on disk
+	return req->ir_write ? ide_wait_ready() : 0;
+}
+
+// Describe req's buffer in prdt[] from entry n on.  Returns the
+// number of entries now in use, or -1 if the buffer does not fit.
+static int
+prd_fill(int n, struct Idereq *req)
+{
+	physaddr_t pa = PADDR(req->ir_buf);
+	uint32_t len, left = req->ir_nsecs * SECTSIZE;
+
+	for (; left > 0; n++, pa += len, left -= len) {
+		if (n == IDE_NPRD)
+			return -1;
+		len = MIN(left, 0x10000 - (pa & 0xFFFF));
+		prdt[n].prd_pa = pa;
+		prdt[n].prd_count = len;	// 64KB truncates to 0
+		prdt[n].prd_flags = 0;
+	}
+	return n;
+}
+
+// Mark every request in the list as done with status r.
+static void
+ide_complete(struct Idereq *req, int r)
+{
+	struct Idereq *next;
+
+	for (; req; req = next) {
+		next = req->ir_next;
+		req->ir_status = r;
+	}
+}
+
+// Start on the queue, if the drive is idle.  With DMA this issues one
+// command for the request at the head of the queue and the ones that
+// follow it on disk; with PIO it works through the whole queue.
+// Called with the lock held.
+static void
+ide_start(void)
+{
+	struct Idereq *req, *last;
+	uint32_t secno, nsecs;
+	int n, nprd, write;
+
+	while (!active && queue) {
+		req = active = last = queue;
+		queue = req->ir_next;
+		req->ir_next = NULL;
+		secno = req->ir_secno;
+		nsecs = req->ir_nsecs;
+		write = req->ir_write;
+		headpos = secno + nsecs;
+
+		if (!bmbase) {
+			active = NULL;
+			ide_complete(req, ide_pio(req));
+			continue;
+		}
+
+		nprd = prd_fill(0, req);
+		assert(nprd > 0);
+		while ((req = queue) && req->ir_secno == secno + nsecs
+		       && req->ir_write == write
+		       && nsecs + req->ir_nsecs <= IDE_MAXSECTS
+		       && (n = prd_fill(nprd, req)) > 0) {
+			queue = req->ir_next;
+			req->ir_next = NULL;
+			last = last->ir_next = req;
+			nsecs += req->ir_nsecs;
+			nprd = n;
+		}
+		prdt[nprd - 1].prd_flags = PRD_EOT;
+		headpos = secno + nsecs;
+
+		if (ide_wait_ready() < 0) {
+			req = active;
+			active = NULL;
+			ide_complete(req, -E_IO);
+			continue;
+		}
+		outl(bmbase + BM_PRDT, PADDR(prdt));
+		outb(bmbase + BM_CMD, write ? 0 : BM_CMD_READ);
+		outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+		ide_command(secno, nsecs,
+			    write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+		outb(bmbase + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+	}
+}
+
+// Finish the command in progress if the drive has signalled that it
+// is done, and start the next one.  Called with the lock held.
+static void
+ide_poll(void)
+{
+	struct Idereq *req;
+	uint8_t bmst, st;
+
+	if (!bmbase)
+		return;
+	if (!active) {
+		// Nothing to finish; just acknowledge the drive.
+		inb(IDE_CMD);
+		return;
+	}
+	if (!((bmst = inb(bmbase + BM_STATUS)) & BM_ST_IRQ))
+		return;
+
+	outb(bmbase + BM_CMD, 0);
+	st = inb(IDE_CMD);	// also acknowledges the drive's interrupt
+	outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+
+	req = active;
+	active = NULL;
+	ide_complete(req, (bmst & BM_ST_ERR) || (st & (IDE_DF|IDE_ERR))
+		     ? -E_IO : 0);
+	ide_start();
+}
+
+// Called on IRQ_IDE
+void
+ide_intr(void)
+{
+	uint32_t eflags = ide_lock();
+
+	ide_poll();
+	ide_unlock(eflags);
+}
+
+// Whether a comes before b in C-LOOK order
+static bool
+ide_before(const struct Idereq *a, const struct Idereq *b)
+{
+	bool apassed = a->ir_secno < headpos, bpassed = b->ir_secno < headpos;
+
+	if (apassed != bpassed)
+		return bpassed;
+	return a->ir_secno <= b->ir_secno;
+}
+
+void
+ide_submit(struct Idereq *req)
+{
+	struct Idereq **pp;
+	uint32_t eflags;
+
+	assert(req->ir_nsecs >= 1 && req->ir_nsecs <= IDE_MAXSECTS);
+	assert(((uintptr_t) req->ir_buf & 1) == 0);
+
+	if (req->ir_secno >= nsectors
+	    || req->ir_nsecs > nsectors - req->ir_secno) {
+		req->ir_status = -E_INVAL;
+		return;
+	}
+	req->ir_status = IDE_PENDING;
+
+	eflags = ide_lock();
+	for (pp = &queue; *pp && ide_before(*pp, req); pp = &(*pp)->ir_next)
+		/* do nothing */;
+	req->ir_next = *pp;
+	*pp = req;
+	ide_start();
+	ide_unlock(eflags);
+}
+
+// Wait for req to be done and return its status.
+int
+ide_wait(struct Idereq *req)
+{
+	uint32_t eflags;
+
+	while (req->ir_status == IDE_PENDING) {
+		if (read_eflags() & FL_IF) {
+			// As in cons_wait, sti takes effect only after
+			// the hlt has started, so a completion that comes
+			// in after the check still ends it.
+			asm volatile("cli");
+			if (req->ir_status == IDE_PENDING)
+				asm volatile("sti; hlt");
+			else
+				asm volatile("sti");
+		} else {
+			// Nobody will take the interrupt; look for
+			// ourselves.
+			eflags = ide_lock();
+			ide_poll();
+			ide_unlock(eflags);
+		}
+	}
+	return req->ir_status;
+}
+
+static int
+ide_rw(uint32_t secno, uint8_t *buf, size_t nsecs, int write)
+{
+	struct Idereq req[IDE_NBATCH];
+	int i, n, r, err = 0;
+
+	while (nsecs > 0) {
+		for (n = 0; n < IDE_NBATCH && nsecs > 0; n++) {
+			req[n].ir_secno = secno;
+			req[n].ir_nsecs = MIN(nsecs, IDE_MAXSECTS);
+			req[n].ir_buf = buf;
+			req[n].ir_write = write;
+			ide_submit(&req[n]);
+			secno += req[n].ir_nsecs;
+			buf += req[n].ir_nsecs * SECTSIZE;
+			nsecs -= req[n].ir_nsecs;
+		}
+		// The requests live on this stack: wait for all of them.
+		for (i = 0; i < n; i++)
+			if ((r = ide_wait(&req[i])) < 0 && !err)
+				err = r;
+		if (err)
+			return err;
+	}
+	return 0;
+}
+
+// Read nsecs sectors starting at secno into dst.
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	return ide_rw(secno, dst, nsecs, 0);
+}
+
+// Write nsecs sectors from src to the disk, starting at secno.
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+	return ide_rw(secno, (uint8_t *) src, nsecs, 1);
+}
+
+uint32_t
+ide_nsectors(void)
+{
+	return nsectors;
+}
+
+// Read the first sectors of the disk in one request and again as
+// single sectors submitted back to front, which the elevator must put
+// in order and, with DMA, merge into one command.
+static void
+check_ide(void)
+{
+	struct Idereq req[8];
+	struct PageInfo *pp;
+	uint8_t *one, *many;
+	int i;
+
+	assert((pp = page_alloc_order(1, 0)));
+	one = page2kva(pp);
+	many = one + PGSIZE;
+
+	assert(ide_read(0, one, 8) == 0);
+	// the boot sector's signature
+	assert(one[510] == 0x55 && one[511] == 0xAA);
+
+	memset(many, 0, PGSIZE);
+	for (i = 7; i >= 0; i--) {
+		req[i].ir_secno = i;
+		req[i].ir_nsecs = 1;
+		req[i].ir_buf = many + i * SECTSIZE;
+		req[i].ir_write = 0;
+		ide_submit(&req[i]);
+	}
+	for (i = 0; i < 8; i++)
+		assert(ide_wait(&req[i]) == 0);
+	assert(memcmp(one, many, PGSIZE) == 0);
+
+	page_free(pp);
+	cprintf("check_ide() succeeded!\n");
+}
+
+void
+ide_init(void)
+{
+	int dma;
+
+	// Keep the drive quiet while we look at it.
+	outb(IDE_CTL, IDE_CTL_NIEN);
+	if ((dma = ide_identify()) < 0) {
+		cprintf("IDE: no boot disk\n");
+		return;
+	}
+
+	if (dma && (bmbase = pci_find_busmaster())) {
+		// Throw away what the identify left behind; then let
+		// the drive interrupt.
+		outb(bmbase + BM_CMD, 0);
+		outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+		inb(IDE_CMD);
+		outb(IDE_CTL, 0);
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_IDE));
+	}
+	cprintf("IDE: boot disk has %u sectors, %s\n", nsectors,
+		bmbase ? "bus-master DMA" : "PIO");
+
+	check_ide();
+}
@@ -0,0 +1,41 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_IDE_H
+#define JOS_KERN_IDE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+#define SECTSIZE	512	// bytes per disk sector
+#define IDE_MAXSECTS	256	// most sectors one request can move
+
+// A request to read or write the boot disk (the master on the primary
+// IDE channel).  The buffer must be in the KERNBASE mapping of
+// physical memory, since the controller is handed its physical
+// address, and must be at least word aligned.
+//
+// ide_submit() queues the request and returns at once; ir_status
+// stays IDE_PENDING until the transfer is over, after which it is 0
+// or -E_IO.  The request must not be touched until then.
+struct Idereq {
+	uint32_t ir_secno;	// first sector
+	uint32_t ir_nsecs;	// 1 to IDE_MAXSECTS
+	void *ir_buf;
+	int ir_write;		// write ir_buf to disk rather than read
+	volatile int ir_status;
+	struct Idereq *ir_next;	// link on the driver's queue
+};
+
+#define IDE_PENDING	1
+
+void	ide_init(void);
+void	ide_intr(void);
+void	ide_submit(struct Idereq *req);
+int	ide_wait(struct Idereq *req);
+int	ide_read(uint32_t secno, void *dst, size_t nsecs);
+int	ide_write(uint32_t secno, const void *src, size_t nsecs);
+uint32_t ide_nsectors(void);
+
+#endif /* !JOS_KERN_IDE_H */
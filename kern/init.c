@@ -3,9 +3,20 @@
 #include <inc/stdio.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/x86.h>
+#include <inc/memlayout.h>
+#include <inc/bootinfo.h>
 
 #include <kern/monitor.h>
 #include <kern/console.h>
+#include <kern/trap.h>
+#include <kern/picirq.h>
+#include <kern/pmap.h>
+#include <kern/kmem.h>
+#include <kern/cpu.h>
+#include <kern/ide.h>
+#include <kern/perf.h>
+#include <kern/boottime.h>
 
 // Test the stack backtrace function (lab 1 only)
 void
@@ -19,19 +30,57 @@ test_backtrace(int x)
 	cprintf("leaving test_backtrace %d\n", x);
 }
 
+static void boot_aps(void);
+
+
 void
 i386_init(void)
 {
 	extern char edata[], end[];
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO_PA);
+
+	boot_stamp(BT_INIT);
 
 	// Before doing anything else, complete the ELF loading process.
 	// Clear the uninitialized global data (BSS) section of our program.
 	// This ensures that all static/global variables start out zero.
-	memset(edata, 0, end - edata);
+	// Our own boot loaders already did this (see inc/bootinfo.h).
+	if (bi->bi_magic != BOOTINFO_MAGIC || !(bi->bi_flags & BI_BSSZERO))
+		memset(edata, 0, end - edata);
+	boot_stamp(BT_BSS);
+
+	// Pick the fastest variants of the string routines for this CPU.
+	string_init();
 
 	// Initialize the console.
 	// Can't call cprintf until after we do this!
 	cons_init();
+	boot_stamp(BT_CONS);
+
+	// Lab 2 memory management initialization functions
+	mem_init();
+	kmem_init();
+
+	// Set up interrupt handling; from here on the serial port is
+	// driven by interrupts.
+	trap_init();
+
+	// Multiprocessor initialization functions
+	mp_init();
+	lapic_init();
+
+	// Multitasking initialization function
+	pic_init();
+	asm volatile("sti");
+
+	// Starting non-boot CPUs
+	boot_aps();
+
+	// The boot disk
+	ide_init();
+
+	// Hardware performance counters
+	perf_init();
 
 	cprintf("6828 decimal is %o octal!\n", 6828);
 
@@ -44,6 +93,55 @@ i386_init(void)
 }
 
 
+// While boot_aps is booting a given CPU, it communicates the per-core
+// stack pointer that should be loaded by mpentry.S to that CPU in
+// this variable.
+void *mpentry_kstack;
+
+// Start the non-boot (AP) processors.
+static void
+boot_aps(void)
+{
+	extern unsigned char mpentry_start[], mpentry_end[];
+	void *code;
+	struct CpuInfo *c;
+
+	// Write entry code to unused memory at MPENTRY_PADDR
+	code = KADDR(MPENTRY_PADDR);
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+
+	// Boot each AP one at a time
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == cpus + cpunum())  // We've started already.
+			continue;
+
+		// Tell mpentry.S what stack to use
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+		// Start the CPU at mpentry_start
+		lapic_startap(c->cpu_id, PADDR(code));
+		// Wait for the CPU to finish some basic setup in mp_main()
+		while(c->cpu_status != CPU_STARTED)
+			;
+		cprintf("SMP: CPU %d started\n", c->cpu_id);
+	}
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+	// We are in high EIP now, and entry_pgdir is kern_pgdir already.
+	// The console has no lock, so leave the talking to boot_aps().
+	lapic_init();
+	trap_init_percpu();
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+
+	// There are no environments to run yet, so the AP has nothing to
+	// do.  Halt it for good, with interrupts off.
+	for (;;)
+		asm volatile("cli; hlt");
+}
+
 /*
  * Variable panicstr contains argument to first call to panic; used as flag
  * to indicate that the kernel has already called panic.
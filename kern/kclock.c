@@ -0,0 +1,77 @@
+/* See COPYRIGHT for copyright information. */
+
+/* Support for the 8253 timer chip and the MC146818 real-time clock. */
+
+#include <inc/x86.h>
+#include <inc/trap.h>
+
+#include <kern/kclock.h>
+#include <kern/picirq.h>
+
+
+// Start interrupting 'hz' times a second on IRQ_TIMER.
+void
+kclock_start(int hz)
+{
+	outb(TIMER_MODE, TIMER_SEL0 | TIMER_RATEGEN | TIMER_16BIT);
+	outb(TIMER_CNTR0, TIMER_DIV(hz) % 256);
+	outb(TIMER_CNTR0, TIMER_DIV(hz) / 256);
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_TIMER));
+}
+
+// Stop delivering timer interrupts.
+void
+kclock_stop(void)
+{
+	irq_setmask_8259A(irq_mask_8259A | (1<<IRQ_TIMER));
+}
+
+// How many times a second the TSC ticks, timed against 10ms of PIT
+// counter 2 (which leaves counter 0 and IRQ_TIMER alone).  Measured
+// once; 0 if counter 2 never seems to finish.
+uint64_t
+kclock_tsc_hz(void)
+{
+	static uint64_t hz;
+	const uint32_t count = TIMER_DIV(100);
+	uint64_t t;
+	uint32_t eflags, n;
+	uint8_t portb;
+
+	if (hz)
+		return hz;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	portb = inb(IO_PORTB);
+	outb(IO_PORTB, (portb & ~PORTB_SPKR) | PORTB_GATE2);
+	outb(TIMER_MODE, TIMER_SEL2 | TIMER_INTTC | TIMER_16BIT);
+	outb(TIMER_CNTR2, count % 256);
+	outb(TIMER_CNTR2, count / 256);
+	// counting starts once the high byte is in; OUT2 rises at zero
+	t = read_tsc();
+	for (n = 0; !(inb(IO_PORTB) & PORTB_OUT2); n++)
+		if (n == 1000000)	// about a second of port reads
+			break;
+	t = read_tsc() - t;
+	outb(IO_PORTB, portb);
+	write_eflags(eflags);
+
+	if (n < 1000000)
+		hz = t * TIMER_FREQ / count;
+	return hz;
+}
+
+unsigned
+mc146818_read(unsigned reg)
+{
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+}
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
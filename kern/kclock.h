@@ -0,0 +1,54 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_KCLOCK_H
+#define JOS_KERN_KCLOCK_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// The 8253 programmable interval timer.  Counter 0 drives IRQ_TIMER;
+// counter 2, gated through system control port B, times kclock_tsc_hz().
+#define	TIMER_FREQ	1193182
+#define TIMER_DIV(x)	((TIMER_FREQ+(x)/2)/(x))
+
+#define	IO_TIMER1	0x040		// 8253 Timer #1
+#define	TIMER_CNTR0	(IO_TIMER1 + 0)	// timer 0 counter port
+#define	TIMER_CNTR2	(IO_TIMER1 + 2)	// timer 2 counter port
+#define	TIMER_MODE	(IO_TIMER1 + 3)	// timer mode port
+#define	  TIMER_SEL0	0x00		// select counter 0
+#define	  TIMER_SEL2	0x80		// select counter 2
+#define	  TIMER_INTTC	0x00		// mode 0, interrupt on terminal count
+#define	  TIMER_RATEGEN	0x04		// mode 2, rate generator
+#define	  TIMER_16BIT	0x30		// r/w counter 16 bits, LSB first
+
+#define	IO_PORTB	0x061		// system control port B
+#define	  PORTB_GATE2	0x01		// counter 2 counts
+#define	  PORTB_SPKR	0x02		// counter 2 drives the speaker
+#define	  PORTB_OUT2	0x20		// counter 2's output (read only)
+
+#define	IO_RTC		0x070		/* RTC port */
+
+#define	MC_NVRAM_START	0xe	/* start of NVRAM: offset 14 */
+#define	MC_NVRAM_SIZE	50	/* 50 bytes of NVRAM */
+
+/* NVRAM bytes 7 & 8: base memory size */
+#define NVRAM_BASELO	(MC_NVRAM_START + 7)	/* low byte; RTC off. 0x15 */
+#define NVRAM_BASEHI	(MC_NVRAM_START + 8)	/* high byte; RTC off. 0x16 */
+
+/* NVRAM bytes 9 & 10: extended memory size (between 1MB and 16MB) */
+#define NVRAM_EXTLO	(MC_NVRAM_START + 9)	/* low byte; RTC off. 0x17 */
+#define NVRAM_EXTHI	(MC_NVRAM_START + 10)	/* high byte; RTC off. 0x18 */
+
+/* NVRAM bytes 38 and 39: extended memory size (between 16MB and 4G) */
+#define NVRAM_EXT16LO	(MC_NVRAM_START + 38)	/* low byte; RTC off. 0x34 */
+#define NVRAM_EXT16HI	(MC_NVRAM_START + 39)	/* high byte; RTC off. 0x35 */
+
+unsigned mc146818_read(unsigned reg);
+void mc146818_write(unsigned reg, unsigned datum);
+void kclock_start(int hz);
+void kclock_stop(void);
+uint64_t kclock_tsc_hz(void);
+
+#endif	// !JOS_KERN_KCLOCK_H
@@ -2,13 +2,21 @@
 #include <inc/string.h>
 #include <inc/memlayout.h>
 #include <inc/assert.h>
+#include <inc/elf.h>
+#include <inc/bootinfo.h>
 
 #include <kern/kdebug.h>
+#include <kern/pmap.h>
+#include <kern/ide.h>
 
-extern const struct Stab __STAB_BEGIN__[];	// Beginning of stabs table
-extern const struct Stab __STAB_END__[];	// End of stabs table
-extern const char __STABSTR_BEGIN__[];		// Beginning of string table
-extern const char __STABSTR_END__[];		// End of string table
+// The kernel's stabs are not loaded with the rest of the kernel (see
+// kern/kernel.ld).  stab_load() reads them from the kernel's ELF file
+// on the boot disk the first time debuginfo_eip() needs them.
+static const struct Stab *stabs, *stab_end;	// stabs table
+static const char *stabstr, *stabstr_end;	// string table
+static struct PageInfo *stab_pp, *stabstr_pp;	// the memory they are in
+static size_t stab_disksize;	// size of both sections in the file
+static int stab_state;		// 0: not read, 1: read, -1: failed
 
 
 // stab_binsearch(stabs, region_left, region_right, type, addr)
@@ -94,43 +102,16 @@ stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
 }
 
 
-// debuginfo_eip(addr, info)
+// stab_debuginfo(addr, info)
 //
-//	Fill in the 'info' structure with information about the specified
-//	instruction address, 'addr'.  Returns 0 if information was found, and
-//	negative if not.  But even if it returns negative it has stored some
-//	information into '*info'.
+//	debuginfo_eip() the slow way, by searching the stabs directly.
+//	Used if symtab_init() could not index them.
 //
-int
-debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+static int
+stab_debuginfo(uintptr_t addr, struct Eipdebuginfo *info)
 {
-	const struct Stab *stabs, *stab_end;
-	const char *stabstr, *stabstr_end;
 	int lfile, rfile, lfun, rfun, lline, rline;
 
-	// Initialize *info
-	info->eip_file = "<unknown>";
-	info->eip_line = 0;
-	info->eip_fn_name = "<unknown>";
-	info->eip_fn_namelen = 9;
-	info->eip_fn_addr = addr;
-	info->eip_fn_narg = 0;
-
-	// Find the relevant set of stabs
-	if (addr >= ULIM) {
-		stabs = __STAB_BEGIN__;
-		stab_end = __STAB_END__;
-		stabstr = __STABSTR_BEGIN__;
-		stabstr_end = __STABSTR_END__;
-	} else {
-		// Can't search for user-level addresses yet!
-  	        panic("User address");
-	}
-
-	// String table validity checks
-	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
-		return -1;
-
 	// Now we find the right stabs that define the function containing
 	// 'eip'.  First, we find the basic source file containing 'eip'.
 	// Then, we look in that source file for the function.  Then we look
@@ -207,3 +188,415 @@ debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
 
 	return 0;
 }
+
+
+// Allocate a block of pages holding at least 'size' bytes.
+static struct PageInfo *
+block_alloc(size_t size)
+{
+	int order;
+
+	for (order = 0; (PGSIZE << order) < size; order++)
+		if (order == MAX_ORDER)
+			return NULL;
+	return page_alloc_order(order, 0);
+}
+
+static size_t
+block_size(struct PageInfo *pp)
+{
+	return pp ? PGSIZE << pp->pp_order : 0;
+}
+
+// Read the 'len' bytes at offset 'off' of the ELF file that starts at
+// disk sector 'elfsect' into a new block of pages, *pp.  Returns a
+// pointer to them, or NULL.
+static void *
+elf_read(uint32_t elfsect, uint32_t off, uint32_t len, struct PageInfo **pp)
+{
+	uint32_t first = off / SECTSIZE;
+	uint32_t nsecs = (off % SECTSIZE + len + SECTSIZE - 1) / SECTSIZE;
+
+	if ((*pp = block_alloc(nsecs * SECTSIZE)) == NULL)
+		return NULL;
+	if (ide_read(elfsect + first, page2kva(*pp), nsecs) < 0) {
+		page_free(*pp);
+		*pp = NULL;
+		return NULL;
+	}
+	return (char *) page2kva(*pp) + off % SECTSIZE;
+}
+
+// Find the kernel's ELF file on the boot disk and read its .stab and
+// .stabstr sections, as located by the section headers.
+// Returns 0 on success, < 0 on failure.
+static int
+stab_load(void)
+{
+	extern char _start[];
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO_PA);
+	struct PageInfo *elfpp, *shpp = NULL, *shstrpp = NULL;
+	struct Elf *elf;
+	struct Secthdr *sh, *shstrsh, *stabsh = NULL, *stabstrsh = NULL;
+	const char *shstr;
+	uint32_t elfsect = 1;
+	int i, r = -1;
+
+	// boot/main.c loads the kernel from sector 1 and says nothing
+	if (bi->bi_magic == BOOTINFO_MAGIC && (bi->bi_flags & BI_ELFSECT))
+		elfsect = bi->bi_elfsect;
+	if ((elf = elf_read(elfsect, 0, sizeof(*elf), &elfpp)) == NULL)
+		return -1;
+
+	// Make sure it is this kernel's file and not, say, zboot's
+	if (elf->e_magic != ELF_MAGIC || elf->e_entry != (uintptr_t) _start
+	    || elf->e_shentsize != sizeof(*sh)
+	    || elf->e_shstrndx >= elf->e_shnum)
+		goto out;
+	if ((sh = elf_read(elfsect, elf->e_shoff,
+			   elf->e_shnum * sizeof(*sh), &shpp)) == NULL)
+		goto out;
+	shstrsh = &sh[elf->e_shstrndx];
+	if (shstrsh->sh_size == 0
+	    || (shstr = elf_read(elfsect, shstrsh->sh_offset,
+				 shstrsh->sh_size, &shstrpp)) == NULL
+	    || shstr[shstrsh->sh_size - 1] != 0)
+		goto out;
+
+	for (i = 0; i < elf->e_shnum; i++) {
+		if (sh[i].sh_name >= shstrsh->sh_size)
+			continue;
+		if (strcmp(shstr + sh[i].sh_name, ".stab") == 0)
+			stabsh = &sh[i];
+		else if (strcmp(shstr + sh[i].sh_name, ".stabstr") == 0)
+			stabstrsh = &sh[i];
+	}
+	if (!stabsh || !stabstrsh || stabstrsh->sh_size == 0
+	    || stabsh->sh_size % sizeof(struct Stab) != 0)
+		goto out;
+
+	if ((stabs = elf_read(elfsect, stabsh->sh_offset, stabsh->sh_size,
+			      &stab_pp)) == NULL)
+		goto out;
+	if ((stabstr = elf_read(elfsect, stabstrsh->sh_offset,
+				stabstrsh->sh_size, &stabstr_pp)) == NULL) {
+		page_free(stab_pp);
+		stab_pp = NULL;
+		goto out;
+	}
+	stab_end = stabs + stabsh->sh_size / sizeof(struct Stab);
+	stabstr_end = stabstr + stabstrsh->sh_size;
+	stab_disksize = stabsh->sh_size + stabstrsh->sh_size;
+	r = 0;
+
+out:
+	if (shstrpp)
+		page_free(shstrpp);
+	if (shpp)
+		page_free(shpp);
+	page_free(elfpp);
+	return r;
+}
+
+
+/*
+ * A compact index of the stabs, built the first time it's needed.
+ *
+ * The stabs interleave files, functions, line numbers and type
+ * information, so debuginfo_eip() used to take three binary searches
+ * (each skipping over stabs of the wrong type) and a linear scan to
+ * answer one query.  symtab_init() pulls out just what it needs into
+ * two tables sorted by address, so that finding the function and the
+ * line is one binary search each over densely packed entries.
+ *
+ * The index holds everything debuginfo_eip() needs from the stabs
+ * table, so once it is built only the string table is kept.
+ */
+
+// A function, or (with sf_name 0) the start of a stretch of code that
+// is in no function, such as an assembly file or the gap after a file.
+struct Symfun {
+	uintptr_t sf_addr;	// first instruction
+	uint32_t sf_name;	// stabstr offset of the name, or 0
+	uint16_t sf_file;	// symfile index of the source file
+	uint16_t sf_narg;	// number of parameters
+};
+
+struct Symline {
+	uintptr_t sl_addr;	// first instruction of the line
+	uint16_t sl_line;	// line number
+	uint16_t sl_file;	// symfile index; may be an included file
+};
+
+#define SYM_NOFILE	0xFFFF	// sf_file past the end of a source file
+
+// All three tables live in one block of pages, symtab_pp, sized to fit.
+static struct Symfun *symfun;
+static struct Symline *symline;
+static uint32_t *symfile;		// stabstr offsets of file names
+static int nsymfun, nsymline, nsymfile;
+static int maxsymfun, maxsymline, maxsymfile;
+static struct PageInfo *symtab_pp;
+static int symtab_state;		// 0: not built, 1: built, -1: failed
+
+// Sort the 'n' entries of 'base', each 'size' bytes long and starting
+// with its address, by address.  The stabs list code mostly in address
+// order, so insertion sort is close to linear here.  It is also stable,
+// so a file that starts where the last one ended sorts after its end.
+static void
+symsort(void *base, int n, int size)
+{
+	char tmp[sizeof(struct Symfun)];
+	char *a = base;
+	int i, j;
+
+	for (i = 1; i < n; i++) {
+		memmove(tmp, a + i * size, size);
+		for (j = i; j > 0
+		     && *(uintptr_t *) (a + (j - 1) * size) > *(uintptr_t *) tmp;
+		     j--)
+			memmove(a + j * size, a + (j - 1) * size, size);
+		memmove(a + j * size, tmp, size);
+	}
+}
+
+// Return the index of the last of the 'n' sorted entries of 'base'
+// whose address is no greater than 'addr', or -1 if there is none.
+static int
+symsearch(const void *base, int n, int size, uintptr_t addr)
+{
+	const char *a = base;
+	int l = 0, r = n;
+
+	// invariant: entries before l are <= addr, from r on > addr
+	while (l < r) {
+		int m = (l + r) / 2;
+		if (*(const uintptr_t *) (a + m * size) <= addr)
+			l = m + 1;
+		else
+			r = m;
+	}
+	return l - 1;
+}
+
+static int
+symtab_addfile(uint32_t strx)
+{
+	if (nsymfile == maxsymfile)
+		return -1;
+	symfile[nsymfile] = strx;
+	return nsymfile++;
+}
+
+static int
+symtab_addfun(uintptr_t addr, uint32_t name, int file)
+{
+	if (nsymfun == maxsymfun)
+		return -1;
+	symfun[nsymfun].sf_addr = addr;
+	symfun[nsymfun].sf_name = name;
+	symfun[nsymfun].sf_file = file;
+	symfun[nsymfun].sf_narg = 0;
+	nsymfun++;
+	return 0;
+}
+
+// Count the entries each table needs and allocate them.
+static int
+symtab_alloc(void)
+{
+	const struct Stab *stab;
+	size_t size;
+	char *p;
+
+	for (stab = stabs; stab < stab_end; stab++)
+		switch (stab->n_type) {
+		case N_SO:
+			maxsymfun++;
+			maxsymfile++;
+			break;
+		case N_SOL:
+			maxsymfile++;
+			break;
+		case N_FUN:
+			maxsymfun++;
+			break;
+		case N_SLINE:
+			maxsymline++;
+			break;
+		}
+	if (maxsymfile >= SYM_NOFILE)
+		return -1;
+
+	size = maxsymfun * sizeof(*symfun) + maxsymline * sizeof(*symline)
+		+ maxsymfile * sizeof(*symfile);
+	if ((symtab_pp = block_alloc(size)) == NULL)
+		return -1;
+	p = page2kva(symtab_pp);
+	symfun = (struct Symfun *) p;
+	symline = (struct Symline *) (p + maxsymfun * sizeof(*symfun));
+	symfile = (uint32_t *) (symline + maxsymline);
+	return 0;
+}
+
+// Build symfun, symline and symfile from the kernel's stabs.
+// Returns 0 on success, < 0 if the stabs don't make sense.
+static int
+symtab_init(void)
+{
+	const struct Stab *stab;
+	uintptr_t fun;		// address of the current function, or 0
+	int file, linefile;	// current source file, and for line numbers
+
+	if (symtab_alloc() < 0)
+		return -1;
+
+	fun = 0;
+	file = linefile = -1;
+	for (stab = stabs; stab < stab_end; stab++) {
+		switch (stab->n_type) {
+		case N_SO:
+			// A source file starts here; one with an empty
+			// name marks the end of the previous one.
+			fun = 0;
+			if (stabstr[stab->n_strx] == 0) {
+				file = linefile = -1;
+				if (symtab_addfun(stab->n_value, 0, SYM_NOFILE) < 0)
+					return -1;
+				break;
+			}
+			if ((file = linefile = symtab_addfile(stab->n_strx)) < 0
+			    || symtab_addfun(stab->n_value, 0, file) < 0)
+				return -1;
+			break;
+
+		case N_SOL:
+			if ((linefile = symtab_addfile(stab->n_strx)) < 0)
+				return -1;
+			break;
+
+		case N_FUN:
+			// An empty name marks the end of the function
+			if (stabstr[stab->n_strx] == 0) {
+				fun = 0;
+				break;
+			}
+			if (file < 0 || symtab_addfun(stab->n_value,
+						      stab->n_strx, file) < 0)
+				return -1;
+			fun = stab->n_value;
+			break;
+
+		case N_PSYM:
+			if (fun)
+				symfun[nsymfun - 1].sf_narg++;
+			break;
+
+		case N_SLINE:
+			// Line addresses are relative to the function
+			// they are in, if any.
+			if (linefile < 0 || nsymline == maxsymline)
+				return -1;
+			symline[nsymline].sl_addr = fun + stab->n_value;
+			symline[nsymline].sl_line = stab->n_desc;
+			symline[nsymline].sl_file = linefile;
+			nsymline++;
+			break;
+		}
+	}
+
+	symsort(symfun, nsymfun, sizeof(symfun[0]));
+	symsort(symline, nsymline, sizeof(symline[0]));
+	return 0;
+}
+
+// debuginfo_eip(addr, info)
+//
+//	Fill in the 'info' structure with information about the specified
+//	instruction address, 'addr'.  Returns 0 if information was found, and
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+	const struct Symfun *sf;
+	int ifun, iline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+	info->eip_line = 0;
+	info->eip_fn_name = "<unknown>";
+	info->eip_fn_namelen = 9;
+	info->eip_fn_addr = addr;
+	info->eip_fn_narg = 0;
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+		// Read them from disk the first time, once there is
+		// a disk to read them from.
+		if (stab_state == 0 && ide_nsectors() != 0)
+			stab_state = stab_load() < 0 ? -1 : 1;
+		if (stab_state <= 0)
+			return -1;
+	} else {
+		// Can't search for user-level addresses yet!
+  	        panic("User address");
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+		return -1;
+
+	if (symtab_state == 0) {
+		if (symtab_init() < 0) {
+			symtab_state = -1;
+			if (symtab_pp)
+				page_free(symtab_pp);
+			symtab_pp = NULL;
+		} else {
+			symtab_state = 1;
+			page_free(stab_pp);
+			stab_pp = NULL;
+			stabs = stab_end = NULL;
+		}
+	}
+	if (symtab_state < 0)
+		return stab_debuginfo(addr, info);
+
+	// Find the function, or the file if it's not in one
+	if ((ifun = symsearch(symfun, nsymfun, sizeof(symfun[0]), addr)) < 0)
+		return -1;
+	sf = &symfun[ifun];
+	if (sf->sf_file == SYM_NOFILE)
+		return -1;
+	if (sf->sf_name) {
+		info->eip_fn_name = stabstr + sf->sf_name;
+		info->eip_fn_addr = sf->sf_addr;
+		info->eip_fn_narg = sf->sf_narg;
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+
+	// Find the line, which must be in that function or stretch of code
+	iline = symsearch(symline, nsymline, sizeof(symline[0]), addr);
+	if (iline < 0 || symline[iline].sl_addr < sf->sf_addr)
+		return -1;
+	info->eip_line = symline[iline].sl_line;
+	info->eip_file = stabstr + symfile[symline[iline].sl_file];
+	return 0;
+}
+
+// debuginfo_footprint(ondisk, resident)
+//
+//	Report how many bytes of debug information debuginfo_eip() read
+//	from the kernel's ELF file and how much memory it keeps for them.
+//	Both are 0 until the first call that needed them.
+//
+void
+debuginfo_footprint(size_t *ondisk, size_t *resident)
+{
+	*ondisk = stab_disksize;
+	*resident = block_size(stab_pp) + block_size(stabstr_pp)
+		+ block_size(symtab_pp);
+}
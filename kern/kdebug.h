@@ -16,5 +16,6 @@ struct Eipdebuginfo {
 };
 
 int debuginfo_eip(uintptr_t eip, struct Eipdebuginfo *info);
+void debuginfo_footprint(size_t *ondisk, size_t *resident);
 
 #endif
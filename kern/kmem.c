@@ -0,0 +1,465 @@
+// Slab allocator.
+//
+// A cache hands out objects of one size.  It gets memory from the page
+// allocator a slab at a time: a block of 2^kc_order pages that starts
+// with a struct Slab, followed by a stack of the indices of the slab's
+// free objects and then the objects themselves.  Keeping the free list
+// outside the objects lets them keep their constructed state while
+// free.  Slabs are aligned to their size, so an object's slab is found
+// by rounding its address down.
+//
+// The space a slab's objects leave over is used to stagger successive
+// slabs by a cache line, or by the alignment if that is larger
+// ("coloring"), so the same object in different slabs does not always
+// compete for the same cache sets.
+//
+// In front of the slabs, each CPU keeps a small stack of free objects
+// per cache, so most allocations and frees are a push or a pop that
+// touches no shared state.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/pmap.h>
+#include <kern/kmem.h>
+#include <kern/spinlock.h>
+
+#define KMEM_MAXORDER	3	// largest slab is 8 pages
+#define KMEM_MAG	16	// objects cached per CPU and cache
+#define KMEM_BATCH	(KMEM_MAG / 2)
+
+struct Slab {
+	struct Slab *sl_link;	// next and previous slab on the
+	struct Slab *sl_prev;	// cache's list for this state
+	struct Kmemcache *sl_cache;
+	char *sl_objs;		// first object, after the color offset
+	uint16_t sl_nfree;	// number of indices on sl_free
+	uint16_t sl_free[];	// indices of the free objects
+};
+
+struct Kmemcache {
+	char kc_name[16];
+	size_t kc_size;		// object size, rounded up to kc_align
+	size_t kc_align;
+	void (*kc_ctor)(void *);
+	int kc_order;		// slabs are 2^kc_order pages
+	int kc_perslab;		// objects per slab
+	size_t kc_maxcolor;	// largest color offset that fits
+	size_t kc_color;	// offset to give the next slab
+
+	struct spinlock kc_lock;	// protects the slabs and their counters
+	struct Slab *kc_full;	// slabs with no free objects,
+	struct Slab *kc_partial; // some free objects,
+	struct Slab *kc_empty;	// and only free objects
+	int kc_nempty;
+
+	uint32_t kc_nslab;	// slabs currently allocated
+
+	struct {
+		int mc_count;
+		void *mc_objs[KMEM_MAG];
+		uint32_t mc_nalloc;
+		uint32_t mc_nfree;
+		uint32_t mc_nfail;
+	} kc_cpu[NCPU];
+
+	struct Kmemcache *kc_next;	// on the list of all caches
+};
+
+// The caches are themselves objects of this cache.
+static struct Kmemcache cache_cache;
+static struct Kmemcache *caches;
+static struct spinlock caches_lock = SPINLOCK_INIT("caches");
+
+static void
+slab_insert(struct Slab **list, struct Slab *sl)
+{
+	sl->sl_prev = NULL;
+	sl->sl_link = *list;
+	if (*list)
+		(*list)->sl_prev = sl;
+	*list = sl;
+}
+
+static void
+slab_remove(struct Slab **list, struct Slab *sl)
+{
+	if (sl->sl_prev)
+		sl->sl_prev->sl_link = sl->sl_link;
+	else
+		*list = sl->sl_link;
+	if (sl->sl_link)
+		sl->sl_link->sl_prev = sl->sl_prev;
+}
+
+// Offset of a slab's first object when its color is 0.
+static size_t
+slab_hdrsize(struct Kmemcache *cp, int perslab)
+{
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+		       cp->kc_align);
+}
+
+// The step between slab colors: a cache line, or more if the objects
+// must be aligned more than that.
+static size_t
+color_step(struct Kmemcache *cp)
+{
+	return MAX(CACHELINE, cp->kc_align);
+}
+
+// Decide on the slab size for cp: the smallest that wastes no more
+// than an eighth of itself, or failing that, the largest allowed.
+static void
+cache_layout(struct Kmemcache *cp)
+{
+	size_t slabsize, used;
+	int order, n;
+
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+		slabsize = PGSIZE << order;
+		n = (slabsize - sizeof(struct Slab))
+			/ (cp->kc_size + sizeof(uint16_t));
+		while (n > 0 && slab_hdrsize(cp, n) + n * cp->kc_size > slabsize)
+			n--;
+		if (n == 0)
+			continue;
+		used = slab_hdrsize(cp, n) + n * cp->kc_size;
+		cp->kc_order = order;
+		cp->kc_perslab = n;
+		cp->kc_maxcolor = ROUNDDOWN(slabsize - used, color_step(cp));
+		if (slabsize - used <= slabsize / 8)
+			break;
+	}
+}
+
+static void
+cache_init(struct Kmemcache *cp, const char *name, size_t size,
+	   size_t align, void (*ctor)(void *))
+{
+	memset(cp, 0, sizeof(*cp));
+	strncpy(cp->kc_name, name, sizeof(cp->kc_name) - 1);
+	cp->kc_align = align ? align : sizeof(void *);
+	assert((cp->kc_align & (cp->kc_align - 1)) == 0);
+	cp->kc_size = ROUNDUP(size ? size : 1, cp->kc_align);
+	cp->kc_ctor = ctor;
+	spin_initlock(&cp->kc_lock);
+	cache_layout(cp);
+	if (cp->kc_perslab == 0)
+		panic("kmem_cache_create: %s objects of %u bytes are too big",
+		      name, size);
+	cp->kc_next = caches;
+	caches = cp;
+}
+
+// Allocate, lay out and construct a new slab for cp and put it on the
+// empty list.  Call with cp->kc_lock held.
+static struct Slab *
+slab_create(struct Kmemcache *cp)
+{
+	struct PageInfo *pp;
+	struct Slab *sl;
+	int i;
+
+	if (!(pp = page_alloc_order(cp->kc_order, 0)))
+		return NULL;
+	sl = page2kva(pp);
+	sl->sl_cache = cp;
+	sl->sl_objs = (char *) sl + slab_hdrsize(cp, cp->kc_perslab)
+		+ cp->kc_color;
+	cp->kc_color += color_step(cp);
+	if (cp->kc_color > cp->kc_maxcolor)
+		cp->kc_color = 0;
+
+	// Hand out the lowest addresses first.
+	sl->sl_nfree = cp->kc_perslab;
+	for (i = 0; i < cp->kc_perslab; i++) {
+		sl->sl_free[i] = cp->kc_perslab - 1 - i;
+		if (cp->kc_ctor)
+			cp->kc_ctor(sl->sl_objs + i * cp->kc_size);
+	}
+
+	slab_insert(&cp->kc_empty, sl);
+	cp->kc_nempty++;
+	cp->kc_nslab++;
+	return sl;
+}
+
+// Take an object off cp's slabs, making a new slab if they are all
+// full.  Call with cp->kc_lock held.
+static void *
+slab_alloc(struct Kmemcache *cp)
+{
+	struct Slab *sl;
+
+	if ((sl = cp->kc_partial) == NULL) {
+		if (!cp->kc_empty && !slab_create(cp))
+			return NULL;
+		sl = cp->kc_empty;
+		slab_remove(&cp->kc_empty, sl);
+		cp->kc_nempty--;
+		slab_insert(&cp->kc_partial, sl);
+	}
+
+	if (--sl->sl_nfree == 0) {
+		slab_remove(&cp->kc_partial, sl);
+		slab_insert(&cp->kc_full, sl);
+	}
+	return sl->sl_objs + sl->sl_free[sl->sl_nfree] * cp->kc_size;
+}
+
+// Put an object back on its slab.  One empty slab is kept for each
+// cache; the pages of any others go back to the page allocator.
+// Call with cp->kc_lock held.
+static void
+slab_free(struct Kmemcache *cp, void *obj)
+{
+	struct Slab *sl;
+	size_t off;
+
+	sl = ROUNDDOWN(obj, PGSIZE << cp->kc_order);
+	off = (char *) obj - sl->sl_objs;
+	if (sl->sl_cache != cp || (char *) obj < sl->sl_objs
+	    || off % cp->kc_size != 0 || off / cp->kc_size >= cp->kc_perslab)
+		panic("kmem_cache_free: %p is not a %s object", obj,
+		      cp->kc_name);
+
+	if (sl->sl_nfree == 0) {
+		slab_remove(&cp->kc_full, sl);
+		slab_insert(&cp->kc_partial, sl);
+	}
+	sl->sl_free[sl->sl_nfree++] = off / cp->kc_size;
+
+	if (sl->sl_nfree == cp->kc_perslab) {
+		slab_remove(&cp->kc_partial, sl);
+		if (cp->kc_nempty > 0) {
+			cp->kc_nslab--;
+			page_free(pa2page(PADDR(sl)));
+		} else {
+			slab_insert(&cp->kc_empty, sl);
+			cp->kc_nempty++;
+		}
+	}
+}
+
+//
+// Create a cache of objects of 'size' bytes, each aligned to 'align'
+// (a power of two, or 0 for word alignment).  Pass CACHELINE to keep
+// objects from sharing cache lines.  If 'ctor' is not NULL, it is
+// called on each object before it is first allocated.
+//
+struct Kmemcache *
+kmem_cache_create(const char *name, size_t size, size_t align,
+		  void (*ctor)(void *))
+{
+	struct Kmemcache *cp;
+	uint32_t eflags;
+
+	if (!(cp = kmem_cache_alloc(&cache_cache)))
+		return NULL;
+	eflags = read_eflags();
+	asm volatile("cli");
+	spin_lock(&caches_lock);
+	cache_init(cp, name, size, align, ctor);
+	spin_unlock(&caches_lock);
+	write_eflags(eflags);
+	return cp;
+}
+
+//
+// Free cp and its slabs.  All of its objects must have been freed.
+//
+void
+kmem_cache_destroy(struct Kmemcache *cp)
+{
+	struct Kmemcache **pcp;
+	uint32_t eflags;
+	int cpu;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	spin_lock(&caches_lock);
+	spin_lock(&cp->kc_lock);
+	for (cpu = 0; cpu < NCPU; cpu++)
+		while (cp->kc_cpu[cpu].mc_count > 0)
+			slab_free(cp, cp->kc_cpu[cpu].mc_objs[--cp->kc_cpu[cpu].mc_count]);
+	if (cp->kc_full || cp->kc_partial)
+		panic("kmem_cache_destroy: %s objects still in use",
+		      cp->kc_name);
+	if (cp->kc_empty)
+		page_free(pa2page(PADDR(cp->kc_empty)));
+	for (pcp = &caches; *pcp != cp; pcp = &(*pcp)->kc_next)
+		/* do nothing */;
+	*pcp = cp->kc_next;
+	spin_unlock(&cp->kc_lock);
+	spin_unlock(&caches_lock);
+	write_eflags(eflags);
+	kmem_cache_free(&cache_cache, cp);
+}
+
+//
+// Allocate an object from cp.
+// Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct Kmemcache *cp)
+{
+	void *obj = NULL;
+	uint32_t eflags;
+	int cpu;
+
+	// This CPU's objects are its own, as long as none of its
+	// interrupt handlers gets at them halfway through.
+	eflags = read_eflags();
+	asm volatile("cli");
+	cpu = cpunum();
+	if (cp->kc_cpu[cpu].mc_count == 0) {
+		spin_lock(&cp->kc_lock);
+		while (cp->kc_cpu[cpu].mc_count < KMEM_BATCH
+		       && (obj = slab_alloc(cp)))
+			cp->kc_cpu[cpu].mc_objs[cp->kc_cpu[cpu].mc_count++] = obj;
+		spin_unlock(&cp->kc_lock);
+	}
+	if (cp->kc_cpu[cpu].mc_count > 0) {
+		obj = cp->kc_cpu[cpu].mc_objs[--cp->kc_cpu[cpu].mc_count];
+		cp->kc_cpu[cpu].mc_nalloc++;
+	} else
+		cp->kc_cpu[cpu].mc_nfail++;
+	write_eflags(eflags);
+	return obj;
+}
+
+//
+// Return an object to cp, in its constructed state.
+//
+void
+kmem_cache_free(struct Kmemcache *cp, void *obj)
+{
+	uint32_t eflags;
+	int cpu, i;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	cpu = cpunum();
+	if (cp->kc_cpu[cpu].mc_count == KMEM_MAG) {
+		spin_lock(&cp->kc_lock);
+		for (i = 0; i < KMEM_BATCH; i++)
+			slab_free(cp, cp->kc_cpu[cpu].mc_objs[i]);
+		spin_unlock(&cp->kc_lock);
+		cp->kc_cpu[cpu].mc_count -= KMEM_BATCH;
+		memmove(cp->kc_cpu[cpu].mc_objs,
+			cp->kc_cpu[cpu].mc_objs + KMEM_BATCH,
+			cp->kc_cpu[cpu].mc_count * sizeof(void *));
+	}
+	cp->kc_cpu[cpu].mc_objs[cp->kc_cpu[cpu].mc_count++] = obj;
+	cp->kc_cpu[cpu].mc_nfree++;
+	write_eflags(eflags);
+}
+
+// Add up the per-CPU allocation and free counts of cp.
+static void
+cache_counts(struct Kmemcache *cp, uint32_t *nalloc, uint32_t *nfree)
+{
+	int cpu;
+
+	*nalloc = *nfree = 0;
+	for (cpu = 0; cpu < NCPU; cpu++) {
+		*nalloc += cp->kc_cpu[cpu].mc_nalloc;
+		*nfree += cp->kc_cpu[cpu].mc_nfree;
+	}
+}
+
+// Print each cache's counters (the 'meminfo' monitor command).
+void
+kmem_print_stats(void)
+{
+	struct Kmemcache *cp;
+	uint32_t nalloc, nfree;
+
+	cprintf("%-15s %5s %10s %5s %5s %9s %9s\n", "cache", "size",
+		"slab pages", "objs", "slabs", "inuse", "allocs");
+	for (cp = caches; cp; cp = cp->kc_next) {
+		cache_counts(cp, &nalloc, &nfree);
+		cprintf("%-15s %5u %10d %5d %5u %9u %9u\n", cp->kc_name,
+			cp->kc_size, 1 << cp->kc_order, cp->kc_perslab,
+			cp->kc_nslab, nalloc - nfree, nalloc);
+	}
+}
+
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+#define CHECK_MAGIC	0x6b6d656d
+
+static void
+check_ctor(void *obj)
+{
+	*(uint32_t *) obj = CHECK_MAGIC;
+}
+
+static void
+check_kmem(void)
+{
+	static void *objs[200];
+	struct Kmemcache *cp;
+	struct Slab *first, *last;
+	uint32_t nslab, nalloc, nfree;
+	int i, j;
+
+	assert((cp = kmem_cache_create("check", 40, CACHELINE, check_ctor)));
+	assert(cp->kc_size == CACHELINE);
+
+	for (i = 0; i < ARRAY_SIZE(objs); i++) {
+		assert((objs[i] = kmem_cache_alloc(cp)));
+		assert((uintptr_t) objs[i] % CACHELINE == 0);
+		assert(*(uint32_t *) objs[i] == CHECK_MAGIC);
+		for (j = 0; j < i; j++)
+			assert(objs[j] != objs[i]);
+	}
+	// 200 objects need several slabs, which get different colors
+	nslab = cp->kc_nslab;
+	assert(nslab > 1);
+	first = ROUNDDOWN(objs[0], PGSIZE << cp->kc_order);
+	last = ROUNDDOWN(objs[ARRAY_SIZE(objs) - 1], PGSIZE << cp->kc_order);
+	assert(first != last);
+	assert(cp->kc_maxcolor == 0
+	       || PGOFF(first->sl_objs) != PGOFF(last->sl_objs));
+
+	// frees go to the per-CPU cache first and come right back
+	kmem_cache_free(cp, objs[7]);
+	assert(kmem_cache_alloc(cp) == objs[7]);
+
+	for (i = 0; i < ARRAY_SIZE(objs); i++)
+		kmem_cache_free(cp, objs[i]);
+	cache_counts(cp, &nalloc, &nfree);
+	assert(nalloc == nfree);
+	assert(cp->kc_nslab < nslab);
+	kmem_cache_destroy(cp);
+
+	// colors step by the alignment when it is more than CACHELINE
+	assert((cp = kmem_cache_create("check128", 200, 128, NULL)));
+	for (i = 0; i < 40; i++) {
+		assert((objs[i] = kmem_cache_alloc(cp)));
+		assert((uintptr_t) objs[i] % 128 == 0);
+	}
+	assert(cp->kc_nslab > 1);
+	for (i = 0; i < 40; i++)
+		kmem_cache_free(cp, objs[i]);
+	kmem_cache_destroy(cp);
+
+	cprintf("check_kmem() succeeded!\n");
+}
+
+// Set up the cache of caches.  Call after mem_init().
+void
+kmem_init(void)
+{
+	cache_init(&cache_cache, "kmem_cache", sizeof(struct Kmemcache),
+		   CACHELINE, NULL);
+	check_kmem();
+}
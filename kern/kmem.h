@@ -0,0 +1,28 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_KMEM_H
+#define JOS_KERN_KMEM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Object caches for small fixed-size kernel objects, carved out of
+// slabs of physically contiguous pages from page_alloc_order().
+//
+// A cache's constructor runs once per object, when its slab is
+// created, not on every kmem_cache_alloc: objects must be handed back
+// to kmem_cache_free in their constructed state.
+
+struct Kmemcache;
+
+void	kmem_init(void);
+struct Kmemcache *kmem_cache_create(const char *name, size_t size,
+				    size_t align, void (*ctor)(void *));
+void	kmem_cache_destroy(struct Kmemcache *cp);
+void	*kmem_cache_alloc(struct Kmemcache *cp);
+void	kmem_cache_free(struct Kmemcache *cp, void *obj);
+void	kmem_print_stats(void);
+
+#endif /* !JOS_KERN_KMEM_H */
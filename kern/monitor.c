@@ -10,6 +10,14 @@
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
+#include <kern/trace.h>
+#include <kern/cpu.h>
+#include <kern/prof.h>
+#include <kern/perf.h>
+#include <kern/pmap.h>
+#include <kern/kmem.h>
+#include <kern/bench.h>
+#include <kern/boottime.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -25,6 +33,14 @@ static struct Command commands[] = {
 	{ "help", "Display this list of commands", mon_help },
 	{ "kerninfo", "Display information about the kernel", mon_kerninfo },
 	{ "backtrace", "Display backtrace infomation to help your to debug", mon_backtrace },
+	{ "console", "Show console devices, or turn them [+]on or -off", mon_console },
+	{ "trace", "Show event tracing state; trace on|off|clear|mark [args]", mon_trace },
+	{ "tracedump", "Print the last [n] trace records of each CPU", mon_tracedump },
+	{ "prof", "Profile the kernel; prof start [-g] [-e event] [hz|period] | stop | report [n]", mon_prof },
+	{ "perf", "Show the performance counters; perf stat command [args] counts them", mon_perf },
+	{ "meminfo", "Display page and object allocator statistics", mon_meminfo },
+	{ "bench", "Run the microbenchmarks [whose names start with prefix]", mon_bench },
+	{ "boottime", "Show how long each boot step took", mon_boottime },
 };
 
 /***** Implementations of basic kernel monitor commands *****/
@@ -43,6 +59,7 @@ int
 mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 {
 	extern char _start[], entry[], etext[], edata[], end[];
+	size_t ondisk, resident;
 
 	cprintf("Special kernel symbols:\n");
 	cprintf("  _start                  %08x (phys)\n", _start);
@@ -52,6 +69,12 @@ mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
 	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
 	cprintf("Kernel executable memory footprint: %dKB\n",
 		ROUNDUP(end - entry, 1024) / 1024);
+	debuginfo_footprint(&ondisk, &resident);
+	if (ondisk)
+		cprintf("Debug info: %dKB on disk, %dKB resident\n",
+			ROUNDUP(ondisk, 1024) / 1024, resident / 1024);
+	else
+		cprintf("Debug info: not loaded\n");
 	return 0;
 }
 
@@ -68,18 +91,182 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 	while (ebp) {
 		eip = *(ebp + 1);
         // Print demanded content according to the stack structure known before.
-		cprintf("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", 
+		cprintf_cached("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", 
 				ebp, eip, *(ebp + 2), *(ebp + 3), *(ebp + 4), *(ebp + 5), *(ebp + 6));
 		// Get and print debug infomation.
 		// For arguments, notice that uintptr_t == uint32_t
 		debuginfo_eip(eip, &info);
-		cprintf("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip - info.eip_fn_addr);
+		cprintf_cached("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip - info.eip_fn_addr);
         // Trace back to the last stack frame.
 		ebp = (uint32_t *)(*ebp);
 	}
 	return 0;
 }
 
+int
+mon_console(int argc, char **argv, struct Trapframe *tf)
+{
+	const struct Conssink *cs;
+	const char *name;
+	int i, j, mask, on;
+
+	mask = cons_getsinks();
+	for (i = 1; i < argc; i++) {
+		name = argv[i];
+		on = (*name != '-');
+		if (*name == '+' || *name == '-')
+			name++;
+		for (j = 0; j < NCONSSINK; j++)
+			if (strcmp(name, cons_sink(j)->cs_name) == 0)
+				break;
+		if (j == NCONSSINK) {
+			cprintf("Unknown console device '%s'\n", name);
+			return 0;
+		}
+		if (on)
+			mask |= 1 << j;
+		else
+			mask &= ~(1 << j);
+	}
+	if (argc > 1 && cons_setsinks(mask) != mask)
+		cprintf("Some of those devices are not present\n");
+
+	mask = cons_getsinks();
+	for (i = 0; i < NCONSSINK; i++) {
+		cs = cons_sink(i);
+		cprintf("%-8s %-7s %10u bytes %10u stalls\n", cs->cs_name,
+			!cs->cs_present ? "absent" : (mask & (1 << i)) ? "on" : "off",
+			cs->cs_bytes, cs->cs_stalls);
+	}
+	return 0;
+}
+
+int
+mon_trace(int argc, char **argv, struct Trapframe *tf)
+{
+	uint32_t arg[4] = { 0, 0, 0, 0 };
+	int i;
+
+	if (argc == 1) {
+		cprintf("tracing is %s\n", trace_on ? "on" : "off");
+		for (i = 0; i < NCPU; i++)
+			if (trace_nrec(i))
+				cprintf("  CPU %d: %d records\n", i, trace_nrec(i));
+	} else if (strcmp(argv[1], "on") == 0)
+		trace_on = 1;
+	else if (strcmp(argv[1], "off") == 0)
+		trace_on = 0;
+	else if (strcmp(argv[1], "clear") == 0)
+		trace_clear();
+	else if (strcmp(argv[1], "mark") == 0) {
+		for (i = 2; i < argc && i - 2 < ARRAY_SIZE(arg); i++)
+			arg[i - 2] = strtol(argv[i], NULL, 0);
+		trace(TR_MARK, arg[0], arg[1], arg[2], arg[3]);
+	} else
+		cprintf("usage: trace [on|off|clear|mark [args]]\n");
+	return 0;
+}
+
+int
+mon_tracedump(int argc, char **argv, struct Trapframe *tf)
+{
+	trace_dump(argc > 1 ? strtol(argv[1], NULL, 0) : 0);
+	return 0;
+}
+
+int
+mon_prof(int argc, char **argv, struct Trapframe *tf)
+{
+	bool callers = 0;
+	int i, event = -1, hz = 1000, period = 1000000;
+
+	if (argc >= 2 && strcmp(argv[1], "start") == 0) {
+		for (i = 2; i < argc; i++)
+			if (strcmp(argv[i], "-g") == 0)
+				callers = 1;
+			else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+				event = perf_event_byname(argv[++i]);
+				if (event < 0) {
+					cprintf("prof: unknown event '%s'\n", argv[i]);
+					return 0;
+				}
+			} else
+				hz = period = strtol(argv[i], NULL, 0);
+		if (event >= 0) {
+			if (period < 1000)
+				cprintf("prof: period must be at least 1000\n");
+			else if (prof_start_event(event, period, callers) < 0)
+				cprintf("prof: can't sample %s on this CPU\n",
+					perf_event_name(event));
+			return 0;
+		}
+		// the 8253's 16-bit divisor can't go below 19 Hz
+		if (hz < 20 || hz > 10000) {
+			cprintf("prof: rate must be 20 to 10000 Hz\n");
+			return 0;
+		}
+		prof_start(hz, callers);
+	} else if (argc == 2 && strcmp(argv[1], "stop") == 0)
+		prof_stop();
+	else if (argc >= 2 && strcmp(argv[1], "report") == 0)
+		prof_report(argc > 2 ? strtol(argv[2], NULL, 0) : 20);
+	else
+		cprintf("usage: prof start [-g] [-e event] [hz|period] | stop | report [n]\n");
+	return 0;
+}
+
+static int runargs(int argc, char **argv, struct Trapframe *tf);
+
+int
+mon_perf(int argc, char **argv, struct Trapframe *tf)
+{
+	struct Perfstat ps;
+	int i, r;
+
+	if (argc == 1) {
+		perf_print_info();
+		return 0;
+	}
+	if (argc < 3 || strcmp(argv[1], "stat") != 0) {
+		cprintf("usage: perf [stat command [args]]\n");
+		return 0;
+	}
+	if (perf_stat_start() < 0) {
+		cprintf("perf: the counters are in use\n");
+		return 0;
+	}
+	r = runargs(argc - 2, argv + 2, tf);
+	perf_stat_stop(&ps);
+
+	cprintf("Performance counter stats for '");
+	for (i = 2; i < argc; i++)
+		cprintf(i > 2 ? " %s" : "%s", argv[i]);
+	cprintf("':\n");
+	perf_stat_print(&ps);
+	return r;
+}
+
+int
+mon_meminfo(int argc, char **argv, struct Trapframe *tf)
+{
+	page_print_stats();
+	kmem_print_stats();
+	return 0;
+}
+
+int
+mon_bench(int argc, char **argv, struct Trapframe *tf)
+{
+	bench_run(argc > 1 ? argv[1] : NULL);
+	return 0;
+}
+
+int
+mon_boottime(int argc, char **argv, struct Trapframe *tf)
+{
+	boottime_print();
+	return 0;
+}
 
 /***** Kernel monitor command interpreter *****/
 
@@ -91,7 +278,6 @@ runcmd(char *buf, struct Trapframe *tf)
 {
 	int argc;
 	char *argv[MAXARGS];
-	int i;
 
 	// Parse the command buffer into whitespace-separated arguments
 	argc = 0;
@@ -113,8 +299,15 @@ runcmd(char *buf, struct Trapframe *tf)
 			buf++;
 	}
 	argv[argc] = 0;
+	return runargs(argc, argv, tf);
+}
+
+// Lookup and invoke the command
+static int
+runargs(int argc, char **argv, struct Trapframe *tf)
+{
+	int i;
 
-	// Lookup and invoke the command
 	if (argc == 0)
 		return 0;
 	for (i = 0; i < ARRAY_SIZE(commands); i++) {
@@ -140,6 +333,8 @@ monitor(struct Trapframe *tf)
 	// cprintf("x=%d y=%d", 3);
 	cprintf("%m%s\n%m%s\n%m%s\n", 0x0100, "blue", 0x0200, "green", 0x0400, "red");
 
+	if (!boot_tsc[BT_MONITOR])
+		boot_stamp(BT_MONITOR);
 	while (1) {
 		buf = readline("K> ");
 		if (buf != NULL)
@@ -0,0 +1,351 @@
+// Hardware performance counters.
+//
+// CPUID leaf 0xA describes the CPU's architectural performance
+// monitoring: how many general-purpose counters it has and how wide
+// they are, which of the architectural events they can count, and,
+// from version 2 on, the fixed-function counters for instructions and
+// cycles.  See chapter 18 of the Intel manual volume 3.
+//
+// perf_stat_start() puts every event that fits on the counters of the
+// calling CPU and perf_stat_stop() reads them back.  perf_sample_start()
+// instead lets general-purpose counter 0 overflow every 'period'
+// events and hands the interrupted state to prof_tick(), so that
+// prof_report() shows where the events happen.  The local APIC
+// delivers the overflow as an NMI, so code that runs with interrupts
+// disabled gets sampled too.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/error.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/perf.h>
+#include <kern/prof.h>
+
+#define MSR_PERFEVTSEL0		0x186	// event select for counter i at 0x186 + i
+#define   EVTSEL_USR		0x00010000	// count in user mode
+#define   EVTSEL_OS		0x00020000	// count in the kernel
+#define   EVTSEL_INT		0x00100000	// interrupt on overflow
+#define   EVTSEL_EN		0x00400000	// enable
+#define MSR_PMC0		0x0C1	// counter i at 0xC1 + i
+#define MSR_FIXED_CTR0		0x309	// fixed counter i at 0x309 + i
+#define MSR_FIXED_CTR_CTRL	0x38D	// 4 bits per fixed counter:
+#define   FIXED_OS_USR		0x3	//   count in kernel and user mode
+#define MSR_GLOBAL_STATUS	0x38E	// the rest are version 2 and later
+#define MSR_GLOBAL_CTRL		0x38F
+#define MSR_GLOBAL_OVF_CTRL	0x390
+
+#define PERF_MAXGP	8	// general-purpose counters used at most
+#define PERF_MAXFIXED	3	// fixed counters used at most
+
+static const struct {
+	const char *name;
+	uint16_t evsel;		// unit mask << 8 | event select
+	int8_t archbit;		// bit in CPUID.0xA:EBX, -1 if model specific
+	int8_t fixed;		// fixed counter that counts it, or -1
+} events[NPERFEVENT] = {
+	[PERF_CYCLES]	= { "cycles",		0x003C,  0,  1 },
+	[PERF_INSTRS]	= { "instructions",	0x00C0,  1,  0 },
+	[PERF_LLCMISS]	= { "llc-misses",	0x412E,  4, -1 },
+	[PERF_BRMISS]	= { "branch-misses",	0x00C5,  6, -1 },
+	// DTLB_LOAD_MISSES.MISS_CAUSES_A_WALK, from Nehalem on
+	[PERF_DTLBMISS]	= { "dtlb-misses",	0x0108, -1, -1 },
+};
+
+static struct {
+	int version;		// 0 if there are no counters
+	int ngp, gpbits;	// general-purpose counters and their width
+	int nfixed, fixedbits;
+	uint64_t gpmask, fixedmask;
+	uint32_t avail;		// bit i: events[i] can be counted
+} pmu;
+
+// What perf_stat_start() put on each counter, or -1
+static int gpevent[PERF_MAXGP], fixedevent[PERF_MAXFIXED];
+static bool stat_running;
+static uint64_t stat_tsc;
+
+// The CPU whose NMIs may be counter overflows, or -1; and the period
+// while sampling, 0 once stopped
+static int sample_cpu = -1;
+static uint32_t sample_period;
+
+static uint64_t
+widthmask(int bits)
+{
+	return bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+}
+
+void
+perf_init(void)
+{
+	uint32_t max, vendor, eax, ebx, edx;
+	int i, len;
+
+	// Leaf 0xA is Intel's; other vendors have their own scheme.
+	cpuid(0, &max, &vendor, NULL, NULL);
+	if (vendor != 0x756e6547 || max < 0xA)	// "Genu"
+		return;
+	cpuid(0xA, &eax, &ebx, NULL, &edx);
+	if ((eax & 0xFF) == 0 || ((eax >> 8) & 0xFF) == 0)
+		return;
+
+	pmu.version = eax & 0xFF;
+	pmu.ngp = MIN((int) (eax >> 8) & 0xFF, PERF_MAXGP);
+	pmu.gpbits = (eax >> 16) & 0xFF;
+	pmu.gpmask = widthmask(pmu.gpbits);
+	if (pmu.version >= 2) {
+		pmu.nfixed = MIN((int) edx & 0x1F, PERF_MAXFIXED);
+		pmu.fixedbits = (edx >> 5) & 0xFF;
+		pmu.fixedmask = widthmask(pmu.fixedbits);
+	}
+
+	// EBX has a bit set for each architectural event that is *not*
+	// available, among the first 'len'.
+	len = eax >> 24;
+	cpuid(1, &eax, NULL, NULL, NULL);
+	for (i = 0; i < NPERFEVENT; i++)
+		if (events[i].archbit >= 0
+		    ? events[i].archbit < len && !(ebx & (1 << events[i].archbit))
+		    : ((eax >> 8) & 0xF) == 6 && pmu.version >= 3)
+			pmu.avail |= 1 << i;
+}
+
+bool
+perf_available(void)
+{
+	return pmu.version != 0;
+}
+
+bool
+perf_can_count(int event)
+{
+	return event >= 0 && event < NPERFEVENT && (pmu.avail & (1 << event));
+}
+
+// Returns the event called 'name', or -1.
+int
+perf_event_byname(const char *name)
+{
+	int i;
+
+	for (i = 0; i < NPERFEVENT; i++)
+		if (strcmp(events[i].name, name) == 0)
+			return i;
+	return -1;
+}
+
+const char *
+perf_event_name(int event)
+{
+	return events[event].name;
+}
+
+void
+perf_print_info(void)
+{
+	int i;
+
+	if (!pmu.version) {
+		cprintf("No architectural performance counters\n");
+		return;
+	}
+	cprintf("Performance monitoring version %d: %d counters of %d bits",
+		pmu.version, pmu.ngp, pmu.gpbits);
+	if (pmu.nfixed)
+		cprintf(", %d fixed of %d bits", pmu.nfixed, pmu.fixedbits);
+	cprintf("\n");
+	for (i = 0; i < NPERFEVENT; i++)
+		cprintf("  %-14s %s\n", events[i].name,
+			perf_can_count(i) ? "yes" : "not supported");
+}
+
+// Stop and unprogram all the counters of this CPU.
+static void
+pmu_disable(void)
+{
+	int i;
+
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_CTRL, 0);
+	for (i = 0; i < pmu.ngp; i++)
+		wrmsr(MSR_PERFEVTSEL0 + i, 0);
+	if (pmu.nfixed)
+		wrmsr(MSR_FIXED_CTR_CTRL, 0);
+}
+
+// Start counting, on this CPU, every event that there is a counter
+// for, in both the kernel and user mode.  Without counters, only the
+// elapsed time is measured.
+int
+perf_stat_start(void)
+{
+	uint64_t global = 0;
+	uint32_t fixedctrl = 0;
+	int ev, i, gp = 0;
+
+	if (stat_running || sample_period)
+		return -E_INVAL;
+
+	pmu_disable();
+	for (i = 0; i < PERF_MAXGP; i++)
+		gpevent[i] = -1;
+	for (i = 0; i < PERF_MAXFIXED; i++)
+		fixedevent[i] = -1;
+	for (ev = 0; ev < NPERFEVENT; ev++) {
+		if (!perf_can_count(ev))
+			continue;
+		if ((i = events[ev].fixed) >= 0 && i < pmu.nfixed) {
+			fixedevent[i] = ev;
+			wrmsr(MSR_FIXED_CTR0 + i, 0);
+			fixedctrl |= FIXED_OS_USR << (4 * i);
+			global |= 1ULL << (32 + i);
+		} else if (gp < pmu.ngp) {
+			gpevent[gp] = ev;
+			wrmsr(MSR_PMC0 + gp, 0);
+			wrmsr(MSR_PERFEVTSEL0 + gp, events[ev].evsel
+			      | EVTSEL_USR | EVTSEL_OS | EVTSEL_EN);
+			global |= 1ULL << gp;
+			gp++;
+		}
+	}
+	if (fixedctrl)
+		wrmsr(MSR_FIXED_CTR_CTRL, fixedctrl);
+
+	stat_running = 1;
+	stat_tsc = read_tsc();
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_CTRL, global);
+	return 0;
+}
+
+// Stop counting and store the counts in *ps.
+// Must run on the CPU that called perf_stat_start().
+void
+perf_stat_stop(struct Perfstat *ps)
+{
+	int i;
+
+	pmu_disable();
+	ps->ps_tsc = read_tsc() - stat_tsc;
+	ps->ps_counted = 0;
+	for (i = 0; i < pmu.ngp; i++)
+		if (gpevent[i] >= 0) {
+			ps->ps_count[gpevent[i]] = rdmsr(MSR_PMC0 + i) & pmu.gpmask;
+			ps->ps_counted |= 1 << gpevent[i];
+		}
+	for (i = 0; i < pmu.nfixed; i++)
+		if (fixedevent[i] >= 0) {
+			ps->ps_count[fixedevent[i]] =
+				rdmsr(MSR_FIXED_CTR0 + i) & pmu.fixedmask;
+			ps->ps_counted |= 1 << fixedevent[i];
+		}
+	stat_running = 0;
+}
+
+void
+perf_stat_print(const struct Perfstat *ps)
+{
+	uint64_t cycles = 0, instrs = 0, x;
+	int i;
+
+	if (ps->ps_counted & (1 << PERF_CYCLES))
+		cycles = ps->ps_count[PERF_CYCLES];
+	if (ps->ps_counted & (1 << PERF_INSTRS))
+		instrs = ps->ps_count[PERF_INSTRS];
+
+	for (i = 0; i < NPERFEVENT; i++) {
+		if (!(ps->ps_counted & (1 << i))) {
+			cprintf("  %14s  %s\n", perf_can_count(i)
+				? "<not counted>" : "<not supported>",
+				events[i].name);
+			continue;
+		}
+		cprintf("  %14llu  %s", ps->ps_count[i], events[i].name);
+		if (i == PERF_INSTRS && cycles) {
+			x = instrs * 100 / cycles;
+			cprintf("  # %llu.%02llu per cycle", x / 100, x % 100);
+		} else if (i != PERF_CYCLES && instrs) {
+			x = ps->ps_count[i] * 100000 / instrs;
+			cprintf("  # %llu.%02llu per 1000 instructions",
+				x / 100, x % 100);
+		}
+		cprintf("\n");
+	}
+	cprintf("  %14llu  TSC ticks elapsed\n", ps->ps_tsc);
+}
+
+// Sample, on this CPU, every 'period' occurrences of 'event'.
+int
+perf_sample_start(int event, uint32_t period)
+{
+	if (!perf_can_count(event) || period == 0 || period > 0x7FFFFFFF
+	    || stat_running || sample_period)
+		return -E_INVAL;
+	pmu_disable();
+	if (lapic_perfint(1) < 0)
+		return -E_INVAL;
+
+	sample_cpu = cpunum();
+	sample_period = period;
+	// The counter counts up and interrupts as it wraps to 0.  (A
+	// write sets bits 31:0 and copies bit 31 into the rest.)
+	wrmsr(MSR_PMC0, -(uint64_t) period & pmu.gpmask);
+	wrmsr(MSR_PERFEVTSEL0, events[event].evsel | EVTSEL_USR
+	      | EVTSEL_OS | EVTSEL_INT | EVTSEL_EN);
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_CTRL, 1);
+	return 0;
+}
+
+// Whether PMC0 has wrapped since it was last loaded with -period.
+static bool
+pmc0_overflowed(void)
+{
+	if (pmu.version >= 2)
+		return rdmsr(MSR_GLOBAL_STATUS) & 1;
+	// the top bit stays set until the counter wraps
+	return !(rdmsr(MSR_PMC0) & (pmu.gpmask ^ (pmu.gpmask >> 1)));
+}
+
+// Must run on the CPU that called perf_sample_start().
+void
+perf_sample_stop(void)
+{
+	if (!sample_period)
+		return;
+	sample_period = 0;
+	pmu_disable();
+	lapic_perfint(0);
+	// Unless PMC0 overflowed since it was last reloaded, no NMI of
+	// ours can still be on its way, and the rest are someone else's.
+	if (!pmc0_overflowed())
+		sample_cpu = -1;
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_OVF_CTRL, 1);
+}
+
+// Called for an NMI.  Returns 1 if it was a counter overflow.
+int
+perf_intr(struct Trapframe *tf)
+{
+	if (sample_cpu != cpunum())
+		return 0;
+	// The one overflow that was on its way as sampling stopped
+	if (!sample_period) {
+		sample_cpu = -1;
+		return 1;
+	}
+
+	if (!pmc0_overflowed())
+		return 0;
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_OVF_CTRL, 1);
+
+	prof_tick(tf);
+	wrmsr(MSR_PMC0, -(uint64_t) sample_period & pmu.gpmask);
+	// delivering the interrupt masked it in the local APIC
+	lapic_perfint(1);
+	return 1;
+}
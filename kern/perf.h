@@ -0,0 +1,43 @@
+#ifndef JOS_KERN_PERF_H
+#define JOS_KERN_PERF_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Trapframe;
+
+// Events the performance counters can count; perf.c has a name for each.
+enum {
+	PERF_CYCLES,
+	PERF_INSTRS,
+	PERF_LLCMISS,
+	PERF_BRMISS,
+	PERF_DTLBMISS,
+	NPERFEVENT
+};
+
+// Counts gathered by perf_stat_start()/perf_stat_stop().
+struct Perfstat {
+	uint64_t ps_tsc;			// cycles of wall time
+	uint32_t ps_counted;			// bit i: ps_count[i] is valid
+	uint64_t ps_count[NPERFEVENT];
+};
+
+void perf_init(void);
+bool perf_available(void);
+bool perf_can_count(int event);
+int perf_event_byname(const char *name);
+const char *perf_event_name(int event);
+void perf_print_info(void);
+
+int perf_stat_start(void);
+void perf_stat_stop(struct Perfstat *ps);
+void perf_stat_print(const struct Perfstat *ps);
+
+int perf_sample_start(int event, uint32_t period);
+void perf_sample_stop(void);
+int perf_intr(struct Trapframe *tf);
+
+#endif /* !JOS_KERN_PERF_H */
@@ -0,0 +1,669 @@
+/* See COPYRIGHT for copyright information. */
+
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/assert.h>
+#include <inc/bootinfo.h>
+
+#include <kern/pmap.h>
+#include <kern/kclock.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// These variables are set by i386_detect_memory()
+size_t npages;			// Amount of physical memory (in pages)
+static size_t npages_basemem;	// Amount of base memory (in pages)
+
+// Kernel-only mappings.  The kernel keeps running on entry_pgdir, which
+// already maps all usable memory at KERNBASE; mem_init adds the rest.
+pde_t *kern_pgdir;		// Kernel's initial page directory
+struct PageInfo *pages;		// Physical page state array
+
+// Free pages, in blocks of 2^order pages that are aligned to their
+// size.  free_area[o] lists the free blocks of order o.
+static struct Freearea {
+	struct PageInfo *fa_head;
+	size_t fa_nblocks;
+	uint32_t fa_nalloc;	// blocks of this order handed out
+	uint32_t fa_nfree;	// and returned
+} free_area[MAX_ORDER + 1];
+
+static uint32_t buddy_nsplit;	// larger blocks broken up to allocate
+static uint32_t buddy_nmerge;	// buddies coalesced on free
+static uint32_t buddy_nfail;	// allocations nothing was left for
+static struct spinlock buddy_spinlock = SPINLOCK_INIT("buddy");
+
+// Single pages are recycled through a magazine per CPU, so the common
+// page_alloc/page_free only touches state no other CPU uses.  Misses
+// move half a magazine at a time to or from the buddy lists.
+#define MAG_SIZE	32
+#define MAG_BATCH	(MAG_SIZE / 2)
+
+static struct Pagemag {
+	int pm_count;
+	struct PageInfo *pm_pages[MAG_SIZE];	// pm_pages[pm_count-1] is hottest
+	uint32_t pm_nalloc;
+	uint32_t pm_nfree;
+	uint32_t pm_nrefill;
+	uint32_t pm_ndrain;
+} mags[NCPU];
+
+
+// --------------------------------------------------------------
+// Detect machine's physical memory setup.
+// --------------------------------------------------------------
+
+static int
+nvram_read(int r)
+{
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+}
+
+static void
+i386_detect_memory(void)
+{
+	size_t basemem, extmem, ext16mem, totalmem;
+
+	// Use CMOS calls to measure available base & extended memory.
+	// (CMOS calls return results in kilobytes.)
+	basemem = nvram_read(NVRAM_BASELO);
+	extmem = nvram_read(NVRAM_EXTLO);
+	ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+
+	// Calculate the number of physical pages available in both base
+	// and extended memory.
+	if (ext16mem)
+		totalmem = 16 * 1024 + ext16mem;
+	else if (extmem)
+		totalmem = 1 * 1024 + extmem;
+	else
+		totalmem = basemem;
+
+	npages = totalmem / (PGSIZE / 1024);
+	npages_basemem = basemem / (PGSIZE / 1024);
+
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+		totalmem, basemem, totalmem - basemem);
+
+	// The kernel can only reach what entry_pgdir maps at KERNBASE.
+	if (npages > (size_t) (0 - KERNBASE) / PGSIZE) {
+		npages = (size_t) (0 - KERNBASE) / PGSIZE;
+		cprintf("Using only the first %uK\n", npages * (PGSIZE / 1024));
+	}
+}
+
+
+// --------------------------------------------------------------
+// Set up memory mappings above UTOP.
+// --------------------------------------------------------------
+
+static void mem_init_mp(void);
+static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static void check_page_alloc(void);
+
+// This simple physical memory allocator is used only while JOS is setting
+// up its virtual memory system.  page_alloc() is the real allocator.
+//
+// If n>0, allocates enough pages of contiguous physical memory to hold 'n'
+// bytes.  Doesn't initialize the memory.  Returns a kernel virtual address.
+//
+// If n==0, returns the address of the next free page without allocating
+// anything.
+//
+// This function may ONLY be used during initialization,
+// before page_init() has set up the free lists.
+static void *
+boot_alloc(uint32_t n)
+{
+	static char *nextfree;	// virtual address of next byte of free memory
+	char *result;
+
+	// Initialize nextfree if this is the first time.
+	// 'end' is a magic symbol automatically generated by the linker,
+	// which points to the end of the kernel's bss segment:
+	// the first virtual address that the linker did *not* assign
+	// to any kernel code or global variables.
+	if (!nextfree) {
+		extern char end[];
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+	}
+
+	result = nextfree;
+	nextfree = ROUNDUP(nextfree + n, PGSIZE);
+	if ((uintptr_t) nextfree - KERNBASE > npages * PGSIZE)
+		panic("boot_alloc: out of memory");
+	return result;
+}
+
+// Set up the physical page allocator and the kernel's mappings below
+// KERNBASE.
+//
+// The kernel stays on entry_pgdir, which maps all of the memory it can
+// use with 4MB pages; page tables are only needed for the per-CPU
+// kernel stacks and MMIO.  UPAGES gets a mapping of 'pages' once there
+// are user environments to read it.
+void
+mem_init(void)
+{
+	extern pde_t entry_pgdir[];
+
+	// Find out how much memory the machine has (npages & npages_basemem).
+	i386_detect_memory();
+
+	kern_pgdir = entry_pgdir;
+
+	//////////////////////////////////////////////////////////////////////
+	// Allocate an array of npages 'struct PageInfo's and store it in 'pages'.
+	// The kernel uses this array to keep track of physical pages: for
+	// each physical page, there is a corresponding struct PageInfo in this
+	// array.  'npages' is the number of physical pages in memory.
+	pages = boot_alloc(npages * sizeof(struct PageInfo));
+	memset(pages, 0, npages * sizeof(struct PageInfo));
+
+	//////////////////////////////////////////////////////////////////////
+	// Now that we've allocated the initial kernel data structures, we set
+	// up the buddy free lists.  Once that's done, all further memory
+	// management will go through page_alloc and page_free.
+	page_init();
+
+	check_page_alloc();
+
+	// Initialize the SMP-related parts of the memory map
+	mem_init_mp();
+}
+
+// Modify mappings in kern_pgdir to support SMP
+//   - Map the per-CPU stacks in the region [KSTACKTOP-PTSIZE, KSTACKTOP)
+//
+static void
+mem_init_mp(void)
+{
+	int i;
+
+	// For CPU i, use the physical memory that 'percpu_kstacks[i]' refers
+	// to as its kernel stack. CPU i's kernel stack grows down from virtual
+	// address kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP), and is
+	// divided into two pieces, just like the single stack you set up in
+	// mem_init:
+	//     * [kstacktop_i - KSTKSIZE, kstacktop_i)
+	//          -- backed by physical memory
+	//     * [kstacktop_i - (KSTKSIZE + KSTKGAP), kstacktop_i - KSTKSIZE)
+	//          -- not backed; so if the kernel overflows its stack,
+	//             it will fault rather than overwrite another CPU's stack.
+	//             Known as a "guard page".
+	//     Permissions: kernel RW, user NONE
+	for (i = 0; i < NCPU; i++)
+		boot_map_region(kern_pgdir,
+				KSTACKTOP - i * (KSTKSIZE + KSTKGAP) - KSTKSIZE,
+				KSTKSIZE, PADDR(percpu_kstacks[i]), PTE_W);
+}
+
+// --------------------------------------------------------------
+// Tracking of physical pages.
+// The 'pages' array has one 'struct PageInfo' entry per physical page.
+// Free pages are kept in the buddy lists and the per-CPU magazines.
+// --------------------------------------------------------------
+
+// The buddy lists are shared by all CPUs.  Interrupts stay off while
+// the lock is held, so a handler on this CPU can't spin on it forever.
+static uint32_t
+buddy_lock(void)
+{
+	uint32_t eflags = read_eflags();
+
+	asm volatile("cli");
+	spin_lock(&buddy_spinlock);
+	return eflags;
+}
+
+static void
+buddy_unlock(uint32_t eflags)
+{
+	spin_unlock(&buddy_spinlock);
+	write_eflags(eflags);
+}
+
+static void
+buddy_insert(struct PageInfo *pp, int order)
+{
+	struct Freearea *fa = &free_area[order];
+
+	pp->pp_order = order;
+	pp->pp_flags = PP_FREE;
+	pp->pp_prev = NULL;
+	pp->pp_link = fa->fa_head;
+	if (fa->fa_head)
+		fa->fa_head->pp_prev = pp;
+	fa->fa_head = pp;
+	fa->fa_nblocks++;
+}
+
+static void
+buddy_remove(struct PageInfo *pp)
+{
+	struct Freearea *fa = &free_area[pp->pp_order];
+
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		fa->fa_head = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_link = pp->pp_prev = NULL;
+	pp->pp_flags = 0;
+	fa->fa_nblocks--;
+}
+
+// Take a block of 2^order pages off the free lists, splitting the
+// smallest larger block if there is none of that size.
+// Call with the buddy lock held.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	struct PageInfo *pp;
+	int o;
+
+	for (o = order; o <= MAX_ORDER && !free_area[o].fa_head; o++)
+		/* do nothing */;
+	if (o > MAX_ORDER) {
+		buddy_nfail++;
+		return NULL;
+	}
+
+	pp = free_area[o].fa_head;
+	buddy_remove(pp);
+	// Give back the upper half until the block is the right size.
+	while (o > order) {
+		o--;
+		buddy_insert(pp + (1 << o), o);
+		buddy_nsplit++;
+	}
+	pp->pp_order = order;
+	free_area[order].fa_nalloc++;
+	return pp;
+}
+
+// Return a block of 2^order pages to the free lists, merging it with
+// its buddy for as long as the buddy is free too.
+// Call with the buddy lock held.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+	struct PageInfo *buddy;
+	size_t pfn = pp - pages, bfn;
+
+	free_area[order].fa_nfree++;
+	for (; order < MAX_ORDER; order++) {
+		bfn = pfn ^ (1 << order);
+		if (bfn + (1 << order) > npages)
+			break;
+		buddy = &pages[bfn];
+		if (!(buddy->pp_flags & PP_FREE) || buddy->pp_order != order)
+			break;
+		buddy_remove(buddy);
+		pfn &= ~(1 << order);
+		buddy_nmerge++;
+	}
+	buddy_insert(&pages[pfn], order);
+}
+
+//
+// Initialize page structures and the buddy free lists.
+// After this is done, NEVER use boot_alloc again.  ONLY use the page
+// allocator functions below to allocate and deallocate physical
+// memory.
+//
+void
+page_init(void)
+{
+	physaddr_t pa, kend = PADDR(boot_alloc(0));
+	uint32_t eflags;
+	size_t i;
+
+	// These pages stay in use for good (pp_ref 1):
+	//  1) Physical page 0, which holds the real-mode IDT and BIOS
+	//     structures in case we ever need them.
+	//  2) The page the boot loader leaves its struct Bootinfo in.
+	//  3) The page at MPENTRY_PADDR, where boot_aps() puts the code
+	//     the other CPUs start in.
+	//  4) The IO hole [IOPHYSMEM, EXTPHYSMEM).
+	//  5) The kernel and everything boot_alloc handed out, which
+	//     start at EXTPHYSMEM and end at kend.
+	// The rest of memory is free.
+	eflags = buddy_lock();
+	for (i = 0; i < npages; i++) {
+		pa = i * PGSIZE;
+		if (i == 0 || pa == ROUNDDOWN(BOOTINFO_PA, PGSIZE)
+		    || pa == MPENTRY_PADDR
+		    || (i >= npages_basemem && pa < kend)) {
+			pages[i].pp_ref = 1;
+			continue;
+		}
+		buddy_free(&pages[i], 0);
+	}
+	// Those were not frees anybody asked for.
+	free_area[0].fa_nfree = 0;
+	buddy_nmerge = 0;
+	buddy_unlock(eflags);
+}
+
+// Fill an empty magazine with MAG_BATCH pages from the buddy lists.
+static void
+mag_refill(struct Pagemag *pm)
+{
+	struct PageInfo *pp;
+	uint32_t eflags;
+	int i;
+
+	eflags = buddy_lock();
+	while (pm->pm_count < MAG_BATCH && (pp = buddy_alloc(0)))
+		pm->pm_pages[pm->pm_count++] = pp;
+	buddy_unlock(eflags);
+	for (i = 0; i < pm->pm_count; i++)
+		pm->pm_pages[i]->pp_flags = PP_MAG;
+	pm->pm_nrefill++;
+}
+
+// Return the MAG_BATCH coldest pages of a full magazine to the buddy
+// lists, keeping the recently freed ones, which are likely still in
+// the cache.
+static void
+mag_drain(struct Pagemag *pm)
+{
+	uint32_t eflags;
+	int i;
+
+	eflags = buddy_lock();
+	for (i = 0; i < MAG_BATCH; i++) {
+		pm->pm_pages[i]->pp_flags = 0;
+		buddy_free(pm->pm_pages[i], 0);
+	}
+	buddy_unlock(eflags);
+	pm->pm_count -= MAG_BATCH;
+	memmove(pm->pm_pages, pm->pm_pages + MAG_BATCH,
+		pm->pm_count * sizeof(pm->pm_pages[0]));
+	pm->pm_ndrain++;
+}
+
+//
+// Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
+// returned physical page with '\0' bytes.  Does NOT increment the reference
+// count of the page - the caller must do these if necessary (either explicitly
+// or via page_insert).
+//
+// Be sure to set the pp_link field of the allocated page to NULL so
+// page_free can check for double-free bugs.
+//
+// Returns NULL if out of free memory.
+//
+struct PageInfo *
+page_alloc(int alloc_flags)
+{
+	struct PageInfo *pp = NULL;
+	struct Pagemag *pm;
+	uint32_t eflags;
+
+	// The magazine is this CPU's alone, but an interrupt handler
+	// could still get at it halfway through.
+	eflags = read_eflags();
+	asm volatile("cli");
+	pm = &mags[cpunum()];
+	if (pm->pm_count == 0)
+		mag_refill(pm);
+	if (pm->pm_count > 0) {
+		pp = pm->pm_pages[--pm->pm_count];
+		pp->pp_flags = 0;
+		pm->pm_nalloc++;
+	}
+	write_eflags(eflags);
+
+	if (pp && (alloc_flags & ALLOC_ZERO))
+		memset(page2kva(pp), 0, PGSIZE);
+	return pp;
+}
+
+//
+// Allocates 2^order physically contiguous pages, aligned to their
+// size, for DMA buffers and the like.  Frees go through page_free,
+// which finds the order in the first page.
+//
+// Returns NULL if there is no free block that large.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+	uint32_t eflags;
+
+	if (order == 0)
+		return page_alloc(alloc_flags);
+	if (order < 0 || order > MAX_ORDER)
+		return NULL;
+
+	eflags = buddy_lock();
+	pp = buddy_alloc(order);
+	buddy_unlock(eflags);
+
+	if (pp && (alloc_flags & ALLOC_ZERO))
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Return a page, or a block from page_alloc_order, to the free lists.
+// (This function should only be called when pp->pp_ref reaches 0.)
+//
+void
+page_free(struct PageInfo *pp)
+{
+	struct Pagemag *pm;
+	uint32_t eflags;
+
+	if (pp->pp_ref != 0 || pp->pp_link != NULL || pp->pp_flags != 0)
+		panic("page_free: page %08x is still in use or already free",
+		      page2pa(pp));
+
+	if (pp->pp_order > 0) {
+		eflags = buddy_lock();
+		buddy_free(pp, pp->pp_order);
+		buddy_unlock(eflags);
+		return;
+	}
+
+	eflags = read_eflags();
+	asm volatile("cli");
+	pm = &mags[cpunum()];
+	if (pm->pm_count == MAG_SIZE)
+		mag_drain(pm);
+	pp->pp_flags = PP_MAG;
+	pm->pm_pages[pm->pm_count++] = pp;
+	pm->pm_nfree++;
+	write_eflags(eflags);
+}
+
+// Given 'pgdir', a pointer to a page directory, pgdir_walk returns
+// a pointer to the page table entry (PTE) for linear address 'va'.
+// This requires walking the two-level page table structure.
+//
+// The relevant page table page might not exist yet.
+// If this is true, and create == false, then pgdir_walk returns NULL.
+// Otherwise, pgdir_walk allocates a new page table page with page_alloc.
+//    - If the allocation fails, pgdir_walk returns NULL.
+//    - Otherwise, the new page's reference count is incremented,
+//	the page is cleared,
+//	and pgdir_walk returns a pointer into the new page table page.
+//
+// 'va' must not be in one of entry_pgdir's 4MB pages.
+pte_t *
+pgdir_walk(pde_t *pgdir, const void *va, int create)
+{
+	pde_t *pde = &pgdir[PDX(va)];
+	struct PageInfo *pp;
+
+	if (*pde & PTE_PS)
+		panic("pgdir_walk: %08x is in a 4MB page", va);
+	if (!(*pde & PTE_P)) {
+		if (!create || !(pp = page_alloc(ALLOC_ZERO)))
+			return NULL;
+		pp->pp_ref++;
+		*pde = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+	}
+	return (pte_t *) KADDR(PTE_ADDR(*pde)) + PTX(va);
+}
+
+//
+// Map [va, va+size) of virtual address space to physical [pa, pa+size)
+// in the page table rooted at pgdir.  Size is a multiple of PGSIZE, and
+// va and pa are both page-aligned.
+// Use permission bits perm|PTE_P for the entries.
+//
+// This function is only intended to set up the ``static'' mappings
+// above UTOP.
+//
+static void
+boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm)
+{
+	pte_t *pte;
+	size_t off;
+
+	for (off = 0; off < size; off += PGSIZE) {
+		if (!(pte = pgdir_walk(pgdir, (void *) (va + off), 1)))
+			panic("boot_map_region: out of memory");
+		*pte = (pa + off) | perm | PTE_P;
+	}
+}
+
+//
+// Reserve size bytes in the MMIO region and map [pa,pa+size) at this
+// location.  Return the base of the reserved region.  size does *not*
+// have to be multiple of PGSIZE.
+//
+void *
+mmio_map_region(physaddr_t pa, size_t size)
+{
+	// Where to start the next region.  Initially, this is the
+	// beginning of the MMIO region.  Because this is static, its
+	// value will be preserved between calls to mmio_map_region
+	// (just like nextfree in boot_alloc).
+	static uintptr_t base = MMIOBASE;
+	uintptr_t result;
+
+	// Device memory is not regular DRAM, so the CPU must not cache
+	// it: map it with PTE_PCD|PTE_PWT (cache-disable and
+	// write-through) in addition to PTE_W.
+	size = ROUNDUP(pa + size, PGSIZE) - ROUNDDOWN(pa, PGSIZE);
+	if (base + size > MMIOLIM)
+		panic("mmio_map_region: out of MMIO space");
+	boot_map_region(kern_pgdir, base, size, ROUNDDOWN(pa, PGSIZE),
+			PTE_PCD | PTE_PWT | PTE_W);
+	result = base + PGOFF(pa);
+	base += size;
+	return (void *) result;
+}
+
+// Count the free pages, wherever they are kept.
+static size_t
+page_nfree(void)
+{
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i <= MAX_ORDER; i++)
+		n += free_area[i].fa_nblocks << i;
+	for (i = 0; i < NCPU; i++)
+		n += mags[i].pm_count;
+	return n;
+}
+
+// Print the allocator's counters (the 'meminfo' monitor command).
+void
+page_print_stats(void)
+{
+	int i;
+
+	cprintf("%u pages (%uK), %u free\n", npages, npages * (PGSIZE / 1024),
+		page_nfree());
+	cprintf("order  free blocks    allocs     frees\n");
+	for (i = 0; i <= MAX_ORDER; i++)
+		cprintf("%5d %12u %9u %9u\n", i, free_area[i].fa_nblocks,
+			free_area[i].fa_nalloc, free_area[i].fa_nfree);
+	cprintf("%u splits, %u merges, %u failed allocations\n",
+		buddy_nsplit, buddy_nmerge, buddy_nfail);
+	for (i = 0; i < NCPU; i++) {
+		if (!mags[i].pm_nalloc && !mags[i].pm_nfree)
+			continue;
+		cprintf("CPU %d: %d cached, %u allocs, %u frees, "
+			"%u refills, %u drains\n", i, mags[i].pm_count,
+			mags[i].pm_nalloc, mags[i].pm_nfree,
+			mags[i].pm_nrefill, mags[i].pm_ndrain);
+	}
+}
+
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+//
+// Check the physical page allocator (page_alloc(), page_alloc_order(),
+// page_free()).
+//
+static void
+check_page_alloc(void)
+{
+	struct PageInfo *pp0, *pp1, *pp2, *blk;
+	struct PageInfo *many[MAG_SIZE + MAG_BATCH];
+	size_t nfree;
+	int i;
+
+	if (!pages)
+		panic("'pages' is a null pointer!");
+	nfree = page_nfree();
+	assert(nfree > 0);
+
+	// should be able to allocate three distinct pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+	assert((pp1 = page_alloc(0)));
+	assert((pp2 = page_alloc(0)));
+	assert(pp1 && pp1 != pp0);
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+	assert(page2pa(pp0) < npages*PGSIZE);
+	assert(page2pa(pp1) < npages*PGSIZE);
+	assert(page2pa(pp2) < npages*PGSIZE);
+	assert(page_nfree() == nfree - 3);
+
+	// test flags
+	memset(page2kva(pp0), 1, PGSIZE);
+	page_free(pp0);
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+	for (i = 0; i < PGSIZE; i++)
+		assert(((char *) page2kva(pp0))[i] == 0);
+
+	// blocks come back aligned to their size, giving back what
+	// they were split from
+	assert((blk = page_alloc_order(3, ALLOC_ZERO)));
+	assert((blk - pages) % 8 == 0);
+	assert(blk->pp_order == 3);
+	for (i = 0; i < 8 * PGSIZE; i++)
+		assert(((char *) page2kva(blk))[i] == 0);
+	assert(page_nfree() == nfree - 3 - 8);
+	page_free(blk);
+	assert(page_nfree() == nfree - 3);
+	assert(!page_alloc_order(MAX_ORDER + 1, 0));
+
+	// go through a refill and a drain of the magazine
+	for (i = 0; i < ARRAY_SIZE(many); i++)
+		assert((many[i] = page_alloc(0)));
+	for (i = 0; i < ARRAY_SIZE(many); i++)
+		page_free(many[i]);
+
+	page_free(pp0);
+	page_free(pp1);
+	page_free(pp2);
+	assert(page_nfree() == nfree);
+
+	cprintf("check_page_alloc() succeeded!\n");
+}
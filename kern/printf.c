@@ -1,25 +1,64 @@
 // Simple implementation of cprintf console output for the kernel,
-// based on printfmt() and the kernel console's cputchar().
+// based on printfmt() and the kernel console's cons_write().
 
 #include <inc/types.h>
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
+#include <inc/consc.h>
+
+#include <kern/console.h>
+
+
+// Collect the formatted output and hand it to the console a buffer
+// at a time, so that each device handles a whole span at once rather
+// than being driven byte by byte.
+struct printbuf {
+	int idx;	// current buffer index
+	int cnt;	// total bytes printed so far
+	int attr;	// cons_c in effect for the bytes in buf
+	char buf[256];
+};
 
 
 static void
-putch(int ch, int *cnt)
+flush(struct printbuf *b)
 {
-	cputchar(ch);
-	*cnt++;
+	int c;
+
+	// %m changes cons_c as it is formatted, so show the buffered
+	// bytes in the color they were formatted under
+	c = cons_c;
+	cons_c = b->attr;
+	cons_write(b->buf, b->idx);
+	cons_c = c;
+	b->idx = 0;
+}
+
+static void
+putch(int ch, struct printbuf *b)
+{
+	if (cons_c != b->attr) {
+		flush(b);
+		b->attr = cons_c;
+	}
+	b->buf[b->idx++] = ch;
+	if (b->idx == sizeof(b->buf))
+		flush(b);
+	b->cnt++;
 }
 
 int
 vcprintf(const char *fmt, va_list ap)
 {
-	int cnt = 0;
+	struct printbuf b;
 
-	vprintfmt((void*)putch, &cnt, fmt, ap);
-	return cnt;
+	b.idx = 0;
+	b.cnt = 0;
+	b.attr = cons_c;
+	vprintfmt((void*)putch, &b, fmt, ap);
+	flush(&b);
+
+	return b.cnt;
 }
 
 int
@@ -35,3 +74,29 @@ cprintf(const char *fmt, ...)
 	return cnt;
 }
 
+int
+vcprintfc(struct Printfmt *pf, va_list ap)
+{
+	struct printbuf b;
+
+	b.idx = 0;
+	b.cnt = 0;
+	b.attr = cons_c;
+	vprintfmtc((void*)putch, &b, pf, ap);
+	flush(&b);
+
+	return b.cnt;
+}
+
+int
+cprintfc(struct Printfmt *pf, ...)
+{
+	va_list ap;
+	int cnt;
+
+	va_start(ap, pf);
+	cnt = vcprintfc(pf, ap);
+	va_end(ap);
+
+	return cnt;
+}
@@ -0,0 +1,235 @@
+// Statistical profiler.
+//
+// While the profiler runs, the timer interrupts the kernel prof_hz
+// times a second and prof_tick() counts the interrupted EIP in a
+// per-CPU histogram.  Instead of the timer, a performance counter can
+// interrupt every so many occurrences of its event (see perf.c).  If
+// asked to, it also walks the frame pointers the way mon_backtrace
+// does and counts each return address it finds in a second histogram,
+// so the report can show time spent in a function's callees too.
+// prof_report() symbolizes the PCs with debuginfo_eip() and adds them
+// up by function.
+
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/memlayout.h>
+#include <inc/trap.h>
+
+#include <kern/cpu.h>
+#include <kern/kclock.h>
+#include <kern/kdebug.h>
+#include <kern/perf.h>
+#include <kern/prof.h>
+
+#define PROF_NPROBE	16	// give up on a PC after this many buckets
+#define PROF_NFN	256	// functions prof_report can tell apart
+
+struct Profbucket {
+	uintptr_t pb_pc;
+	uint32_t pb_count;	// 0 if the bucket is free
+};
+
+static struct {
+	struct Profbucket self[PROF_NBUCKET];	 // interrupted PCs
+	struct Profbucket callers[PROF_NBUCKET]; // return addresses above them
+	uint32_t nsample;
+	uint32_t ndropped;	// samples that found the histogram full
+} hists[NCPU];
+
+static bool prof_running, prof_callers;
+static int prof_hz;
+static int prof_event = -1;	// counter event that drives sampling, or -1
+static uint32_t prof_period;	// ... and how many of them per sample
+
+// Count 'pc' in the open-addressed histogram 'h'.
+// Returns 0 if there's no room for it.
+static int
+hist_add(struct Profbucket *h, uintptr_t pc)
+{
+	uint32_t i, n;
+
+	i = pc * 2654435761U;
+	for (n = 0; n < PROF_NPROBE; n++, i++) {
+		struct Profbucket *b = &h[i % PROF_NBUCKET];
+		if (b->pb_count == 0)
+			b->pb_pc = pc;
+		if (b->pb_pc == pc) {
+			b->pb_count++;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Called from the timer interrupt, or the counter overflow NMI.
+void
+prof_tick(struct Trapframe *tf)
+{
+	uint32_t *ebp, *next;
+	int depth;
+
+	if (!prof_running)
+		return;
+
+	hists[cpunum()].nsample++;
+	if (!hist_add(hists[cpunum()].self, tf->tf_eip))
+		hists[cpunum()].ndropped++;
+	if (!prof_callers)
+		return;
+
+	// The interrupted code's frames are on this stack, above the
+	// trap frame; stop at anything that doesn't look like one.
+	// (If it was interrupted in a function's prologue, the first
+	// caller found is its caller's caller.)
+	ebp = (uint32_t *) tf->tf_regs.reg_ebp;
+	for (depth = 0; depth < PROF_DEPTH; depth++) {
+		if ((uintptr_t) ebp <= (uintptr_t) tf
+		    || (uintptr_t) ebp >= (uintptr_t) tf + KSTKSIZE)
+			break;
+		hist_add(hists[cpunum()].callers, ebp[1]);
+		next = (uint32_t *) ebp[0];
+		if (next <= ebp)
+			break;
+		ebp = next;
+	}
+}
+
+// Start profiling from scratch, taking 'hz' samples a second.
+// With 'callers', count time spent in callees towards their callers.
+void
+prof_start(int hz, bool callers)
+{
+	prof_stop();
+	memset(hists, 0, sizeof(hists));
+	prof_hz = hz;
+	prof_event = -1;
+	prof_callers = callers;
+	prof_running = 1;
+	kclock_start(hz);
+}
+
+// Start profiling from scratch, taking a sample on this CPU each
+// 'period' times performance counter event 'event' happens.
+int
+prof_start_event(int event, uint32_t period, bool callers)
+{
+	int r;
+
+	prof_stop();
+	memset(hists, 0, sizeof(hists));
+	prof_event = event;
+	prof_period = period;
+	prof_callers = callers;
+	prof_running = 1;
+	if ((r = perf_sample_start(event, period)) < 0)
+		prof_running = 0;
+	return r;
+}
+
+void
+prof_stop(void)
+{
+	if (prof_running && prof_event >= 0)
+		perf_sample_stop();
+	else if (prof_running)
+		kclock_stop();
+	prof_running = 0;
+}
+
+struct Proffn {
+	const char *pf_name;	// not null terminated
+	int pf_namelen;
+	uint32_t pf_self;	// samples in the function itself
+	uint32_t pf_total;	// ... and in what it called
+};
+
+// Find or make the entry in 'fns' for the function containing 'pc'.
+static struct Proffn *
+fn_add(struct Proffn *fns, int *nfns, uintptr_t pc)
+{
+	struct Eipdebuginfo info;
+	int i;
+
+	debuginfo_eip(pc, &info);
+	if (strncmp(info.eip_fn_name, "<unknown>", 9) == 0
+	    && strcmp(info.eip_file, "<unknown>") != 0) {
+		// not in a function; count it by source file
+		info.eip_fn_name = info.eip_file;
+		info.eip_fn_namelen = strlen(info.eip_file);
+	}
+	for (i = 0; i < *nfns; i++)
+		if (fns[i].pf_name == info.eip_fn_name)
+			return &fns[i];
+	if (*nfns == PROF_NFN)
+		return NULL;
+	fns[i].pf_name = info.eip_fn_name;
+	fns[i].pf_namelen = info.eip_fn_namelen;
+	fns[i].pf_self = fns[i].pf_total = 0;
+	(*nfns)++;
+	return &fns[i];
+}
+
+// Print the 'n' functions with the most samples of their own.
+void
+prof_report(int n)
+{
+	static struct Proffn fns[PROF_NFN];
+	struct Proffn *f, t;
+	uint32_t nsample, ndropped;
+	int cpu, i, j, nfns;
+	bool running;
+
+	// keep the histograms still while we read them
+	running = prof_running;
+	prof_running = 0;
+
+	nfns = 0;
+	nsample = ndropped = 0;
+	for (cpu = 0; cpu < NCPU; cpu++) {
+		nsample += hists[cpu].nsample;
+		ndropped += hists[cpu].ndropped;
+		for (i = 0; i < PROF_NBUCKET; i++) {
+			struct Profbucket *b = &hists[cpu].self[i];
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc))) {
+				f->pf_self += b->pb_count;
+				f->pf_total += b->pb_count;
+			}
+			b = &hists[cpu].callers[i];
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc)))
+				f->pf_total += b->pb_count;
+		}
+	}
+
+	prof_running = running;
+
+	if (prof_event >= 0)
+		cprintf("%u samples, one per %u %s", nsample, prof_period,
+			perf_event_name(prof_event));
+	else
+		cprintf("%u samples at %d Hz", nsample, prof_hz);
+	if (ndropped)
+		cprintf(", %u not counted", ndropped);
+	cprintf("\n");
+	if (nsample == 0)
+		return;
+	cprintf(prof_callers ? "    self        total\n" : "    self\n");
+
+	// selection sort of the top n
+	for (i = 0; i < n && i < nfns; i++) {
+		for (j = i + 1; j < nfns; j++)
+			if (fns[j].pf_self > fns[i].pf_self) {
+				t = fns[i];
+				fns[i] = fns[j];
+				fns[j] = t;
+			}
+		f = &fns[i];
+		cprintf_cached("  %6u %3u.%u%%", f->pf_self,
+			f->pf_self * 100 / nsample,
+			f->pf_self * 1000 / nsample % 10);
+		if (prof_callers)
+			cprintf_cached(" %6u %3u.%u%%", f->pf_total,
+				f->pf_total * 100 / nsample,
+				f->pf_total * 1000 / nsample % 10);
+		cprintf_cached("  %.*s\n", f->pf_namelen, f->pf_name);
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef JOS_KERN_PROF_H
+#define JOS_KERN_PROF_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Trapframe;
+
+#define PROF_NBUCKET	512	// distinct PCs per histogram; must be a power of 2
+#define PROF_DEPTH	8	// callers recorded per sample, with callers on
+
+void prof_start(int hz, bool callers);
+int prof_start_event(int event, uint32_t period, bool callers);
+void prof_stop(void);
+void prof_report(int n);
+void prof_tick(struct Trapframe *tf);
+
+#endif /* !JOS_KERN_PROF_H */
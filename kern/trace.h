@@ -0,0 +1,42 @@
+#ifndef JOS_KERN_TRACE_H
+#define JOS_KERN_TRACE_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+// Trace event ids; trace.c has a name for each.
+enum {
+	TR_MARK = 1,	// "trace mark" from the monitor
+	TR_TRAP,	// trap(): trapno, eip, err
+	NTRACEEVENT
+};
+
+// One trace record.  The ring holds TRACE_NREC of them per CPU.
+struct Tracerec {
+	uint64_t tr_tsc;	// read_tsc() when the event happened
+	uint32_t tr_event;	// TR_*
+	uintptr_t tr_eip;	// where trace() was called from
+	uint32_t tr_arg[4];	// event specific
+};
+
+#define TRACE_NREC	512	// records per CPU; must be a power of 2
+
+extern bool trace_on;
+
+void trace_event(uint32_t event, uint32_t a0, uint32_t a1, uint32_t a2,
+		 uint32_t a3);
+int trace_nrec(int cpu);
+void trace_clear(void);
+void trace_dump(int n);
+
+// Record an event if tracing is on.  Safe in any context, including
+// interrupt handlers; it never takes a lock or prints anything.
+#define trace(event, a0, a1, a2, a3)					\
+	do {								\
+		if (trace_on)						\
+			trace_event(event, a0, a1, a2, a3);		\
+	} while (0)
+
+#endif /* !JOS_KERN_TRACE_H */
@@ -27,27 +27,68 @@ static const char * const error_string[MAXERROR] =
 	[E_NO_MEM]	= "out of memory",
 	[E_NO_FREE_ENV]	= "out of environments",
 	[E_FAULT]	= "segmentation fault",
+	[E_IO]		= "I/O error",
 };
 
+// n / 10 for any 32-bit n: multiply by 2^35 / 10, rounded up, and
+// shift the fraction back out.  One 32x32-bit multiply, no divide.
+static inline uint32_t
+div10(uint32_t n)
+{
+	return ((uint64_t) n * 0xCCCCCCCDU) >> 35;
+}
+
 /*
- * Print a number (base <= 16) in reverse order,
- * using specified putch function and associated pointer putdat.
+ * Print a number (base 8, 10 or 16), padded on the left to 'width'
+ * with 'padc', using specified putch function and associated pointer
+ * putdat.
+ *
+ * The digits are produced least significant first into a buffer.
+ * Bases 8 and 16 take them off with shifts and masks.  Base 10 works
+ * on 32-bit values, where dividing by 10 is a multiply; a larger
+ * number is first split into 9-digit chunks, which costs one 64-bit
+ * division (a libgcc call on the i386) per chunk rather than per digit.
  */
 static void
 printnum(void (*putch)(int, void*), void *putdat,
 	 unsigned long long num, unsigned base, int width, int padc)
 {
-	// first recursively print all preceding (more significant) digits
-	if (num >= base) {
-		printnum(putch, putdat, num / base, base, width - 1, padc);
+	char buf[22];		// UINT64_MAX takes 22 octal digits
+	char *p = buf + sizeof(buf);
+	unsigned long long hi;
+	uint32_t n, q;
+	int i, shift;
+
+	if (base != 10) {
+		shift = (base == 16 ? 4 : 3);
+		do {
+			*--p = "0123456789abcdef"[num & (base - 1)];
+			num >>= shift;
+		} while (num);
 	} else {
-		// print any needed pad characters before first digit
-		while (--width > 0)
-			putch(padc, putdat);
+		while (num > 0xFFFFFFFFU) {
+			// the remainder from the quotient, not a second call
+			hi = num / 1000000000;
+			n = num - hi * 1000000000;
+			num = hi;
+			for (i = 0; i < 9; i++, n = q) {
+				q = div10(n);
+				*--p = '0' + (n - q * 10);
+			}
+		}
+		n = num;
+		do {
+			q = div10(n);
+			*--p = '0' + (n - q * 10);
+			n = q;
+		} while (n);
 	}
 
-	// then print this (the least significant) digit
-	putch("0123456789abcdef"[num % base], putdat);
+	// print any needed pad characters before first digit
+	for (width -= buf + sizeof(buf) - p; width > 0; width--)
+		putch(padc, putdat);
+	while (p < buf + sizeof(buf))
+		putch(*p++, putdat);
 }
 
 // Get an unsigned int of various possible sizes from a varargs list,
@@ -80,15 +121,235 @@ getint(va_list *ap, int lflag)
 // Main function to format and print a string.
 void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
 
-void
-vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+// Parse the conversion specification that follows a '%', at fmt, into
+// *ps.  Returns a pointer just past it.  An unrecognized conversion
+// gets ps_conv 0.
+//
+// '*' takes the width or precision from the argument list ap.  When
+// ap is NULL the specification is being parsed ahead of time, for
+// vprintfmtc(): a '*' then only records, in ps_wstar or ps_pstar,
+// which of the ps_nstar arguments will supply the width or precision.
+// This fails, returning NULL, if where later characters of the
+// specification go would depend on an argument's value.
+static const char *
+parsespec(const char *fmt, struct Printfspec *ps, va_list *ap)
+{
+	int ch;
+
+	ps->ps_padc = ' ';
+	ps->ps_width = -1;
+	ps->ps_precision = -1;
+	ps->ps_lflag = 0;
+	ps->ps_altflag = 0;
+	ps->ps_nstar = ps->ps_wstar = ps->ps_pstar = 0;
+reswitch:
+	switch (ch = *(unsigned char *) fmt++) {
+
+	// flag to pad on the right
+	case '-':
+		ps->ps_padc = '-';
+		goto reswitch;
+
+	// flag to pad with 0's instead of spaces
+	case '0':
+		ps->ps_padc = '0';
+		goto reswitch;
+
+	// width field
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+		if (ps->ps_wstar)
+			return NULL;
+		for (ps->ps_precision = 0; ; ++fmt) {
+			ps->ps_precision = ps->ps_precision * 10 + ch - '0';
+			ch = *fmt;
+			if (ch < '0' || ch > '9')
+				break;
+		}
+		ps->ps_pstar = 0;
+		goto process_precision;
+
+	case '*':
+		if (ap) {
+			ps->ps_precision = va_arg(*ap, int);
+			goto process_precision;
+		}
+		if (ps->ps_wstar)
+			return NULL;
+		ps->ps_nstar++;
+		if (ps->ps_width < 0)
+			ps->ps_wstar = ps->ps_nstar;
+		else
+			ps->ps_pstar = ps->ps_nstar;
+		goto reswitch;
+
+	case '.':
+		if (ps->ps_wstar)
+			return NULL;
+		if (ps->ps_width < 0)
+			ps->ps_width = 0;
+		goto reswitch;
+
+	case '#':
+		ps->ps_altflag = 1;
+		goto reswitch;
+
+	process_precision:
+		if (ps->ps_width < 0)
+			ps->ps_width = ps->ps_precision, ps->ps_precision = -1;
+		goto reswitch;
+
+	// long flag (doubled for long long)
+	case 'l':
+		ps->ps_lflag++;
+		goto reswitch;
+
+	case 'c':
+	case 'e':
+	case 's':
+	case 'd':
+	case 'u':
+	case 'o':
+	case 'p':
+	case 'm':
+	case 'x':
+	case '%':
+		ps->ps_conv = ch;
+		return fmt;
+
+	// unrecognized escape sequence
+	default:
+		if (!ap && ps->ps_nstar)
+			return NULL;
+		ps->ps_conv = 0;
+		return fmt;
+	}
+}
+
+// Print one argument as specification *ps says.
+static void
+printspec(void (*putch)(int, void*), void *putdat,
+	  const struct Printfspec *ps, va_list *ap)
 {
 	register const char *p;
 	register int ch, err;
 	unsigned long long num;
-	int base, lflag, width, precision, altflag;
+	int base, i, lflag, width, precision, altflag;
 	char padc;
 
+	padc = ps->ps_padc;
+	width = ps->ps_width;
+	precision = ps->ps_precision;
+	lflag = ps->ps_lflag;
+	altflag = ps->ps_altflag;
+	for (i = 1; i <= ps->ps_nstar; i++) {
+		ch = va_arg(*ap, int);
+		if (i == ps->ps_wstar)
+			width = ch;
+		else if (i == ps->ps_pstar)
+			precision = ch;
+	}
+
+	switch (ps->ps_conv) {
+	// character
+	case 'c':
+		putch(va_arg(*ap, int), putdat);
+		break;
+
+	// error message
+	case 'e':
+		err = va_arg(*ap, int);
+		if (err < 0)
+			err = -err;
+		if (err >= MAXERROR || (p = error_string[err]) == NULL)
+			printfmt(putch, putdat, "error %d", err);
+		else
+			printfmt(putch, putdat, "%s", p);
+		break;
+
+	// string
+	case 's':
+		if ((p = va_arg(*ap, char *)) == NULL)
+			p = "(null)";
+		if (width > 0 && padc != '-')
+			for (width -= strnlen(p, precision); width > 0; width--)
+				putch(padc, putdat);
+		for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+			if (altflag && (ch < ' ' || ch > '~'))
+				putch('?', putdat);
+			else
+				putch(ch, putdat);
+		for (; width > 0; width--)
+			putch(' ', putdat);
+		break;
+
+	// (signed) decimal
+	case 'd':
+		num = getint(ap, lflag);
+		if ((long long) num < 0) {
+			putch('-', putdat);
+			num = -(long long) num;
+		}
+		base = 10;
+		goto number;
+
+	// unsigned decimal
+	case 'u':
+		num = getuint(ap, lflag);
+		base = 10;
+		goto number;
+
+	// (unsigned) octal
+	case 'o':
+		num = getuint(ap, lflag);
+		base = 8;
+		goto number;
+
+	// pointer
+	case 'p':
+		putch('0', putdat);
+		putch('x', putdat);
+		num = (unsigned long long)
+			(uintptr_t) va_arg(*ap, void *);
+		base = 16;
+		goto number;
+
+	// change color
+	case 'm':
+		num = getint(ap, lflag);
+		cons_c = num;
+		break;
+
+	// (unsigned) hexadecimal
+	case 'x':
+		num = getuint(ap, lflag);
+		base = 16;
+
+	number:
+		printnum(putch, putdat, num, base, width, padc);
+		break;
+
+	// escaped '%' character
+	case '%':
+		putch('%', putdat);
+		break;
+	}
+}
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+	struct Printfspec ps;
+	const char *spec;
+	int ch;
+
 	while (1) {
 		while ((ch = *(unsigned char *) fmt++) != '%') {
 			if (ch == '\0') {
@@ -99,161 +360,88 @@ vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
 		}
 
 		// Process a %-escape sequence
-		padc = ' ';
-		width = -1;
-		precision = -1;
-		lflag = 0;
-		altflag = 0;
-	reswitch:
-		switch (ch = *(unsigned char *) fmt++) {
-
-		// flag to pad on the right
-		case '-':
-			padc = '-';
-			goto reswitch;
-
-		// flag to pad with 0's instead of spaces
-		case '0':
-			padc = '0';
-			goto reswitch;
-
-		// width field
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':
-			for (precision = 0; ; ++fmt) {
-				precision = precision * 10 + ch - '0';
-				ch = *fmt;
-				if (ch < '0' || ch > '9')
-					break;
-			}
-			goto process_precision;
-
-		case '*':
-			precision = va_arg(ap, int);
-			goto process_precision;
-
-		case '.':
-			if (width < 0)
-				width = 0;
-			goto reswitch;
-
-		case '#':
-			altflag = 1;
-			goto reswitch;
-
-		process_precision:
-			if (width < 0)
-				width = precision, precision = -1;
-			goto reswitch;
-
-		// long flag (doubled for long long)
-		case 'l':
-			lflag++;
-			goto reswitch;
-
-		// character
-		case 'c':
-			putch(va_arg(ap, int), putdat);
-			break;
-
-		// error message
-		case 'e':
-			err = va_arg(ap, int);
-			if (err < 0)
-				err = -err;
-			if (err >= MAXERROR || (p = error_string[err]) == NULL)
-				printfmt(putch, putdat, "error %d", err);
-			else
-				printfmt(putch, putdat, "%s", p);
-			break;
+		spec = fmt;
+		fmt = parsespec(fmt, &ps, &ap);
+		if (ps.ps_conv == 0) {
+			// unrecognized: just print it literally
+			putch('%', putdat);
+			fmt = spec;
+			continue;
+		}
+		printspec(putch, putdat, &ps, &ap);
+	}
+}
 
-		// string
-		case 's':
-			if ((p = va_arg(ap, char *)) == NULL)
-				p = "(null)";
-			if (width > 0 && padc != '-')
-				for (width -= strnlen(p, precision); width > 0; width--)
-					putch(padc, putdat);
-			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
-				if (altflag && (ch < ' ' || ch > '~'))
-					putch('?', putdat);
-				else
-					putch(ch, putdat);
-			for (; width > 0; width--)
-				putch(' ', putdat);
-			break;
+// Turn pf->pf_fmt into the op list pf->pf_ops: each op is the literal
+// text up to the next conversion, then the conversion.  The last op
+// has only the text after the last conversion.  Sets pf_nops to -1 if
+// the format does not fit or cannot be parsed ahead of time.
+static void
+printfmt_compile(struct Printfmt *pf)
+{
+	const char *fmt, *lit, *spec;
+	struct Printfop *op;
+	int n = 0;
 
-		// (signed) decimal
-		case 'd':
-			num = getint(&ap, lflag);
-			if ((long long) num < 0) {
-				putch('-', putdat);
-				num = -(long long) num;
-			}
-			base = 10;
-			goto number;
-
-		// unsigned decimal
-		case 'u':
-			num = getuint(&ap, lflag);
-			base = 10;
-			goto number;
-
-		// (unsigned) octal
-		case 'o':
-			// Replace this with your code.
-			// putch('X', putdat);
-			// putch('X', putdat);
-			// putch('X', putdat);
-			num = getuint(&ap, lflag);
-			base = 8;
-			goto number;
+	lit = fmt = pf->pf_fmt;
+	while (1) {
+		while (*fmt != '%' && *fmt != '\0')
+			fmt++;
+		if (n == PRINTFMT_MAXOPS || fmt - pf->pf_fmt > 0xFFFF)
+			goto fail;
+		op = &pf->pf_ops[n];
+		op->po_off = lit - pf->pf_fmt;
+		op->po_len = fmt - lit;
+		if (*fmt == '\0')
 			break;
 
-		// pointer
-		case 'p':
-			putch('0', putdat);
-			putch('x', putdat);
-			num = (unsigned long long)
-				(uintptr_t) va_arg(ap, void *);
-			base = 16;
-			goto number;
-		
-		// change color
-		case 'm':
-			num = getint(&ap, lflag);
-			cons_c = num;
-			break;
+		spec = ++fmt;
+		if ((fmt = parsespec(fmt, &op->po_spec, NULL)) == NULL)
+			goto fail;
+		if (op->po_spec.ps_conv == 0) {
+			// unrecognized: the '%' and what follows it are
+			// part of the literal text
+			fmt = spec;
+			continue;
+		}
+		n++;
+		lit = fmt;
+	}
+	// Make sure the ops are all there before anybody uses them.
+	asm volatile("" ::: "memory");
+	pf->pf_nops = n + 1;
+	return;
 
-		// (unsigned) hexadecimal
-		case 'x':
-			num = getuint(&ap, lflag);
-			base = 16;
-		
-		number:
-			printnum(putch, putdat, num, base, width, padc);
-			break;
+fail:
+	pf->pf_nops = -1;
+}
 
-		// escaped '%' character
-		case '%':
-			putch(ch, putdat);
-			break;
+// Like vprintfmt, with the format in pf->pf_fmt, which is parsed only
+// the first time.  The output is exactly what vprintfmt would print.
+void
+vprintfmtc(void (*putch)(int, void*), void *putdat, struct Printfmt *pf,
+	   va_list ap)
+{
+	const struct Printfop *op, *last;
+	const char *p, *ep;
+
+	if (pf->pf_nops == 0)
+		printfmt_compile(pf);
+	if (pf->pf_nops < 0) {
+		vprintfmt(putch, putdat, pf->pf_fmt, ap);
+		return;
+	}
 
-		// unrecognized escape sequence - just print it literally
-		default:
-			putch('%', putdat);
-			for (fmt--; fmt[-1] != '%'; fmt--)
-				/* do nothing */;
+	last = &pf->pf_ops[pf->pf_nops - 1];
+	for (op = pf->pf_ops; ; op++) {
+		p = pf->pf_fmt + op->po_off;
+		for (ep = p + op->po_len; p < ep; p++)
+			putch(*(unsigned char *) p, putdat);
+		if (op == last)
 			break;
-		}
+		printspec(putch, putdat, &op->po_spec, &ap);
 	}
+	cons_c = 0x0700;
 }
 
 void
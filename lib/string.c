@@ -1,6 +1,7 @@
 // Basic string routines.  Not hardware optimized, but not shabby.
 
 #include <inc/string.h>
+#include <inc/x86.h>
 
 // Using assembly for memset/memmove
 // makes some difference on real hardware,
@@ -8,14 +9,50 @@
 // Primespipe runs 3x faster this way.
 #define ASM 1
 
+// Several routines below look at a 32-bit word at a time.  A word
+// read from an aligned address never straddles a page boundary, so
+// the string routines may read past the terminating null that way
+// without risking a fault.
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+#define ONES	0x01010101U
+#define HIGHS	0x80808080U
+// Nonzero iff some byte of the word 'w' is zero
+#define HASZERO(w)	(((w) - ONES) & ~(w) & HIGHS)
+
+// Set by string_init() if the CPU has enhanced rep movsb/stosb
+// (CPUID.(EAX=7):EBX bit 9): then the byte string instructions are at
+// least as fast as the word ones, at any alignment.
+static bool erms;
+
+void
+string_init(void)
+{
+	uint32_t max, ebx;
+
+	cpuid(0, &max, NULL, NULL, NULL);
+	if (max >= 7) {
+		// leaf 7 takes a subleaf in ecx
+		asm volatile("cpuid" : "=b" (ebx) : "a" (7), "c" (0) : "edx");
+		erms = (ebx >> 9) & 1;
+	}
+}
+
 int
 strlen(const char *s)
 {
-	int n;
-
-	for (n = 0; *s != '\0'; s++)
-		n++;
-	return n;
+	const char *p;
+	const word_t *w;
+
+	// bytes up to a word boundary, then whole words
+	for (p = s; (uintptr_t) p % 4; p++)
+		if (*p == '\0')
+			return p - s;
+	for (w = (const word_t *) p; !HASZERO(*w); w++)
+		/* do nothing */;
+	for (p = (const char *) w; *p != '\0'; p++)
+		/* do nothing */;
+	return p - s;
 }
 
 int
@@ -100,7 +137,20 @@ strncmp(const char *p, const char *q, size_t n)
 char *
 strchr(const char *s, char c)
 {
-	for (; *s; s++)
+	const word_t *w;
+	uint32_t cs;
+
+	for (; (uintptr_t) s % 4; s++) {
+		if (*s == '\0')
+			return 0;
+		if (*s == c)
+			return (char *) s;
+	}
+	// skip words with neither a null nor a 'c'
+	cs = (uint8_t) c * ONES;
+	for (w = (const word_t *) s; !HASZERO(*w) && !HASZERO(*w ^ cs); w++)
+		/* do nothing */;
+	for (s = (const char *) w; *s; s++)
 		if (*s == c)
 			return (char *) s;
 	return 0;
@@ -122,19 +172,28 @@ void *
 memset(void *v, int c, size_t n)
 {
 	char *p;
+	size_t m;
 
 	if (n == 0)
 		return v;
-	if ((int)v%4 == 0 && n%4 == 0) {
-		c &= 0xFF;
-		c = (c<<24)|(c<<16)|(c<<8)|c;
-		asm volatile("cld; rep stosl\n"
-			:: "D" (v), "a" (c), "c" (n/4)
-			: "cc", "memory");
-	} else
+	p = v;
+	c &= 0xFF;
+	if (n >= 16 && !erms) {
+		// bytes up to a word boundary, words, then the rest
+		m = -(uintptr_t) p % 4;
+		n -= m;
 		asm volatile("cld; rep stosb\n"
-			:: "D" (v), "a" (c), "c" (n)
+			: "+D" (p), "+c" (m) : "a" (c)
 			: "cc", "memory");
+		m = n/4;
+		asm volatile("rep stosl\n"
+			: "+D" (p), "+c" (m) : "a" (c * ONES)
+			: "cc", "memory");
+		n %= 4;
+	}
+	asm volatile("cld; rep stosb\n"
+		: "+D" (p), "+c" (n) : "a" (c)
+		: "cc", "memory");
 	return v;
 }
 
@@ -143,27 +202,49 @@ memmove(void *dst, const void *src, size_t n)
 {
 	const char *s;
 	char *d;
+	size_t m;
 
 	s = src;
 	d = dst;
 	if (s < d && s + n > d) {
-		s += n;
-		d += n;
-		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
-			asm volatile("std; rep movsl\n"
-				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
-		else
-			asm volatile("std; rep movsb\n"
-				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
-		// Some versions of GCC rely on DF being clear
-		asm volatile("cld" ::: "cc");
+		// Backwards, from the last byte.  Nothing speeds up
+		// rep movsb with DF set, so always align for rep movsl.
+		// Each asm sets DF itself and clears it again, since
+		// GCC assumes DF is clear between them.
+		s += n - 1;
+		d += n - 1;
+		if (n >= 16) {
+			m = (uintptr_t) (d + 1) % 4;
+			n -= m;
+			asm volatile("std; rep movsb; cld\n"
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			// rep movsl takes the address of the word's first byte
+			d -= 3;
+			s -= 3;
+			m = n/4;
+			asm volatile("std; rep movsl; cld\n"
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			d += 3;
+			s += 3;
+			n %= 4;
+		}
+		asm volatile("std; rep movsb; cld\n"
+			: "+D" (d), "+S" (s), "+c" (n) :: "cc", "memory");
 	} else {
-		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
-			asm volatile("cld; rep movsl\n"
-				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
-		else
+		if (n >= 16 && !erms) {
+			// Align the destination; x86 doesn't mind
+			// unaligned loads nearly as much.
+			m = -(uintptr_t) d % 4;
+			n -= m;
 			asm volatile("cld; rep movsb\n"
-				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			m = n/4;
+			asm volatile("rep movsl\n"
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			n %= 4;
+		}
+		asm volatile("cld; rep movsb\n"
+			: "+D" (d), "+S" (s), "+c" (n) :: "cc", "memory");
 	}
 	return dst;
 }
@@ -217,6 +298,9 @@ memcmp(const void *v1, const void *v2, size_t n)
 	const uint8_t *s1 = (const uint8_t *) v1;
 	const uint8_t *s2 = (const uint8_t *) v2;
 
+	// skip equal words, then find the difference byte by byte
+	for (; n >= 4 && *(const word_t *) s1 == *(const word_t *) s2; n -= 4)
+		s1 += 4, s2 += 4;
 	while (n-- > 0) {
 		if (*s1 != *s2)
 			return (int) *s1 - (int) *s2;
@@ -230,6 +314,11 @@ void *
 memfind(const void *s, int c, size_t n)
 {
 	const void *ends = (const char *) s + n;
+	uint32_t cs = (uint8_t) c * ONES;
+
+	// skip words with no 'c'
+	for (; n >= 4 && !HASZERO(*(const word_t *) s ^ cs); n -= 4)
+		s += 4;
 	for (; s < ends; s++)
 		if (*(const unsigned char *) s == (unsigned char) c)
 			break;
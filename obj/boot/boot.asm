@@ -0,0 +1,372 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+.set CR0_PE_ON,      0x1         # protected mode enable flag
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    7c00:	fa                   	cli
+  cld                         # String operations increment
+    7c01:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c08:	8e d0                	mov    %eax,%ss
+  #   For backwards compatibility with the earliest PCs, physical
+  #   address line 20 is tied low, so that addresses higher than
+  #   1MB wrap around to zero by default.  This code undoes this,
+  #   through the "fast A20" bit of system control port A rather
+  #   than the keyboard controller, which takes less code.
+  inb     $0x92,%al
+    7c0a:	e4 92                	in     $0x92,%al
+  orb     $0x2,%al
+    7c0c:	0c 02                	or     $0x2,%al
+  outb    %al,$0x92
+    7c0e:	e6 92                	out    %al,$0x92
+
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  lgdt    gdtdesc
+    7c10:	0f 01 16             	lgdtl  (%esi)
+    7c13:	6f                   	outsl  %ds:(%esi),(%dx)
+    7c14:	7c 0f                	jl     7c25 <protcseg+0x1>
+  movl    %cr0, %eax
+    7c16:	20 c0                	and    %al,%al
+  orl     $CR0_PE_ON, %eax
+    7c18:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c1c:	0f 22 c0             	mov    %eax,%cr0
+  
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7c1f:	ea                   	.byte 0xea
+    7c20:	24 7c                	and    $0x7c,%al
+    7c22:	08 00                	or     %al,(%eax)
+
+00007c24 <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    7c24:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c28:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c2a:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7c2c:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c2e:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c30:	8e d0                	mov    %eax,%ss
+  
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7c32:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  # with the time now; bootmain adds one after each disk read.
+  # BI_BSSZERO goes in before bootmain has zeroed anything: it is a
+  # promise that bootmain will have by the time the kernel looks.
+  # bootmain never returns: it spins on a bad ELF header, and jumps
+  # to the kernel otherwise.
+  movl    $BOOTINFO_PA, %edi
+    7c37:	bf 00 60 00 00       	mov    $0x6000,%edi
+  movl    $BOOTINFO_MAGIC, %eax
+    7c3c:	b8 42 4f 4f 54       	mov    $0x544f4f42,%eax
+  stosl                           # bi_magic
+    7c41:	ab                   	stos   %eax,%es:(%edi)
+  pushl   $(BI_BSSZERO | BI_TSC)
+    7c42:	6a 05                	push   $0x5
+  popl    %eax
+    7c44:	58                   	pop    %eax
+  stosl                           # bi_flags
+    7c45:	ab                   	stos   %eax,%es:(%edi)
+  scasl                           # (skip bi_elfsect)
+    7c46:	af                   	scas   %es:(%edi),%eax
+  rdtsc
+    7c47:	0f 31                	rdtsc
+  stosl                           # bi_tsc0
+    7c49:	ab                   	stos   %eax,%es:(%edi)
+  xchgl   %edx, %eax
+    7c4a:	92                   	xchg   %eax,%edx
+  stosl
+    7c4b:	ab                   	stos   %eax,%es:(%edi)
+  leal    4(%edi), %eax
+    7c4c:	8d 47 04             	lea    0x4(%edi),%eax
+  stosl                           # bi_tscend = &bi_tsc[0]
+    7c4f:	ab                   	stos   %eax,%es:(%edi)
+  call bootmain
+    7c50:	e8 e6 00 00 00       	call   7d3b <bootmain>
+
+00007c55 <spin>:
+
+  # If bootmain returns (it can't), loop.
+spin:
+  jmp spin
+    7c55:	eb fe                	jmp    7c55 <spin>
+
+00007c57 <gdt>:
+	...
+    7c5f:	ff                   	(bad)
+    7c60:	ff 00                	incl   (%eax)
+    7c62:	00 00                	add    %al,(%eax)
+    7c64:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c6b:	00                   	.byte 0x0
+    7c6c:	92                   	xchg   %eax,%edx
+    7c6d:	cf                   	iret
+	...
+
+00007c6f <gdtdesc>:
+    7c6f:	17                   	pop    %ss
+    7c70:	00 57 7c             	add    %dl,0x7c(%edi)
+	...
+
+00007c75 <readseg>:
+
+// Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
+// Might copy more than asked
+static void
+readseg(uint32_t pa, uint32_t count, uint32_t offset)
+{
+    7c75:	55                   	push   %ebp
+
+	// round down to sector boundary
+	pa &= ~(SECTSIZE - 1);
+
+	// translate from bytes to sectors, and kernel starts at sector 1
+	offset = (offset / SECTSIZE) + 1;
+    7c76:	c1 e9 09             	shr    $0x9,%ecx
+{
+    7c79:	57                   	push   %edi
+    7c7a:	56                   	push   %esi
+	end_pa = pa + count;
+    7c7b:	8d 34 10             	lea    (%eax,%edx,1),%esi
+	pa &= ~(SECTSIZE - 1);
+    7c7e:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+{
+    7c83:	53                   	push   %ebx
+	pa &= ~(SECTSIZE - 1);
+    7c84:	89 c5                	mov    %eax,%ebp
+	// command fetches nsect % MAXSECTS sectors (the drive only looks
+	// at the low 8 bits of the count, and takes 0 to mean 256), after
+	// which the number left is a multiple of MAXSECTS.
+	// We'd write more to memory than asked, but it doesn't matter --
+	// we load in increasing order.
+	nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    7c86:	8d 86 ff 01 00 00    	lea    0x1ff(%esi),%eax
+{
+    7c8c:	53                   	push   %ebx
+	nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    7c8d:	29 e8                	sub    %ebp,%eax
+	offset = (offset / SECTSIZE) + 1;
+    7c8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+	nsect = (end_pa - pa + SECTSIZE - 1) / SECTSIZE;
+    7c92:	c1 e8 09             	shr    $0x9,%eax
+    7c95:	89 04 24             	mov    %eax,(%esp)
+	for (first = 1; pa < end_pa; pa += SECTSIZE, offset++, nsect--) {
+    7c98:	b8 01 00 00 00       	mov    $0x1,%eax
+    7c9d:	39 f5                	cmp    %esi,%ebp
+    7c9f:	0f 83 81 00 00 00    	jae    7d26 <readseg+0xb1>
+		if (first || nsect % MAXSECTS == 0)
+    7ca5:	85 c0                	test   %eax,%eax
+    7ca7:	75 06                	jne    7caf <readseg+0x3a>
+    7ca9:	80 3c 24 00          	cmpb   $0x0,(%esp)
+    7cad:	75 4a                	jne    7cf9 <readseg+0x84>
+
+static inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7caf:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cb4:	ec                   	in     (%dx),%al
+
+static void
+waitdisk(void)
+{
+	// wait for disk reaady
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7cb5:	83 e0 c0             	and    $0xffffffc0,%eax
+    7cb8:	3c 40                	cmp    $0x40,%al
+    7cba:	75 f3                	jne    7caf <readseg+0x3a>
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7cbc:	8a 04 24             	mov    (%esp),%al
+    7cbf:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7cc4:	ee                   	out    %al,(%dx)
+    7cc5:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cca:	89 d8                	mov    %ebx,%eax
+    7ccc:	ee                   	out    %al,(%dx)
+	// wait for disk to be ready
+	waitdisk();
+
+	outb(0x1F2, nsect);	// count; 0 means 256
+	outb(0x1F3, offset);
+	outb(0x1F4, offset >> 8);
+    7ccd:	89 d8                	mov    %ebx,%eax
+    7ccf:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cd4:	c1 e8 08             	shr    $0x8,%eax
+    7cd7:	ee                   	out    %al,(%dx)
+	outb(0x1F5, offset >> 16);
+    7cd8:	89 d8                	mov    %ebx,%eax
+    7cda:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cdf:	c1 e8 10             	shr    $0x10,%eax
+    7ce2:	ee                   	out    %al,(%dx)
+	outb(0x1F6, (offset >> 24) | 0xE0);
+    7ce3:	89 d8                	mov    %ebx,%eax
+    7ce5:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cea:	c1 e8 18             	shr    $0x18,%eax
+    7ced:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cf0:	ee                   	out    %al,(%dx)
+    7cf1:	b0 20                	mov    $0x20,%al
+    7cf3:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cf8:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7cf9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cfe:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+    7cff:	83 e0 c0             	and    $0xffffffc0,%eax
+    7d02:	3c 40                	cmp    $0x40,%al
+    7d04:	75 f3                	jne    7cf9 <readseg+0x84>
+	asm volatile("cld\n\trepne\n\tinsl"
+    7d06:	89 ef                	mov    %ebp,%edi
+    7d08:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7d0d:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7d12:	fc                   	cld
+    7d13:	f2 6d                	repnz insl (%dx),%es:(%edi)
+		first = 0;
+    7d15:	31 c0                	xor    %eax,%eax
+	for (first = 1; pa < end_pa; pa += SECTSIZE, offset++, nsect--) {
+    7d17:	ff 0c 24             	decl   (%esp)
+    7d1a:	81 c5 00 02 00 00    	add    $0x200,%ebp
+    7d20:	43                   	inc    %ebx
+    7d21:	e9 77 ff ff ff       	jmp    7c9d <readseg+0x28>
+	asm volatile("rdtsc; movl %0, %%edi; stosl; movl %%edi, %0"
+    7d26:	0f 31                	rdtsc
+    7d28:	8b 3d 14 60 00 00    	mov    0x6014,%edi
+    7d2e:	ab                   	stos   %eax,%es:(%edi)
+    7d2f:	89 3d 14 60 00 00    	mov    %edi,0x6014
+}
+    7d35:	58                   	pop    %eax
+    7d36:	5b                   	pop    %ebx
+    7d37:	5e                   	pop    %esi
+    7d38:	5f                   	pop    %edi
+    7d39:	5d                   	pop    %ebp
+    7d3a:	c3                   	ret
+
+00007d3b <bootmain>:
+{
+    7d3b:	55                   	push   %ebp
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7d3c:	31 c9                	xor    %ecx,%ecx
+    7d3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+    7d43:	b8 00 00 01 00       	mov    $0x10000,%eax
+{
+    7d48:	57                   	push   %edi
+    7d49:	56                   	push   %esi
+    7d4a:	53                   	push   %ebx
+    7d4b:	83 ec 1c             	sub    $0x1c,%esp
+	readseg((uint32_t) ELFHDR, SECTSIZE*8, 0);
+    7d4e:	e8 22 ff ff ff       	call   7c75 <readseg>
+	if (ELFHDR->e_magic != ELF_MAGIC)
+    7d53:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d5a:	45 4c 46 
+    7d5d:	74 02                	je     7d61 <bootmain+0x26>
+    7d5f:	eb fe                	jmp    7d5f <bootmain+0x24>
+	ph0 = (struct Proghdr *) ((uint8_t *) ELFHDR + ELFHDR->e_phoff);
+    7d61:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7d66:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+	eph = ph0 + ELFHDR->e_phnum;
+    7d6c:	0f b7 05 2c 00 01 00 	movzwl 0x1002c,%eax
+	offset = ph0->p_offset;
+    7d73:	8b 4b 04             	mov    0x4(%ebx),%ecx
+	for (ph = ph0; ph < eph; ph++) {
+    7d76:	89 de                	mov    %ebx,%esi
+	eph = ph0 + ELFHDR->e_phnum;
+    7d78:	c1 e0 05             	shl    $0x5,%eax
+    7d7b:	01 d8                	add    %ebx,%eax
+    7d7d:	89 44 24 08          	mov    %eax,0x8(%esp)
+	pa = end_pa = ph0->p_pa;
+    7d81:	8b 43 0c             	mov    0xc(%ebx),%eax
+    7d84:	89 c2                	mov    %eax,%edx
+	for (ph = ph0; ph < eph; ph++) {
+    7d86:	8b 7c 24 08          	mov    0x8(%esp),%edi
+    7d8a:	39 fe                	cmp    %edi,%esi
+    7d8c:	73 44                	jae    7dd2 <bootmain+0x97>
+		if (ph->p_filesz == 0)
+    7d8e:	83 7e 10 00          	cmpl   $0x0,0x10(%esi)
+    7d92:	74 39                	je     7dcd <bootmain+0x92>
+		if (ph->p_pa - ph->p_offset != pa - offset
+    7d94:	8b 7e 0c             	mov    0xc(%esi),%edi
+    7d97:	89 fd                	mov    %edi,%ebp
+    7d99:	2b 6e 04             	sub    0x4(%esi),%ebp
+    7d9c:	89 7c 24 04          	mov    %edi,0x4(%esp)
+    7da0:	89 ef                	mov    %ebp,%edi
+    7da2:	89 c5                	mov    %eax,%ebp
+    7da4:	29 cd                	sub    %ecx,%ebp
+    7da6:	89 6c 24 0c          	mov    %ebp,0xc(%esp)
+		    || ph->p_pa < end_pa) {
+    7daa:	89 fd                	mov    %edi,%ebp
+    7dac:	8b 7c 24 0c          	mov    0xc(%esp),%edi
+    7db0:	39 fd                	cmp    %edi,%ebp
+    7db2:	75 06                	jne    7dba <bootmain+0x7f>
+    7db4:	39 54 24 04          	cmp    %edx,0x4(%esp)
+    7db8:	73 0d                	jae    7dc7 <bootmain+0x8c>
+			readseg(pa, end_pa - pa, offset);
+    7dba:	29 c2                	sub    %eax,%edx
+    7dbc:	e8 b4 fe ff ff       	call   7c75 <readseg>
+			pa = ph->p_pa;
+    7dc1:	8b 46 0c             	mov    0xc(%esi),%eax
+			offset = ph->p_offset;
+    7dc4:	8b 4e 04             	mov    0x4(%esi),%ecx
+		end_pa = ph->p_pa + ph->p_filesz;
+    7dc7:	8b 56 10             	mov    0x10(%esi),%edx
+    7dca:	03 56 0c             	add    0xc(%esi),%edx
+	for (ph = ph0; ph < eph; ph++) {
+    7dcd:	83 c6 20             	add    $0x20,%esi
+    7dd0:	eb b4                	jmp    7d86 <bootmain+0x4b>
+	readseg(pa, end_pa - pa, offset);
+    7dd2:	29 c2                	sub    %eax,%edx
+    7dd4:	e8 9c fe ff ff       	call   7c75 <readseg>
+	asm volatile("cld\n\trep\n\tstosb"
+    7dd9:	31 c0                	xor    %eax,%eax
+	for (ph = ph0; ph < eph; ph++)
+    7ddb:	8b 74 24 08          	mov    0x8(%esp),%esi
+    7ddf:	39 f3                	cmp    %esi,%ebx
+    7de1:	73 15                	jae    7df8 <bootmain+0xbd>
+		      ph->p_memsz - ph->p_filesz);
+    7de3:	8b 53 10             	mov    0x10(%ebx),%edx
+		stosb((uint8_t *) ph->p_pa + ph->p_filesz, 0,
+    7de6:	8b 7b 0c             	mov    0xc(%ebx),%edi
+		      ph->p_memsz - ph->p_filesz);
+    7de9:	8b 4b 14             	mov    0x14(%ebx),%ecx
+		stosb((uint8_t *) ph->p_pa + ph->p_filesz, 0,
+    7dec:	01 d7                	add    %edx,%edi
+		      ph->p_memsz - ph->p_filesz);
+    7dee:	29 d1                	sub    %edx,%ecx
+    7df0:	fc                   	cld
+    7df1:	f3 aa                	rep stos %al,%es:(%edi)
+	for (ph = ph0; ph < eph; ph++)
+    7df3:	83 c3 20             	add    $0x20,%ebx
+    7df6:	eb e3                	jmp    7ddb <bootmain+0xa0>
+	((entry_t) (ELFHDR->e_entry))();
+    7df8:	ff 15 18 00 01 00    	call   *0x10018
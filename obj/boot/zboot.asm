@@ -0,0 +1,329 @@
+
+obj/boot/zboot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00020000 <readsect>:
+
+// Read 'nsect' consecutive sectors starting at sector 'offset' into
+// 'dst', using as few disk commands as possible.
+static void
+readsect(void *dst, uint32_t offset, uint32_t nsect)
+{
+   20000:	55                   	push   %ebp
+   20001:	89 e5                	mov    %esp,%ebp
+   20003:	57                   	push   %edi
+   20004:	56                   	push   %esi
+   20005:	53                   	push   %ebx
+   20006:	89 cb                	mov    %ecx,%ebx
+   20008:	83 ec 0c             	sub    $0xc,%esp
+   2000b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+   2000e:	89 55 f0             	mov    %edx,-0x10(%ebp)
+	uint8_t *p;
+	uint32_t i, n;
+
+	p = dst;
+	while (nsect > 0) {
+   20011:	85 db                	test   %ebx,%ebx
+   20013:	0f 84 9c 00 00 00    	je     200b5 <readsect+0xb5>
+		n = nsect < MAXSECTS ? nsect : MAXSECTS;
+   20019:	be 00 01 00 00       	mov    $0x100,%esi
+   2001e:	39 f3                	cmp    %esi,%ebx
+   20020:	0f 46 f3             	cmovbe %ebx,%esi
+
+static inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+   20023:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   20028:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+   20029:	83 e0 c0             	and    $0xffffffc0,%eax
+   2002c:	3c 40                	cmp    $0x40,%al
+   2002e:	75 f3                	jne    20023 <readsect+0x23>
+}
+
+static inline void
+outb(int port, uint8_t data)
+{
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+   20030:	ba f2 01 00 00       	mov    $0x1f2,%edx
+   20035:	89 f0                	mov    %esi,%eax
+   20037:	ee                   	out    %al,(%dx)
+   20038:	ba f3 01 00 00       	mov    $0x1f3,%edx
+   2003d:	8a 45 f0             	mov    -0x10(%ebp),%al
+   20040:	ee                   	out    %al,(%dx)
+		// wait for disk to be ready
+		waitdisk();
+
+		outb(0x1F2, n);		// count; 0 means 256
+		outb(0x1F3, offset);
+		outb(0x1F4, offset >> 8);
+   20041:	8b 45 f0             	mov    -0x10(%ebp),%eax
+   20044:	ba f4 01 00 00       	mov    $0x1f4,%edx
+   20049:	c1 e8 08             	shr    $0x8,%eax
+   2004c:	ee                   	out    %al,(%dx)
+		outb(0x1F5, offset >> 16);
+   2004d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+   20050:	ba f5 01 00 00       	mov    $0x1f5,%edx
+   20055:	c1 e8 10             	shr    $0x10,%eax
+   20058:	ee                   	out    %al,(%dx)
+		outb(0x1F6, (offset >> 24) | 0xE0);
+   20059:	8b 45 f0             	mov    -0x10(%ebp),%eax
+   2005c:	ba f6 01 00 00       	mov    $0x1f6,%edx
+   20061:	c1 e8 18             	shr    $0x18,%eax
+   20064:	83 c8 e0             	or     $0xffffffe0,%eax
+   20067:	ee                   	out    %al,(%dx)
+   20068:	b0 20                	mov    $0x20,%al
+   2006a:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   2006f:	ee                   	out    %al,(%dx)
+   20070:	8b 7d ec             	mov    -0x14(%ebp),%edi
+   20073:	89 f0                	mov    %esi,%eax
+   20075:	c1 e0 09             	shl    $0x9,%eax
+   20078:	01 f8                	add    %edi,%eax
+   2007a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		outb(0x1F7, 0x20);	// cmd 0x20 - read sectors
+
+		for (i = 0; i < n; i++, p += SECTSIZE) {
+   2007d:	8b 7d e8             	mov    -0x18(%ebp),%edi
+   20080:	39 7d ec             	cmp    %edi,-0x14(%ebp)
+   20083:	74 26                	je     200ab <readsect+0xab>
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+   20085:	ba f7 01 00 00       	mov    $0x1f7,%edx
+   2008a:	ec                   	in     (%dx),%al
+	while ((inb(0x1F7) & 0xC0) != 0x40)
+   2008b:	83 e0 c0             	and    $0xffffffc0,%eax
+   2008e:	3c 40                	cmp    $0x40,%al
+   20090:	75 f3                	jne    20085 <readsect+0x85>
+	asm volatile("cld\n\trepne\n\tinsl"
+   20092:	8b 7d ec             	mov    -0x14(%ebp),%edi
+   20095:	b9 80 00 00 00       	mov    $0x80,%ecx
+   2009a:	ba f0 01 00 00       	mov    $0x1f0,%edx
+   2009f:	fc                   	cld
+   200a0:	f2 6d                	repnz insl (%dx),%es:(%edi)
+		for (i = 0; i < n; i++, p += SECTSIZE) {
+   200a2:	81 45 ec 00 02 00 00 	addl   $0x200,-0x14(%ebp)
+   200a9:	eb d2                	jmp    2007d <readsect+0x7d>
+			waitdisk();
+			insl(0x1F0, p, SECTSIZE/4);
+		}
+		nsect -= n;
+		offset += n;
+   200ab:	01 75 f0             	add    %esi,-0x10(%ebp)
+		nsect -= n;
+   200ae:	29 f3                	sub    %esi,%ebx
+   200b0:	e9 5c ff ff ff       	jmp    20011 <readsect+0x11>
+	}
+}
+   200b5:	83 c4 0c             	add    $0xc,%esp
+   200b8:	5b                   	pop    %ebx
+   200b9:	5e                   	pop    %esi
+   200ba:	5f                   	pop    %edi
+   200bb:	5d                   	pop    %ebp
+   200bc:	c3                   	ret
+
+000200bd <zbootmain>:
+{
+   200bd:	55                   	push   %ebp
+	readsect(ZHDR, ZIMAGE_SECT, 1);
+   200be:	b9 01 00 00 00       	mov    $0x1,%ecx
+   200c3:	ba 20 00 00 00       	mov    $0x20,%edx
+{
+   200c8:	89 e5                	mov    %esp,%ebp
+   200ca:	57                   	push   %edi
+   200cb:	56                   	push   %esi
+   200cc:	53                   	push   %ebx
+   200cd:	83 ec 1c             	sub    $0x1c,%esp
+		- BOOTINFO->bi_tsc;
+   200d0:	a1 14 60 00 00       	mov    0x6014,%eax
+	BOOTINFO->bi_flags |= BI_ZBOOT;
+   200d5:	83 0d 04 60 00 00 08 	orl    $0x8,0x6004
+		- BOOTINFO->bi_tsc;
+   200dc:	2d 18 60 00 00       	sub    $0x6018,%eax
+   200e1:	c1 f8 02             	sar    $0x2,%eax
+	BOOTINFO->bi_zbootidx = (uint32_t *) BOOTINFO->bi_tscend
+   200e4:	a3 58 60 00 00       	mov    %eax,0x6058
+	readsect(ZHDR, ZIMAGE_SECT, 1);
+   200e9:	b8 00 00 01 00       	mov    $0x10000,%eax
+   200ee:	e8 0d ff ff ff       	call   20000 <readsect>
+	if (ZHDR->z_magic != ZIMAGE_MAGIC || ZHDR->z_nseg > ZIMAGE_MAXSEG)
+   200f3:	81 3d 00 00 01 00 4a 	cmpl   $0x5a534f4a,0x10000
+   200fa:	4f 53 5a 
+   200fd:	0f 85 44 01 00 00    	jne    20247 <zbootmain+0x18a>
+   20103:	a1 08 00 01 00       	mov    0x10008,%eax
+   20108:	83 f8 08             	cmp    $0x8,%eax
+   2010b:	0f 87 36 01 00 00    	ja     20247 <zbootmain+0x18a>
+	ezs = zs + ZHDR->z_nseg;
+   20111:	6b c0 1c             	imul   $0x1c,%eax,%eax
+	zs = ZHDR->z_seg;
+   20114:	bb 0c 00 01 00       	mov    $0x1000c,%ebx
+	ezs = zs + ZHDR->z_nseg;
+   20119:	05 0c 00 01 00       	add    $0x1000c,%eax
+   2011e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (; zs < ezs; zs++) {
+   20121:	8b 45 d8             	mov    -0x28(%ebp),%eax
+   20124:	39 c3                	cmp    %eax,%ebx
+   20126:	0f 83 fe 00 00 00    	jae    2022a <zbootmain+0x16d>
+			 (zs->zs_size + SECTSIZE - 1) / SECTSIZE);
+   2012c:	8b 73 14             	mov    0x14(%ebx),%esi
+		readsect(src, ZIMAGE_SECT + zs->zs_offset / SECTSIZE,
+   2012f:	8b 53 10             	mov    0x10(%ebx),%edx
+		src = (uint8_t *) zs->zs_pa + zs->zs_inplace;
+   20132:	8b 03                	mov    (%ebx),%eax
+   20134:	03 43 18             	add    0x18(%ebx),%eax
+		readsect(src, ZIMAGE_SECT + zs->zs_offset / SECTSIZE,
+   20137:	c1 ea 09             	shr    $0x9,%edx
+			 (zs->zs_size + SECTSIZE - 1) / SECTSIZE);
+   2013a:	8d 8e ff 01 00 00    	lea    0x1ff(%esi),%ecx
+		readsect(src, ZIMAGE_SECT + zs->zs_offset / SECTSIZE,
+   20140:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+   20143:	c1 e9 09             	shr    $0x9,%ecx
+   20146:	83 c2 20             	add    $0x20,%edx
+   20149:	e8 b2 fe ff ff       	call   20000 <readsect>
+		if ((zs->zs_flags & ZSEG_LZ4)
+   2014e:	f6 43 0c 01          	testb  $0x1,0xc(%ebx)
+   20152:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+   20155:	75 35                	jne    2018c <zbootmain+0xcf>
+		      zs->zs_memsz - zs->zs_filesz);
+   20157:	8b 43 04             	mov    0x4(%ebx),%eax
+		stosb((uint8_t *) zs->zs_pa + zs->zs_filesz, 0,
+   2015a:	8b 3b                	mov    (%ebx),%edi
+		      zs->zs_memsz - zs->zs_filesz);
+   2015c:	8b 4b 08             	mov    0x8(%ebx),%ecx
+		stosb((uint8_t *) zs->zs_pa + zs->zs_filesz, 0,
+   2015f:	01 c7                	add    %eax,%edi
+		      zs->zs_memsz - zs->zs_filesz);
+   20161:	29 c1                	sub    %eax,%ecx
+	asm volatile("cld\n\trep\n\tstosb"
+   20163:	31 c0                	xor    %eax,%eax
+   20165:	fc                   	cld
+   20166:	f3 aa                	rep stos %al,%es:(%edi)
+	uint32_t *p = (uint32_t *) BOOTINFO->bi_tscend;
+   20168:	8b 0d 14 60 00 00    	mov    0x6014,%ecx
+	if (p < BOOTINFO->bi_tsc + BI_NTSC) {
+   2016e:	81 f9 57 60 00 00    	cmp    $0x6057,%ecx
+   20174:	0f 87 a8 00 00 00    	ja     20222 <zbootmain+0x165>
+
+static inline uint64_t
+read_tsc(void)
+{
+	uint64_t tsc;
+	asm volatile("rdtsc" : "=A" (tsc));
+   2017a:	0f 31                	rdtsc
+		*p++ = read_tsc();
+   2017c:	89 01                	mov    %eax,(%ecx)
+   2017e:	83 c1 04             	add    $0x4,%ecx
+   20181:	89 0d 14 60 00 00    	mov    %ecx,0x6014
+   20187:	e9 96 00 00 00       	jmp    20222 <zbootmain+0x165>
+	end = src + size;
+   2018c:	8b 73 14             	mov    0x14(%ebx),%esi
+		    && lz4_decode((uint8_t *) zs->zs_pa, src, zs->zs_size)
+   2018f:	8b 3b                	mov    (%ebx),%edi
+	end = src + size;
+   20191:	01 c6                	add    %eax,%esi
+   20193:	89 75 e0             	mov    %esi,-0x20(%ebp)
+	while (src < end) {
+   20196:	8b 75 e0             	mov    -0x20(%ebp),%esi
+   20199:	39 f0                	cmp    %esi,%eax
+   2019b:	73 76                	jae    20213 <zbootmain+0x156>
+		token = *src++;
+   2019d:	8d 50 01             	lea    0x1(%eax),%edx
+   201a0:	0f b6 00             	movzbl (%eax),%eax
+   201a3:	88 45 e4             	mov    %al,-0x1c(%ebp)
+		if ((len = token >> 4) == 15)
+   201a6:	c1 e8 04             	shr    $0x4,%eax
+   201a9:	83 f8 0f             	cmp    $0xf,%eax
+   201ac:	74 07                	je     201b5 <zbootmain+0xf8>
+   201ae:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+{
+   201b1:	89 d6                	mov    %edx,%esi
+   201b3:	eb 0c                	jmp    201c1 <zbootmain+0x104>
+				len += *src;
+   201b5:	0f b6 32             	movzbl (%edx),%esi
+			while (*src++ == 255);
+   201b8:	42                   	inc    %edx
+				len += *src;
+   201b9:	89 f1                	mov    %esi,%ecx
+   201bb:	01 f0                	add    %esi,%eax
+			while (*src++ == 255);
+   201bd:	fe c1                	inc    %cl
+   201bf:	eb eb                	jmp    201ac <zbootmain+0xef>
+		while (len-- > 0)
+   201c1:	39 cf                	cmp    %ecx,%edi
+   201c3:	74 03                	je     201c8 <zbootmain+0x10b>
+			*dst++ = *src++;
+   201c5:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+   201c6:	eb f9                	jmp    201c1 <zbootmain+0x104>
+		if (src >= end)
+   201c8:	8b 75 e0             	mov    -0x20(%ebp),%esi
+   201cb:	01 d0                	add    %edx,%eax
+   201cd:	39 f0                	cmp    %esi,%eax
+   201cf:	73 42                	jae    20213 <zbootmain+0x156>
+		match = dst - (src[0] | (src[1] << 8));
+   201d1:	0f b7 10             	movzwl (%eax),%edx
+   201d4:	89 ce                	mov    %ecx,%esi
+		if ((len = token & 15) == 15)
+   201d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		src += 2;
+   201d9:	83 c0 02             	add    $0x2,%eax
+		match = dst - (src[0] | (src[1] << 8));
+   201dc:	29 d6                	sub    %edx,%esi
+   201de:	8a 55 e4             	mov    -0x1c(%ebp),%dl
+		if ((len = token & 15) == 15)
+   201e1:	83 e7 0f             	and    $0xf,%edi
+		match = dst - (src[0] | (src[1] << 8));
+   201e4:	89 75 dc             	mov    %esi,-0x24(%ebp)
+   201e7:	83 e2 0f             	and    $0xf,%edx
+		if ((len = token & 15) == 15)
+   201ea:	80 fa 0f             	cmp    $0xf,%dl
+   201ed:	75 11                	jne    20200 <zbootmain+0x143>
+   201ef:	bf 0f 00 00 00       	mov    $0xf,%edi
+				len += *src;
+   201f4:	0f b6 30             	movzbl (%eax),%esi
+			while (*src++ == 255);
+   201f7:	40                   	inc    %eax
+				len += *src;
+   201f8:	89 f2                	mov    %esi,%edx
+   201fa:	01 f7                	add    %esi,%edi
+			while (*src++ == 255);
+   201fc:	fe c2                	inc    %dl
+   201fe:	74 f4                	je     201f4 <zbootmain+0x137>
+   20200:	8d 54 39 04          	lea    0x4(%ecx,%edi,1),%edx
+		for (len += 4; len > 0; len--)
+   20204:	89 cf                	mov    %ecx,%edi
+   20206:	39 fa                	cmp    %edi,%edx
+   20208:	74 8c                	je     20196 <zbootmain+0xd9>
+			*dst++ = *match++;
+   2020a:	8b 75 dc             	mov    -0x24(%ebp),%esi
+   2020d:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+   2020e:	89 75 dc             	mov    %esi,-0x24(%ebp)
+   20211:	eb f3                	jmp    20206 <zbootmain+0x149>
+		       != (uint8_t *) zs->zs_pa + zs->zs_filesz)
+   20213:	8b 03                	mov    (%ebx),%eax
+   20215:	03 43 04             	add    0x4(%ebx),%eax
+		    && lz4_decode((uint8_t *) zs->zs_pa, src, zs->zs_size)
+   20218:	39 c7                	cmp    %eax,%edi
+   2021a:	0f 84 37 ff ff ff    	je     20157 <zbootmain+0x9a>
+   20220:	eb 25                	jmp    20247 <zbootmain+0x18a>
+	for (; zs < ezs; zs++) {
+   20222:	83 c3 1c             	add    $0x1c,%ebx
+   20225:	e9 f7 fe ff ff       	jmp    20121 <zbootmain+0x64>
+	BOOTINFO->bi_elfsect = ZIMAGE_SECT + ZHDR->z_elfoffset / SECTSIZE;
+   2022a:	a1 ec 00 01 00       	mov    0x100ec,%eax
+	BOOTINFO->bi_flags |= BI_ELFSECT;
+   2022f:	83 0d 04 60 00 00 02 	orl    $0x2,0x6004
+	BOOTINFO->bi_elfsect = ZIMAGE_SECT + ZHDR->z_elfoffset / SECTSIZE;
+   20236:	c1 e8 09             	shr    $0x9,%eax
+   20239:	83 c0 20             	add    $0x20,%eax
+   2023c:	a3 08 60 00 00       	mov    %eax,0x6008
+	((void (*)(void)) (ZHDR->z_entry))();
+   20241:	ff 15 04 00 01 00    	call   *0x10004
+	asm volatile("outw %0,%w1" : : "a" (data), "d" (port));
+   20247:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+   2024c:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+   20251:	66 ef                	out    %ax,(%dx)
+   20253:	b8 00 8e ff ff       	mov    $0xffff8e00,%eax
+   20258:	66 ef                	out    %ax,(%dx)
+   2025a:	eb fe                	jmp    2025a <zbootmain+0x19d>
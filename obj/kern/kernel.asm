@@ -0,0 +1,17536 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# translates virtual addresses [KERNBASE, 2^32) to physical
+	# addresses [0, 256MB) using 4MB pages.
+
+	# entry_pgdir (see entrypgdir.c) uses 4MB pages and global
+	# pages, which every CPU since the Pentium Pro supports.
+	movl	%cr4, %eax
+f0100015:	0f 20 e0             	mov    %cr4,%eax
+	orl	$(CR4_PSE|CR4_PGE), %eax
+f0100018:	0d 90 00 00 00       	or     $0x90,%eax
+	movl	%eax, %cr4
+f010001d:	0f 22 e0             	mov    %eax,%cr4
+
+	# Load the physical address of entry_pgdir into cr3.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100020:	b8 00 40 11 00       	mov    $0x114000,%eax
+	movl	%eax, %cr3
+f0100025:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f0100028:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f010002b:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100030:	0f 22 c0             	mov    %eax,%cr0
+
+	# Note the time in boot_tsc[BT_ENTRY] (see kern/boottime.h).
+	rdtsc
+f0100033:	0f 31                	rdtsc
+	movl	%eax, boot_tsc
+f0100035:	a3 60 54 11 f0       	mov    %eax,0xf0115460
+	movl	%edx, boot_tsc+4
+f010003a:	89 15 64 54 11 f0    	mov    %edx,0xf0115464
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100040:	b8 47 00 10 f0       	mov    $0xf0100047,%eax
+	jmp	*%eax
+f0100045:	ff e0                	jmp    *%eax
+
+f0100047 <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f0100047:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f010004c:	bc 00 40 11 f0       	mov    $0xf0114000,%esp
+
+	# now to C code
+	call	i386_init
+f0100051:	e8 0a 01 00 00       	call   f0100160 <i386_init>
+
+f0100056 <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f0100056:	eb fe                	jmp    f0100056 <spin>
+
+f0100058 <test_backtrace>:
+#include <kern/boottime.h>
+
+// Test the stack backtrace function (lab 1 only)
+void
+test_backtrace(int x)
+{
+f0100058:	55                   	push   %ebp
+f0100059:	89 e5                	mov    %esp,%ebp
+f010005b:	56                   	push   %esi
+f010005c:	53                   	push   %ebx
+f010005d:	e8 ed 02 00 00       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100062:	81 c3 2a 54 01 00    	add    $0x1542a,%ebx
+f0100068:	8b 75 08             	mov    0x8(%ebp),%esi
+	cprintf("entering test_backtrace %d\n", x);
+f010006b:	83 ec 08             	sub    $0x8,%esp
+f010006e:	56                   	push   %esi
+f010006f:	8d 83 b4 46 ff ff    	lea    -0xb94c(%ebx),%eax
+f0100075:	50                   	push   %eax
+f0100076:	e8 17 40 00 00       	call   f0104092 <cprintf>
+	if (x > 0)
+f010007b:	83 c4 10             	add    $0x10,%esp
+f010007e:	85 f6                	test   %esi,%esi
+f0100080:	7e 29                	jle    f01000ab <test_backtrace+0x53>
+		test_backtrace(x-1);
+f0100082:	83 ec 0c             	sub    $0xc,%esp
+f0100085:	8d 46 ff             	lea    -0x1(%esi),%eax
+f0100088:	50                   	push   %eax
+f0100089:	e8 ca ff ff ff       	call   f0100058 <test_backtrace>
+f010008e:	83 c4 10             	add    $0x10,%esp
+	else
+		mon_backtrace(0, 0, 0);
+	cprintf("leaving test_backtrace %d\n", x);
+f0100091:	83 ec 08             	sub    $0x8,%esp
+f0100094:	56                   	push   %esi
+f0100095:	8d 83 d0 46 ff ff    	lea    -0xb930(%ebx),%eax
+f010009b:	50                   	push   %eax
+f010009c:	e8 f1 3f 00 00       	call   f0104092 <cprintf>
+}
+f01000a1:	83 c4 10             	add    $0x10,%esp
+f01000a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01000a7:	5b                   	pop    %ebx
+f01000a8:	5e                   	pop    %esi
+f01000a9:	5d                   	pop    %ebp
+f01000aa:	c3                   	ret
+		mon_backtrace(0, 0, 0);
+f01000ab:	83 ec 04             	sub    $0x4,%esp
+f01000ae:	6a 00                	push   $0x0
+f01000b0:	6a 00                	push   $0x0
+f01000b2:	6a 00                	push   $0x0
+f01000b4:	e8 ac 10 00 00       	call   f0101165 <mon_backtrace>
+f01000b9:	83 c4 10             	add    $0x10,%esp
+f01000bc:	eb d3                	jmp    f0100091 <test_backtrace+0x39>
+
+f01000be <mp_main>:
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+f01000be:	55                   	push   %ebp
+f01000bf:	89 e5                	mov    %esp,%ebp
+f01000c1:	53                   	push   %ebx
+f01000c2:	83 ec 04             	sub    $0x4,%esp
+f01000c5:	e8 85 02 00 00       	call   f010034f <__x86.get_pc_thunk.bx>
+f01000ca:	81 c3 c2 53 01 00    	add    $0x153c2,%ebx
+	// We are in high EIP now, and entry_pgdir is kern_pgdir already.
+	// The console has no lock, so leave the talking to boot_aps().
+	lapic_init();
+f01000d0:	e8 0c 88 00 00       	call   f01088e1 <lapic_init>
+	trap_init_percpu();
+f01000d5:	e8 45 40 00 00       	call   f010411f <trap_init_percpu>
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+f01000da:	e8 e0 87 00 00       	call   f01088bf <cpunum>
+f01000df:	6b c0 70             	imul   $0x70,%eax,%eax
+f01000e2:	c7 c2 20 50 15 f0    	mov    $0xf0155020,%edx
+f01000e8:	8d 54 10 04          	lea    0x4(%eax,%edx,1),%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+f01000ec:	b8 01 00 00 00       	mov    $0x1,%eax
+f01000f1:	f0 87 02             	lock xchg %eax,(%edx)
+
+	// There are no environments to run yet, so the AP has nothing to
+	// do.  Halt it for good, with interrupts off.
+	for (;;)
+		asm volatile("cli; hlt");
+f01000f4:	fa                   	cli
+f01000f5:	f4                   	hlt
+f01000f6:	eb fc                	jmp    f01000f4 <mp_main+0x36>
+
+f01000f8 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt,...)
+{
+f01000f8:	55                   	push   %ebp
+f01000f9:	89 e5                	mov    %esp,%ebp
+f01000fb:	56                   	push   %esi
+f01000fc:	53                   	push   %ebx
+f01000fd:	e8 4d 02 00 00       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100102:	81 c3 8a 53 01 00    	add    $0x1538a,%ebx
+	va_list ap;
+
+	if (panicstr)
+f0100108:	c7 c0 00 43 15 f0    	mov    $0xf0154300,%eax
+f010010e:	83 38 00             	cmpl   $0x0,(%eax)
+f0100111:	74 0f                	je     f0100122 <_panic+0x2a>
+	va_end(ap);
+
+dead:
+	/* break into the kernel monitor */
+	while (1)
+		monitor(NULL);
+f0100113:	83 ec 0c             	sub    $0xc,%esp
+f0100116:	6a 00                	push   $0x0
+f0100118:	e8 dc 18 00 00       	call   f01019f9 <monitor>
+f010011d:	83 c4 10             	add    $0x10,%esp
+f0100120:	eb f1                	jmp    f0100113 <_panic+0x1b>
+	panicstr = fmt;
+f0100122:	8b 55 10             	mov    0x10(%ebp),%edx
+f0100125:	89 10                	mov    %edx,(%eax)
+	asm volatile("cli; cld");
+f0100127:	fa                   	cli
+f0100128:	fc                   	cld
+	va_start(ap, fmt);
+f0100129:	8d 75 14             	lea    0x14(%ebp),%esi
+	cprintf("kernel panic at %s:%d: ", file, line);
+f010012c:	83 ec 04             	sub    $0x4,%esp
+f010012f:	ff 75 0c             	push   0xc(%ebp)
+f0100132:	ff 75 08             	push   0x8(%ebp)
+f0100135:	8d 83 eb 46 ff ff    	lea    -0xb915(%ebx),%eax
+f010013b:	50                   	push   %eax
+f010013c:	e8 51 3f 00 00       	call   f0104092 <cprintf>
+	vcprintf(fmt, ap);
+f0100141:	83 c4 08             	add    $0x8,%esp
+f0100144:	56                   	push   %esi
+f0100145:	ff 75 10             	push   0x10(%ebp)
+f0100148:	e8 e0 3e 00 00       	call   f010402d <vcprintf>
+	cprintf("\n");
+f010014d:	8d 83 09 66 ff ff    	lea    -0x99f7(%ebx),%eax
+f0100153:	89 04 24             	mov    %eax,(%esp)
+f0100156:	e8 37 3f 00 00       	call   f0104092 <cprintf>
+f010015b:	83 c4 10             	add    $0x10,%esp
+f010015e:	eb b3                	jmp    f0100113 <_panic+0x1b>
+
+f0100160 <i386_init>:
+{
+f0100160:	55                   	push   %ebp
+f0100161:	89 e5                	mov    %esp,%ebp
+f0100163:	57                   	push   %edi
+f0100164:	56                   	push   %esi
+f0100165:	53                   	push   %ebx
+f0100166:	83 ec 1c             	sub    $0x1c,%esp
+f0100169:	e8 e1 01 00 00       	call   f010034f <__x86.get_pc_thunk.bx>
+f010016e:	81 c3 1e 53 01 00    	add    $0x1531e,%ebx
+	asm volatile("rdtsc" : "=A" (tsc));
+f0100174:	0f 31                	rdtsc
+f0100176:	89 c6                	mov    %eax,%esi
+f0100178:	89 d7                	mov    %edx,%edi
+	boot_stamp(BT_INIT);
+f010017a:	c7 c2 60 54 11 f0    	mov    $0xf0115460,%edx
+f0100180:	89 72 08             	mov    %esi,0x8(%edx)
+f0100183:	89 7a 0c             	mov    %edi,0xc(%edx)
+	if (bi->bi_magic != BOOTINFO_MAGIC || !(bi->bi_flags & BI_BSSZERO))
+f0100186:	81 3d 00 60 00 f0 42 	cmpl   $0x544f4f42,0xf0006000
+f010018d:	4f 4f 54 
+f0100190:	75 09                	jne    f010019b <i386_init+0x3b>
+f0100192:	f6 05 04 60 00 f0 01 	testb  $0x1,0xf0006004
+f0100199:	75 1d                	jne    f01001b8 <i386_init+0x58>
+		memset(edata, 0, end - edata);
+f010019b:	83 ec 04             	sub    $0x4,%esp
+f010019e:	c7 c2 00 70 11 f0    	mov    $0xf0117000,%edx
+f01001a4:	c7 c0 00 43 15 f0    	mov    $0xf0154300,%eax
+f01001aa:	29 d0                	sub    %edx,%eax
+f01001ac:	50                   	push   %eax
+f01001ad:	6a 00                	push   $0x0
+f01001af:	52                   	push   %edx
+f01001b0:	e8 34 7f 00 00       	call   f01080e9 <memset>
+f01001b5:	83 c4 10             	add    $0x10,%esp
+f01001b8:	0f 31                	rdtsc
+	boot_stamp(BT_BSS);
+f01001ba:	c7 c6 60 54 11 f0    	mov    $0xf0115460,%esi
+f01001c0:	89 46 10             	mov    %eax,0x10(%esi)
+f01001c3:	89 56 14             	mov    %edx,0x14(%esi)
+	string_init();
+f01001c6:	e8 d9 7c 00 00       	call   f0107ea4 <string_init>
+	cons_init();
+f01001cb:	e8 74 0b 00 00       	call   f0100d44 <cons_init>
+f01001d0:	0f 31                	rdtsc
+	boot_stamp(BT_CONS);
+f01001d2:	89 46 18             	mov    %eax,0x18(%esi)
+f01001d5:	89 56 1c             	mov    %edx,0x1c(%esi)
+	mem_init();
+f01001d8:	e8 cc 22 00 00       	call   f01024a9 <mem_init>
+	kmem_init();
+f01001dd:	e8 53 36 00 00       	call   f0103835 <kmem_init>
+	trap_init();
+f01001e2:	e8 47 40 00 00       	call   f010422e <trap_init>
+	mp_init();
+f01001e7:	e8 e3 82 00 00       	call   f01084cf <mp_init>
+	lapic_init();
+f01001ec:	e8 f0 86 00 00       	call   f01088e1 <lapic_init>
+	pic_init();
+f01001f1:	e8 d8 3c 00 00       	call   f0103ece <pic_init>
+	asm volatile("sti");
+f01001f6:	fb                   	sti
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f01001f7:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f01001fd:	83 38 07             	cmpl   $0x7,(%eax)
+f0100200:	76 31                	jbe    f0100233 <i386_init+0xd3>
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f0100202:	83 ec 04             	sub    $0x4,%esp
+f0100205:	c7 c2 88 83 10 f0    	mov    $0xf0108388,%edx
+f010020b:	c7 c0 0a 84 10 f0    	mov    $0xf010840a,%eax
+f0100211:	29 d0                	sub    %edx,%eax
+f0100213:	50                   	push   %eax
+f0100214:	52                   	push   %edx
+f0100215:	68 00 70 00 f0       	push   $0xf0007000
+f010021a:	e8 24 7f 00 00       	call   f0108143 <memmove>
+	for (c = cpus; c < cpus + ncpu; c++) {
+f010021f:	83 c4 10             	add    $0x10,%esp
+f0100222:	c7 c6 20 50 15 f0    	mov    $0xf0155020,%esi
+f0100228:	c7 c7 a4 53 15 f0    	mov    $0xf01553a4,%edi
+f010022e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f0100231:	eb 1d                	jmp    f0100250 <i386_init+0xf0>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100233:	68 00 70 00 00       	push   $0x7000
+f0100238:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f010023e:	50                   	push   %eax
+f010023f:	6a 6e                	push   $0x6e
+f0100241:	8d 83 03 47 ff ff    	lea    -0xb8fd(%ebx),%eax
+f0100247:	50                   	push   %eax
+f0100248:	e8 ab fe ff ff       	call   f01000f8 <_panic>
+f010024d:	83 c6 70             	add    $0x70,%esi
+f0100250:	6b 07 70             	imul   $0x70,(%edi),%eax
+f0100253:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0100256:	01 c8                	add    %ecx,%eax
+f0100258:	39 c6                	cmp    %eax,%esi
+f010025a:	73 6b                	jae    f01002c7 <i386_init+0x167>
+		if (c == cpus + cpunum())  // We've started already.
+f010025c:	e8 5e 86 00 00       	call   f01088bf <cpunum>
+f0100261:	6b c0 70             	imul   $0x70,%eax,%eax
+f0100264:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+f010026a:	39 c6                	cmp    %eax,%esi
+f010026c:	74 df                	je     f010024d <i386_init+0xed>
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f010026e:	89 f0                	mov    %esi,%eax
+f0100270:	81 e8 20 50 15 f0    	sub    $0xf0155020,%eax
+f0100276:	c1 f8 04             	sar    $0x4,%eax
+f0100279:	69 c0 b7 6d db b6    	imul   $0xb6db6db7,%eax,%eax
+f010027f:	83 c0 01             	add    $0x1,%eax
+f0100282:	c1 e0 0f             	shl    $0xf,%eax
+f0100285:	81 c0 00 60 15 f0    	add    $0xf0156000,%eax
+f010028b:	c7 c2 04 43 15 f0    	mov    $0xf0154304,%edx
+f0100291:	89 02                	mov    %eax,(%edx)
+		lapic_startap(c->cpu_id, PADDR(code));
+f0100293:	83 ec 08             	sub    $0x8,%esp
+f0100296:	68 00 70 00 00       	push   $0x7000
+f010029b:	0f b6 06             	movzbl (%esi),%eax
+f010029e:	50                   	push   %eax
+f010029f:	e8 ba 87 00 00       	call   f0108a5e <lapic_startap>
+		while(c->cpu_status != CPU_STARTED)
+f01002a4:	83 c4 10             	add    $0x10,%esp
+f01002a7:	8b 46 04             	mov    0x4(%esi),%eax
+f01002aa:	83 f8 01             	cmp    $0x1,%eax
+f01002ad:	75 f8                	jne    f01002a7 <i386_init+0x147>
+		cprintf("SMP: CPU %d started\n", c->cpu_id);
+f01002af:	83 ec 08             	sub    $0x8,%esp
+f01002b2:	0f b6 06             	movzbl (%esi),%eax
+f01002b5:	50                   	push   %eax
+f01002b6:	8d 83 0f 47 ff ff    	lea    -0xb8f1(%ebx),%eax
+f01002bc:	50                   	push   %eax
+f01002bd:	e8 d0 3d 00 00       	call   f0104092 <cprintf>
+f01002c2:	83 c4 10             	add    $0x10,%esp
+f01002c5:	eb 86                	jmp    f010024d <i386_init+0xed>
+	ide_init();
+f01002c7:	e8 a5 92 00 00       	call   f0109571 <ide_init>
+	perf_init();
+f01002cc:	e8 b8 5b 00 00       	call   f0105e89 <perf_init>
+	cprintf("6828 decimal is %o octal!\n", 6828);
+f01002d1:	83 ec 08             	sub    $0x8,%esp
+f01002d4:	68 ac 1a 00 00       	push   $0x1aac
+f01002d9:	8d 83 24 47 ff ff    	lea    -0xb8dc(%ebx),%eax
+f01002df:	50                   	push   %eax
+f01002e0:	e8 ad 3d 00 00       	call   f0104092 <cprintf>
+	test_backtrace(5);
+f01002e5:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+f01002ec:	e8 67 fd ff ff       	call   f0100058 <test_backtrace>
+f01002f1:	83 c4 10             	add    $0x10,%esp
+		monitor(NULL);
+f01002f4:	83 ec 0c             	sub    $0xc,%esp
+f01002f7:	6a 00                	push   $0x0
+f01002f9:	e8 fb 16 00 00       	call   f01019f9 <monitor>
+f01002fe:	83 c4 10             	add    $0x10,%esp
+f0100301:	eb f1                	jmp    f01002f4 <i386_init+0x194>
+
+f0100303 <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt,...)
+{
+f0100303:	55                   	push   %ebp
+f0100304:	89 e5                	mov    %esp,%ebp
+f0100306:	56                   	push   %esi
+f0100307:	53                   	push   %ebx
+f0100308:	e8 42 00 00 00       	call   f010034f <__x86.get_pc_thunk.bx>
+f010030d:	81 c3 7f 51 01 00    	add    $0x1517f,%ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+f0100313:	8d 75 14             	lea    0x14(%ebp),%esi
+	cprintf("kernel warning at %s:%d: ", file, line);
+f0100316:	83 ec 04             	sub    $0x4,%esp
+f0100319:	ff 75 0c             	push   0xc(%ebp)
+f010031c:	ff 75 08             	push   0x8(%ebp)
+f010031f:	8d 83 3f 47 ff ff    	lea    -0xb8c1(%ebx),%eax
+f0100325:	50                   	push   %eax
+f0100326:	e8 67 3d 00 00       	call   f0104092 <cprintf>
+	vcprintf(fmt, ap);
+f010032b:	83 c4 08             	add    $0x8,%esp
+f010032e:	56                   	push   %esi
+f010032f:	ff 75 10             	push   0x10(%ebp)
+f0100332:	e8 f6 3c 00 00       	call   f010402d <vcprintf>
+	cprintf("\n");
+f0100337:	8d 83 09 66 ff ff    	lea    -0x99f7(%ebx),%eax
+f010033d:	89 04 24             	mov    %eax,(%esp)
+f0100340:	e8 4d 3d 00 00       	call   f0104092 <cprintf>
+	va_end(ap);
+}
+f0100345:	83 c4 10             	add    $0x10,%esp
+f0100348:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010034b:	5b                   	pop    %ebx
+f010034c:	5e                   	pop    %esi
+f010034d:	5d                   	pop    %ebp
+f010034e:	c3                   	ret
+
+f010034f <__x86.get_pc_thunk.bx>:
+f010034f:	8b 1c 24             	mov    (%esp),%ebx
+f0100352:	c3                   	ret
+
+f0100353 <serial_proc_data>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100353:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100358:	ec                   	in     (%dx),%al
+static bool serial_txintr;	// COM_IER_TXRDY is on
+
+static int
+serial_proc_data(void)
+{
+	if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f0100359:	a8 01                	test   $0x1,%al
+f010035b:	74 0a                	je     f0100367 <serial_proc_data+0x14>
+f010035d:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100362:	ec                   	in     (%dx),%al
+		return -1;
+	return inb(COM1+COM_RX);
+f0100363:	0f b6 c0             	movzbl %al,%eax
+f0100366:	c3                   	ret
+		return -1;
+f0100367:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f010036c:	c3                   	ret
+
+f010036d <serial_tx_fill>:
+
+// Move as many bytes from serial_tx to the UART as its transmit FIFO
+// holds.  The caller has seen COM_LSR_TXRDY, or given up waiting.
+static void
+serial_tx_fill(void)
+{
+f010036d:	55                   	push   %ebp
+f010036e:	89 e5                	mov    %esp,%ebp
+f0100370:	57                   	push   %edi
+f0100371:	56                   	push   %esi
+f0100372:	53                   	push   %ebx
+f0100373:	83 ec 08             	sub    $0x8,%esp
+f0100376:	e8 63 0c 00 00       	call   f0100fde <__x86.get_pc_thunk.ax>
+f010037b:	05 11 51 01 00       	add    $0x15111,%eax
+f0100380:	89 45 ec             	mov    %eax,-0x14(%ebp)
+	int i;
+
+	for (i = 0; i < serial_txfifo && serial_tx.rpos != serial_tx.wpos; i++)
+f0100383:	8b b0 74 fe ff ff    	mov    -0x18c(%eax),%esi
+f0100389:	89 75 f0             	mov    %esi,-0x10(%ebp)
+f010038c:	8b b8 d4 c1 00 00    	mov    0xc1d4(%eax),%edi
+f0100392:	8b 98 d8 c1 00 00    	mov    0xc1d8(%eax),%ebx
+f0100398:	29 fb                	sub    %edi,%ebx
+f010039a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010039f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		outb(COM1 + COM_TX,
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+f01003a4:	8d b0 d4 bd 00 00    	lea    0xbdd4(%eax),%esi
+	for (i = 0; i < serial_txfifo && serial_tx.rpos != serial_tx.wpos; i++)
+f01003aa:	eb 17                	jmp    f01003c3 <serial_tx_fill+0x56>
+		     serial_tx.buf[serial_tx.rpos++ % SERIAL_TXBUFSIZE]);
+f01003ac:	25 ff 03 00 00       	and    $0x3ff,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01003b1:	0f b6 04 06          	movzbl (%esi,%eax,1),%eax
+f01003b5:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01003ba:	ee                   	out    %al,(%dx)
+	for (i = 0; i < serial_txfifo && serial_tx.rpos != serial_tx.wpos; i++)
+f01003bb:	83 c1 01             	add    $0x1,%ecx
+f01003be:	ba 01 00 00 00       	mov    $0x1,%edx
+f01003c3:	8d 04 39             	lea    (%ecx,%edi,1),%eax
+f01003c6:	39 4d f0             	cmp    %ecx,-0x10(%ebp)
+f01003c9:	7e 13                	jle    f01003de <serial_tx_fill+0x71>
+f01003cb:	39 d9                	cmp    %ebx,%ecx
+f01003cd:	75 dd                	jne    f01003ac <serial_tx_fill+0x3f>
+f01003cf:	84 d2                	test   %dl,%dl
+f01003d1:	74 18                	je     f01003eb <serial_tx_fill+0x7e>
+f01003d3:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f01003d6:	89 87 d4 c1 00 00    	mov    %eax,0xc1d4(%edi)
+}
+f01003dc:	eb 0d                	jmp    f01003eb <serial_tx_fill+0x7e>
+f01003de:	84 d2                	test   %dl,%dl
+f01003e0:	74 09                	je     f01003eb <serial_tx_fill+0x7e>
+f01003e2:	8b 75 ec             	mov    -0x14(%ebp),%esi
+f01003e5:	89 86 d4 c1 00 00    	mov    %eax,0xc1d4(%esi)
+f01003eb:	83 c4 08             	add    $0x8,%esp
+f01003ee:	5b                   	pop    %ebx
+f01003ef:	5e                   	pop    %esi
+f01003f0:	5f                   	pop    %edi
+f01003f1:	5d                   	pop    %ebp
+f01003f2:	c3                   	ret
+
+f01003f3 <serial_tx_wait>:
+
+static void
+serial_tx_wait(void)
+{
+f01003f3:	55                   	push   %ebp
+f01003f4:	89 e5                	mov    %esp,%ebp
+f01003f6:	56                   	push   %esi
+f01003f7:	53                   	push   %ebx
+f01003f8:	e8 e9 0b 00 00       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f01003fd:	81 c1 8f 50 01 00    	add    $0x1508f,%ecx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100403:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100408:	ec                   	in     (%dx),%al
+	int i;
+
+	if (!(inb(COM1 + COM_LSR) & COM_LSR_TXRDY))
+f0100409:	a8 20                	test   $0x20,%al
+f010040b:	75 07                	jne    f0100414 <serial_tx_wait+0x21>
+		sinks[CONS_SERIAL].cs_stalls++;
+f010040d:	83 81 c0 01 00 00 01 	addl   $0x1,0x1c0(%ecx)
+{
+f0100414:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100419:	be fd 03 00 00       	mov    $0x3fd,%esi
+f010041e:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100423:	89 f2                	mov    %esi,%edx
+f0100425:	ec                   	in     (%dx),%al
+	for (i = 0;
+	     !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f0100426:	a8 20                	test   $0x20,%al
+f0100428:	75 13                	jne    f010043d <serial_tx_wait+0x4a>
+f010042a:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100430:	7f 0b                	jg     f010043d <serial_tx_wait+0x4a>
+f0100432:	89 ca                	mov    %ecx,%edx
+f0100434:	ec                   	in     (%dx),%al
+f0100435:	ec                   	in     (%dx),%al
+f0100436:	ec                   	in     (%dx),%al
+f0100437:	ec                   	in     (%dx),%al
+	     i++)
+f0100438:	83 c3 01             	add    $0x1,%ebx
+f010043b:	eb e6                	jmp    f0100423 <serial_tx_wait+0x30>
+		delay();
+}
+f010043d:	5b                   	pop    %ebx
+f010043e:	5e                   	pop    %esi
+f010043f:	5d                   	pop    %ebp
+f0100440:	c3                   	ret
+
+f0100441 <serial_tx_start>:
+// Refill the transmit FIFO if it has drained, and leave the TXRDY
+// interrupt on exactly as long as serial_tx has more to send.
+// Called with interrupts disabled.
+static void
+serial_tx_start(void)
+{
+f0100441:	55                   	push   %ebp
+f0100442:	89 e5                	mov    %esp,%ebp
+f0100444:	53                   	push   %ebx
+f0100445:	e8 05 ff ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010044a:	81 c3 42 50 01 00    	add    $0x15042,%ebx
+f0100450:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100455:	ec                   	in     (%dx),%al
+	bool more;
+
+	if (inb(COM1 + COM_LSR) & COM_LSR_TXRDY)
+f0100456:	a8 20                	test   $0x20,%al
+f0100458:	75 36                	jne    f0100490 <serial_tx_start+0x4f>
+		serial_tx_fill();
+	more = serial_tx.rpos != serial_tx.wpos;
+f010045a:	8b 93 d4 c1 00 00    	mov    0xc1d4(%ebx),%edx
+f0100460:	8b 83 d8 c1 00 00    	mov    0xc1d8(%ebx),%eax
+f0100466:	39 c2                	cmp    %eax,%edx
+f0100468:	0f 95 c1             	setne  %cl
+	if (more != serial_txintr) {
+f010046b:	38 8b cc bd 00 00    	cmp    %cl,0xbdcc(%ebx)
+f0100471:	74 18                	je     f010048b <serial_tx_start+0x4a>
+		serial_txintr = more;
+f0100473:	88 8b cc bd 00 00    	mov    %cl,0xbdcc(%ebx)
+		outb(COM1 + COM_IER, COM_IER_RDI | (more ? COM_IER_TXRDY : 0));
+f0100479:	39 c2                	cmp    %eax,%edx
+f010047b:	0f 95 c0             	setne  %al
+f010047e:	0f b6 c0             	movzbl %al,%eax
+f0100481:	8d 44 00 01          	lea    0x1(%eax,%eax,1),%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100485:	ba f9 03 00 00       	mov    $0x3f9,%edx
+f010048a:	ee                   	out    %al,(%dx)
+	}
+}
+f010048b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010048e:	c9                   	leave
+f010048f:	c3                   	ret
+		serial_tx_fill();
+f0100490:	e8 d8 fe ff ff       	call   f010036d <serial_tx_fill>
+f0100495:	eb c3                	jmp    f010045a <serial_tx_start+0x19>
+
+f0100497 <serial_write>:
+}
+
+// Queue 'n' bytes from 'buf' for output.
+static void
+serial_write(const char *buf, int n)
+{
+f0100497:	55                   	push   %ebp
+f0100498:	89 e5                	mov    %esp,%ebp
+f010049a:	57                   	push   %edi
+f010049b:	56                   	push   %esi
+f010049c:	53                   	push   %ebx
+f010049d:	83 ec 2c             	sub    $0x2c,%esp
+f01004a0:	e8 aa fe ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01004a5:	81 c3 e7 4f 01 00    	add    $0x14fe7,%ebx
+f01004ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01004ae:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f01004b1:	9c                   	pushf
+f01004b2:	5a                   	pop    %edx
+f01004b3:	89 55 d8             	mov    %edx,-0x28(%ebp)
+	uint32_t eflags;
+	int i;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+f01004b6:	fa                   	cli
+
+	for (i = 0; i < n; i++) {
+f01004b7:	bf 00 00 00 00       	mov    $0x0,%edi
+		if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+f01004bc:	8d 35 d4 bd 00 00    	lea    0xbdd4,%esi
+			// full: make room the slow way
+			serial_tx_wait();
+			serial_tx_fill();
+		}
+		serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = buf[i];
+f01004c2:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+f01004c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01004c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	for (i = 0; i < n; i++) {
+f01004cb:	eb 26                	jmp    f01004f3 <serial_write+0x5c>
+		serial_tx.buf[serial_tx.wpos++ % SERIAL_TXBUFSIZE] = buf[i];
+f01004cd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01004d0:	0f b6 14 38          	movzbl (%eax,%edi,1),%edx
+f01004d4:	8b 84 33 04 04 00 00 	mov    0x404(%ebx,%esi,1),%eax
+f01004db:	8d 48 01             	lea    0x1(%eax),%ecx
+f01004de:	89 8c 33 04 04 00 00 	mov    %ecx,0x404(%ebx,%esi,1)
+f01004e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01004ea:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01004ed:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+	for (i = 0; i < n; i++) {
+f01004f0:	83 c7 01             	add    $0x1,%edi
+f01004f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01004f6:	39 c7                	cmp    %eax,%edi
+f01004f8:	7d 21                	jge    f010051b <serial_write+0x84>
+		if (serial_tx.wpos - serial_tx.rpos == SERIAL_TXBUFSIZE) {
+f01004fa:	8b 84 33 04 04 00 00 	mov    0x404(%ebx,%esi,1),%eax
+f0100501:	2b 84 33 00 04 00 00 	sub    0x400(%ebx,%esi,1),%eax
+f0100508:	3d 00 04 00 00       	cmp    $0x400,%eax
+f010050d:	75 be                	jne    f01004cd <serial_write+0x36>
+			serial_tx_wait();
+f010050f:	e8 df fe ff ff       	call   f01003f3 <serial_tx_wait>
+			serial_tx_fill();
+f0100514:	e8 54 fe ff ff       	call   f010036d <serial_tx_fill>
+f0100519:	eb b2                	jmp    f01004cd <serial_write+0x36>
+	}
+	sinks[CONS_SERIAL].cs_bytes += n;
+f010051b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f010051e:	01 83 bc 01 00 00    	add    %eax,0x1bc(%ebx)
+
+	if (serial_exists && (eflags & FL_IF))
+f0100524:	80 bb dc c1 00 00 00 	cmpb   $0x0,0xc1dc(%ebx)
+f010052b:	74 05                	je     f0100532 <serial_write+0x9b>
+f010052d:	f6 c6 02             	test   $0x2,%dh
+f0100530:	75 08                	jne    f010053a <serial_write+0xa3>
+		serial_tx_start();
+	else {
+		// No interrupt is coming to drain the buffer (we are in
+		// an interrupt handler, in panic, or early in boot), so
+		// push everything out synchronously, in order.
+		while (serial_tx.rpos != serial_tx.wpos) {
+f0100532:	8d 35 d4 bd 00 00    	lea    0xbdd4,%esi
+f0100538:	eb 11                	jmp    f010054b <serial_write+0xb4>
+		serial_tx_start();
+f010053a:	e8 02 ff ff ff       	call   f0100441 <serial_tx_start>
+f010053f:	eb 1a                	jmp    f010055b <serial_write+0xc4>
+			serial_tx_wait();
+f0100541:	e8 ad fe ff ff       	call   f01003f3 <serial_tx_wait>
+			serial_tx_fill();
+f0100546:	e8 22 fe ff ff       	call   f010036d <serial_tx_fill>
+		while (serial_tx.rpos != serial_tx.wpos) {
+f010054b:	8b 84 1e 04 04 00 00 	mov    0x404(%esi,%ebx,1),%eax
+f0100552:	39 84 1e 00 04 00 00 	cmp    %eax,0x400(%esi,%ebx,1)
+f0100559:	75 e6                	jne    f0100541 <serial_write+0xaa>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f010055b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010055e:	50                   	push   %eax
+f010055f:	9d                   	popf
+		}
+	}
+
+	write_eflags(eflags);
+}
+f0100560:	83 c4 2c             	add    $0x2c,%esp
+f0100563:	5b                   	pop    %ebx
+f0100564:	5e                   	pop    %esi
+f0100565:	5f                   	pop    %edi
+f0100566:	5d                   	pop    %ebp
+f0100567:	c3                   	ret
+
+f0100568 <cga_show>:
+}
+
+// Program the 6845 to show video memory from cell 'start' on.
+static void
+cga_show(uint16_t start)
+{
+f0100568:	55                   	push   %ebp
+f0100569:	89 e5                	mov    %esp,%ebp
+f010056b:	57                   	push   %edi
+f010056c:	56                   	push   %esi
+f010056d:	53                   	push   %ebx
+f010056e:	83 ec 04             	sub    $0x4,%esp
+f0100571:	e8 d9 fd ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100576:	81 c3 16 4f 01 00    	add    $0x14f16,%ebx
+f010057c:	66 89 45 f2          	mov    %ax,-0xe(%ebp)
+	if (start == crt_shown)
+f0100580:	66 39 83 bc bd 00 00 	cmp    %ax,0xbdbc(%ebx)
+f0100587:	74 32                	je     f01005bb <cga_show+0x53>
+f0100589:	89 c1                	mov    %eax,%ecx
+		return;
+	outb(addr_6845, 12);
+f010058b:	8b b3 c8 bd 00 00    	mov    0xbdc8(%ebx),%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100591:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100596:	89 f2                	mov    %esi,%edx
+f0100598:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, start >> 8);
+f0100599:	8d 7e 01             	lea    0x1(%esi),%edi
+f010059c:	89 c8                	mov    %ecx,%eax
+f010059e:	66 c1 e8 08          	shr    $0x8,%ax
+f01005a2:	89 fa                	mov    %edi,%edx
+f01005a4:	ee                   	out    %al,(%dx)
+f01005a5:	b8 0d 00 00 00       	mov    $0xd,%eax
+f01005aa:	89 f2                	mov    %esi,%edx
+f01005ac:	ee                   	out    %al,(%dx)
+f01005ad:	0f b6 45 f2          	movzbl -0xe(%ebp),%eax
+f01005b1:	89 fa                	mov    %edi,%edx
+f01005b3:	ee                   	out    %al,(%dx)
+	outb(addr_6845, 13);
+	outb(addr_6845 + 1, start);
+	crt_shown = start;
+f01005b4:	66 89 8b bc bd 00 00 	mov    %cx,0xbdbc(%ebx)
+}
+f01005bb:	83 c4 04             	add    $0x4,%esp
+f01005be:	5b                   	pop    %ebx
+f01005bf:	5e                   	pop    %esi
+f01005c0:	5f                   	pop    %edi
+f01005c1:	5d                   	pop    %ebp
+f01005c2:	c3                   	ret
+
+f01005c3 <cga_cursor>:
+	sinks[CONS_CGA].cs_bytes++;
+}
+
+static void
+cga_cursor(void)
+{
+f01005c3:	55                   	push   %ebp
+f01005c4:	89 e5                	mov    %esp,%ebp
+f01005c6:	56                   	push   %esi
+f01005c7:	53                   	push   %ebx
+f01005c8:	e8 82 fd ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01005cd:	81 c3 bf 4e 01 00    	add    $0x14ebf,%ebx
+	// new output brings the screen back from the scrollback
+	crt_back = 0;
+f01005d3:	c7 83 b4 bd 00 00 00 	movl   $0x0,0xbdb4(%ebx)
+f01005da:	00 00 00 
+	cga_show(crt_start);
+f01005dd:	0f b7 83 be bd 00 00 	movzwl 0xbdbe(%ebx),%eax
+f01005e4:	e8 7f ff ff ff       	call   f0100568 <cga_show>
+
+	/* move that little blinky thing */
+	outb(addr_6845, 14);
+f01005e9:	8b 8b c8 bd 00 00    	mov    0xbdc8(%ebx),%ecx
+f01005ef:	b8 0e 00 00 00       	mov    $0xe,%eax
+f01005f4:	89 ca                	mov    %ecx,%edx
+f01005f6:	ee                   	out    %al,(%dx)
+	outb(addr_6845 + 1, crt_pos >> 8);
+f01005f7:	0f b7 9b c0 bd 00 00 	movzwl 0xbdc0(%ebx),%ebx
+f01005fe:	8d 71 01             	lea    0x1(%ecx),%esi
+f0100601:	89 d8                	mov    %ebx,%eax
+f0100603:	66 c1 e8 08          	shr    $0x8,%ax
+f0100607:	89 f2                	mov    %esi,%edx
+f0100609:	ee                   	out    %al,(%dx)
+f010060a:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010060f:	89 ca                	mov    %ecx,%edx
+f0100611:	ee                   	out    %al,(%dx)
+f0100612:	89 d8                	mov    %ebx,%eax
+f0100614:	89 f2                	mov    %esi,%edx
+f0100616:	ee                   	out    %al,(%dx)
+	outb(addr_6845, 15);
+	outb(addr_6845 + 1, crt_pos);
+}
+f0100617:	5b                   	pop    %ebx
+f0100618:	5e                   	pop    %esi
+f0100619:	5d                   	pop    %ebp
+f010061a:	c3                   	ret
+
+f010061b <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f010061b:	55                   	push   %ebp
+f010061c:	89 e5                	mov    %esp,%ebp
+f010061e:	57                   	push   %edi
+f010061f:	56                   	push   %esi
+f0100620:	53                   	push   %ebx
+f0100621:	83 ec 1c             	sub    $0x1c,%esp
+f0100624:	e8 c1 09 00 00       	call   f0100fea <__x86.get_pc_thunk.si>
+f0100629:	81 c6 63 4e 01 00    	add    $0x14e63,%esi
+f010062f:	89 c7                	mov    %eax,%edi
+	int c;
+
+	while ((c = (*proc)()) != -1) {
+		if (c == 0)
+			continue;
+		cons.buf[cons.wpos++] = c;
+f0100631:	8d 1d 94 1b 00 00    	lea    0x1b94,%ebx
+f0100637:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+f010063a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010063d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+	while ((c = (*proc)()) != -1) {
+f0100640:	eb 25                	jmp    f0100667 <cons_intr+0x4c>
+		cons.buf[cons.wpos++] = c;
+f0100642:	8b 8c 1e 04 02 00 00 	mov    0x204(%esi,%ebx,1),%ecx
+f0100649:	8d 51 01             	lea    0x1(%ecx),%edx
+f010064c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010064f:	88 04 0f             	mov    %al,(%edi,%ecx,1)
+		if (cons.wpos == CONSBUFSIZE)
+f0100652:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+			cons.wpos = 0;
+f0100658:	b8 00 00 00 00       	mov    $0x0,%eax
+f010065d:	0f 44 d0             	cmove  %eax,%edx
+f0100660:	89 94 1e 04 02 00 00 	mov    %edx,0x204(%esi,%ebx,1)
+	while ((c = (*proc)()) != -1) {
+f0100667:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010066a:	ff d0                	call   *%eax
+f010066c:	83 f8 ff             	cmp    $0xffffffff,%eax
+f010066f:	74 06                	je     f0100677 <cons_intr+0x5c>
+		if (c == 0)
+f0100671:	85 c0                	test   %eax,%eax
+f0100673:	75 cd                	jne    f0100642 <cons_intr+0x27>
+f0100675:	eb f0                	jmp    f0100667 <cons_intr+0x4c>
+	}
+}
+f0100677:	83 c4 1c             	add    $0x1c,%esp
+f010067a:	5b                   	pop    %ebx
+f010067b:	5e                   	pop    %esi
+f010067c:	5f                   	pop    %edi
+f010067d:	5d                   	pop    %ebp
+f010067e:	c3                   	ret
+
+f010067f <kbd_proc_data>:
+{
+f010067f:	55                   	push   %ebp
+f0100680:	89 e5                	mov    %esp,%ebp
+f0100682:	57                   	push   %edi
+f0100683:	56                   	push   %esi
+f0100684:	53                   	push   %ebx
+f0100685:	83 ec 1c             	sub    $0x1c,%esp
+f0100688:	e8 c2 fc ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010068d:	81 c3 ff 4d 01 00    	add    $0x14dff,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100693:	ba 64 00 00 00       	mov    $0x64,%edx
+f0100698:	ec                   	in     (%dx),%al
+	if ((stat & KBS_DIB) == 0)
+f0100699:	a8 01                	test   $0x1,%al
+f010069b:	0f 84 10 02 00 00    	je     f01008b1 <kbd_proc_data+0x232>
+	if (stat & KBS_TERR)
+f01006a1:	a8 20                	test   $0x20,%al
+f01006a3:	0f 85 12 02 00 00    	jne    f01008bb <kbd_proc_data+0x23c>
+f01006a9:	ba 60 00 00 00       	mov    $0x60,%edx
+f01006ae:	ec                   	in     (%dx),%al
+f01006af:	89 c2                	mov    %eax,%edx
+	if (data == 0xE0) {
+f01006b1:	3c e0                	cmp    $0xe0,%al
+f01006b3:	74 64                	je     f0100719 <kbd_proc_data+0x9a>
+	} else if (data & 0x80) {
+f01006b5:	84 c0                	test   %al,%al
+f01006b7:	78 76                	js     f010072f <kbd_proc_data+0xb0>
+	} else if (shift & E0ESC) {
+f01006b9:	8b 8b 74 1b 00 00    	mov    0x1b74(%ebx),%ecx
+f01006bf:	f6 c1 40             	test   $0x40,%cl
+f01006c2:	74 0e                	je     f01006d2 <kbd_proc_data+0x53>
+		data |= 0x80;
+f01006c4:	83 c8 80             	or     $0xffffff80,%eax
+f01006c7:	89 c2                	mov    %eax,%edx
+		shift &= ~E0ESC;
+f01006c9:	83 e1 bf             	and    $0xffffffbf,%ecx
+f01006cc:	89 8b 74 1b 00 00    	mov    %ecx,0x1b74(%ebx)
+	shift |= shiftcode[data];
+f01006d2:	0f b6 d2             	movzbl %dl,%edx
+f01006d5:	0f b6 84 13 14 49 ff 	movzbl -0xb6ec(%ebx,%edx,1),%eax
+f01006dc:	ff 
+f01006dd:	0b 83 74 1b 00 00    	or     0x1b74(%ebx),%eax
+	shift ^= togglecode[data];
+f01006e3:	0f b6 8c 13 14 48 ff 	movzbl -0xb7ec(%ebx,%edx,1),%ecx
+f01006ea:	ff 
+f01006eb:	31 c8                	xor    %ecx,%eax
+f01006ed:	89 83 74 1b 00 00    	mov    %eax,0x1b74(%ebx)
+	c = charcode[shift & (CTL | SHIFT)][data];
+f01006f3:	89 c1                	mov    %eax,%ecx
+f01006f5:	83 e1 03             	and    $0x3,%ecx
+f01006f8:	8b 8c 8b 14 00 00 00 	mov    0x14(%ebx,%ecx,4),%ecx
+f01006ff:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f0100703:	0f b6 f2             	movzbl %dl,%esi
+	if (shift & CAPSLOCK) {
+f0100706:	a8 08                	test   $0x8,%al
+f0100708:	74 62                	je     f010076c <kbd_proc_data+0xed>
+		if ('a' <= c && c <= 'z')
+f010070a:	89 f2                	mov    %esi,%edx
+f010070c:	8d 4e 9f             	lea    -0x61(%esi),%ecx
+f010070f:	83 f9 19             	cmp    $0x19,%ecx
+f0100712:	77 4c                	ja     f0100760 <kbd_proc_data+0xe1>
+			c += 'A' - 'a';
+f0100714:	83 ee 20             	sub    $0x20,%esi
+f0100717:	eb 0c                	jmp    f0100725 <kbd_proc_data+0xa6>
+		shift |= E0ESC;
+f0100719:	83 8b 74 1b 00 00 40 	orl    $0x40,0x1b74(%ebx)
+		return 0;
+f0100720:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f0100725:	89 f0                	mov    %esi,%eax
+f0100727:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010072a:	5b                   	pop    %ebx
+f010072b:	5e                   	pop    %esi
+f010072c:	5f                   	pop    %edi
+f010072d:	5d                   	pop    %ebp
+f010072e:	c3                   	ret
+		data = (shift & E0ESC ? data : data & 0x7F);
+f010072f:	8b 8b 74 1b 00 00    	mov    0x1b74(%ebx),%ecx
+f0100735:	83 e0 7f             	and    $0x7f,%eax
+f0100738:	f6 c1 40             	test   $0x40,%cl
+f010073b:	0f 44 d0             	cmove  %eax,%edx
+		shift &= ~(shiftcode[data] | E0ESC);
+f010073e:	0f b6 d2             	movzbl %dl,%edx
+f0100741:	0f b6 84 13 14 49 ff 	movzbl -0xb6ec(%ebx,%edx,1),%eax
+f0100748:	ff 
+f0100749:	83 c8 40             	or     $0x40,%eax
+f010074c:	0f b6 c0             	movzbl %al,%eax
+f010074f:	f7 d0                	not    %eax
+f0100751:	21 c8                	and    %ecx,%eax
+f0100753:	89 83 74 1b 00 00    	mov    %eax,0x1b74(%ebx)
+		return 0;
+f0100759:	be 00 00 00 00       	mov    $0x0,%esi
+f010075e:	eb c5                	jmp    f0100725 <kbd_proc_data+0xa6>
+		else if ('A' <= c && c <= 'Z')
+f0100760:	83 ea 41             	sub    $0x41,%edx
+			c += 'a' - 'A';
+f0100763:	8d 4e 20             	lea    0x20(%esi),%ecx
+f0100766:	83 fa 1a             	cmp    $0x1a,%edx
+f0100769:	0f 42 f1             	cmovb  %ecx,%esi
+	if ((shift & SHIFT) && (c == KEY_PGUP || c == KEY_PGDN)) {
+f010076c:	a8 01                	test   $0x1,%al
+f010076e:	74 0b                	je     f010077b <kbd_proc_data+0xfc>
+f0100770:	8d 96 1a ff ff ff    	lea    -0xe6(%esi),%edx
+f0100776:	83 fa 01             	cmp    $0x1,%edx
+f0100779:	76 30                	jbe    f01007ab <kbd_proc_data+0x12c>
+	if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010077b:	f7 d0                	not    %eax
+f010077d:	a8 06                	test   $0x6,%al
+f010077f:	75 a4                	jne    f0100725 <kbd_proc_data+0xa6>
+f0100781:	81 fe e9 00 00 00    	cmp    $0xe9,%esi
+f0100787:	75 9c                	jne    f0100725 <kbd_proc_data+0xa6>
+		cprintf("Rebooting!\n");
+f0100789:	83 ec 0c             	sub    $0xc,%esp
+f010078c:	8d 83 7f 47 ff ff    	lea    -0xb881(%ebx),%eax
+f0100792:	50                   	push   %eax
+f0100793:	e8 fa 38 00 00       	call   f0104092 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100798:	b8 03 00 00 00       	mov    $0x3,%eax
+f010079d:	ba 92 00 00 00       	mov    $0x92,%edx
+f01007a2:	ee                   	out    %al,(%dx)
+}
+f01007a3:	83 c4 10             	add    $0x10,%esp
+f01007a6:	e9 7a ff ff ff       	jmp    f0100725 <kbd_proc_data+0xa6>
+		cga_scrollback(c == KEY_PGUP ? CRT_ROWS / 2 : -CRT_ROWS / 2);
+f01007ab:	81 fe e6 00 00 00    	cmp    $0xe6,%esi
+f01007b1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+f01007b6:	ba 0c 00 00 00       	mov    $0xc,%edx
+f01007bb:	0f 44 c2             	cmove  %edx,%eax
+		return 0;
+f01007be:	be 00 00 00 00       	mov    $0x0,%esi
+	if (crt_vend < CRT_VIEW)
+f01007c3:	66 81 bb c2 bd 00 00 	cmpw   $0x37ef,0xbdc2(%ebx)
+f01007ca:	ef 37 
+f01007cc:	0f 86 53 ff ff ff    	jbe    f0100725 <kbd_proc_data+0xa6>
+	maxback = crt_nscrolled - crt_nhist;
+f01007d2:	8b b3 b8 bd 00 00    	mov    0xbdb8(%ebx),%esi
+f01007d8:	8b 93 9c 1d 00 00    	mov    0x1d9c(%ebx),%edx
+	if (crt_back < 0)
+f01007de:	03 83 b4 bd 00 00    	add    0xbdb4(%ebx),%eax
+f01007e4:	78 54                	js     f010083a <kbd_proc_data+0x1bb>
+	maxback += crt_nhist < CRT_NHIST ? crt_nhist : CRT_NHIST;
+f01007e6:	b9 00 01 00 00       	mov    $0x100,%ecx
+f01007eb:	39 ca                	cmp    %ecx,%edx
+f01007ed:	0f 46 ca             	cmovbe %edx,%ecx
+f01007f0:	29 d1                	sub    %edx,%ecx
+f01007f2:	01 f1                	add    %esi,%ecx
+	crt_back += lines;
+f01007f4:	39 c8                	cmp    %ecx,%eax
+f01007f6:	0f 47 c1             	cmova  %ecx,%eax
+f01007f9:	89 83 b4 bd 00 00    	mov    %eax,0xbdb4(%ebx)
+	line = crt_nscrolled - crt_back;
+f01007ff:	8b 83 b4 bd 00 00    	mov    0xbdb4(%ebx),%eax
+f0100805:	29 c6                	sub    %eax,%esi
+f0100807:	bf e0 6f 00 00       	mov    $0x6fe0,%edi
+		memmove(crt_buf + CRT_VIEW + i * CRT_COLS,
+f010080c:	8d 8b b4 1d 00 00    	lea    0x1db4(%ebx),%ecx
+f0100812:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (line >= crt_nhist) {
+f0100815:	39 d6                	cmp    %edx,%esi
+f0100817:	72 68                	jb     f0100881 <kbd_proc_data+0x202>
+		cga_show(crt_start - crt_back * CRT_COLS);
+f0100819:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010081c:	c1 e0 04             	shl    $0x4,%eax
+f010081f:	0f b7 93 be bd 00 00 	movzwl 0xbdbe(%ebx),%edx
+f0100826:	29 c2                	sub    %eax,%edx
+f0100828:	0f b7 c2             	movzwl %dx,%eax
+f010082b:	e8 38 fd ff ff       	call   f0100568 <cga_show>
+		return 0;
+f0100830:	be 00 00 00 00       	mov    $0x0,%esi
+		return;
+f0100835:	e9 eb fe ff ff       	jmp    f0100725 <kbd_proc_data+0xa6>
+		crt_back = 0;
+f010083a:	c7 83 b4 bd 00 00 00 	movl   $0x0,0xbdb4(%ebx)
+f0100841:	00 00 00 
+f0100844:	eb b9                	jmp    f01007ff <kbd_proc_data+0x180>
+			: crt_buf + (line - crt_nhist) * CRT_COLS,
+f0100846:	89 f2                	mov    %esi,%edx
+f0100848:	29 c2                	sub    %eax,%edx
+f010084a:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f010084d:	c1 e0 05             	shl    $0x5,%eax
+		memmove(crt_buf + CRT_VIEW + i * CRT_COLS,
+f0100850:	03 83 c4 bd 00 00    	add    0xbdc4(%ebx),%eax
+f0100856:	83 ec 04             	sub    $0x4,%esp
+f0100859:	68 a0 00 00 00       	push   $0xa0
+f010085e:	50                   	push   %eax
+f010085f:	89 f8                	mov    %edi,%eax
+f0100861:	03 83 c4 bd 00 00    	add    0xbdc4(%ebx),%eax
+f0100867:	50                   	push   %eax
+f0100868:	e8 d6 78 00 00       	call   f0108143 <memmove>
+	for (i = 0; i < CRT_ROWS; i++, line++)
+f010086d:	83 c6 01             	add    $0x1,%esi
+f0100870:	81 c7 a0 00 00 00    	add    $0xa0,%edi
+f0100876:	83 c4 10             	add    $0x10,%esp
+f0100879:	81 ff 80 7f 00 00    	cmp    $0x7f80,%edi
+f010087f:	74 1c                	je     f010089d <kbd_proc_data+0x21e>
+			line < crt_nhist ? crt_hist[line % CRT_NHIST]
+f0100881:	8b 83 9c 1d 00 00    	mov    0x1d9c(%ebx),%eax
+		memmove(crt_buf + CRT_VIEW + i * CRT_COLS,
+f0100887:	39 c6                	cmp    %eax,%esi
+f0100889:	73 bb                	jae    f0100846 <kbd_proc_data+0x1c7>
+			line < crt_nhist ? crt_hist[line % CRT_NHIST]
+f010088b:	89 f0                	mov    %esi,%eax
+f010088d:	0f b6 c0             	movzbl %al,%eax
+		memmove(crt_buf + CRT_VIEW + i * CRT_COLS,
+f0100890:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100893:	c1 e0 05             	shl    $0x5,%eax
+f0100896:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0100899:	01 c8                	add    %ecx,%eax
+f010089b:	eb b9                	jmp    f0100856 <kbd_proc_data+0x1d7>
+	cga_show(CRT_VIEW);
+f010089d:	b8 f0 37 00 00       	mov    $0x37f0,%eax
+f01008a2:	e8 c1 fc ff ff       	call   f0100568 <cga_show>
+		return 0;
+f01008a7:	be 00 00 00 00       	mov    $0x0,%esi
+f01008ac:	e9 74 fe ff ff       	jmp    f0100725 <kbd_proc_data+0xa6>
+		return -1;
+f01008b1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f01008b6:	e9 6a fe ff ff       	jmp    f0100725 <kbd_proc_data+0xa6>
+		return -1;
+f01008bb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f01008c0:	e9 60 fe ff ff       	jmp    f0100725 <kbd_proc_data+0xa6>
+
+f01008c5 <cga_emit>:
+{
+f01008c5:	55                   	push   %ebp
+f01008c6:	89 e5                	mov    %esp,%ebp
+f01008c8:	57                   	push   %edi
+f01008c9:	56                   	push   %esi
+f01008ca:	53                   	push   %ebx
+f01008cb:	83 ec 1c             	sub    $0x1c,%esp
+f01008ce:	e8 7c fa ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01008d3:	81 c3 b9 4b 01 00    	add    $0x14bb9,%ebx
+	if (!cons_c)
+f01008d9:	c7 c2 08 43 15 f0    	mov    $0xf0154308,%edx
+f01008df:	83 3a 00             	cmpl   $0x0,(%edx)
+f01008e2:	75 06                	jne    f01008ea <cga_emit+0x25>
+		cons_c = 0x0700;
+f01008e4:	c7 02 00 07 00 00    	movl   $0x700,(%edx)
+	if (!(c & ~0xFF))
+f01008ea:	3d ff 00 00 00       	cmp    $0xff,%eax
+f01008ef:	77 08                	ja     f01008f9 <cga_emit+0x34>
+		c |= cons_c;
+f01008f1:	c7 c2 08 43 15 f0    	mov    $0xf0154308,%edx
+f01008f7:	0b 02                	or     (%edx),%eax
+	switch (c & 0xff) {
+f01008f9:	0f b6 d0             	movzbl %al,%edx
+f01008fc:	3c 0a                	cmp    $0xa,%al
+f01008fe:	0f 84 b7 00 00 00    	je     f01009bb <cga_emit+0xf6>
+f0100904:	83 fa 0a             	cmp    $0xa,%edx
+f0100907:	7f 38                	jg     f0100941 <cga_emit+0x7c>
+f0100909:	83 fa 08             	cmp    $0x8,%edx
+f010090c:	74 7f                	je     f010098d <cga_emit+0xc8>
+f010090e:	83 fa 09             	cmp    $0x9,%edx
+f0100911:	0f 85 ae 00 00 00    	jne    f01009c5 <cga_emit+0x100>
+		cga_emit((c & ~0xff) | ' ');
+f0100917:	b0 00                	mov    $0x0,%al
+f0100919:	83 c8 20             	or     $0x20,%eax
+f010091c:	89 c3                	mov    %eax,%ebx
+f010091e:	e8 a2 ff ff ff       	call   f01008c5 <cga_emit>
+		cga_emit((c & ~0xff) | ' ');
+f0100923:	89 d8                	mov    %ebx,%eax
+f0100925:	e8 9b ff ff ff       	call   f01008c5 <cga_emit>
+		cga_emit((c & ~0xff) | ' ');
+f010092a:	89 d8                	mov    %ebx,%eax
+f010092c:	e8 94 ff ff ff       	call   f01008c5 <cga_emit>
+		cga_emit((c & ~0xff) | ' ');
+f0100931:	89 d8                	mov    %ebx,%eax
+f0100933:	e8 8d ff ff ff       	call   f01008c5 <cga_emit>
+		cga_emit((c & ~0xff) | ' ');
+f0100938:	89 d8                	mov    %ebx,%eax
+f010093a:	e8 86 ff ff ff       	call   f01008c5 <cga_emit>
+		return;
+f010093f:	eb 44                	jmp    f0100985 <cga_emit+0xc0>
+	switch (c & 0xff) {
+f0100941:	83 fa 0d             	cmp    $0xd,%edx
+f0100944:	75 7f                	jne    f01009c5 <cga_emit+0x100>
+		crt_pos -= (crt_pos % CRT_COLS);
+f0100946:	0f b7 83 c0 bd 00 00 	movzwl 0xbdc0(%ebx),%eax
+f010094d:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100953:	c1 e8 16             	shr    $0x16,%eax
+f0100956:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100959:	c1 e0 04             	shl    $0x4,%eax
+f010095c:	66 89 83 c0 bd 00 00 	mov    %ax,0xbdc0(%ebx)
+	if (crt_pos >= crt_start + CRT_SIZE)
+f0100963:	0f b7 83 be bd 00 00 	movzwl 0xbdbe(%ebx),%eax
+f010096a:	0f b7 d0             	movzwl %ax,%edx
+f010096d:	8d b2 cf 07 00 00    	lea    0x7cf(%edx),%esi
+f0100973:	0f b7 8b c0 bd 00 00 	movzwl 0xbdc0(%ebx),%ecx
+f010097a:	39 ce                	cmp    %ecx,%esi
+f010097c:	7c 6a                	jl     f01009e8 <cga_emit+0x123>
+	sinks[CONS_CGA].cs_bytes++;
+f010097e:	83 83 dc 01 00 00 01 	addl   $0x1,0x1dc(%ebx)
+}
+f0100985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100988:	5b                   	pop    %ebx
+f0100989:	5e                   	pop    %esi
+f010098a:	5f                   	pop    %edi
+f010098b:	5d                   	pop    %ebp
+f010098c:	c3                   	ret
+		if (crt_pos > crt_start) {
+f010098d:	0f b7 93 c0 bd 00 00 	movzwl 0xbdc0(%ebx),%edx
+f0100994:	66 39 93 be bd 00 00 	cmp    %dx,0xbdbe(%ebx)
+f010099b:	73 c6                	jae    f0100963 <cga_emit+0x9e>
+			crt_pos--;
+f010099d:	83 ea 01             	sub    $0x1,%edx
+f01009a0:	66 89 93 c0 bd 00 00 	mov    %dx,0xbdc0(%ebx)
+			crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f01009a7:	0f b7 d2             	movzwl %dx,%edx
+f01009aa:	b0 00                	mov    $0x0,%al
+f01009ac:	83 c8 20             	or     $0x20,%eax
+f01009af:	8b 8b c4 bd 00 00    	mov    0xbdc4(%ebx),%ecx
+f01009b5:	66 89 04 51          	mov    %ax,(%ecx,%edx,2)
+f01009b9:	eb a8                	jmp    f0100963 <cga_emit+0x9e>
+		crt_pos += CRT_COLS;
+f01009bb:	66 83 83 c0 bd 00 00 	addw   $0x50,0xbdc0(%ebx)
+f01009c2:	50 
+f01009c3:	eb 81                	jmp    f0100946 <cga_emit+0x81>
+		crt_buf[crt_pos++] = c;		/* write the character */
+f01009c5:	0f b7 93 c0 bd 00 00 	movzwl 0xbdc0(%ebx),%edx
+f01009cc:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01009cf:	66 89 8b c0 bd 00 00 	mov    %cx,0xbdc0(%ebx)
+f01009d6:	0f b7 d2             	movzwl %dx,%edx
+f01009d9:	8b 8b c4 bd 00 00    	mov    0xbdc4(%ebx),%ecx
+f01009df:	66 89 04 51          	mov    %ax,(%ecx,%edx,2)
+		break;
+f01009e3:	e9 7b ff ff ff       	jmp    f0100963 <cga_emit+0x9e>
+	if (crt_start + CRT_SIZE + CRT_COLS > crt_vend) {
+f01009e8:	81 c2 1f 08 00 00    	add    $0x81f,%edx
+f01009ee:	0f b7 b3 c2 bd 00 00 	movzwl 0xbdc2(%ebx),%esi
+		crt_start += CRT_COLS;
+f01009f5:	8d 48 50             	lea    0x50(%eax),%ecx
+	if (crt_start + CRT_SIZE + CRT_COLS > crt_vend) {
+f01009f8:	39 f2                	cmp    %esi,%edx
+f01009fa:	0f 8c 9e 00 00 00    	jl     f0100a9e <cga_emit+0x1d9>
+	uint32_t i, top = crt_start / CRT_COLS;
+f0100a00:	0f b7 c0             	movzwl %ax,%eax
+f0100a03:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f0100a09:	c1 e8 16             	shr    $0x16,%eax
+f0100a0c:	8d 78 01             	lea    0x1(%eax),%edi
+		for (i = 0; i <= top; i++, crt_nhist++)
+f0100a0f:	be 00 00 00 00       	mov    $0x0,%esi
+			memmove(crt_hist[crt_nhist % CRT_NHIST],
+f0100a14:	8d 83 b4 1d 00 00    	lea    0x1db4(%ebx),%eax
+f0100a1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0100a1d:	83 ec 04             	sub    $0x4,%esp
+f0100a20:	68 a0 00 00 00       	push   $0xa0
+				crt_buf + i * CRT_COLS,
+f0100a25:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+f0100a28:	c1 e0 05             	shl    $0x5,%eax
+f0100a2b:	03 83 c4 bd 00 00    	add    0xbdc4(%ebx),%eax
+			memmove(crt_hist[crt_nhist % CRT_NHIST],
+f0100a31:	50                   	push   %eax
+f0100a32:	0f b6 83 9c 1d 00 00 	movzbl 0x1d9c(%ebx),%eax
+f0100a39:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0100a3c:	c1 e0 05             	shl    $0x5,%eax
+f0100a3f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0100a42:	01 c8                	add    %ecx,%eax
+f0100a44:	50                   	push   %eax
+f0100a45:	e8 f9 76 00 00       	call   f0108143 <memmove>
+		for (i = 0; i <= top; i++, crt_nhist++)
+f0100a4a:	83 c6 01             	add    $0x1,%esi
+f0100a4d:	83 83 9c 1d 00 00 01 	addl   $0x1,0x1d9c(%ebx)
+f0100a54:	83 c4 10             	add    $0x10,%esp
+f0100a57:	39 fe                	cmp    %edi,%esi
+f0100a59:	75 c2                	jne    f0100a1d <cga_emit+0x158>
+		memmove(crt_buf, crt_buf + crt_start + CRT_COLS,
+f0100a5b:	8b 83 c4 bd 00 00    	mov    0xbdc4(%ebx),%eax
+f0100a61:	83 ec 04             	sub    $0x4,%esp
+f0100a64:	68 00 0f 00 00       	push   $0xf00
+f0100a69:	0f b7 93 be bd 00 00 	movzwl 0xbdbe(%ebx),%edx
+f0100a70:	8d 94 50 a0 00 00 00 	lea    0xa0(%eax,%edx,2),%edx
+f0100a77:	52                   	push   %edx
+f0100a78:	50                   	push   %eax
+f0100a79:	e8 c5 76 00 00       	call   f0108143 <memmove>
+		crt_pos -= crt_start + CRT_COLS;
+f0100a7e:	0f b7 83 c0 bd 00 00 	movzwl 0xbdc0(%ebx),%eax
+f0100a85:	83 e8 50             	sub    $0x50,%eax
+f0100a88:	66 2b 83 be bd 00 00 	sub    0xbdbe(%ebx),%ax
+f0100a8f:	66 89 83 c0 bd 00 00 	mov    %ax,0xbdc0(%ebx)
+f0100a96:	83 c4 10             	add    $0x10,%esp
+f0100a99:	b9 00 00 00 00       	mov    $0x0,%ecx
+		crt_start = 0;
+f0100a9e:	66 89 8b be bd 00 00 	mov    %cx,0xbdbe(%ebx)
+	for (i = crt_start + CRT_SIZE - CRT_COLS; i < crt_start + CRT_SIZE; i++)
+f0100aa5:	0f b7 d1             	movzwl %cx,%edx
+f0100aa8:	8d 8a 80 07 00 00    	lea    0x780(%edx),%ecx
+		crt_buf[i] = 0x0700 | ' ';
+f0100aae:	8b b3 c4 bd 00 00    	mov    0xbdc4(%ebx),%esi
+f0100ab4:	8d 04 4e             	lea    (%esi,%ecx,2),%eax
+f0100ab7:	8d ba d0 07 00 00    	lea    0x7d0(%edx),%edi
+f0100abd:	39 cf                	cmp    %ecx,%edi
+f0100abf:	19 c9                	sbb    %ecx,%ecx
+f0100ac1:	83 e1 b0             	and    $0xffffffb0,%ecx
+f0100ac4:	8d 54 0a 51          	lea    0x51(%edx,%ecx,1),%edx
+f0100ac8:	8d 94 56 fe 0e 00 00 	lea    0xefe(%esi,%edx,2),%edx
+	for (i = crt_start + CRT_SIZE - CRT_COLS; i < crt_start + CRT_SIZE; i++)
+f0100acf:	eb 08                	jmp    f0100ad9 <cga_emit+0x214>
+		crt_buf[i] = 0x0700 | ' ';
+f0100ad1:	66 c7 00 20 07       	movw   $0x720,(%eax)
+f0100ad6:	83 c0 02             	add    $0x2,%eax
+	for (i = crt_start + CRT_SIZE - CRT_COLS; i < crt_start + CRT_SIZE; i++)
+f0100ad9:	39 d0                	cmp    %edx,%eax
+f0100adb:	75 f4                	jne    f0100ad1 <cga_emit+0x20c>
+	crt_nscrolled++;
+f0100add:	83 83 b8 bd 00 00 01 	addl   $0x1,0xbdb8(%ebx)
+}
+f0100ae4:	e9 95 fe ff ff       	jmp    f010097e <cga_emit+0xb9>
+
+f0100ae9 <lpt_putc>:
+{
+f0100ae9:	55                   	push   %ebp
+f0100aea:	89 e5                	mov    %esp,%ebp
+f0100aec:	57                   	push   %edi
+f0100aed:	56                   	push   %esi
+f0100aee:	53                   	push   %ebx
+f0100aef:	83 ec 04             	sub    $0x4,%esp
+f0100af2:	e8 f7 04 00 00       	call   f0100fee <__x86.get_pc_thunk.di>
+f0100af7:	81 c7 95 49 01 00    	add    $0x14995,%edi
+f0100afd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+	for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f0100b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100b05:	be 79 03 00 00       	mov    $0x379,%esi
+f0100b0a:	b9 84 00 00 00       	mov    $0x84,%ecx
+f0100b0f:	89 f2                	mov    %esi,%edx
+f0100b11:	ec                   	in     (%dx),%al
+f0100b12:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100b18:	7f 0f                	jg     f0100b29 <lpt_putc+0x40>
+f0100b1a:	84 c0                	test   %al,%al
+f0100b1c:	78 0b                	js     f0100b29 <lpt_putc+0x40>
+f0100b1e:	89 ca                	mov    %ecx,%edx
+f0100b20:	ec                   	in     (%dx),%al
+f0100b21:	ec                   	in     (%dx),%al
+f0100b22:	ec                   	in     (%dx),%al
+f0100b23:	ec                   	in     (%dx),%al
+f0100b24:	83 c3 01             	add    $0x1,%ebx
+f0100b27:	eb e6                	jmp    f0100b0f <lpt_putc+0x26>
+	if (i > 0)
+f0100b29:	85 db                	test   %ebx,%ebx
+f0100b2b:	7e 0f                	jle    f0100b3c <lpt_putc+0x53>
+		sinks[CONS_LPT].cs_stalls++;
+f0100b2d:	83 87 d0 01 00 00 01 	addl   $0x1,0x1d0(%edi)
+	if (i == 12800) {
+f0100b34:	81 fb 00 32 00 00    	cmp    $0x3200,%ebx
+f0100b3a:	74 2a                	je     f0100b66 <lpt_putc+0x7d>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100b3c:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100b41:	0f b6 45 f0          	movzbl -0x10(%ebp),%eax
+f0100b45:	ee                   	out    %al,(%dx)
+f0100b46:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100b4b:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100b50:	ee                   	out    %al,(%dx)
+f0100b51:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100b56:	ee                   	out    %al,(%dx)
+	sinks[CONS_LPT].cs_bytes++;
+f0100b57:	83 87 cc 01 00 00 01 	addl   $0x1,0x1cc(%edi)
+}
+f0100b5e:	83 c4 04             	add    $0x4,%esp
+f0100b61:	5b                   	pop    %ebx
+f0100b62:	5e                   	pop    %esi
+f0100b63:	5f                   	pop    %edi
+f0100b64:	5d                   	pop    %ebp
+f0100b65:	c3                   	ret
+		cons_mask &= ~(1 << CONS_LPT);
+f0100b66:	83 a7 e0 c1 00 00 fd 	andl   $0xfffffffd,0xc1e0(%edi)
+		return;
+f0100b6d:	eb ef                	jmp    f0100b5e <lpt_putc+0x75>
+
+f0100b6f <serial_intr>:
+{
+f0100b6f:	e8 6a 04 00 00       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0100b74:	05 18 49 01 00       	add    $0x14918,%eax
+	if (!serial_exists)
+f0100b79:	80 b8 dc c1 00 00 00 	cmpb   $0x0,0xc1dc(%eax)
+f0100b80:	74 27                	je     f0100ba9 <serial_intr+0x3a>
+{
+f0100b82:	55                   	push   %ebp
+f0100b83:	89 e5                	mov    %esp,%ebp
+f0100b85:	56                   	push   %esi
+f0100b86:	53                   	push   %ebx
+		cons_intr(serial_proc_data);
+f0100b87:	8d b0 c7 ae fe ff    	lea    -0x15139(%eax),%esi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100b8d:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f0100b92:	89 f0                	mov    %esi,%eax
+f0100b94:	e8 82 fa ff ff       	call   f010061b <cons_intr>
+		serial_tx_start();
+f0100b99:	e8 a3 f8 ff ff       	call   f0100441 <serial_tx_start>
+f0100b9e:	89 da                	mov    %ebx,%edx
+f0100ba0:	ec                   	in     (%dx),%al
+	} while (!(inb(COM1 + COM_IIR) & COM_IIR_NOPEND));
+f0100ba1:	a8 01                	test   $0x1,%al
+f0100ba3:	74 ed                	je     f0100b92 <serial_intr+0x23>
+}
+f0100ba5:	5b                   	pop    %ebx
+f0100ba6:	5e                   	pop    %esi
+f0100ba7:	5d                   	pop    %ebp
+f0100ba8:	c3                   	ret
+f0100ba9:	c3                   	ret
+
+f0100baa <kbd_intr>:
+{
+f0100baa:	55                   	push   %ebp
+f0100bab:	89 e5                	mov    %esp,%ebp
+f0100bad:	83 ec 08             	sub    $0x8,%esp
+f0100bb0:	e8 29 04 00 00       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0100bb5:	05 d7 48 01 00       	add    $0x148d7,%eax
+	cons_intr(kbd_proc_data);
+f0100bba:	8d 80 f3 b1 fe ff    	lea    -0x14e0d(%eax),%eax
+f0100bc0:	e8 56 fa ff ff       	call   f010061b <cons_intr>
+}
+f0100bc5:	c9                   	leave
+f0100bc6:	c3                   	ret
+
+f0100bc7 <cons_getc>:
+
+// return the next input character from the console, or 0 if none waiting
+int
+cons_getc(void)
+{
+f0100bc7:	55                   	push   %ebp
+f0100bc8:	89 e5                	mov    %esp,%ebp
+f0100bca:	56                   	push   %esi
+f0100bcb:	53                   	push   %ebx
+f0100bcc:	e8 7e f7 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100bd1:	81 c3 bb 48 01 00    	add    $0x148bb,%ebx
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100bd7:	9c                   	pushf
+f0100bd8:	58                   	pop    %eax
+f0100bd9:	89 c6                	mov    %eax,%esi
+	uint32_t eflags;
+	int c;
+
+	// keep the interrupt handlers off cons while we look at it
+	eflags = read_eflags();
+	asm volatile("cli");
+f0100bdb:	fa                   	cli
+
+	// With interrupts on, the keyboard and serial interrupts fill
+	// the buffer.  Otherwise (e.g., when the kernel monitor runs
+	// after a panic) poll for any pending input characters.
+	if (!(eflags & FL_IF)) {
+f0100bdc:	f6 c4 02             	test   $0x2,%ah
+f0100bdf:	74 39                	je     f0100c1a <cons_getc+0x53>
+		kbd_intr();
+	}
+
+	// grab the next character from the input buffer.
+	c = 0;
+	if (cons.rpos != cons.wpos) {
+f0100be1:	8b 83 94 1d 00 00    	mov    0x1d94(%ebx),%eax
+	c = 0;
+f0100be7:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (cons.rpos != cons.wpos) {
+f0100bec:	3b 83 98 1d 00 00    	cmp    0x1d98(%ebx),%eax
+f0100bf2:	74 1e                	je     f0100c12 <cons_getc+0x4b>
+		c = cons.buf[cons.rpos++];
+f0100bf4:	8d 48 01             	lea    0x1(%eax),%ecx
+f0100bf7:	0f b6 94 03 94 1b 00 	movzbl 0x1b94(%ebx,%eax,1),%edx
+f0100bfe:	00 
+		if (cons.rpos == CONSBUFSIZE)
+			cons.rpos = 0;
+f0100bff:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f0100c04:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100c09:	0f 45 c1             	cmovne %ecx,%eax
+f0100c0c:	89 83 94 1d 00 00    	mov    %eax,0x1d94(%ebx)
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0100c12:	56                   	push   %esi
+f0100c13:	9d                   	popf
+	}
+	write_eflags(eflags);
+	return c;
+}
+f0100c14:	89 d0                	mov    %edx,%eax
+f0100c16:	5b                   	pop    %ebx
+f0100c17:	5e                   	pop    %esi
+f0100c18:	5d                   	pop    %ebp
+f0100c19:	c3                   	ret
+		serial_intr();
+f0100c1a:	e8 50 ff ff ff       	call   f0100b6f <serial_intr>
+		kbd_intr();
+f0100c1f:	e8 86 ff ff ff       	call   f0100baa <kbd_intr>
+f0100c24:	eb bb                	jmp    f0100be1 <cons_getc+0x1a>
+
+f0100c26 <cons_write>:
+// Output 'n' bytes from 'buf' to the console.  This is cheaper than
+// cons_putc for each byte: the serial port takes them all into its
+// buffer at once and the display moves its cursor only at the end.
+void
+cons_write(const char *buf, int n)
+{
+f0100c26:	55                   	push   %ebp
+f0100c27:	89 e5                	mov    %esp,%ebp
+f0100c29:	57                   	push   %edi
+f0100c2a:	56                   	push   %esi
+f0100c2b:	53                   	push   %ebx
+f0100c2c:	83 ec 0c             	sub    $0xc,%esp
+f0100c2f:	e8 ba 03 00 00       	call   f0100fee <__x86.get_pc_thunk.di>
+f0100c34:	81 c7 58 48 01 00    	add    $0x14858,%edi
+f0100c3a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int i;
+
+	if (cons_mask & (1 << CONS_SERIAL))
+f0100c3d:	f6 87 e0 c1 00 00 01 	testb  $0x1,0xc1e0(%edi)
+f0100c44:	75 07                	jne    f0100c4d <cons_write+0x27>
+{
+f0100c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100c4b:	eb 1b                	jmp    f0100c68 <cons_write+0x42>
+		serial_write(buf, n);
+f0100c4d:	89 f2                	mov    %esi,%edx
+f0100c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100c52:	e8 40 f8 ff ff       	call   f0100497 <serial_write>
+f0100c57:	eb ed                	jmp    f0100c46 <cons_write+0x20>
+	// lpt_putc may give up on the printer part way through
+	for (i = 0; i < n && (cons_mask & (1 << CONS_LPT)); i++)
+		lpt_putc((uint8_t) buf[i]);
+f0100c59:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100c5c:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+f0100c60:	e8 84 fe ff ff       	call   f0100ae9 <lpt_putc>
+	for (i = 0; i < n && (cons_mask & (1 << CONS_LPT)); i++)
+f0100c65:	83 c3 01             	add    $0x1,%ebx
+f0100c68:	39 f3                	cmp    %esi,%ebx
+f0100c6a:	7d 09                	jge    f0100c75 <cons_write+0x4f>
+f0100c6c:	f6 87 e0 c1 00 00 02 	testb  $0x2,0xc1e0(%edi)
+f0100c73:	75 e4                	jne    f0100c59 <cons_write+0x33>
+	if (cons_mask & (1 << CONS_CGA))
+f0100c75:	f6 87 e0 c1 00 00 04 	testb  $0x4,0xc1e0(%edi)
+f0100c7c:	75 08                	jne    f0100c86 <cons_write+0x60>
+		cga_write(buf, n);
+}
+f0100c7e:	83 c4 0c             	add    $0xc,%esp
+f0100c81:	5b                   	pop    %ebx
+f0100c82:	5e                   	pop    %esi
+f0100c83:	5f                   	pop    %edi
+f0100c84:	5d                   	pop    %ebp
+f0100c85:	c3                   	ret
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100c86:	9c                   	pushf
+f0100c87:	58                   	pop    %eax
+f0100c88:	89 c7                	mov    %eax,%edi
+	asm volatile("cli");
+f0100c8a:	fa                   	cli
+	for (i = 0; i < n; i++)
+f0100c8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0100c90:	eb 0f                	jmp    f0100ca1 <cons_write+0x7b>
+		cga_emit((uint8_t) buf[i]);
+f0100c92:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100c95:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+f0100c99:	e8 27 fc ff ff       	call   f01008c5 <cga_emit>
+	for (i = 0; i < n; i++)
+f0100c9e:	83 c3 01             	add    $0x1,%ebx
+f0100ca1:	39 de                	cmp    %ebx,%esi
+f0100ca3:	7f ed                	jg     f0100c92 <cons_write+0x6c>
+	cga_cursor();
+f0100ca5:	e8 19 f9 ff ff       	call   f01005c3 <cga_cursor>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0100caa:	57                   	push   %edi
+f0100cab:	9d                   	popf
+}
+f0100cac:	eb d0                	jmp    f0100c7e <cons_write+0x58>
+
+f0100cae <cons_getsinks>:
+
+// return the set of output devices in use, as 1 << CONS_* bits
+int
+cons_getsinks(void)
+{
+f0100cae:	e8 2b 03 00 00       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0100cb3:	05 d9 47 01 00       	add    $0x147d9,%eax
+	return cons_mask;
+f0100cb8:	8b 80 e0 c1 00 00    	mov    0xc1e0(%eax),%eax
+}
+f0100cbe:	c3                   	ret
+
+f0100cbf <cons_setsinks>:
+// Send console output to the devices in 'mask' (1 << CONS_* bits)
+// only.  Devices cons_init did not find are left out.
+// Returns the new set.
+int
+cons_setsinks(int mask)
+{
+f0100cbf:	55                   	push   %ebp
+f0100cc0:	89 e5                	mov    %esp,%ebp
+f0100cc2:	e8 1b 03 00 00       	call   f0100fe2 <__x86.get_pc_thunk.dx>
+f0100cc7:	81 c2 c5 47 01 00    	add    $0x147c5,%edx
+f0100ccd:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i;
+
+	for (i = 0; i < NCONSSINK; i++)
+		if (!sinks[i].cs_present)
+f0100cd0:	80 ba b8 01 00 00 00 	cmpb   $0x0,0x1b8(%edx)
+f0100cd7:	75 03                	jne    f0100cdc <cons_setsinks+0x1d>
+			mask &= ~(1 << i);
+f0100cd9:	83 e0 fe             	and    $0xfffffffe,%eax
+		if (!sinks[i].cs_present)
+f0100cdc:	80 ba c8 01 00 00 00 	cmpb   $0x0,0x1c8(%edx)
+f0100ce3:	75 03                	jne    f0100ce8 <cons_setsinks+0x29>
+			mask &= ~(1 << i);
+f0100ce5:	83 e0 fd             	and    $0xfffffffd,%eax
+		if (!sinks[i].cs_present)
+f0100ce8:	80 ba d8 01 00 00 00 	cmpb   $0x0,0x1d8(%edx)
+f0100cef:	75 03                	jne    f0100cf4 <cons_setsinks+0x35>
+			mask &= ~(1 << i);
+f0100cf1:	83 e0 fb             	and    $0xfffffffb,%eax
+	cons_mask = mask;
+f0100cf4:	89 82 e0 c1 00 00    	mov    %eax,0xc1e0(%edx)
+	return mask;
+}
+f0100cfa:	5d                   	pop    %ebp
+f0100cfb:	c3                   	ret
+
+f0100cfc <cons_sink>:
+
+// return the description and counters of output device 'sink'
+const struct Conssink *
+cons_sink(int sink)
+{
+f0100cfc:	55                   	push   %ebp
+f0100cfd:	89 e5                	mov    %esp,%ebp
+f0100cff:	53                   	push   %ebx
+f0100d00:	83 ec 04             	sub    $0x4,%esp
+f0100d03:	e8 47 f6 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100d08:	81 c3 84 47 01 00    	add    $0x14784,%ebx
+f0100d0e:	8b 45 08             	mov    0x8(%ebp),%eax
+	assert(sink >= 0 && sink < NCONSSINK);
+f0100d11:	83 f8 02             	cmp    $0x2,%eax
+f0100d14:	77 0f                	ja     f0100d25 <cons_sink+0x29>
+	return &sinks[sink];
+f0100d16:	c1 e0 04             	shl    $0x4,%eax
+f0100d19:	8d 84 03 b4 01 00 00 	lea    0x1b4(%ebx,%eax,1),%eax
+}
+f0100d20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100d23:	c9                   	leave
+f0100d24:	c3                   	ret
+	assert(sink >= 0 && sink < NCONSSINK);
+f0100d25:	8d 83 8b 47 ff ff    	lea    -0xb875(%ebx),%eax
+f0100d2b:	50                   	push   %eax
+f0100d2c:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0100d32:	50                   	push   %eax
+f0100d33:	68 1b 03 00 00       	push   $0x31b
+f0100d38:	8d 83 be 47 ff ff    	lea    -0xb842(%ebx),%eax
+f0100d3e:	50                   	push   %eax
+f0100d3f:	e8 b4 f3 ff ff       	call   f01000f8 <_panic>
+
+f0100d44 <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f0100d44:	55                   	push   %ebp
+f0100d45:	89 e5                	mov    %esp,%ebp
+f0100d47:	57                   	push   %edi
+f0100d48:	56                   	push   %esi
+f0100d49:	53                   	push   %ebx
+f0100d4a:	83 ec 1c             	sub    $0x1c,%esp
+f0100d4d:	e8 fd f5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100d52:	81 c3 3a 47 01 00    	add    $0x1473a,%ebx
+	was = *cp;
+f0100d58:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+	*cp = (uint16_t) 0xA55A;
+f0100d5f:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100d66:	5a a5 
+	if (*cp != 0xA55A) {
+f0100d68:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f0100d6f:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f0100d73:	0f 84 59 01 00 00    	je     f0100ed2 <cons_init+0x18e>
+f0100d79:	b9 b4 03 00 00       	mov    $0x3b4,%ecx
+f0100d7e:	b8 d0 07 00 00       	mov    $0x7d0,%eax
+		cp = (uint16_t*) (KERNBASE + MONO_BUF);
+f0100d83:	c7 45 e4 00 00 0b f0 	movl   $0xf00b0000,-0x1c(%ebp)
+		addr_6845 = MONO_BASE;
+f0100d8a:	89 8b c8 bd 00 00    	mov    %ecx,0xbdc8(%ebx)
+		crt_vend = CRT_SIZE;
+f0100d90:	66 89 83 c2 bd 00 00 	mov    %ax,0xbdc2(%ebx)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100d97:	b8 0e 00 00 00       	mov    $0xe,%eax
+f0100d9c:	89 ca                	mov    %ecx,%edx
+f0100d9e:	ee                   	out    %al,(%dx)
+	pos = inb(addr_6845 + 1) << 8;
+f0100d9f:	8d 79 01             	lea    0x1(%ecx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100da2:	89 fa                	mov    %edi,%edx
+f0100da4:	ec                   	in     (%dx),%al
+f0100da5:	0f b6 f0             	movzbl %al,%esi
+f0100da8:	c1 e6 08             	shl    $0x8,%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100dab:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100db0:	89 ca                	mov    %ecx,%edx
+f0100db2:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100db3:	89 fa                	mov    %edi,%edx
+f0100db5:	ec                   	in     (%dx),%al
+	crt_buf = (uint16_t*) cp;
+f0100db6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0100db9:	89 93 c4 bd 00 00    	mov    %edx,0xbdc4(%ebx)
+	pos |= inb(addr_6845 + 1);
+f0100dbf:	0f b6 c0             	movzbl %al,%eax
+f0100dc2:	09 f0                	or     %esi,%eax
+	crt_pos = pos;
+f0100dc4:	66 89 83 c0 bd 00 00 	mov    %ax,0xbdc0(%ebx)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100dcb:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100dd0:	89 ca                	mov    %ecx,%edx
+f0100dd2:	ee                   	out    %al,(%dx)
+f0100dd3:	be 00 00 00 00       	mov    $0x0,%esi
+f0100dd8:	89 f0                	mov    %esi,%eax
+f0100dda:	89 fa                	mov    %edi,%edx
+f0100ddc:	ee                   	out    %al,(%dx)
+f0100ddd:	b8 0d 00 00 00       	mov    $0xd,%eax
+f0100de2:	89 ca                	mov    %ecx,%edx
+f0100de4:	ee                   	out    %al,(%dx)
+f0100de5:	89 f0                	mov    %esi,%eax
+f0100de7:	89 fa                	mov    %edi,%edx
+f0100de9:	ee                   	out    %al,(%dx)
+	crt_start = crt_shown = 0;
+f0100dea:	66 c7 83 bc bd 00 00 	movw   $0x0,0xbdbc(%ebx)
+f0100df1:	00 00 
+f0100df3:	66 c7 83 be bd 00 00 	movw   $0x0,0xbdbe(%ebx)
+f0100dfa:	00 00 
+	sinks[CONS_CGA].cs_present = 1;
+f0100dfc:	c6 83 d8 01 00 00 01 	movb   $0x1,0x1d8(%ebx)
+	kbd_intr();
+f0100e03:	e8 a2 fd ff ff       	call   f0100baa <kbd_intr>
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_KBD));
+f0100e08:	83 ec 0c             	sub    $0xc,%esp
+f0100e0b:	c7 c0 08 53 11 f0    	mov    $0xf0115308,%eax
+f0100e11:	0f b7 00             	movzwl (%eax),%eax
+f0100e14:	25 fd ff 00 00       	and    $0xfffd,%eax
+f0100e19:	50                   	push   %eax
+f0100e1a:	e8 11 30 00 00       	call   f0103e30 <irq_setmask_8259A>
+f0100e1f:	b8 07 00 00 00       	mov    $0x7,%eax
+f0100e24:	ba fa 03 00 00       	mov    $0x3fa,%edx
+f0100e29:	ee                   	out    %al,(%dx)
+f0100e2a:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f0100e2f:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f0100e34:	89 fa                	mov    %edi,%edx
+f0100e36:	ee                   	out    %al,(%dx)
+f0100e37:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100e3c:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0100e41:	ee                   	out    %al,(%dx)
+f0100e42:	b9 f9 03 00 00       	mov    $0x3f9,%ecx
+f0100e47:	89 f0                	mov    %esi,%eax
+f0100e49:	89 ca                	mov    %ecx,%edx
+f0100e4b:	ee                   	out    %al,(%dx)
+f0100e4c:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100e51:	89 fa                	mov    %edi,%edx
+f0100e53:	ee                   	out    %al,(%dx)
+f0100e54:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100e59:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f0100e5e:	ee                   	out    %al,(%dx)
+f0100e5f:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100e64:	89 ca                	mov    %ecx,%edx
+f0100e66:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100e67:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100e6c:	ec                   	in     (%dx),%al
+f0100e6d:	89 c1                	mov    %eax,%ecx
+	serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f0100e6f:	83 c4 10             	add    $0x10,%esp
+f0100e72:	3c ff                	cmp    $0xff,%al
+f0100e74:	0f 95 83 dc c1 00 00 	setne  0xc1dc(%ebx)
+f0100e7b:	ba fa 03 00 00       	mov    $0x3fa,%edx
+f0100e80:	ec                   	in     (%dx),%al
+	if ((inb(COM1+COM_IIR) & COM_IIR_FIFO) == COM_IIR_FIFO)
+f0100e81:	83 e0 c0             	and    $0xffffffc0,%eax
+f0100e84:	3c c0                	cmp    $0xc0,%al
+f0100e86:	74 67                	je     f0100eef <cons_init+0x1ab>
+f0100e88:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100e8d:	ec                   	in     (%dx),%al
+	if (serial_exists)
+f0100e8e:	80 f9 ff             	cmp    $0xff,%cl
+f0100e91:	75 68                	jne    f0100efb <cons_init+0x1b7>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100e93:	ba 78 03 00 00       	mov    $0x378,%edx
+f0100e98:	b8 aa ff ff ff       	mov    $0xffffffaa,%eax
+f0100e9d:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100e9e:	ec                   	in     (%dx),%al
+	sinks[CONS_LPT].cs_present = (inb(0x378+0) == 0xAA);
+f0100e9f:	3c aa                	cmp    $0xaa,%al
+f0100ea1:	0f 94 83 c8 01 00 00 	sete   0x1c8(%ebx)
+	cga_init();
+	kbd_init();
+	serial_init();
+	lpt_init();
+
+	sinks[CONS_SERIAL].cs_present = serial_exists;
+f0100ea8:	0f b6 b3 dc c1 00 00 	movzbl 0xc1dc(%ebx),%esi
+f0100eaf:	89 f0                	mov    %esi,%eax
+f0100eb1:	88 83 b8 01 00 00    	mov    %al,0x1b8(%ebx)
+	cons_setsinks(~0);
+f0100eb7:	83 ec 0c             	sub    $0xc,%esp
+f0100eba:	6a ff                	push   $0xffffffff
+f0100ebc:	e8 fe fd ff ff       	call   f0100cbf <cons_setsinks>
+
+	if (!serial_exists)
+f0100ec1:	83 c4 10             	add    $0x10,%esp
+f0100ec4:	89 f0                	mov    %esi,%eax
+f0100ec6:	84 c0                	test   %al,%al
+f0100ec8:	74 50                	je     f0100f1a <cons_init+0x1d6>
+		cprintf("Serial port does not exist!\n");
+}
+f0100eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100ecd:	5b                   	pop    %ebx
+f0100ece:	5e                   	pop    %esi
+f0100ecf:	5f                   	pop    %edi
+f0100ed0:	5d                   	pop    %ebp
+f0100ed1:	c3                   	ret
+		*cp = was;
+f0100ed2:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100ed9:	b9 d4 03 00 00       	mov    $0x3d4,%ecx
+f0100ede:	b8 f0 37 00 00       	mov    $0x37f0,%eax
+	cp = (uint16_t*) (KERNBASE + CGA_BUF);
+f0100ee3:	c7 45 e4 00 80 0b f0 	movl   $0xf00b8000,-0x1c(%ebp)
+f0100eea:	e9 9b fe ff ff       	jmp    f0100d8a <cons_init+0x46>
+		serial_txfifo = COM_TXFIFO;
+f0100eef:	c7 83 74 fe ff ff 10 	movl   $0x10,-0x18c(%ebx)
+f0100ef6:	00 00 00 
+f0100ef9:	eb 8d                	jmp    f0100e88 <cons_init+0x144>
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_SERIAL));
+f0100efb:	83 ec 0c             	sub    $0xc,%esp
+f0100efe:	c7 c0 08 53 11 f0    	mov    $0xf0115308,%eax
+f0100f04:	0f b7 00             	movzwl (%eax),%eax
+f0100f07:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100f0c:	50                   	push   %eax
+f0100f0d:	e8 1e 2f 00 00       	call   f0103e30 <irq_setmask_8259A>
+f0100f12:	83 c4 10             	add    $0x10,%esp
+f0100f15:	e9 79 ff ff ff       	jmp    f0100e93 <cons_init+0x14f>
+		cprintf("Serial port does not exist!\n");
+f0100f1a:	83 ec 0c             	sub    $0xc,%esp
+f0100f1d:	8d 83 cd 47 ff ff    	lea    -0xb833(%ebx),%eax
+f0100f23:	50                   	push   %eax
+f0100f24:	e8 69 31 00 00       	call   f0104092 <cprintf>
+f0100f29:	83 c4 10             	add    $0x10,%esp
+}
+f0100f2c:	eb 9c                	jmp    f0100eca <cons_init+0x186>
+
+f0100f2e <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f0100f2e:	55                   	push   %ebp
+f0100f2f:	89 e5                	mov    %esp,%ebp
+f0100f31:	56                   	push   %esi
+f0100f32:	53                   	push   %ebx
+f0100f33:	83 ec 10             	sub    $0x10,%esp
+f0100f36:	e8 14 f4 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100f3b:	81 c3 51 45 01 00    	add    $0x14551,%ebx
+	if (cons_mask & (1 << CONS_SERIAL))
+f0100f41:	8b b3 e0 c1 00 00    	mov    0xc1e0(%ebx),%esi
+f0100f47:	f7 c6 01 00 00 00    	test   $0x1,%esi
+f0100f4d:	75 18                	jne    f0100f67 <cputchar+0x39>
+	if (cons_mask & (1 << CONS_LPT))
+f0100f4f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+f0100f55:	75 26                	jne    f0100f7d <cputchar+0x4f>
+	if (cons_mask & (1 << CONS_CGA))
+f0100f57:	f6 83 e0 c1 00 00 04 	testb  $0x4,0xc1e0(%ebx)
+f0100f5e:	75 27                	jne    f0100f87 <cputchar+0x59>
+	cons_putc(c);
+}
+f0100f60:	83 c4 10             	add    $0x10,%esp
+f0100f63:	5b                   	pop    %ebx
+f0100f64:	5e                   	pop    %esi
+f0100f65:	5d                   	pop    %ebp
+f0100f66:	c3                   	ret
+	char ch = c;
+f0100f67:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+f0100f6b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	serial_write(&ch, 1);
+f0100f6e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+f0100f71:	ba 01 00 00 00       	mov    $0x1,%edx
+f0100f76:	e8 1c f5 ff ff       	call   f0100497 <serial_write>
+}
+f0100f7b:	eb d2                	jmp    f0100f4f <cputchar+0x21>
+		lpt_putc(c);
+f0100f7d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100f80:	e8 64 fb ff ff       	call   f0100ae9 <lpt_putc>
+f0100f85:	eb d0                	jmp    f0100f57 <cputchar+0x29>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100f87:	9c                   	pushf
+f0100f88:	5b                   	pop    %ebx
+	asm volatile("cli");
+f0100f89:	fa                   	cli
+	cga_emit(c);
+f0100f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100f8d:	e8 33 f9 ff ff       	call   f01008c5 <cga_emit>
+	cga_cursor();
+f0100f92:	e8 2c f6 ff ff       	call   f01005c3 <cga_cursor>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0100f97:	53                   	push   %ebx
+f0100f98:	9d                   	popf
+}
+f0100f99:	eb c5                	jmp    f0100f60 <cputchar+0x32>
+
+f0100f9b <getchar>:
+
+int
+getchar(void)
+{
+f0100f9b:	55                   	push   %ebp
+f0100f9c:	89 e5                	mov    %esp,%ebp
+f0100f9e:	53                   	push   %ebx
+f0100f9f:	83 ec 04             	sub    $0x4,%esp
+f0100fa2:	e8 a8 f3 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0100fa7:	81 c3 e5 44 01 00    	add    $0x144e5,%ebx
+	int c;
+
+	while ((c = cons_getc()) == 0)
+f0100fad:	e8 15 fc ff ff       	call   f0100bc7 <cons_getc>
+f0100fb2:	85 c0                	test   %eax,%eax
+f0100fb4:	75 1d                	jne    f0100fd3 <getchar+0x38>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0100fb6:	9c                   	pushf
+f0100fb7:	58                   	pop    %eax
+		if (read_eflags() & FL_IF)
+f0100fb8:	f6 c4 02             	test   $0x2,%ah
+f0100fbb:	74 f0                	je     f0100fad <getchar+0x12>
+	asm volatile("cli");
+f0100fbd:	fa                   	cli
+	if (cons.rpos == cons.wpos)
+f0100fbe:	8b 83 98 1d 00 00    	mov    0x1d98(%ebx),%eax
+f0100fc4:	39 83 94 1d 00 00    	cmp    %eax,0x1d94(%ebx)
+f0100fca:	74 03                	je     f0100fcf <getchar+0x34>
+		asm volatile("sti");
+f0100fcc:	fb                   	sti
+f0100fcd:	eb de                	jmp    f0100fad <getchar+0x12>
+		asm volatile("sti; hlt");
+f0100fcf:	fb                   	sti
+f0100fd0:	f4                   	hlt
+f0100fd1:	eb da                	jmp    f0100fad <getchar+0x12>
+			cons_wait();
+	return c;
+}
+f0100fd3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100fd6:	c9                   	leave
+f0100fd7:	c3                   	ret
+
+f0100fd8 <iscons>:
+int
+iscons(int fdnum)
+{
+	// used by readline
+	return 1;
+}
+f0100fd8:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100fdd:	c3                   	ret
+
+f0100fde <__x86.get_pc_thunk.ax>:
+f0100fde:	8b 04 24             	mov    (%esp),%eax
+f0100fe1:	c3                   	ret
+
+f0100fe2 <__x86.get_pc_thunk.dx>:
+f0100fe2:	8b 14 24             	mov    (%esp),%edx
+f0100fe5:	c3                   	ret
+
+f0100fe6 <__x86.get_pc_thunk.cx>:
+f0100fe6:	8b 0c 24             	mov    (%esp),%ecx
+f0100fe9:	c3                   	ret
+
+f0100fea <__x86.get_pc_thunk.si>:
+f0100fea:	8b 34 24             	mov    (%esp),%esi
+f0100fed:	c3                   	ret
+
+f0100fee <__x86.get_pc_thunk.di>:
+f0100fee:	8b 3c 24             	mov    (%esp),%edi
+f0100ff1:	c3                   	ret
+
+f0100ff2 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f0100ff2:	55                   	push   %ebp
+f0100ff3:	89 e5                	mov    %esp,%ebp
+f0100ff5:	57                   	push   %edi
+f0100ff6:	56                   	push   %esi
+f0100ff7:	53                   	push   %ebx
+f0100ff8:	83 ec 1c             	sub    $0x1c,%esp
+f0100ffb:	e8 4f f3 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101000:	81 c3 8c 44 01 00    	add    $0x1448c,%ebx
+f0101006:	8d b3 34 00 00 00    	lea    0x34(%ebx),%esi
+f010100c:	8d be 84 00 00 00    	lea    0x84(%esi),%edi
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f0101012:	8d 83 14 4a ff ff    	lea    -0xb5ec(%ebx),%eax
+f0101018:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f010101b:	eb 16                	jmp    f0101033 <mon_help+0x41>
+		cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f010101d:	83 ec 04             	sub    $0x4,%esp
+f0101020:	ff 76 04             	push   0x4(%esi)
+f0101023:	ff 36                	push   (%esi)
+f0101025:	ff 75 e4             	push   -0x1c(%ebp)
+f0101028:	e8 65 30 00 00       	call   f0104092 <cprintf>
+f010102d:	83 c6 0c             	add    $0xc,%esi
+f0101030:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAY_SIZE(commands); i++)
+f0101033:	39 fe                	cmp    %edi,%esi
+f0101035:	75 e6                	jne    f010101d <mon_help+0x2b>
+	return 0;
+}
+f0101037:	b8 00 00 00 00       	mov    $0x0,%eax
+f010103c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010103f:	5b                   	pop    %ebx
+f0101040:	5e                   	pop    %esi
+f0101041:	5f                   	pop    %edi
+f0101042:	5d                   	pop    %ebp
+f0101043:	c3                   	ret
+
+f0101044 <mon_kerninfo>:
+
+int
+mon_kerninfo(int argc, char **argv, struct Trapframe *tf)
+{
+f0101044:	55                   	push   %ebp
+f0101045:	89 e5                	mov    %esp,%ebp
+f0101047:	57                   	push   %edi
+f0101048:	56                   	push   %esi
+f0101049:	53                   	push   %ebx
+f010104a:	83 ec 28             	sub    $0x28,%esp
+f010104d:	e8 fd f2 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101052:	81 c3 3a 44 01 00    	add    $0x1443a,%ebx
+	extern char _start[], entry[], etext[], edata[], end[];
+	size_t ondisk, resident;
+
+	cprintf("Special kernel symbols:\n");
+f0101058:	8d 83 1d 4a ff ff    	lea    -0xb5e3(%ebx),%eax
+f010105e:	50                   	push   %eax
+f010105f:	e8 2e 30 00 00       	call   f0104092 <cprintf>
+	cprintf("  _start                  %08x (phys)\n", _start);
+f0101064:	83 c4 08             	add    $0x8,%esp
+f0101067:	ff b3 fc ff ff ff    	push   -0x4(%ebx)
+f010106d:	8d 83 cc 4b ff ff    	lea    -0xb434(%ebx),%eax
+f0101073:	50                   	push   %eax
+f0101074:	e8 19 30 00 00       	call   f0104092 <cprintf>
+	cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f0101079:	83 c4 0c             	add    $0xc,%esp
+f010107c:	c7 c7 0c 00 10 f0    	mov    $0xf010000c,%edi
+f0101082:	8d 87 00 00 00 10    	lea    0x10000000(%edi),%eax
+f0101088:	50                   	push   %eax
+f0101089:	57                   	push   %edi
+f010108a:	8d 83 f4 4b ff ff    	lea    -0xb40c(%ebx),%eax
+f0101090:	50                   	push   %eax
+f0101091:	e8 fc 2f 00 00       	call   f0104092 <cprintf>
+	cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0101096:	83 c4 0c             	add    $0xc,%esp
+f0101099:	c7 c0 3f 9b 10 f0    	mov    $0xf0109b3f,%eax
+f010109f:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f01010a5:	52                   	push   %edx
+f01010a6:	50                   	push   %eax
+f01010a7:	8d 83 18 4c ff ff    	lea    -0xb3e8(%ebx),%eax
+f01010ad:	50                   	push   %eax
+f01010ae:	e8 df 2f 00 00       	call   f0104092 <cprintf>
+	cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f01010b3:	83 c4 0c             	add    $0xc,%esp
+f01010b6:	c7 c0 00 70 11 f0    	mov    $0xf0117000,%eax
+f01010bc:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f01010c2:	52                   	push   %edx
+f01010c3:	50                   	push   %eax
+f01010c4:	8d 83 3c 4c ff ff    	lea    -0xb3c4(%ebx),%eax
+f01010ca:	50                   	push   %eax
+f01010cb:	e8 c2 2f 00 00       	call   f0104092 <cprintf>
+	cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f01010d0:	83 c4 0c             	add    $0xc,%esp
+f01010d3:	c7 c6 00 43 15 f0    	mov    $0xf0154300,%esi
+f01010d9:	8d 86 00 00 00 10    	lea    0x10000000(%esi),%eax
+f01010df:	50                   	push   %eax
+f01010e0:	56                   	push   %esi
+f01010e1:	8d 83 60 4c ff ff    	lea    -0xb3a0(%ebx),%eax
+f01010e7:	50                   	push   %eax
+f01010e8:	e8 a5 2f 00 00       	call   f0104092 <cprintf>
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01010ed:	83 c4 08             	add    $0x8,%esp
+		ROUNDUP(end - entry, 1024) / 1024);
+f01010f0:	29 fe                	sub    %edi,%esi
+f01010f2:	81 c6 ff 03 00 00    	add    $0x3ff,%esi
+	cprintf("Kernel executable memory footprint: %dKB\n",
+f01010f8:	c1 fe 0a             	sar    $0xa,%esi
+f01010fb:	56                   	push   %esi
+f01010fc:	8d 83 84 4c ff ff    	lea    -0xb37c(%ebx),%eax
+f0101102:	50                   	push   %eax
+f0101103:	e8 8a 2f 00 00       	call   f0104092 <cprintf>
+	debuginfo_footprint(&ondisk, &resident);
+f0101108:	83 c4 08             	add    $0x8,%esp
+f010110b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f010110e:	50                   	push   %eax
+f010110f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0101112:	50                   	push   %eax
+f0101113:	e8 49 43 00 00       	call   f0105461 <debuginfo_footprint>
+	if (ondisk)
+f0101118:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010111b:	83 c4 10             	add    $0x10,%esp
+f010111e:	85 c0                	test   %eax,%eax
+f0101120:	74 2f                	je     f0101151 <mon_kerninfo+0x10d>
+		cprintf("Debug info: %dKB on disk, %dKB resident\n",
+f0101122:	83 ec 04             	sub    $0x4,%esp
+f0101125:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101128:	c1 ea 0a             	shr    $0xa,%edx
+f010112b:	52                   	push   %edx
+			ROUNDUP(ondisk, 1024) / 1024, resident / 1024);
+f010112c:	05 ff 03 00 00       	add    $0x3ff,%eax
+		cprintf("Debug info: %dKB on disk, %dKB resident\n",
+f0101131:	c1 e8 0a             	shr    $0xa,%eax
+f0101134:	50                   	push   %eax
+f0101135:	8d 83 b0 4c ff ff    	lea    -0xb350(%ebx),%eax
+f010113b:	50                   	push   %eax
+f010113c:	e8 51 2f 00 00       	call   f0104092 <cprintf>
+f0101141:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("Debug info: not loaded\n");
+	return 0;
+}
+f0101144:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101149:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010114c:	5b                   	pop    %ebx
+f010114d:	5e                   	pop    %esi
+f010114e:	5f                   	pop    %edi
+f010114f:	5d                   	pop    %ebp
+f0101150:	c3                   	ret
+		cprintf("Debug info: not loaded\n");
+f0101151:	83 ec 0c             	sub    $0xc,%esp
+f0101154:	8d 83 36 4a ff ff    	lea    -0xb5ca(%ebx),%eax
+f010115a:	50                   	push   %eax
+f010115b:	e8 32 2f 00 00       	call   f0104092 <cprintf>
+f0101160:	83 c4 10             	add    $0x10,%esp
+f0101163:	eb df                	jmp    f0101144 <mon_kerninfo+0x100>
+
+f0101165 <mon_backtrace>:
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f0101165:	55                   	push   %ebp
+f0101166:	89 e5                	mov    %esp,%ebp
+f0101168:	57                   	push   %edi
+f0101169:	56                   	push   %esi
+f010116a:	53                   	push   %ebx
+f010116b:	83 ec 48             	sub    $0x48,%esp
+f010116e:	e8 dc f1 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101173:	81 c3 19 43 01 00    	add    $0x14319,%ebx
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f0101179:	89 ee                	mov    %ebp,%esi
+    // Get the current ebp pointing to the stack top.
+	uint32_t *ebp = (uint32_t *)read_ebp();
+	uint32_t eip;
+	struct Eipdebuginfo info;
+
+	cprintf("Stack backtrace:\n");
+f010117b:	8d 83 4e 4a ff ff    	lea    -0xb5b2(%ebx),%eax
+f0101181:	50                   	push   %eax
+f0101182:	e8 0b 2f 00 00       	call   f0104092 <cprintf>
+	while (ebp) {
+f0101187:	83 c4 10             	add    $0x10,%esp
+		eip = *(ebp + 1);
+        // Print demanded content according to the stack structure known before.
+		cprintf_cached("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", 
+f010118a:	8d 83 54 03 00 00    	lea    0x354(%ebx),%eax
+f0101190:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+				ebp, eip, *(ebp + 2), *(ebp + 3), *(ebp + 4), *(ebp + 5), *(ebp + 6));
+		// Get and print debug infomation.
+		// For arguments, notice that uintptr_t == uint32_t
+		debuginfo_eip(eip, &info);
+		cprintf_cached("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip - info.eip_fn_addr);
+f0101193:	8d 83 f4 01 00 00    	lea    0x1f4(%ebx),%eax
+f0101199:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	while (ebp) {
+f010119c:	eb 49                	jmp    f01011e7 <mon_backtrace+0x82>
+		eip = *(ebp + 1);
+f010119e:	8b 7e 04             	mov    0x4(%esi),%edi
+		cprintf_cached("  ebp %08x  eip %08x  args %08x %08x %08x %08x %08x\n", 
+f01011a1:	ff 76 18             	push   0x18(%esi)
+f01011a4:	ff 76 14             	push   0x14(%esi)
+f01011a7:	ff 76 10             	push   0x10(%esi)
+f01011aa:	ff 76 0c             	push   0xc(%esi)
+f01011ad:	ff 76 08             	push   0x8(%esi)
+f01011b0:	57                   	push   %edi
+f01011b1:	56                   	push   %esi
+f01011b2:	ff 75 c4             	push   -0x3c(%ebp)
+f01011b5:	e8 51 2f 00 00       	call   f010410b <cprintfc>
+		debuginfo_eip(eip, &info);
+f01011ba:	83 c4 18             	add    $0x18,%esp
+f01011bd:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f01011c0:	50                   	push   %eax
+f01011c1:	57                   	push   %edi
+f01011c2:	e8 47 38 00 00       	call   f0104a0e <debuginfo_eip>
+		cprintf_cached("         %s:%d: %.*s+%d\n", info.eip_file, info.eip_line, info.eip_fn_namelen, info.eip_fn_name, eip - info.eip_fn_addr);
+f01011c7:	83 c4 08             	add    $0x8,%esp
+f01011ca:	2b 7d e0             	sub    -0x20(%ebp),%edi
+f01011cd:	57                   	push   %edi
+f01011ce:	ff 75 d8             	push   -0x28(%ebp)
+f01011d1:	ff 75 dc             	push   -0x24(%ebp)
+f01011d4:	ff 75 d4             	push   -0x2c(%ebp)
+f01011d7:	ff 75 d0             	push   -0x30(%ebp)
+f01011da:	ff 75 c0             	push   -0x40(%ebp)
+f01011dd:	e8 29 2f 00 00       	call   f010410b <cprintfc>
+        // Trace back to the last stack frame.
+		ebp = (uint32_t *)(*ebp);
+f01011e2:	8b 36                	mov    (%esi),%esi
+f01011e4:	83 c4 20             	add    $0x20,%esp
+	while (ebp) {
+f01011e7:	85 f6                	test   %esi,%esi
+f01011e9:	75 b3                	jne    f010119e <mon_backtrace+0x39>
+	}
+	return 0;
+}
+f01011eb:	b8 00 00 00 00       	mov    $0x0,%eax
+f01011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01011f3:	5b                   	pop    %ebx
+f01011f4:	5e                   	pop    %esi
+f01011f5:	5f                   	pop    %edi
+f01011f6:	5d                   	pop    %ebp
+f01011f7:	c3                   	ret
+
+f01011f8 <runargs>:
+}
+
+// Lookup and invoke the command
+static int
+runargs(int argc, char **argv, struct Trapframe *tf)
+{
+f01011f8:	55                   	push   %ebp
+f01011f9:	89 e5                	mov    %esp,%ebp
+f01011fb:	57                   	push   %edi
+f01011fc:	56                   	push   %esi
+f01011fd:	53                   	push   %ebx
+f01011fe:	83 ec 1c             	sub    $0x1c,%esp
+f0101201:	e8 49 f1 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101206:	81 c3 86 42 01 00    	add    $0x14286,%ebx
+f010120c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010120f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int i;
+
+	if (argc == 0)
+f0101212:	85 c0                	test   %eax,%eax
+f0101214:	74 4b                	je     f0101261 <runargs+0x69>
+f0101216:	8d b3 34 00 00 00    	lea    0x34(%ebx),%esi
+		return 0;
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f010121c:	bf 00 00 00 00       	mov    $0x0,%edi
+f0101221:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		if (strcmp(argv[0], commands[i].name) == 0)
+f0101224:	83 ec 08             	sub    $0x8,%esp
+f0101227:	ff 36                	push   (%esi)
+f0101229:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010122c:	ff 30                	push   (%eax)
+f010122e:	e8 c2 6d 00 00       	call   f0107ff5 <strcmp>
+f0101233:	83 c6 0c             	add    $0xc,%esi
+f0101236:	83 c4 10             	add    $0x10,%esp
+f0101239:	85 c0                	test   %eax,%eax
+f010123b:	74 2c                	je     f0101269 <runargs+0x71>
+	for (i = 0; i < ARRAY_SIZE(commands); i++) {
+f010123d:	83 c7 01             	add    $0x1,%edi
+f0101240:	83 ff 0b             	cmp    $0xb,%edi
+f0101243:	75 df                	jne    f0101224 <runargs+0x2c>
+			return commands[i].func(argc, argv, tf);
+	}
+	cprintf("Unknown command '%s'\n", argv[0]);
+f0101245:	83 ec 08             	sub    $0x8,%esp
+f0101248:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010124b:	ff 30                	push   (%eax)
+f010124d:	8d 83 60 4a ff ff    	lea    -0xb5a0(%ebx),%eax
+f0101253:	50                   	push   %eax
+f0101254:	e8 39 2e 00 00       	call   f0104092 <cprintf>
+	return 0;
+f0101259:	83 c4 10             	add    $0x10,%esp
+f010125c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101264:	5b                   	pop    %ebx
+f0101265:	5e                   	pop    %esi
+f0101266:	5f                   	pop    %edi
+f0101267:	5d                   	pop    %ebp
+f0101268:	c3                   	ret
+			return commands[i].func(argc, argv, tf);
+f0101269:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010126c:	83 ec 04             	sub    $0x4,%esp
+f010126f:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f0101272:	ff 75 e0             	push   -0x20(%ebp)
+f0101275:	ff 75 e4             	push   -0x1c(%ebp)
+f0101278:	50                   	push   %eax
+f0101279:	ff 94 93 3c 00 00 00 	call   *0x3c(%ebx,%edx,4)
+f0101280:	83 c4 10             	add    $0x10,%esp
+f0101283:	eb dc                	jmp    f0101261 <runargs+0x69>
+
+f0101285 <mon_console>:
+{
+f0101285:	55                   	push   %ebp
+f0101286:	89 e5                	mov    %esp,%ebp
+f0101288:	57                   	push   %edi
+f0101289:	56                   	push   %esi
+f010128a:	53                   	push   %ebx
+f010128b:	83 ec 1c             	sub    $0x1c,%esp
+f010128e:	e8 bc f0 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101293:	81 c3 f9 41 01 00    	add    $0x141f9,%ebx
+	mask = cons_getsinks();
+f0101299:	e8 10 fa ff ff       	call   f0100cae <cons_getsinks>
+f010129e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (i = 1; i < argc; i++) {
+f01012a1:	ba 01 00 00 00       	mov    $0x1,%edx
+f01012a6:	e9 d0 00 00 00       	jmp    f010137b <mon_console+0xf6>
+			mask &= ~(1 << j);
+f01012ab:	b8 01 00 00 00       	mov    $0x1,%eax
+f01012b0:	89 f1                	mov    %esi,%ecx
+f01012b2:	d3 e0                	shl    %cl,%eax
+f01012b4:	f7 d0                	not    %eax
+f01012b6:	21 45 dc             	and    %eax,-0x24(%ebp)
+f01012b9:	e9 ba 00 00 00       	jmp    f0101378 <mon_console+0xf3>
+	if (argc > 1 && cons_setsinks(mask) != mask)
+f01012be:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01012c2:	7f 21                	jg     f01012e5 <mon_console+0x60>
+	mask = cons_getsinks();
+f01012c4:	e8 e5 f9 ff ff       	call   f0100cae <cons_getsinks>
+f01012c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (i = 0; i < NCONSSINK; i++) {
+f01012cc:	be 00 00 00 00       	mov    $0x0,%esi
+		cprintf("%-8s %-7s %10u bytes %10u stalls\n", cs->cs_name,
+f01012d1:	8d 83 76 4a ff ff    	lea    -0xb58a(%ebx),%eax
+f01012d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			!cs->cs_present ? "absent" : (mask & (1 << i)) ? "on" : "off",
+f01012da:	8d 83 68 5b ff ff    	lea    -0xa498(%ebx),%eax
+f01012e0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01012e3:	eb 4a                	jmp    f010132f <mon_console+0xaa>
+	if (argc > 1 && cons_setsinks(mask) != mask)
+f01012e5:	83 ec 0c             	sub    $0xc,%esp
+f01012e8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f01012eb:	57                   	push   %edi
+f01012ec:	e8 ce f9 ff ff       	call   f0100cbf <cons_setsinks>
+f01012f1:	83 c4 10             	add    $0x10,%esp
+f01012f4:	39 f8                	cmp    %edi,%eax
+f01012f6:	74 cc                	je     f01012c4 <mon_console+0x3f>
+		cprintf("Some of those devices are not present\n");
+f01012f8:	83 ec 0c             	sub    $0xc,%esp
+f01012fb:	8d 83 dc 4c ff ff    	lea    -0xb324(%ebx),%eax
+f0101301:	50                   	push   %eax
+f0101302:	e8 8b 2d 00 00       	call   f0104092 <cprintf>
+f0101307:	83 c4 10             	add    $0x10,%esp
+f010130a:	eb b8                	jmp    f01012c4 <mon_console+0x3f>
+		cprintf("%-8s %-7s %10u bytes %10u stalls\n", cs->cs_name,
+f010130c:	83 ec 0c             	sub    $0xc,%esp
+f010130f:	57                   	push   %edi
+f0101310:	51                   	push   %ecx
+f0101311:	52                   	push   %edx
+f0101312:	ff 30                	push   (%eax)
+f0101314:	8d 83 04 4d ff ff    	lea    -0xb2fc(%ebx),%eax
+f010131a:	50                   	push   %eax
+f010131b:	e8 72 2d 00 00       	call   f0104092 <cprintf>
+	for (i = 0; i < NCONSSINK; i++) {
+f0101320:	83 c6 01             	add    $0x1,%esi
+f0101323:	83 c4 20             	add    $0x20,%esp
+f0101326:	83 fe 03             	cmp    $0x3,%esi
+f0101329:	0f 84 aa 00 00 00    	je     f01013d9 <mon_console+0x154>
+		cs = cons_sink(i);
+f010132f:	83 ec 0c             	sub    $0xc,%esp
+f0101332:	56                   	push   %esi
+f0101333:	e8 c4 f9 ff ff       	call   f0100cfc <cons_sink>
+			cs->cs_bytes, cs->cs_stalls);
+f0101338:	8b 78 0c             	mov    0xc(%eax),%edi
+f010133b:	8b 48 08             	mov    0x8(%eax),%ecx
+		cprintf("%-8s %-7s %10u bytes %10u stalls\n", cs->cs_name,
+f010133e:	83 c4 10             	add    $0x10,%esp
+f0101341:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101344:	80 78 04 00          	cmpb   $0x0,0x4(%eax)
+f0101348:	74 c2                	je     f010130c <mon_console+0x87>
+			!cs->cs_present ? "absent" : (mask & (1 << i)) ? "on" : "off",
+f010134a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010134d:	0f a3 f2             	bt     %esi,%edx
+f0101350:	8d 93 7d 4a ff ff    	lea    -0xb583(%ebx),%edx
+f0101356:	0f 42 55 dc          	cmovb  -0x24(%ebp),%edx
+f010135a:	eb b0                	jmp    f010130c <mon_console+0x87>
+		if (on)
+f010135c:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+f0101360:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0101363:	80 f9 2d             	cmp    $0x2d,%cl
+f0101366:	0f 84 3f ff ff ff    	je     f01012ab <mon_console+0x26>
+			mask |= 1 << j;
+f010136c:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101371:	89 f1                	mov    %esi,%ecx
+f0101373:	d3 e0                	shl    %cl,%eax
+f0101375:	09 45 dc             	or     %eax,-0x24(%ebp)
+	for (i = 1; i < argc; i++) {
+f0101378:	83 c2 01             	add    $0x1,%edx
+f010137b:	3b 55 08             	cmp    0x8(%ebp),%edx
+f010137e:	0f 8d 3a ff ff ff    	jge    f01012be <mon_console+0x39>
+		name = argv[i];
+f0101384:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101387:	8b 3c 90             	mov    (%eax,%edx,4),%edi
+		on = (*name != '-');
+f010138a:	0f b6 0f             	movzbl (%edi),%ecx
+		if (*name == '+' || *name == '-')
+f010138d:	8d 41 d5             	lea    -0x2b(%ecx),%eax
+f0101390:	83 e0 fd             	and    $0xfffffffd,%eax
+			name++;
+f0101393:	3c 01                	cmp    $0x1,%al
+f0101395:	83 d7 00             	adc    $0x0,%edi
+		for (j = 0; j < NCONSSINK; j++)
+f0101398:	be 00 00 00 00       	mov    $0x0,%esi
+f010139d:	88 4d e4             	mov    %cl,-0x1c(%ebp)
+f01013a0:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			if (strcmp(name, cons_sink(j)->cs_name) == 0)
+f01013a3:	83 ec 0c             	sub    $0xc,%esp
+f01013a6:	56                   	push   %esi
+f01013a7:	e8 50 f9 ff ff       	call   f0100cfc <cons_sink>
+f01013ac:	83 c4 08             	add    $0x8,%esp
+f01013af:	ff 30                	push   (%eax)
+f01013b1:	57                   	push   %edi
+f01013b2:	e8 3e 6c 00 00       	call   f0107ff5 <strcmp>
+f01013b7:	83 c4 10             	add    $0x10,%esp
+f01013ba:	85 c0                	test   %eax,%eax
+f01013bc:	74 9e                	je     f010135c <mon_console+0xd7>
+		for (j = 0; j < NCONSSINK; j++)
+f01013be:	83 c6 01             	add    $0x1,%esi
+f01013c1:	83 fe 03             	cmp    $0x3,%esi
+f01013c4:	75 dd                	jne    f01013a3 <mon_console+0x11e>
+			cprintf("Unknown console device '%s'\n", name);
+f01013c6:	83 ec 08             	sub    $0x8,%esp
+f01013c9:	57                   	push   %edi
+f01013ca:	8d 83 81 4a ff ff    	lea    -0xb57f(%ebx),%eax
+f01013d0:	50                   	push   %eax
+f01013d1:	e8 bc 2c 00 00       	call   f0104092 <cprintf>
+			return 0;
+f01013d6:	83 c4 10             	add    $0x10,%esp
+}
+f01013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01013de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01013e1:	5b                   	pop    %ebx
+f01013e2:	5e                   	pop    %esi
+f01013e3:	5f                   	pop    %edi
+f01013e4:	5d                   	pop    %ebp
+f01013e5:	c3                   	ret
+
+f01013e6 <mon_trace>:
+{
+f01013e6:	55                   	push   %ebp
+f01013e7:	89 e5                	mov    %esp,%ebp
+f01013e9:	57                   	push   %edi
+f01013ea:	56                   	push   %esi
+f01013eb:	53                   	push   %ebx
+f01013ec:	83 ec 1c             	sub    $0x1c,%esp
+f01013ef:	e8 5b ef ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01013f4:	81 c3 98 40 01 00    	add    $0x14098,%ebx
+	uint32_t arg[4] = { 0, 0, 0, 0 };
+f01013fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0101401:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f0101408:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f010140f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (argc == 1) {
+f0101416:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f010141a:	75 68                	jne    f0101484 <mon_trace+0x9e>
+		cprintf("tracing is %s\n", trace_on ? "on" : "off");
+f010141c:	8d 83 7d 4a ff ff    	lea    -0xb583(%ebx),%eax
+f0101422:	c7 c2 48 54 11 f0    	mov    $0xf0115448,%edx
+f0101428:	80 3a 00             	cmpb   $0x0,(%edx)
+f010142b:	74 06                	je     f0101433 <mon_trace+0x4d>
+f010142d:	8d 83 68 5b ff ff    	lea    -0xa498(%ebx),%eax
+f0101433:	83 ec 08             	sub    $0x8,%esp
+f0101436:	50                   	push   %eax
+f0101437:	8d 83 9e 4a ff ff    	lea    -0xb562(%ebx),%eax
+f010143d:	50                   	push   %eax
+f010143e:	e8 4f 2c 00 00       	call   f0104092 <cprintf>
+f0101443:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < NCPU; i++)
+f0101446:	be 00 00 00 00       	mov    $0x0,%esi
+				cprintf("  CPU %d: %d records\n", i, trace_nrec(i));
+f010144b:	8d bb ad 4a ff ff    	lea    -0xb553(%ebx),%edi
+f0101451:	eb 08                	jmp    f010145b <mon_trace+0x75>
+		for (i = 0; i < NCPU; i++)
+f0101453:	83 c6 01             	add    $0x1,%esi
+f0101456:	83 fe 08             	cmp    $0x8,%esi
+f0101459:	74 4e                	je     f01014a9 <mon_trace+0xc3>
+			if (trace_nrec(i))
+f010145b:	83 ec 0c             	sub    $0xc,%esp
+f010145e:	56                   	push   %esi
+f010145f:	e8 f2 40 00 00       	call   f0105556 <trace_nrec>
+f0101464:	83 c4 10             	add    $0x10,%esp
+f0101467:	85 c0                	test   %eax,%eax
+f0101469:	74 e8                	je     f0101453 <mon_trace+0x6d>
+				cprintf("  CPU %d: %d records\n", i, trace_nrec(i));
+f010146b:	83 ec 0c             	sub    $0xc,%esp
+f010146e:	56                   	push   %esi
+f010146f:	e8 e2 40 00 00       	call   f0105556 <trace_nrec>
+f0101474:	83 c4 0c             	add    $0xc,%esp
+f0101477:	50                   	push   %eax
+f0101478:	56                   	push   %esi
+f0101479:	57                   	push   %edi
+f010147a:	e8 13 2c 00 00       	call   f0104092 <cprintf>
+f010147f:	83 c4 10             	add    $0x10,%esp
+f0101482:	eb cf                	jmp    f0101453 <mon_trace+0x6d>
+	} else if (strcmp(argv[1], "on") == 0)
+f0101484:	83 ec 08             	sub    $0x8,%esp
+f0101487:	8d 83 68 5b ff ff    	lea    -0xa498(%ebx),%eax
+f010148d:	50                   	push   %eax
+f010148e:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101491:	ff 70 04             	push   0x4(%eax)
+f0101494:	e8 5c 6b 00 00       	call   f0107ff5 <strcmp>
+f0101499:	83 c4 10             	add    $0x10,%esp
+f010149c:	85 c0                	test   %eax,%eax
+f010149e:	75 16                	jne    f01014b6 <mon_trace+0xd0>
+		trace_on = 1;
+f01014a0:	c7 c0 48 54 11 f0    	mov    $0xf0115448,%eax
+f01014a6:	c6 00 01             	movb   $0x1,(%eax)
+}
+f01014a9:	b8 00 00 00 00       	mov    $0x0,%eax
+f01014ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01014b1:	5b                   	pop    %ebx
+f01014b2:	5e                   	pop    %esi
+f01014b3:	5f                   	pop    %edi
+f01014b4:	5d                   	pop    %ebp
+f01014b5:	c3                   	ret
+	else if (strcmp(argv[1], "off") == 0)
+f01014b6:	83 ec 08             	sub    $0x8,%esp
+f01014b9:	8d 83 7d 4a ff ff    	lea    -0xb583(%ebx),%eax
+f01014bf:	50                   	push   %eax
+f01014c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01014c3:	ff 70 04             	push   0x4(%eax)
+f01014c6:	e8 2a 6b 00 00       	call   f0107ff5 <strcmp>
+f01014cb:	83 c4 10             	add    $0x10,%esp
+f01014ce:	85 c0                	test   %eax,%eax
+f01014d0:	75 0b                	jne    f01014dd <mon_trace+0xf7>
+		trace_on = 0;
+f01014d2:	c7 c0 48 54 11 f0    	mov    $0xf0115448,%eax
+f01014d8:	c6 00 00             	movb   $0x0,(%eax)
+f01014db:	eb cc                	jmp    f01014a9 <mon_trace+0xc3>
+	else if (strcmp(argv[1], "clear") == 0)
+f01014dd:	83 ec 08             	sub    $0x8,%esp
+f01014e0:	8d 83 c3 4a ff ff    	lea    -0xb53d(%ebx),%eax
+f01014e6:	50                   	push   %eax
+f01014e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01014ea:	ff 70 04             	push   0x4(%eax)
+f01014ed:	e8 03 6b 00 00       	call   f0107ff5 <strcmp>
+f01014f2:	83 c4 10             	add    $0x10,%esp
+f01014f5:	85 c0                	test   %eax,%eax
+f01014f7:	75 07                	jne    f0101500 <mon_trace+0x11a>
+		trace_clear();
+f01014f9:	e8 80 40 00 00       	call   f010557e <trace_clear>
+f01014fe:	eb a9                	jmp    f01014a9 <mon_trace+0xc3>
+	else if (strcmp(argv[1], "mark") == 0) {
+f0101500:	83 ec 08             	sub    $0x8,%esp
+f0101503:	8d 83 c9 4a ff ff    	lea    -0xb537(%ebx),%eax
+f0101509:	50                   	push   %eax
+f010150a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010150d:	ff 70 04             	push   0x4(%eax)
+f0101510:	e8 e0 6a 00 00       	call   f0107ff5 <strcmp>
+f0101515:	83 c4 10             	add    $0x10,%esp
+		for (i = 2; i < argc && i - 2 < ARRAY_SIZE(arg); i++)
+f0101518:	be 02 00 00 00       	mov    $0x2,%esi
+	else if (strcmp(argv[1], "mark") == 0) {
+f010151d:	85 c0                	test   %eax,%eax
+f010151f:	74 33                	je     f0101554 <mon_trace+0x16e>
+		cprintf("usage: trace [on|off|clear|mark [args]]\n");
+f0101521:	83 ec 0c             	sub    $0xc,%esp
+f0101524:	8d 83 28 4d ff ff    	lea    -0xb2d8(%ebx),%eax
+f010152a:	50                   	push   %eax
+f010152b:	e8 62 2b 00 00       	call   f0104092 <cprintf>
+f0101530:	83 c4 10             	add    $0x10,%esp
+f0101533:	e9 71 ff ff ff       	jmp    f01014a9 <mon_trace+0xc3>
+			arg[i - 2] = strtol(argv[i], NULL, 0);
+f0101538:	83 ec 04             	sub    $0x4,%esp
+f010153b:	6a 00                	push   $0x0
+f010153d:	6a 00                	push   $0x0
+f010153f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101542:	ff 34 b0             	push   (%eax,%esi,4)
+f0101545:	e8 62 6d 00 00       	call   f01082ac <strtol>
+f010154a:	89 44 b5 d0          	mov    %eax,-0x30(%ebp,%esi,4)
+		for (i = 2; i < argc && i - 2 < ARRAY_SIZE(arg); i++)
+f010154e:	83 c6 01             	add    $0x1,%esi
+f0101551:	83 c4 10             	add    $0x10,%esp
+f0101554:	3b 75 08             	cmp    0x8(%ebp),%esi
+f0101557:	7d 05                	jge    f010155e <mon_trace+0x178>
+f0101559:	83 fe 06             	cmp    $0x6,%esi
+f010155c:	75 da                	jne    f0101538 <mon_trace+0x152>
+		trace(TR_MARK, arg[0], arg[1], arg[2], arg[3]);
+f010155e:	c7 c0 48 54 11 f0    	mov    $0xf0115448,%eax
+f0101564:	80 38 00             	cmpb   $0x0,(%eax)
+f0101567:	0f 84 3c ff ff ff    	je     f01014a9 <mon_trace+0xc3>
+f010156d:	83 ec 0c             	sub    $0xc,%esp
+f0101570:	ff 75 e4             	push   -0x1c(%ebp)
+f0101573:	ff 75 e0             	push   -0x20(%ebp)
+f0101576:	ff 75 dc             	push   -0x24(%ebp)
+f0101579:	ff 75 d8             	push   -0x28(%ebp)
+f010157c:	6a 01                	push   $0x1
+f010157e:	e8 54 3f 00 00       	call   f01054d7 <trace_event>
+f0101583:	83 c4 20             	add    $0x20,%esp
+f0101586:	e9 1e ff ff ff       	jmp    f01014a9 <mon_trace+0xc3>
+
+f010158b <mon_tracedump>:
+{
+f010158b:	55                   	push   %ebp
+f010158c:	89 e5                	mov    %esp,%ebp
+f010158e:	53                   	push   %ebx
+f010158f:	83 ec 04             	sub    $0x4,%esp
+f0101592:	e8 b8 ed ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101597:	81 c3 f5 3e 01 00    	add    $0x13ef5,%ebx
+	trace_dump(argc > 1 ? strtol(argv[1], NULL, 0) : 0);
+f010159d:	b8 00 00 00 00       	mov    $0x0,%eax
+f01015a2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01015a6:	7f 13                	jg     f01015bb <mon_tracedump+0x30>
+f01015a8:	83 ec 0c             	sub    $0xc,%esp
+f01015ab:	50                   	push   %eax
+f01015ac:	e8 28 40 00 00       	call   f01055d9 <trace_dump>
+}
+f01015b1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01015b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01015b9:	c9                   	leave
+f01015ba:	c3                   	ret
+	trace_dump(argc > 1 ? strtol(argv[1], NULL, 0) : 0);
+f01015bb:	83 ec 04             	sub    $0x4,%esp
+f01015be:	6a 00                	push   $0x0
+f01015c0:	6a 00                	push   $0x0
+f01015c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01015c5:	ff 70 04             	push   0x4(%eax)
+f01015c8:	e8 df 6c 00 00       	call   f01082ac <strtol>
+f01015cd:	83 c4 10             	add    $0x10,%esp
+f01015d0:	eb d6                	jmp    f01015a8 <mon_tracedump+0x1d>
+
+f01015d2 <mon_prof>:
+{
+f01015d2:	55                   	push   %ebp
+f01015d3:	89 e5                	mov    %esp,%ebp
+f01015d5:	57                   	push   %edi
+f01015d6:	56                   	push   %esi
+f01015d7:	53                   	push   %ebx
+f01015d8:	83 ec 2c             	sub    $0x2c,%esp
+f01015db:	e8 6f ed ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01015e0:	81 c3 ac 3e 01 00    	add    $0x13eac,%ebx
+	if (argc >= 2 && strcmp(argv[1], "start") == 0) {
+f01015e6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01015ea:	7f 1f                	jg     f010160b <mon_prof+0x39>
+		cprintf("usage: prof start [-g] [-e event] [hz|period] | stop | report [n]\n");
+f01015ec:	83 ec 0c             	sub    $0xc,%esp
+f01015ef:	8d 83 c0 4d ff ff    	lea    -0xb240(%ebx),%eax
+f01015f5:	50                   	push   %eax
+f01015f6:	e8 97 2a 00 00       	call   f0104092 <cprintf>
+f01015fb:	83 c4 10             	add    $0x10,%esp
+}
+f01015fe:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101606:	5b                   	pop    %ebx
+f0101607:	5e                   	pop    %esi
+f0101608:	5f                   	pop    %edi
+f0101609:	5d                   	pop    %ebp
+f010160a:	c3                   	ret
+	if (argc >= 2 && strcmp(argv[1], "start") == 0) {
+f010160b:	83 ec 08             	sub    $0x8,%esp
+f010160e:	8d 83 ce 4a ff ff    	lea    -0xb532(%ebx),%eax
+f0101614:	50                   	push   %eax
+f0101615:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101618:	ff 70 04             	push   0x4(%eax)
+f010161b:	e8 d5 69 00 00       	call   f0107ff5 <strcmp>
+f0101620:	83 c4 10             	add    $0x10,%esp
+f0101623:	85 c0                	test   %eax,%eax
+f0101625:	0f 84 ea 00 00 00    	je     f0101715 <mon_prof+0x143>
+	} else if (argc == 2 && strcmp(argv[1], "stop") == 0)
+f010162b:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+f010162f:	0f 84 b8 01 00 00    	je     f01017ed <mon_prof+0x21b>
+	else if (argc >= 2 && strcmp(argv[1], "report") == 0)
+f0101635:	83 ec 08             	sub    $0x8,%esp
+f0101638:	8d 83 f9 4a ff ff    	lea    -0xb507(%ebx),%eax
+f010163e:	50                   	push   %eax
+f010163f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101642:	ff 70 04             	push   0x4(%eax)
+f0101645:	e8 ab 69 00 00       	call   f0107ff5 <strcmp>
+f010164a:	83 c4 10             	add    $0x10,%esp
+f010164d:	85 c0                	test   %eax,%eax
+f010164f:	75 9b                	jne    f01015ec <mon_prof+0x1a>
+		prof_report(argc > 2 ? strtol(argv[2], NULL, 0) : 20);
+f0101651:	b8 14 00 00 00       	mov    $0x14,%eax
+f0101656:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+f010165a:	0f 8f df 01 00 00    	jg     f010183f <mon_prof+0x26d>
+f0101660:	83 ec 0c             	sub    $0xc,%esp
+f0101663:	50                   	push   %eax
+f0101664:	e8 5c 44 00 00       	call   f0105ac5 <prof_report>
+f0101669:	83 c4 10             	add    $0x10,%esp
+f010166c:	eb 90                	jmp    f01015fe <mon_prof+0x2c>
+			else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+f010166e:	83 ec 08             	sub    $0x8,%esp
+f0101671:	ff 75 d8             	push   -0x28(%ebp)
+f0101674:	ff 36                	push   (%esi)
+f0101676:	e8 7a 69 00 00       	call   f0107ff5 <strcmp>
+f010167b:	83 c4 10             	add    $0x10,%esp
+f010167e:	85 c0                	test   %eax,%eax
+f0101680:	75 0b                	jne    f010168d <mon_prof+0xbb>
+f0101682:	8d 47 01             	lea    0x1(%edi),%eax
+f0101685:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0101688:	3b 45 08             	cmp    0x8(%ebp),%eax
+f010168b:	7c 4c                	jl     f01016d9 <mon_prof+0x107>
+				hz = period = strtol(argv[i], NULL, 0);
+f010168d:	83 ec 04             	sub    $0x4,%esp
+f0101690:	6a 00                	push   $0x0
+f0101692:	6a 00                	push   $0x0
+f0101694:	ff 36                	push   (%esi)
+f0101696:	e8 11 6c 00 00       	call   f01082ac <strtol>
+f010169b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010169e:	83 c4 10             	add    $0x10,%esp
+f01016a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (i = 2; i < argc; i++)
+f01016a4:	83 c7 01             	add    $0x1,%edi
+f01016a7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+f01016aa:	0f 8d 9a 00 00 00    	jge    f010174a <mon_prof+0x178>
+			if (strcmp(argv[i], "-g") == 0)
+f01016b0:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+f01016b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01016ba:	89 c6                	mov    %eax,%esi
+f01016bc:	03 75 0c             	add    0xc(%ebp),%esi
+f01016bf:	83 ec 08             	sub    $0x8,%esp
+f01016c2:	ff 75 e0             	push   -0x20(%ebp)
+f01016c5:	ff 36                	push   (%esi)
+f01016c7:	e8 29 69 00 00       	call   f0107ff5 <strcmp>
+f01016cc:	83 c4 10             	add    $0x10,%esp
+f01016cf:	85 c0                	test   %eax,%eax
+f01016d1:	75 9b                	jne    f010166e <mon_prof+0x9c>
+				callers = 1;
+f01016d3:	c6 45 df 01          	movb   $0x1,-0x21(%ebp)
+f01016d7:	eb cb                	jmp    f01016a4 <mon_prof+0xd2>
+				event = perf_event_byname(argv[++i]);
+f01016d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01016dc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01016df:	8d 74 08 04          	lea    0x4(%eax,%ecx,1),%esi
+f01016e3:	83 ec 0c             	sub    $0xc,%esp
+f01016e6:	ff 36                	push   (%esi)
+f01016e8:	e8 94 49 00 00       	call   f0106081 <perf_event_byname>
+f01016ed:	89 45 c8             	mov    %eax,-0x38(%ebp)
+				if (event < 0) {
+f01016f0:	83 c4 10             	add    $0x10,%esp
+f01016f3:	85 c0                	test   %eax,%eax
+f01016f5:	78 05                	js     f01016fc <mon_prof+0x12a>
+				event = perf_event_byname(argv[++i]);
+f01016f7:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f01016fa:	eb a8                	jmp    f01016a4 <mon_prof+0xd2>
+					cprintf("prof: unknown event '%s'\n", argv[i]);
+f01016fc:	83 ec 08             	sub    $0x8,%esp
+f01016ff:	ff 36                	push   (%esi)
+f0101701:	8d 83 da 4a ff ff    	lea    -0xb526(%ebx),%eax
+f0101707:	50                   	push   %eax
+f0101708:	e8 85 29 00 00       	call   f0104092 <cprintf>
+					return 0;
+f010170d:	83 c4 10             	add    $0x10,%esp
+f0101710:	e9 e9 fe ff ff       	jmp    f01015fe <mon_prof+0x2c>
+	int i, event = -1, hz = 1000, period = 1000000;
+f0101715:	c7 45 d0 40 42 0f 00 	movl   $0xf4240,-0x30(%ebp)
+f010171c:	c7 45 d4 e8 03 00 00 	movl   $0x3e8,-0x2c(%ebp)
+f0101723:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%ebp)
+		for (i = 2; i < argc; i++)
+f010172a:	bf 02 00 00 00       	mov    $0x2,%edi
+	bool callers = 0;
+f010172f:	c6 45 df 00          	movb   $0x0,-0x21(%ebp)
+			if (strcmp(argv[i], "-g") == 0)
+f0101733:	8d 83 d4 4a ff ff    	lea    -0xb52c(%ebx),%eax
+f0101739:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+f010173c:	8d 83 d7 4a ff ff    	lea    -0xb529(%ebx),%eax
+f0101742:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0101745:	e9 5d ff ff ff       	jmp    f01016a7 <mon_prof+0xd5>
+		if (event >= 0) {
+f010174a:	83 7d c8 00          	cmpl   $0x0,-0x38(%ebp)
+f010174e:	79 25                	jns    f0101775 <mon_prof+0x1a3>
+		if (hz < 20 || hz > 10000) {
+f0101750:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101753:	83 e8 14             	sub    $0x14,%eax
+f0101756:	3d fc 26 00 00       	cmp    $0x26fc,%eax
+f010175b:	77 79                	ja     f01017d6 <mon_prof+0x204>
+		prof_start(hz, callers);
+f010175d:	83 ec 08             	sub    $0x8,%esp
+f0101760:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+f0101764:	50                   	push   %eax
+f0101765:	ff 75 d4             	push   -0x2c(%ebp)
+f0101768:	e8 7a 42 00 00       	call   f01059e7 <prof_start>
+f010176d:	83 c4 10             	add    $0x10,%esp
+f0101770:	e9 89 fe ff ff       	jmp    f01015fe <mon_prof+0x2c>
+			if (period < 1000)
+f0101775:	81 7d d0 e7 03 00 00 	cmpl   $0x3e7,-0x30(%ebp)
+f010177c:	7f 17                	jg     f0101795 <mon_prof+0x1c3>
+				cprintf("prof: period must be at least 1000\n");
+f010177e:	83 ec 0c             	sub    $0xc,%esp
+f0101781:	8d 83 54 4d ff ff    	lea    -0xb2ac(%ebx),%eax
+f0101787:	50                   	push   %eax
+f0101788:	e8 05 29 00 00       	call   f0104092 <cprintf>
+f010178d:	83 c4 10             	add    $0x10,%esp
+f0101790:	e9 69 fe ff ff       	jmp    f01015fe <mon_prof+0x2c>
+			else if (prof_start_event(event, period, callers) < 0)
+f0101795:	83 ec 04             	sub    $0x4,%esp
+f0101798:	0f b6 45 df          	movzbl -0x21(%ebp),%eax
+f010179c:	50                   	push   %eax
+f010179d:	ff 75 d0             	push   -0x30(%ebp)
+f01017a0:	ff 75 c8             	push   -0x38(%ebp)
+f01017a3:	e8 a6 42 00 00       	call   f0105a4e <prof_start_event>
+f01017a8:	83 c4 10             	add    $0x10,%esp
+f01017ab:	85 c0                	test   %eax,%eax
+f01017ad:	0f 89 4b fe ff ff    	jns    f01015fe <mon_prof+0x2c>
+				cprintf("prof: can't sample %s on this CPU\n",
+f01017b3:	83 ec 0c             	sub    $0xc,%esp
+f01017b6:	ff 75 c8             	push   -0x38(%ebp)
+f01017b9:	e8 0d 49 00 00       	call   f01060cb <perf_event_name>
+f01017be:	83 c4 08             	add    $0x8,%esp
+f01017c1:	50                   	push   %eax
+f01017c2:	8d 83 78 4d ff ff    	lea    -0xb288(%ebx),%eax
+f01017c8:	50                   	push   %eax
+f01017c9:	e8 c4 28 00 00       	call   f0104092 <cprintf>
+f01017ce:	83 c4 10             	add    $0x10,%esp
+f01017d1:	e9 28 fe ff ff       	jmp    f01015fe <mon_prof+0x2c>
+			cprintf("prof: rate must be 20 to 10000 Hz\n");
+f01017d6:	83 ec 0c             	sub    $0xc,%esp
+f01017d9:	8d 83 9c 4d ff ff    	lea    -0xb264(%ebx),%eax
+f01017df:	50                   	push   %eax
+f01017e0:	e8 ad 28 00 00       	call   f0104092 <cprintf>
+			return 0;
+f01017e5:	83 c4 10             	add    $0x10,%esp
+f01017e8:	e9 11 fe ff ff       	jmp    f01015fe <mon_prof+0x2c>
+	} else if (argc == 2 && strcmp(argv[1], "stop") == 0)
+f01017ed:	83 ec 08             	sub    $0x8,%esp
+f01017f0:	8d 83 f4 4a ff ff    	lea    -0xb50c(%ebx),%eax
+f01017f6:	50                   	push   %eax
+f01017f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01017fa:	ff 70 04             	push   0x4(%eax)
+f01017fd:	e8 f3 67 00 00       	call   f0107ff5 <strcmp>
+f0101802:	83 c4 10             	add    $0x10,%esp
+f0101805:	85 c0                	test   %eax,%eax
+f0101807:	74 2c                	je     f0101835 <mon_prof+0x263>
+	else if (argc >= 2 && strcmp(argv[1], "report") == 0)
+f0101809:	83 ec 08             	sub    $0x8,%esp
+f010180c:	8d 83 f9 4a ff ff    	lea    -0xb507(%ebx),%eax
+f0101812:	50                   	push   %eax
+f0101813:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101816:	ff 70 04             	push   0x4(%eax)
+f0101819:	e8 d7 67 00 00       	call   f0107ff5 <strcmp>
+f010181e:	89 c2                	mov    %eax,%edx
+f0101820:	83 c4 10             	add    $0x10,%esp
+		prof_report(argc > 2 ? strtol(argv[2], NULL, 0) : 20);
+f0101823:	b8 14 00 00 00       	mov    $0x14,%eax
+	else if (argc >= 2 && strcmp(argv[1], "report") == 0)
+f0101828:	85 d2                	test   %edx,%edx
+f010182a:	0f 84 30 fe ff ff    	je     f0101660 <mon_prof+0x8e>
+f0101830:	e9 b7 fd ff ff       	jmp    f01015ec <mon_prof+0x1a>
+		prof_stop();
+f0101835:	e8 71 41 00 00       	call   f01059ab <prof_stop>
+f010183a:	e9 bf fd ff ff       	jmp    f01015fe <mon_prof+0x2c>
+		prof_report(argc > 2 ? strtol(argv[2], NULL, 0) : 20);
+f010183f:	83 ec 04             	sub    $0x4,%esp
+f0101842:	6a 00                	push   $0x0
+f0101844:	6a 00                	push   $0x0
+f0101846:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101849:	ff 70 08             	push   0x8(%eax)
+f010184c:	e8 5b 6a 00 00       	call   f01082ac <strtol>
+f0101851:	83 c4 10             	add    $0x10,%esp
+f0101854:	e9 07 fe ff ff       	jmp    f0101660 <mon_prof+0x8e>
+
+f0101859 <mon_perf>:
+{
+f0101859:	55                   	push   %ebp
+f010185a:	89 e5                	mov    %esp,%ebp
+f010185c:	57                   	push   %edi
+f010185d:	56                   	push   %esi
+f010185e:	53                   	push   %ebx
+f010185f:	83 ec 5c             	sub    $0x5c,%esp
+f0101862:	e8 e8 ea ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101867:	81 c3 25 3c 01 00    	add    $0x13c25,%ebx
+f010186d:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (argc == 1) {
+f0101870:	83 ff 01             	cmp    $0x1,%edi
+f0101873:	74 48                	je     f01018bd <mon_perf+0x64>
+	if (argc < 3 || strcmp(argv[1], "stat") != 0) {
+f0101875:	83 ff 02             	cmp    $0x2,%edi
+f0101878:	7e 1f                	jle    f0101899 <mon_perf+0x40>
+f010187a:	83 ec 08             	sub    $0x8,%esp
+f010187d:	8d 83 00 4b ff ff    	lea    -0xb500(%ebx),%eax
+f0101883:	50                   	push   %eax
+f0101884:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101887:	ff 70 04             	push   0x4(%eax)
+f010188a:	e8 66 67 00 00       	call   f0107ff5 <strcmp>
+f010188f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0101892:	83 c4 10             	add    $0x10,%esp
+f0101895:	85 c0                	test   %eax,%eax
+f0101897:	74 32                	je     f01018cb <mon_perf+0x72>
+		cprintf("usage: perf [stat command [args]]\n");
+f0101899:	83 ec 0c             	sub    $0xc,%esp
+f010189c:	8d 83 04 4e ff ff    	lea    -0xb1fc(%ebx),%eax
+f01018a2:	50                   	push   %eax
+f01018a3:	e8 ea 27 00 00       	call   f0104092 <cprintf>
+		return 0;
+f01018a8:	83 c4 10             	add    $0x10,%esp
+f01018ab:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+}
+f01018b2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f01018b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01018b8:	5b                   	pop    %ebx
+f01018b9:	5e                   	pop    %esi
+f01018ba:	5f                   	pop    %edi
+f01018bb:	5d                   	pop    %ebp
+f01018bc:	c3                   	ret
+		perf_print_info();
+f01018bd:	e8 22 48 00 00       	call   f01060e4 <perf_print_info>
+		return 0;
+f01018c2:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+f01018c9:	eb e7                	jmp    f01018b2 <mon_perf+0x59>
+	if (perf_stat_start() < 0) {
+f01018cb:	e8 ef 48 00 00       	call   f01061bf <perf_stat_start>
+f01018d0:	85 c0                	test   %eax,%eax
+f01018d2:	0f 88 8d 00 00 00    	js     f0101965 <mon_perf+0x10c>
+	r = runargs(argc - 2, argv + 2, tf);
+f01018d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01018db:	8d 50 08             	lea    0x8(%eax),%edx
+f01018de:	8d 47 fe             	lea    -0x2(%edi),%eax
+f01018e1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f01018e4:	e8 0f f9 ff ff       	call   f01011f8 <runargs>
+f01018e9:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	perf_stat_stop(&ps);
+f01018ec:	83 ec 0c             	sub    $0xc,%esp
+f01018ef:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+f01018f2:	50                   	push   %eax
+f01018f3:	e8 cf 4a 00 00       	call   f01063c7 <perf_stat_stop>
+	cprintf("Performance counter stats for '");
+f01018f8:	8d 83 48 4e ff ff    	lea    -0xb1b8(%ebx),%eax
+f01018fe:	89 04 24             	mov    %eax,(%esp)
+f0101901:	e8 8c 27 00 00       	call   f0104092 <cprintf>
+f0101906:	83 c4 10             	add    $0x10,%esp
+	for (i = 2; i < argc; i++)
+f0101909:	be 02 00 00 00       	mov    $0x2,%esi
+		cprintf(i > 2 ? " %s" : "%s", argv[i]);
+f010190e:	8d 83 f5 5d ff ff    	lea    -0xa20b(%ebx),%eax
+f0101914:	89 45 9c             	mov    %eax,-0x64(%ebp)
+f0101917:	8d 83 f6 5d ff ff    	lea    -0xa20a(%ebx),%eax
+f010191d:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0101920:	83 fe 03             	cmp    $0x3,%esi
+f0101923:	8b 45 9c             	mov    -0x64(%ebp),%eax
+f0101926:	0f 4c 45 a0          	cmovl  -0x60(%ebp),%eax
+f010192a:	83 ec 08             	sub    $0x8,%esp
+f010192d:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0101930:	ff 34 b2             	push   (%edx,%esi,4)
+f0101933:	50                   	push   %eax
+f0101934:	e8 59 27 00 00       	call   f0104092 <cprintf>
+	for (i = 2; i < argc; i++)
+f0101939:	83 c6 01             	add    $0x1,%esi
+f010193c:	83 c4 10             	add    $0x10,%esp
+f010193f:	39 f7                	cmp    %esi,%edi
+f0101941:	75 dd                	jne    f0101920 <mon_perf+0xc7>
+	cprintf("':\n");
+f0101943:	83 ec 0c             	sub    $0xc,%esp
+f0101946:	8d 83 05 4b ff ff    	lea    -0xb4fb(%ebx),%eax
+f010194c:	50                   	push   %eax
+f010194d:	e8 40 27 00 00       	call   f0104092 <cprintf>
+	perf_stat_print(&ps);
+f0101952:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+f0101955:	89 04 24             	mov    %eax,(%esp)
+f0101958:	e8 84 4b 00 00       	call   f01064e1 <perf_stat_print>
+	return r;
+f010195d:	83 c4 10             	add    $0x10,%esp
+f0101960:	e9 4d ff ff ff       	jmp    f01018b2 <mon_perf+0x59>
+		cprintf("perf: the counters are in use\n");
+f0101965:	83 ec 0c             	sub    $0xc,%esp
+f0101968:	8d 83 28 4e ff ff    	lea    -0xb1d8(%ebx),%eax
+f010196e:	50                   	push   %eax
+f010196f:	e8 1e 27 00 00       	call   f0104092 <cprintf>
+		return 0;
+f0101974:	83 c4 10             	add    $0x10,%esp
+f0101977:	e9 36 ff ff ff       	jmp    f01018b2 <mon_perf+0x59>
+
+f010197c <mon_meminfo>:
+{
+f010197c:	55                   	push   %ebp
+f010197d:	89 e5                	mov    %esp,%ebp
+f010197f:	53                   	push   %ebx
+f0101980:	83 ec 04             	sub    $0x4,%esp
+f0101983:	e8 c7 e9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101988:	81 c3 04 3b 01 00    	add    $0x13b04,%ebx
+	page_print_stats();
+f010198e:	e8 e0 13 00 00       	call   f0102d73 <page_print_stats>
+	kmem_print_stats();
+f0101993:	e8 de 1d 00 00       	call   f0103776 <kmem_print_stats>
+}
+f0101998:	b8 00 00 00 00       	mov    $0x0,%eax
+f010199d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01019a0:	c9                   	leave
+f01019a1:	c3                   	ret
+
+f01019a2 <mon_bench>:
+{
+f01019a2:	55                   	push   %ebp
+f01019a3:	89 e5                	mov    %esp,%ebp
+f01019a5:	53                   	push   %ebx
+f01019a6:	83 ec 04             	sub    $0x4,%esp
+f01019a9:	e8 a1 e9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01019ae:	81 c3 de 3a 01 00    	add    $0x13ade,%ebx
+	bench_run(argc > 1 ? argv[1] : NULL);
+f01019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+f01019b9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+f01019bd:	7e 06                	jle    f01019c5 <mon_bench+0x23>
+f01019bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01019c2:	8b 40 04             	mov    0x4(%eax),%eax
+f01019c5:	83 ec 0c             	sub    $0xc,%esp
+f01019c8:	50                   	push   %eax
+f01019c9:	e8 d2 50 00 00       	call   f0106aa0 <bench_run>
+}
+f01019ce:	b8 00 00 00 00       	mov    $0x0,%eax
+f01019d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01019d6:	c9                   	leave
+f01019d7:	c3                   	ret
+
+f01019d8 <mon_boottime>:
+{
+f01019d8:	55                   	push   %ebp
+f01019d9:	89 e5                	mov    %esp,%ebp
+f01019db:	53                   	push   %ebx
+f01019dc:	83 ec 04             	sub    $0x4,%esp
+f01019df:	e8 6b e9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01019e4:	81 c3 a8 3a 01 00    	add    $0x13aa8,%ebx
+	boottime_print();
+f01019ea:	e8 05 58 00 00       	call   f01071f4 <boottime_print>
+}
+f01019ef:	b8 00 00 00 00       	mov    $0x0,%eax
+f01019f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01019f7:	c9                   	leave
+f01019f8:	c3                   	ret
+
+f01019f9 <monitor>:
+
+void
+monitor(struct Trapframe *tf)
+{
+f01019f9:	55                   	push   %ebp
+f01019fa:	89 e5                	mov    %esp,%ebp
+f01019fc:	57                   	push   %edi
+f01019fd:	56                   	push   %esi
+f01019fe:	53                   	push   %ebx
+f01019ff:	83 ec 68             	sub    $0x68,%esp
+f0101a02:	e8 48 e9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101a07:	81 c3 85 3a 01 00    	add    $0x13a85,%ebx
+	char *buf;
+
+	cprintf("Welcome to the JOS kernel monitor!\n");
+f0101a0d:	8d 83 68 4e ff ff    	lea    -0xb198(%ebx),%eax
+f0101a13:	50                   	push   %eax
+f0101a14:	e8 79 26 00 00       	call   f0104092 <cprintf>
+	cprintf("Type 'help' for a list of commands.\n");
+f0101a19:	8d 83 8c 4e ff ff    	lea    -0xb174(%ebx),%eax
+f0101a1f:	89 04 24             	mov    %eax,(%esp)
+f0101a22:	e8 6b 26 00 00       	call   f0104092 <cprintf>
+	// int x = 1, y = 3, z = 4;
+	// cprintf("x %d, y %x, z %d\n", x, y, z);
+	// unsigned int i = 0x00646c72;
+    // cprintf("H%x Wo%s", 57616, &i);
+	// cprintf("x=%d y=%d", 3);
+	cprintf("%m%s\n%m%s\n%m%s\n", 0x0100, "blue", 0x0200, "green", 0x0400, "red");
+f0101a27:	83 c4 0c             	add    $0xc,%esp
+f0101a2a:	8d 83 69 60 ff ff    	lea    -0x9f97(%ebx),%eax
+f0101a30:	50                   	push   %eax
+f0101a31:	68 00 04 00 00       	push   $0x400
+f0101a36:	8d 83 09 4b ff ff    	lea    -0xb4f7(%ebx),%eax
+f0101a3c:	50                   	push   %eax
+f0101a3d:	68 00 02 00 00       	push   $0x200
+f0101a42:	8d 83 0f 4b ff ff    	lea    -0xb4f1(%ebx),%eax
+f0101a48:	50                   	push   %eax
+f0101a49:	68 00 01 00 00       	push   $0x100
+f0101a4e:	8d 83 14 4b ff ff    	lea    -0xb4ec(%ebx),%eax
+f0101a54:	50                   	push   %eax
+f0101a55:	e8 38 26 00 00       	call   f0104092 <cprintf>
+
+	if (!boot_tsc[BT_MONITOR])
+f0101a5a:	c7 c0 60 54 11 f0    	mov    $0xf0115460,%eax
+f0101a60:	83 c4 20             	add    $0x20,%esp
+f0101a63:	8b 50 20             	mov    0x20(%eax),%edx
+f0101a66:	8b 40 24             	mov    0x24(%eax),%eax
+f0101a69:	09 d0                	or     %edx,%eax
+f0101a6b:	75 0e                	jne    f0101a7b <monitor+0x82>
+	asm volatile("rdtsc" : "=A" (tsc));
+f0101a6d:	0f 31                	rdtsc
+		boot_stamp(BT_MONITOR);
+f0101a6f:	c7 c1 60 54 11 f0    	mov    $0xf0115460,%ecx
+f0101a75:	89 41 20             	mov    %eax,0x20(%ecx)
+f0101a78:	89 51 24             	mov    %edx,0x24(%ecx)
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101a7b:	8d bb 28 4b ff ff    	lea    -0xb4d8(%ebx),%edi
+f0101a81:	eb 4a                	jmp    f0101acd <monitor+0xd4>
+f0101a83:	83 ec 08             	sub    $0x8,%esp
+f0101a86:	0f be c0             	movsbl %al,%eax
+f0101a89:	50                   	push   %eax
+f0101a8a:	57                   	push   %edi
+f0101a8b:	e8 c6 65 00 00       	call   f0108056 <strchr>
+f0101a90:	83 c4 10             	add    $0x10,%esp
+f0101a93:	85 c0                	test   %eax,%eax
+f0101a95:	74 08                	je     f0101a9f <monitor+0xa6>
+			*buf++ = 0;
+f0101a97:	c6 06 00             	movb   $0x0,(%esi)
+f0101a9a:	8d 76 01             	lea    0x1(%esi),%esi
+f0101a9d:	eb 79                	jmp    f0101b18 <monitor+0x11f>
+		if (*buf == 0)
+f0101a9f:	80 3e 00             	cmpb   $0x0,(%esi)
+f0101aa2:	74 7f                	je     f0101b23 <monitor+0x12a>
+		if (argc == MAXARGS-1) {
+f0101aa4:	83 7d a4 0f          	cmpl   $0xf,-0x5c(%ebp)
+f0101aa8:	74 0f                	je     f0101ab9 <monitor+0xc0>
+		argv[argc++] = buf;
+f0101aaa:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0101aad:	8d 48 01             	lea    0x1(%eax),%ecx
+f0101ab0:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+f0101ab3:	89 74 85 a8          	mov    %esi,-0x58(%ebp,%eax,4)
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0101ab7:	eb 44                	jmp    f0101afd <monitor+0x104>
+			cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0101ab9:	83 ec 08             	sub    $0x8,%esp
+f0101abc:	6a 10                	push   $0x10
+f0101abe:	8d 83 2d 4b ff ff    	lea    -0xb4d3(%ebx),%eax
+f0101ac4:	50                   	push   %eax
+f0101ac5:	e8 c8 25 00 00       	call   f0104092 <cprintf>
+f0101aca:	83 c4 10             	add    $0x10,%esp
+	while (1) {
+		buf = readline("K> ");
+f0101acd:	8d 83 24 4b ff ff    	lea    -0xb4dc(%ebx),%eax
+f0101ad3:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0101ad6:	83 ec 0c             	sub    $0xc,%esp
+f0101ad9:	ff 75 a4             	push   -0x5c(%ebp)
+f0101adc:	e8 be 62 00 00       	call   f0107d9f <readline>
+f0101ae1:	89 c6                	mov    %eax,%esi
+		if (buf != NULL)
+f0101ae3:	83 c4 10             	add    $0x10,%esp
+f0101ae6:	85 c0                	test   %eax,%eax
+f0101ae8:	74 ec                	je     f0101ad6 <monitor+0xdd>
+	argv[argc] = 0;
+f0101aea:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+	argc = 0;
+f0101af1:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+f0101af8:	eb 1e                	jmp    f0101b18 <monitor+0x11f>
+			buf++;
+f0101afa:	83 c6 01             	add    $0x1,%esi
+		while (*buf && !strchr(WHITESPACE, *buf))
+f0101afd:	0f b6 06             	movzbl (%esi),%eax
+f0101b00:	84 c0                	test   %al,%al
+f0101b02:	74 14                	je     f0101b18 <monitor+0x11f>
+f0101b04:	83 ec 08             	sub    $0x8,%esp
+f0101b07:	0f be c0             	movsbl %al,%eax
+f0101b0a:	50                   	push   %eax
+f0101b0b:	57                   	push   %edi
+f0101b0c:	e8 45 65 00 00       	call   f0108056 <strchr>
+f0101b11:	83 c4 10             	add    $0x10,%esp
+f0101b14:	85 c0                	test   %eax,%eax
+f0101b16:	74 e2                	je     f0101afa <monitor+0x101>
+		while (*buf && strchr(WHITESPACE, *buf))
+f0101b18:	0f b6 06             	movzbl (%esi),%eax
+f0101b1b:	84 c0                	test   %al,%al
+f0101b1d:	0f 85 60 ff ff ff    	jne    f0101a83 <monitor+0x8a>
+	argv[argc] = 0;
+f0101b23:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0101b26:	c7 44 85 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%eax,4)
+f0101b2d:	00 
+	return runargs(argc, argv, tf);
+f0101b2e:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0101b31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0101b34:	e8 bf f6 ff ff       	call   f01011f8 <runargs>
+			if (runcmd(buf, tf) < 0)
+f0101b39:	85 c0                	test   %eax,%eax
+f0101b3b:	79 90                	jns    f0101acd <monitor+0xd4>
+				break;
+	}
+}
+f0101b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101b40:	5b                   	pop    %ebx
+f0101b41:	5e                   	pop    %esi
+f0101b42:	5f                   	pop    %edi
+f0101b43:	5d                   	pop    %ebp
+f0101b44:	c3                   	ret
+
+f0101b45 <buddy_insert>:
+	write_eflags(eflags);
+}
+
+static void
+buddy_insert(struct PageInfo *pp, int order)
+{
+f0101b45:	55                   	push   %ebp
+f0101b46:	89 e5                	mov    %esp,%ebp
+f0101b48:	53                   	push   %ebx
+f0101b49:	e8 98 f4 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0101b4e:	81 c1 3e 39 01 00    	add    $0x1393e,%ecx
+	struct Freearea *fa = &free_area[order];
+
+	pp->pp_order = order;
+f0101b54:	88 50 0a             	mov    %dl,0xa(%eax)
+	pp->pp_flags = PP_FREE;
+f0101b57:	c6 40 0b 01          	movb   $0x1,0xb(%eax)
+	pp->pp_prev = NULL;
+f0101b5b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+	pp->pp_link = fa->fa_head;
+f0101b62:	89 d3                	mov    %edx,%ebx
+f0101b64:	c1 e3 04             	shl    $0x4,%ebx
+f0101b67:	8b 9c 19 d4 c6 00 00 	mov    0xc6d4(%ecx,%ebx,1),%ebx
+f0101b6e:	89 18                	mov    %ebx,(%eax)
+	if (fa->fa_head)
+f0101b70:	85 db                	test   %ebx,%ebx
+f0101b72:	74 03                	je     f0101b77 <buddy_insert+0x32>
+		fa->fa_head->pp_prev = pp;
+f0101b74:	89 43 04             	mov    %eax,0x4(%ebx)
+	fa->fa_head = pp;
+f0101b77:	c1 e2 04             	shl    $0x4,%edx
+f0101b7a:	89 84 11 d4 c6 00 00 	mov    %eax,0xc6d4(%ecx,%edx,1)
+	fa->fa_nblocks++;
+f0101b81:	83 84 11 d8 c6 00 00 	addl   $0x1,0xc6d8(%ecx,%edx,1)
+f0101b88:	01 
+}
+f0101b89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101b8c:	c9                   	leave
+f0101b8d:	c3                   	ret
+
+f0101b8e <buddy_remove>:
+
+static void
+buddy_remove(struct PageInfo *pp)
+{
+f0101b8e:	55                   	push   %ebp
+f0101b8f:	89 e5                	mov    %esp,%ebp
+f0101b91:	56                   	push   %esi
+f0101b92:	53                   	push   %ebx
+f0101b93:	e8 4e f4 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0101b98:	81 c1 f4 38 01 00    	add    $0x138f4,%ecx
+	struct Freearea *fa = &free_area[pp->pp_order];
+f0101b9e:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+
+	if (pp->pp_prev)
+f0101ba2:	8b 58 04             	mov    0x4(%eax),%ebx
+f0101ba5:	85 db                	test   %ebx,%ebx
+f0101ba7:	74 32                	je     f0101bdb <buddy_remove+0x4d>
+		pp->pp_prev->pp_link = pp->pp_link;
+f0101ba9:	8b 30                	mov    (%eax),%esi
+f0101bab:	89 33                	mov    %esi,(%ebx)
+	else
+		fa->fa_head = pp->pp_link;
+	if (pp->pp_link)
+f0101bad:	8b 18                	mov    (%eax),%ebx
+f0101baf:	85 db                	test   %ebx,%ebx
+f0101bb1:	74 06                	je     f0101bb9 <buddy_remove+0x2b>
+		pp->pp_link->pp_prev = pp->pp_prev;
+f0101bb3:	8b 70 04             	mov    0x4(%eax),%esi
+f0101bb6:	89 73 04             	mov    %esi,0x4(%ebx)
+	pp->pp_link = pp->pp_prev = NULL;
+f0101bb9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+f0101bc0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	pp->pp_flags = 0;
+f0101bc6:	c6 40 0b 00          	movb   $0x0,0xb(%eax)
+	fa->fa_nblocks--;
+f0101bca:	89 d0                	mov    %edx,%eax
+f0101bcc:	c1 e0 04             	shl    $0x4,%eax
+f0101bcf:	83 ac 01 d8 c6 00 00 	subl   $0x1,0xc6d8(%ecx,%eax,1)
+f0101bd6:	01 
+}
+f0101bd7:	5b                   	pop    %ebx
+f0101bd8:	5e                   	pop    %esi
+f0101bd9:	5d                   	pop    %ebp
+f0101bda:	c3                   	ret
+		fa->fa_head = pp->pp_link;
+f0101bdb:	89 d3                	mov    %edx,%ebx
+f0101bdd:	c1 e3 04             	shl    $0x4,%ebx
+f0101be0:	8b 30                	mov    (%eax),%esi
+f0101be2:	89 b4 19 d4 c6 00 00 	mov    %esi,0xc6d4(%ecx,%ebx,1)
+f0101be9:	eb c2                	jmp    f0101bad <buddy_remove+0x1f>
+
+f0101beb <buddy_alloc>:
+// Take a block of 2^order pages off the free lists, splitting the
+// smallest larger block if there is none of that size.
+// Call with the buddy lock held.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+f0101beb:	55                   	push   %ebp
+f0101bec:	89 e5                	mov    %esp,%ebp
+f0101bee:	57                   	push   %edi
+f0101bef:	56                   	push   %esi
+f0101bf0:	53                   	push   %ebx
+f0101bf1:	83 ec 1c             	sub    $0x1c,%esp
+f0101bf4:	e8 f1 f3 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f0101bf9:	81 c6 93 38 01 00    	add    $0x13893,%esi
+f0101bff:	89 c7                	mov    %eax,%edi
+	struct PageInfo *pp;
+	int o;
+
+	for (o = order; o <= MAX_ORDER && !free_area[o].fa_head; o++)
+f0101c01:	89 c3                	mov    %eax,%ebx
+f0101c03:	eb 03                	jmp    f0101c08 <buddy_alloc+0x1d>
+f0101c05:	83 c3 01             	add    $0x1,%ebx
+f0101c08:	83 fb 0a             	cmp    $0xa,%ebx
+f0101c0b:	7f 66                	jg     f0101c73 <buddy_alloc+0x88>
+f0101c0d:	89 d8                	mov    %ebx,%eax
+f0101c0f:	c1 e0 04             	shl    $0x4,%eax
+f0101c12:	83 bc 30 d4 c6 00 00 	cmpl   $0x0,0xc6d4(%eax,%esi,1)
+f0101c19:	00 
+f0101c1a:	74 e9                	je     f0101c05 <buddy_alloc+0x1a>
+	if (o > MAX_ORDER) {
+		buddy_nfail++;
+		return NULL;
+	}
+
+	pp = free_area[o].fa_head;
+f0101c1c:	89 d8                	mov    %ebx,%eax
+f0101c1e:	c1 e0 04             	shl    $0x4,%eax
+f0101c21:	8b 84 06 d4 c6 00 00 	mov    0xc6d4(%esi,%eax,1),%eax
+f0101c28:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	buddy_remove(pp);
+f0101c2b:	e8 5e ff ff ff       	call   f0101b8e <buddy_remove>
+	// Give back the upper half until the block is the right size.
+	while (o > order) {
+f0101c30:	39 fb                	cmp    %edi,%ebx
+f0101c32:	7e 21                	jle    f0101c55 <buddy_alloc+0x6a>
+		o--;
+f0101c34:	83 eb 01             	sub    $0x1,%ebx
+		buddy_insert(pp + (1 << o), o);
+f0101c37:	b8 0c 00 00 00       	mov    $0xc,%eax
+f0101c3c:	89 d9                	mov    %ebx,%ecx
+f0101c3e:	d3 e0                	shl    %cl,%eax
+f0101c40:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101c43:	01 d0                	add    %edx,%eax
+f0101c45:	89 da                	mov    %ebx,%edx
+f0101c47:	e8 f9 fe ff ff       	call   f0101b45 <buddy_insert>
+		buddy_nsplit++;
+f0101c4c:	83 86 bc c6 00 00 01 	addl   $0x1,0xc6bc(%esi)
+f0101c53:	eb db                	jmp    f0101c30 <buddy_alloc+0x45>
+	}
+	pp->pp_order = order;
+f0101c55:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0101c58:	89 f8                	mov    %edi,%eax
+f0101c5a:	88 41 0a             	mov    %al,0xa(%ecx)
+	free_area[order].fa_nalloc++;
+f0101c5d:	c1 e7 04             	shl    $0x4,%edi
+f0101c60:	83 84 3e dc c6 00 00 	addl   $0x1,0xc6dc(%esi,%edi,1)
+f0101c67:	01 
+	return pp;
+}
+f0101c68:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101c6b:	83 c4 1c             	add    $0x1c,%esp
+f0101c6e:	5b                   	pop    %ebx
+f0101c6f:	5e                   	pop    %esi
+f0101c70:	5f                   	pop    %edi
+f0101c71:	5d                   	pop    %ebp
+f0101c72:	c3                   	ret
+		buddy_nfail++;
+f0101c73:	83 86 b4 c6 00 00 01 	addl   $0x1,0xc6b4(%esi)
+		return NULL;
+f0101c7a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0101c81:	eb e5                	jmp    f0101c68 <buddy_alloc+0x7d>
+
+f0101c83 <buddy_free>:
+// Return a block of 2^order pages to the free lists, merging it with
+// its buddy for as long as the buddy is free too.
+// Call with the buddy lock held.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+f0101c83:	55                   	push   %ebp
+f0101c84:	89 e5                	mov    %esp,%ebp
+f0101c86:	57                   	push   %edi
+f0101c87:	56                   	push   %esi
+f0101c88:	53                   	push   %ebx
+f0101c89:	83 ec 1c             	sub    $0x1c,%esp
+f0101c8c:	e8 55 f3 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0101c91:	81 c1 fb 37 01 00    	add    $0x137fb,%ecx
+f0101c97:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f0101c9a:	89 d6                	mov    %edx,%esi
+	struct PageInfo *buddy;
+	size_t pfn = pp - pages, bfn;
+f0101c9c:	c7 c2 14 43 15 f0    	mov    $0xf0154314,%edx
+f0101ca2:	2b 02                	sub    (%edx),%eax
+f0101ca4:	c1 f8 02             	sar    $0x2,%eax
+f0101ca7:	69 f8 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%edi
+
+	free_area[order].fa_nfree++;
+f0101cad:	89 f0                	mov    %esi,%eax
+f0101caf:	c1 e0 04             	shl    $0x4,%eax
+f0101cb2:	83 84 01 e0 c6 00 00 	addl   $0x1,0xc6e0(%ecx,%eax,1)
+f0101cb9:	01 
+	for (; order < MAX_ORDER; order++) {
+		bfn = pfn ^ (1 << order);
+		if (bfn + (1 << order) > npages)
+f0101cba:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0101cc0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+			break;
+		buddy = &pages[bfn];
+f0101cc3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	for (; order < MAX_ORDER; order++) {
+f0101cc6:	83 fe 09             	cmp    $0x9,%esi
+f0101cc9:	7f 48                	jg     f0101d13 <buddy_free+0x90>
+		bfn = pfn ^ (1 << order);
+f0101ccb:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0101cd0:	89 f1                	mov    %esi,%ecx
+f0101cd2:	d3 e3                	shl    %cl,%ebx
+f0101cd4:	89 d8                	mov    %ebx,%eax
+f0101cd6:	31 f8                	xor    %edi,%eax
+		if (bfn + (1 << order) > npages)
+f0101cd8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+f0101cdb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0101cde:	39 11                	cmp    %edx,(%ecx)
+f0101ce0:	72 31                	jb     f0101d13 <buddy_free+0x90>
+		buddy = &pages[bfn];
+f0101ce2:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0101ce5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101ce8:	8b 00                	mov    (%eax),%eax
+f0101cea:	8d 04 90             	lea    (%eax,%edx,4),%eax
+		if (!(buddy->pp_flags & PP_FREE) || buddy->pp_order != order)
+f0101ced:	f6 40 0b 01          	testb  $0x1,0xb(%eax)
+f0101cf1:	74 20                	je     f0101d13 <buddy_free+0x90>
+f0101cf3:	0f b6 50 0a          	movzbl 0xa(%eax),%edx
+f0101cf7:	39 f2                	cmp    %esi,%edx
+f0101cf9:	75 18                	jne    f0101d13 <buddy_free+0x90>
+			break;
+		buddy_remove(buddy);
+f0101cfb:	e8 8e fe ff ff       	call   f0101b8e <buddy_remove>
+		pfn &= ~(1 << order);
+f0101d00:	f7 d3                	not    %ebx
+f0101d02:	21 df                	and    %ebx,%edi
+		buddy_nmerge++;
+f0101d04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101d07:	83 80 b8 c6 00 00 01 	addl   $0x1,0xc6b8(%eax)
+	for (; order < MAX_ORDER; order++) {
+f0101d0e:	83 c6 01             	add    $0x1,%esi
+f0101d11:	eb b3                	jmp    f0101cc6 <buddy_free+0x43>
+	}
+	buddy_insert(&pages[pfn], order);
+f0101d13:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f0101d16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101d19:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0101d1f:	8b 00                	mov    (%eax),%eax
+f0101d21:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0101d24:	89 f2                	mov    %esi,%edx
+f0101d26:	e8 1a fe ff ff       	call   f0101b45 <buddy_insert>
+}
+f0101d2b:	83 c4 1c             	add    $0x1c,%esp
+f0101d2e:	5b                   	pop    %ebx
+f0101d2f:	5e                   	pop    %esi
+f0101d30:	5f                   	pop    %edi
+f0101d31:	5d                   	pop    %ebp
+f0101d32:	c3                   	ret
+
+f0101d33 <page_nfree>:
+}
+
+// Count the free pages, wherever they are kept.
+static size_t
+page_nfree(void)
+{
+f0101d33:	55                   	push   %ebp
+f0101d34:	89 e5                	mov    %esp,%ebp
+f0101d36:	56                   	push   %esi
+f0101d37:	53                   	push   %ebx
+f0101d38:	e8 ad f2 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f0101d3d:	81 c6 4f 37 01 00    	add    $0x1374f,%esi
+f0101d43:	8d 9e d8 c6 00 00    	lea    0xc6d8(%esi),%ebx
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i <= MAX_ORDER; i++)
+f0101d49:	b9 00 00 00 00       	mov    $0x0,%ecx
+	size_t n = 0;
+f0101d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+		n += free_area[i].fa_nblocks << i;
+f0101d53:	8b 03                	mov    (%ebx),%eax
+f0101d55:	d3 e0                	shl    %cl,%eax
+f0101d57:	01 c2                	add    %eax,%edx
+	for (i = 0; i <= MAX_ORDER; i++)
+f0101d59:	83 c1 01             	add    $0x1,%ecx
+f0101d5c:	83 c3 10             	add    $0x10,%ebx
+f0101d5f:	83 f9 0b             	cmp    $0xb,%ecx
+f0101d62:	75 ef                	jne    f0101d53 <page_nfree+0x20>
+f0101d64:	8d 86 14 c2 00 00    	lea    0xc214(%esi),%eax
+f0101d6a:	8d 88 a0 04 00 00    	lea    0x4a0(%eax),%ecx
+f0101d70:	eb 07                	jmp    f0101d79 <page_nfree+0x46>
+	for (i = 0; i < NCPU; i++)
+		n += mags[i].pm_count;
+f0101d72:	03 10                	add    (%eax),%edx
+f0101d74:	05 94 00 00 00       	add    $0x94,%eax
+	for (i = 0; i < NCPU; i++)
+f0101d79:	39 c8                	cmp    %ecx,%eax
+f0101d7b:	75 f5                	jne    f0101d72 <page_nfree+0x3f>
+	return n;
+}
+f0101d7d:	89 d0                	mov    %edx,%eax
+f0101d7f:	5b                   	pop    %ebx
+f0101d80:	5e                   	pop    %esi
+f0101d81:	5d                   	pop    %ebp
+f0101d82:	c3                   	ret
+
+f0101d83 <nvram_read>:
+{
+f0101d83:	55                   	push   %ebp
+f0101d84:	89 e5                	mov    %esp,%ebp
+f0101d86:	57                   	push   %edi
+f0101d87:	56                   	push   %esi
+f0101d88:	53                   	push   %ebx
+f0101d89:	83 ec 18             	sub    $0x18,%esp
+f0101d8c:	e8 be e5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101d91:	81 c3 fb 36 01 00    	add    $0x136fb,%ebx
+f0101d97:	89 c6                	mov    %eax,%esi
+	return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101d99:	50                   	push   %eax
+f0101d9a:	e8 63 20 00 00       	call   f0103e02 <mc146818_read>
+f0101d9f:	89 c7                	mov    %eax,%edi
+f0101da1:	83 c6 01             	add    $0x1,%esi
+f0101da4:	89 34 24             	mov    %esi,(%esp)
+f0101da7:	e8 56 20 00 00       	call   f0103e02 <mc146818_read>
+f0101dac:	c1 e0 08             	shl    $0x8,%eax
+f0101daf:	09 f8                	or     %edi,%eax
+}
+f0101db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101db4:	5b                   	pop    %ebx
+f0101db5:	5e                   	pop    %esi
+f0101db6:	5f                   	pop    %edi
+f0101db7:	5d                   	pop    %ebp
+f0101db8:	c3                   	ret
+
+f0101db9 <boot_alloc>:
+{
+f0101db9:	55                   	push   %ebp
+f0101dba:	89 e5                	mov    %esp,%ebp
+f0101dbc:	53                   	push   %ebx
+f0101dbd:	83 ec 04             	sub    $0x4,%esp
+f0101dc0:	e8 1d f2 ff ff       	call   f0100fe2 <__x86.get_pc_thunk.dx>
+f0101dc5:	81 c2 c7 36 01 00    	add    $0x136c7,%edx
+	if (!nextfree) {
+f0101dcb:	83 ba f4 c1 00 00 00 	cmpl   $0x0,0xc1f4(%edx)
+f0101dd2:	74 33                	je     f0101e07 <boot_alloc+0x4e>
+	result = nextfree;
+f0101dd4:	8b 9a f4 c1 00 00    	mov    0xc1f4(%edx),%ebx
+	nextfree = ROUNDUP(nextfree + n, PGSIZE);
+f0101dda:	8d 84 03 ff 0f 00 00 	lea    0xfff(%ebx,%eax,1),%eax
+f0101de1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101de6:	89 82 f4 c1 00 00    	mov    %eax,0xc1f4(%edx)
+	if ((uintptr_t) nextfree - KERNBASE > npages * PGSIZE)
+f0101dec:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101df1:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f0101df7:	8b 09                	mov    (%ecx),%ecx
+f0101df9:	c1 e1 0c             	shl    $0xc,%ecx
+f0101dfc:	39 c1                	cmp    %eax,%ecx
+f0101dfe:	72 21                	jb     f0101e21 <boot_alloc+0x68>
+}
+f0101e00:	89 d8                	mov    %ebx,%eax
+f0101e02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101e05:	c9                   	leave
+f0101e06:	c3                   	ret
+		nextfree = ROUNDUP((char *) end, PGSIZE);
+f0101e07:	c7 c1 00 43 15 f0    	mov    $0xf0154300,%ecx
+f0101e0d:	81 c1 ff 0f 00 00    	add    $0xfff,%ecx
+f0101e13:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0101e19:	89 8a f4 c1 00 00    	mov    %ecx,0xc1f4(%edx)
+f0101e1f:	eb b3                	jmp    f0101dd4 <boot_alloc+0x1b>
+		panic("boot_alloc: out of memory");
+f0101e21:	83 ec 04             	sub    $0x4,%esp
+f0101e24:	8d 82 06 51 ff ff    	lea    -0xaefa(%edx),%eax
+f0101e2a:	50                   	push   %eax
+f0101e2b:	68 88 00 00 00       	push   $0x88
+f0101e30:	8d 82 20 51 ff ff    	lea    -0xaee0(%edx),%eax
+f0101e36:	50                   	push   %eax
+f0101e37:	89 d3                	mov    %edx,%ebx
+f0101e39:	e8 ba e2 ff ff       	call   f01000f8 <_panic>
+
+f0101e3e <buddy_lock>:
+{
+f0101e3e:	55                   	push   %ebp
+f0101e3f:	89 e5                	mov    %esp,%ebp
+f0101e41:	56                   	push   %esi
+f0101e42:	53                   	push   %ebx
+f0101e43:	e8 07 e5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101e48:	81 c3 44 36 01 00    	add    $0x13644,%ebx
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0101e4e:	9c                   	pushf
+f0101e4f:	5e                   	pop    %esi
+	asm volatile("cli");
+f0101e50:	fa                   	cli
+	spin_lock(&buddy_spinlock);
+f0101e51:	83 ec 0c             	sub    $0xc,%esp
+f0101e54:	8d 83 b4 04 00 00    	lea    0x4b4(%ebx),%eax
+f0101e5a:	50                   	push   %eax
+f0101e5b:	e8 6e 6d 00 00       	call   f0108bce <spin_lock>
+}
+f0101e60:	89 f0                	mov    %esi,%eax
+f0101e62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101e65:	5b                   	pop    %ebx
+f0101e66:	5e                   	pop    %esi
+f0101e67:	5d                   	pop    %ebp
+f0101e68:	c3                   	ret
+
+f0101e69 <buddy_unlock>:
+{
+f0101e69:	55                   	push   %ebp
+f0101e6a:	89 e5                	mov    %esp,%ebp
+f0101e6c:	56                   	push   %esi
+f0101e6d:	53                   	push   %ebx
+f0101e6e:	e8 dc e4 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0101e73:	81 c3 19 36 01 00    	add    $0x13619,%ebx
+f0101e79:	89 c6                	mov    %eax,%esi
+	spin_unlock(&buddy_spinlock);
+f0101e7b:	83 ec 0c             	sub    $0xc,%esp
+f0101e7e:	8d 83 b4 04 00 00    	lea    0x4b4(%ebx),%eax
+f0101e84:	50                   	push   %eax
+f0101e85:	e8 f4 6d 00 00       	call   f0108c7e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0101e8a:	56                   	push   %esi
+f0101e8b:	9d                   	popf
+}
+f0101e8c:	83 c4 10             	add    $0x10,%esp
+f0101e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0101e92:	5b                   	pop    %ebx
+f0101e93:	5e                   	pop    %esi
+f0101e94:	5d                   	pop    %ebp
+f0101e95:	c3                   	ret
+
+f0101e96 <page_init>:
+{
+f0101e96:	55                   	push   %ebp
+f0101e97:	89 e5                	mov    %esp,%ebp
+f0101e99:	57                   	push   %edi
+f0101e9a:	56                   	push   %esi
+f0101e9b:	53                   	push   %ebx
+f0101e9c:	83 ec 1c             	sub    $0x1c,%esp
+f0101e9f:	e8 3a f1 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0101ea4:	05 e8 35 01 00       	add    $0x135e8,%eax
+f0101ea9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	physaddr_t pa, kend = PADDR(boot_alloc(0));
+f0101eac:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101eb1:	e8 03 ff ff ff       	call   f0101db9 <boot_alloc>
+	if ((uint32_t)kva < KERNBASE)
+f0101eb6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101ebb:	76 2e                	jbe    f0101eeb <page_init+0x55>
+	return (physaddr_t)kva - KERNBASE;
+f0101ebd:	05 00 00 00 10       	add    $0x10000000,%eax
+f0101ec2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	eflags = buddy_lock();
+f0101ec5:	e8 74 ff ff ff       	call   f0101e3e <buddy_lock>
+f0101eca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (i = 0; i < npages; i++) {
+f0101ecd:	be 00 00 00 00       	mov    $0x0,%esi
+f0101ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101ed7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101eda:	c7 c7 0c 43 15 f0    	mov    $0xf015430c,%edi
+f0101ee0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+			pages[i].pp_ref = 1;
+f0101ee3:	c7 c7 14 43 15 f0    	mov    $0xf0154314,%edi
+	for (i = 0; i < npages; i++) {
+f0101ee9:	eb 2b                	jmp    f0101f16 <page_init+0x80>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101eeb:	50                   	push   %eax
+f0101eec:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0101eef:	8d 83 e8 52 ff ff    	lea    -0xad18(%ebx),%eax
+f0101ef5:	50                   	push   %eax
+f0101ef6:	68 41 01 00 00       	push   $0x141
+f0101efb:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0101f01:	50                   	push   %eax
+f0101f02:	e8 f1 e1 ff ff       	call   f01000f8 <_panic>
+			pages[i].pp_ref = 1;
+f0101f07:	8b 07                	mov    (%edi),%eax
+f0101f09:	66 c7 44 30 08 01 00 	movw   $0x1,0x8(%eax,%esi,1)
+	for (i = 0; i < npages; i++) {
+f0101f10:	83 c3 01             	add    $0x1,%ebx
+f0101f13:	83 c6 0c             	add    $0xc,%esi
+f0101f16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101f19:	3b 18                	cmp    (%eax),%ebx
+f0101f1b:	73 41                	jae    f0101f5e <page_init+0xc8>
+f0101f1d:	89 d8                	mov    %ebx,%eax
+f0101f1f:	c1 e0 0c             	shl    $0xc,%eax
+		if (i == 0 || pa == ROUNDDOWN(BOOTINFO_PA, PGSIZE)
+f0101f22:	89 c2                	mov    %eax,%edx
+f0101f24:	80 e6 ef             	and    $0xef,%dh
+		    || pa == MPENTRY_PADDR
+f0101f27:	81 fa 00 60 00 00    	cmp    $0x6000,%edx
+f0101f2d:	74 d8                	je     f0101f07 <page_init+0x71>
+f0101f2f:	85 db                	test   %ebx,%ebx
+f0101f31:	74 d4                	je     f0101f07 <page_init+0x71>
+		    || (i >= npages_basemem && pa < kend)) {
+f0101f33:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0101f36:	3b 99 84 c7 00 00    	cmp    0xc784(%ecx),%ebx
+f0101f3c:	72 05                	jb     f0101f43 <page_init+0xad>
+f0101f3e:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+f0101f41:	77 c4                	ja     f0101f07 <page_init+0x71>
+		buddy_free(&pages[i], 0);
+f0101f43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101f46:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0101f4c:	89 f1                	mov    %esi,%ecx
+f0101f4e:	03 08                	add    (%eax),%ecx
+f0101f50:	89 c8                	mov    %ecx,%eax
+f0101f52:	ba 00 00 00 00       	mov    $0x0,%edx
+f0101f57:	e8 27 fd ff ff       	call   f0101c83 <buddy_free>
+f0101f5c:	eb b2                	jmp    f0101f10 <page_init+0x7a>
+	free_area[0].fa_nfree = 0;
+f0101f5e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101f61:	c7 80 e0 c6 00 00 00 	movl   $0x0,0xc6e0(%eax)
+f0101f68:	00 00 00 
+	buddy_nmerge = 0;
+f0101f6b:	c7 80 b8 c6 00 00 00 	movl   $0x0,0xc6b8(%eax)
+f0101f72:	00 00 00 
+	buddy_unlock(eflags);
+f0101f75:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0101f78:	e8 ec fe ff ff       	call   f0101e69 <buddy_unlock>
+}
+f0101f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101f80:	5b                   	pop    %ebx
+f0101f81:	5e                   	pop    %esi
+f0101f82:	5f                   	pop    %edi
+f0101f83:	5d                   	pop    %ebp
+f0101f84:	c3                   	ret
+
+f0101f85 <page_alloc>:
+{
+f0101f85:	55                   	push   %ebp
+f0101f86:	89 e5                	mov    %esp,%ebp
+f0101f88:	57                   	push   %edi
+f0101f89:	56                   	push   %esi
+f0101f8a:	53                   	push   %ebx
+f0101f8b:	83 ec 2c             	sub    $0x2c,%esp
+f0101f8e:	e8 5b f0 ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0101f93:	81 c7 f9 34 01 00    	add    $0x134f9,%edi
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0101f99:	9c                   	pushf
+f0101f9a:	58                   	pop    %eax
+f0101f9b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	asm volatile("cli");
+f0101f9e:	fa                   	cli
+	pm = &mags[cpunum()];
+f0101f9f:	89 fb                	mov    %edi,%ebx
+f0101fa1:	e8 19 69 00 00       	call   f01088bf <cpunum>
+f0101fa6:	89 c3                	mov    %eax,%ebx
+	if (pm->pm_count == 0)
+f0101fa8:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f0101fae:	8b b4 07 14 c2 00 00 	mov    0xc214(%edi,%eax,1),%esi
+f0101fb5:	85 f6                	test   %esi,%esi
+f0101fb7:	74 5e                	je     f0102017 <page_alloc+0x92>
+	if (pm->pm_count > 0) {
+f0101fb9:	69 c3 94 00 00 00    	imul   $0x94,%ebx,%eax
+f0101fbf:	8b 84 07 14 c2 00 00 	mov    0xc214(%edi,%eax,1),%eax
+	struct PageInfo *pp = NULL;
+f0101fc6:	be 00 00 00 00       	mov    $0x0,%esi
+	if (pm->pm_count > 0) {
+f0101fcb:	85 c0                	test   %eax,%eax
+f0101fcd:	7e 2b                	jle    f0101ffa <page_alloc+0x75>
+		pp = pm->pm_pages[--pm->pm_count];
+f0101fcf:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0101fd2:	69 d3 94 00 00 00    	imul   $0x94,%ebx,%edx
+f0101fd8:	89 8c 17 14 c2 00 00 	mov    %ecx,0xc214(%edi,%edx,1)
+f0101fdf:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+f0101fe2:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+f0101fe5:	01 c8                	add    %ecx,%eax
+f0101fe7:	8b b4 87 18 c2 00 00 	mov    0xc218(%edi,%eax,4),%esi
+		pp->pp_flags = 0;
+f0101fee:	c6 46 0b 00          	movb   $0x0,0xb(%esi)
+		pm->pm_nalloc++;
+f0101ff2:	83 84 17 98 c2 00 00 	addl   $0x1,0xc298(%edi,%edx,1)
+f0101ff9:	01 
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0101ffa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101ffd:	50                   	push   %eax
+f0101ffe:	9d                   	popf
+	if (pp && (alloc_flags & ALLOC_ZERO))
+f0101fff:	85 f6                	test   %esi,%esi
+f0102001:	74 0a                	je     f010200d <page_alloc+0x88>
+f0102003:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f0102007:	0f 85 a5 00 00 00    	jne    f01020b2 <page_alloc+0x12d>
+}
+f010200d:	89 f0                	mov    %esi,%eax
+f010200f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102012:	5b                   	pop    %ebx
+f0102013:	5e                   	pop    %esi
+f0102014:	5f                   	pop    %edi
+f0102015:	5d                   	pop    %ebp
+f0102016:	c3                   	ret
+	eflags = buddy_lock();
+f0102017:	e8 22 fe ff ff       	call   f0101e3e <buddy_lock>
+f010201c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	while (pm->pm_count < MAG_BATCH && (pp = buddy_alloc(0)))
+f010201f:	8d 05 14 c2 00 00    	lea    0xc214,%eax
+f0102025:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102028:	69 c3 94 00 00 00    	imul   $0x94,%ebx,%eax
+f010202e:	8d 84 07 14 c2 00 00 	lea    0xc214(%edi,%eax,1),%eax
+		pm->pm_pages[pm->pm_count++] = pp;
+f0102035:	8d 0c dd 00 00 00 00 	lea    0x0(,%ebx,8),%ecx
+f010203c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+f010203f:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f0102042:	89 c6                	mov    %eax,%esi
+	while (pm->pm_count < MAG_BATCH && (pp = buddy_alloc(0)))
+f0102044:	83 3e 0f             	cmpl   $0xf,(%esi)
+f0102047:	7f 2b                	jg     f0102074 <page_alloc+0xef>
+f0102049:	b8 00 00 00 00       	mov    $0x0,%eax
+f010204e:	e8 98 fb ff ff       	call   f0101beb <buddy_alloc>
+f0102053:	85 c0                	test   %eax,%eax
+f0102055:	74 1d                	je     f0102074 <page_alloc+0xef>
+		pm->pm_pages[pm->pm_count++] = pp;
+f0102057:	8b 0e                	mov    (%esi),%ecx
+f0102059:	8d 51 01             	lea    0x1(%ecx),%edx
+f010205c:	89 16                	mov    %edx,(%esi)
+f010205e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0102061:	01 da                	add    %ebx,%edx
+f0102063:	8d 14 93             	lea    (%ebx,%edx,4),%edx
+f0102066:	01 ca                	add    %ecx,%edx
+f0102068:	8d 14 97             	lea    (%edi,%edx,4),%edx
+f010206b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010206e:	89 44 11 04          	mov    %eax,0x4(%ecx,%edx,1)
+f0102072:	eb d0                	jmp    f0102044 <page_alloc+0xbf>
+	buddy_unlock(eflags);
+f0102074:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102077:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010207a:	e8 ea fd ff ff       	call   f0101e69 <buddy_unlock>
+f010207f:	69 c3 94 00 00 00    	imul   $0x94,%ebx,%eax
+f0102085:	8d 8c 07 14 c2 00 00 	lea    0xc214(%edi,%eax,1),%ecx
+	for (i = 0; i < pm->pm_count; i++)
+f010208c:	89 ca                	mov    %ecx,%edx
+f010208e:	eb 0b                	jmp    f010209b <page_alloc+0x116>
+		pm->pm_pages[i]->pp_flags = PP_MAG;
+f0102090:	8b 44 b1 04          	mov    0x4(%ecx,%esi,4),%eax
+f0102094:	c6 40 0b 02          	movb   $0x2,0xb(%eax)
+	for (i = 0; i < pm->pm_count; i++)
+f0102098:	83 c6 01             	add    $0x1,%esi
+f010209b:	3b 32                	cmp    (%edx),%esi
+f010209d:	7c f1                	jl     f0102090 <page_alloc+0x10b>
+	pm->pm_nrefill++;
+f010209f:	69 c3 94 00 00 00    	imul   $0x94,%ebx,%eax
+f01020a5:	83 84 07 a0 c2 00 00 	addl   $0x1,0xc2a0(%edi,%eax,1)
+f01020ac:	01 
+}
+f01020ad:	e9 07 ff ff ff       	jmp    f0101fb9 <page_alloc+0x34>
+void	*mmio_map_region(physaddr_t pa, size_t size);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f01020b2:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f01020b8:	89 f3                	mov    %esi,%ebx
+f01020ba:	2b 18                	sub    (%eax),%ebx
+f01020bc:	89 d8                	mov    %ebx,%eax
+f01020be:	c1 f8 02             	sar    $0x2,%eax
+f01020c1:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01020c7:	89 c2                	mov    %eax,%edx
+f01020c9:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01020cc:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01020d1:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f01020d7:	3b 01                	cmp    (%ecx),%eax
+f01020d9:	73 20                	jae    f01020fb <page_alloc+0x176>
+		memset(page2kva(pp), 0, PGSIZE);
+f01020db:	83 ec 04             	sub    $0x4,%esp
+f01020de:	68 00 10 00 00       	push   $0x1000
+f01020e3:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f01020e5:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01020eb:	52                   	push   %edx
+f01020ec:	89 fb                	mov    %edi,%ebx
+f01020ee:	e8 f6 5f 00 00       	call   f01080e9 <memset>
+f01020f3:	83 c4 10             	add    $0x10,%esp
+	return pp;
+f01020f6:	e9 12 ff ff ff       	jmp    f010200d <page_alloc+0x88>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01020fb:	52                   	push   %edx
+f01020fc:	8d 87 5c 47 ff ff    	lea    -0xb8a4(%edi),%eax
+f0102102:	50                   	push   %eax
+f0102103:	6a 53                	push   $0x53
+f0102105:	8d 87 2c 51 ff ff    	lea    -0xaed4(%edi),%eax
+f010210b:	50                   	push   %eax
+f010210c:	89 fb                	mov    %edi,%ebx
+f010210e:	e8 e5 df ff ff       	call   f01000f8 <_panic>
+
+f0102113 <page_alloc_order>:
+{
+f0102113:	55                   	push   %ebp
+f0102114:	89 e5                	mov    %esp,%ebp
+f0102116:	57                   	push   %edi
+f0102117:	56                   	push   %esi
+f0102118:	53                   	push   %ebx
+f0102119:	83 ec 1c             	sub    $0x1c,%esp
+f010211c:	e8 cd ee ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0102121:	81 c7 6b 33 01 00    	add    $0x1336b,%edi
+f0102127:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (order == 0)
+f010212a:	85 db                	test   %ebx,%ebx
+f010212c:	74 36                	je     f0102164 <page_alloc_order+0x51>
+	if (order < 0 || order > MAX_ORDER)
+f010212e:	83 fb 0a             	cmp    $0xa,%ebx
+f0102131:	0f 87 a2 00 00 00    	ja     f01021d9 <page_alloc_order+0xc6>
+	eflags = buddy_lock();
+f0102137:	e8 02 fd ff ff       	call   f0101e3e <buddy_lock>
+f010213c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	pp = buddy_alloc(order);
+f010213f:	89 d8                	mov    %ebx,%eax
+f0102141:	e8 a5 fa ff ff       	call   f0101beb <buddy_alloc>
+f0102146:	89 c6                	mov    %eax,%esi
+	buddy_unlock(eflags);
+f0102148:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010214b:	e8 19 fd ff ff       	call   f0101e69 <buddy_unlock>
+	if (pp && (alloc_flags & ALLOC_ZERO))
+f0102150:	85 f6                	test   %esi,%esi
+f0102152:	74 06                	je     f010215a <page_alloc_order+0x47>
+f0102154:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+f0102158:	75 1c                	jne    f0102176 <page_alloc_order+0x63>
+}
+f010215a:	89 f0                	mov    %esi,%eax
+f010215c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010215f:	5b                   	pop    %ebx
+f0102160:	5e                   	pop    %esi
+f0102161:	5f                   	pop    %edi
+f0102162:	5d                   	pop    %ebp
+f0102163:	c3                   	ret
+		return page_alloc(alloc_flags);
+f0102164:	83 ec 0c             	sub    $0xc,%esp
+f0102167:	ff 75 0c             	push   0xc(%ebp)
+f010216a:	e8 16 fe ff ff       	call   f0101f85 <page_alloc>
+f010216f:	89 c6                	mov    %eax,%esi
+f0102171:	83 c4 10             	add    $0x10,%esp
+f0102174:	eb e4                	jmp    f010215a <page_alloc_order+0x47>
+		memset(page2kva(pp), 0, PGSIZE << order);
+f0102176:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010217b:	89 d9                	mov    %ebx,%ecx
+f010217d:	d3 e2                	shl    %cl,%edx
+	return (pp - pages) << PGSHIFT;
+f010217f:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0102185:	89 f1                	mov    %esi,%ecx
+f0102187:	2b 08                	sub    (%eax),%ecx
+f0102189:	89 c8                	mov    %ecx,%eax
+f010218b:	c1 f8 02             	sar    $0x2,%eax
+f010218e:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102194:	89 c1                	mov    %eax,%ecx
+f0102196:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102199:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010219e:	c7 c3 0c 43 15 f0    	mov    $0xf015430c,%ebx
+f01021a4:	3b 03                	cmp    (%ebx),%eax
+f01021a6:	73 19                	jae    f01021c1 <page_alloc_order+0xae>
+f01021a8:	83 ec 04             	sub    $0x4,%esp
+f01021ab:	52                   	push   %edx
+f01021ac:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f01021ae:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f01021b4:	51                   	push   %ecx
+f01021b5:	89 fb                	mov    %edi,%ebx
+f01021b7:	e8 2d 5f 00 00       	call   f01080e9 <memset>
+f01021bc:	83 c4 10             	add    $0x10,%esp
+f01021bf:	eb 99                	jmp    f010215a <page_alloc_order+0x47>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01021c1:	51                   	push   %ecx
+f01021c2:	8d 87 5c 47 ff ff    	lea    -0xb8a4(%edi),%eax
+f01021c8:	50                   	push   %eax
+f01021c9:	6a 53                	push   $0x53
+f01021cb:	8d 87 2c 51 ff ff    	lea    -0xaed4(%edi),%eax
+f01021d1:	50                   	push   %eax
+f01021d2:	89 fb                	mov    %edi,%ebx
+f01021d4:	e8 1f df ff ff       	call   f01000f8 <_panic>
+		return NULL;
+f01021d9:	be 00 00 00 00       	mov    $0x0,%esi
+f01021de:	e9 77 ff ff ff       	jmp    f010215a <page_alloc_order+0x47>
+
+f01021e3 <page_free>:
+{
+f01021e3:	55                   	push   %ebp
+f01021e4:	89 e5                	mov    %esp,%ebp
+f01021e6:	57                   	push   %edi
+f01021e7:	56                   	push   %esi
+f01021e8:	53                   	push   %ebx
+f01021e9:	83 ec 2c             	sub    $0x2c,%esp
+f01021ec:	e8 f9 ed ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f01021f1:	81 c6 9b 32 01 00    	add    $0x1329b,%esi
+f01021f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+	if (pp->pp_ref != 0 || pp->pp_link != NULL || pp->pp_flags != 0)
+f01021fa:	66 83 7f 08 00       	cmpw   $0x0,0x8(%edi)
+f01021ff:	75 79                	jne    f010227a <page_free+0x97>
+f0102201:	83 3f 00             	cmpl   $0x0,(%edi)
+f0102204:	75 74                	jne    f010227a <page_free+0x97>
+f0102206:	80 7f 0b 00          	cmpb   $0x0,0xb(%edi)
+f010220a:	75 6e                	jne    f010227a <page_free+0x97>
+	if (pp->pp_order > 0) {
+f010220c:	80 7f 0a 00          	cmpb   $0x0,0xa(%edi)
+f0102210:	0f 85 95 00 00 00    	jne    f01022ab <page_free+0xc8>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0102216:	9c                   	pushf
+f0102217:	58                   	pop    %eax
+f0102218:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	asm volatile("cli");
+f010221b:	fa                   	cli
+	pm = &mags[cpunum()];
+f010221c:	89 f3                	mov    %esi,%ebx
+f010221e:	e8 9c 66 00 00       	call   f01088bf <cpunum>
+f0102223:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (pm->pm_count == MAG_SIZE)
+f0102226:	69 c0 94 00 00 00    	imul   $0x94,%eax,%eax
+f010222c:	83 bc 06 14 c2 00 00 	cmpl   $0x20,0xc214(%esi,%eax,1)
+f0102233:	20 
+f0102234:	0f 84 8c 00 00 00    	je     f01022c6 <page_free+0xe3>
+	pp->pp_flags = PP_MAG;
+f010223a:	c6 47 0b 02          	movb   $0x2,0xb(%edi)
+	pm->pm_pages[pm->pm_count++] = pp;
+f010223e:	69 45 e4 94 00 00 00 	imul   $0x94,-0x1c(%ebp),%eax
+f0102245:	8d 8c 06 14 c2 00 00 	lea    0xc214(%esi,%eax,1),%ecx
+f010224c:	8b 11                	mov    (%ecx),%edx
+f010224e:	8d 5a 01             	lea    0x1(%edx),%ebx
+f0102251:	89 19                	mov    %ebx,(%ecx)
+f0102253:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0102256:	8d 0c db             	lea    (%ebx,%ebx,8),%ecx
+f0102259:	8d 0c 8b             	lea    (%ebx,%ecx,4),%ecx
+f010225c:	01 ca                	add    %ecx,%edx
+f010225e:	89 bc 96 18 c2 00 00 	mov    %edi,0xc218(%esi,%edx,4)
+	pm->pm_nfree++;
+f0102265:	83 84 06 9c c2 00 00 	addl   $0x1,0xc29c(%esi,%eax,1)
+f010226c:	01 
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f010226d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102270:	50                   	push   %eax
+f0102271:	9d                   	popf
+}
+f0102272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102275:	5b                   	pop    %ebx
+f0102276:	5e                   	pop    %esi
+f0102277:	5f                   	pop    %edi
+f0102278:	5d                   	pop    %ebp
+f0102279:	c3                   	ret
+	return (pp - pages) << PGSHIFT;
+f010227a:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0102280:	2b 38                	sub    (%eax),%edi
+f0102282:	89 f8                	mov    %edi,%eax
+f0102284:	c1 f8 02             	sar    $0x2,%eax
+f0102287:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010228d:	c1 e0 0c             	shl    $0xc,%eax
+		panic("page_free: page %08x is still in use or already free",
+f0102290:	50                   	push   %eax
+f0102291:	8d 86 0c 53 ff ff    	lea    -0xacf4(%esi),%eax
+f0102297:	50                   	push   %eax
+f0102298:	68 d1 01 00 00       	push   $0x1d1
+f010229d:	8d 86 20 51 ff ff    	lea    -0xaee0(%esi),%eax
+f01022a3:	50                   	push   %eax
+f01022a4:	89 f3                	mov    %esi,%ebx
+f01022a6:	e8 4d de ff ff       	call   f01000f8 <_panic>
+		eflags = buddy_lock();
+f01022ab:	e8 8e fb ff ff       	call   f0101e3e <buddy_lock>
+f01022b0:	89 c3                	mov    %eax,%ebx
+		buddy_free(pp, pp->pp_order);
+f01022b2:	0f b6 57 0a          	movzbl 0xa(%edi),%edx
+f01022b6:	89 f8                	mov    %edi,%eax
+f01022b8:	e8 c6 f9 ff ff       	call   f0101c83 <buddy_free>
+		buddy_unlock(eflags);
+f01022bd:	89 d8                	mov    %ebx,%eax
+f01022bf:	e8 a5 fb ff ff       	call   f0101e69 <buddy_unlock>
+		return;
+f01022c4:	eb ac                	jmp    f0102272 <page_free+0x8f>
+	eflags = buddy_lock();
+f01022c6:	e8 73 fb ff ff       	call   f0101e3e <buddy_lock>
+f01022cb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01022ce:	69 4d e4 94 00 00 00 	imul   $0x94,-0x1c(%ebp),%ecx
+f01022d5:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f01022d8:	8d 86 14 c2 00 00    	lea    0xc214(%esi),%eax
+f01022de:	8d 54 08 04          	lea    0x4(%eax,%ecx,1),%edx
+f01022e2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f01022e5:	89 d3                	mov    %edx,%ebx
+f01022e7:	8d 44 08 44          	lea    0x44(%eax,%ecx,1),%eax
+f01022eb:	89 7d 08             	mov    %edi,0x8(%ebp)
+f01022ee:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < MAG_BATCH; i++) {
+f01022f0:	eb 15                	jmp    f0102307 <page_free+0x124>
+		pm->pm_pages[i]->pp_flags = 0;
+f01022f2:	8b 03                	mov    (%ebx),%eax
+f01022f4:	c6 40 0b 00          	movb   $0x0,0xb(%eax)
+		buddy_free(pm->pm_pages[i], 0);
+f01022f8:	8b 03                	mov    (%ebx),%eax
+f01022fa:	ba 00 00 00 00       	mov    $0x0,%edx
+f01022ff:	e8 7f f9 ff ff       	call   f0101c83 <buddy_free>
+f0102304:	83 c3 04             	add    $0x4,%ebx
+	for (i = 0; i < MAG_BATCH; i++) {
+f0102307:	39 fb                	cmp    %edi,%ebx
+f0102309:	75 e7                	jne    f01022f2 <page_free+0x10f>
+	buddy_unlock(eflags);
+f010230b:	8b 7d 08             	mov    0x8(%ebp),%edi
+f010230e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0102311:	e8 53 fb ff ff       	call   f0101e69 <buddy_unlock>
+	pm->pm_count -= MAG_BATCH;
+f0102316:	69 45 e4 94 00 00 00 	imul   $0x94,-0x1c(%ebp),%eax
+f010231d:	8d 8c 06 14 c2 00 00 	lea    0xc214(%esi,%eax,1),%ecx
+f0102324:	8b 01                	mov    (%ecx),%eax
+f0102326:	83 e8 10             	sub    $0x10,%eax
+f0102329:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f010232c:	89 01                	mov    %eax,(%ecx)
+	memmove(pm->pm_pages, pm->pm_pages + MAG_BATCH,
+f010232e:	83 ec 04             	sub    $0x4,%esp
+f0102331:	c1 e0 02             	shl    $0x2,%eax
+f0102334:	50                   	push   %eax
+f0102335:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0102338:	8d 84 06 58 c2 00 00 	lea    0xc258(%esi,%eax,1),%eax
+f010233f:	50                   	push   %eax
+f0102340:	ff 75 d4             	push   -0x2c(%ebp)
+f0102343:	89 f3                	mov    %esi,%ebx
+f0102345:	e8 f9 5d 00 00       	call   f0108143 <memmove>
+	pm->pm_ndrain++;
+f010234a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010234d:	83 81 90 00 00 00 01 	addl   $0x1,0x90(%ecx)
+}
+f0102354:	83 c4 10             	add    $0x10,%esp
+f0102357:	e9 de fe ff ff       	jmp    f010223a <page_free+0x57>
+
+f010235c <pgdir_walk>:
+{
+f010235c:	55                   	push   %ebp
+f010235d:	89 e5                	mov    %esp,%ebp
+f010235f:	57                   	push   %edi
+f0102360:	56                   	push   %esi
+f0102361:	53                   	push   %ebx
+f0102362:	83 ec 0c             	sub    $0xc,%esp
+f0102365:	e8 84 ec ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f010236a:	81 c7 22 31 01 00    	add    $0x13122,%edi
+f0102370:	8b 75 0c             	mov    0xc(%ebp),%esi
+	pde_t *pde = &pgdir[PDX(va)];
+f0102373:	89 f3                	mov    %esi,%ebx
+f0102375:	c1 eb 16             	shr    $0x16,%ebx
+f0102378:	c1 e3 02             	shl    $0x2,%ebx
+f010237b:	03 5d 08             	add    0x8(%ebp),%ebx
+	if (*pde & PTE_PS)
+f010237e:	8b 03                	mov    (%ebx),%eax
+f0102380:	a8 80                	test   $0x80,%al
+f0102382:	75 6c                	jne    f01023f0 <pgdir_walk+0x94>
+	if (!(*pde & PTE_P)) {
+f0102384:	a8 01                	test   $0x1,%al
+f0102386:	75 39                	jne    f01023c1 <pgdir_walk+0x65>
+		if (!create || !(pp = page_alloc(ALLOC_ZERO)))
+f0102388:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f010238c:	0f 84 94 00 00 00    	je     f0102426 <pgdir_walk+0xca>
+f0102392:	83 ec 0c             	sub    $0xc,%esp
+f0102395:	6a 01                	push   $0x1
+f0102397:	e8 e9 fb ff ff       	call   f0101f85 <page_alloc>
+f010239c:	83 c4 10             	add    $0x10,%esp
+f010239f:	85 c0                	test   %eax,%eax
+f01023a1:	74 45                	je     f01023e8 <pgdir_walk+0x8c>
+		pp->pp_ref++;
+f01023a3:	66 83 40 08 01       	addw   $0x1,0x8(%eax)
+f01023a8:	c7 c2 14 43 15 f0    	mov    $0xf0154314,%edx
+f01023ae:	2b 02                	sub    (%edx),%eax
+f01023b0:	c1 f8 02             	sar    $0x2,%eax
+f01023b3:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01023b9:	c1 e0 0c             	shl    $0xc,%eax
+		*pde = page2pa(pp) | PTE_P | PTE_W | PTE_U;
+f01023bc:	83 c8 07             	or     $0x7,%eax
+f01023bf:	89 03                	mov    %eax,(%ebx)
+	return (pte_t *) KADDR(PTE_ADDR(*pde)) + PTX(va);
+f01023c1:	8b 03                	mov    (%ebx),%eax
+f01023c3:	89 c2                	mov    %eax,%edx
+f01023c5:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	if (PGNUM(pa) >= npages)
+f01023cb:	c1 e8 0c             	shr    $0xc,%eax
+f01023ce:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f01023d4:	3b 01                	cmp    (%ecx),%eax
+f01023d6:	73 33                	jae    f010240b <pgdir_walk+0xaf>
+f01023d8:	c1 ee 0a             	shr    $0xa,%esi
+f01023db:	81 e6 fc 0f 00 00    	and    $0xffc,%esi
+f01023e1:	8d 84 32 00 00 00 f0 	lea    -0x10000000(%edx,%esi,1),%eax
+}
+f01023e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01023eb:	5b                   	pop    %ebx
+f01023ec:	5e                   	pop    %esi
+f01023ed:	5f                   	pop    %edi
+f01023ee:	5d                   	pop    %ebp
+f01023ef:	c3                   	ret
+		panic("pgdir_walk: %08x is in a 4MB page", va);
+f01023f0:	56                   	push   %esi
+f01023f1:	8d 87 44 53 ff ff    	lea    -0xacbc(%edi),%eax
+f01023f7:	50                   	push   %eax
+f01023f8:	68 fa 01 00 00       	push   $0x1fa
+f01023fd:	8d 87 20 51 ff ff    	lea    -0xaee0(%edi),%eax
+f0102403:	50                   	push   %eax
+f0102404:	89 fb                	mov    %edi,%ebx
+f0102406:	e8 ed dc ff ff       	call   f01000f8 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010240b:	52                   	push   %edx
+f010240c:	8d 87 5c 47 ff ff    	lea    -0xb8a4(%edi),%eax
+f0102412:	50                   	push   %eax
+f0102413:	68 01 02 00 00       	push   $0x201
+f0102418:	8d 87 20 51 ff ff    	lea    -0xaee0(%edi),%eax
+f010241e:	50                   	push   %eax
+f010241f:	89 fb                	mov    %edi,%ebx
+f0102421:	e8 d2 dc ff ff       	call   f01000f8 <_panic>
+			return NULL;
+f0102426:	b8 00 00 00 00       	mov    $0x0,%eax
+f010242b:	eb bb                	jmp    f01023e8 <pgdir_walk+0x8c>
+
+f010242d <boot_map_region>:
+{
+f010242d:	55                   	push   %ebp
+f010242e:	89 e5                	mov    %esp,%ebp
+f0102430:	57                   	push   %edi
+f0102431:	56                   	push   %esi
+f0102432:	53                   	push   %ebx
+f0102433:	83 ec 1c             	sub    $0x1c,%esp
+f0102436:	e8 b3 eb ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f010243b:	81 c7 51 30 01 00    	add    $0x13051,%edi
+f0102441:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0102444:	89 c7                	mov    %eax,%edi
+f0102446:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0102449:	89 ce                	mov    %ecx,%esi
+	for (off = 0; off < size; off += PGSIZE) {
+f010244b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0102450:	39 f3                	cmp    %esi,%ebx
+f0102452:	73 4d                	jae    f01024a1 <boot_map_region+0x74>
+		if (!(pte = pgdir_walk(pgdir, (void *) (va + off), 1)))
+f0102454:	83 ec 04             	sub    $0x4,%esp
+f0102457:	6a 01                	push   $0x1
+f0102459:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010245c:	01 d8                	add    %ebx,%eax
+f010245e:	50                   	push   %eax
+f010245f:	57                   	push   %edi
+f0102460:	e8 f7 fe ff ff       	call   f010235c <pgdir_walk>
+f0102465:	89 c2                	mov    %eax,%edx
+f0102467:	83 c4 10             	add    $0x10,%esp
+f010246a:	85 c0                	test   %eax,%eax
+f010246c:	74 15                	je     f0102483 <boot_map_region+0x56>
+		*pte = (pa + off) | perm | PTE_P;
+f010246e:	89 d8                	mov    %ebx,%eax
+f0102470:	03 45 08             	add    0x8(%ebp),%eax
+f0102473:	0b 45 0c             	or     0xc(%ebp),%eax
+f0102476:	83 c8 01             	or     $0x1,%eax
+f0102479:	89 02                	mov    %eax,(%edx)
+	for (off = 0; off < size; off += PGSIZE) {
+f010247b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0102481:	eb cd                	jmp    f0102450 <boot_map_region+0x23>
+			panic("boot_map_region: out of memory");
+f0102483:	83 ec 04             	sub    $0x4,%esp
+f0102486:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0102489:	8d 83 68 53 ff ff    	lea    -0xac98(%ebx),%eax
+f010248f:	50                   	push   %eax
+f0102490:	68 15 02 00 00       	push   $0x215
+f0102495:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f010249b:	50                   	push   %eax
+f010249c:	e8 57 dc ff ff       	call   f01000f8 <_panic>
+}
+f01024a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01024a4:	5b                   	pop    %ebx
+f01024a5:	5e                   	pop    %esi
+f01024a6:	5f                   	pop    %edi
+f01024a7:	5d                   	pop    %ebp
+f01024a8:	c3                   	ret
+
+f01024a9 <mem_init>:
+{
+f01024a9:	55                   	push   %ebp
+f01024aa:	89 e5                	mov    %esp,%ebp
+f01024ac:	57                   	push   %edi
+f01024ad:	56                   	push   %esi
+f01024ae:	53                   	push   %ebx
+f01024af:	81 ec ec 00 00 00    	sub    $0xec,%esp
+f01024b5:	e8 24 eb ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f01024ba:	05 d2 2f 01 00       	add    $0x12fd2,%eax
+f01024bf:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+	basemem = nvram_read(NVRAM_BASELO);
+f01024c5:	b8 15 00 00 00       	mov    $0x15,%eax
+f01024ca:	e8 b4 f8 ff ff       	call   f0101d83 <nvram_read>
+f01024cf:	89 c3                	mov    %eax,%ebx
+	extmem = nvram_read(NVRAM_EXTLO);
+f01024d1:	b8 17 00 00 00       	mov    $0x17,%eax
+f01024d6:	e8 a8 f8 ff ff       	call   f0101d83 <nvram_read>
+f01024db:	89 c6                	mov    %eax,%esi
+	ext16mem = nvram_read(NVRAM_EXT16LO) * 64;
+f01024dd:	b8 34 00 00 00       	mov    $0x34,%eax
+f01024e2:	e8 9c f8 ff ff       	call   f0101d83 <nvram_read>
+	if (ext16mem)
+f01024e7:	c1 e0 06             	shl    $0x6,%eax
+f01024ea:	0f 84 6d 02 00 00    	je     f010275d <mem_init+0x2b4>
+		totalmem = 16 * 1024 + ext16mem;
+f01024f0:	05 00 40 00 00       	add    $0x4000,%eax
+	npages = totalmem / (PGSIZE / 1024);
+f01024f5:	8b bd 24 ff ff ff    	mov    -0xdc(%ebp),%edi
+f01024fb:	c7 c6 0c 43 15 f0    	mov    $0xf015430c,%esi
+f0102501:	89 c2                	mov    %eax,%edx
+f0102503:	c1 ea 02             	shr    $0x2,%edx
+f0102506:	89 16                	mov    %edx,(%esi)
+	npages_basemem = basemem / (PGSIZE / 1024);
+f0102508:	89 da                	mov    %ebx,%edx
+f010250a:	c1 ea 02             	shr    $0x2,%edx
+f010250d:	89 97 84 c7 00 00    	mov    %edx,0xc784(%edi)
+	cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0102513:	89 c2                	mov    %eax,%edx
+f0102515:	29 da                	sub    %ebx,%edx
+f0102517:	52                   	push   %edx
+f0102518:	53                   	push   %ebx
+f0102519:	50                   	push   %eax
+f010251a:	8d 87 88 53 ff ff    	lea    -0xac78(%edi),%eax
+f0102520:	50                   	push   %eax
+f0102521:	89 fb                	mov    %edi,%ebx
+f0102523:	e8 6a 1b 00 00       	call   f0104092 <cprintf>
+	if (npages > (size_t) (0 - KERNBASE) / PGSIZE) {
+f0102528:	83 c4 10             	add    $0x10,%esp
+f010252b:	81 3e 00 00 01 00    	cmpl   $0x10000,(%esi)
+f0102531:	0f 87 36 02 00 00    	ja     f010276d <mem_init+0x2c4>
+	kern_pgdir = entry_pgdir;
+f0102537:	8b bd 24 ff ff ff    	mov    -0xdc(%ebp),%edi
+f010253d:	c7 c0 10 43 15 f0    	mov    $0xf0154310,%eax
+f0102543:	c7 c2 00 40 11 f0    	mov    $0xf0114000,%edx
+f0102549:	89 10                	mov    %edx,(%eax)
+	pages = boot_alloc(npages * sizeof(struct PageInfo));
+f010254b:	c7 c3 0c 43 15 f0    	mov    $0xf015430c,%ebx
+f0102551:	8b 03                	mov    (%ebx),%eax
+f0102553:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0102556:	c1 e0 02             	shl    $0x2,%eax
+f0102559:	e8 5b f8 ff ff       	call   f0101db9 <boot_alloc>
+f010255e:	c7 c6 14 43 15 f0    	mov    $0xf0154314,%esi
+f0102564:	89 06                	mov    %eax,(%esi)
+	memset(pages, 0, npages * sizeof(struct PageInfo));
+f0102566:	83 ec 04             	sub    $0x4,%esp
+f0102569:	8b 13                	mov    (%ebx),%edx
+f010256b:	8d 14 52             	lea    (%edx,%edx,2),%edx
+f010256e:	c1 e2 02             	shl    $0x2,%edx
+f0102571:	52                   	push   %edx
+f0102572:	6a 00                	push   $0x0
+f0102574:	50                   	push   %eax
+f0102575:	89 fb                	mov    %edi,%ebx
+f0102577:	e8 6d 5b 00 00       	call   f01080e9 <memset>
+	page_init();
+f010257c:	e8 15 f9 ff ff       	call   f0101e96 <page_init>
+	struct PageInfo *pp0, *pp1, *pp2, *blk;
+	struct PageInfo *many[MAG_SIZE + MAG_BATCH];
+	size_t nfree;
+	int i;
+
+	if (!pages)
+f0102581:	83 c4 10             	add    $0x10,%esp
+f0102584:	83 3e 00             	cmpl   $0x0,(%esi)
+f0102587:	0f 84 0e 02 00 00    	je     f010279b <mem_init+0x2f2>
+		panic("'pages' is a null pointer!");
+	nfree = page_nfree();
+f010258d:	e8 a1 f7 ff ff       	call   f0101d33 <page_nfree>
+f0102592:	89 85 18 ff ff ff    	mov    %eax,-0xe8(%ebp)
+	assert(nfree > 0);
+f0102598:	85 c0                	test   %eax,%eax
+f010259a:	0f 84 1c 02 00 00    	je     f01027bc <mem_init+0x313>
+
+	// should be able to allocate three distinct pages
+	pp0 = pp1 = pp2 = 0;
+	assert((pp0 = page_alloc(0)));
+f01025a0:	83 ec 0c             	sub    $0xc,%esp
+f01025a3:	6a 00                	push   $0x0
+f01025a5:	e8 db f9 ff ff       	call   f0101f85 <page_alloc>
+f01025aa:	89 c6                	mov    %eax,%esi
+f01025ac:	83 c4 10             	add    $0x10,%esp
+f01025af:	85 c0                	test   %eax,%eax
+f01025b1:	0f 84 2a 02 00 00    	je     f01027e1 <mem_init+0x338>
+	assert((pp1 = page_alloc(0)));
+f01025b7:	83 ec 0c             	sub    $0xc,%esp
+f01025ba:	6a 00                	push   $0x0
+f01025bc:	e8 c4 f9 ff ff       	call   f0101f85 <page_alloc>
+f01025c1:	89 85 20 ff ff ff    	mov    %eax,-0xe0(%ebp)
+f01025c7:	83 c4 10             	add    $0x10,%esp
+f01025ca:	85 c0                	test   %eax,%eax
+f01025cc:	0f 84 34 02 00 00    	je     f0102806 <mem_init+0x35d>
+	assert((pp2 = page_alloc(0)));
+f01025d2:	83 ec 0c             	sub    $0xc,%esp
+f01025d5:	6a 00                	push   $0x0
+f01025d7:	e8 a9 f9 ff ff       	call   f0101f85 <page_alloc>
+f01025dc:	89 85 1c ff ff ff    	mov    %eax,-0xe4(%ebp)
+f01025e2:	83 c4 10             	add    $0x10,%esp
+f01025e5:	85 c0                	test   %eax,%eax
+f01025e7:	0f 84 3e 02 00 00    	je     f010282b <mem_init+0x382>
+	assert(pp1 && pp1 != pp0);
+f01025ed:	8b 85 20 ff ff ff    	mov    -0xe0(%ebp),%eax
+f01025f3:	39 c6                	cmp    %eax,%esi
+f01025f5:	0f 84 55 02 00 00    	je     f0102850 <mem_init+0x3a7>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f01025fb:	8b 85 1c ff ff ff    	mov    -0xe4(%ebp),%eax
+f0102601:	39 c6                	cmp    %eax,%esi
+f0102603:	0f 84 6c 02 00 00    	je     f0102875 <mem_init+0x3cc>
+f0102609:	39 85 20 ff ff ff    	cmp    %eax,-0xe0(%ebp)
+f010260f:	0f 84 60 02 00 00    	je     f0102875 <mem_init+0x3cc>
+	return (pp - pages) << PGSHIFT;
+f0102615:	8b bd 24 ff ff ff    	mov    -0xdc(%ebp),%edi
+f010261b:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0102621:	8b 08                	mov    (%eax),%ecx
+f0102623:	89 f3                	mov    %esi,%ebx
+f0102625:	29 cb                	sub    %ecx,%ebx
+f0102627:	c1 fb 02             	sar    $0x2,%ebx
+f010262a:	69 db ab aa aa aa    	imul   $0xaaaaaaab,%ebx,%ebx
+f0102630:	c1 e3 0c             	shl    $0xc,%ebx
+	assert(page2pa(pp0) < npages*PGSIZE);
+f0102633:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0102639:	8b 38                	mov    (%eax),%edi
+f010263b:	89 fa                	mov    %edi,%edx
+f010263d:	c1 e2 0c             	shl    $0xc,%edx
+f0102640:	39 d3                	cmp    %edx,%ebx
+f0102642:	0f 83 52 02 00 00    	jae    f010289a <mem_init+0x3f1>
+f0102648:	8b 85 20 ff ff ff    	mov    -0xe0(%ebp),%eax
+f010264e:	29 c8                	sub    %ecx,%eax
+f0102650:	c1 f8 02             	sar    $0x2,%eax
+f0102653:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102659:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp1) < npages*PGSIZE);
+f010265c:	39 d0                	cmp    %edx,%eax
+f010265e:	0f 83 5b 02 00 00    	jae    f01028bf <mem_init+0x416>
+f0102664:	8b 85 1c ff ff ff    	mov    -0xe4(%ebp),%eax
+f010266a:	29 c8                	sub    %ecx,%eax
+f010266c:	c1 f8 02             	sar    $0x2,%eax
+f010266f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0102675:	c1 e0 0c             	shl    $0xc,%eax
+	assert(page2pa(pp2) < npages*PGSIZE);
+f0102678:	39 d0                	cmp    %edx,%eax
+f010267a:	0f 83 64 02 00 00    	jae    f01028e4 <mem_init+0x43b>
+	assert(page_nfree() == nfree - 3);
+f0102680:	e8 ae f6 ff ff       	call   f0101d33 <page_nfree>
+f0102685:	8b 8d 18 ff ff ff    	mov    -0xe8(%ebp),%ecx
+f010268b:	83 e9 03             	sub    $0x3,%ecx
+f010268e:	89 8d 14 ff ff ff    	mov    %ecx,-0xec(%ebp)
+f0102694:	39 c8                	cmp    %ecx,%eax
+f0102696:	0f 85 6d 02 00 00    	jne    f0102909 <mem_init+0x460>
+	if (PGNUM(pa) >= npages)
+f010269c:	89 d8                	mov    %ebx,%eax
+f010269e:	c1 e8 0c             	shr    $0xc,%eax
+f01026a1:	39 f8                	cmp    %edi,%eax
+f01026a3:	0f 83 85 02 00 00    	jae    f010292e <mem_init+0x485>
+
+	// test flags
+	memset(page2kva(pp0), 1, PGSIZE);
+f01026a9:	83 ec 04             	sub    $0x4,%esp
+f01026ac:	68 00 10 00 00       	push   $0x1000
+f01026b1:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f01026b3:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f01026b9:	53                   	push   %ebx
+f01026ba:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01026c0:	e8 24 5a 00 00       	call   f01080e9 <memset>
+	page_free(pp0);
+f01026c5:	89 34 24             	mov    %esi,(%esp)
+f01026c8:	e8 16 fb ff ff       	call   f01021e3 <page_free>
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+f01026cd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f01026d4:	e8 ac f8 ff ff       	call   f0101f85 <page_alloc>
+f01026d9:	89 c7                	mov    %eax,%edi
+f01026db:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+f01026e1:	83 c4 10             	add    $0x10,%esp
+f01026e4:	85 c0                	test   %eax,%eax
+f01026e6:	0f 84 5e 02 00 00    	je     f010294a <mem_init+0x4a1>
+	return (pp - pages) << PGSHIFT;
+f01026ec:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f01026f2:	2b 38                	sub    (%eax),%edi
+f01026f4:	89 f9                	mov    %edi,%ecx
+f01026f6:	c1 f9 02             	sar    $0x2,%ecx
+f01026f9:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+f01026ff:	89 cf                	mov    %ecx,%edi
+f0102701:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0102704:	81 e1 ff ff 0f 00    	and    $0xfffff,%ecx
+f010270a:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0102710:	8b 30                	mov    (%eax),%esi
+	return (void *)(pa + KERNBASE);
+f0102712:	8d 87 00 00 00 f0    	lea    -0x10000000(%edi),%eax
+f0102718:	8d 9f 00 10 00 f0    	lea    -0xffff000(%edi),%ebx
+	for (i = 0; i < PGSIZE; i++)
+f010271e:	39 d8                	cmp    %ebx,%eax
+f0102720:	0f 84 65 02 00 00    	je     f010298b <mem_init+0x4e2>
+	if (PGNUM(pa) >= npages)
+f0102726:	39 f1                	cmp    %esi,%ecx
+f0102728:	0f 83 41 02 00 00    	jae    f010296f <mem_init+0x4c6>
+		assert(((char *) page2kva(pp0))[i] == 0);
+f010272e:	0f b6 10             	movzbl (%eax),%edx
+f0102731:	83 c0 01             	add    $0x1,%eax
+f0102734:	84 d2                	test   %dl,%dl
+f0102736:	74 e6                	je     f010271e <mem_init+0x275>
+f0102738:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f010273e:	8d 83 04 54 ff ff    	lea    -0xabfc(%ebx),%eax
+f0102744:	50                   	push   %eax
+f0102745:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010274b:	50                   	push   %eax
+f010274c:	68 83 02 00 00       	push   $0x283
+f0102751:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102757:	50                   	push   %eax
+f0102758:	e8 9b d9 ff ff       	call   f01000f8 <_panic>
+		totalmem = 1 * 1024 + extmem;
+f010275d:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+f0102763:	85 f6                	test   %esi,%esi
+f0102765:	0f 44 c3             	cmove  %ebx,%eax
+f0102768:	e9 88 fd ff ff       	jmp    f01024f5 <mem_init+0x4c>
+		npages = (size_t) (0 - KERNBASE) / PGSIZE;
+f010276d:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102773:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0102779:	c7 00 00 00 01 00    	movl   $0x10000,(%eax)
+		cprintf("Using only the first %uK\n", npages * (PGSIZE / 1024));
+f010277f:	83 ec 08             	sub    $0x8,%esp
+f0102782:	68 00 00 04 00       	push   $0x40000
+f0102787:	8d 83 3a 51 ff ff    	lea    -0xaec6(%ebx),%eax
+f010278d:	50                   	push   %eax
+f010278e:	e8 ff 18 00 00       	call   f0104092 <cprintf>
+f0102793:	83 c4 10             	add    $0x10,%esp
+f0102796:	e9 9c fd ff ff       	jmp    f0102537 <mem_init+0x8e>
+		panic("'pages' is a null pointer!");
+f010279b:	83 ec 04             	sub    $0x4,%esp
+f010279e:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01027a4:	8d 83 54 51 ff ff    	lea    -0xaeac(%ebx),%eax
+f01027aa:	50                   	push   %eax
+f01027ab:	68 6e 02 00 00       	push   $0x26e
+f01027b0:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f01027b6:	50                   	push   %eax
+f01027b7:	e8 3c d9 ff ff       	call   f01000f8 <_panic>
+	assert(nfree > 0);
+f01027bc:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01027c2:	8d 83 6f 51 ff ff    	lea    -0xae91(%ebx),%eax
+f01027c8:	50                   	push   %eax
+f01027c9:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01027cf:	50                   	push   %eax
+f01027d0:	68 70 02 00 00       	push   $0x270
+f01027d5:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f01027db:	50                   	push   %eax
+f01027dc:	e8 17 d9 ff ff       	call   f01000f8 <_panic>
+	assert((pp0 = page_alloc(0)));
+f01027e1:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01027e7:	8d 83 79 51 ff ff    	lea    -0xae87(%ebx),%eax
+f01027ed:	50                   	push   %eax
+f01027ee:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01027f4:	50                   	push   %eax
+f01027f5:	68 74 02 00 00       	push   $0x274
+f01027fa:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102800:	50                   	push   %eax
+f0102801:	e8 f2 d8 ff ff       	call   f01000f8 <_panic>
+	assert((pp1 = page_alloc(0)));
+f0102806:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f010280c:	8d 83 8f 51 ff ff    	lea    -0xae71(%ebx),%eax
+f0102812:	50                   	push   %eax
+f0102813:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102819:	50                   	push   %eax
+f010281a:	68 75 02 00 00       	push   $0x275
+f010281f:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102825:	50                   	push   %eax
+f0102826:	e8 cd d8 ff ff       	call   f01000f8 <_panic>
+	assert((pp2 = page_alloc(0)));
+f010282b:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102831:	8d 83 a5 51 ff ff    	lea    -0xae5b(%ebx),%eax
+f0102837:	50                   	push   %eax
+f0102838:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010283e:	50                   	push   %eax
+f010283f:	68 76 02 00 00       	push   $0x276
+f0102844:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f010284a:	50                   	push   %eax
+f010284b:	e8 a8 d8 ff ff       	call   f01000f8 <_panic>
+	assert(pp1 && pp1 != pp0);
+f0102850:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102856:	8d 83 bb 51 ff ff    	lea    -0xae45(%ebx),%eax
+f010285c:	50                   	push   %eax
+f010285d:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102863:	50                   	push   %eax
+f0102864:	68 77 02 00 00       	push   $0x277
+f0102869:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f010286f:	50                   	push   %eax
+f0102870:	e8 83 d8 ff ff       	call   f01000f8 <_panic>
+	assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102875:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f010287b:	8d 83 c4 53 ff ff    	lea    -0xac3c(%ebx),%eax
+f0102881:	50                   	push   %eax
+f0102882:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102888:	50                   	push   %eax
+f0102889:	68 78 02 00 00       	push   $0x278
+f010288e:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102894:	50                   	push   %eax
+f0102895:	e8 5e d8 ff ff       	call   f01000f8 <_panic>
+	assert(page2pa(pp0) < npages*PGSIZE);
+f010289a:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01028a0:	8d 83 cd 51 ff ff    	lea    -0xae33(%ebx),%eax
+f01028a6:	50                   	push   %eax
+f01028a7:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01028ad:	50                   	push   %eax
+f01028ae:	68 79 02 00 00       	push   $0x279
+f01028b3:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f01028b9:	50                   	push   %eax
+f01028ba:	e8 39 d8 ff ff       	call   f01000f8 <_panic>
+	assert(page2pa(pp1) < npages*PGSIZE);
+f01028bf:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01028c5:	8d 83 ea 51 ff ff    	lea    -0xae16(%ebx),%eax
+f01028cb:	50                   	push   %eax
+f01028cc:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01028d2:	50                   	push   %eax
+f01028d3:	68 7a 02 00 00       	push   $0x27a
+f01028d8:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f01028de:	50                   	push   %eax
+f01028df:	e8 14 d8 ff ff       	call   f01000f8 <_panic>
+	assert(page2pa(pp2) < npages*PGSIZE);
+f01028e4:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f01028ea:	8d 83 07 52 ff ff    	lea    -0xadf9(%ebx),%eax
+f01028f0:	50                   	push   %eax
+f01028f1:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01028f7:	50                   	push   %eax
+f01028f8:	68 7b 02 00 00       	push   $0x27b
+f01028fd:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102903:	50                   	push   %eax
+f0102904:	e8 ef d7 ff ff       	call   f01000f8 <_panic>
+	assert(page_nfree() == nfree - 3);
+f0102909:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f010290f:	8d 83 24 52 ff ff    	lea    -0xaddc(%ebx),%eax
+f0102915:	50                   	push   %eax
+f0102916:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010291c:	50                   	push   %eax
+f010291d:	68 7c 02 00 00       	push   $0x27c
+f0102922:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102928:	50                   	push   %eax
+f0102929:	e8 ca d7 ff ff       	call   f01000f8 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010292e:	53                   	push   %ebx
+f010292f:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102935:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f010293b:	50                   	push   %eax
+f010293c:	6a 53                	push   $0x53
+f010293e:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0102944:	50                   	push   %eax
+f0102945:	e8 ae d7 ff ff       	call   f01000f8 <_panic>
+	assert((pp0 = page_alloc(ALLOC_ZERO)));
+f010294a:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102950:	8d 83 e4 53 ff ff    	lea    -0xac1c(%ebx),%eax
+f0102956:	50                   	push   %eax
+f0102957:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010295d:	50                   	push   %eax
+f010295e:	68 81 02 00 00       	push   $0x281
+f0102963:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102969:	50                   	push   %eax
+f010296a:	e8 89 d7 ff ff       	call   f01000f8 <_panic>
+f010296f:	57                   	push   %edi
+f0102970:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102976:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f010297c:	50                   	push   %eax
+f010297d:	6a 53                	push   $0x53
+f010297f:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0102985:	50                   	push   %eax
+f0102986:	e8 6d d7 ff ff       	call   f01000f8 <_panic>
+
+	// blocks come back aligned to their size, giving back what
+	// they were split from
+	assert((blk = page_alloc_order(3, ALLOC_ZERO)));
+f010298b:	83 ec 08             	sub    $0x8,%esp
+f010298e:	6a 01                	push   $0x1
+f0102990:	6a 03                	push   $0x3
+f0102992:	e8 7c f7 ff ff       	call   f0102113 <page_alloc_order>
+f0102997:	89 c7                	mov    %eax,%edi
+f0102999:	83 c4 10             	add    $0x10,%esp
+f010299c:	85 c0                	test   %eax,%eax
+f010299e:	0f 84 96 00 00 00    	je     f0102a3a <mem_init+0x591>
+	assert((blk - pages) % 8 == 0);
+f01029a4:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+f01029aa:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f01029b0:	89 f9                	mov    %edi,%ecx
+f01029b2:	2b 08                	sub    (%eax),%ecx
+f01029b4:	c1 f9 02             	sar    $0x2,%ecx
+f01029b7:	69 c9 ab aa aa aa    	imul   $0xaaaaaaab,%ecx,%ecx
+f01029bd:	f6 c1 07             	test   $0x7,%cl
+f01029c0:	0f 85 99 00 00 00    	jne    f0102a5f <mem_init+0x5b6>
+	assert(blk->pp_order == 3);
+f01029c6:	80 7f 0a 03          	cmpb   $0x3,0xa(%edi)
+f01029ca:	0f 85 b4 00 00 00    	jne    f0102a84 <mem_init+0x5db>
+	return (pp - pages) << PGSHIFT;
+f01029d0:	89 ca                	mov    %ecx,%edx
+f01029d2:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01029d5:	81 e1 ff ff 0f 00    	and    $0xfffff,%ecx
+f01029db:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+f01029e1:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f01029e7:	8b 30                	mov    (%eax),%esi
+	return (void *)(pa + KERNBASE);
+f01029e9:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+f01029ef:	8d 9a 00 80 00 f0    	lea    -0xfff8000(%edx),%ebx
+f01029f5:	89 95 0c ff ff ff    	mov    %edx,-0xf4(%ebp)
+	for (i = 0; i < 8 * PGSIZE; i++)
+f01029fb:	39 d8                	cmp    %ebx,%eax
+f01029fd:	0f 84 c8 00 00 00    	je     f0102acb <mem_init+0x622>
+	if (PGNUM(pa) >= npages)
+f0102a03:	39 f1                	cmp    %esi,%ecx
+f0102a05:	0f 83 9e 00 00 00    	jae    f0102aa9 <mem_init+0x600>
+		assert(((char *) page2kva(blk))[i] == 0);
+f0102a0b:	0f b6 10             	movzbl (%eax),%edx
+f0102a0e:	83 c0 01             	add    $0x1,%eax
+f0102a11:	84 d2                	test   %dl,%dl
+f0102a13:	74 e6                	je     f01029fb <mem_init+0x552>
+f0102a15:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102a1b:	8d 83 50 54 ff ff    	lea    -0xabb0(%ebx),%eax
+f0102a21:	50                   	push   %eax
+f0102a22:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102a28:	50                   	push   %eax
+f0102a29:	68 8b 02 00 00       	push   $0x28b
+f0102a2e:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102a34:	50                   	push   %eax
+f0102a35:	e8 be d6 ff ff       	call   f01000f8 <_panic>
+	assert((blk = page_alloc_order(3, ALLOC_ZERO)));
+f0102a3a:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102a40:	8d 83 28 54 ff ff    	lea    -0xabd8(%ebx),%eax
+f0102a46:	50                   	push   %eax
+f0102a47:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102a4d:	50                   	push   %eax
+f0102a4e:	68 87 02 00 00       	push   $0x287
+f0102a53:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102a59:	50                   	push   %eax
+f0102a5a:	e8 99 d6 ff ff       	call   f01000f8 <_panic>
+	assert((blk - pages) % 8 == 0);
+f0102a5f:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102a65:	8d 83 3e 52 ff ff    	lea    -0xadc2(%ebx),%eax
+f0102a6b:	50                   	push   %eax
+f0102a6c:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102a72:	50                   	push   %eax
+f0102a73:	68 88 02 00 00       	push   $0x288
+f0102a78:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102a7e:	50                   	push   %eax
+f0102a7f:	e8 74 d6 ff ff       	call   f01000f8 <_panic>
+	assert(blk->pp_order == 3);
+f0102a84:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102a8a:	8d 83 55 52 ff ff    	lea    -0xadab(%ebx),%eax
+f0102a90:	50                   	push   %eax
+f0102a91:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102a97:	50                   	push   %eax
+f0102a98:	68 89 02 00 00       	push   $0x289
+f0102a9d:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102aa3:	50                   	push   %eax
+f0102aa4:	e8 4f d6 ff ff       	call   f01000f8 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0102aa9:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+f0102aaf:	52                   	push   %edx
+f0102ab0:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102ab6:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0102abc:	50                   	push   %eax
+f0102abd:	6a 53                	push   $0x53
+f0102abf:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0102ac5:	50                   	push   %eax
+f0102ac6:	e8 2d d6 ff ff       	call   f01000f8 <_panic>
+	assert(page_nfree() == nfree - 3 - 8);
+f0102acb:	e8 63 f2 ff ff       	call   f0101d33 <page_nfree>
+f0102ad0:	89 c2                	mov    %eax,%edx
+f0102ad2:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+f0102ad8:	83 e8 0b             	sub    $0xb,%eax
+f0102adb:	39 c2                	cmp    %eax,%edx
+f0102add:	0f 85 82 00 00 00    	jne    f0102b65 <mem_init+0x6bc>
+	page_free(blk);
+f0102ae3:	83 ec 0c             	sub    $0xc,%esp
+f0102ae6:	57                   	push   %edi
+f0102ae7:	e8 f7 f6 ff ff       	call   f01021e3 <page_free>
+	assert(page_nfree() == nfree - 3);
+f0102aec:	e8 42 f2 ff ff       	call   f0101d33 <page_nfree>
+f0102af1:	83 c4 10             	add    $0x10,%esp
+f0102af4:	39 85 14 ff ff ff    	cmp    %eax,-0xec(%ebp)
+f0102afa:	0f 85 8a 00 00 00    	jne    f0102b8a <mem_init+0x6e1>
+	assert(!page_alloc_order(MAX_ORDER + 1, 0));
+f0102b00:	83 ec 08             	sub    $0x8,%esp
+f0102b03:	6a 00                	push   $0x0
+f0102b05:	6a 0b                	push   $0xb
+f0102b07:	e8 07 f6 ff ff       	call   f0102113 <page_alloc_order>
+f0102b0c:	83 c4 10             	add    $0x10,%esp
+f0102b0f:	85 c0                	test   %eax,%eax
+f0102b11:	0f 85 98 00 00 00    	jne    f0102baf <mem_init+0x706>
+f0102b17:	8d b5 28 ff ff ff    	lea    -0xd8(%ebp),%esi
+f0102b1d:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f0102b20:	89 f3                	mov    %esi,%ebx
+
+	// go through a refill and a drain of the magazine
+	for (i = 0; i < ARRAY_SIZE(many); i++)
+f0102b22:	39 fb                	cmp    %edi,%ebx
+f0102b24:	0f 84 aa 00 00 00    	je     f0102bd4 <mem_init+0x72b>
+		assert((many[i] = page_alloc(0)));
+f0102b2a:	83 ec 0c             	sub    $0xc,%esp
+f0102b2d:	6a 00                	push   $0x0
+f0102b2f:	e8 51 f4 ff ff       	call   f0101f85 <page_alloc>
+f0102b34:	89 03                	mov    %eax,(%ebx)
+f0102b36:	83 c3 04             	add    $0x4,%ebx
+f0102b39:	83 c4 10             	add    $0x10,%esp
+f0102b3c:	85 c0                	test   %eax,%eax
+f0102b3e:	75 e2                	jne    f0102b22 <mem_init+0x679>
+f0102b40:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102b46:	8d 83 86 52 ff ff    	lea    -0xad7a(%ebx),%eax
+f0102b4c:	50                   	push   %eax
+f0102b4d:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102b53:	50                   	push   %eax
+f0102b54:	68 93 02 00 00       	push   $0x293
+f0102b59:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102b5f:	50                   	push   %eax
+f0102b60:	e8 93 d5 ff ff       	call   f01000f8 <_panic>
+	assert(page_nfree() == nfree - 3 - 8);
+f0102b65:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102b6b:	8d 83 68 52 ff ff    	lea    -0xad98(%ebx),%eax
+f0102b71:	50                   	push   %eax
+f0102b72:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102b78:	50                   	push   %eax
+f0102b79:	68 8c 02 00 00       	push   $0x28c
+f0102b7e:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102b84:	50                   	push   %eax
+f0102b85:	e8 6e d5 ff ff       	call   f01000f8 <_panic>
+	assert(page_nfree() == nfree - 3);
+f0102b8a:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102b90:	8d 83 24 52 ff ff    	lea    -0xaddc(%ebx),%eax
+f0102b96:	50                   	push   %eax
+f0102b97:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102b9d:	50                   	push   %eax
+f0102b9e:	68 8e 02 00 00       	push   $0x28e
+f0102ba3:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102ba9:	50                   	push   %eax
+f0102baa:	e8 49 d5 ff ff       	call   f01000f8 <_panic>
+	assert(!page_alloc_order(MAX_ORDER + 1, 0));
+f0102baf:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102bb5:	8d 83 74 54 ff ff    	lea    -0xab8c(%ebx),%eax
+f0102bbb:	50                   	push   %eax
+f0102bbc:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102bc2:	50                   	push   %eax
+f0102bc3:	68 8f 02 00 00       	push   $0x28f
+f0102bc8:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102bce:	50                   	push   %eax
+f0102bcf:	e8 24 d5 ff ff       	call   f01000f8 <_panic>
+	for (i = 0; i < ARRAY_SIZE(many); i++)
+f0102bd4:	39 de                	cmp    %ebx,%esi
+f0102bd6:	74 12                	je     f0102bea <mem_init+0x741>
+		page_free(many[i]);
+f0102bd8:	83 ec 0c             	sub    $0xc,%esp
+f0102bdb:	ff 36                	push   (%esi)
+f0102bdd:	e8 01 f6 ff ff       	call   f01021e3 <page_free>
+f0102be2:	83 c6 04             	add    $0x4,%esi
+f0102be5:	83 c4 10             	add    $0x10,%esp
+f0102be8:	eb ea                	jmp    f0102bd4 <mem_init+0x72b>
+
+	page_free(pp0);
+f0102bea:	83 ec 0c             	sub    $0xc,%esp
+f0102bed:	ff b5 10 ff ff ff    	push   -0xf0(%ebp)
+f0102bf3:	e8 eb f5 ff ff       	call   f01021e3 <page_free>
+	page_free(pp1);
+f0102bf8:	83 c4 04             	add    $0x4,%esp
+f0102bfb:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+f0102c01:	e8 dd f5 ff ff       	call   f01021e3 <page_free>
+	page_free(pp2);
+f0102c06:	83 c4 04             	add    $0x4,%esp
+f0102c09:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+f0102c0f:	e8 cf f5 ff ff       	call   f01021e3 <page_free>
+	assert(page_nfree() == nfree);
+f0102c14:	e8 1a f1 ff ff       	call   f0101d33 <page_nfree>
+f0102c19:	83 c4 10             	add    $0x10,%esp
+f0102c1c:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%ebp)
+f0102c22:	75 39                	jne    f0102c5d <mem_init+0x7b4>
+
+	cprintf("check_page_alloc() succeeded!\n");
+f0102c24:	83 ec 0c             	sub    $0xc,%esp
+f0102c27:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102c2d:	8d 83 98 54 ff ff    	lea    -0xab68(%ebx),%eax
+f0102c33:	50                   	push   %eax
+f0102c34:	e8 59 14 00 00       	call   f0104092 <cprintf>
+f0102c39:	89 d8                	mov    %ebx,%eax
+f0102c3b:	c7 c3 00 60 15 f0    	mov    $0xf0156000,%ebx
+f0102c41:	8d bb 00 00 04 00    	lea    0x40000(%ebx),%edi
+f0102c47:	89 bd 20 ff ff ff    	mov    %edi,-0xe0(%ebp)
+}
+f0102c4d:	83 c4 10             	add    $0x10,%esp
+f0102c50:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+		boot_map_region(kern_pgdir,
+f0102c55:	c7 c7 10 43 15 f0    	mov    $0xf0154310,%edi
+}
+f0102c5b:	eb 4e                	jmp    f0102cab <mem_init+0x802>
+	assert(page_nfree() == nfree);
+f0102c5d:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102c63:	8d 83 a0 52 ff ff    	lea    -0xad60(%ebx),%eax
+f0102c69:	50                   	push   %eax
+f0102c6a:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102c70:	50                   	push   %eax
+f0102c71:	68 9a 02 00 00       	push   $0x29a
+f0102c76:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102c7c:	50                   	push   %eax
+f0102c7d:	e8 76 d4 ff ff       	call   f01000f8 <_panic>
+		boot_map_region(kern_pgdir,
+f0102c82:	8b 07                	mov    (%edi),%eax
+f0102c84:	83 ec 08             	sub    $0x8,%esp
+f0102c87:	6a 02                	push   $0x2
+	return (physaddr_t)kva - KERNBASE;
+f0102c89:	8d 93 00 00 00 10    	lea    0x10000000(%ebx),%edx
+f0102c8f:	52                   	push   %edx
+f0102c90:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f0102c95:	89 f2                	mov    %esi,%edx
+f0102c97:	e8 91 f7 ff ff       	call   f010242d <boot_map_region>
+f0102c9c:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f0102ca2:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0102ca8:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NCPU; i++)
+f0102cab:	39 9d 20 ff ff ff    	cmp    %ebx,-0xe0(%ebp)
+f0102cb1:	74 27                	je     f0102cda <mem_init+0x831>
+	if ((uint32_t)kva < KERNBASE)
+f0102cb3:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0102cb9:	77 c7                	ja     f0102c82 <mem_init+0x7d9>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0102cbb:	53                   	push   %ebx
+f0102cbc:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+f0102cc2:	8d 83 e8 52 ff ff    	lea    -0xad18(%ebx),%eax
+f0102cc8:	50                   	push   %eax
+f0102cc9:	68 c8 00 00 00       	push   $0xc8
+f0102cce:	8d 83 20 51 ff ff    	lea    -0xaee0(%ebx),%eax
+f0102cd4:	50                   	push   %eax
+f0102cd5:	e8 1e d4 ff ff       	call   f01000f8 <_panic>
+}
+f0102cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102cdd:	5b                   	pop    %ebx
+f0102cde:	5e                   	pop    %esi
+f0102cdf:	5f                   	pop    %edi
+f0102ce0:	5d                   	pop    %ebp
+f0102ce1:	c3                   	ret
+
+f0102ce2 <mmio_map_region>:
+{
+f0102ce2:	55                   	push   %ebp
+f0102ce3:	89 e5                	mov    %esp,%ebp
+f0102ce5:	57                   	push   %edi
+f0102ce6:	56                   	push   %esi
+f0102ce7:	53                   	push   %ebx
+f0102ce8:	83 ec 0c             	sub    $0xc,%esp
+f0102ceb:	e8 fe e2 ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0102cf0:	81 c7 9c 27 01 00    	add    $0x1279c,%edi
+f0102cf6:	8b 75 08             	mov    0x8(%ebp),%esi
+	size = ROUNDUP(pa + size, PGSIZE) - ROUNDDOWN(pa, PGSIZE);
+f0102cf9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0102cfc:	8d 9c 06 ff 0f 00 00 	lea    0xfff(%esi,%eax,1),%ebx
+f0102d03:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+f0102d09:	89 f1                	mov    %esi,%ecx
+f0102d0b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+f0102d11:	29 cb                	sub    %ecx,%ebx
+	if (base + size > MMIOLIM)
+f0102d13:	8b 97 78 fe ff ff    	mov    -0x188(%edi),%edx
+f0102d19:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f0102d1c:	3d 00 00 c0 ef       	cmp    $0xefc00000,%eax
+f0102d21:	77 33                	ja     f0102d56 <mmio_map_region+0x74>
+	boot_map_region(kern_pgdir, base, size, ROUNDDOWN(pa, PGSIZE),
+f0102d23:	c7 c0 10 43 15 f0    	mov    $0xf0154310,%eax
+f0102d29:	8b 00                	mov    (%eax),%eax
+f0102d2b:	83 ec 08             	sub    $0x8,%esp
+f0102d2e:	6a 1a                	push   $0x1a
+f0102d30:	51                   	push   %ecx
+f0102d31:	89 d9                	mov    %ebx,%ecx
+f0102d33:	e8 f5 f6 ff ff       	call   f010242d <boot_map_region>
+	result = base + PGOFF(pa);
+f0102d38:	8b 87 78 fe ff ff    	mov    -0x188(%edi),%eax
+	base += size;
+f0102d3e:	01 c3                	add    %eax,%ebx
+f0102d40:	89 9f 78 fe ff ff    	mov    %ebx,-0x188(%edi)
+	result = base + PGOFF(pa);
+f0102d46:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+f0102d4c:	01 f0                	add    %esi,%eax
+}
+f0102d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102d51:	5b                   	pop    %ebx
+f0102d52:	5e                   	pop    %esi
+f0102d53:	5f                   	pop    %edi
+f0102d54:	5d                   	pop    %ebp
+f0102d55:	c3                   	ret
+		panic("mmio_map_region: out of MMIO space");
+f0102d56:	83 ec 04             	sub    $0x4,%esp
+f0102d59:	8d 87 b8 54 ff ff    	lea    -0xab48(%edi),%eax
+f0102d5f:	50                   	push   %eax
+f0102d60:	68 2e 02 00 00       	push   $0x22e
+f0102d65:	8d 87 20 51 ff ff    	lea    -0xaee0(%edi),%eax
+f0102d6b:	50                   	push   %eax
+f0102d6c:	89 fb                	mov    %edi,%ebx
+f0102d6e:	e8 85 d3 ff ff       	call   f01000f8 <_panic>
+
+f0102d73 <page_print_stats>:
+{
+f0102d73:	55                   	push   %ebp
+f0102d74:	89 e5                	mov    %esp,%ebp
+f0102d76:	57                   	push   %edi
+f0102d77:	56                   	push   %esi
+f0102d78:	53                   	push   %ebx
+f0102d79:	83 ec 1c             	sub    $0x1c,%esp
+f0102d7c:	e8 ce d5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0102d81:	81 c3 0b 27 01 00    	add    $0x1270b,%ebx
+	cprintf("%u pages (%uK), %u free\n", npages, npages * (PGSIZE / 1024),
+f0102d87:	e8 a7 ef ff ff       	call   f0101d33 <page_nfree>
+f0102d8c:	89 c2                	mov    %eax,%edx
+f0102d8e:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0102d94:	8b 00                	mov    (%eax),%eax
+f0102d96:	52                   	push   %edx
+f0102d97:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+f0102d9e:	52                   	push   %edx
+f0102d9f:	50                   	push   %eax
+f0102da0:	8d 83 b6 52 ff ff    	lea    -0xad4a(%ebx),%eax
+f0102da6:	50                   	push   %eax
+f0102da7:	e8 e6 12 00 00       	call   f0104092 <cprintf>
+	cprintf("order  free blocks    allocs     frees\n");
+f0102dac:	8d 83 dc 54 ff ff    	lea    -0xab24(%ebx),%eax
+f0102db2:	89 04 24             	mov    %eax,(%esp)
+f0102db5:	e8 d8 12 00 00       	call   f0104092 <cprintf>
+f0102dba:	8d b3 d8 c6 00 00    	lea    0xc6d8(%ebx),%esi
+f0102dc0:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i <= MAX_ORDER; i++)
+f0102dc3:	bf 00 00 00 00       	mov    $0x0,%edi
+		cprintf("%5d %12u %9u %9u\n", i, free_area[i].fa_nblocks,
+f0102dc8:	8d 83 cf 52 ff ff    	lea    -0xad31(%ebx),%eax
+f0102dce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102dd1:	83 ec 0c             	sub    $0xc,%esp
+f0102dd4:	ff 76 08             	push   0x8(%esi)
+f0102dd7:	ff 76 04             	push   0x4(%esi)
+f0102dda:	ff 36                	push   (%esi)
+f0102ddc:	57                   	push   %edi
+f0102ddd:	ff 75 e4             	push   -0x1c(%ebp)
+f0102de0:	e8 ad 12 00 00       	call   f0104092 <cprintf>
+	for (i = 0; i <= MAX_ORDER; i++)
+f0102de5:	83 c7 01             	add    $0x1,%edi
+f0102de8:	83 c6 10             	add    $0x10,%esi
+f0102deb:	83 c4 20             	add    $0x20,%esp
+f0102dee:	83 ff 0b             	cmp    $0xb,%edi
+f0102df1:	75 de                	jne    f0102dd1 <page_print_stats+0x5e>
+	cprintf("%u splits, %u merges, %u failed allocations\n",
+f0102df3:	ff b3 b4 c6 00 00    	push   0xc6b4(%ebx)
+f0102df9:	ff b3 b8 c6 00 00    	push   0xc6b8(%ebx)
+f0102dff:	ff b3 bc c6 00 00    	push   0xc6bc(%ebx)
+f0102e05:	8d 83 04 55 ff ff    	lea    -0xaafc(%ebx),%eax
+f0102e0b:	50                   	push   %eax
+f0102e0c:	e8 81 12 00 00       	call   f0104092 <cprintf>
+f0102e11:	8d b3 14 c2 00 00    	lea    0xc214(%ebx),%esi
+f0102e17:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NCPU; i++) {
+f0102e1a:	bf 00 00 00 00       	mov    $0x0,%edi
+		cprintf("CPU %d: %d cached, %u allocs, %u frees, "
+f0102e1f:	8d 83 34 55 ff ff    	lea    -0xaacc(%ebx),%eax
+f0102e25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0102e28:	eb 32                	jmp    f0102e5c <page_print_stats+0xe9>
+f0102e2a:	83 ec 04             	sub    $0x4,%esp
+f0102e2d:	ff b0 90 00 00 00    	push   0x90(%eax)
+f0102e33:	ff b0 8c 00 00 00    	push   0x8c(%eax)
+f0102e39:	ff b0 88 00 00 00    	push   0x88(%eax)
+f0102e3f:	52                   	push   %edx
+f0102e40:	ff 30                	push   (%eax)
+f0102e42:	57                   	push   %edi
+f0102e43:	ff 75 e4             	push   -0x1c(%ebp)
+f0102e46:	e8 47 12 00 00       	call   f0104092 <cprintf>
+f0102e4b:	83 c4 20             	add    $0x20,%esp
+	for (i = 0; i < NCPU; i++) {
+f0102e4e:	83 c7 01             	add    $0x1,%edi
+f0102e51:	81 c6 94 00 00 00    	add    $0x94,%esi
+f0102e57:	83 ff 08             	cmp    $0x8,%edi
+f0102e5a:	74 17                	je     f0102e73 <page_print_stats+0x100>
+f0102e5c:	89 f0                	mov    %esi,%eax
+		if (!mags[i].pm_nalloc && !mags[i].pm_nfree)
+f0102e5e:	8b 96 84 00 00 00    	mov    0x84(%esi),%edx
+f0102e64:	85 d2                	test   %edx,%edx
+f0102e66:	75 c2                	jne    f0102e2a <page_print_stats+0xb7>
+f0102e68:	83 be 88 00 00 00 00 	cmpl   $0x0,0x88(%esi)
+f0102e6f:	75 b9                	jne    f0102e2a <page_print_stats+0xb7>
+f0102e71:	eb db                	jmp    f0102e4e <page_print_stats+0xdb>
+}
+f0102e73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102e76:	5b                   	pop    %ebx
+f0102e77:	5e                   	pop    %esi
+f0102e78:	5f                   	pop    %edi
+f0102e79:	5d                   	pop    %ebp
+f0102e7a:	c3                   	ret
+
+f0102e7b <slab_remove>:
+}
+
+static void
+slab_remove(struct Slab **list, struct Slab *sl)
+{
+	if (sl->sl_prev)
+f0102e7b:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0102e7e:	85 c9                	test   %ecx,%ecx
+f0102e80:	74 11                	je     f0102e93 <slab_remove+0x18>
+		sl->sl_prev->sl_link = sl->sl_link;
+f0102e82:	8b 02                	mov    (%edx),%eax
+f0102e84:	89 01                	mov    %eax,(%ecx)
+	else
+		*list = sl->sl_link;
+	if (sl->sl_link)
+f0102e86:	8b 02                	mov    (%edx),%eax
+f0102e88:	85 c0                	test   %eax,%eax
+f0102e8a:	74 06                	je     f0102e92 <slab_remove+0x17>
+		sl->sl_link->sl_prev = sl->sl_prev;
+f0102e8c:	8b 52 04             	mov    0x4(%edx),%edx
+f0102e8f:	89 50 04             	mov    %edx,0x4(%eax)
+}
+f0102e92:	c3                   	ret
+		*list = sl->sl_link;
+f0102e93:	8b 0a                	mov    (%edx),%ecx
+f0102e95:	89 08                	mov    %ecx,(%eax)
+f0102e97:	eb ed                	jmp    f0102e86 <slab_remove+0xb>
+
+f0102e99 <check_ctor>:
+
+#define CHECK_MAGIC	0x6b6d656d
+
+static void
+check_ctor(void *obj)
+{
+f0102e99:	55                   	push   %ebp
+f0102e9a:	89 e5                	mov    %esp,%ebp
+	*(uint32_t *) obj = CHECK_MAGIC;
+f0102e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+f0102e9f:	c7 00 6d 65 6d 6b    	movl   $0x6b6d656d,(%eax)
+}
+f0102ea5:	5d                   	pop    %ebp
+f0102ea6:	c3                   	ret
+
+f0102ea7 <cache_init>:
+{
+f0102ea7:	55                   	push   %ebp
+f0102ea8:	89 e5                	mov    %esp,%ebp
+f0102eaa:	57                   	push   %edi
+f0102eab:	56                   	push   %esi
+f0102eac:	53                   	push   %ebx
+f0102ead:	83 ec 30             	sub    $0x30,%esp
+f0102eb0:	e8 9a d4 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0102eb5:	81 c3 d7 25 01 00    	add    $0x125d7,%ebx
+f0102ebb:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+f0102ebe:	89 c7                	mov    %eax,%edi
+f0102ec0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f0102ec3:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f0102ec6:	8b 75 08             	mov    0x8(%ebp),%esi
+	memset(cp, 0, sizeof(*cp));
+f0102ec9:	68 f8 02 00 00       	push   $0x2f8
+f0102ece:	6a 00                	push   $0x0
+f0102ed0:	50                   	push   %eax
+f0102ed1:	e8 13 52 00 00       	call   f01080e9 <memset>
+	strncpy(cp->kc_name, name, sizeof(cp->kc_name) - 1);
+f0102ed6:	83 c4 0c             	add    $0xc,%esp
+f0102ed9:	6a 0f                	push   $0xf
+f0102edb:	ff 75 d4             	push   -0x2c(%ebp)
+f0102ede:	57                   	push   %edi
+f0102edf:	e8 a9 50 00 00       	call   f0107f8d <strncpy>
+	cp->kc_align = align ? align : sizeof(void *);
+f0102ee4:	83 c4 10             	add    $0x10,%esp
+f0102ee7:	85 f6                	test   %esi,%esi
+f0102ee9:	0f 84 2a 01 00 00    	je     f0103019 <cache_init+0x172>
+f0102eef:	89 77 14             	mov    %esi,0x14(%edi)
+	assert((cp->kc_align & (cp->kc_align - 1)) == 0);
+f0102ef2:	8d 46 ff             	lea    -0x1(%esi),%eax
+f0102ef5:	85 f0                	test   %esi,%eax
+f0102ef7:	0f 84 28 01 00 00    	je     f0103025 <cache_init+0x17e>
+f0102efd:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0102f00:	8d 83 74 55 ff ff    	lea    -0xaa8c(%ebx),%eax
+f0102f06:	50                   	push   %eax
+f0102f07:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0102f0d:	50                   	push   %eax
+f0102f0e:	68 92 00 00 00       	push   $0x92
+f0102f13:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f0102f19:	50                   	push   %eax
+f0102f1a:	e8 d9 d1 ff ff       	call   f01000f8 <_panic>
+			n--;
+f0102f1f:	83 e9 01             	sub    $0x1,%ecx
+		while (n > 0 && slab_hdrsize(cp, n) + n * cp->kc_size > slabsize)
+f0102f22:	85 c9                	test   %ecx,%ecx
+f0102f24:	0f 8e a1 00 00 00    	jle    f0102fcb <cache_init+0x124>
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0102f2a:	8b 47 14             	mov    0x14(%edi),%eax
+f0102f2d:	8d 44 48 13          	lea    0x13(%eax,%ecx,2),%eax
+		while (n > 0 && slab_hdrsize(cp, n) + n * cp->kc_size > slabsize)
+f0102f31:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0102f34:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102f39:	f7 77 14             	divl   0x14(%edi)
+		while (n > 0 && slab_hdrsize(cp, n) + n * cp->kc_size > slabsize)
+f0102f3c:	29 d3                	sub    %edx,%ebx
+f0102f3e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102f41:	29 c6                	sub    %eax,%esi
+f0102f43:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+f0102f46:	72 d7                	jb     f0102f1f <cache_init+0x78>
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0102f48:	8b 77 14             	mov    0x14(%edi),%esi
+f0102f4b:	8d 5c 4e 13          	lea    0x13(%esi,%ecx,2),%ebx
+		cp->kc_order = order;
+f0102f4f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0102f52:	89 47 1c             	mov    %eax,0x1c(%edi)
+		cp->kc_perslab = n;
+f0102f55:	89 4f 20             	mov    %ecx,0x20(%edi)
+		used = slab_hdrsize(cp, n) + n * cp->kc_size;
+f0102f58:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0102f5b:	0f af c1             	imul   %ecx,%eax
+		cp->kc_maxcolor = ROUNDDOWN(slabsize - used, color_step(cp));
+f0102f5e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0102f61:	29 c1                	sub    %eax,%ecx
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0102f63:	89 d8                	mov    %ebx,%eax
+f0102f65:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102f6a:	f7 f6                	div    %esi
+		cp->kc_maxcolor = ROUNDDOWN(slabsize - used, color_step(cp));
+f0102f6c:	01 d1                	add    %edx,%ecx
+f0102f6e:	29 d9                	sub    %ebx,%ecx
+	return MAX(CACHELINE, cp->kc_align);
+f0102f70:	bb 40 00 00 00       	mov    $0x40,%ebx
+f0102f75:	39 de                	cmp    %ebx,%esi
+f0102f77:	0f 43 de             	cmovae %esi,%ebx
+		cp->kc_maxcolor = ROUNDDOWN(slabsize - used, color_step(cp));
+f0102f7a:	89 c8                	mov    %ecx,%eax
+f0102f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102f81:	f7 f3                	div    %ebx
+f0102f83:	89 c8                	mov    %ecx,%eax
+f0102f85:	29 d0                	sub    %edx,%eax
+f0102f87:	89 47 24             	mov    %eax,0x24(%edi)
+		if (slabsize - used <= slabsize / 8)
+f0102f8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0102f8d:	c1 e8 03             	shr    $0x3,%eax
+f0102f90:	39 c8                	cmp    %ecx,%eax
+f0102f92:	73 44                	jae    f0102fd8 <cache_init+0x131>
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+f0102f94:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+f0102f98:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0102f9b:	83 f8 04             	cmp    $0x4,%eax
+f0102f9e:	74 32                	je     f0102fd2 <cache_init+0x12b>
+		slabsize = PGSIZE << order;
+f0102fa0:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0102fa5:	0f b6 4d dc          	movzbl -0x24(%ebp),%ecx
+f0102fa9:	d3 e0                	shl    %cl,%eax
+f0102fab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			/ (cp->kc_size + sizeof(uint16_t));
+f0102fae:	8b 77 10             	mov    0x10(%edi),%esi
+f0102fb1:	89 75 e0             	mov    %esi,-0x20(%ebp)
+		n = (slabsize - sizeof(struct Slab))
+f0102fb4:	83 e8 14             	sub    $0x14,%eax
+			/ (cp->kc_size + sizeof(uint16_t));
+f0102fb7:	8d 4e 02             	lea    0x2(%esi),%ecx
+f0102fba:	ba 00 00 00 00       	mov    $0x0,%edx
+f0102fbf:	f7 f1                	div    %ecx
+		n = (slabsize - sizeof(struct Slab))
+f0102fc1:	89 c1                	mov    %eax,%ecx
+f0102fc3:	0f af f0             	imul   %eax,%esi
+		while (n > 0 && slab_hdrsize(cp, n) + n * cp->kc_size > slabsize)
+f0102fc6:	e9 57 ff ff ff       	jmp    f0102f22 <cache_init+0x7b>
+		if (n == 0)
+f0102fcb:	74 c7                	je     f0102f94 <cache_init+0xed>
+f0102fcd:	e9 76 ff ff ff       	jmp    f0102f48 <cache_init+0xa1>
+	if (cp->kc_perslab == 0)
+f0102fd2:	83 7f 20 00          	cmpl   $0x0,0x20(%edi)
+f0102fd6:	74 1d                	je     f0102ff5 <cache_init+0x14e>
+	cp->kc_next = caches;
+f0102fd8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f0102fdb:	8b 82 b4 ca 00 00    	mov    0xcab4(%edx),%eax
+f0102fe1:	89 87 f4 02 00 00    	mov    %eax,0x2f4(%edi)
+	caches = cp;
+f0102fe7:	89 ba b4 ca 00 00    	mov    %edi,0xcab4(%edx)
+}
+f0102fed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0102ff0:	5b                   	pop    %ebx
+f0102ff1:	5e                   	pop    %esi
+f0102ff2:	5f                   	pop    %edi
+f0102ff3:	5d                   	pop    %ebp
+f0102ff4:	c3                   	ret
+		panic("kmem_cache_create: %s objects of %u bytes are too big",
+f0102ff5:	83 ec 0c             	sub    $0xc,%esp
+f0102ff8:	ff 75 d0             	push   -0x30(%ebp)
+f0102ffb:	ff 75 d4             	push   -0x2c(%ebp)
+f0102ffe:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0103001:	8d 83 a0 55 ff ff    	lea    -0xaa60(%ebx),%eax
+f0103007:	50                   	push   %eax
+f0103008:	68 98 00 00 00       	push   $0x98
+f010300d:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f0103013:	50                   	push   %eax
+f0103014:	e8 df d0 ff ff       	call   f01000f8 <_panic>
+	cp->kc_align = align ? align : sizeof(void *);
+f0103019:	c7 47 14 04 00 00 00 	movl   $0x4,0x14(%edi)
+f0103020:	be 04 00 00 00       	mov    $0x4,%esi
+	cp->kc_size = ROUNDUP(size ? size : 1, cp->kc_align);
+f0103025:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0103028:	85 d2                	test   %edx,%edx
+f010302a:	b8 01 00 00 00       	mov    $0x1,%eax
+f010302f:	0f 45 c2             	cmovne %edx,%eax
+f0103032:	8d 4c 06 ff          	lea    -0x1(%esi,%eax,1),%ecx
+f0103036:	89 c8                	mov    %ecx,%eax
+f0103038:	ba 00 00 00 00       	mov    $0x0,%edx
+f010303d:	f7 f6                	div    %esi
+f010303f:	29 d1                	sub    %edx,%ecx
+f0103041:	89 4f 10             	mov    %ecx,0x10(%edi)
+	cp->kc_ctor = ctor;
+f0103044:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103047:	89 47 18             	mov    %eax,0x18(%edi)
+	spin_initlock(&cp->kc_lock);
+f010304a:	83 ec 08             	sub    $0x8,%esp
+f010304d:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0103050:	8d 83 0b 58 ff ff    	lea    -0xa7f5(%ebx),%eax
+f0103056:	50                   	push   %eax
+f0103057:	8d 47 2c             	lea    0x2c(%edi),%eax
+f010305a:	50                   	push   %eax
+f010305b:	e8 53 5b 00 00       	call   f0108bb3 <__spin_initlock>
+f0103060:	83 c4 10             	add    $0x10,%esp
+	for (order = 0; order <= KMEM_MAXORDER; order++) {
+f0103063:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+f010306a:	e9 31 ff ff ff       	jmp    f0102fa0 <cache_init+0xf9>
+
+f010306f <slab_free>:
+{
+f010306f:	55                   	push   %ebp
+f0103070:	89 e5                	mov    %esp,%ebp
+f0103072:	57                   	push   %edi
+f0103073:	56                   	push   %esi
+f0103074:	53                   	push   %ebx
+f0103075:	83 ec 1c             	sub    $0x1c,%esp
+f0103078:	e8 71 df ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f010307d:	81 c7 0f 24 01 00    	add    $0x1240f,%edi
+f0103083:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f0103086:	89 c6                	mov    %eax,%esi
+f0103088:	89 d7                	mov    %edx,%edi
+	sl = ROUNDDOWN(obj, PGSIZE << cp->kc_order);
+f010308a:	8b 48 1c             	mov    0x1c(%eax),%ecx
+f010308d:	bb 00 f0 ff ff       	mov    $0xfffff000,%ebx
+f0103092:	d3 e3                	shl    %cl,%ebx
+f0103094:	21 d3                	and    %edx,%ebx
+	off = (char *) obj - sl->sl_objs;
+f0103096:	8b 43 0c             	mov    0xc(%ebx),%eax
+f0103099:	29 c2                	sub    %eax,%edx
+f010309b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	if (sl->sl_cache != cp || (char *) obj < sl->sl_objs
+f010309e:	39 73 08             	cmp    %esi,0x8(%ebx)
+f01030a1:	75 58                	jne    f01030fb <slab_free+0x8c>
+f01030a3:	39 c7                	cmp    %eax,%edi
+f01030a5:	72 54                	jb     f01030fb <slab_free+0x8c>
+	    || off % cp->kc_size != 0 || off / cp->kc_size >= cp->kc_perslab)
+f01030a7:	8b 4e 10             	mov    0x10(%esi),%ecx
+f01030aa:	89 d0                	mov    %edx,%eax
+f01030ac:	ba 00 00 00 00       	mov    $0x0,%edx
+f01030b1:	f7 f1                	div    %ecx
+f01030b3:	85 d2                	test   %edx,%edx
+f01030b5:	75 44                	jne    f01030fb <slab_free+0x8c>
+f01030b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01030ba:	ba 00 00 00 00       	mov    $0x0,%edx
+f01030bf:	f7 f1                	div    %ecx
+f01030c1:	3b 46 20             	cmp    0x20(%esi),%eax
+f01030c4:	73 35                	jae    f01030fb <slab_free+0x8c>
+	if (sl->sl_nfree == 0) {
+f01030c6:	66 83 7b 10 00       	cmpw   $0x0,0x10(%ebx)
+f01030cb:	74 4e                	je     f010311b <slab_free+0xac>
+	sl->sl_free[sl->sl_nfree++] = off / cp->kc_size;
+f01030cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01030d0:	ba 00 00 00 00       	mov    $0x0,%edx
+f01030d5:	f7 76 10             	divl   0x10(%esi)
+f01030d8:	0f b7 4b 10          	movzwl 0x10(%ebx),%ecx
+f01030dc:	8d 51 01             	lea    0x1(%ecx),%edx
+f01030df:	66 89 53 10          	mov    %dx,0x10(%ebx)
+f01030e3:	0f b7 c9             	movzwl %cx,%ecx
+f01030e6:	66 89 44 4b 12       	mov    %ax,0x12(%ebx,%ecx,2)
+	if (sl->sl_nfree == cp->kc_perslab) {
+f01030eb:	0f b7 d2             	movzwl %dx,%edx
+f01030ee:	3b 56 20             	cmp    0x20(%esi),%edx
+f01030f1:	74 4a                	je     f010313d <slab_free+0xce>
+}
+f01030f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01030f6:	5b                   	pop    %ebx
+f01030f7:	5e                   	pop    %esi
+f01030f8:	5f                   	pop    %edi
+f01030f9:	5d                   	pop    %ebp
+f01030fa:	c3                   	ret
+		panic("kmem_cache_free: %p is not a %s object", obj,
+f01030fb:	83 ec 0c             	sub    $0xc,%esp
+f01030fe:	56                   	push   %esi
+f01030ff:	57                   	push   %edi
+f0103100:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103103:	8d 83 d8 55 ff ff    	lea    -0xaa28(%ebx),%eax
+f0103109:	50                   	push   %eax
+f010310a:	68 e3 00 00 00       	push   $0xe3
+f010310f:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f0103115:	50                   	push   %eax
+f0103116:	e8 dd cf ff ff       	call   f01000f8 <_panic>
+		slab_remove(&cp->kc_full, sl);
+f010311b:	8d 46 60             	lea    0x60(%esi),%eax
+f010311e:	89 da                	mov    %ebx,%edx
+f0103120:	e8 56 fd ff ff       	call   f0102e7b <slab_remove>
+	sl->sl_prev = NULL;
+f0103125:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	sl->sl_link = *list;
+f010312c:	8b 46 64             	mov    0x64(%esi),%eax
+f010312f:	89 03                	mov    %eax,(%ebx)
+	if (*list)
+f0103131:	85 c0                	test   %eax,%eax
+f0103133:	74 03                	je     f0103138 <slab_free+0xc9>
+		(*list)->sl_prev = sl;
+f0103135:	89 58 04             	mov    %ebx,0x4(%eax)
+	*list = sl;
+f0103138:	89 5e 64             	mov    %ebx,0x64(%esi)
+}
+f010313b:	eb 90                	jmp    f01030cd <slab_free+0x5e>
+		slab_remove(&cp->kc_partial, sl);
+f010313d:	8d 46 64             	lea    0x64(%esi),%eax
+f0103140:	89 da                	mov    %ebx,%edx
+f0103142:	e8 34 fd ff ff       	call   f0102e7b <slab_remove>
+		if (cp->kc_nempty > 0) {
+f0103147:	83 7e 6c 00          	cmpl   $0x0,0x6c(%esi)
+f010314b:	7e 7b                	jle    f01031c8 <slab_free+0x159>
+			cp->kc_nslab--;
+f010314d:	83 6e 70 01          	subl   $0x1,0x70(%esi)
+	if ((uint32_t)kva < KERNBASE)
+f0103151:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0103157:	76 38                	jbe    f0103191 <slab_free+0x122>
+	return (physaddr_t)kva - KERNBASE;
+f0103159:	81 c3 00 00 00 10    	add    $0x10000000,%ebx
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f010315f:	c1 eb 0c             	shr    $0xc,%ebx
+f0103162:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103165:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f010316b:	3b 18                	cmp    (%eax),%ebx
+f010316d:	73 3e                	jae    f01031ad <slab_free+0x13e>
+			page_free(pa2page(PADDR(sl)));
+f010316f:	83 ec 0c             	sub    $0xc,%esp
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f0103172:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+f0103175:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103178:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f010317e:	8b 00                	mov    (%eax),%eax
+f0103180:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f0103183:	50                   	push   %eax
+f0103184:	e8 5a f0 ff ff       	call   f01021e3 <page_free>
+f0103189:	83 c4 10             	add    $0x10,%esp
+f010318c:	e9 62 ff ff ff       	jmp    f01030f3 <slab_free+0x84>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103191:	53                   	push   %ebx
+f0103192:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103195:	8d 83 e8 52 ff ff    	lea    -0xad18(%ebx),%eax
+f010319b:	50                   	push   %eax
+f010319c:	68 f0 00 00 00       	push   $0xf0
+f01031a1:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f01031a7:	50                   	push   %eax
+f01031a8:	e8 4b cf ff ff       	call   f01000f8 <_panic>
+		panic("pa2page called with invalid pa");
+f01031ad:	83 ec 04             	sub    $0x4,%esp
+f01031b0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01031b3:	8d 83 00 56 ff ff    	lea    -0xaa00(%ebx),%eax
+f01031b9:	50                   	push   %eax
+f01031ba:	6a 4c                	push   $0x4c
+f01031bc:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f01031c2:	50                   	push   %eax
+f01031c3:	e8 30 cf ff ff       	call   f01000f8 <_panic>
+	sl->sl_prev = NULL;
+f01031c8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	sl->sl_link = *list;
+f01031cf:	8b 46 68             	mov    0x68(%esi),%eax
+f01031d2:	89 03                	mov    %eax,(%ebx)
+	if (*list)
+f01031d4:	85 c0                	test   %eax,%eax
+f01031d6:	74 03                	je     f01031db <slab_free+0x16c>
+		(*list)->sl_prev = sl;
+f01031d8:	89 58 04             	mov    %ebx,0x4(%eax)
+	*list = sl;
+f01031db:	89 5e 68             	mov    %ebx,0x68(%esi)
+			cp->kc_nempty++;
+f01031de:	83 46 6c 01          	addl   $0x1,0x6c(%esi)
+}
+f01031e2:	e9 0c ff ff ff       	jmp    f01030f3 <slab_free+0x84>
+
+f01031e7 <kmem_cache_alloc>:
+{
+f01031e7:	55                   	push   %ebp
+f01031e8:	89 e5                	mov    %esp,%ebp
+f01031ea:	57                   	push   %edi
+f01031eb:	56                   	push   %esi
+f01031ec:	53                   	push   %ebx
+f01031ed:	83 ec 3c             	sub    $0x3c,%esp
+f01031f0:	e8 5a d1 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01031f5:	81 c3 97 22 01 00    	add    $0x12297,%ebx
+f01031fb:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f01031fe:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0103201:	9c                   	pushf
+f0103202:	58                   	pop    %eax
+f0103203:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	asm volatile("cli");
+f0103206:	fa                   	cli
+	cpu = cpunum();
+f0103207:	e8 b3 56 00 00       	call   f01088bf <cpunum>
+f010320c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	if (cp->kc_cpu[cpu].mc_count == 0) {
+f010320f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0103212:	c1 e0 04             	shl    $0x4,%eax
+f0103215:	8b 44 06 74          	mov    0x74(%esi,%eax,1),%eax
+f0103219:	89 45 d0             	mov    %eax,-0x30(%ebp)
+	void *obj = NULL;
+f010321c:	bf 00 00 00 00       	mov    $0x0,%edi
+	if (cp->kc_cpu[cpu].mc_count == 0) {
+f0103221:	85 c0                	test   %eax,%eax
+f0103223:	74 5b                	je     f0103280 <kmem_cache_alloc+0x99>
+	if (cp->kc_cpu[cpu].mc_count > 0) {
+f0103225:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0103228:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f010322b:	c1 e0 04             	shl    $0x4,%eax
+f010322e:	8b 44 06 74          	mov    0x74(%esi,%eax,1),%eax
+f0103232:	85 c0                	test   %eax,%eax
+f0103234:	0f 8e 3a 02 00 00    	jle    f0103474 <kmem_cache_alloc+0x28d>
+		obj = cp->kc_cpu[cpu].mc_objs[--cp->kc_cpu[cpu].mc_count];
+f010323a:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f010323d:	89 d7                	mov    %edx,%edi
+f010323f:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+f0103246:	8d 14 10             	lea    (%eax,%edx,1),%edx
+f0103249:	c1 e2 04             	shl    $0x4,%edx
+f010324c:	01 f2                	add    %esi,%edx
+f010324e:	89 4a 74             	mov    %ecx,0x74(%edx)
+f0103251:	8d 1c 38             	lea    (%eax,%edi,1),%ebx
+f0103254:	8d 4c 99 1c          	lea    0x1c(%ecx,%ebx,4),%ecx
+f0103258:	8b 7c 8e 08          	mov    0x8(%esi,%ecx,4),%edi
+		cp->kc_cpu[cpu].mc_nalloc++;
+f010325c:	89 d8                	mov    %ebx,%eax
+f010325e:	c1 e0 04             	shl    $0x4,%eax
+f0103261:	8b 84 06 b8 00 00 00 	mov    0xb8(%esi,%eax,1),%eax
+f0103268:	83 c0 01             	add    $0x1,%eax
+f010326b:	89 82 b8 00 00 00    	mov    %eax,0xb8(%edx)
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0103271:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0103274:	50                   	push   %eax
+f0103275:	9d                   	popf
+}
+f0103276:	89 f8                	mov    %edi,%eax
+f0103278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010327b:	5b                   	pop    %ebx
+f010327c:	5e                   	pop    %esi
+f010327d:	5f                   	pop    %edi
+f010327e:	5d                   	pop    %ebp
+f010327f:	c3                   	ret
+		spin_lock(&cp->kc_lock);
+f0103280:	8d 46 2c             	lea    0x2c(%esi),%eax
+f0103283:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0103286:	83 ec 0c             	sub    $0xc,%esp
+f0103289:	50                   	push   %eax
+f010328a:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f010328d:	e8 3c 59 00 00       	call   f0108bce <spin_lock>
+		while (cp->kc_cpu[cpu].mc_count < KMEM_BATCH
+f0103292:	83 c4 10             	add    $0x10,%esp
+f0103295:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103298:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f010329b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010329e:	c1 e0 04             	shl    $0x4,%eax
+f01032a1:	01 f0                	add    %esi,%eax
+f01032a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		slab_remove(&cp->kc_empty, sl);
+f01032a6:	8d 46 68             	lea    0x68(%esi),%eax
+f01032a9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		while (cp->kc_cpu[cpu].mc_count < KMEM_BATCH
+f01032ac:	e9 6d 01 00 00       	jmp    f010341e <kmem_cache_alloc+0x237>
+		if (!cp->kc_empty && !slab_create(cp))
+f01032b1:	83 7e 68 00          	cmpl   $0x0,0x68(%esi)
+f01032b5:	74 2c                	je     f01032e3 <kmem_cache_alloc+0xfc>
+		sl = cp->kc_empty;
+f01032b7:	8b 5e 68             	mov    0x68(%esi),%ebx
+		slab_remove(&cp->kc_empty, sl);
+f01032ba:	89 da                	mov    %ebx,%edx
+f01032bc:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f01032bf:	e8 b7 fb ff ff       	call   f0102e7b <slab_remove>
+		cp->kc_nempty--;
+f01032c4:	83 6e 6c 01          	subl   $0x1,0x6c(%esi)
+	sl->sl_prev = NULL;
+f01032c8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	sl->sl_link = *list;
+f01032cf:	8b 46 64             	mov    0x64(%esi),%eax
+f01032d2:	89 03                	mov    %eax,(%ebx)
+	if (*list)
+f01032d4:	85 c0                	test   %eax,%eax
+f01032d6:	74 03                	je     f01032db <kmem_cache_alloc+0xf4>
+		(*list)->sl_prev = sl;
+f01032d8:	89 58 04             	mov    %ebx,0x4(%eax)
+	*list = sl;
+f01032db:	89 5e 64             	mov    %ebx,0x64(%esi)
+}
+f01032de:	e9 4f 01 00 00       	jmp    f0103432 <kmem_cache_alloc+0x24b>
+	if (!(pp = page_alloc_order(cp->kc_order, 0)))
+f01032e3:	83 ec 08             	sub    $0x8,%esp
+f01032e6:	6a 00                	push   $0x0
+f01032e8:	ff 76 1c             	push   0x1c(%esi)
+f01032eb:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f01032ee:	e8 20 ee ff ff       	call   f0102113 <page_alloc_order>
+f01032f3:	89 c7                	mov    %eax,%edi
+f01032f5:	83 c4 10             	add    $0x10,%esp
+f01032f8:	85 c0                	test   %eax,%eax
+f01032fa:	0f 84 5e 01 00 00    	je     f010345e <kmem_cache_alloc+0x277>
+	return (pp - pages) << PGSHIFT;
+f0103300:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0103306:	2b 38                	sub    (%eax),%edi
+f0103308:	c1 ff 02             	sar    $0x2,%edi
+f010330b:	69 ff ab aa aa aa    	imul   $0xaaaaaaab,%edi,%edi
+f0103311:	89 f8                	mov    %edi,%eax
+f0103313:	c1 e0 0c             	shl    $0xc,%eax
+f0103316:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	if (PGNUM(pa) >= npages)
+f0103319:	81 e7 ff ff 0f 00    	and    $0xfffff,%edi
+f010331f:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0103325:	3b 38                	cmp    (%eax),%edi
+f0103327:	73 52                	jae    f010337b <kmem_cache_alloc+0x194>
+	return (void *)(pa + KERNBASE);
+f0103329:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010332c:	8d b8 00 00 00 f0    	lea    -0x10000000(%eax),%edi
+	sl->sl_cache = cp;
+f0103332:	89 77 08             	mov    %esi,0x8(%edi)
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0103335:	8b 5e 14             	mov    0x14(%esi),%ebx
+f0103338:	8b 46 20             	mov    0x20(%esi),%eax
+f010333b:	8d 44 43 13          	lea    0x13(%ebx,%eax,2),%eax
+		+ cp->kc_color;
+f010333f:	89 c1                	mov    %eax,%ecx
+f0103341:	03 4e 28             	add    0x28(%esi),%ecx
+	return ROUNDUP(sizeof(struct Slab) + perslab * sizeof(uint16_t),
+f0103344:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103349:	f7 f3                	div    %ebx
+		+ cp->kc_color;
+f010334b:	29 d1                	sub    %edx,%ecx
+f010334d:	01 f9                	add    %edi,%ecx
+f010334f:	89 4f 0c             	mov    %ecx,0xc(%edi)
+	return MAX(CACHELINE, cp->kc_align);
+f0103352:	8b 46 14             	mov    0x14(%esi),%eax
+f0103355:	ba 40 00 00 00       	mov    $0x40,%edx
+f010335a:	39 d0                	cmp    %edx,%eax
+f010335c:	0f 42 c2             	cmovb  %edx,%eax
+	cp->kc_color += color_step(cp);
+f010335f:	03 46 28             	add    0x28(%esi),%eax
+	if (cp->kc_color > cp->kc_maxcolor)
+f0103362:	39 46 24             	cmp    %eax,0x24(%esi)
+f0103365:	73 05                	jae    f010336c <kmem_cache_alloc+0x185>
+		cp->kc_color = 0;
+f0103367:	b8 00 00 00 00       	mov    $0x0,%eax
+f010336c:	89 46 28             	mov    %eax,0x28(%esi)
+	sl->sl_nfree = cp->kc_perslab;
+f010336f:	8b 46 20             	mov    0x20(%esi),%eax
+f0103372:	66 89 47 10          	mov    %ax,0x10(%edi)
+	for (i = 0; i < cp->kc_perslab; i++) {
+f0103376:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103379:	eb 1e                	jmp    f0103399 <kmem_cache_alloc+0x1b2>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010337b:	ff 75 c4             	push   -0x3c(%ebp)
+f010337e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0103381:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0103387:	50                   	push   %eax
+f0103388:	6a 53                	push   $0x53
+f010338a:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0103390:	50                   	push   %eax
+f0103391:	e8 62 cd ff ff       	call   f01000f8 <_panic>
+f0103396:	83 c3 01             	add    $0x1,%ebx
+f0103399:	8b 46 20             	mov    0x20(%esi),%eax
+f010339c:	39 d8                	cmp    %ebx,%eax
+f010339e:	7e 25                	jle    f01033c5 <kmem_cache_alloc+0x1de>
+		sl->sl_free[i] = cp->kc_perslab - 1 - i;
+f01033a0:	83 e8 01             	sub    $0x1,%eax
+f01033a3:	29 d8                	sub    %ebx,%eax
+f01033a5:	66 89 44 5f 12       	mov    %ax,0x12(%edi,%ebx,2)
+		if (cp->kc_ctor)
+f01033aa:	8b 56 18             	mov    0x18(%esi),%edx
+f01033ad:	85 d2                	test   %edx,%edx
+f01033af:	74 e5                	je     f0103396 <kmem_cache_alloc+0x1af>
+			cp->kc_ctor(sl->sl_objs + i * cp->kc_size);
+f01033b1:	83 ec 0c             	sub    $0xc,%esp
+f01033b4:	89 d8                	mov    %ebx,%eax
+f01033b6:	0f af 46 10          	imul   0x10(%esi),%eax
+f01033ba:	03 47 0c             	add    0xc(%edi),%eax
+f01033bd:	50                   	push   %eax
+f01033be:	ff d2                	call   *%edx
+f01033c0:	83 c4 10             	add    $0x10,%esp
+f01033c3:	eb d1                	jmp    f0103396 <kmem_cache_alloc+0x1af>
+	sl->sl_prev = NULL;
+f01033c5:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	sl->sl_link = *list;
+f01033cc:	8b 46 68             	mov    0x68(%esi),%eax
+f01033cf:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01033d2:	89 81 00 00 00 f0    	mov    %eax,-0x10000000(%ecx)
+	if (*list)
+f01033d8:	85 c0                	test   %eax,%eax
+f01033da:	74 03                	je     f01033df <kmem_cache_alloc+0x1f8>
+		(*list)->sl_prev = sl;
+f01033dc:	89 78 04             	mov    %edi,0x4(%eax)
+	*list = sl;
+f01033df:	89 7e 68             	mov    %edi,0x68(%esi)
+	cp->kc_nempty++;
+f01033e2:	83 46 6c 01          	addl   $0x1,0x6c(%esi)
+	cp->kc_nslab++;
+f01033e6:	83 46 70 01          	addl   $0x1,0x70(%esi)
+f01033ea:	e9 c8 fe ff ff       	jmp    f01032b7 <kmem_cache_alloc+0xd0>
+		(*list)->sl_prev = sl;
+f01033ef:	89 58 04             	mov    %ebx,0x4(%eax)
+	*list = sl;
+f01033f2:	89 5e 60             	mov    %ebx,0x60(%esi)
+	return sl->sl_objs + sl->sl_free[sl->sl_nfree] * cp->kc_size;
+f01033f5:	0f b7 43 10          	movzwl 0x10(%ebx),%eax
+f01033f9:	0f b7 7c 43 12       	movzwl 0x12(%ebx,%eax,2),%edi
+f01033fe:	0f af 7e 10          	imul   0x10(%esi),%edi
+		       && (obj = slab_alloc(cp)))
+f0103402:	03 7b 0c             	add    0xc(%ebx),%edi
+f0103405:	74 57                	je     f010345e <kmem_cache_alloc+0x277>
+			cp->kc_cpu[cpu].mc_objs[cp->kc_cpu[cpu].mc_count++] = obj;
+f0103407:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f010340a:	8b 41 74             	mov    0x74(%ecx),%eax
+f010340d:	8d 50 01             	lea    0x1(%eax),%edx
+f0103410:	89 51 74             	mov    %edx,0x74(%ecx)
+f0103413:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0103416:	8d 44 90 1c          	lea    0x1c(%eax,%edx,4),%eax
+f010341a:	89 7c 86 08          	mov    %edi,0x8(%esi,%eax,4)
+		       && (obj = slab_alloc(cp)))
+f010341e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103421:	83 78 74 07          	cmpl   $0x7,0x74(%eax)
+f0103425:	7f 37                	jg     f010345e <kmem_cache_alloc+0x277>
+	if ((sl = cp->kc_partial) == NULL) {
+f0103427:	8b 5e 64             	mov    0x64(%esi),%ebx
+f010342a:	85 db                	test   %ebx,%ebx
+f010342c:	0f 84 7f fe ff ff    	je     f01032b1 <kmem_cache_alloc+0xca>
+	if (--sl->sl_nfree == 0) {
+f0103432:	0f b7 43 10          	movzwl 0x10(%ebx),%eax
+f0103436:	83 e8 01             	sub    $0x1,%eax
+f0103439:	66 89 43 10          	mov    %ax,0x10(%ebx)
+f010343d:	66 85 c0             	test   %ax,%ax
+f0103440:	75 b3                	jne    f01033f5 <kmem_cache_alloc+0x20e>
+		slab_remove(&cp->kc_partial, sl);
+f0103442:	8d 46 64             	lea    0x64(%esi),%eax
+f0103445:	89 da                	mov    %ebx,%edx
+f0103447:	e8 2f fa ff ff       	call   f0102e7b <slab_remove>
+	sl->sl_prev = NULL;
+f010344c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	sl->sl_link = *list;
+f0103453:	8b 46 60             	mov    0x60(%esi),%eax
+f0103456:	89 03                	mov    %eax,(%ebx)
+	if (*list)
+f0103458:	85 c0                	test   %eax,%eax
+f010345a:	75 93                	jne    f01033ef <kmem_cache_alloc+0x208>
+f010345c:	eb 94                	jmp    f01033f2 <kmem_cache_alloc+0x20b>
+		spin_unlock(&cp->kc_lock);
+f010345e:	83 ec 0c             	sub    $0xc,%esp
+f0103461:	ff 75 c8             	push   -0x38(%ebp)
+f0103464:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0103467:	e8 12 58 00 00       	call   f0108c7e <spin_unlock>
+f010346c:	83 c4 10             	add    $0x10,%esp
+f010346f:	e9 b1 fd ff ff       	jmp    f0103225 <kmem_cache_alloc+0x3e>
+		cp->kc_cpu[cpu].mc_nfail++;
+f0103474:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103477:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+f010347e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+f0103481:	c1 e2 04             	shl    $0x4,%edx
+f0103484:	8b 84 16 c0 00 00 00 	mov    0xc0(%esi,%edx,1),%eax
+f010348b:	83 c0 01             	add    $0x1,%eax
+f010348e:	89 84 16 c0 00 00 00 	mov    %eax,0xc0(%esi,%edx,1)
+f0103495:	e9 d7 fd ff ff       	jmp    f0103271 <kmem_cache_alloc+0x8a>
+
+f010349a <kmem_cache_create>:
+{
+f010349a:	55                   	push   %ebp
+f010349b:	89 e5                	mov    %esp,%ebp
+f010349d:	57                   	push   %edi
+f010349e:	56                   	push   %esi
+f010349f:	53                   	push   %ebx
+f01034a0:	83 ec 28             	sub    $0x28,%esp
+f01034a3:	e8 a7 ce ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01034a8:	81 c3 e4 1f 01 00    	add    $0x11fe4,%ebx
+	if (!(cp = kmem_cache_alloc(&cache_cache)))
+f01034ae:	8d 83 d4 ca 00 00    	lea    0xcad4(%ebx),%eax
+f01034b4:	50                   	push   %eax
+f01034b5:	e8 2d fd ff ff       	call   f01031e7 <kmem_cache_alloc>
+f01034ba:	89 c7                	mov    %eax,%edi
+f01034bc:	83 c4 10             	add    $0x10,%esp
+f01034bf:	85 c0                	test   %eax,%eax
+f01034c1:	74 3b                	je     f01034fe <kmem_cache_create+0x64>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f01034c3:	9c                   	pushf
+f01034c4:	58                   	pop    %eax
+f01034c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	asm volatile("cli");
+f01034c8:	fa                   	cli
+	spin_lock(&caches_lock);
+f01034c9:	83 ec 0c             	sub    $0xc,%esp
+f01034cc:	8d b3 f4 04 00 00    	lea    0x4f4(%ebx),%esi
+f01034d2:	56                   	push   %esi
+f01034d3:	e8 f6 56 00 00       	call   f0108bce <spin_lock>
+	cache_init(cp, name, size, align, ctor);
+f01034d8:	83 c4 08             	add    $0x8,%esp
+f01034db:	ff 75 14             	push   0x14(%ebp)
+f01034de:	ff 75 10             	push   0x10(%ebp)
+f01034e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01034e4:	8b 55 08             	mov    0x8(%ebp),%edx
+f01034e7:	89 f8                	mov    %edi,%eax
+f01034e9:	e8 b9 f9 ff ff       	call   f0102ea7 <cache_init>
+	spin_unlock(&caches_lock);
+f01034ee:	89 34 24             	mov    %esi,(%esp)
+f01034f1:	e8 88 57 00 00       	call   f0108c7e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f01034f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01034f9:	50                   	push   %eax
+f01034fa:	9d                   	popf
+	return cp;
+f01034fb:	83 c4 10             	add    $0x10,%esp
+}
+f01034fe:	89 f8                	mov    %edi,%eax
+f0103500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103503:	5b                   	pop    %ebx
+f0103504:	5e                   	pop    %esi
+f0103505:	5f                   	pop    %edi
+f0103506:	5d                   	pop    %ebp
+f0103507:	c3                   	ret
+
+f0103508 <kmem_cache_free>:
+{
+f0103508:	55                   	push   %ebp
+f0103509:	89 e5                	mov    %esp,%ebp
+f010350b:	57                   	push   %edi
+f010350c:	56                   	push   %esi
+f010350d:	53                   	push   %ebx
+f010350e:	83 ec 2c             	sub    $0x2c,%esp
+f0103511:	e8 39 ce ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103516:	81 c3 76 1f 01 00    	add    $0x11f76,%ebx
+f010351c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f010351f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0103522:	9c                   	pushf
+f0103523:	58                   	pop    %eax
+f0103524:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	asm volatile("cli");
+f0103527:	fa                   	cli
+	cpu = cpunum();
+f0103528:	e8 92 53 00 00       	call   f01088bf <cpunum>
+f010352d:	89 c6                	mov    %eax,%esi
+	if (cp->kc_cpu[cpu].mc_count == KMEM_MAG) {
+f010352f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0103532:	c1 e0 04             	shl    $0x4,%eax
+f0103535:	83 7c 07 74 10       	cmpl   $0x10,0x74(%edi,%eax,1)
+f010353a:	74 48                	je     f0103584 <kmem_cache_free+0x7c>
+	cp->kc_cpu[cpu].mc_objs[cp->kc_cpu[cpu].mc_count++] = obj;
+f010353c:	8d 14 b5 00 00 00 00 	lea    0x0(,%esi,4),%edx
+f0103543:	8d 04 32             	lea    (%edx,%esi,1),%eax
+f0103546:	c1 e0 04             	shl    $0x4,%eax
+f0103549:	01 f8                	add    %edi,%eax
+f010354b:	8b 48 74             	mov    0x74(%eax),%ecx
+f010354e:	8d 59 01             	lea    0x1(%ecx),%ebx
+f0103551:	89 58 74             	mov    %ebx,0x74(%eax)
+f0103554:	8d 1c 32             	lea    (%edx,%esi,1),%ebx
+f0103557:	8d 4c 99 1c          	lea    0x1c(%ecx,%ebx,4),%ecx
+f010355b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010355e:	89 5c 8f 08          	mov    %ebx,0x8(%edi,%ecx,4)
+	cp->kc_cpu[cpu].mc_nfree++;
+f0103562:	01 f2                	add    %esi,%edx
+f0103564:	c1 e2 04             	shl    $0x4,%edx
+f0103567:	8b 94 17 bc 00 00 00 	mov    0xbc(%edi,%edx,1),%edx
+f010356e:	83 c2 01             	add    $0x1,%edx
+f0103571:	89 90 bc 00 00 00    	mov    %edx,0xbc(%eax)
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0103577:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010357a:	50                   	push   %eax
+f010357b:	9d                   	popf
+}
+f010357c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010357f:	5b                   	pop    %ebx
+f0103580:	5e                   	pop    %esi
+f0103581:	5f                   	pop    %edi
+f0103582:	5d                   	pop    %ebp
+f0103583:	c3                   	ret
+		spin_lock(&cp->kc_lock);
+f0103584:	8d 47 2c             	lea    0x2c(%edi),%eax
+f0103587:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010358a:	83 ec 0c             	sub    $0xc,%esp
+f010358d:	50                   	push   %eax
+f010358e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103591:	e8 38 56 00 00       	call   f0108bce <spin_lock>
+f0103596:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+f0103599:	c1 e0 04             	shl    $0x4,%eax
+f010359c:	8d 4c 07 78          	lea    0x78(%edi,%eax,1),%ecx
+f01035a0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f01035a3:	89 cb                	mov    %ecx,%ebx
+f01035a5:	8d 84 07 98 00 00 00 	lea    0x98(%edi,%eax,1),%eax
+		for (i = 0; i < KMEM_BATCH; i++)
+f01035ac:	83 c4 10             	add    $0x10,%esp
+f01035af:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+f01035b2:	89 c6                	mov    %eax,%esi
+f01035b4:	eb 0c                	jmp    f01035c2 <kmem_cache_free+0xba>
+			slab_free(cp, cp->kc_cpu[cpu].mc_objs[i]);
+f01035b6:	8b 13                	mov    (%ebx),%edx
+f01035b8:	89 f8                	mov    %edi,%eax
+f01035ba:	e8 b0 fa ff ff       	call   f010306f <slab_free>
+f01035bf:	83 c3 04             	add    $0x4,%ebx
+		for (i = 0; i < KMEM_BATCH; i++)
+f01035c2:	39 f3                	cmp    %esi,%ebx
+f01035c4:	75 f0                	jne    f01035b6 <kmem_cache_free+0xae>
+		spin_unlock(&cp->kc_lock);
+f01035c6:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f01035c9:	83 ec 0c             	sub    $0xc,%esp
+f01035cc:	ff 75 dc             	push   -0x24(%ebp)
+f01035cf:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01035d2:	e8 a7 56 00 00       	call   f0108c7e <spin_unlock>
+		cp->kc_cpu[cpu].mc_count -= KMEM_BATCH;
+f01035d7:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+f01035da:	c1 e2 04             	shl    $0x4,%edx
+f01035dd:	01 fa                	add    %edi,%edx
+f01035df:	8b 42 74             	mov    0x74(%edx),%eax
+f01035e2:	83 e8 08             	sub    $0x8,%eax
+f01035e5:	89 42 74             	mov    %eax,0x74(%edx)
+		memmove(cp->kc_cpu[cpu].mc_objs,
+f01035e8:	83 c4 0c             	add    $0xc,%esp
+f01035eb:	c1 e0 02             	shl    $0x2,%eax
+f01035ee:	50                   	push   %eax
+f01035ef:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01035f2:	8d 41 20             	lea    0x20(%ecx),%eax
+f01035f5:	50                   	push   %eax
+f01035f6:	51                   	push   %ecx
+f01035f7:	e8 47 4b 00 00       	call   f0108143 <memmove>
+f01035fc:	83 c4 10             	add    $0x10,%esp
+f01035ff:	e9 38 ff ff ff       	jmp    f010353c <kmem_cache_free+0x34>
+
+f0103604 <kmem_cache_destroy>:
+{
+f0103604:	55                   	push   %ebp
+f0103605:	89 e5                	mov    %esp,%ebp
+f0103607:	57                   	push   %edi
+f0103608:	56                   	push   %esi
+f0103609:	53                   	push   %ebx
+f010360a:	83 ec 28             	sub    $0x28,%esp
+f010360d:	e8 3d cd ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103612:	81 c3 7a 1e 01 00    	add    $0x11e7a,%ebx
+f0103618:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+f010361b:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f010361e:	9c                   	pushf
+f010361f:	58                   	pop    %eax
+f0103620:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	asm volatile("cli");
+f0103623:	fa                   	cli
+	spin_lock(&caches_lock);
+f0103624:	8d 83 f4 04 00 00    	lea    0x4f4(%ebx),%eax
+f010362a:	50                   	push   %eax
+f010362b:	e8 9e 55 00 00       	call   f0108bce <spin_lock>
+	spin_lock(&cp->kc_lock);
+f0103630:	8d 46 2c             	lea    0x2c(%esi),%eax
+f0103633:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0103636:	89 04 24             	mov    %eax,(%esp)
+f0103639:	e8 90 55 00 00       	call   f0108bce <spin_lock>
+f010363e:	8d 7e 74             	lea    0x74(%esi),%edi
+f0103641:	83 c4 10             	add    $0x10,%esp
+	for (cpu = 0; cpu < NCPU; cpu++)
+f0103644:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103649:	eb 17                	jmp    f0103662 <kmem_cache_destroy+0x5e>
+			slab_free(cp, cp->kc_cpu[cpu].mc_objs[--cp->kc_cpu[cpu].mc_count]);
+f010364b:	83 e8 01             	sub    $0x1,%eax
+f010364e:	89 07                	mov    %eax,(%edi)
+f0103650:	8d 14 9b             	lea    (%ebx,%ebx,4),%edx
+f0103653:	8d 44 90 1c          	lea    0x1c(%eax,%edx,4),%eax
+f0103657:	8b 54 86 08          	mov    0x8(%esi,%eax,4),%edx
+f010365b:	89 f0                	mov    %esi,%eax
+f010365d:	e8 0d fa ff ff       	call   f010306f <slab_free>
+		while (cp->kc_cpu[cpu].mc_count > 0)
+f0103662:	8b 07                	mov    (%edi),%eax
+f0103664:	85 c0                	test   %eax,%eax
+f0103666:	7f e3                	jg     f010364b <kmem_cache_destroy+0x47>
+	for (cpu = 0; cpu < NCPU; cpu++)
+f0103668:	83 c3 01             	add    $0x1,%ebx
+f010366b:	83 c7 50             	add    $0x50,%edi
+f010366e:	83 fb 08             	cmp    $0x8,%ebx
+f0103671:	75 ef                	jne    f0103662 <kmem_cache_destroy+0x5e>
+	if (cp->kc_full || cp->kc_partial)
+f0103673:	83 7e 60 00          	cmpl   $0x0,0x60(%esi)
+f0103677:	75 57                	jne    f01036d0 <kmem_cache_destroy+0xcc>
+f0103679:	83 7e 64 00          	cmpl   $0x0,0x64(%esi)
+f010367d:	75 51                	jne    f01036d0 <kmem_cache_destroy+0xcc>
+	if (cp->kc_empty)
+f010367f:	8b 46 68             	mov    0x68(%esi),%eax
+f0103682:	85 c0                	test   %eax,%eax
+f0103684:	74 39                	je     f01036bf <kmem_cache_destroy+0xbb>
+	if ((uint32_t)kva < KERNBASE)
+f0103686:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010368b:	76 5f                	jbe    f01036ec <kmem_cache_destroy+0xe8>
+	return (physaddr_t)kva - KERNBASE;
+f010368d:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0103692:	c1 e8 0c             	shr    $0xc,%eax
+f0103695:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0103698:	c7 c2 0c 43 15 f0    	mov    $0xf015430c,%edx
+f010369e:	3b 02                	cmp    (%edx),%eax
+f01036a0:	73 66                	jae    f0103708 <kmem_cache_destroy+0x104>
+		page_free(pa2page(PADDR(cp->kc_empty)));
+f01036a2:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f01036a5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f01036a8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01036ab:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f01036b1:	8b 00                	mov    (%eax),%eax
+f01036b3:	8d 04 90             	lea    (%eax,%edx,4),%eax
+f01036b6:	50                   	push   %eax
+f01036b7:	e8 27 eb ff ff       	call   f01021e3 <page_free>
+f01036bc:	83 c4 10             	add    $0x10,%esp
+	for (pcp = &caches; *pcp != cp; pcp = &(*pcp)->kc_next)
+f01036bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01036c2:	8b 81 b4 ca 00 00    	mov    0xcab4(%ecx),%eax
+f01036c8:	8d 91 b4 ca 00 00    	lea    0xcab4(%ecx),%edx
+f01036ce:	eb 5e                	jmp    f010372e <kmem_cache_destroy+0x12a>
+		panic("kmem_cache_destroy: %s objects still in use",
+f01036d0:	56                   	push   %esi
+f01036d1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01036d4:	8d 83 20 56 ff ff    	lea    -0xa9e0(%ebx),%eax
+f01036da:	50                   	push   %eax
+f01036db:	68 22 01 00 00       	push   $0x122
+f01036e0:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f01036e6:	50                   	push   %eax
+f01036e7:	e8 0c ca ff ff       	call   f01000f8 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01036ec:	50                   	push   %eax
+f01036ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01036f0:	8d 83 e8 52 ff ff    	lea    -0xad18(%ebx),%eax
+f01036f6:	50                   	push   %eax
+f01036f7:	68 25 01 00 00       	push   $0x125
+f01036fc:	8d 83 ff 57 ff ff    	lea    -0xa801(%ebx),%eax
+f0103702:	50                   	push   %eax
+f0103703:	e8 f0 c9 ff ff       	call   f01000f8 <_panic>
+		panic("pa2page called with invalid pa");
+f0103708:	83 ec 04             	sub    $0x4,%esp
+f010370b:	89 cb                	mov    %ecx,%ebx
+f010370d:	8d 81 00 56 ff ff    	lea    -0xaa00(%ecx),%eax
+f0103713:	50                   	push   %eax
+f0103714:	6a 4c                	push   $0x4c
+f0103716:	8d 81 2c 51 ff ff    	lea    -0xaed4(%ecx),%eax
+f010371c:	50                   	push   %eax
+f010371d:	e8 d6 c9 ff ff       	call   f01000f8 <_panic>
+	for (pcp = &caches; *pcp != cp; pcp = &(*pcp)->kc_next)
+f0103722:	8d 90 f4 02 00 00    	lea    0x2f4(%eax),%edx
+f0103728:	8b 80 f4 02 00 00    	mov    0x2f4(%eax),%eax
+f010372e:	39 f0                	cmp    %esi,%eax
+f0103730:	75 f0                	jne    f0103722 <kmem_cache_destroy+0x11e>
+	*pcp = cp->kc_next;
+f0103732:	8b 86 f4 02 00 00    	mov    0x2f4(%esi),%eax
+f0103738:	89 02                	mov    %eax,(%edx)
+	spin_unlock(&cp->kc_lock);
+f010373a:	83 ec 0c             	sub    $0xc,%esp
+f010373d:	ff 75 e0             	push   -0x20(%ebp)
+f0103740:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f0103743:	e8 36 55 00 00       	call   f0108c7e <spin_unlock>
+	spin_unlock(&caches_lock);
+f0103748:	8d 83 f4 04 00 00    	lea    0x4f4(%ebx),%eax
+f010374e:	89 04 24             	mov    %eax,(%esp)
+f0103751:	e8 28 55 00 00       	call   f0108c7e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0103756:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0103759:	50                   	push   %eax
+f010375a:	9d                   	popf
+	kmem_cache_free(&cache_cache, cp);
+f010375b:	83 c4 08             	add    $0x8,%esp
+f010375e:	56                   	push   %esi
+f010375f:	8d 83 d4 ca 00 00    	lea    0xcad4(%ebx),%eax
+f0103765:	50                   	push   %eax
+f0103766:	e8 9d fd ff ff       	call   f0103508 <kmem_cache_free>
+}
+f010376b:	83 c4 10             	add    $0x10,%esp
+f010376e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103771:	5b                   	pop    %ebx
+f0103772:	5e                   	pop    %esi
+f0103773:	5f                   	pop    %edi
+f0103774:	5d                   	pop    %ebp
+f0103775:	c3                   	ret
+
+f0103776 <kmem_print_stats>:
+{
+f0103776:	55                   	push   %ebp
+f0103777:	89 e5                	mov    %esp,%ebp
+f0103779:	57                   	push   %edi
+f010377a:	56                   	push   %esi
+f010377b:	53                   	push   %ebx
+f010377c:	83 ec 1c             	sub    $0x1c,%esp
+f010377f:	e8 cb cb ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103784:	81 c3 08 1d 01 00    	add    $0x11d08,%ebx
+	cprintf("%-15s %5s %10s %5s %5s %9s %9s\n", "cache", "size",
+f010378a:	8d 83 18 58 ff ff    	lea    -0xa7e8(%ebx),%eax
+f0103790:	50                   	push   %eax
+f0103791:	8d 83 1f 58 ff ff    	lea    -0xa7e1(%ebx),%eax
+f0103797:	50                   	push   %eax
+f0103798:	8d 83 25 58 ff ff    	lea    -0xa7db(%ebx),%eax
+f010379e:	50                   	push   %eax
+f010379f:	8d 83 2b 58 ff ff    	lea    -0xa7d5(%ebx),%eax
+f01037a5:	50                   	push   %eax
+f01037a6:	8d 83 30 58 ff ff    	lea    -0xa7d0(%ebx),%eax
+f01037ac:	50                   	push   %eax
+f01037ad:	8d 83 3b 58 ff ff    	lea    -0xa7c5(%ebx),%eax
+f01037b3:	50                   	push   %eax
+f01037b4:	8d 83 45 58 ff ff    	lea    -0xa7bb(%ebx),%eax
+f01037ba:	50                   	push   %eax
+f01037bb:	8d 83 4c 56 ff ff    	lea    -0xa9b4(%ebx),%eax
+f01037c1:	50                   	push   %eax
+f01037c2:	e8 cb 08 00 00       	call   f0104092 <cprintf>
+	for (cp = caches; cp; cp = cp->kc_next) {
+f01037c7:	8b b3 b4 ca 00 00    	mov    0xcab4(%ebx),%esi
+f01037cd:	83 c4 20             	add    $0x20,%esp
+		cprintf("%-15s %5u %10d %5d %5u %9u %9u\n", cp->kc_name,
+f01037d0:	8d 83 6c 56 ff ff    	lea    -0xa994(%ebx),%eax
+f01037d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (cp = caches; cp; cp = cp->kc_next) {
+f01037d9:	eb 36                	jmp    f0103811 <kmem_print_stats+0x9b>
+		*nalloc += cp->kc_cpu[cpu].mc_nalloc;
+f01037db:	03 10                	add    (%eax),%edx
+		*nfree += cp->kc_cpu[cpu].mc_nfree;
+f01037dd:	03 48 04             	add    0x4(%eax),%ecx
+f01037e0:	83 c0 50             	add    $0x50,%eax
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f01037e3:	39 c7                	cmp    %eax,%edi
+f01037e5:	75 f4                	jne    f01037db <kmem_print_stats+0x65>
+		cprintf("%-15s %5u %10d %5d %5u %9u %9u\n", cp->kc_name,
+f01037e7:	52                   	push   %edx
+f01037e8:	29 ca                	sub    %ecx,%edx
+f01037ea:	52                   	push   %edx
+f01037eb:	ff 76 70             	push   0x70(%esi)
+f01037ee:	ff 76 20             	push   0x20(%esi)
+f01037f1:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+f01037f4:	b8 01 00 00 00       	mov    $0x1,%eax
+f01037f9:	d3 e0                	shl    %cl,%eax
+f01037fb:	50                   	push   %eax
+f01037fc:	ff 76 10             	push   0x10(%esi)
+f01037ff:	56                   	push   %esi
+f0103800:	ff 75 e4             	push   -0x1c(%ebp)
+f0103803:	e8 8a 08 00 00       	call   f0104092 <cprintf>
+	for (cp = caches; cp; cp = cp->kc_next) {
+f0103808:	8b b6 f4 02 00 00    	mov    0x2f4(%esi),%esi
+f010380e:	83 c4 20             	add    $0x20,%esp
+f0103811:	85 f6                	test   %esi,%esi
+f0103813:	74 18                	je     f010382d <kmem_print_stats+0xb7>
+f0103815:	8d 86 b8 00 00 00    	lea    0xb8(%esi),%eax
+f010381b:	8d be 38 03 00 00    	lea    0x338(%esi),%edi
+	*nalloc = *nfree = 0;
+f0103821:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0103826:	ba 00 00 00 00       	mov    $0x0,%edx
+f010382b:	eb b6                	jmp    f01037e3 <kmem_print_stats+0x6d>
+}
+f010382d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103830:	5b                   	pop    %ebx
+f0103831:	5e                   	pop    %esi
+f0103832:	5f                   	pop    %edi
+f0103833:	5d                   	pop    %ebp
+f0103834:	c3                   	ret
+
+f0103835 <kmem_init>:
+}
+
+// Set up the cache of caches.  Call after mem_init().
+void
+kmem_init(void)
+{
+f0103835:	55                   	push   %ebp
+f0103836:	89 e5                	mov    %esp,%ebp
+f0103838:	57                   	push   %edi
+f0103839:	56                   	push   %esi
+f010383a:	53                   	push   %ebx
+f010383b:	83 ec 24             	sub    $0x24,%esp
+f010383e:	e8 ab d7 ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0103843:	81 c7 49 1c 01 00    	add    $0x11c49,%edi
+	cache_init(&cache_cache, "kmem_cache", sizeof(struct Kmemcache),
+f0103849:	6a 00                	push   $0x0
+f010384b:	6a 40                	push   $0x40
+f010384d:	b9 f8 02 00 00       	mov    $0x2f8,%ecx
+f0103852:	8d 97 40 58 ff ff    	lea    -0xa7c0(%edi),%edx
+f0103858:	8d 87 d4 ca 00 00    	lea    0xcad4(%edi),%eax
+f010385e:	e8 44 f6 ff ff       	call   f0102ea7 <cache_init>
+	assert((cp = kmem_cache_create("check", 40, CACHELINE, check_ctor)));
+f0103863:	8d 87 0d da fe ff    	lea    -0x125f3(%edi),%eax
+f0103869:	50                   	push   %eax
+f010386a:	6a 40                	push   $0x40
+f010386c:	6a 28                	push   $0x28
+f010386e:	8d 87 4b 58 ff ff    	lea    -0xa7b5(%edi),%eax
+f0103874:	50                   	push   %eax
+f0103875:	e8 20 fc ff ff       	call   f010349a <kmem_cache_create>
+f010387a:	83 c4 20             	add    $0x20,%esp
+f010387d:	85 c0                	test   %eax,%eax
+f010387f:	74 12                	je     f0103893 <kmem_init+0x5e>
+f0103881:	89 c6                	mov    %eax,%esi
+	assert(cp->kc_size == CACHELINE);
+f0103883:	83 78 10 40          	cmpl   $0x40,0x10(%eax)
+f0103887:	75 2b                	jne    f01038b4 <kmem_init+0x7f>
+	for (i = 0; i < ARRAY_SIZE(objs); i++) {
+f0103889:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010388e:	e9 d1 00 00 00       	jmp    f0103964 <kmem_init+0x12f>
+	assert((cp = kmem_cache_create("check", 40, CACHELINE, check_ctor)));
+f0103893:	8d 87 8c 56 ff ff    	lea    -0xa974(%edi),%eax
+f0103899:	50                   	push   %eax
+f010389a:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f01038a0:	50                   	push   %eax
+f01038a1:	68 9e 01 00 00       	push   $0x19e
+f01038a6:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f01038ac:	50                   	push   %eax
+f01038ad:	89 fb                	mov    %edi,%ebx
+f01038af:	e8 44 c8 ff ff       	call   f01000f8 <_panic>
+	assert(cp->kc_size == CACHELINE);
+f01038b4:	8d 87 51 58 ff ff    	lea    -0xa7af(%edi),%eax
+f01038ba:	50                   	push   %eax
+f01038bb:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f01038c1:	50                   	push   %eax
+f01038c2:	68 9f 01 00 00       	push   $0x19f
+f01038c7:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f01038cd:	50                   	push   %eax
+f01038ce:	89 fb                	mov    %edi,%ebx
+f01038d0:	e8 23 c8 ff ff       	call   f01000f8 <_panic>
+		assert((objs[i] = kmem_cache_alloc(cp)));
+f01038d5:	8d 87 cc 56 ff ff    	lea    -0xa934(%edi),%eax
+f01038db:	50                   	push   %eax
+f01038dc:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f01038e2:	50                   	push   %eax
+f01038e3:	68 a2 01 00 00       	push   $0x1a2
+f01038e8:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f01038ee:	50                   	push   %eax
+f01038ef:	89 fb                	mov    %edi,%ebx
+f01038f1:	e8 02 c8 ff ff       	call   f01000f8 <_panic>
+		assert((uintptr_t) objs[i] % CACHELINE == 0);
+f01038f6:	8d 87 f0 56 ff ff    	lea    -0xa910(%edi),%eax
+f01038fc:	50                   	push   %eax
+f01038fd:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103903:	50                   	push   %eax
+f0103904:	68 a3 01 00 00       	push   $0x1a3
+f0103909:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f010390f:	50                   	push   %eax
+f0103910:	89 fb                	mov    %edi,%ebx
+f0103912:	e8 e1 c7 ff ff       	call   f01000f8 <_panic>
+		assert(*(uint32_t *) objs[i] == CHECK_MAGIC);
+f0103917:	8d 87 18 57 ff ff    	lea    -0xa8e8(%edi),%eax
+f010391d:	50                   	push   %eax
+f010391e:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103924:	50                   	push   %eax
+f0103925:	68 a4 01 00 00       	push   $0x1a4
+f010392a:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103930:	50                   	push   %eax
+f0103931:	89 fb                	mov    %edi,%ebx
+f0103933:	e8 c0 c7 ff ff       	call   f01000f8 <_panic>
+			assert(objs[j] != objs[i]);
+f0103938:	8d 87 6a 58 ff ff    	lea    -0xa796(%edi),%eax
+f010393e:	50                   	push   %eax
+f010393f:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103945:	50                   	push   %eax
+f0103946:	68 a6 01 00 00       	push   $0x1a6
+f010394b:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103951:	50                   	push   %eax
+f0103952:	89 fb                	mov    %edi,%ebx
+f0103954:	e8 9f c7 ff ff       	call   f01000f8 <_panic>
+	for (i = 0; i < ARRAY_SIZE(objs); i++) {
+f0103959:	83 c3 01             	add    $0x1,%ebx
+f010395c:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+f0103962:	74 45                	je     f01039a9 <kmem_init+0x174>
+		assert((objs[i] = kmem_cache_alloc(cp)));
+f0103964:	83 ec 0c             	sub    $0xc,%esp
+f0103967:	56                   	push   %esi
+f0103968:	e8 7a f8 ff ff       	call   f01031e7 <kmem_cache_alloc>
+f010396d:	89 84 9f 94 c7 00 00 	mov    %eax,0xc794(%edi,%ebx,4)
+f0103974:	83 c4 10             	add    $0x10,%esp
+f0103977:	85 c0                	test   %eax,%eax
+f0103979:	0f 84 56 ff ff ff    	je     f01038d5 <kmem_init+0xa0>
+		assert((uintptr_t) objs[i] % CACHELINE == 0);
+f010397f:	89 c1                	mov    %eax,%ecx
+f0103981:	83 e1 3f             	and    $0x3f,%ecx
+f0103984:	0f 85 6c ff ff ff    	jne    f01038f6 <kmem_init+0xc1>
+		assert(*(uint32_t *) objs[i] == CHECK_MAGIC);
+f010398a:	81 38 6d 65 6d 6b    	cmpl   $0x6b6d656d,(%eax)
+f0103990:	75 85                	jne    f0103917 <kmem_init+0xe2>
+		for (j = 0; j < i; j++)
+f0103992:	ba 00 00 00 00       	mov    $0x0,%edx
+f0103997:	39 da                	cmp    %ebx,%edx
+f0103999:	7d be                	jge    f0103959 <kmem_init+0x124>
+			assert(objs[j] != objs[i]);
+f010399b:	3b 84 97 94 c7 00 00 	cmp    0xc794(%edi,%edx,4),%eax
+f01039a2:	74 94                	je     f0103938 <kmem_init+0x103>
+		for (j = 0; j < i; j++)
+f01039a4:	83 c2 01             	add    $0x1,%edx
+f01039a7:	eb ee                	jmp    f0103997 <kmem_init+0x162>
+	nslab = cp->kc_nslab;
+f01039a9:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+f01039ac:	8b 46 70             	mov    0x70(%esi),%eax
+f01039af:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	assert(nslab > 1);
+f01039b2:	83 f8 01             	cmp    $0x1,%eax
+f01039b5:	0f 86 8f 00 00 00    	jbe    f0103a4a <kmem_init+0x215>
+	first = ROUNDDOWN(objs[0], PGSIZE << cp->kc_order);
+f01039bb:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+f01039be:	b8 00 f0 ff ff       	mov    $0xfffff000,%eax
+f01039c3:	d3 e0                	shl    %cl,%eax
+f01039c5:	89 c2                	mov    %eax,%edx
+f01039c7:	23 97 94 c7 00 00    	and    0xc794(%edi),%edx
+	last = ROUNDDOWN(objs[ARRAY_SIZE(objs) - 1], PGSIZE << cp->kc_order);
+f01039cd:	23 87 b0 ca 00 00    	and    0xcab0(%edi),%eax
+	assert(first != last);
+f01039d3:	39 c2                	cmp    %eax,%edx
+f01039d5:	0f 84 90 00 00 00    	je     f0103a6b <kmem_init+0x236>
+	assert(cp->kc_maxcolor == 0
+f01039db:	83 7e 24 00          	cmpl   $0x0,0x24(%esi)
+f01039df:	74 13                	je     f01039f4 <kmem_init+0x1bf>
+f01039e1:	8b 52 0c             	mov    0xc(%edx),%edx
+f01039e4:	33 50 0c             	xor    0xc(%eax),%edx
+f01039e7:	89 d0                	mov    %edx,%eax
+f01039e9:	a9 ff 0f 00 00       	test   $0xfff,%eax
+f01039ee:	0f 84 98 00 00 00    	je     f0103a8c <kmem_init+0x257>
+	kmem_cache_free(cp, objs[7]);
+f01039f4:	83 ec 08             	sub    $0x8,%esp
+f01039f7:	ff b7 b0 c7 00 00    	push   0xc7b0(%edi)
+f01039fd:	56                   	push   %esi
+f01039fe:	e8 05 fb ff ff       	call   f0103508 <kmem_cache_free>
+	assert(kmem_cache_alloc(cp) == objs[7]);
+f0103a03:	89 34 24             	mov    %esi,(%esp)
+f0103a06:	e8 dc f7 ff ff       	call   f01031e7 <kmem_cache_alloc>
+f0103a0b:	83 c4 10             	add    $0x10,%esp
+f0103a0e:	39 87 b0 c7 00 00    	cmp    %eax,0xc7b0(%edi)
+f0103a14:	0f 85 93 00 00 00    	jne    f0103aad <kmem_init+0x278>
+f0103a1a:	8d 9f 94 c7 00 00    	lea    0xc794(%edi),%ebx
+f0103a20:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+f0103a23:	8d 83 20 03 00 00    	lea    0x320(%ebx),%eax
+f0103a29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < ARRAY_SIZE(objs); i++)
+f0103a2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103a2f:	39 c3                	cmp    %eax,%ebx
+f0103a31:	0f 84 97 00 00 00    	je     f0103ace <kmem_init+0x299>
+		kmem_cache_free(cp, objs[i]);
+f0103a37:	83 ec 08             	sub    $0x8,%esp
+f0103a3a:	ff 33                	push   (%ebx)
+f0103a3c:	56                   	push   %esi
+f0103a3d:	e8 c6 fa ff ff       	call   f0103508 <kmem_cache_free>
+f0103a42:	83 c3 04             	add    $0x4,%ebx
+f0103a45:	83 c4 10             	add    $0x10,%esp
+f0103a48:	eb e2                	jmp    f0103a2c <kmem_init+0x1f7>
+	assert(nslab > 1);
+f0103a4a:	8d 87 c0 58 ff ff    	lea    -0xa740(%edi),%eax
+f0103a50:	50                   	push   %eax
+f0103a51:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103a57:	50                   	push   %eax
+f0103a58:	68 aa 01 00 00       	push   $0x1aa
+f0103a5d:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103a63:	50                   	push   %eax
+f0103a64:	89 fb                	mov    %edi,%ebx
+f0103a66:	e8 8d c6 ff ff       	call   f01000f8 <_panic>
+	assert(first != last);
+f0103a6b:	8d 87 7d 58 ff ff    	lea    -0xa783(%edi),%eax
+f0103a71:	50                   	push   %eax
+f0103a72:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103a78:	50                   	push   %eax
+f0103a79:	68 ad 01 00 00       	push   $0x1ad
+f0103a7e:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103a84:	50                   	push   %eax
+f0103a85:	89 fb                	mov    %edi,%ebx
+f0103a87:	e8 6c c6 ff ff       	call   f01000f8 <_panic>
+	assert(cp->kc_maxcolor == 0
+f0103a8c:	8d 87 40 57 ff ff    	lea    -0xa8c0(%edi),%eax
+f0103a92:	50                   	push   %eax
+f0103a93:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103a99:	50                   	push   %eax
+f0103a9a:	68 ae 01 00 00       	push   $0x1ae
+f0103a9f:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103aa5:	50                   	push   %eax
+f0103aa6:	89 fb                	mov    %edi,%ebx
+f0103aa8:	e8 4b c6 ff ff       	call   f01000f8 <_panic>
+	assert(kmem_cache_alloc(cp) == objs[7]);
+f0103aad:	8d 87 88 57 ff ff    	lea    -0xa878(%edi),%eax
+f0103ab3:	50                   	push   %eax
+f0103ab4:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103aba:	50                   	push   %eax
+f0103abb:	68 b3 01 00 00       	push   $0x1b3
+f0103ac0:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103ac6:	50                   	push   %eax
+f0103ac7:	89 fb                	mov    %edi,%ebx
+f0103ac9:	e8 2a c6 ff ff       	call   f01000f8 <_panic>
+f0103ace:	8d 86 b8 00 00 00    	lea    0xb8(%esi),%eax
+f0103ad4:	8d 8e 38 03 00 00    	lea    0x338(%esi),%ecx
+	*nalloc = *nfree = 0;
+f0103ada:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f0103add:	89 da                	mov    %ebx,%edx
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f0103adf:	39 c8                	cmp    %ecx,%eax
+f0103ae1:	74 0a                	je     f0103aed <kmem_init+0x2b8>
+		*nalloc += cp->kc_cpu[cpu].mc_nalloc;
+f0103ae3:	03 18                	add    (%eax),%ebx
+		*nfree += cp->kc_cpu[cpu].mc_nfree;
+f0103ae5:	03 50 04             	add    0x4(%eax),%edx
+f0103ae8:	83 c0 50             	add    $0x50,%eax
+f0103aeb:	eb f2                	jmp    f0103adf <kmem_init+0x2aa>
+	assert(nalloc == nfree);
+f0103aed:	39 d3                	cmp    %edx,%ebx
+f0103aef:	0f 85 8f 00 00 00    	jne    f0103b84 <kmem_init+0x34f>
+	assert(cp->kc_nslab < nslab);
+f0103af5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0103af8:	39 46 70             	cmp    %eax,0x70(%esi)
+f0103afb:	0f 83 a4 00 00 00    	jae    f0103ba5 <kmem_init+0x370>
+	kmem_cache_destroy(cp);
+f0103b01:	83 ec 0c             	sub    $0xc,%esp
+f0103b04:	56                   	push   %esi
+f0103b05:	e8 fa fa ff ff       	call   f0103604 <kmem_cache_destroy>
+	assert((cp = kmem_cache_create("check128", 200, 128, NULL)));
+f0103b0a:	6a 00                	push   $0x0
+f0103b0c:	68 80 00 00 00       	push   $0x80
+f0103b11:	68 c8 00 00 00       	push   $0xc8
+f0103b16:	8d 87 b0 58 ff ff    	lea    -0xa750(%edi),%eax
+f0103b1c:	50                   	push   %eax
+f0103b1d:	e8 78 f9 ff ff       	call   f010349a <kmem_cache_create>
+f0103b22:	89 c6                	mov    %eax,%esi
+f0103b24:	83 c4 20             	add    $0x20,%esp
+f0103b27:	85 c0                	test   %eax,%eax
+f0103b29:	0f 84 97 00 00 00    	je     f0103bc6 <kmem_init+0x391>
+f0103b2f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0103b32:	8d 83 a0 00 00 00    	lea    0xa0(%ebx),%eax
+f0103b38:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < 40; i++) {
+f0103b3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103b3e:	39 c3                	cmp    %eax,%ebx
+f0103b40:	0f 84 c2 00 00 00    	je     f0103c08 <kmem_init+0x3d3>
+		assert((objs[i] = kmem_cache_alloc(cp)));
+f0103b46:	83 ec 0c             	sub    $0xc,%esp
+f0103b49:	56                   	push   %esi
+f0103b4a:	e8 98 f6 ff ff       	call   f01031e7 <kmem_cache_alloc>
+f0103b4f:	89 03                	mov    %eax,(%ebx)
+f0103b51:	83 c4 10             	add    $0x10,%esp
+f0103b54:	85 c0                	test   %eax,%eax
+f0103b56:	0f 84 8b 00 00 00    	je     f0103be7 <kmem_init+0x3b2>
+		assert((uintptr_t) objs[i] % 128 == 0);
+f0103b5c:	83 c3 04             	add    $0x4,%ebx
+f0103b5f:	a8 7f                	test   $0x7f,%al
+f0103b61:	74 d8                	je     f0103b3b <kmem_init+0x306>
+f0103b63:	8d 87 e0 57 ff ff    	lea    -0xa820(%edi),%eax
+f0103b69:	50                   	push   %eax
+f0103b6a:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103b70:	50                   	push   %eax
+f0103b71:	68 c0 01 00 00       	push   $0x1c0
+f0103b76:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103b7c:	50                   	push   %eax
+f0103b7d:	89 fb                	mov    %edi,%ebx
+f0103b7f:	e8 74 c5 ff ff       	call   f01000f8 <_panic>
+	assert(nalloc == nfree);
+f0103b84:	8d 87 8b 58 ff ff    	lea    -0xa775(%edi),%eax
+f0103b8a:	50                   	push   %eax
+f0103b8b:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103b91:	50                   	push   %eax
+f0103b92:	68 b8 01 00 00       	push   $0x1b8
+f0103b97:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103b9d:	50                   	push   %eax
+f0103b9e:	89 fb                	mov    %edi,%ebx
+f0103ba0:	e8 53 c5 ff ff       	call   f01000f8 <_panic>
+	assert(cp->kc_nslab < nslab);
+f0103ba5:	8d 87 9b 58 ff ff    	lea    -0xa765(%edi),%eax
+f0103bab:	50                   	push   %eax
+f0103bac:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103bb2:	50                   	push   %eax
+f0103bb3:	68 b9 01 00 00       	push   $0x1b9
+f0103bb8:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103bbe:	50                   	push   %eax
+f0103bbf:	89 fb                	mov    %edi,%ebx
+f0103bc1:	e8 32 c5 ff ff       	call   f01000f8 <_panic>
+	assert((cp = kmem_cache_create("check128", 200, 128, NULL)));
+f0103bc6:	8d 87 a8 57 ff ff    	lea    -0xa858(%edi),%eax
+f0103bcc:	50                   	push   %eax
+f0103bcd:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103bd3:	50                   	push   %eax
+f0103bd4:	68 bd 01 00 00       	push   $0x1bd
+f0103bd9:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103bdf:	50                   	push   %eax
+f0103be0:	89 fb                	mov    %edi,%ebx
+f0103be2:	e8 11 c5 ff ff       	call   f01000f8 <_panic>
+		assert((objs[i] = kmem_cache_alloc(cp)));
+f0103be7:	8d 87 cc 56 ff ff    	lea    -0xa934(%edi),%eax
+f0103bed:	50                   	push   %eax
+f0103bee:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103bf4:	50                   	push   %eax
+f0103bf5:	68 bf 01 00 00       	push   $0x1bf
+f0103bfa:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103c00:	50                   	push   %eax
+f0103c01:	89 fb                	mov    %edi,%ebx
+f0103c03:	e8 f0 c4 ff ff       	call   f01000f8 <_panic>
+	assert(cp->kc_nslab > 1);
+f0103c08:	83 7e 70 01          	cmpl   $0x1,0x70(%esi)
+f0103c0c:	76 08                	jbe    f0103c16 <kmem_init+0x3e1>
+f0103c0e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f0103c11:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0103c14:	eb 34                	jmp    f0103c4a <kmem_init+0x415>
+f0103c16:	8d 87 b9 58 ff ff    	lea    -0xa747(%edi),%eax
+f0103c1c:	50                   	push   %eax
+f0103c1d:	8d 87 a9 47 ff ff    	lea    -0xb857(%edi),%eax
+f0103c23:	50                   	push   %eax
+f0103c24:	68 c2 01 00 00       	push   $0x1c2
+f0103c29:	8d 87 ff 57 ff ff    	lea    -0xa801(%edi),%eax
+f0103c2f:	50                   	push   %eax
+f0103c30:	89 fb                	mov    %edi,%ebx
+f0103c32:	e8 c1 c4 ff ff       	call   f01000f8 <_panic>
+		kmem_cache_free(cp, objs[i]);
+f0103c37:	83 ec 08             	sub    $0x8,%esp
+f0103c3a:	ff 36                	push   (%esi)
+f0103c3c:	ff 75 e4             	push   -0x1c(%ebp)
+f0103c3f:	e8 c4 f8 ff ff       	call   f0103508 <kmem_cache_free>
+f0103c44:	83 c6 04             	add    $0x4,%esi
+f0103c47:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 40; i++)
+f0103c4a:	39 de                	cmp    %ebx,%esi
+f0103c4c:	75 e9                	jne    f0103c37 <kmem_init+0x402>
+	kmem_cache_destroy(cp);
+f0103c4e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0103c51:	83 ec 0c             	sub    $0xc,%esp
+f0103c54:	56                   	push   %esi
+f0103c55:	e8 aa f9 ff ff       	call   f0103604 <kmem_cache_destroy>
+	cprintf("check_kmem() succeeded!\n");
+f0103c5a:	8d 87 ca 58 ff ff    	lea    -0xa736(%edi),%eax
+f0103c60:	89 04 24             	mov    %eax,(%esp)
+f0103c63:	89 fb                	mov    %edi,%ebx
+f0103c65:	e8 28 04 00 00       	call   f0104092 <cprintf>
+		   CACHELINE, NULL);
+	check_kmem();
+}
+f0103c6a:	83 c4 10             	add    $0x10,%esp
+f0103c6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103c70:	5b                   	pop    %ebx
+f0103c71:	5e                   	pop    %esi
+f0103c72:	5f                   	pop    %edi
+f0103c73:	5d                   	pop    %ebp
+f0103c74:	c3                   	ret
+
+f0103c75 <kclock_start>:
+
+
+// Start interrupting 'hz' times a second on IRQ_TIMER.
+void
+kclock_start(int hz)
+{
+f0103c75:	55                   	push   %ebp
+f0103c76:	89 e5                	mov    %esp,%ebp
+f0103c78:	56                   	push   %esi
+f0103c79:	53                   	push   %ebx
+f0103c7a:	e8 d0 c6 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103c7f:	81 c3 0d 18 01 00    	add    $0x1180d,%ebx
+f0103c85:	8b 75 08             	mov    0x8(%ebp),%esi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103c88:	b8 34 00 00 00       	mov    $0x34,%eax
+f0103c8d:	ba 43 00 00 00       	mov    $0x43,%edx
+f0103c92:	ee                   	out    %al,(%dx)
+	outb(TIMER_MODE, TIMER_SEL0 | TIMER_RATEGEN | TIMER_16BIT);
+	outb(TIMER_CNTR0, TIMER_DIV(hz) % 256);
+f0103c93:	89 f0                	mov    %esi,%eax
+f0103c95:	c1 e8 1f             	shr    $0x1f,%eax
+f0103c98:	01 f0                	add    %esi,%eax
+f0103c9a:	d1 f8                	sar    %eax
+f0103c9c:	05 de 34 12 00       	add    $0x1234de,%eax
+f0103ca1:	99                   	cltd
+f0103ca2:	f7 fe                	idiv   %esi
+f0103ca4:	89 c1                	mov    %eax,%ecx
+f0103ca6:	89 c2                	mov    %eax,%edx
+f0103ca8:	c1 fa 1f             	sar    $0x1f,%edx
+f0103cab:	c1 ea 18             	shr    $0x18,%edx
+f0103cae:	8d 04 10             	lea    (%eax,%edx,1),%eax
+f0103cb1:	0f b6 c0             	movzbl %al,%eax
+f0103cb4:	29 d0                	sub    %edx,%eax
+f0103cb6:	ba 40 00 00 00       	mov    $0x40,%edx
+f0103cbb:	ee                   	out    %al,(%dx)
+	outb(TIMER_CNTR0, TIMER_DIV(hz) / 256);
+f0103cbc:	8d 81 ff 00 00 00    	lea    0xff(%ecx),%eax
+f0103cc2:	85 c9                	test   %ecx,%ecx
+f0103cc4:	0f 49 c1             	cmovns %ecx,%eax
+f0103cc7:	c1 f8 08             	sar    $0x8,%eax
+f0103cca:	ee                   	out    %al,(%dx)
+	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_TIMER));
+f0103ccb:	83 ec 0c             	sub    $0xc,%esp
+f0103cce:	c7 c0 08 53 11 f0    	mov    $0xf0115308,%eax
+f0103cd4:	0f b7 00             	movzwl (%eax),%eax
+f0103cd7:	25 fe ff 00 00       	and    $0xfffe,%eax
+f0103cdc:	50                   	push   %eax
+f0103cdd:	e8 4e 01 00 00       	call   f0103e30 <irq_setmask_8259A>
+}
+f0103ce2:	83 c4 10             	add    $0x10,%esp
+f0103ce5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0103ce8:	5b                   	pop    %ebx
+f0103ce9:	5e                   	pop    %esi
+f0103cea:	5d                   	pop    %ebp
+f0103ceb:	c3                   	ret
+
+f0103cec <kclock_stop>:
+
+// Stop delivering timer interrupts.
+void
+kclock_stop(void)
+{
+f0103cec:	55                   	push   %ebp
+f0103ced:	89 e5                	mov    %esp,%ebp
+f0103cef:	53                   	push   %ebx
+f0103cf0:	83 ec 10             	sub    $0x10,%esp
+f0103cf3:	e8 57 c6 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103cf8:	81 c3 94 17 01 00    	add    $0x11794,%ebx
+	irq_setmask_8259A(irq_mask_8259A | (1<<IRQ_TIMER));
+f0103cfe:	c7 c0 08 53 11 f0    	mov    $0xf0115308,%eax
+f0103d04:	0f b7 00             	movzwl (%eax),%eax
+f0103d07:	83 c8 01             	or     $0x1,%eax
+f0103d0a:	0f b7 c0             	movzwl %ax,%eax
+f0103d0d:	50                   	push   %eax
+f0103d0e:	e8 1d 01 00 00       	call   f0103e30 <irq_setmask_8259A>
+}
+f0103d13:	83 c4 10             	add    $0x10,%esp
+f0103d16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103d19:	c9                   	leave
+f0103d1a:	c3                   	ret
+
+f0103d1b <kclock_tsc_hz>:
+// How many times a second the TSC ticks, timed against 10ms of PIT
+// counter 2 (which leaves counter 0 and IRQ_TIMER alone).  Measured
+// once; 0 if counter 2 never seems to finish.
+uint64_t
+kclock_tsc_hz(void)
+{
+f0103d1b:	55                   	push   %ebp
+f0103d1c:	89 e5                	mov    %esp,%ebp
+f0103d1e:	57                   	push   %edi
+f0103d1f:	56                   	push   %esi
+f0103d20:	53                   	push   %ebx
+f0103d21:	83 ec 1c             	sub    $0x1c,%esp
+f0103d24:	e8 26 c6 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103d29:	81 c3 63 17 01 00    	add    $0x11763,%ebx
+	const uint32_t count = TIMER_DIV(100);
+	uint64_t t;
+	uint32_t eflags, n;
+	uint8_t portb;
+
+	if (hz)
+f0103d2f:	8b 83 cc cd 00 00    	mov    0xcdcc(%ebx),%eax
+f0103d35:	8b 93 d0 cd 00 00    	mov    0xcdd0(%ebx),%edx
+f0103d3b:	89 d7                	mov    %edx,%edi
+f0103d3d:	09 c7                	or     %eax,%edi
+f0103d3f:	0f 85 b5 00 00 00    	jne    f0103dfa <kclock_tsc_hz+0xdf>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0103d45:	9c                   	pushf
+f0103d46:	58                   	pop    %eax
+f0103d47:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		return hz;
+
+	eflags = read_eflags();
+	asm volatile("cli");
+f0103d4a:	fa                   	cli
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0103d4b:	ba 61 00 00 00       	mov    $0x61,%edx
+f0103d50:	ec                   	in     (%dx),%al
+f0103d51:	88 45 e7             	mov    %al,-0x19(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103d54:	83 e0 fc             	and    $0xfffffffc,%eax
+f0103d57:	83 c8 01             	or     $0x1,%eax
+f0103d5a:	ee                   	out    %al,(%dx)
+f0103d5b:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+f0103d60:	ba 43 00 00 00       	mov    $0x43,%edx
+f0103d65:	ee                   	out    %al,(%dx)
+f0103d66:	ba 42 00 00 00       	mov    $0x42,%edx
+f0103d6b:	b8 9c ff ff ff       	mov    $0xffffff9c,%eax
+f0103d70:	ee                   	out    %al,(%dx)
+f0103d71:	b8 2e 00 00 00       	mov    $0x2e,%eax
+f0103d76:	ee                   	out    %al,(%dx)
+	asm volatile("rdtsc" : "=A" (tsc));
+f0103d77:	0f 31                	rdtsc
+f0103d79:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0103d7c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	outb(TIMER_MODE, TIMER_SEL2 | TIMER_INTTC | TIMER_16BIT);
+	outb(TIMER_CNTR2, count % 256);
+	outb(TIMER_CNTR2, count / 256);
+	// counting starts once the high byte is in; OUT2 rises at zero
+	t = read_tsc();
+	for (n = 0; !(inb(IO_PORTB) & PORTB_OUT2); n++)
+f0103d7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0103d84:	ba 61 00 00 00       	mov    $0x61,%edx
+f0103d89:	ec                   	in     (%dx),%al
+		if (n == 1000000)	// about a second of port reads
+f0103d8a:	a8 20                	test   $0x20,%al
+f0103d8c:	75 0d                	jne    f0103d9b <kclock_tsc_hz+0x80>
+f0103d8e:	81 f9 40 42 0f 00    	cmp    $0xf4240,%ecx
+f0103d94:	74 05                	je     f0103d9b <kclock_tsc_hz+0x80>
+	for (n = 0; !(inb(IO_PORTB) & PORTB_OUT2); n++)
+f0103d96:	83 c1 01             	add    $0x1,%ecx
+f0103d99:	eb ee                	jmp    f0103d89 <kclock_tsc_hz+0x6e>
+	asm volatile("rdtsc" : "=A" (tsc));
+f0103d9b:	0f 31                	rdtsc
+f0103d9d:	89 c6                	mov    %eax,%esi
+f0103d9f:	89 d7                	mov    %edx,%edi
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103da1:	ba 61 00 00 00       	mov    $0x61,%edx
+f0103da6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0103daa:	ee                   	out    %al,(%dx)
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0103dab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103dae:	50                   	push   %eax
+f0103daf:	9d                   	popf
+			break;
+	t = read_tsc() - t;
+	outb(IO_PORTB, portb);
+	write_eflags(eflags);
+
+	if (n < 1000000)
+f0103db0:	81 f9 3f 42 0f 00    	cmp    $0xf423f,%ecx
+f0103db6:	77 36                	ja     f0103dee <kclock_tsc_hz+0xd3>
+	t = read_tsc() - t;
+f0103db8:	89 f0                	mov    %esi,%eax
+f0103dba:	89 fa                	mov    %edi,%edx
+f0103dbc:	2b 45 d8             	sub    -0x28(%ebp),%eax
+f0103dbf:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+		hz = t * TIMER_FREQ / count;
+f0103dc2:	69 ca de 34 12 00    	imul   $0x1234de,%edx,%ecx
+f0103dc8:	be de 34 12 00       	mov    $0x1234de,%esi
+f0103dcd:	f7 e6                	mul    %esi
+f0103dcf:	01 ca                	add    %ecx,%edx
+f0103dd1:	6a 00                	push   $0x0
+f0103dd3:	68 9c 2e 00 00       	push   $0x2e9c
+f0103dd8:	52                   	push   %edx
+f0103dd9:	50                   	push   %eax
+f0103dda:	e8 ff 5b 00 00       	call   f01099de <__udivdi3>
+f0103ddf:	83 c4 10             	add    $0x10,%esp
+f0103de2:	89 83 cc cd 00 00    	mov    %eax,0xcdcc(%ebx)
+f0103de8:	89 93 d0 cd 00 00    	mov    %edx,0xcdd0(%ebx)
+	return hz;
+f0103dee:	8b 83 cc cd 00 00    	mov    0xcdcc(%ebx),%eax
+f0103df4:	8b 93 d0 cd 00 00    	mov    0xcdd0(%ebx),%edx
+}
+f0103dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103dfd:	5b                   	pop    %ebx
+f0103dfe:	5e                   	pop    %esi
+f0103dff:	5f                   	pop    %edi
+f0103e00:	5d                   	pop    %ebp
+f0103e01:	c3                   	ret
+
+f0103e02 <mc146818_read>:
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f0103e02:	55                   	push   %ebp
+f0103e03:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103e05:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103e08:	ba 70 00 00 00       	mov    $0x70,%edx
+f0103e0d:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0103e0e:	ba 71 00 00 00       	mov    $0x71,%edx
+f0103e13:	ec                   	in     (%dx),%al
+	outb(IO_RTC, reg);
+	return inb(IO_RTC+1);
+f0103e14:	0f b6 c0             	movzbl %al,%eax
+}
+f0103e17:	5d                   	pop    %ebp
+f0103e18:	c3                   	ret
+
+f0103e19 <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f0103e19:	55                   	push   %ebp
+f0103e1a:	89 e5                	mov    %esp,%ebp
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0103e1c:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103e1f:	ba 70 00 00 00       	mov    $0x70,%edx
+f0103e24:	ee                   	out    %al,(%dx)
+f0103e25:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103e28:	ba 71 00 00 00       	mov    $0x71,%edx
+f0103e2d:	ee                   	out    %al,(%dx)
+	outb(IO_RTC, reg);
+	outb(IO_RTC+1, datum);
+}
+f0103e2e:	5d                   	pop    %ebp
+f0103e2f:	c3                   	ret
+
+f0103e30 <irq_setmask_8259A>:
+		irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f0103e30:	55                   	push   %ebp
+f0103e31:	89 e5                	mov    %esp,%ebp
+f0103e33:	57                   	push   %edi
+f0103e34:	56                   	push   %esi
+f0103e35:	53                   	push   %ebx
+f0103e36:	83 ec 1c             	sub    $0x1c,%esp
+f0103e39:	e8 11 c5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103e3e:	81 c3 4e 16 01 00    	add    $0x1164e,%ebx
+f0103e44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	irq_mask_8259A = mask;
+f0103e47:	66 89 8b 7c fe ff ff 	mov    %cx,-0x184(%ebx)
+	if (!didinit)
+f0103e4e:	80 bb d4 cd 00 00 00 	cmpb   $0x0,0xcdd4(%ebx)
+f0103e55:	75 08                	jne    f0103e5f <irq_setmask_8259A+0x2f>
+	cprintf("enabled interrupts:");
+	for (i = 0; i < 16; i++)
+		if (~mask & (1<<i))
+			cprintf(" %d", i);
+	cprintf("\n");
+}
+f0103e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103e5a:	5b                   	pop    %ebx
+f0103e5b:	5e                   	pop    %esi
+f0103e5c:	5f                   	pop    %edi
+f0103e5d:	5d                   	pop    %ebp
+f0103e5e:	c3                   	ret
+f0103e5f:	89 cf                	mov    %ecx,%edi
+f0103e61:	ba 21 00 00 00       	mov    $0x21,%edx
+f0103e66:	89 c8                	mov    %ecx,%eax
+f0103e68:	ee                   	out    %al,(%dx)
+	outb(IO_PIC2+1, (char)(mask >> 8));
+f0103e69:	89 c8                	mov    %ecx,%eax
+f0103e6b:	66 c1 e8 08          	shr    $0x8,%ax
+f0103e6f:	ba a1 00 00 00       	mov    $0xa1,%edx
+f0103e74:	ee                   	out    %al,(%dx)
+	cprintf("enabled interrupts:");
+f0103e75:	83 ec 0c             	sub    $0xc,%esp
+f0103e78:	8d 83 ea 58 ff ff    	lea    -0xa716(%ebx),%eax
+f0103e7e:	50                   	push   %eax
+f0103e7f:	e8 0e 02 00 00       	call   f0104092 <cprintf>
+f0103e84:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 16; i++)
+f0103e87:	be 00 00 00 00       	mov    $0x0,%esi
+		if (~mask & (1<<i))
+f0103e8c:	0f b7 ff             	movzwl %di,%edi
+f0103e8f:	f7 d7                	not    %edi
+			cprintf(" %d", i);
+f0103e91:	8d 83 a8 61 ff ff    	lea    -0x9e58(%ebx),%eax
+f0103e97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0103e9a:	eb 08                	jmp    f0103ea4 <irq_setmask_8259A+0x74>
+	for (i = 0; i < 16; i++)
+f0103e9c:	83 c6 01             	add    $0x1,%esi
+f0103e9f:	83 fe 10             	cmp    $0x10,%esi
+f0103ea2:	74 16                	je     f0103eba <irq_setmask_8259A+0x8a>
+		if (~mask & (1<<i))
+f0103ea4:	0f a3 f7             	bt     %esi,%edi
+f0103ea7:	73 f3                	jae    f0103e9c <irq_setmask_8259A+0x6c>
+			cprintf(" %d", i);
+f0103ea9:	83 ec 08             	sub    $0x8,%esp
+f0103eac:	56                   	push   %esi
+f0103ead:	ff 75 e4             	push   -0x1c(%ebp)
+f0103eb0:	e8 dd 01 00 00       	call   f0104092 <cprintf>
+f0103eb5:	83 c4 10             	add    $0x10,%esp
+f0103eb8:	eb e2                	jmp    f0103e9c <irq_setmask_8259A+0x6c>
+	cprintf("\n");
+f0103eba:	83 ec 0c             	sub    $0xc,%esp
+f0103ebd:	8d 83 09 66 ff ff    	lea    -0x99f7(%ebx),%eax
+f0103ec3:	50                   	push   %eax
+f0103ec4:	e8 c9 01 00 00       	call   f0104092 <cprintf>
+f0103ec9:	83 c4 10             	add    $0x10,%esp
+f0103ecc:	eb 89                	jmp    f0103e57 <irq_setmask_8259A+0x27>
+
+f0103ece <pic_init>:
+{
+f0103ece:	55                   	push   %ebp
+f0103ecf:	89 e5                	mov    %esp,%ebp
+f0103ed1:	57                   	push   %edi
+f0103ed2:	56                   	push   %esi
+f0103ed3:	53                   	push   %ebx
+f0103ed4:	83 ec 0c             	sub    $0xc,%esp
+f0103ed7:	e8 73 c4 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103edc:	81 c3 b0 15 01 00    	add    $0x115b0,%ebx
+	didinit = 1;
+f0103ee2:	c6 83 d4 cd 00 00 01 	movb   $0x1,0xcdd4(%ebx)
+f0103ee9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0103eee:	b9 21 00 00 00       	mov    $0x21,%ecx
+f0103ef3:	89 ca                	mov    %ecx,%edx
+f0103ef5:	ee                   	out    %al,(%dx)
+f0103ef6:	be a1 00 00 00       	mov    $0xa1,%esi
+f0103efb:	89 f2                	mov    %esi,%edx
+f0103efd:	ee                   	out    %al,(%dx)
+f0103efe:	bf 11 00 00 00       	mov    $0x11,%edi
+f0103f03:	89 f8                	mov    %edi,%eax
+f0103f05:	ba 20 00 00 00       	mov    $0x20,%edx
+f0103f0a:	ee                   	out    %al,(%dx)
+f0103f0b:	b8 20 00 00 00       	mov    $0x20,%eax
+f0103f10:	89 ca                	mov    %ecx,%edx
+f0103f12:	ee                   	out    %al,(%dx)
+f0103f13:	b8 04 00 00 00       	mov    $0x4,%eax
+f0103f18:	ee                   	out    %al,(%dx)
+f0103f19:	b8 03 00 00 00       	mov    $0x3,%eax
+f0103f1e:	ee                   	out    %al,(%dx)
+f0103f1f:	b9 a0 00 00 00       	mov    $0xa0,%ecx
+f0103f24:	89 f8                	mov    %edi,%eax
+f0103f26:	89 ca                	mov    %ecx,%edx
+f0103f28:	ee                   	out    %al,(%dx)
+f0103f29:	b8 28 00 00 00       	mov    $0x28,%eax
+f0103f2e:	89 f2                	mov    %esi,%edx
+f0103f30:	ee                   	out    %al,(%dx)
+f0103f31:	b8 02 00 00 00       	mov    $0x2,%eax
+f0103f36:	ee                   	out    %al,(%dx)
+f0103f37:	b8 01 00 00 00       	mov    $0x1,%eax
+f0103f3c:	ee                   	out    %al,(%dx)
+f0103f3d:	bf 68 00 00 00       	mov    $0x68,%edi
+f0103f42:	89 f8                	mov    %edi,%eax
+f0103f44:	ba 20 00 00 00       	mov    $0x20,%edx
+f0103f49:	ee                   	out    %al,(%dx)
+f0103f4a:	be 0a 00 00 00       	mov    $0xa,%esi
+f0103f4f:	89 f0                	mov    %esi,%eax
+f0103f51:	ee                   	out    %al,(%dx)
+f0103f52:	89 f8                	mov    %edi,%eax
+f0103f54:	89 ca                	mov    %ecx,%edx
+f0103f56:	ee                   	out    %al,(%dx)
+f0103f57:	89 f0                	mov    %esi,%eax
+f0103f59:	ee                   	out    %al,(%dx)
+	if (irq_mask_8259A != 0xFFFF)
+f0103f5a:	0f b7 83 7c fe ff ff 	movzwl -0x184(%ebx),%eax
+f0103f61:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0103f65:	75 08                	jne    f0103f6f <pic_init+0xa1>
+}
+f0103f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103f6a:	5b                   	pop    %ebx
+f0103f6b:	5e                   	pop    %esi
+f0103f6c:	5f                   	pop    %edi
+f0103f6d:	5d                   	pop    %ebp
+f0103f6e:	c3                   	ret
+		irq_setmask_8259A(irq_mask_8259A);
+f0103f6f:	83 ec 0c             	sub    $0xc,%esp
+f0103f72:	0f b7 c0             	movzwl %ax,%eax
+f0103f75:	50                   	push   %eax
+f0103f76:	e8 b5 fe ff ff       	call   f0103e30 <irq_setmask_8259A>
+f0103f7b:	83 c4 10             	add    $0x10,%esp
+}
+f0103f7e:	eb e7                	jmp    f0103f67 <pic_init+0x99>
+
+f0103f80 <irq_eoi>:
+f0103f80:	b8 20 00 00 00       	mov    $0x20,%eax
+f0103f85:	ba a0 00 00 00       	mov    $0xa0,%edx
+f0103f8a:	ee                   	out    %al,(%dx)
+	//   r: rotate
+	//   s: specific
+	//   e: end-of-interrupt
+	// xxx: specific interrupt line
+	outb(IO_PIC2, 0x20);
+}
+f0103f8b:	c3                   	ret
+
+f0103f8c <flush>:
+};
+
+
+static void
+flush(struct printbuf *b)
+{
+f0103f8c:	55                   	push   %ebp
+f0103f8d:	89 e5                	mov    %esp,%ebp
+f0103f8f:	57                   	push   %edi
+f0103f90:	56                   	push   %esi
+f0103f91:	53                   	push   %ebx
+f0103f92:	83 ec 24             	sub    $0x24,%esp
+f0103f95:	e8 b5 c3 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0103f9a:	81 c3 f2 14 01 00    	add    $0x114f2,%ebx
+f0103fa0:	89 c6                	mov    %eax,%esi
+	int c;
+
+	// %m changes cons_c as it is formatted, so show the buffered
+	// bytes in the color they were formatted under
+	c = cons_c;
+f0103fa2:	c7 c7 08 43 15 f0    	mov    $0xf0154308,%edi
+f0103fa8:	8b 07                	mov    (%edi),%eax
+f0103faa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	cons_c = b->attr;
+f0103fad:	8b 46 08             	mov    0x8(%esi),%eax
+f0103fb0:	89 07                	mov    %eax,(%edi)
+	cons_write(b->buf, b->idx);
+f0103fb2:	ff 36                	push   (%esi)
+f0103fb4:	8d 46 0c             	lea    0xc(%esi),%eax
+f0103fb7:	50                   	push   %eax
+f0103fb8:	e8 69 cc ff ff       	call   f0100c26 <cons_write>
+	cons_c = c;
+f0103fbd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103fc0:	89 07                	mov    %eax,(%edi)
+	b->idx = 0;
+f0103fc2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+f0103fc8:	83 c4 10             	add    $0x10,%esp
+f0103fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103fce:	5b                   	pop    %ebx
+f0103fcf:	5e                   	pop    %esi
+f0103fd0:	5f                   	pop    %edi
+f0103fd1:	5d                   	pop    %ebp
+f0103fd2:	c3                   	ret
+
+f0103fd3 <putch>:
+
+static void
+putch(int ch, struct printbuf *b)
+{
+f0103fd3:	55                   	push   %ebp
+f0103fd4:	89 e5                	mov    %esp,%ebp
+f0103fd6:	56                   	push   %esi
+f0103fd7:	53                   	push   %ebx
+f0103fd8:	e8 0d d0 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f0103fdd:	81 c6 af 14 01 00    	add    $0x114af,%esi
+f0103fe3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (cons_c != b->attr) {
+f0103fe6:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f0103fec:	8b 00                	mov    (%eax),%eax
+f0103fee:	39 43 08             	cmp    %eax,0x8(%ebx)
+f0103ff1:	75 1d                	jne    f0104010 <putch+0x3d>
+		flush(b);
+		b->attr = cons_c;
+	}
+	b->buf[b->idx++] = ch;
+f0103ff3:	8b 13                	mov    (%ebx),%edx
+f0103ff5:	8d 42 01             	lea    0x1(%edx),%eax
+f0103ff8:	89 03                	mov    %eax,(%ebx)
+f0103ffa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0103ffd:	88 4c 13 0c          	mov    %cl,0xc(%ebx,%edx,1)
+	if (b->idx == sizeof(b->buf))
+f0104001:	3d 00 01 00 00       	cmp    $0x100,%eax
+f0104006:	74 1c                	je     f0104024 <putch+0x51>
+		flush(b);
+	b->cnt++;
+f0104008:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+f010400c:	5b                   	pop    %ebx
+f010400d:	5e                   	pop    %esi
+f010400e:	5d                   	pop    %ebp
+f010400f:	c3                   	ret
+		flush(b);
+f0104010:	89 d8                	mov    %ebx,%eax
+f0104012:	e8 75 ff ff ff       	call   f0103f8c <flush>
+		b->attr = cons_c;
+f0104017:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f010401d:	8b 00                	mov    (%eax),%eax
+f010401f:	89 43 08             	mov    %eax,0x8(%ebx)
+f0104022:	eb cf                	jmp    f0103ff3 <putch+0x20>
+		flush(b);
+f0104024:	89 d8                	mov    %ebx,%eax
+f0104026:	e8 61 ff ff ff       	call   f0103f8c <flush>
+f010402b:	eb db                	jmp    f0104008 <putch+0x35>
+
+f010402d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f010402d:	55                   	push   %ebp
+f010402e:	89 e5                	mov    %esp,%ebp
+f0104030:	56                   	push   %esi
+f0104031:	53                   	push   %ebx
+f0104032:	81 ec 10 01 00 00    	sub    $0x110,%esp
+f0104038:	e8 12 c3 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010403d:	81 c3 4f 14 01 00    	add    $0x1144f,%ebx
+	struct printbuf b;
+
+	b.idx = 0;
+f0104043:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+f010404a:	00 00 00 
+	b.cnt = 0;
+f010404d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f0104054:	00 00 00 
+	b.attr = cons_c;
+f0104057:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f010405d:	8b 00                	mov    (%eax),%eax
+f010405f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+	vprintfmt((void*)putch, &b, fmt, ap);
+f0104065:	ff 75 0c             	push   0xc(%ebp)
+f0104068:	ff 75 08             	push   0x8(%ebp)
+f010406b:	8d b5 ec fe ff ff    	lea    -0x114(%ebp),%esi
+f0104071:	56                   	push   %esi
+f0104072:	8d 83 47 eb fe ff    	lea    -0x114b9(%ebx),%eax
+f0104078:	50                   	push   %eax
+f0104079:	e8 a9 3a 00 00       	call   f0107b27 <vprintfmt>
+	flush(&b);
+f010407e:	89 f0                	mov    %esi,%eax
+f0104080:	e8 07 ff ff ff       	call   f0103f8c <flush>
+
+	return b.cnt;
+}
+f0104085:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+f010408b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010408e:	5b                   	pop    %ebx
+f010408f:	5e                   	pop    %esi
+f0104090:	5d                   	pop    %ebp
+f0104091:	c3                   	ret
+
+f0104092 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f0104092:	55                   	push   %ebp
+f0104093:	89 e5                	mov    %esp,%ebp
+f0104095:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+f0104098:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+f010409b:	50                   	push   %eax
+f010409c:	ff 75 08             	push   0x8(%ebp)
+f010409f:	e8 89 ff ff ff       	call   f010402d <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+f01040a4:	c9                   	leave
+f01040a5:	c3                   	ret
+
+f01040a6 <vcprintfc>:
+
+int
+vcprintfc(struct Printfmt *pf, va_list ap)
+{
+f01040a6:	55                   	push   %ebp
+f01040a7:	89 e5                	mov    %esp,%ebp
+f01040a9:	56                   	push   %esi
+f01040aa:	53                   	push   %ebx
+f01040ab:	81 ec 10 01 00 00    	sub    $0x110,%esp
+f01040b1:	e8 99 c2 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01040b6:	81 c3 d6 13 01 00    	add    $0x113d6,%ebx
+	struct printbuf b;
+
+	b.idx = 0;
+f01040bc:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+f01040c3:	00 00 00 
+	b.cnt = 0;
+f01040c6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+f01040cd:	00 00 00 
+	b.attr = cons_c;
+f01040d0:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f01040d6:	8b 00                	mov    (%eax),%eax
+f01040d8:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+	vprintfmtc((void*)putch, &b, pf, ap);
+f01040de:	ff 75 0c             	push   0xc(%ebp)
+f01040e1:	ff 75 08             	push   0x8(%ebp)
+f01040e4:	8d b5 ec fe ff ff    	lea    -0x114(%ebp),%esi
+f01040ea:	56                   	push   %esi
+f01040eb:	8d 83 47 eb fe ff    	lea    -0x114b9(%ebx),%eax
+f01040f1:	50                   	push   %eax
+f01040f2:	e8 cc 3a 00 00       	call   f0107bc3 <vprintfmtc>
+	flush(&b);
+f01040f7:	89 f0                	mov    %esi,%eax
+f01040f9:	e8 8e fe ff ff       	call   f0103f8c <flush>
+
+	return b.cnt;
+}
+f01040fe:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+f0104104:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104107:	5b                   	pop    %ebx
+f0104108:	5e                   	pop    %esi
+f0104109:	5d                   	pop    %ebp
+f010410a:	c3                   	ret
+
+f010410b <cprintfc>:
+
+int
+cprintfc(struct Printfmt *pf, ...)
+{
+f010410b:	55                   	push   %ebp
+f010410c:	89 e5                	mov    %esp,%ebp
+f010410e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, pf);
+f0104111:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintfc(pf, ap);
+f0104114:	50                   	push   %eax
+f0104115:	ff 75 08             	push   0x8(%ebp)
+f0104118:	e8 89 ff ff ff       	call   f01040a6 <vcprintfc>
+	va_end(ap);
+
+	return cnt;
+}
+f010411d:	c9                   	leave
+f010411e:	c3                   	ret
+
+f010411f <trap_init_percpu>:
+}
+
+// Load the kernel's GDT, this CPU's TSS and the IDT on the current CPU.
+void
+trap_init_percpu(void)
+{
+f010411f:	55                   	push   %ebp
+f0104120:	89 e5                	mov    %esp,%ebp
+f0104122:	57                   	push   %edi
+f0104123:	56                   	push   %esi
+f0104124:	53                   	push   %ebx
+f0104125:	83 ec 1c             	sub    $0x1c,%esp
+f0104128:	e8 22 c2 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010412d:	81 c3 5f 13 01 00    	add    $0x1135f,%ebx
+	int i = cpunum();
+f0104133:	e8 87 47 00 00       	call   f01088bf <cpunum>
+f0104138:	89 c6                	mov    %eax,%esi
+	asm volatile("lgdt (%0)" : : "r" (p));
+f010413a:	8d 83 30 05 00 00    	lea    0x530(%ebx),%eax
+f0104140:	0f 01 10             	lgdtl  (%eax)
+
+	lgdt(&gdt_pd);
+	// The kernel never uses GS or FS, so we leave those set to
+	// the kernel data segment as well.
+	asm volatile("movw %%ax,%%gs" : : "a" (GD_KD));
+f0104143:	b8 10 00 00 00       	mov    $0x10,%eax
+f0104148:	8e e8                	mov    %eax,%gs
+	asm volatile("movw %%ax,%%fs" : : "a" (GD_KD));
+f010414a:	8e e0                	mov    %eax,%fs
+	asm volatile("movw %%ax,%%es" : : "a" (GD_KD));
+f010414c:	8e c0                	mov    %eax,%es
+	asm volatile("movw %%ax,%%ds" : : "a" (GD_KD));
+f010414e:	8e d8                	mov    %eax,%ds
+	asm volatile("movw %%ax,%%ss" : : "a" (GD_KD));
+f0104150:	8e d0                	mov    %eax,%ss
+	// Load the kernel text segment into CS.
+	asm volatile("ljmp %0,$1f\n 1:\n" : : "i" (GD_KT));
+f0104152:	ea 59 41 10 f0 08 00 	ljmp   $0x8,$0xf0104159
+
+	// Setup a TSS so that we get the right stack
+	// when we trap to the kernel.
+	thiscpu->cpu_ts.ts_esp0 = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+f0104159:	e8 61 47 00 00       	call   f01088bf <cpunum>
+f010415e:	c7 c7 20 50 15 f0    	mov    $0xf0155020,%edi
+f0104164:	6b c0 70             	imul   $0x70,%eax,%eax
+f0104167:	89 f1                	mov    %esi,%ecx
+f0104169:	c1 e1 10             	shl    $0x10,%ecx
+f010416c:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0104171:	29 ca                	sub    %ecx,%edx
+f0104173:	89 54 07 0c          	mov    %edx,0xc(%edi,%eax,1)
+	thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f0104177:	e8 43 47 00 00       	call   f01088bf <cpunum>
+f010417c:	6b c0 70             	imul   $0x70,%eax,%eax
+f010417f:	66 c7 44 07 10 10 00 	movw   $0x10,0x10(%edi,%eax,1)
+	thiscpu->cpu_ts.ts_iomb = sizeof(struct Taskstate);
+f0104186:	e8 34 47 00 00       	call   f01088bf <cpunum>
+f010418b:	6b c0 70             	imul   $0x70,%eax,%eax
+f010418e:	66 c7 44 07 6e 68 00 	movw   $0x68,0x6e(%edi,%eax,1)
+
+	// Initialize the TSS slot of the gdt.
+	gdt[(GD_TSS0 >> 3) + i] = SEG16(STS_T32A, (uint32_t) (&thiscpu->cpu_ts),
+f0104195:	89 75 dc             	mov    %esi,-0x24(%ebp)
+f0104198:	83 c6 05             	add    $0x5,%esi
+f010419b:	e8 1f 47 00 00       	call   f01088bf <cpunum>
+f01041a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01041a3:	e8 17 47 00 00       	call   f01088bf <cpunum>
+f01041a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01041ab:	e8 0f 47 00 00       	call   f01088bf <cpunum>
+f01041b0:	89 c1                	mov    %eax,%ecx
+f01041b2:	66 c7 84 f3 94 fe ff 	movw   $0x67,-0x16c(%ebx,%esi,8)
+f01041b9:	ff 67 00 
+f01041bc:	8d 94 f3 94 fe ff ff 	lea    -0x16c(%ebx,%esi,8),%edx
+f01041c3:	6b 45 e4 70          	imul   $0x70,-0x1c(%ebp),%eax
+f01041c7:	8d 44 07 08          	lea    0x8(%edi,%eax,1),%eax
+f01041cb:	66 89 42 02          	mov    %ax,0x2(%edx)
+f01041cf:	6b 45 e0 70          	imul   $0x70,-0x20(%ebp),%eax
+f01041d3:	8d 44 07 08          	lea    0x8(%edi,%eax,1),%eax
+f01041d7:	c1 e8 10             	shr    $0x10,%eax
+f01041da:	88 42 04             	mov    %al,0x4(%edx)
+f01041dd:	0f b6 84 f3 99 fe ff 	movzbl -0x167(%ebx,%esi,8),%eax
+f01041e4:	ff 
+f01041e5:	83 e0 90             	and    $0xffffff90,%eax
+f01041e8:	83 c8 89             	or     $0xffffff89,%eax
+f01041eb:	88 84 f3 99 fe ff ff 	mov    %al,-0x167(%ebx,%esi,8)
+f01041f2:	c6 84 f3 9a fe ff ff 	movb   $0x40,-0x166(%ebx,%esi,8)
+f01041f9:	40 
+f01041fa:	6b c9 70             	imul   $0x70,%ecx,%ecx
+f01041fd:	8d 44 0f 08          	lea    0x8(%edi,%ecx,1),%eax
+f0104201:	c1 e8 18             	shr    $0x18,%eax
+f0104204:	88 42 07             	mov    %al,0x7(%edx)
+					sizeof(struct Taskstate) - 1, 0);
+	gdt[(GD_TSS0 >> 3) + i].sd_s = 0;
+f0104207:	80 a4 f3 99 fe ff ff 	andb   $0xef,-0x167(%ebx,%esi,8)
+f010420e:	ef 
+
+	// Load the TSS selector (like other segment selectors, the
+	// bottom three bits are special; we leave them 0)
+	ltr(GD_TSS0 + (i << 3));
+f010420f:	0f b7 45 dc          	movzwl -0x24(%ebp),%eax
+f0104213:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+	asm volatile("ltr %0" : : "r" (sel));
+f010421a:	0f 00 d8             	ltr    %ax
+	asm volatile("lidt (%0)" : : "r" (p));
+f010421d:	8d 83 28 05 00 00    	lea    0x528(%ebx),%eax
+f0104223:	0f 01 18             	lidtl  (%eax)
+
+	lidt(&idt_pd);
+}
+f0104226:	83 c4 1c             	add    $0x1c,%esp
+f0104229:	5b                   	pop    %ebx
+f010422a:	5e                   	pop    %esi
+f010422b:	5f                   	pop    %edi
+f010422c:	5d                   	pop    %ebp
+f010422d:	c3                   	ret
+
+f010422e <trap_init>:
+{
+f010422e:	55                   	push   %ebp
+f010422f:	89 e5                	mov    %esp,%ebp
+f0104231:	57                   	push   %edi
+f0104232:	56                   	push   %esi
+f0104233:	53                   	push   %ebx
+f0104234:	83 ec 0c             	sub    $0xc,%esp
+f0104237:	e8 13 c1 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010423c:	81 c3 50 12 01 00    	add    $0x11250,%ebx
+	for (i = 0; i < ARRAY_SIZE(trap_vectors); i++)
+f0104242:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (trap_vectors[i])
+f0104247:	c7 c6 88 53 11 f0    	mov    $0xf0115388,%esi
+			SETGATE(idt[i], 0, GD_KT, trap_vectors[i], 0);
+f010424d:	8d 3d f4 cd 00 00    	lea    0xcdf4,%edi
+f0104253:	eb 08                	jmp    f010425d <trap_init+0x2f>
+	for (i = 0; i < ARRAY_SIZE(trap_vectors); i++)
+f0104255:	83 c0 01             	add    $0x1,%eax
+f0104258:	83 f8 30             	cmp    $0x30,%eax
+f010425b:	74 33                	je     f0104290 <trap_init+0x62>
+		if (trap_vectors[i])
+f010425d:	8b 14 86             	mov    (%esi,%eax,4),%edx
+f0104260:	85 d2                	test   %edx,%edx
+f0104262:	74 f1                	je     f0104255 <trap_init+0x27>
+			SETGATE(idt[i], 0, GD_KT, trap_vectors[i], 0);
+f0104264:	66 89 94 c3 f4 cd 00 	mov    %dx,0xcdf4(%ebx,%eax,8)
+f010426b:	00 
+f010426c:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+f010426f:	01 f9                	add    %edi,%ecx
+f0104271:	66 c7 41 02 08 00    	movw   $0x8,0x2(%ecx)
+f0104277:	c6 84 c3 f8 cd 00 00 	movb   $0x0,0xcdf8(%ebx,%eax,8)
+f010427e:	00 
+f010427f:	c6 84 c3 f9 cd 00 00 	movb   $0x8e,0xcdf9(%ebx,%eax,8)
+f0104286:	8e 
+f0104287:	c1 ea 10             	shr    $0x10,%edx
+f010428a:	66 89 51 06          	mov    %dx,0x6(%ecx)
+f010428e:	eb c5                	jmp    f0104255 <trap_init+0x27>
+	trap_init_percpu();
+f0104290:	e8 8a fe ff ff       	call   f010411f <trap_init_percpu>
+}
+f0104295:	83 c4 0c             	add    $0xc,%esp
+f0104298:	5b                   	pop    %ebx
+f0104299:	5e                   	pop    %esi
+f010429a:	5f                   	pop    %edi
+f010429b:	5d                   	pop    %ebp
+f010429c:	c3                   	ret
+
+f010429d <print_regs>:
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f010429d:	55                   	push   %ebp
+f010429e:	89 e5                	mov    %esp,%ebp
+f01042a0:	56                   	push   %esi
+f01042a1:	53                   	push   %ebx
+f01042a2:	e8 a8 c0 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01042a7:	81 c3 e5 11 01 00    	add    $0x111e5,%ebx
+f01042ad:	8b 75 08             	mov    0x8(%ebp),%esi
+	cprintf("  edi  0x%08x\n", regs->reg_edi);
+f01042b0:	83 ec 08             	sub    $0x8,%esp
+f01042b3:	ff 36                	push   (%esi)
+f01042b5:	8d 83 fe 58 ff ff    	lea    -0xa702(%ebx),%eax
+f01042bb:	50                   	push   %eax
+f01042bc:	e8 d1 fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  esi  0x%08x\n", regs->reg_esi);
+f01042c1:	83 c4 08             	add    $0x8,%esp
+f01042c4:	ff 76 04             	push   0x4(%esi)
+f01042c7:	8d 83 0d 59 ff ff    	lea    -0xa6f3(%ebx),%eax
+f01042cd:	50                   	push   %eax
+f01042ce:	e8 bf fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f01042d3:	83 c4 08             	add    $0x8,%esp
+f01042d6:	ff 76 08             	push   0x8(%esi)
+f01042d9:	8d 83 1c 59 ff ff    	lea    -0xa6e4(%ebx),%eax
+f01042df:	50                   	push   %eax
+f01042e0:	e8 ad fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f01042e5:	83 c4 08             	add    $0x8,%esp
+f01042e8:	ff 76 0c             	push   0xc(%esi)
+f01042eb:	8d 83 2b 59 ff ff    	lea    -0xa6d5(%ebx),%eax
+f01042f1:	50                   	push   %eax
+f01042f2:	e8 9b fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f01042f7:	83 c4 08             	add    $0x8,%esp
+f01042fa:	ff 76 10             	push   0x10(%esi)
+f01042fd:	8d 83 3a 59 ff ff    	lea    -0xa6c6(%ebx),%eax
+f0104303:	50                   	push   %eax
+f0104304:	e8 89 fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  edx  0x%08x\n", regs->reg_edx);
+f0104309:	83 c4 08             	add    $0x8,%esp
+f010430c:	ff 76 14             	push   0x14(%esi)
+f010430f:	8d 83 49 59 ff ff    	lea    -0xa6b7(%ebx),%eax
+f0104315:	50                   	push   %eax
+f0104316:	e8 77 fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f010431b:	83 c4 08             	add    $0x8,%esp
+f010431e:	ff 76 18             	push   0x18(%esi)
+f0104321:	8d 83 58 59 ff ff    	lea    -0xa6a8(%ebx),%eax
+f0104327:	50                   	push   %eax
+f0104328:	e8 65 fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  eax  0x%08x\n", regs->reg_eax);
+f010432d:	83 c4 08             	add    $0x8,%esp
+f0104330:	ff 76 1c             	push   0x1c(%esi)
+f0104333:	8d 83 67 59 ff ff    	lea    -0xa699(%ebx),%eax
+f0104339:	50                   	push   %eax
+f010433a:	e8 53 fd ff ff       	call   f0104092 <cprintf>
+}
+f010433f:	83 c4 10             	add    $0x10,%esp
+f0104342:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104345:	5b                   	pop    %ebx
+f0104346:	5e                   	pop    %esi
+f0104347:	5d                   	pop    %ebp
+f0104348:	c3                   	ret
+
+f0104349 <print_trapframe>:
+{
+f0104349:	55                   	push   %ebp
+f010434a:	89 e5                	mov    %esp,%ebp
+f010434c:	56                   	push   %esi
+f010434d:	53                   	push   %ebx
+f010434e:	e8 fc bf ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0104353:	81 c3 39 11 01 00    	add    $0x11139,%ebx
+f0104359:	8b 75 08             	mov    0x8(%ebp),%esi
+	cprintf("TRAP frame at %p\n", tf);
+f010435c:	83 ec 08             	sub    $0x8,%esp
+f010435f:	56                   	push   %esi
+f0104360:	8d 83 98 59 ff ff    	lea    -0xa668(%ebx),%eax
+f0104366:	50                   	push   %eax
+f0104367:	e8 26 fd ff ff       	call   f0104092 <cprintf>
+	print_regs(&tf->tf_regs);
+f010436c:	89 34 24             	mov    %esi,(%esp)
+f010436f:	e8 29 ff ff ff       	call   f010429d <print_regs>
+	cprintf("  es   0x----%04x\n", tf->tf_es);
+f0104374:	83 c4 08             	add    $0x8,%esp
+f0104377:	0f b7 46 20          	movzwl 0x20(%esi),%eax
+f010437b:	50                   	push   %eax
+f010437c:	8d 83 aa 59 ff ff    	lea    -0xa656(%ebx),%eax
+f0104382:	50                   	push   %eax
+f0104383:	e8 0a fd ff ff       	call   f0104092 <cprintf>
+	cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0104388:	83 c4 08             	add    $0x8,%esp
+f010438b:	0f b7 46 24          	movzwl 0x24(%esi),%eax
+f010438f:	50                   	push   %eax
+f0104390:	8d 83 bd 59 ff ff    	lea    -0xa643(%ebx),%eax
+f0104396:	50                   	push   %eax
+f0104397:	e8 f6 fc ff ff       	call   f0104092 <cprintf>
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f010439c:	8b 56 28             	mov    0x28(%esi),%edx
+	if (trapno < ARRAY_SIZE(excnames))
+f010439f:	83 c4 10             	add    $0x10,%esp
+f01043a2:	83 fa 13             	cmp    $0x13,%edx
+f01043a5:	0f 86 83 00 00 00    	jbe    f010442e <print_trapframe+0xe5>
+	if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f01043ab:	8d 42 e0             	lea    -0x20(%edx),%eax
+	return "(unknown trap)";
+f01043ae:	83 f8 10             	cmp    $0x10,%eax
+f01043b1:	8d 83 85 59 ff ff    	lea    -0xa67b(%ebx),%eax
+f01043b7:	8d 8b 76 59 ff ff    	lea    -0xa68a(%ebx),%ecx
+f01043bd:	0f 43 c1             	cmovae %ecx,%eax
+	cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f01043c0:	83 ec 04             	sub    $0x4,%esp
+f01043c3:	50                   	push   %eax
+f01043c4:	52                   	push   %edx
+f01043c5:	8d 83 d0 59 ff ff    	lea    -0xa630(%ebx),%eax
+f01043cb:	50                   	push   %eax
+f01043cc:	e8 c1 fc ff ff       	call   f0104092 <cprintf>
+	if (tf->tf_trapno == T_PGFLT)
+f01043d1:	83 c4 10             	add    $0x10,%esp
+f01043d4:	83 7e 28 0e          	cmpl   $0xe,0x28(%esi)
+f01043d8:	74 5d                	je     f0104437 <print_trapframe+0xee>
+	cprintf("  err  0x%08x\n", tf->tf_err);
+f01043da:	83 ec 08             	sub    $0x8,%esp
+f01043dd:	ff 76 2c             	push   0x2c(%esi)
+f01043e0:	8d 83 f1 59 ff ff    	lea    -0xa60f(%ebx),%eax
+f01043e6:	50                   	push   %eax
+f01043e7:	e8 a6 fc ff ff       	call   f0104092 <cprintf>
+	cprintf("  eip  0x%08x\n", tf->tf_eip);
+f01043ec:	83 c4 08             	add    $0x8,%esp
+f01043ef:	ff 76 30             	push   0x30(%esi)
+f01043f2:	8d 83 00 5a ff ff    	lea    -0xa600(%ebx),%eax
+f01043f8:	50                   	push   %eax
+f01043f9:	e8 94 fc ff ff       	call   f0104092 <cprintf>
+	cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f01043fe:	83 c4 08             	add    $0x8,%esp
+f0104401:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f0104405:	50                   	push   %eax
+f0104406:	8d 83 0f 5a ff ff    	lea    -0xa5f1(%ebx),%eax
+f010440c:	50                   	push   %eax
+f010440d:	e8 80 fc ff ff       	call   f0104092 <cprintf>
+	cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0104412:	83 c4 08             	add    $0x8,%esp
+f0104415:	ff 76 38             	push   0x38(%esi)
+f0104418:	8d 83 22 5a ff ff    	lea    -0xa5de(%ebx),%eax
+f010441e:	50                   	push   %eax
+f010441f:	e8 6e fc ff ff       	call   f0104092 <cprintf>
+}
+f0104424:	83 c4 10             	add    $0x10,%esp
+f0104427:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010442a:	5b                   	pop    %ebx
+f010442b:	5e                   	pop    %esi
+f010442c:	5d                   	pop    %ebp
+f010442d:	c3                   	ret
+		return excnames[trapno];
+f010442e:	8b 84 93 d4 00 00 00 	mov    0xd4(%ebx,%edx,4),%eax
+f0104435:	eb 89                	jmp    f01043c0 <print_trapframe+0x77>
+	asm volatile("movl %%cr2,%0" : "=r" (val));
+f0104437:	0f 20 d0             	mov    %cr2,%eax
+		cprintf("  cr2  0x%08x\n", rcr2());
+f010443a:	83 ec 08             	sub    $0x8,%esp
+f010443d:	50                   	push   %eax
+f010443e:	8d 83 e2 59 ff ff    	lea    -0xa61e(%ebx),%eax
+f0104444:	50                   	push   %eax
+f0104445:	e8 48 fc ff ff       	call   f0104092 <cprintf>
+f010444a:	83 c4 10             	add    $0x10,%esp
+f010444d:	eb 8b                	jmp    f01043da <print_trapframe+0x91>
+
+f010444f <trap>:
+	panic("unhandled trap in kernel");
+}
+
+void
+trap(struct Trapframe *tf)
+{
+f010444f:	55                   	push   %ebp
+f0104450:	89 e5                	mov    %esp,%ebp
+f0104452:	56                   	push   %esi
+f0104453:	53                   	push   %ebx
+f0104454:	e8 f6 be ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0104459:	81 c3 33 10 01 00    	add    $0x11033,%ebx
+f010445f:	8b 75 08             	mov    0x8(%ebp),%esi
+	// The interrupted code may have set DF and some versions
+	// of GCC rely on DF being clear
+	asm volatile("cld" ::: "cc");
+f0104462:	fc                   	cld
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0104463:	9c                   	pushf
+f0104464:	58                   	pop    %eax
+
+	// Check that interrupts are disabled.  If this assertion
+	// fails, DO NOT be tempted to fix it by inserting a "cli" in
+	// the interrupt path.
+	assert(!(read_eflags() & FL_IF));
+f0104465:	f6 c4 02             	test   $0x2,%ah
+f0104468:	75 1f                	jne    f0104489 <trap+0x3a>
+
+	trace(TR_TRAP, tf->tf_trapno, tf->tf_eip, tf->tf_err, 0);
+f010446a:	c7 c0 48 54 11 f0    	mov    $0xf0115448,%eax
+f0104470:	80 38 00             	cmpb   $0x0,(%eax)
+f0104473:	75 33                	jne    f01044a8 <trap+0x59>
+	switch (tf->tf_trapno) {
+f0104475:	83 7e 28 2e          	cmpl   $0x2e,0x28(%esi)
+f0104479:	77 57                	ja     f01044d2 <.L22>
+f010447b:	8b 46 28             	mov    0x28(%esi),%eax
+f010447e:	89 da                	mov    %ebx,%edx
+f0104480:	03 94 83 d0 5b ff ff 	add    -0xa430(%ebx,%eax,4),%edx
+f0104487:	ff e2                	jmp    *%edx
+	assert(!(read_eflags() & FL_IF));
+f0104489:	8d 83 31 5a ff ff    	lea    -0xa5cf(%ebx),%eax
+f010448f:	50                   	push   %eax
+f0104490:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0104496:	50                   	push   %eax
+f0104497:	68 de 00 00 00       	push   $0xde
+f010449c:	8d 83 4a 5a ff ff    	lea    -0xa5b6(%ebx),%eax
+f01044a2:	50                   	push   %eax
+f01044a3:	e8 50 bc ff ff       	call   f01000f8 <_panic>
+	trace(TR_TRAP, tf->tf_trapno, tf->tf_eip, tf->tf_err, 0);
+f01044a8:	83 ec 0c             	sub    $0xc,%esp
+f01044ab:	6a 00                	push   $0x0
+f01044ad:	ff 76 2c             	push   0x2c(%esi)
+f01044b0:	ff 76 30             	push   0x30(%esi)
+f01044b3:	ff 76 28             	push   0x28(%esi)
+f01044b6:	6a 02                	push   $0x2
+f01044b8:	e8 1a 10 00 00       	call   f01054d7 <trace_event>
+f01044bd:	83 c4 20             	add    $0x20,%esp
+f01044c0:	eb b3                	jmp    f0104475 <trap+0x26>
+
+f01044c2 <.L29>:
+		if (perf_intr(tf))
+f01044c2:	83 ec 0c             	sub    $0xc,%esp
+f01044c5:	56                   	push   %esi
+f01044c6:	e8 bd 24 00 00       	call   f0106988 <perf_intr>
+f01044cb:	83 c4 10             	add    $0x10,%esp
+f01044ce:	85 c0                	test   %eax,%eax
+f01044d0:	75 30                	jne    f0104502 <.L28+0xc>
+
+f01044d2 <.L22>:
+	print_trapframe(tf);
+f01044d2:	83 ec 0c             	sub    $0xc,%esp
+f01044d5:	56                   	push   %esi
+f01044d6:	e8 6e fe ff ff       	call   f0104349 <print_trapframe>
+	panic("unhandled trap in kernel");
+f01044db:	83 c4 0c             	add    $0xc,%esp
+f01044de:	8d 83 73 5a ff ff    	lea    -0xa58d(%ebx),%eax
+f01044e4:	50                   	push   %eax
+f01044e5:	68 d1 00 00 00       	push   $0xd1
+f01044ea:	8d 83 4a 5a ff ff    	lea    -0xa5b6(%ebx),%eax
+f01044f0:	50                   	push   %eax
+f01044f1:	e8 02 bc ff ff       	call   f01000f8 <_panic>
+
+f01044f6 <.L28>:
+		prof_tick(tf);
+f01044f6:	83 ec 0c             	sub    $0xc,%esp
+f01044f9:	56                   	push   %esi
+f01044fa:	e8 d5 13 00 00       	call   f01058d4 <prof_tick>
+		return;
+f01044ff:	83 c4 10             	add    $0x10,%esp
+	trap_dispatch(tf);
+}
+f0104502:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104505:	5b                   	pop    %ebx
+f0104506:	5e                   	pop    %esi
+f0104507:	5d                   	pop    %ebp
+f0104508:	c3                   	ret
+
+f0104509 <.L27>:
+		kbd_intr();
+f0104509:	e8 9c c6 ff ff       	call   f0100baa <kbd_intr>
+		return;
+f010450e:	eb f2                	jmp    f0104502 <.L28+0xc>
+
+f0104510 <.L26>:
+		serial_intr();
+f0104510:	e8 5a c6 ff ff       	call   f0100b6f <serial_intr>
+		return;
+f0104515:	eb eb                	jmp    f0104502 <.L28+0xc>
+
+f0104517 <.L23>:
+		ide_intr();
+f0104517:	e8 74 4d 00 00       	call   f0109290 <ide_intr>
+		irq_eoi();
+f010451c:	e8 5f fa ff ff       	call   f0103f80 <irq_eoi>
+		return;
+f0104521:	eb df                	jmp    f0104502 <.L28+0xc>
+
+f0104523 <.L25>:
+		cprintf("Spurious interrupt on irq 7\n");
+f0104523:	83 ec 0c             	sub    $0xc,%esp
+f0104526:	8d 83 56 5a ff ff    	lea    -0xa5aa(%ebx),%eax
+f010452c:	50                   	push   %eax
+f010452d:	e8 60 fb ff ff       	call   f0104092 <cprintf>
+		return;
+f0104532:	83 c4 10             	add    $0x10,%esp
+f0104535:	eb cb                	jmp    f0104502 <.L28+0xc>
+f0104537:	90                   	nop
+
+f0104538 <t_divide>:
+	.p2align 2
+	.globl trap_vectors
+trap_vectors:
+.text
+
+TRAPHANDLER_NOEC(t_divide, T_DIVIDE)
+f0104538:	6a 00                	push   $0x0
+f010453a:	6a 00                	push   $0x0
+f010453c:	e9 f9 00 00 00       	jmp    f010463a <_alltraps>
+f0104541:	90                   	nop
+
+f0104542 <t_debug>:
+TRAPHANDLER_NOEC(t_debug, T_DEBUG)
+f0104542:	6a 00                	push   $0x0
+f0104544:	6a 01                	push   $0x1
+f0104546:	e9 ef 00 00 00       	jmp    f010463a <_alltraps>
+f010454b:	90                   	nop
+
+f010454c <t_nmi>:
+TRAPHANDLER_NOEC(t_nmi, T_NMI)
+f010454c:	6a 00                	push   $0x0
+f010454e:	6a 02                	push   $0x2
+f0104550:	e9 e5 00 00 00       	jmp    f010463a <_alltraps>
+f0104555:	90                   	nop
+
+f0104556 <t_brkpt>:
+TRAPHANDLER_NOEC(t_brkpt, T_BRKPT)
+f0104556:	6a 00                	push   $0x0
+f0104558:	6a 03                	push   $0x3
+f010455a:	e9 db 00 00 00       	jmp    f010463a <_alltraps>
+f010455f:	90                   	nop
+
+f0104560 <t_oflow>:
+TRAPHANDLER_NOEC(t_oflow, T_OFLOW)
+f0104560:	6a 00                	push   $0x0
+f0104562:	6a 04                	push   $0x4
+f0104564:	e9 d1 00 00 00       	jmp    f010463a <_alltraps>
+f0104569:	90                   	nop
+
+f010456a <t_bound>:
+TRAPHANDLER_NOEC(t_bound, T_BOUND)
+f010456a:	6a 00                	push   $0x0
+f010456c:	6a 05                	push   $0x5
+f010456e:	e9 c7 00 00 00       	jmp    f010463a <_alltraps>
+f0104573:	90                   	nop
+
+f0104574 <t_illop>:
+TRAPHANDLER_NOEC(t_illop, T_ILLOP)
+f0104574:	6a 00                	push   $0x0
+f0104576:	6a 06                	push   $0x6
+f0104578:	e9 bd 00 00 00       	jmp    f010463a <_alltraps>
+f010457d:	90                   	nop
+
+f010457e <t_device>:
+TRAPHANDLER_NOEC(t_device, T_DEVICE)
+f010457e:	6a 00                	push   $0x0
+f0104580:	6a 07                	push   $0x7
+f0104582:	e9 b3 00 00 00       	jmp    f010463a <_alltraps>
+f0104587:	90                   	nop
+
+f0104588 <t_dblflt>:
+TRAPHANDLER(t_dblflt, T_DBLFLT)
+f0104588:	6a 08                	push   $0x8
+f010458a:	e9 ab 00 00 00       	jmp    f010463a <_alltraps>
+f010458f:	90                   	nop
+
+f0104590 <t_coproc>:
+TRAPHANDLER_NOEC(t_coproc, 9)
+f0104590:	6a 00                	push   $0x0
+f0104592:	6a 09                	push   $0x9
+f0104594:	e9 a1 00 00 00       	jmp    f010463a <_alltraps>
+f0104599:	90                   	nop
+
+f010459a <t_tss>:
+TRAPHANDLER(t_tss, T_TSS)
+f010459a:	6a 0a                	push   $0xa
+f010459c:	e9 99 00 00 00       	jmp    f010463a <_alltraps>
+f01045a1:	90                   	nop
+
+f01045a2 <t_segnp>:
+TRAPHANDLER(t_segnp, T_SEGNP)
+f01045a2:	6a 0b                	push   $0xb
+f01045a4:	e9 91 00 00 00       	jmp    f010463a <_alltraps>
+f01045a9:	90                   	nop
+
+f01045aa <t_stack>:
+TRAPHANDLER(t_stack, T_STACK)
+f01045aa:	6a 0c                	push   $0xc
+f01045ac:	e9 89 00 00 00       	jmp    f010463a <_alltraps>
+f01045b1:	90                   	nop
+
+f01045b2 <t_gpflt>:
+TRAPHANDLER(t_gpflt, T_GPFLT)
+f01045b2:	6a 0d                	push   $0xd
+f01045b4:	e9 81 00 00 00       	jmp    f010463a <_alltraps>
+f01045b9:	90                   	nop
+
+f01045ba <t_pgflt>:
+TRAPHANDLER(t_pgflt, T_PGFLT)
+f01045ba:	6a 0e                	push   $0xe
+f01045bc:	eb 7c                	jmp    f010463a <_alltraps>
+
+f01045be <t_res>:
+TRAPHANDLER_NOEC(t_res, 15)
+f01045be:	6a 00                	push   $0x0
+f01045c0:	6a 0f                	push   $0xf
+f01045c2:	eb 76                	jmp    f010463a <_alltraps>
+
+f01045c4 <t_fperr>:
+TRAPHANDLER_NOEC(t_fperr, T_FPERR)
+f01045c4:	6a 00                	push   $0x0
+f01045c6:	6a 10                	push   $0x10
+f01045c8:	eb 70                	jmp    f010463a <_alltraps>
+
+f01045ca <t_align>:
+TRAPHANDLER(t_align, T_ALIGN)
+f01045ca:	6a 11                	push   $0x11
+f01045cc:	eb 6c                	jmp    f010463a <_alltraps>
+
+f01045ce <t_mchk>:
+TRAPHANDLER_NOEC(t_mchk, T_MCHK)
+f01045ce:	6a 00                	push   $0x0
+f01045d0:	6a 12                	push   $0x12
+f01045d2:	eb 66                	jmp    f010463a <_alltraps>
+
+f01045d4 <t_simderr>:
+TRAPHANDLER_NOEC(t_simderr, T_SIMDERR)
+f01045d4:	6a 00                	push   $0x0
+f01045d6:	6a 13                	push   $0x13
+f01045d8:	eb 60                	jmp    f010463a <_alltraps>
+
+f01045da <irq_0>:
+
+.data
+	.fill IRQ_OFFSET - (T_SIMDERR + 1), 4, 0	# not used
+.text
+
+TRAPHANDLER_NOEC(irq_0, IRQ_OFFSET + 0)
+f01045da:	6a 00                	push   $0x0
+f01045dc:	6a 20                	push   $0x20
+f01045de:	eb 5a                	jmp    f010463a <_alltraps>
+
+f01045e0 <irq_1>:
+TRAPHANDLER_NOEC(irq_1, IRQ_OFFSET + 1)
+f01045e0:	6a 00                	push   $0x0
+f01045e2:	6a 21                	push   $0x21
+f01045e4:	eb 54                	jmp    f010463a <_alltraps>
+
+f01045e6 <irq_2>:
+TRAPHANDLER_NOEC(irq_2, IRQ_OFFSET + 2)
+f01045e6:	6a 00                	push   $0x0
+f01045e8:	6a 22                	push   $0x22
+f01045ea:	eb 4e                	jmp    f010463a <_alltraps>
+
+f01045ec <irq_3>:
+TRAPHANDLER_NOEC(irq_3, IRQ_OFFSET + 3)
+f01045ec:	6a 00                	push   $0x0
+f01045ee:	6a 23                	push   $0x23
+f01045f0:	eb 48                	jmp    f010463a <_alltraps>
+
+f01045f2 <irq_4>:
+TRAPHANDLER_NOEC(irq_4, IRQ_OFFSET + 4)
+f01045f2:	6a 00                	push   $0x0
+f01045f4:	6a 24                	push   $0x24
+f01045f6:	eb 42                	jmp    f010463a <_alltraps>
+
+f01045f8 <irq_5>:
+TRAPHANDLER_NOEC(irq_5, IRQ_OFFSET + 5)
+f01045f8:	6a 00                	push   $0x0
+f01045fa:	6a 25                	push   $0x25
+f01045fc:	eb 3c                	jmp    f010463a <_alltraps>
+
+f01045fe <irq_6>:
+TRAPHANDLER_NOEC(irq_6, IRQ_OFFSET + 6)
+f01045fe:	6a 00                	push   $0x0
+f0104600:	6a 26                	push   $0x26
+f0104602:	eb 36                	jmp    f010463a <_alltraps>
+
+f0104604 <irq_7>:
+TRAPHANDLER_NOEC(irq_7, IRQ_OFFSET + 7)
+f0104604:	6a 00                	push   $0x0
+f0104606:	6a 27                	push   $0x27
+f0104608:	eb 30                	jmp    f010463a <_alltraps>
+
+f010460a <irq_8>:
+TRAPHANDLER_NOEC(irq_8, IRQ_OFFSET + 8)
+f010460a:	6a 00                	push   $0x0
+f010460c:	6a 28                	push   $0x28
+f010460e:	eb 2a                	jmp    f010463a <_alltraps>
+
+f0104610 <irq_9>:
+TRAPHANDLER_NOEC(irq_9, IRQ_OFFSET + 9)
+f0104610:	6a 00                	push   $0x0
+f0104612:	6a 29                	push   $0x29
+f0104614:	eb 24                	jmp    f010463a <_alltraps>
+
+f0104616 <irq_10>:
+TRAPHANDLER_NOEC(irq_10, IRQ_OFFSET + 10)
+f0104616:	6a 00                	push   $0x0
+f0104618:	6a 2a                	push   $0x2a
+f010461a:	eb 1e                	jmp    f010463a <_alltraps>
+
+f010461c <irq_11>:
+TRAPHANDLER_NOEC(irq_11, IRQ_OFFSET + 11)
+f010461c:	6a 00                	push   $0x0
+f010461e:	6a 2b                	push   $0x2b
+f0104620:	eb 18                	jmp    f010463a <_alltraps>
+
+f0104622 <irq_12>:
+TRAPHANDLER_NOEC(irq_12, IRQ_OFFSET + 12)
+f0104622:	6a 00                	push   $0x0
+f0104624:	6a 2c                	push   $0x2c
+f0104626:	eb 12                	jmp    f010463a <_alltraps>
+
+f0104628 <irq_13>:
+TRAPHANDLER_NOEC(irq_13, IRQ_OFFSET + 13)
+f0104628:	6a 00                	push   $0x0
+f010462a:	6a 2d                	push   $0x2d
+f010462c:	eb 0c                	jmp    f010463a <_alltraps>
+
+f010462e <irq_14>:
+TRAPHANDLER_NOEC(irq_14, IRQ_OFFSET + 14)
+f010462e:	6a 00                	push   $0x0
+f0104630:	6a 2e                	push   $0x2e
+f0104632:	eb 06                	jmp    f010463a <_alltraps>
+
+f0104634 <irq_15>:
+TRAPHANDLER_NOEC(irq_15, IRQ_OFFSET + 15)
+f0104634:	6a 00                	push   $0x0
+f0104636:	6a 2f                	push   $0x2f
+f0104638:	eb 00                	jmp    f010463a <_alltraps>
+
+f010463a <_alltraps>:
+ * _alltraps builds the rest of the struct Trapframe (see inc/trap.h)
+ * on the stack, switches to the kernel data segment and calls trap().
+ * If trap() returns, pop the frame back off and resume.
+ */
+_alltraps:
+	pushl %ds
+f010463a:	1e                   	push   %ds
+	pushl %es
+f010463b:	06                   	push   %es
+	pushal
+f010463c:	60                   	pusha
+
+	movw $GD_KD, %ax
+f010463d:	66 b8 10 00          	mov    $0x10,%ax
+	movw %ax, %ds
+f0104641:	8e d8                	mov    %eax,%ds
+	movw %ax, %es
+f0104643:	8e c0                	mov    %eax,%es
+
+	pushl %esp			# trap(struct Trapframe *tf)
+f0104645:	54                   	push   %esp
+	call trap
+f0104646:	e8 04 fe ff ff       	call   f010444f <trap>
+	addl $4, %esp
+f010464b:	83 c4 04             	add    $0x4,%esp
+
+	popal
+f010464e:	61                   	popa
+	popl %es
+f010464f:	07                   	pop    %es
+	popl %ds
+f0104650:	1f                   	pop    %ds
+	addl $8, %esp			# trap number and error code
+f0104651:	83 c4 08             	add    $0x8,%esp
+	iret
+f0104654:	cf                   	iret
+
+f0104655 <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+	       int type, uintptr_t addr)
+{
+f0104655:	55                   	push   %ebp
+f0104656:	89 e5                	mov    %esp,%ebp
+f0104658:	57                   	push   %edi
+f0104659:	56                   	push   %esi
+f010465a:	53                   	push   %ebx
+f010465b:	83 ec 14             	sub    $0x14,%esp
+f010465e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0104661:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0104664:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+	int l = *region_left, r = *region_right, any_matches = 0;
+f0104667:	8b 1a                	mov    (%edx),%ebx
+f0104669:	8b 09                	mov    (%ecx),%ecx
+f010466b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+	while (l <= r) {
+f0104672:	eb 4f                	jmp    f01046c3 <stab_binsearch+0x6e>
+		int true_m = (l + r) / 2, m = true_m;
+
+		// search for earliest stab with right type
+		while (m >= l && stabs[m].n_type != type)
+			m--;
+f0104674:	83 e8 01             	sub    $0x1,%eax
+		while (m >= l && stabs[m].n_type != type)
+f0104677:	39 c3                	cmp    %eax,%ebx
+f0104679:	0f 8f cc 00 00 00    	jg     f010474b <stab_binsearch+0xf6>
+f010467f:	0f b6 0a             	movzbl (%edx),%ecx
+f0104682:	83 ea 0c             	sub    $0xc,%edx
+f0104685:	39 f1                	cmp    %esi,%ecx
+f0104687:	75 eb                	jne    f0104674 <stab_binsearch+0x1f>
+f0104689:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f010468c:	89 75 08             	mov    %esi,0x8(%ebp)
+			continue;
+		}
+
+		// actual binary search
+		any_matches = 1;
+		if (stabs[m].n_value < addr) {
+f010468f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0104692:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0104695:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0104699:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f010469c:	72 16                	jb     f01046b4 <stab_binsearch+0x5f>
+			*region_left = m;
+			l = true_m + 1;
+		} else if (stabs[m].n_value > addr) {
+f010469e:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f01046a1:	73 48                	jae    f01046eb <stab_binsearch+0x96>
+			*region_right = m - 1;
+f01046a3:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f01046a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01046a9:	89 08                	mov    %ecx,(%eax)
+		any_matches = 1;
+f01046ab:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01046b2:	eb 0f                	jmp    f01046c3 <stab_binsearch+0x6e>
+			*region_left = m;
+f01046b4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01046b7:	89 06                	mov    %eax,(%esi)
+			l = true_m + 1;
+f01046b9:	8d 5f 01             	lea    0x1(%edi),%ebx
+		any_matches = 1;
+f01046bc:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+	while (l <= r) {
+f01046c3:	39 cb                	cmp    %ecx,%ebx
+f01046c5:	7f 38                	jg     f01046ff <stab_binsearch+0xaa>
+		int true_m = (l + r) / 2, m = true_m;
+f01046c7:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f01046ca:	89 c2                	mov    %eax,%edx
+f01046cc:	c1 ea 1f             	shr    $0x1f,%edx
+f01046cf:	01 d0                	add    %edx,%eax
+f01046d1:	89 c7                	mov    %eax,%edi
+f01046d3:	d1 ff                	sar    %edi
+f01046d5:	83 e0 fe             	and    $0xfffffffe,%eax
+f01046d8:	01 f8                	add    %edi,%eax
+f01046da:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f01046dd:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+f01046e1:	89 f8                	mov    %edi,%eax
+f01046e3:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f01046e6:	8b 75 08             	mov    0x8(%ebp),%esi
+		while (m >= l && stabs[m].n_type != type)
+f01046e9:	eb 8c                	jmp    f0104677 <stab_binsearch+0x22>
+			r = m - 1;
+		} else {
+			// exact match for 'addr', but continue loop to find
+			// *region_right
+			*region_left = m;
+f01046eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f01046ee:	89 07                	mov    %eax,(%edi)
+			l = m;
+			addr++;
+f01046f0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f01046f4:	89 c3                	mov    %eax,%ebx
+		any_matches = 1;
+f01046f6:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f01046fd:	eb c4                	jmp    f01046c3 <stab_binsearch+0x6e>
+		}
+	}
+
+	if (!any_matches)
+f01046ff:	8b 75 08             	mov    0x8(%ebp),%esi
+f0104702:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0104706:	75 15                	jne    f010471d <stab_binsearch+0xc8>
+		*region_right = *region_left - 1;
+f0104708:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010470b:	8b 00                	mov    (%eax),%eax
+f010470d:	83 e8 01             	sub    $0x1,%eax
+f0104710:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0104713:	89 07                	mov    %eax,(%edi)
+		     l > *region_left && stabs[l].n_type != type;
+		     l--)
+			/* do nothing */;
+		*region_left = l;
+	}
+}
+f0104715:	83 c4 14             	add    $0x14,%esp
+f0104718:	5b                   	pop    %ebx
+f0104719:	5e                   	pop    %esi
+f010471a:	5f                   	pop    %edi
+f010471b:	5d                   	pop    %ebp
+f010471c:	c3                   	ret
+		for (l = *region_right;
+f010471d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104720:	8b 00                	mov    (%eax),%eax
+		     l > *region_left && stabs[l].n_type != type;
+f0104722:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0104725:	8b 0f                	mov    (%edi),%ecx
+f0104727:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f010472a:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f010472d:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0104731:	39 c1                	cmp    %eax,%ecx
+f0104733:	7d 0f                	jge    f0104744 <stab_binsearch+0xef>
+f0104735:	0f b6 1a             	movzbl (%edx),%ebx
+f0104738:	83 ea 0c             	sub    $0xc,%edx
+f010473b:	39 f3                	cmp    %esi,%ebx
+f010473d:	74 05                	je     f0104744 <stab_binsearch+0xef>
+		     l--)
+f010473f:	83 e8 01             	sub    $0x1,%eax
+f0104742:	eb ed                	jmp    f0104731 <stab_binsearch+0xdc>
+		*region_left = l;
+f0104744:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0104747:	89 07                	mov    %eax,(%edi)
+}
+f0104749:	eb ca                	jmp    f0104715 <stab_binsearch+0xc0>
+			l = true_m + 1;
+f010474b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f010474e:	89 75 08             	mov    %esi,0x8(%ebp)
+f0104751:	8d 5f 01             	lea    0x1(%edi),%ebx
+			continue;
+f0104754:	e9 6a ff ff ff       	jmp    f01046c3 <stab_binsearch+0x6e>
+
+f0104759 <symtab_addfile>:
+	return l - 1;
+}
+
+static int
+symtab_addfile(uint32_t strx)
+{
+f0104759:	e8 84 c8 ff ff       	call   f0100fe2 <__x86.get_pc_thunk.dx>
+f010475e:	81 c2 2e 0d 01 00    	add    $0x10d2e,%edx
+f0104764:	89 c1                	mov    %eax,%ecx
+	if (nsymfile == maxsymfile)
+f0104766:	8b 82 08 d6 00 00    	mov    0xd608(%edx),%eax
+f010476c:	3b 82 fc d5 00 00    	cmp    0xd5fc(%edx),%eax
+f0104772:	74 1b                	je     f010478f <symtab_addfile+0x36>
+{
+f0104774:	55                   	push   %ebp
+f0104775:	89 e5                	mov    %esp,%ebp
+f0104777:	53                   	push   %ebx
+		return -1;
+	symfile[nsymfile] = strx;
+f0104778:	8b 9a 14 d6 00 00    	mov    0xd614(%edx),%ebx
+f010477e:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	return nsymfile++;
+f0104781:	8d 48 01             	lea    0x1(%eax),%ecx
+f0104784:	89 8a 08 d6 00 00    	mov    %ecx,0xd608(%edx)
+}
+f010478a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010478d:	c9                   	leave
+f010478e:	c3                   	ret
+		return -1;
+f010478f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0104794:	c3                   	ret
+
+f0104795 <symtab_addfun>:
+
+static int
+symtab_addfun(uintptr_t addr, uint32_t name, int file)
+{
+f0104795:	55                   	push   %ebp
+f0104796:	89 e5                	mov    %esp,%ebp
+f0104798:	57                   	push   %edi
+f0104799:	56                   	push   %esi
+f010479a:	53                   	push   %ebx
+f010479b:	83 ec 04             	sub    $0x4,%esp
+f010479e:	e8 ac bb ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01047a3:	81 c3 e9 0c 01 00    	add    $0x10ce9,%ebx
+f01047a9:	89 c6                	mov    %eax,%esi
+f01047ab:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+	if (nsymfun == maxsymfun)
+f01047ae:	8b 83 10 d6 00 00    	mov    0xd610(%ebx),%eax
+f01047b4:	3b 83 04 d6 00 00    	cmp    0xd604(%ebx),%eax
+f01047ba:	74 35                	je     f01047f1 <symtab_addfun+0x5c>
+		return -1;
+	symfun[nsymfun].sf_addr = addr;
+f01047bc:	8d 3c 40             	lea    (%eax,%eax,2),%edi
+f01047bf:	8b 8b 1c d6 00 00    	mov    0xd61c(%ebx),%ecx
+f01047c5:	8d 0c b9             	lea    (%ecx,%edi,4),%ecx
+f01047c8:	89 31                	mov    %esi,(%ecx)
+	symfun[nsymfun].sf_name = name;
+f01047ca:	89 51 04             	mov    %edx,0x4(%ecx)
+	symfun[nsymfun].sf_file = file;
+f01047cd:	0f b7 7d f0          	movzwl -0x10(%ebp),%edi
+f01047d1:	66 89 79 08          	mov    %di,0x8(%ecx)
+	symfun[nsymfun].sf_narg = 0;
+f01047d5:	66 c7 41 0a 00 00    	movw   $0x0,0xa(%ecx)
+	nsymfun++;
+f01047db:	83 c0 01             	add    $0x1,%eax
+f01047de:	89 83 10 d6 00 00    	mov    %eax,0xd610(%ebx)
+	return 0;
+f01047e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01047e9:	83 c4 04             	add    $0x4,%esp
+f01047ec:	5b                   	pop    %ebx
+f01047ed:	5e                   	pop    %esi
+f01047ee:	5f                   	pop    %edi
+f01047ef:	5d                   	pop    %ebp
+f01047f0:	c3                   	ret
+		return -1;
+f01047f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01047f6:	eb f1                	jmp    f01047e9 <symtab_addfun+0x54>
+
+f01047f8 <block_alloc>:
+{
+f01047f8:	55                   	push   %ebp
+f01047f9:	89 e5                	mov    %esp,%ebp
+f01047fb:	56                   	push   %esi
+f01047fc:	53                   	push   %ebx
+f01047fd:	e8 4d bb ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0104802:	81 c3 8a 0c 01 00    	add    $0x10c8a,%ebx
+	for (order = 0; (PGSIZE << order) < size; order++)
+f0104808:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010480d:	be 00 10 00 00       	mov    $0x1000,%esi
+f0104812:	89 f2                	mov    %esi,%edx
+f0104814:	d3 e2                	shl    %cl,%edx
+f0104816:	39 c2                	cmp    %eax,%edx
+f0104818:	73 0a                	jae    f0104824 <block_alloc+0x2c>
+		if (order == MAX_ORDER)
+f010481a:	83 f9 0a             	cmp    $0xa,%ecx
+f010481d:	74 15                	je     f0104834 <block_alloc+0x3c>
+	for (order = 0; (PGSIZE << order) < size; order++)
+f010481f:	83 c1 01             	add    $0x1,%ecx
+f0104822:	eb ee                	jmp    f0104812 <block_alloc+0x1a>
+	return page_alloc_order(order, 0);
+f0104824:	83 ec 08             	sub    $0x8,%esp
+f0104827:	6a 00                	push   $0x0
+f0104829:	51                   	push   %ecx
+f010482a:	e8 e4 d8 ff ff       	call   f0102113 <page_alloc_order>
+f010482f:	83 c4 10             	add    $0x10,%esp
+f0104832:	eb 05                	jmp    f0104839 <block_alloc+0x41>
+			return NULL;
+f0104834:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0104839:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010483c:	5b                   	pop    %ebx
+f010483d:	5e                   	pop    %esi
+f010483e:	5d                   	pop    %ebp
+f010483f:	c3                   	ret
+
+f0104840 <symsort>:
+{
+f0104840:	55                   	push   %ebp
+f0104841:	89 e5                	mov    %esp,%ebp
+f0104843:	57                   	push   %edi
+f0104844:	56                   	push   %esi
+f0104845:	53                   	push   %ebx
+f0104846:	83 ec 3c             	sub    $0x3c,%esp
+f0104849:	e8 01 bb ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010484e:	81 c3 3e 0c 01 00    	add    $0x10c3e,%ebx
+f0104854:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0104857:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f010485a:	89 cf                	mov    %ecx,%edi
+	for (i = 1; i < n; i++) {
+f010485c:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+f010485f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f0104866:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%ebp)
+		memmove(tmp, a + i * size, size);
+f010486d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0104870:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	for (i = 1; i < n; i++) {
+f0104873:	eb 4d                	jmp    f01048c2 <symsort+0x82>
+			memmove(a + j * size, a + (j - 1) * size, size);
+f0104875:	83 ec 04             	sub    $0x4,%esp
+f0104878:	57                   	push   %edi
+f0104879:	52                   	push   %edx
+f010487a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010487d:	01 f0                	add    %esi,%eax
+f010487f:	50                   	push   %eax
+f0104880:	e8 be 38 00 00       	call   f0108143 <memmove>
+f0104885:	83 c4 10             	add    $0x10,%esp
+		     j--)
+f0104888:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+		     && *(uintptr_t *) (a + (j - 1) * size) > *(uintptr_t *) tmp;
+f010488b:	85 c0                	test   %eax,%eax
+f010488d:	7e 11                	jle    f01048a0 <symsort+0x60>
+f010488f:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0104892:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+f0104895:	89 f2                	mov    %esi,%edx
+f0104897:	29 fe                	sub    %edi,%esi
+f0104899:	8b 0a                	mov    (%edx),%ecx
+f010489b:	39 4d dc             	cmp    %ecx,-0x24(%ebp)
+f010489e:	72 d5                	jb     f0104875 <symsort+0x35>
+		memmove(a + j * size, tmp, size);
+f01048a0:	83 ec 04             	sub    $0x4,%esp
+f01048a3:	57                   	push   %edi
+f01048a4:	ff 75 bc             	push   -0x44(%ebp)
+f01048a7:	0f af c7             	imul   %edi,%eax
+f01048aa:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f01048ad:	01 d0                	add    %edx,%eax
+f01048af:	50                   	push   %eax
+f01048b0:	e8 8e 38 00 00       	call   f0108143 <memmove>
+	for (i = 1; i < n; i++) {
+f01048b5:	83 45 cc 01          	addl   $0x1,-0x34(%ebp)
+f01048b9:	01 7d c8             	add    %edi,-0x38(%ebp)
+f01048bc:	01 7d c4             	add    %edi,-0x3c(%ebp)
+f01048bf:	83 c4 10             	add    $0x10,%esp
+f01048c2:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f01048c5:	39 55 cc             	cmp    %edx,-0x34(%ebp)
+f01048c8:	7d 2c                	jge    f01048f6 <symsort+0xb6>
+		memmove(tmp, a + i * size, size);
+f01048ca:	83 ec 04             	sub    $0x4,%esp
+f01048cd:	57                   	push   %edi
+f01048ce:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01048d1:	8b 75 c0             	mov    -0x40(%ebp),%esi
+f01048d4:	01 f0                	add    %esi,%eax
+f01048d6:	50                   	push   %eax
+f01048d7:	ff 75 bc             	push   -0x44(%ebp)
+f01048da:	e8 64 38 00 00       	call   f0108143 <memmove>
+f01048df:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01048e2:	01 ce                	add    %ecx,%esi
+		for (j = i; j > 0
+f01048e4:	83 c4 10             	add    $0x10,%esp
+f01048e7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+			memmove(a + j * size, a + (j - 1) * size, size);
+f01048ea:	8b 55 c8             	mov    -0x38(%ebp),%edx
+f01048ed:	01 fa                	add    %edi,%edx
+f01048ef:	29 ca                	sub    %ecx,%edx
+f01048f1:	89 55 d0             	mov    %edx,-0x30(%ebp)
+		for (j = i; j > 0
+f01048f4:	eb 95                	jmp    f010488b <symsort+0x4b>
+}
+f01048f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01048f9:	5b                   	pop    %ebx
+f01048fa:	5e                   	pop    %esi
+f01048fb:	5f                   	pop    %edi
+f01048fc:	5d                   	pop    %ebp
+f01048fd:	c3                   	ret
+
+f01048fe <elf_read>:
+{
+f01048fe:	55                   	push   %ebp
+f01048ff:	89 e5                	mov    %esp,%ebp
+f0104901:	57                   	push   %edi
+f0104902:	56                   	push   %esi
+f0104903:	53                   	push   %ebx
+f0104904:	83 ec 1c             	sub    $0x1c,%esp
+f0104907:	e8 43 ba ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010490c:	81 c3 80 0b 01 00    	add    $0x10b80,%ebx
+f0104912:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0104915:	89 d6                	mov    %edx,%esi
+	uint32_t first = off / SECTSIZE;
+f0104917:	89 d0                	mov    %edx,%eax
+f0104919:	c1 e8 09             	shr    $0x9,%eax
+f010491c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	uint32_t nsecs = (off % SECTSIZE + len + SECTSIZE - 1) / SECTSIZE;
+f010491f:	81 e6 ff 01 00 00    	and    $0x1ff,%esi
+f0104925:	8d 84 0e ff 01 00 00 	lea    0x1ff(%esi,%ecx,1),%eax
+f010492c:	89 c7                	mov    %eax,%edi
+f010492e:	c1 ef 09             	shr    $0x9,%edi
+	if ((*pp = block_alloc(nsecs * SECTSIZE)) == NULL)
+f0104931:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+f0104936:	e8 bd fe ff ff       	call   f01047f8 <block_alloc>
+f010493b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010493e:	89 01                	mov    %eax,(%ecx)
+f0104940:	85 c0                	test   %eax,%eax
+f0104942:	74 76                	je     f01049ba <elf_read+0xbc>
+	return (pp - pages) << PGSHIFT;
+f0104944:	c7 c2 14 43 15 f0    	mov    $0xf0154314,%edx
+f010494a:	2b 02                	sub    (%edx),%eax
+f010494c:	c1 f8 02             	sar    $0x2,%eax
+f010494f:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104955:	89 c2                	mov    %eax,%edx
+f0104957:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f010495a:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010495f:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f0104965:	3b 01                	cmp    (%ecx),%eax
+f0104967:	73 59                	jae    f01049c2 <elf_read+0xc4>
+	if (ide_read(elfsect + first, page2kva(*pp), nsecs) < 0) {
+f0104969:	83 ec 04             	sub    $0x4,%esp
+f010496c:	57                   	push   %edi
+	return (void *)(pa + KERNBASE);
+f010496d:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0104973:	52                   	push   %edx
+f0104974:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0104977:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f010497a:	01 f8                	add    %edi,%eax
+f010497c:	50                   	push   %eax
+f010497d:	e8 ae 4b 00 00       	call   f0109530 <ide_read>
+f0104982:	83 c4 10             	add    $0x10,%esp
+f0104985:	85 c0                	test   %eax,%eax
+f0104987:	78 4f                	js     f01049d8 <elf_read+0xda>
+	return (pp - pages) << PGSHIFT;
+f0104989:	8b 45 08             	mov    0x8(%ebp),%eax
+f010498c:	8b 00                	mov    (%eax),%eax
+f010498e:	c7 c2 14 43 15 f0    	mov    $0xf0154314,%edx
+f0104994:	2b 02                	sub    (%edx),%eax
+f0104996:	c1 f8 02             	sar    $0x2,%eax
+f0104999:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010499f:	89 c2                	mov    %eax,%edx
+f01049a1:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01049a4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01049a9:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f01049af:	3b 01                	cmp    (%ecx),%eax
+f01049b1:	73 45                	jae    f01049f8 <elf_read+0xfa>
+	return (char *) page2kva(*pp) + off % SECTSIZE;
+f01049b3:	8d 84 16 00 00 00 f0 	lea    -0x10000000(%esi,%edx,1),%eax
+}
+f01049ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01049bd:	5b                   	pop    %ebx
+f01049be:	5e                   	pop    %esi
+f01049bf:	5f                   	pop    %edi
+f01049c0:	5d                   	pop    %ebp
+f01049c1:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01049c2:	52                   	push   %edx
+f01049c3:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f01049c9:	50                   	push   %eax
+f01049ca:	6a 53                	push   $0x53
+f01049cc:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f01049d2:	50                   	push   %eax
+f01049d3:	e8 20 b7 ff ff       	call   f01000f8 <_panic>
+		page_free(*pp);
+f01049d8:	83 ec 0c             	sub    $0xc,%esp
+f01049db:	8b 45 08             	mov    0x8(%ebp),%eax
+f01049de:	ff 30                	push   (%eax)
+f01049e0:	e8 fe d7 ff ff       	call   f01021e3 <page_free>
+		*pp = NULL;
+f01049e5:	8b 45 08             	mov    0x8(%ebp),%eax
+f01049e8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		return NULL;
+f01049ee:	83 c4 10             	add    $0x10,%esp
+f01049f1:	b8 00 00 00 00       	mov    $0x0,%eax
+f01049f6:	eb c2                	jmp    f01049ba <elf_read+0xbc>
+f01049f8:	52                   	push   %edx
+f01049f9:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f01049ff:	50                   	push   %eax
+f0104a00:	6a 53                	push   $0x53
+f0104a02:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0104a08:	50                   	push   %eax
+f0104a09:	e8 ea b6 ff ff       	call   f01000f8 <_panic>
+
+f0104a0e <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0104a0e:	55                   	push   %ebp
+f0104a0f:	89 e5                	mov    %esp,%ebp
+f0104a11:	57                   	push   %edi
+f0104a12:	56                   	push   %esi
+f0104a13:	53                   	push   %ebx
+f0104a14:	83 ec 5c             	sub    $0x5c,%esp
+f0104a17:	e8 d2 c5 ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0104a1c:	81 c7 70 0a 01 00    	add    $0x10a70,%edi
+	const struct Symfun *sf;
+	int ifun, iline;
+
+	// Initialize *info
+	info->eip_file = "<unknown>";
+f0104a22:	8d 87 8c 5c ff ff    	lea    -0xa374(%edi),%eax
+f0104a28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0104a2b:	89 03                	mov    %eax,(%ebx)
+	info->eip_line = 0;
+f0104a2d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+	info->eip_fn_name = "<unknown>";
+f0104a34:	89 43 08             	mov    %eax,0x8(%ebx)
+	info->eip_fn_namelen = 9;
+f0104a37:	89 d8                	mov    %ebx,%eax
+f0104a39:	c7 43 0c 09 00 00 00 	movl   $0x9,0xc(%ebx)
+	info->eip_fn_addr = addr;
+f0104a40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104a43:	89 58 10             	mov    %ebx,0x10(%eax)
+	info->eip_fn_narg = 0;
+f0104a46:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+	// Find the relevant set of stabs
+	if (addr >= ULIM) {
+f0104a4d:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f0104a53:	0f 86 c2 03 00 00    	jbe    f0104e1b <debuginfo_eip+0x40d>
+		// Read them from disk the first time, once there is
+		// a disk to read them from.
+		if (stab_state == 0 && ide_nsectors() != 0)
+f0104a59:	8b 87 20 d6 00 00    	mov    0xd620(%edi),%eax
+f0104a5f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0104a62:	85 c0                	test   %eax,%eax
+f0104a64:	74 7f                	je     f0104ae5 <debuginfo_eip+0xd7>
+			stab_state = stab_load() < 0 ? -1 : 1;
+		if (stab_state <= 0)
+f0104a66:	83 bf 20 d6 00 00 00 	cmpl   $0x0,0xd620(%edi)
+f0104a6d:	0f 8e 92 09 00 00    	jle    f0105405 <debuginfo_eip+0x9f7>
+		// Can't search for user-level addresses yet!
+  	        panic("User address");
+	}
+
+	// String table validity checks
+	if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0104a73:	8b 87 30 d6 00 00    	mov    0xd630(%edi),%eax
+f0104a79:	39 87 34 d6 00 00    	cmp    %eax,0xd634(%edi)
+f0104a7f:	0f 83 87 09 00 00    	jae    f010540c <debuginfo_eip+0x9fe>
+f0104a85:	80 78 ff 00          	cmpb   $0x0,-0x1(%eax)
+f0104a89:	0f 85 84 09 00 00    	jne    f0105413 <debuginfo_eip+0xa05>
+		return -1;
+
+	if (symtab_state == 0) {
+f0104a8f:	83 bf f4 d5 00 00 00 	cmpl   $0x0,0xd5f4(%edi)
+f0104a96:	0f 84 9c 03 00 00    	je     f0104e38 <debuginfo_eip+0x42a>
+			page_free(stab_pp);
+			stab_pp = NULL;
+			stabs = stab_end = NULL;
+		}
+	}
+	if (symtab_state < 0)
+f0104a9c:	83 bf f4 d5 00 00 00 	cmpl   $0x0,0xd5f4(%edi)
+f0104aa3:	0f 88 da 06 00 00    	js     f0105183 <debuginfo_eip+0x775>
+		return stab_debuginfo(addr, info);
+
+	// Find the function, or the file if it's not in one
+	if ((ifun = symsearch(symfun, nsymfun, sizeof(symfun[0]), addr)) < 0)
+f0104aa9:	8b 97 10 d6 00 00    	mov    0xd610(%edi),%edx
+f0104aaf:	8b 9f 1c d6 00 00    	mov    0xd61c(%edi),%ebx
+	int l = 0, r = n;
+f0104ab5:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while (l < r) {
+f0104aba:	39 ca                	cmp    %ecx,%edx
+f0104abc:	0f 8e 7a 08 00 00    	jle    f010533c <debuginfo_eip+0x92e>
+		int m = (l + r) / 2;
+f0104ac2:	8d 34 0a             	lea    (%edx,%ecx,1),%esi
+f0104ac5:	89 f0                	mov    %esi,%eax
+f0104ac7:	c1 e8 1f             	shr    $0x1f,%eax
+f0104aca:	01 f0                	add    %esi,%eax
+f0104acc:	89 c6                	mov    %eax,%esi
+f0104ace:	d1 fe                	sar    %esi
+		if (*(const uintptr_t *) (a + m * size) <= addr)
+f0104ad0:	83 e0 fe             	and    $0xfffffffe,%eax
+f0104ad3:	01 f0                	add    %esi,%eax
+f0104ad5:	8b 04 83             	mov    (%ebx,%eax,4),%eax
+f0104ad8:	39 45 08             	cmp    %eax,0x8(%ebp)
+f0104adb:	0f 83 53 08 00 00    	jae    f0105334 <debuginfo_eip+0x926>
+		int m = (l + r) / 2;
+f0104ae1:	89 f2                	mov    %esi,%edx
+f0104ae3:	eb d5                	jmp    f0104aba <debuginfo_eip+0xac>
+		if (stab_state == 0 && ide_nsectors() != 0)
+f0104ae5:	89 fb                	mov    %edi,%ebx
+f0104ae7:	e8 74 4a 00 00       	call   f0109560 <ide_nsectors>
+f0104aec:	85 c0                	test   %eax,%eax
+f0104aee:	0f 84 72 ff ff ff    	je     f0104a66 <debuginfo_eip+0x58>
+	struct PageInfo *elfpp, *shpp = NULL, *shstrpp = NULL;
+f0104af4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0104afb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	uint32_t elfsect = 1;
+f0104b02:	be 01 00 00 00       	mov    $0x1,%esi
+	if (bi->bi_magic == BOOTINFO_MAGIC && (bi->bi_flags & BI_ELFSECT))
+f0104b07:	81 3d 00 60 00 f0 42 	cmpl   $0x544f4f42,0xf0006000
+f0104b0e:	4f 4f 54 
+f0104b11:	74 75                	je     f0104b88 <debuginfo_eip+0x17a>
+	if ((elf = elf_read(elfsect, 0, sizeof(*elf), &elfpp)) == NULL)
+f0104b13:	83 ec 0c             	sub    $0xc,%esp
+f0104b16:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0104b19:	50                   	push   %eax
+f0104b1a:	b9 34 00 00 00       	mov    $0x34,%ecx
+f0104b1f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104b24:	89 f0                	mov    %esi,%eax
+f0104b26:	e8 d3 fd ff ff       	call   f01048fe <elf_read>
+f0104b2b:	89 c3                	mov    %eax,%ebx
+f0104b2d:	83 c4 10             	add    $0x10,%esp
+f0104b30:	85 c0                	test   %eax,%eax
+f0104b32:	0f 84 dc 02 00 00    	je     f0104e14 <debuginfo_eip+0x406>
+	if (elf->e_magic != ELF_MAGIC || elf->e_entry != (uintptr_t) _start
+f0104b38:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f0104b3e:	75 1c                	jne    f0104b5c <debuginfo_eip+0x14e>
+f0104b40:	c7 c0 0c 00 10 00    	mov    $0x10000c,%eax
+f0104b46:	39 43 18             	cmp    %eax,0x18(%ebx)
+f0104b49:	75 11                	jne    f0104b5c <debuginfo_eip+0x14e>
+	    || elf->e_shentsize != sizeof(*sh)
+f0104b4b:	66 83 7b 2e 28       	cmpw   $0x28,0x2e(%ebx)
+f0104b50:	75 0a                	jne    f0104b5c <debuginfo_eip+0x14e>
+	    || elf->e_shstrndx >= elf->e_shnum)
+f0104b52:	0f b7 43 30          	movzwl 0x30(%ebx),%eax
+f0104b56:	66 39 43 32          	cmp    %ax,0x32(%ebx)
+f0104b5a:	72 40                	jb     f0104b9c <debuginfo_eip+0x18e>
+	if (shpp)
+f0104b5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104b5f:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104b66:	85 c0                	test   %eax,%eax
+f0104b68:	0f 85 59 02 00 00    	jne    f0104dc7 <debuginfo_eip+0x3b9>
+	page_free(elfpp);
+f0104b6e:	83 ec 0c             	sub    $0xc,%esp
+f0104b71:	ff 75 dc             	push   -0x24(%ebp)
+f0104b74:	89 fb                	mov    %edi,%ebx
+f0104b76:	e8 68 d6 ff ff       	call   f01021e3 <page_free>
+f0104b7b:	83 c4 10             	add    $0x10,%esp
+			stab_state = stab_load() < 0 ? -1 : 1;
+f0104b7e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104b83:	e9 66 02 00 00       	jmp    f0104dee <debuginfo_eip+0x3e0>
+	if (bi->bi_magic == BOOTINFO_MAGIC && (bi->bi_flags & BI_ELFSECT))
+f0104b88:	f6 05 04 60 00 f0 02 	testb  $0x2,0xf0006004
+f0104b8f:	74 82                	je     f0104b13 <debuginfo_eip+0x105>
+		elfsect = bi->bi_elfsect;
+f0104b91:	8b 35 08 60 00 f0    	mov    0xf0006008,%esi
+f0104b97:	e9 77 ff ff ff       	jmp    f0104b13 <debuginfo_eip+0x105>
+			   elf->e_shnum * sizeof(*sh), &shpp)) == NULL)
+f0104b9c:	0f b7 c0             	movzwl %ax,%eax
+	if ((sh = elf_read(elfsect, elf->e_shoff,
+f0104b9f:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+f0104ba2:	c1 e1 03             	shl    $0x3,%ecx
+f0104ba5:	8b 53 20             	mov    0x20(%ebx),%edx
+f0104ba8:	83 ec 0c             	sub    $0xc,%esp
+f0104bab:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0104bae:	50                   	push   %eax
+f0104baf:	89 f0                	mov    %esi,%eax
+f0104bb1:	e8 48 fd ff ff       	call   f01048fe <elf_read>
+f0104bb6:	89 c1                	mov    %eax,%ecx
+f0104bb8:	83 c4 10             	add    $0x10,%esp
+f0104bbb:	85 c0                	test   %eax,%eax
+f0104bbd:	74 9d                	je     f0104b5c <debuginfo_eip+0x14e>
+	shstrsh = &sh[elf->e_shstrndx];
+f0104bbf:	0f b7 43 32          	movzwl 0x32(%ebx),%eax
+f0104bc3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0104bc6:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0104bc9:	8d 04 c1             	lea    (%ecx,%eax,8),%eax
+	if (shstrsh->sh_size == 0
+f0104bcc:	8b 48 14             	mov    0x14(%eax),%ecx
+f0104bcf:	85 c9                	test   %ecx,%ecx
+f0104bd1:	74 89                	je     f0104b5c <debuginfo_eip+0x14e>
+	    || (shstr = elf_read(elfsect, shstrsh->sh_offset,
+f0104bd3:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f0104bd6:	8b 50 10             	mov    0x10(%eax),%edx
+f0104bd9:	83 ec 0c             	sub    $0xc,%esp
+f0104bdc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0104bdf:	50                   	push   %eax
+f0104be0:	89 f0                	mov    %esi,%eax
+f0104be2:	e8 17 fd ff ff       	call   f01048fe <elf_read>
+f0104be7:	89 c2                	mov    %eax,%edx
+f0104be9:	89 45 b0             	mov    %eax,-0x50(%ebp)
+f0104bec:	83 c4 10             	add    $0x10,%esp
+f0104bef:	85 c0                	test   %eax,%eax
+f0104bf1:	0f 84 a4 01 00 00    	je     f0104d9b <debuginfo_eip+0x38d>
+	    || shstr[shstrsh->sh_size - 1] != 0)
+f0104bf7:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f0104bfa:	8b 40 14             	mov    0x14(%eax),%eax
+f0104bfd:	80 7c 02 ff 00       	cmpb   $0x0,-0x1(%edx,%eax,1)
+f0104c02:	0f 85 9c 01 00 00    	jne    f0104da4 <debuginfo_eip+0x396>
+f0104c08:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0104c0b:	89 4d a8             	mov    %ecx,-0x58(%ebp)
+	for (i = 0; i < elf->e_shnum; i++) {
+f0104c0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0104c11:	89 45 ac             	mov    %eax,-0x54(%ebp)
+	struct Secthdr *sh, *shstrsh, *stabsh = NULL, *stabstrsh = NULL;
+f0104c14:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+f0104c1b:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+		if (strcmp(shstr + sh[i].sh_name, ".stab") == 0)
+f0104c22:	8d 87 96 5c ff ff    	lea    -0xa36a(%edi),%eax
+f0104c28:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		else if (strcmp(shstr + sh[i].sh_name, ".stabstr") == 0)
+f0104c2b:	8d 87 9c 5c ff ff    	lea    -0xa364(%edi),%eax
+f0104c31:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0104c34:	89 75 9c             	mov    %esi,-0x64(%ebp)
+f0104c37:	89 de                	mov    %ebx,%esi
+f0104c39:	eb 2d                	jmp    f0104c68 <debuginfo_eip+0x25a>
+f0104c3b:	83 ec 08             	sub    $0x8,%esp
+f0104c3e:	ff 75 a0             	push   -0x60(%ebp)
+f0104c41:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0104c44:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+f0104c47:	03 18                	add    (%eax),%ebx
+f0104c49:	53                   	push   %ebx
+f0104c4a:	89 fb                	mov    %edi,%ebx
+f0104c4c:	e8 a4 33 00 00       	call   f0107ff5 <strcmp>
+f0104c51:	83 c4 10             	add    $0x10,%esp
+			stabstrsh = &sh[i];
+f0104c54:	85 c0                	test   %eax,%eax
+f0104c56:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0104c59:	0f 45 45 c0          	cmovne -0x40(%ebp),%eax
+f0104c5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	for (i = 0; i < elf->e_shnum; i++) {
+f0104c60:	83 45 ac 01          	addl   $0x1,-0x54(%ebp)
+f0104c64:	83 45 a8 28          	addl   $0x28,-0x58(%ebp)
+f0104c68:	0f b7 46 30          	movzwl 0x30(%esi),%eax
+f0104c6c:	39 45 ac             	cmp    %eax,-0x54(%ebp)
+f0104c6f:	7d 32                	jge    f0104ca3 <debuginfo_eip+0x295>
+		if (sh[i].sh_name >= shstrsh->sh_size)
+f0104c71:	8b 45 a8             	mov    -0x58(%ebp),%eax
+f0104c74:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f0104c77:	8b 00                	mov    (%eax),%eax
+f0104c79:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f0104c7c:	3b 43 14             	cmp    0x14(%ebx),%eax
+f0104c7f:	73 df                	jae    f0104c60 <debuginfo_eip+0x252>
+		if (strcmp(shstr + sh[i].sh_name, ".stab") == 0)
+f0104c81:	83 ec 08             	sub    $0x8,%esp
+f0104c84:	ff 75 a4             	push   -0x5c(%ebp)
+f0104c87:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+f0104c8a:	01 d8                	add    %ebx,%eax
+f0104c8c:	50                   	push   %eax
+f0104c8d:	89 fb                	mov    %edi,%ebx
+f0104c8f:	e8 61 33 00 00       	call   f0107ff5 <strcmp>
+f0104c94:	83 c4 10             	add    $0x10,%esp
+f0104c97:	85 c0                	test   %eax,%eax
+f0104c99:	75 a0                	jne    f0104c3b <debuginfo_eip+0x22d>
+			stabsh = &sh[i];
+f0104c9b:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0104c9e:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f0104ca1:	eb bd                	jmp    f0104c60 <debuginfo_eip+0x252>
+	if (!stabsh || !stabstrsh || stabstrsh->sh_size == 0
+f0104ca3:	8b 75 9c             	mov    -0x64(%ebp),%esi
+f0104ca6:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0104ca9:	85 db                	test   %ebx,%ebx
+f0104cab:	0f 84 48 01 00 00    	je     f0104df9 <debuginfo_eip+0x3eb>
+f0104cb1:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0104cb4:	85 c0                	test   %eax,%eax
+f0104cb6:	0f 84 3d 01 00 00    	je     f0104df9 <debuginfo_eip+0x3eb>
+f0104cbc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+f0104cc0:	0f 84 3c 01 00 00    	je     f0104e02 <debuginfo_eip+0x3f4>
+	    || stabsh->sh_size % sizeof(struct Stab) != 0)
+f0104cc6:	8b 5b 14             	mov    0x14(%ebx),%ebx
+f0104cc9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+f0104cce:	89 d8                	mov    %ebx,%eax
+f0104cd0:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104cd5:	f7 f1                	div    %ecx
+f0104cd7:	85 d2                	test   %edx,%edx
+f0104cd9:	74 0c                	je     f0104ce7 <debuginfo_eip+0x2d9>
+	int i, r = -1;
+f0104cdb:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104ce2:	e9 c4 00 00 00       	jmp    f0104dab <debuginfo_eip+0x39d>
+	if ((stabs = elf_read(elfsect, stabsh->sh_offset, stabsh->sh_size,
+f0104ce7:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0104cea:	8b 51 10             	mov    0x10(%ecx),%edx
+f0104ced:	83 ec 0c             	sub    $0xc,%esp
+f0104cf0:	8d 87 2c d6 00 00    	lea    0xd62c(%edi),%eax
+f0104cf6:	50                   	push   %eax
+f0104cf7:	89 d9                	mov    %ebx,%ecx
+f0104cf9:	89 f0                	mov    %esi,%eax
+f0104cfb:	e8 fe fb ff ff       	call   f01048fe <elf_read>
+f0104d00:	89 87 3c d6 00 00    	mov    %eax,0xd63c(%edi)
+f0104d06:	83 c4 10             	add    $0x10,%esp
+f0104d09:	85 c0                	test   %eax,%eax
+f0104d0b:	0f 84 fa 00 00 00    	je     f0104e0b <debuginfo_eip+0x3fd>
+	if ((stabstr = elf_read(elfsect, stabstrsh->sh_offset,
+f0104d11:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0104d14:	8b 48 14             	mov    0x14(%eax),%ecx
+f0104d17:	8b 50 10             	mov    0x10(%eax),%edx
+f0104d1a:	83 ec 0c             	sub    $0xc,%esp
+f0104d1d:	8d 87 28 d6 00 00    	lea    0xd628(%edi),%eax
+f0104d23:	50                   	push   %eax
+f0104d24:	89 f0                	mov    %esi,%eax
+f0104d26:	e8 d3 fb ff ff       	call   f01048fe <elf_read>
+f0104d2b:	89 c3                	mov    %eax,%ebx
+f0104d2d:	89 87 34 d6 00 00    	mov    %eax,0xd634(%edi)
+f0104d33:	83 c4 10             	add    $0x10,%esp
+f0104d36:	85 c0                	test   %eax,%eax
+f0104d38:	74 3b                	je     f0104d75 <debuginfo_eip+0x367>
+	stab_end = stabs + stabsh->sh_size / sizeof(struct Stab);
+f0104d3a:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0104d3d:	8b 48 14             	mov    0x14(%eax),%ecx
+f0104d40:	be 0c 00 00 00       	mov    $0xc,%esi
+f0104d45:	89 c8                	mov    %ecx,%eax
+f0104d47:	ba 00 00 00 00       	mov    $0x0,%edx
+f0104d4c:	f7 f6                	div    %esi
+f0104d4e:	6b c0 0c             	imul   $0xc,%eax,%eax
+f0104d51:	03 87 3c d6 00 00    	add    0xd63c(%edi),%eax
+f0104d57:	89 87 38 d6 00 00    	mov    %eax,0xd638(%edi)
+	stabstr_end = stabstr + stabstrsh->sh_size;
+f0104d5d:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0104d60:	8b 40 14             	mov    0x14(%eax),%eax
+f0104d63:	01 c3                	add    %eax,%ebx
+f0104d65:	89 9f 30 d6 00 00    	mov    %ebx,0xd630(%edi)
+	stab_disksize = stabsh->sh_size + stabstrsh->sh_size;
+f0104d6b:	01 c8                	add    %ecx,%eax
+f0104d6d:	89 87 24 d6 00 00    	mov    %eax,0xd624(%edi)
+f0104d73:	eb 36                	jmp    f0104dab <debuginfo_eip+0x39d>
+		page_free(stab_pp);
+f0104d75:	83 ec 0c             	sub    $0xc,%esp
+f0104d78:	ff b7 2c d6 00 00    	push   0xd62c(%edi)
+f0104d7e:	89 fb                	mov    %edi,%ebx
+f0104d80:	e8 5e d4 ff ff       	call   f01021e3 <page_free>
+		stab_pp = NULL;
+f0104d85:	c7 87 2c d6 00 00 00 	movl   $0x0,0xd62c(%edi)
+f0104d8c:	00 00 00 
+		goto out;
+f0104d8f:	83 c4 10             	add    $0x10,%esp
+	int i, r = -1;
+f0104d92:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+		goto out;
+f0104d99:	eb 10                	jmp    f0104dab <debuginfo_eip+0x39d>
+	int i, r = -1;
+f0104d9b:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104da2:	eb 07                	jmp    f0104dab <debuginfo_eip+0x39d>
+f0104da4:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+	if (shstrpp)
+f0104dab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0104dae:	85 c0                	test   %eax,%eax
+f0104db0:	74 0e                	je     f0104dc0 <debuginfo_eip+0x3b2>
+		page_free(shstrpp);
+f0104db2:	83 ec 0c             	sub    $0xc,%esp
+f0104db5:	50                   	push   %eax
+f0104db6:	89 fb                	mov    %edi,%ebx
+f0104db8:	e8 26 d4 ff ff       	call   f01021e3 <page_free>
+f0104dbd:	83 c4 10             	add    $0x10,%esp
+	if (shpp)
+f0104dc0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0104dc3:	85 c0                	test   %eax,%eax
+f0104dc5:	74 0e                	je     f0104dd5 <debuginfo_eip+0x3c7>
+		page_free(shpp);
+f0104dc7:	83 ec 0c             	sub    $0xc,%esp
+f0104dca:	50                   	push   %eax
+f0104dcb:	89 fb                	mov    %edi,%ebx
+f0104dcd:	e8 11 d4 ff ff       	call   f01021e3 <page_free>
+f0104dd2:	83 c4 10             	add    $0x10,%esp
+	page_free(elfpp);
+f0104dd5:	83 ec 0c             	sub    $0xc,%esp
+f0104dd8:	ff 75 dc             	push   -0x24(%ebp)
+f0104ddb:	89 fb                	mov    %edi,%ebx
+f0104ddd:	e8 01 d4 ff ff       	call   f01021e3 <page_free>
+			stab_state = stab_load() < 0 ? -1 : 1;
+f0104de2:	83 c4 10             	add    $0x10,%esp
+f0104de5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0104de8:	c1 f8 1f             	sar    $0x1f,%eax
+f0104deb:	83 c8 01             	or     $0x1,%eax
+f0104dee:	89 87 20 d6 00 00    	mov    %eax,0xd620(%edi)
+f0104df4:	e9 6d fc ff ff       	jmp    f0104a66 <debuginfo_eip+0x58>
+	int i, r = -1;
+f0104df9:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104e00:	eb a9                	jmp    f0104dab <debuginfo_eip+0x39d>
+f0104e02:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104e09:	eb a0                	jmp    f0104dab <debuginfo_eip+0x39d>
+f0104e0b:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+f0104e12:	eb 97                	jmp    f0104dab <debuginfo_eip+0x39d>
+			stab_state = stab_load() < 0 ? -1 : 1;
+f0104e14:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0104e19:	eb d3                	jmp    f0104dee <debuginfo_eip+0x3e0>
+  	        panic("User address");
+f0104e1b:	83 ec 04             	sub    $0x4,%esp
+f0104e1e:	8d 87 a5 5c ff ff    	lea    -0xa35b(%edi),%eax
+f0104e24:	50                   	push   %eax
+f0104e25:	68 20 02 00 00       	push   $0x220
+f0104e2a:	8d 87 b2 5c ff ff    	lea    -0xa34e(%edi),%eax
+f0104e30:	50                   	push   %eax
+f0104e31:	89 fb                	mov    %edi,%ebx
+f0104e33:	e8 c0 b2 ff ff       	call   f01000f8 <_panic>
+	for (stab = stabs; stab < stab_end; stab++)
+f0104e38:	8b 97 3c d6 00 00    	mov    0xd63c(%edi),%edx
+f0104e3e:	8b 8f 38 d6 00 00    	mov    0xd638(%edi),%ecx
+f0104e44:	8b b7 04 d6 00 00    	mov    0xd604(%edi),%esi
+f0104e4a:	8b 9f fc d5 00 00    	mov    0xd5fc(%edi),%ebx
+f0104e50:	8b 87 00 d6 00 00    	mov    0xd600(%edi),%eax
+f0104e56:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f0104e59:	c6 45 c4 00          	movb   $0x0,-0x3c(%ebp)
+f0104e5d:	c6 45 c0 00          	movb   $0x0,-0x40(%ebp)
+f0104e61:	c6 45 bc 00          	movb   $0x0,-0x44(%ebp)
+f0104e65:	eb 1e                	jmp    f0104e85 <debuginfo_eip+0x477>
+		switch (stab->n_type) {
+f0104e67:	3c 84                	cmp    $0x84,%al
+f0104e69:	75 17                	jne    f0104e82 <debuginfo_eip+0x474>
+			maxsymfile++;
+f0104e6b:	83 c3 01             	add    $0x1,%ebx
+			break;
+f0104e6e:	c6 45 c4 01          	movb   $0x1,-0x3c(%ebp)
+f0104e72:	eb 0e                	jmp    f0104e82 <debuginfo_eip+0x474>
+			maxsymfun++;
+f0104e74:	83 c6 01             	add    $0x1,%esi
+			maxsymfile++;
+f0104e77:	83 c3 01             	add    $0x1,%ebx
+			break;
+f0104e7a:	c6 45 c4 01          	movb   $0x1,-0x3c(%ebp)
+f0104e7e:	c6 45 c0 01          	movb   $0x1,-0x40(%ebp)
+	for (stab = stabs; stab < stab_end; stab++)
+f0104e82:	83 c2 0c             	add    $0xc,%edx
+f0104e85:	39 ca                	cmp    %ecx,%edx
+f0104e87:	73 25                	jae    f0104eae <debuginfo_eip+0x4a0>
+		switch (stab->n_type) {
+f0104e89:	0f b6 42 04          	movzbl 0x4(%edx),%eax
+f0104e8d:	3c 64                	cmp    $0x64,%al
+f0104e8f:	74 e3                	je     f0104e74 <debuginfo_eip+0x466>
+f0104e91:	77 d4                	ja     f0104e67 <debuginfo_eip+0x459>
+f0104e93:	3c 24                	cmp    $0x24,%al
+f0104e95:	74 0e                	je     f0104ea5 <debuginfo_eip+0x497>
+f0104e97:	3c 44                	cmp    $0x44,%al
+f0104e99:	75 e7                	jne    f0104e82 <debuginfo_eip+0x474>
+			maxsymline++;
+f0104e9b:	83 45 b8 01          	addl   $0x1,-0x48(%ebp)
+			break;
+f0104e9f:	c6 45 bc 01          	movb   $0x1,-0x44(%ebp)
+f0104ea3:	eb dd                	jmp    f0104e82 <debuginfo_eip+0x474>
+			maxsymfun++;
+f0104ea5:	83 c6 01             	add    $0x1,%esi
+			break;
+f0104ea8:	c6 45 c0 01          	movb   $0x1,-0x40(%ebp)
+f0104eac:	eb d4                	jmp    f0104e82 <debuginfo_eip+0x474>
+f0104eae:	80 7d c4 00          	cmpb   $0x0,-0x3c(%ebp)
+f0104eb2:	74 06                	je     f0104eba <debuginfo_eip+0x4ac>
+f0104eb4:	89 9f fc d5 00 00    	mov    %ebx,0xd5fc(%edi)
+f0104eba:	80 7d c0 00          	cmpb   $0x0,-0x40(%ebp)
+f0104ebe:	74 06                	je     f0104ec6 <debuginfo_eip+0x4b8>
+f0104ec0:	89 b7 04 d6 00 00    	mov    %esi,0xd604(%edi)
+f0104ec6:	80 7d bc 00          	cmpb   $0x0,-0x44(%ebp)
+f0104eca:	74 09                	je     f0104ed5 <debuginfo_eip+0x4c7>
+f0104ecc:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f0104ecf:	89 87 00 d6 00 00    	mov    %eax,0xd600(%edi)
+	if (maxsymfile >= SYM_NOFILE)
+f0104ed5:	8b 97 fc d5 00 00    	mov    0xd5fc(%edi),%edx
+f0104edb:	81 fa fe ff 00 00    	cmp    $0xfffe,%edx
+f0104ee1:	0f 8f 6b 02 00 00    	jg     f0105152 <debuginfo_eip+0x744>
+	size = maxsymfun * sizeof(*symfun) + maxsymline * sizeof(*symline)
+f0104ee7:	8b 87 04 d6 00 00    	mov    0xd604(%edi),%eax
+f0104eed:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+f0104ef0:	8b 87 00 d6 00 00    	mov    0xd600(%edi),%eax
+f0104ef6:	c1 e0 03             	shl    $0x3,%eax
+f0104ef9:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+f0104efc:	8d 04 90             	lea    (%eax,%edx,4),%eax
+	if ((symtab_pp = block_alloc(size)) == NULL)
+f0104eff:	e8 f4 f8 ff ff       	call   f01047f8 <block_alloc>
+f0104f04:	89 87 f8 d5 00 00    	mov    %eax,0xd5f8(%edi)
+f0104f0a:	85 c0                	test   %eax,%eax
+f0104f0c:	0f 84 40 02 00 00    	je     f0105152 <debuginfo_eip+0x744>
+	return (pp - pages) << PGSHIFT;
+f0104f12:	c7 c2 14 43 15 f0    	mov    $0xf0154314,%edx
+f0104f18:	2b 02                	sub    (%edx),%eax
+f0104f1a:	c1 f8 02             	sar    $0x2,%eax
+f0104f1d:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0104f23:	89 c2                	mov    %eax,%edx
+f0104f25:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0104f28:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0104f2d:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f0104f33:	3b 01                	cmp    (%ecx),%eax
+f0104f35:	73 54                	jae    f0104f8b <debuginfo_eip+0x57d>
+	return (void *)(pa + KERNBASE);
+f0104f37:	8d 9a 00 00 00 f0    	lea    -0x10000000(%edx),%ebx
+f0104f3d:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+	symfun = (struct Symfun *) p;
+f0104f40:	89 9f 1c d6 00 00    	mov    %ebx,0xd61c(%edi)
+	symline = (struct Symline *) (p + maxsymfun * sizeof(*symfun));
+f0104f46:	8b 87 04 d6 00 00    	mov    0xd604(%edi),%eax
+f0104f4c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0104f4f:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+f0104f52:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f0104f55:	89 87 18 d6 00 00    	mov    %eax,0xd618(%edi)
+	symfile = (uint32_t *) (symline + maxsymline);
+f0104f5b:	8b 97 00 d6 00 00    	mov    0xd600(%edi),%edx
+f0104f61:	89 55 bc             	mov    %edx,-0x44(%ebp)
+f0104f64:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+f0104f67:	89 87 14 d6 00 00    	mov    %eax,0xd614(%edi)
+	for (stab = stabs; stab < stab_end; stab++) {
+f0104f6d:	8b 9f 3c d6 00 00    	mov    0xd63c(%edi),%ebx
+	file = linefile = -1;
+f0104f73:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f0104f78:	c7 45 c0 ff ff ff ff 	movl   $0xffffffff,-0x40(%ebp)
+	fun = 0;
+f0104f7f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+	for (stab = stabs; stab < stab_end; stab++) {
+f0104f86:	e9 ec 00 00 00       	jmp    f0105077 <debuginfo_eip+0x669>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0104f8b:	52                   	push   %edx
+f0104f8c:	8d 87 5c 47 ff ff    	lea    -0xb8a4(%edi),%eax
+f0104f92:	50                   	push   %eax
+f0104f93:	6a 53                	push   $0x53
+f0104f95:	8d 87 2c 51 ff ff    	lea    -0xaed4(%edi),%eax
+f0104f9b:	50                   	push   %eax
+f0104f9c:	89 fb                	mov    %edi,%ebx
+f0104f9e:	e8 55 b1 ff ff       	call   f01000f8 <_panic>
+		switch (stab->n_type) {
+f0104fa3:	3c 24                	cmp    $0x24,%al
+f0104fa5:	0f 84 08 01 00 00    	je     f01050b3 <debuginfo_eip+0x6a5>
+f0104fab:	3c 44                	cmp    $0x44,%al
+f0104fad:	0f 85 c1 00 00 00    	jne    f0105074 <debuginfo_eip+0x666>
+			if (linefile < 0 || nsymline == maxsymline)
+f0104fb3:	85 f6                	test   %esi,%esi
+f0104fb5:	0f 88 97 01 00 00    	js     f0105152 <debuginfo_eip+0x744>
+f0104fbb:	8b 87 0c d6 00 00    	mov    0xd60c(%edi),%eax
+f0104fc1:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0104fc4:	39 d0                	cmp    %edx,%eax
+f0104fc6:	0f 84 86 01 00 00    	je     f0105152 <debuginfo_eip+0x744>
+			symline[nsymline].sl_addr = fun + stab->n_value;
+f0104fcc:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f0104fcf:	8d 14 c2             	lea    (%edx,%eax,8),%edx
+f0104fd2:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f0104fd5:	03 4b 08             	add    0x8(%ebx),%ecx
+f0104fd8:	89 0a                	mov    %ecx,(%edx)
+			symline[nsymline].sl_line = stab->n_desc;
+f0104fda:	0f b7 4b 06          	movzwl 0x6(%ebx),%ecx
+f0104fde:	66 89 4a 04          	mov    %cx,0x4(%edx)
+			symline[nsymline].sl_file = linefile;
+f0104fe2:	66 89 72 06          	mov    %si,0x6(%edx)
+			nsymline++;
+f0104fe6:	83 c0 01             	add    $0x1,%eax
+f0104fe9:	89 87 0c d6 00 00    	mov    %eax,0xd60c(%edi)
+			break;
+f0104fef:	e9 80 00 00 00       	jmp    f0105074 <debuginfo_eip+0x666>
+			if (stabstr[stab->n_strx] == 0) {
+f0104ff4:	8b 03                	mov    (%ebx),%eax
+f0104ff6:	8b 97 34 d6 00 00    	mov    0xd634(%edi),%edx
+f0104ffc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0105000:	75 2f                	jne    f0105031 <debuginfo_eip+0x623>
+				if (symtab_addfun(stab->n_value, 0, SYM_NOFILE) < 0)
+f0105002:	8b 43 08             	mov    0x8(%ebx),%eax
+f0105005:	b9 ff ff 00 00       	mov    $0xffff,%ecx
+f010500a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010500f:	e8 81 f7 ff ff       	call   f0104795 <symtab_addfun>
+f0105014:	85 c0                	test   %eax,%eax
+f0105016:	0f 88 36 01 00 00    	js     f0105152 <debuginfo_eip+0x744>
+				file = linefile = -1;
+f010501c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f0105021:	c7 45 c0 ff ff ff ff 	movl   $0xffffffff,-0x40(%ebp)
+			fun = 0;
+f0105028:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f010502f:	eb 43                	jmp    f0105074 <debuginfo_eip+0x666>
+			if ((file = linefile = symtab_addfile(stab->n_strx)) < 0
+f0105031:	e8 23 f7 ff ff       	call   f0104759 <symtab_addfile>
+f0105036:	89 c6                	mov    %eax,%esi
+f0105038:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f010503b:	85 c0                	test   %eax,%eax
+f010503d:	0f 88 0f 01 00 00    	js     f0105152 <debuginfo_eip+0x744>
+			    || symtab_addfun(stab->n_value, 0, file) < 0)
+f0105043:	8b 43 08             	mov    0x8(%ebx),%eax
+f0105046:	89 f1                	mov    %esi,%ecx
+f0105048:	ba 00 00 00 00       	mov    $0x0,%edx
+f010504d:	e8 43 f7 ff ff       	call   f0104795 <symtab_addfun>
+f0105052:	85 c0                	test   %eax,%eax
+f0105054:	0f 88 f8 00 00 00    	js     f0105152 <debuginfo_eip+0x744>
+			fun = 0;
+f010505a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f0105061:	eb 11                	jmp    f0105074 <debuginfo_eip+0x666>
+			if ((linefile = symtab_addfile(stab->n_strx)) < 0)
+f0105063:	8b 03                	mov    (%ebx),%eax
+f0105065:	e8 ef f6 ff ff       	call   f0104759 <symtab_addfile>
+f010506a:	89 c6                	mov    %eax,%esi
+f010506c:	85 c0                	test   %eax,%eax
+f010506e:	0f 88 de 00 00 00    	js     f0105152 <debuginfo_eip+0x744>
+	for (stab = stabs; stab < stab_end; stab++) {
+f0105074:	83 c3 0c             	add    $0xc,%ebx
+f0105077:	3b 9f 38 d6 00 00    	cmp    0xd638(%edi),%ebx
+f010507d:	73 6a                	jae    f01050e9 <debuginfo_eip+0x6db>
+		switch (stab->n_type) {
+f010507f:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+f0105083:	3c 64                	cmp    $0x64,%al
+f0105085:	0f 84 69 ff ff ff    	je     f0104ff4 <debuginfo_eip+0x5e6>
+f010508b:	0f 86 12 ff ff ff    	jbe    f0104fa3 <debuginfo_eip+0x595>
+f0105091:	3c 84                	cmp    $0x84,%al
+f0105093:	74 ce                	je     f0105063 <debuginfo_eip+0x655>
+f0105095:	3c a0                	cmp    $0xa0,%al
+f0105097:	75 db                	jne    f0105074 <debuginfo_eip+0x666>
+			if (fun)
+f0105099:	83 7d c4 00          	cmpl   $0x0,-0x3c(%ebp)
+f010509d:	74 d5                	je     f0105074 <debuginfo_eip+0x666>
+				symfun[nsymfun - 1].sf_narg++;
+f010509f:	8b 87 10 d6 00 00    	mov    0xd610(%edi),%eax
+f01050a5:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f01050a8:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+f01050ab:	66 83 44 82 fe 01    	addw   $0x1,-0x2(%edx,%eax,4)
+f01050b1:	eb c1                	jmp    f0105074 <debuginfo_eip+0x666>
+			if (stabstr[stab->n_strx] == 0) {
+f01050b3:	8b 13                	mov    (%ebx),%edx
+f01050b5:	8b 87 34 d6 00 00    	mov    0xd634(%edi),%eax
+f01050bb:	80 3c 10 00          	cmpb   $0x0,(%eax,%edx,1)
+f01050bf:	74 1f                	je     f01050e0 <debuginfo_eip+0x6d2>
+			if (file < 0 || symtab_addfun(stab->n_value,
+f01050c1:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f01050c4:	85 c9                	test   %ecx,%ecx
+f01050c6:	0f 88 86 00 00 00    	js     f0105152 <debuginfo_eip+0x744>
+f01050cc:	8b 43 08             	mov    0x8(%ebx),%eax
+f01050cf:	e8 c1 f6 ff ff       	call   f0104795 <symtab_addfun>
+f01050d4:	85 c0                	test   %eax,%eax
+f01050d6:	78 7a                	js     f0105152 <debuginfo_eip+0x744>
+			fun = stab->n_value;
+f01050d8:	8b 43 08             	mov    0x8(%ebx),%eax
+f01050db:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+			break;
+f01050de:	eb 94                	jmp    f0105074 <debuginfo_eip+0x666>
+				fun = 0;
+f01050e0:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f01050e7:	eb 8b                	jmp    f0105074 <debuginfo_eip+0x666>
+	symsort(symfun, nsymfun, sizeof(symfun[0]));
+f01050e9:	b9 0c 00 00 00       	mov    $0xc,%ecx
+f01050ee:	8b 97 10 d6 00 00    	mov    0xd610(%edi),%edx
+f01050f4:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f01050f7:	e8 44 f7 ff ff       	call   f0104840 <symsort>
+	symsort(symline, nsymline, sizeof(symline[0]));
+f01050fc:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0105101:	8b 97 0c d6 00 00    	mov    0xd60c(%edi),%edx
+f0105107:	8b 87 18 d6 00 00    	mov    0xd618(%edi),%eax
+f010510d:	e8 2e f7 ff ff       	call   f0104840 <symsort>
+			symtab_state = 1;
+f0105112:	c7 87 f4 d5 00 00 01 	movl   $0x1,0xd5f4(%edi)
+f0105119:	00 00 00 
+			page_free(stab_pp);
+f010511c:	83 ec 0c             	sub    $0xc,%esp
+f010511f:	ff b7 2c d6 00 00    	push   0xd62c(%edi)
+f0105125:	89 fb                	mov    %edi,%ebx
+f0105127:	e8 b7 d0 ff ff       	call   f01021e3 <page_free>
+			stab_pp = NULL;
+f010512c:	c7 87 2c d6 00 00 00 	movl   $0x0,0xd62c(%edi)
+f0105133:	00 00 00 
+			stabs = stab_end = NULL;
+f0105136:	c7 87 38 d6 00 00 00 	movl   $0x0,0xd638(%edi)
+f010513d:	00 00 00 
+f0105140:	c7 87 3c d6 00 00 00 	movl   $0x0,0xd63c(%edi)
+f0105147:	00 00 00 
+f010514a:	83 c4 10             	add    $0x10,%esp
+f010514d:	e9 4a f9 ff ff       	jmp    f0104a9c <debuginfo_eip+0x8e>
+			symtab_state = -1;
+f0105152:	c7 87 f4 d5 00 00 ff 	movl   $0xffffffff,0xd5f4(%edi)
+f0105159:	ff ff ff 
+			if (symtab_pp)
+f010515c:	8b 87 f8 d5 00 00    	mov    0xd5f8(%edi),%eax
+f0105162:	85 c0                	test   %eax,%eax
+f0105164:	74 0e                	je     f0105174 <debuginfo_eip+0x766>
+				page_free(symtab_pp);
+f0105166:	83 ec 0c             	sub    $0xc,%esp
+f0105169:	50                   	push   %eax
+f010516a:	89 fb                	mov    %edi,%ebx
+f010516c:	e8 72 d0 ff ff       	call   f01021e3 <page_free>
+f0105171:	83 c4 10             	add    $0x10,%esp
+			symtab_pp = NULL;
+f0105174:	c7 87 f8 d5 00 00 00 	movl   $0x0,0xd5f8(%edi)
+f010517b:	00 00 00 
+f010517e:	e9 19 f9 ff ff       	jmp    f0104a9c <debuginfo_eip+0x8e>
+	lfile = 0;
+f0105183:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+	rfile = (stab_end - stabs) - 1;
+f010518a:	8b 9f 3c d6 00 00    	mov    0xd63c(%edi),%ebx
+f0105190:	8b 87 38 d6 00 00    	mov    0xd638(%edi),%eax
+f0105196:	29 d8                	sub    %ebx,%eax
+f0105198:	c1 f8 02             	sar    $0x2,%eax
+f010519b:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f01051a1:	83 e8 01             	sub    $0x1,%eax
+f01051a4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f01051a7:	8d 4d d4             	lea    -0x2c(%ebp),%ecx
+f01051aa:	8d 55 d0             	lea    -0x30(%ebp),%edx
+f01051ad:	83 ec 08             	sub    $0x8,%esp
+f01051b0:	ff 75 08             	push   0x8(%ebp)
+f01051b3:	6a 64                	push   $0x64
+f01051b5:	89 d8                	mov    %ebx,%eax
+f01051b7:	e8 99 f4 ff ff       	call   f0104655 <stab_binsearch>
+	if (lfile == 0)
+f01051bc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f01051bf:	83 c4 10             	add    $0x10,%esp
+f01051c2:	85 f6                	test   %esi,%esi
+f01051c4:	0f 84 4c 01 00 00    	je     f0105316 <debuginfo_eip+0x908>
+	lfun = lfile;
+f01051ca:	89 75 d8             	mov    %esi,-0x28(%ebp)
+	rfun = rfile;
+f01051cd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01051d0:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f01051d3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f01051d6:	8d 4d dc             	lea    -0x24(%ebp),%ecx
+f01051d9:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f01051dc:	83 ec 08             	sub    $0x8,%esp
+f01051df:	ff 75 08             	push   0x8(%ebp)
+f01051e2:	6a 24                	push   $0x24
+f01051e4:	89 d8                	mov    %ebx,%eax
+f01051e6:	e8 6a f4 ff ff       	call   f0104655 <stab_binsearch>
+	if (lfun <= rfun) {
+f01051eb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01051ee:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f01051f1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f01051f4:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+f01051f7:	83 c4 10             	add    $0x10,%esp
+f01051fa:	39 c8                	cmp    %ecx,%eax
+f01051fc:	7f 33                	jg     f0105231 <debuginfo_eip+0x823>
+		if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f01051fe:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0105201:	8d 14 83             	lea    (%ebx,%eax,4),%edx
+f0105204:	8b 0a                	mov    (%edx),%ecx
+f0105206:	8b 9f 34 d6 00 00    	mov    0xd634(%edi),%ebx
+f010520c:	8b 87 30 d6 00 00    	mov    0xd630(%edi),%eax
+f0105212:	29 d8                	sub    %ebx,%eax
+f0105214:	39 c1                	cmp    %eax,%ecx
+f0105216:	73 08                	jae    f0105220 <debuginfo_eip+0x812>
+			info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0105218:	01 cb                	add    %ecx,%ebx
+f010521a:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010521d:	89 58 08             	mov    %ebx,0x8(%eax)
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0105220:	8b 42 08             	mov    0x8(%edx),%eax
+		addr -= info->eip_fn_addr;
+f0105223:	29 45 08             	sub    %eax,0x8(%ebp)
+f0105226:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f0105229:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f010522c:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+f010522f:	eb 05                	jmp    f0105236 <debuginfo_eip+0x828>
+f0105231:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105234:	89 f2                	mov    %esi,%edx
+		info->eip_fn_addr = stabs[lfun].n_value;
+f0105236:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105239:	89 43 10             	mov    %eax,0x10(%ebx)
+		lline = lfun;
+f010523c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		rline = rfun;
+f010523f:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0105242:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0105245:	83 ec 08             	sub    $0x8,%esp
+f0105248:	6a 3a                	push   $0x3a
+f010524a:	ff 73 08             	push   0x8(%ebx)
+f010524d:	89 fb                	mov    %edi,%ebx
+f010524f:	e8 79 2e 00 00       	call   f01080cd <strfind>
+f0105254:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0105257:	2b 43 08             	sub    0x8(%ebx),%eax
+f010525a:	89 43 0c             	mov    %eax,0xc(%ebx)
+	stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f010525d:	8b 9f 3c d6 00 00    	mov    0xd63c(%edi),%ebx
+f0105263:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+f0105266:	8d 55 e0             	lea    -0x20(%ebp),%edx
+f0105269:	83 c4 08             	add    $0x8,%esp
+f010526c:	ff 75 08             	push   0x8(%ebp)
+f010526f:	6a 44                	push   $0x44
+f0105271:	89 d8                	mov    %ebx,%eax
+f0105273:	e8 dd f3 ff ff       	call   f0104655 <stab_binsearch>
+	if (lline > rline)
+f0105278:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010527b:	83 c4 10             	add    $0x10,%esp
+f010527e:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+f0105281:	0f 8f 99 00 00 00    	jg     f0105320 <debuginfo_eip+0x912>
+	info->eip_line = stabs[lline].n_desc;
+f0105287:	89 c2                	mov    %eax,%edx
+f0105289:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f010528c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f010528f:	0f b7 4c 83 06       	movzwl 0x6(%ebx,%eax,4),%ecx
+f0105294:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105297:	89 48 04             	mov    %ecx,0x4(%eax)
+f010529a:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f010529d:	8d 44 83 04          	lea    0x4(%ebx,%eax,4),%eax
+f01052a1:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+	while (lline >= lfile
+f01052a4:	eb 06                	jmp    f01052ac <debuginfo_eip+0x89e>
+f01052a6:	83 ea 01             	sub    $0x1,%edx
+f01052a9:	83 e8 0c             	sub    $0xc,%eax
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f01052ac:	39 d6                	cmp    %edx,%esi
+f01052ae:	7f 1f                	jg     f01052cf <debuginfo_eip+0x8c1>
+	       && stabs[lline].n_type != N_SOL
+f01052b0:	0f b6 08             	movzbl (%eax),%ecx
+f01052b3:	80 f9 84             	cmp    $0x84,%cl
+f01052b6:	0f 84 7a 01 00 00    	je     f0105436 <debuginfo_eip+0xa28>
+	       && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f01052bc:	80 f9 64             	cmp    $0x64,%cl
+f01052bf:	75 e5                	jne    f01052a6 <debuginfo_eip+0x898>
+f01052c1:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f01052c5:	74 df                	je     f01052a6 <debuginfo_eip+0x898>
+f01052c7:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f01052ca:	e9 6a 01 00 00       	jmp    f0105439 <debuginfo_eip+0xa2b>
+f01052cf:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+	return 0;
+f01052d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lfun < rfun)
+f01052d7:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01052da:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f01052dd:	39 f7                	cmp    %esi,%edi
+f01052df:	0f 8d 18 01 00 00    	jge    f01053fd <debuginfo_eip+0x9ef>
+		for (lline = lfun + 1;
+f01052e5:	83 c7 01             	add    $0x1,%edi
+f01052e8:	89 f8                	mov    %edi,%eax
+f01052ea:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+f01052ed:	8d 54 93 04          	lea    0x4(%ebx,%edx,4),%edx
+f01052f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		     lline < rfun && stabs[lline].n_type == N_PSYM;
+f01052f4:	39 c6                	cmp    %eax,%esi
+f01052f6:	7e 32                	jle    f010532a <debuginfo_eip+0x91c>
+f01052f8:	0f b6 0a             	movzbl (%edx),%ecx
+f01052fb:	83 c0 01             	add    $0x1,%eax
+f01052fe:	83 c2 0c             	add    $0xc,%edx
+f0105301:	80 f9 a0             	cmp    $0xa0,%cl
+f0105304:	75 06                	jne    f010530c <debuginfo_eip+0x8fe>
+			info->eip_fn_narg++;
+f0105306:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+f010530a:	eb e8                	jmp    f01052f4 <debuginfo_eip+0x8e6>
+	return 0;
+f010530c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105311:	e9 e7 00 00 00       	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f0105316:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010531b:	e9 dd 00 00 00       	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f0105320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105325:	e9 d3 00 00 00       	jmp    f01053fd <debuginfo_eip+0x9ef>
+	return 0;
+f010532a:	b8 00 00 00 00       	mov    $0x0,%eax
+		return stab_debuginfo(addr, info);
+f010532f:	e9 c9 00 00 00       	jmp    f01053fd <debuginfo_eip+0x9ef>
+			l = m + 1;
+f0105334:	8d 4e 01             	lea    0x1(%esi),%ecx
+f0105337:	e9 7e f7 ff ff       	jmp    f0104aba <debuginfo_eip+0xac>
+	if ((ifun = symsearch(symfun, nsymfun, sizeof(symfun[0]), addr)) < 0)
+f010533c:	83 e9 01             	sub    $0x1,%ecx
+f010533f:	0f 88 d5 00 00 00    	js     f010541a <debuginfo_eip+0xa0c>
+		return -1;
+	sf = &symfun[ifun];
+f0105345:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+f0105348:	8d 1c 83             	lea    (%ebx,%eax,4),%ebx
+f010534b:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+	if (sf->sf_file == SYM_NOFILE)
+f010534e:	66 83 7b 08 ff       	cmpw   $0xffff,0x8(%ebx)
+f0105353:	0f 84 c8 00 00 00    	je     f0105421 <debuginfo_eip+0xa13>
+		return -1;
+	if (sf->sf_name) {
+f0105359:	8b 43 04             	mov    0x4(%ebx),%eax
+f010535c:	85 c0                	test   %eax,%eax
+f010535e:	74 18                	je     f0105378 <debuginfo_eip+0x96a>
+		info->eip_fn_name = stabstr + sf->sf_name;
+f0105360:	03 87 34 d6 00 00    	add    0xd634(%edi),%eax
+f0105366:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105369:	89 42 08             	mov    %eax,0x8(%edx)
+		info->eip_fn_addr = sf->sf_addr;
+f010536c:	8b 03                	mov    (%ebx),%eax
+f010536e:	89 42 10             	mov    %eax,0x10(%edx)
+		info->eip_fn_narg = sf->sf_narg;
+f0105371:	0f b7 43 0a          	movzwl 0xa(%ebx),%eax
+f0105375:	89 42 14             	mov    %eax,0x14(%edx)
+	}
+	// Ignore stuff after the colon.
+	info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0105378:	83 ec 08             	sub    $0x8,%esp
+f010537b:	6a 3a                	push   $0x3a
+f010537d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105380:	ff 70 08             	push   0x8(%eax)
+f0105383:	89 fb                	mov    %edi,%ebx
+f0105385:	e8 43 2d 00 00       	call   f01080cd <strfind>
+f010538a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f010538d:	2b 43 08             	sub    0x8(%ebx),%eax
+f0105390:	89 43 0c             	mov    %eax,0xc(%ebx)
+
+	// Find the line, which must be in that function or stretch of code
+	iline = symsearch(symline, nsymline, sizeof(symline[0]), addr);
+f0105393:	8b 97 0c d6 00 00    	mov    0xd60c(%edi),%edx
+f0105399:	8b b7 18 d6 00 00    	mov    0xd618(%edi),%esi
+	while (l < r) {
+f010539f:	83 c4 10             	add    $0x10,%esp
+	int l = 0, r = n;
+f01053a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+	while (l < r) {
+f01053a7:	39 da                	cmp    %ebx,%edx
+f01053a9:	7e 1d                	jle    f01053c8 <debuginfo_eip+0x9ba>
+		int m = (l + r) / 2;
+f01053ab:	8d 0c 1a             	lea    (%edx,%ebx,1),%ecx
+f01053ae:	89 c8                	mov    %ecx,%eax
+f01053b0:	c1 e8 1f             	shr    $0x1f,%eax
+f01053b3:	01 c8                	add    %ecx,%eax
+f01053b5:	d1 f8                	sar    %eax
+		if (*(const uintptr_t *) (a + m * size) <= addr)
+f01053b7:	8b 0c c6             	mov    (%esi,%eax,8),%ecx
+f01053ba:	39 4d 08             	cmp    %ecx,0x8(%ebp)
+f01053bd:	73 04                	jae    f01053c3 <debuginfo_eip+0x9b5>
+		int m = (l + r) / 2;
+f01053bf:	89 c2                	mov    %eax,%edx
+f01053c1:	eb e4                	jmp    f01053a7 <debuginfo_eip+0x999>
+			l = m + 1;
+f01053c3:	8d 58 01             	lea    0x1(%eax),%ebx
+f01053c6:	eb df                	jmp    f01053a7 <debuginfo_eip+0x999>
+	if (iline < 0 || symline[iline].sl_addr < sf->sf_addr)
+f01053c8:	83 eb 01             	sub    $0x1,%ebx
+f01053cb:	78 5b                	js     f0105428 <debuginfo_eip+0xa1a>
+f01053cd:	8d 04 de             	lea    (%esi,%ebx,8),%eax
+f01053d0:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f01053d3:	8b 1b                	mov    (%ebx),%ebx
+f01053d5:	39 18                	cmp    %ebx,(%eax)
+f01053d7:	72 56                	jb     f010542f <debuginfo_eip+0xa21>
+		return -1;
+	info->eip_line = symline[iline].sl_line;
+f01053d9:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+f01053dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f01053e0:	89 53 04             	mov    %edx,0x4(%ebx)
+	info->eip_file = stabstr + symfile[symline[iline].sl_file];
+f01053e3:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+f01053e7:	8b 87 14 d6 00 00    	mov    0xd614(%edi),%eax
+f01053ed:	8b 04 90             	mov    (%eax,%edx,4),%eax
+f01053f0:	03 87 34 d6 00 00    	add    0xd634(%edi),%eax
+f01053f6:	89 03                	mov    %eax,(%ebx)
+	return 0;
+f01053f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01053fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105400:	5b                   	pop    %ebx
+f0105401:	5e                   	pop    %esi
+f0105402:	5f                   	pop    %edi
+f0105403:	5d                   	pop    %ebp
+f0105404:	c3                   	ret
+			return -1;
+f0105405:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010540a:	eb f1                	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f010540c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105411:	eb ea                	jmp    f01053fd <debuginfo_eip+0x9ef>
+f0105413:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105418:	eb e3                	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f010541a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010541f:	eb dc                	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f0105421:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105426:	eb d5                	jmp    f01053fd <debuginfo_eip+0x9ef>
+		return -1;
+f0105428:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010542d:	eb ce                	jmp    f01053fd <debuginfo_eip+0x9ef>
+f010542f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0105434:	eb c7                	jmp    f01053fd <debuginfo_eip+0x9ef>
+f0105436:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+	if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0105439:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f010543c:	8b 14 83             	mov    (%ebx,%eax,4),%edx
+f010543f:	8b 8f 34 d6 00 00    	mov    0xd634(%edi),%ecx
+f0105445:	8b 87 30 d6 00 00    	mov    0xd630(%edi),%eax
+f010544b:	29 c8                	sub    %ecx,%eax
+f010544d:	39 c2                	cmp    %eax,%edx
+f010544f:	0f 83 7d fe ff ff    	jae    f01052d2 <debuginfo_eip+0x8c4>
+		info->eip_file = stabstr + stabs[lline].n_strx;
+f0105455:	01 ca                	add    %ecx,%edx
+f0105457:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010545a:	89 10                	mov    %edx,(%eax)
+f010545c:	e9 71 fe ff ff       	jmp    f01052d2 <debuginfo_eip+0x8c4>
+
+f0105461 <debuginfo_footprint>:
+//	from the kernel's ELF file and how much memory it keeps for them.
+//	Both are 0 until the first call that needed them.
+//
+void
+debuginfo_footprint(size_t *ondisk, size_t *resident)
+{
+f0105461:	55                   	push   %ebp
+f0105462:	89 e5                	mov    %esp,%ebp
+f0105464:	53                   	push   %ebx
+f0105465:	e8 e5 ae ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010546a:	81 c3 22 00 01 00    	add    $0x10022,%ebx
+	*ondisk = stab_disksize;
+f0105470:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105473:	8b 93 24 d6 00 00    	mov    0xd624(%ebx),%edx
+f0105479:	89 10                	mov    %edx,(%eax)
+	*resident = block_size(stab_pp) + block_size(stabstr_pp)
+f010547b:	8b 83 2c d6 00 00    	mov    0xd62c(%ebx),%eax
+	return pp ? PGSIZE << pp->pp_order : 0;
+f0105481:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105486:	85 c0                	test   %eax,%eax
+f0105488:	74 0b                	je     f0105495 <debuginfo_footprint+0x34>
+f010548a:	0f b6 48 0a          	movzbl 0xa(%eax),%ecx
+f010548e:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0105493:	d3 e2                	shl    %cl,%edx
+	*resident = block_size(stab_pp) + block_size(stabstr_pp)
+f0105495:	8b 8b 28 d6 00 00    	mov    0xd628(%ebx),%ecx
+	return pp ? PGSIZE << pp->pp_order : 0;
+f010549b:	b8 00 00 00 00       	mov    $0x0,%eax
+f01054a0:	85 c9                	test   %ecx,%ecx
+f01054a2:	74 0b                	je     f01054af <debuginfo_footprint+0x4e>
+f01054a4:	0f b6 49 0a          	movzbl 0xa(%ecx),%ecx
+f01054a8:	b8 00 10 00 00       	mov    $0x1000,%eax
+f01054ad:	d3 e0                	shl    %cl,%eax
+	*resident = block_size(stab_pp) + block_size(stabstr_pp)
+f01054af:	01 c2                	add    %eax,%edx
+		+ block_size(symtab_pp);
+f01054b1:	8b 8b f8 d5 00 00    	mov    0xd5f8(%ebx),%ecx
+	return pp ? PGSIZE << pp->pp_order : 0;
+f01054b7:	b8 00 00 00 00       	mov    $0x0,%eax
+f01054bc:	85 c9                	test   %ecx,%ecx
+f01054be:	74 0b                	je     f01054cb <debuginfo_footprint+0x6a>
+f01054c0:	0f b6 49 0a          	movzbl 0xa(%ecx),%ecx
+f01054c4:	b8 00 10 00 00       	mov    $0x1000,%eax
+f01054c9:	d3 e0                	shl    %cl,%eax
+		+ block_size(symtab_pp);
+f01054cb:	01 d0                	add    %edx,%eax
+f01054cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01054d0:	89 02                	mov    %eax,(%edx)
+}
+f01054d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01054d5:	c9                   	leave
+f01054d6:	c3                   	ret
+
+f01054d7 <trace_event>:
+};
+
+void
+trace_event(uint32_t event, uint32_t a0, uint32_t a1, uint32_t a2,
+	    uint32_t a3)
+{
+f01054d7:	55                   	push   %ebp
+f01054d8:	89 e5                	mov    %esp,%ebp
+f01054da:	56                   	push   %esi
+f01054db:	53                   	push   %ebx
+f01054dc:	e8 6e ae ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01054e1:	81 c3 ab ff 00 00    	add    $0xffab,%ebx
+	struct Tracerec *tr;
+	uint32_t idx = 1;
+
+	// claim a slot; no lock prefix, as no other CPU writes here
+	asm volatile("xaddl %0, %1"
+		     : "+r" (idx), "+m" (rings[cpunum()].head)
+f01054e7:	e8 d3 33 00 00       	call   f01088bf <cpunum>
+f01054ec:	69 c0 04 40 00 00    	imul   $0x4004,%eax,%eax
+	asm volatile("xaddl %0, %1"
+f01054f2:	be 01 00 00 00       	mov    $0x1,%esi
+f01054f7:	0f c1 b4 03 54 d6 00 	xadd   %esi,0xd654(%ebx,%eax,1)
+f01054fe:	00 
+		     : : "cc");
+	tr = &rings[cpunum()].rec[idx % TRACE_NREC];
+f01054ff:	e8 bb 33 00 00       	call   f01088bf <cpunum>
+f0105504:	89 c1                	mov    %eax,%ecx
+f0105506:	81 e6 ff 01 00 00    	and    $0x1ff,%esi
+	asm volatile("rdtsc" : "=A" (tsc));
+f010550c:	0f 31                	rdtsc
+	tr->tr_tsc = read_tsc();
+f010550e:	c1 e6 05             	shl    $0x5,%esi
+f0105511:	69 c9 04 40 00 00    	imul   $0x4004,%ecx,%ecx
+f0105517:	01 ce                	add    %ecx,%esi
+f0105519:	89 84 33 58 d6 00 00 	mov    %eax,0xd658(%ebx,%esi,1)
+f0105520:	89 94 33 5c d6 00 00 	mov    %edx,0xd65c(%ebx,%esi,1)
+	tr->tr_event = event;
+f0105527:	8d 84 33 54 d6 00 00 	lea    0xd654(%ebx,%esi,1),%eax
+f010552e:	8b 55 08             	mov    0x8(%ebp),%edx
+f0105531:	89 50 0c             	mov    %edx,0xc(%eax)
+	tr->tr_eip = (uintptr_t) __builtin_return_address(0);
+f0105534:	8b 55 04             	mov    0x4(%ebp),%edx
+f0105537:	89 50 10             	mov    %edx,0x10(%eax)
+	tr->tr_arg[0] = a0;
+f010553a:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010553d:	89 50 14             	mov    %edx,0x14(%eax)
+	tr->tr_arg[1] = a1;
+f0105540:	8b 55 10             	mov    0x10(%ebp),%edx
+f0105543:	89 50 18             	mov    %edx,0x18(%eax)
+	tr->tr_arg[2] = a2;
+f0105546:	8b 55 14             	mov    0x14(%ebp),%edx
+f0105549:	89 50 1c             	mov    %edx,0x1c(%eax)
+	tr->tr_arg[3] = a3;
+f010554c:	8b 55 18             	mov    0x18(%ebp),%edx
+f010554f:	89 50 20             	mov    %edx,0x20(%eax)
+}
+f0105552:	5b                   	pop    %ebx
+f0105553:	5e                   	pop    %esi
+f0105554:	5d                   	pop    %ebp
+f0105555:	c3                   	ret
+
+f0105556 <trace_nrec>:
+
+// Return the number of records the ring of 'cpu' holds.
+int
+trace_nrec(int cpu)
+{
+f0105556:	55                   	push   %ebp
+f0105557:	89 e5                	mov    %esp,%ebp
+f0105559:	e8 84 ba ff ff       	call   f0100fe2 <__x86.get_pc_thunk.dx>
+f010555e:	81 c2 2e ff 00 00    	add    $0xff2e,%edx
+	return MIN(rings[cpu].head, TRACE_NREC);
+f0105564:	69 45 08 04 40 00 00 	imul   $0x4004,0x8(%ebp),%eax
+f010556b:	8b 84 02 54 d6 00 00 	mov    0xd654(%edx,%eax,1),%eax
+f0105572:	ba 00 02 00 00       	mov    $0x200,%edx
+f0105577:	39 d0                	cmp    %edx,%eax
+f0105579:	0f 47 c2             	cmova  %edx,%eax
+}
+f010557c:	5d                   	pop    %ebp
+f010557d:	c3                   	ret
+
+f010557e <trace_clear>:
+
+void
+trace_clear(void)
+{
+f010557e:	e8 5b ba ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0105583:	05 09 ff 00 00       	add    $0xff09,%eax
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		rings[i].head = 0;
+f0105588:	c7 80 54 d6 00 00 00 	movl   $0x0,0xd654(%eax)
+f010558f:	00 00 00 
+f0105592:	c7 80 58 16 01 00 00 	movl   $0x0,0x11658(%eax)
+f0105599:	00 00 00 
+f010559c:	c7 80 5c 56 01 00 00 	movl   $0x0,0x1565c(%eax)
+f01055a3:	00 00 00 
+f01055a6:	c7 80 60 96 01 00 00 	movl   $0x0,0x19660(%eax)
+f01055ad:	00 00 00 
+f01055b0:	c7 80 64 d6 01 00 00 	movl   $0x0,0x1d664(%eax)
+f01055b7:	00 00 00 
+f01055ba:	c7 80 68 16 02 00 00 	movl   $0x0,0x21668(%eax)
+f01055c1:	00 00 00 
+f01055c4:	c7 80 6c 56 02 00 00 	movl   $0x0,0x2566c(%eax)
+f01055cb:	00 00 00 
+f01055ce:	c7 80 70 96 02 00 00 	movl   $0x0,0x29670(%eax)
+f01055d5:	00 00 00 
+}
+f01055d8:	c3                   	ret
+
+f01055d9 <trace_dump>:
+
+// Print the last 'n' records of each CPU (all of them if n <= 0),
+// oldest first, with times in cycles since the first one printed.
+void
+trace_dump(int n)
+{
+f01055d9:	55                   	push   %ebp
+f01055da:	89 e5                	mov    %esp,%ebp
+f01055dc:	57                   	push   %edi
+f01055dd:	56                   	push   %esi
+f01055de:	53                   	push   %ebx
+f01055df:	83 ec 5c             	sub    $0x5c,%esp
+f01055e2:	e8 68 ad ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01055e7:	81 c3 a5 fe 00 00    	add    $0xfea5,%ebx
+	const char *name;
+	bool on;
+	int cpu;
+
+	// don't trace the interrupts taken while printing
+	on = trace_on;
+f01055ed:	0f b6 83 bc ff ff ff 	movzbl -0x44(%ebx),%eax
+f01055f4:	88 45 a7             	mov    %al,-0x59(%ebp)
+	trace_on = 0;
+f01055f7:	c6 83 bc ff ff ff 00 	movb   $0x0,-0x44(%ebx)
+f01055fe:	8d 83 54 d6 00 00    	lea    0xd654(%ebx),%eax
+f0105604:	89 45 ac             	mov    %eax,-0x54(%ebp)
+
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f0105607:	be 00 00 00 00       	mov    $0x0,%esi
+			i = head - trace_nrec(cpu);
+		else
+			i = head - n;
+		cprintf("CPU %d: %u records, showing %u\n", cpu, head,
+			head - i);
+		t0 = rings[cpu].rec[i % TRACE_NREC].tr_tsc;
+f010560c:	8d 05 54 d6 00 00    	lea    0xd654,%eax
+f0105612:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0105615:	01 d8                	add    %ebx,%eax
+f0105617:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f010561a:	e9 0e 01 00 00       	jmp    f010572d <trace_dump+0x154>
+			name = tr->tr_event < NTRACEEVENT
+				? eventnames[tr->tr_event] : NULL;
+			if (name)
+				cprintf_cached("  +%10llu %-5s", tr->tr_tsc - t0, name);
+			else
+				cprintf_cached("  +%10llu %5u", tr->tr_tsc - t0,
+f010561f:	50                   	push   %eax
+f0105620:	89 f0                	mov    %esi,%eax
+f0105622:	c1 e0 05             	shl    $0x5,%eax
+f0105625:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+f0105628:	01 d0                	add    %edx,%eax
+f010562a:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+f010562d:	8b 54 08 08          	mov    0x8(%eax,%ecx,1),%edx
+f0105631:	8b 44 08 04          	mov    0x4(%eax,%ecx,1),%eax
+f0105635:	2b 45 b0             	sub    -0x50(%ebp),%eax
+f0105638:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+f010563b:	52                   	push   %edx
+f010563c:	50                   	push   %eax
+f010563d:	8d 83 14 08 00 00    	lea    0x814(%ebx),%eax
+f0105643:	50                   	push   %eax
+f0105644:	e8 c2 ea ff ff       	call   f010410b <cprintfc>
+f0105649:	83 c4 10             	add    $0x10,%esp
+					tr->tr_event);
+			cprintf_cached(" %08x %08x %08x %08x", tr->tr_arg[0],
+f010564c:	83 ec 0c             	sub    $0xc,%esp
+f010564f:	c1 e6 05             	shl    $0x5,%esi
+f0105652:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f0105655:	01 c6                	add    %eax,%esi
+f0105657:	01 de                	add    %ebx,%esi
+f0105659:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f010565c:	01 c6                	add    %eax,%esi
+f010565e:	ff 76 20             	push   0x20(%esi)
+f0105661:	ff 76 1c             	push   0x1c(%esi)
+f0105664:	ff 76 18             	push   0x18(%esi)
+f0105667:	ff 76 14             	push   0x14(%esi)
+f010566a:	8d 83 b4 06 00 00    	lea    0x6b4(%ebx),%eax
+f0105670:	50                   	push   %eax
+f0105671:	e8 95 ea ff ff       	call   f010410b <cprintfc>
+				tr->tr_arg[1], tr->tr_arg[2], tr->tr_arg[3]);
+			debuginfo_eip(tr->tr_eip, &info);
+f0105676:	83 c4 18             	add    $0x18,%esp
+f0105679:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010567c:	50                   	push   %eax
+f010567d:	ff 76 10             	push   0x10(%esi)
+f0105680:	e8 89 f3 ff ff       	call   f0104a0e <debuginfo_eip>
+			cprintf_cached("  %s:%d: %.*s+%d\n", info.eip_file,
+f0105685:	83 c4 08             	add    $0x8,%esp
+f0105688:	8b 46 10             	mov    0x10(%esi),%eax
+f010568b:	2b 45 e0             	sub    -0x20(%ebp),%eax
+f010568e:	50                   	push   %eax
+f010568f:	ff 75 d8             	push   -0x28(%ebp)
+f0105692:	ff 75 dc             	push   -0x24(%ebp)
+f0105695:	ff 75 d4             	push   -0x2c(%ebp)
+f0105698:	ff 75 d0             	push   -0x30(%ebp)
+f010569b:	8d 83 54 05 00 00    	lea    0x554(%ebx),%eax
+f01056a1:	50                   	push   %eax
+f01056a2:	e8 64 ea ff ff       	call   f010410b <cprintfc>
+		for (; i != head; i++) {
+f01056a7:	83 c7 01             	add    $0x1,%edi
+f01056aa:	83 c4 20             	add    $0x20,%esp
+f01056ad:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01056b0:	39 c7                	cmp    %eax,%edi
+f01056b2:	74 63                	je     f0105717 <trace_dump+0x13e>
+			tr = &rings[cpu].rec[i % TRACE_NREC];
+f01056b4:	89 fe                	mov    %edi,%esi
+f01056b6:	81 e6 ff 01 00 00    	and    $0x1ff,%esi
+			name = tr->tr_event < NTRACEEVENT
+f01056bc:	89 f0                	mov    %esi,%eax
+f01056be:	c1 e0 05             	shl    $0x5,%eax
+f01056c1:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+f01056c4:	01 c8                	add    %ecx,%eax
+f01056c6:	01 d8                	add    %ebx,%eax
+f01056c8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f01056cb:	8b 44 02 0c          	mov    0xc(%edx,%eax,1),%eax
+				? eventnames[tr->tr_event] : NULL;
+f01056cf:	83 f8 02             	cmp    $0x2,%eax
+f01056d2:	0f 87 47 ff ff ff    	ja     f010561f <trace_dump+0x46>
+f01056d8:	8b 94 83 24 01 00 00 	mov    0x124(%ebx,%eax,4),%edx
+			if (name)
+f01056df:	85 d2                	test   %edx,%edx
+f01056e1:	0f 84 38 ff ff ff    	je     f010561f <trace_dump+0x46>
+				cprintf_cached("  +%10llu %-5s", tr->tr_tsc - t0, name);
+f01056e7:	52                   	push   %edx
+f01056e8:	89 f0                	mov    %esi,%eax
+f01056ea:	c1 e0 05             	shl    $0x5,%eax
+f01056ed:	01 c8                	add    %ecx,%eax
+f01056ef:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f01056f2:	8d 54 10 04          	lea    0x4(%eax,%edx,1),%edx
+f01056f6:	8b 02                	mov    (%edx),%eax
+f01056f8:	8b 52 04             	mov    0x4(%edx),%edx
+f01056fb:	2b 45 b0             	sub    -0x50(%ebp),%eax
+f01056fe:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+f0105701:	52                   	push   %edx
+f0105702:	50                   	push   %eax
+f0105703:	8d 83 74 09 00 00    	lea    0x974(%ebx),%eax
+f0105709:	50                   	push   %eax
+f010570a:	e8 fc e9 ff ff       	call   f010410b <cprintfc>
+f010570f:	83 c4 10             	add    $0x10,%esp
+f0105712:	e9 35 ff ff ff       	jmp    f010564c <trace_dump+0x73>
+f0105717:	8b 75 a8             	mov    -0x58(%ebp),%esi
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f010571a:	83 c6 01             	add    $0x1,%esi
+f010571d:	81 45 ac 04 40 00 00 	addl   $0x4004,-0x54(%ebp)
+f0105724:	83 fe 08             	cmp    $0x8,%esi
+f0105727:	0f 84 83 00 00 00    	je     f01057b0 <trace_dump+0x1d7>
+		head = rings[cpu].head;
+f010572d:	8b 45 ac             	mov    -0x54(%ebp),%eax
+f0105730:	8b 38                	mov    (%eax),%edi
+f0105732:	89 7d bc             	mov    %edi,-0x44(%ebp)
+		if (head == 0)
+f0105735:	85 ff                	test   %edi,%edi
+f0105737:	74 e1                	je     f010571a <trace_dump+0x141>
+		if (n <= 0 || n > trace_nrec(cpu))
+f0105739:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f010573d:	7e 12                	jle    f0105751 <trace_dump+0x178>
+	return MIN(rings[cpu].head, TRACE_NREC);
+f010573f:	b8 00 02 00 00       	mov    $0x200,%eax
+f0105744:	39 c7                	cmp    %eax,%edi
+f0105746:	0f 46 c7             	cmovbe %edi,%eax
+			i = head - n;
+f0105749:	2b 7d 08             	sub    0x8(%ebp),%edi
+		if (n <= 0 || n > trace_nrec(cpu))
+f010574c:	39 45 08             	cmp    %eax,0x8(%ebp)
+f010574f:	7e 11                	jle    f0105762 <trace_dump+0x189>
+	return MIN(rings[cpu].head, TRACE_NREC);
+f0105751:	b8 00 02 00 00       	mov    $0x200,%eax
+f0105756:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+f0105759:	39 c1                	cmp    %eax,%ecx
+f010575b:	0f 46 c1             	cmovbe %ecx,%eax
+			i = head - trace_nrec(cpu);
+f010575e:	29 c1                	sub    %eax,%ecx
+f0105760:	89 cf                	mov    %ecx,%edi
+		cprintf("CPU %d: %u records, showing %u\n", cpu, head,
+f0105762:	8b 55 bc             	mov    -0x44(%ebp),%edx
+f0105765:	89 d0                	mov    %edx,%eax
+f0105767:	29 f8                	sub    %edi,%eax
+f0105769:	50                   	push   %eax
+f010576a:	52                   	push   %edx
+f010576b:	56                   	push   %esi
+f010576c:	8d 83 c0 5c ff ff    	lea    -0xa340(%ebx),%eax
+f0105772:	50                   	push   %eax
+f0105773:	e8 1a e9 ff ff       	call   f0104092 <cprintf>
+		t0 = rings[cpu].rec[i % TRACE_NREC].tr_tsc;
+f0105778:	89 f8                	mov    %edi,%eax
+f010577a:	25 ff 01 00 00       	and    $0x1ff,%eax
+f010577f:	c1 e0 05             	shl    $0x5,%eax
+f0105782:	69 d6 04 40 00 00    	imul   $0x4004,%esi,%edx
+f0105788:	01 d0                	add    %edx,%eax
+f010578a:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f010578d:	8d 54 10 04          	lea    0x4(%eax,%edx,1),%edx
+f0105791:	8b 02                	mov    (%edx),%eax
+f0105793:	8b 52 04             	mov    0x4(%edx),%edx
+f0105796:	89 45 b0             	mov    %eax,-0x50(%ebp)
+f0105799:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+		for (; i != head; i++) {
+f010579c:	83 c4 10             	add    $0x10,%esp
+			name = tr->tr_event < NTRACEEVENT
+f010579f:	69 c6 04 40 00 00    	imul   $0x4004,%esi,%eax
+f01057a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f01057a8:	89 75 a8             	mov    %esi,-0x58(%ebp)
+		for (; i != head; i++) {
+f01057ab:	e9 fd fe ff ff       	jmp    f01056ad <trace_dump+0xd4>
+				info.eip_line, info.eip_fn_namelen,
+				info.eip_fn_name, tr->tr_eip - info.eip_fn_addr);
+		}
+	}
+
+	trace_on = on;
+f01057b0:	0f b6 45 a7          	movzbl -0x59(%ebp),%eax
+f01057b4:	88 83 bc ff ff ff    	mov    %al,-0x44(%ebx)
+}
+f01057ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01057bd:	5b                   	pop    %ebx
+f01057be:	5e                   	pop    %esi
+f01057bf:	5f                   	pop    %edi
+f01057c0:	5d                   	pop    %ebp
+f01057c1:	c3                   	ret
+
+f01057c2 <hist_add>:
+
+// Count 'pc' in the open-addressed histogram 'h'.
+// Returns 0 if there's no room for it.
+static int
+hist_add(struct Profbucket *h, uintptr_t pc)
+{
+f01057c2:	55                   	push   %ebp
+f01057c3:	89 e5                	mov    %esp,%ebp
+f01057c5:	57                   	push   %edi
+f01057c6:	56                   	push   %esi
+f01057c7:	53                   	push   %ebx
+f01057c8:	89 c6                	mov    %eax,%esi
+f01057ca:	89 d3                	mov    %edx,%ebx
+	uint32_t i, n;
+
+	i = pc * 2654435761U;
+f01057cc:	69 c2 b1 79 37 9e    	imul   $0x9e3779b1,%edx,%eax
+f01057d2:	8d 78 10             	lea    0x10(%eax),%edi
+	for (n = 0; n < PROF_NPROBE; n++, i++) {
+f01057d5:	eb 07                	jmp    f01057de <hist_add+0x1c>
+		struct Profbucket *b = &h[i % PROF_NBUCKET];
+		if (b->pb_count == 0)
+			b->pb_pc = pc;
+		if (b->pb_pc == pc) {
+f01057d7:	39 1a                	cmp    %ebx,(%edx)
+f01057d9:	74 1b                	je     f01057f6 <hist_add+0x34>
+	for (n = 0; n < PROF_NPROBE; n++, i++) {
+f01057db:	83 c0 01             	add    $0x1,%eax
+f01057de:	39 f8                	cmp    %edi,%eax
+f01057e0:	74 21                	je     f0105803 <hist_add+0x41>
+		struct Profbucket *b = &h[i % PROF_NBUCKET];
+f01057e2:	89 c2                	mov    %eax,%edx
+f01057e4:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+f01057ea:	8d 14 d6             	lea    (%esi,%edx,8),%edx
+		if (b->pb_count == 0)
+f01057ed:	8b 4a 04             	mov    0x4(%edx),%ecx
+f01057f0:	85 c9                	test   %ecx,%ecx
+f01057f2:	75 e3                	jne    f01057d7 <hist_add+0x15>
+			b->pb_pc = pc;
+f01057f4:	89 1a                	mov    %ebx,(%edx)
+			b->pb_count++;
+f01057f6:	83 c1 01             	add    $0x1,%ecx
+f01057f9:	89 4a 04             	mov    %ecx,0x4(%edx)
+			return 1;
+f01057fc:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105801:	eb 05                	jmp    f0105808 <hist_add+0x46>
+		}
+	}
+	return 0;
+f0105803:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105808:	5b                   	pop    %ebx
+f0105809:	5e                   	pop    %esi
+f010580a:	5f                   	pop    %edi
+f010580b:	5d                   	pop    %ebp
+f010580c:	c3                   	ret
+
+f010580d <fn_add>:
+};
+
+// Find or make the entry in 'fns' for the function containing 'pc'.
+static struct Proffn *
+fn_add(struct Proffn *fns, int *nfns, uintptr_t pc)
+{
+f010580d:	55                   	push   %ebp
+f010580e:	89 e5                	mov    %esp,%ebp
+f0105810:	57                   	push   %edi
+f0105811:	56                   	push   %esi
+f0105812:	53                   	push   %ebx
+f0105813:	83 ec 44             	sub    $0x44,%esp
+f0105816:	e8 34 ab ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010581b:	81 c3 71 fc 00 00    	add    $0xfc71,%ebx
+f0105821:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0105824:	89 d6                	mov    %edx,%esi
+	struct Eipdebuginfo info;
+	int i;
+
+	debuginfo_eip(pc, &info);
+f0105826:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f0105829:	50                   	push   %eax
+f010582a:	51                   	push   %ecx
+f010582b:	e8 de f1 ff ff       	call   f0104a0e <debuginfo_eip>
+	if (strncmp(info.eip_fn_name, "<unknown>", 9) == 0
+f0105830:	83 c4 0c             	add    $0xc,%esp
+f0105833:	6a 09                	push   $0x9
+f0105835:	8d 83 8c 5c ff ff    	lea    -0xa374(%ebx),%eax
+f010583b:	50                   	push   %eax
+f010583c:	ff 75 d8             	push   -0x28(%ebp)
+f010583f:	e8 d7 27 00 00       	call   f010801b <strncmp>
+f0105844:	83 c4 10             	add    $0x10,%esp
+f0105847:	85 c0                	test   %eax,%eax
+f0105849:	74 0f                	je     f010585a <fn_add+0x4d>
+	    && strcmp(info.eip_file, "<unknown>") != 0) {
+		// not in a function; count it by source file
+		info.eip_fn_name = info.eip_file;
+		info.eip_fn_namelen = strlen(info.eip_file);
+	}
+	for (i = 0; i < *nfns; i++)
+f010584b:	8b 1e                	mov    (%esi),%ebx
+		if (fns[i].pf_name == info.eip_fn_name)
+f010584d:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0105850:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+	for (i = 0; i < *nfns; i++)
+f0105853:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105858:	eb 35                	jmp    f010588f <fn_add+0x82>
+	    && strcmp(info.eip_file, "<unknown>") != 0) {
+f010585a:	83 ec 08             	sub    $0x8,%esp
+f010585d:	8d 83 8c 5c ff ff    	lea    -0xa374(%ebx),%eax
+f0105863:	50                   	push   %eax
+f0105864:	ff 75 d0             	push   -0x30(%ebp)
+f0105867:	e8 89 27 00 00       	call   f0107ff5 <strcmp>
+f010586c:	83 c4 10             	add    $0x10,%esp
+f010586f:	85 c0                	test   %eax,%eax
+f0105871:	74 d8                	je     f010584b <fn_add+0x3e>
+		info.eip_fn_name = info.eip_file;
+f0105873:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105876:	89 45 d8             	mov    %eax,-0x28(%ebp)
+		info.eip_fn_namelen = strlen(info.eip_file);
+f0105879:	83 ec 0c             	sub    $0xc,%esp
+f010587c:	50                   	push   %eax
+f010587d:	e8 5a 26 00 00       	call   f0107edc <strlen>
+f0105882:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0105885:	83 c4 10             	add    $0x10,%esp
+f0105888:	eb c1                	jmp    f010584b <fn_add+0x3e>
+	for (i = 0; i < *nfns; i++)
+f010588a:	83 c2 01             	add    $0x1,%edx
+f010588d:	89 c8                	mov    %ecx,%eax
+f010588f:	39 d3                	cmp    %edx,%ebx
+f0105891:	7e 0f                	jle    f01058a2 <fn_add+0x95>
+		if (fns[i].pf_name == info.eip_fn_name)
+f0105893:	8d 48 10             	lea    0x10(%eax),%ecx
+f0105896:	39 38                	cmp    %edi,(%eax)
+f0105898:	75 f0                	jne    f010588a <fn_add+0x7d>
+	fns[i].pf_name = info.eip_fn_name;
+	fns[i].pf_namelen = info.eip_fn_namelen;
+	fns[i].pf_self = fns[i].pf_total = 0;
+	(*nfns)++;
+	return &fns[i];
+}
+f010589a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010589d:	5b                   	pop    %ebx
+f010589e:	5e                   	pop    %esi
+f010589f:	5f                   	pop    %edi
+f01058a0:	5d                   	pop    %ebp
+f01058a1:	c3                   	ret
+	if (*nfns == PROF_NFN)
+f01058a2:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+f01058a8:	74 23                	je     f01058cd <fn_add+0xc0>
+	fns[i].pf_name = info.eip_fn_name;
+f01058aa:	c1 e2 04             	shl    $0x4,%edx
+f01058ad:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01058b0:	01 d0                	add    %edx,%eax
+f01058b2:	89 38                	mov    %edi,(%eax)
+	fns[i].pf_namelen = info.eip_fn_namelen;
+f01058b4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01058b7:	89 50 04             	mov    %edx,0x4(%eax)
+	fns[i].pf_self = fns[i].pf_total = 0;
+f01058ba:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+f01058c1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+	(*nfns)++;
+f01058c8:	83 06 01             	addl   $0x1,(%esi)
+	return &fns[i];
+f01058cb:	eb cd                	jmp    f010589a <fn_add+0x8d>
+		return NULL;
+f01058cd:	b8 00 00 00 00       	mov    $0x0,%eax
+f01058d2:	eb c6                	jmp    f010589a <fn_add+0x8d>
+
+f01058d4 <prof_tick>:
+{
+f01058d4:	55                   	push   %ebp
+f01058d5:	89 e5                	mov    %esp,%ebp
+f01058d7:	57                   	push   %edi
+f01058d8:	56                   	push   %esi
+f01058d9:	53                   	push   %ebx
+f01058da:	83 ec 1c             	sub    $0x1c,%esp
+f01058dd:	e8 6d aa ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01058e2:	81 c3 aa fb 00 00    	add    $0xfbaa,%ebx
+	if (!prof_running)
+f01058e8:	80 bb 7d e6 02 00 00 	cmpb   $0x0,0x2e67d(%ebx)
+f01058ef:	75 08                	jne    f01058f9 <prof_tick+0x25>
+}
+f01058f1:	83 c4 1c             	add    $0x1c,%esp
+f01058f4:	5b                   	pop    %ebx
+f01058f5:	5e                   	pop    %esi
+f01058f6:	5f                   	pop    %edi
+f01058f7:	5d                   	pop    %ebp
+f01058f8:	c3                   	ret
+	hists[cpunum()].nsample++;
+f01058f9:	e8 c1 2f 00 00       	call   f01088bf <cpunum>
+f01058fe:	69 c0 08 20 00 00    	imul   $0x2008,%eax,%eax
+f0105904:	83 84 03 94 06 03 00 	addl   $0x1,0x30694(%ebx,%eax,1)
+f010590b:	01 
+	if (!hist_add(hists[cpunum()].self, tf->tf_eip))
+f010590c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010590f:	8b 70 30             	mov    0x30(%eax),%esi
+f0105912:	e8 a8 2f 00 00       	call   f01088bf <cpunum>
+f0105917:	69 c0 08 20 00 00    	imul   $0x2008,%eax,%eax
+f010591d:	8d 84 03 94 e6 02 00 	lea    0x2e694(%ebx,%eax,1),%eax
+f0105924:	89 f2                	mov    %esi,%edx
+f0105926:	e8 97 fe ff ff       	call   f01057c2 <hist_add>
+f010592b:	85 c0                	test   %eax,%eax
+f010592d:	74 67                	je     f0105996 <prof_tick+0xc2>
+	if (!prof_callers)
+f010592f:	80 bb 7c e6 02 00 00 	cmpb   $0x0,0x2e67c(%ebx)
+f0105936:	74 b9                	je     f01058f1 <prof_tick+0x1d>
+	ebp = (uint32_t *) tf->tf_regs.reg_ebp;
+f0105938:	8b 45 08             	mov    0x8(%ebp),%eax
+f010593b:	8b 70 08             	mov    0x8(%eax),%esi
+	for (depth = 0; depth < PROF_DEPTH; depth++) {
+f010593e:	bf 09 00 00 00       	mov    $0x9,%edi
+		    || (uintptr_t) ebp >= (uintptr_t) tf + KSTKSIZE)
+f0105943:	05 00 80 00 00       	add    $0x8000,%eax
+f0105948:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		hist_add(hists[cpunum()].callers, ebp[1]);
+f010594b:	8d 83 94 e6 02 00    	lea    0x2e694(%ebx),%eax
+f0105951:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (depth = 0; depth < PROF_DEPTH; depth++) {
+f0105954:	83 ef 01             	sub    $0x1,%edi
+f0105957:	74 98                	je     f01058f1 <prof_tick+0x1d>
+		if ((uintptr_t) ebp <= (uintptr_t) tf
+f0105959:	39 75 08             	cmp    %esi,0x8(%ebp)
+f010595c:	73 93                	jae    f01058f1 <prof_tick+0x1d>
+		    || (uintptr_t) ebp >= (uintptr_t) tf + KSTKSIZE)
+f010595e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105961:	39 c6                	cmp    %eax,%esi
+f0105963:	73 8c                	jae    f01058f1 <prof_tick+0x1d>
+		hist_add(hists[cpunum()].callers, ebp[1]);
+f0105965:	8b 46 04             	mov    0x4(%esi),%eax
+f0105968:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010596b:	e8 4f 2f 00 00       	call   f01088bf <cpunum>
+f0105970:	69 c0 08 20 00 00    	imul   $0x2008,%eax,%eax
+f0105976:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f0105979:	8d 84 01 00 10 00 00 	lea    0x1000(%ecx,%eax,1),%eax
+f0105980:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0105983:	e8 3a fe ff ff       	call   f01057c2 <hist_add>
+		next = (uint32_t *) ebp[0];
+f0105988:	8b 06                	mov    (%esi),%eax
+		if (next <= ebp)
+f010598a:	39 c6                	cmp    %eax,%esi
+f010598c:	0f 83 5f ff ff ff    	jae    f01058f1 <prof_tick+0x1d>
+		ebp = next;
+f0105992:	89 c6                	mov    %eax,%esi
+f0105994:	eb be                	jmp    f0105954 <prof_tick+0x80>
+		hists[cpunum()].ndropped++;
+f0105996:	e8 24 2f 00 00       	call   f01088bf <cpunum>
+f010599b:	69 c0 08 20 00 00    	imul   $0x2008,%eax,%eax
+f01059a1:	83 84 03 98 06 03 00 	addl   $0x1,0x30698(%ebx,%eax,1)
+f01059a8:	01 
+f01059a9:	eb 84                	jmp    f010592f <prof_tick+0x5b>
+
+f01059ab <prof_stop>:
+{
+f01059ab:	55                   	push   %ebp
+f01059ac:	89 e5                	mov    %esp,%ebp
+f01059ae:	53                   	push   %ebx
+f01059af:	83 ec 04             	sub    $0x4,%esp
+f01059b2:	e8 98 a9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01059b7:	81 c3 d5 fa 00 00    	add    $0xfad5,%ebx
+	if (prof_running && prof_event >= 0)
+f01059bd:	80 bb 7d e6 02 00 00 	cmpb   $0x0,0x2e67d(%ebx)
+f01059c4:	74 0e                	je     f01059d4 <prof_stop+0x29>
+f01059c6:	83 bb c0 ff ff ff 00 	cmpl   $0x0,-0x40(%ebx)
+f01059cd:	79 11                	jns    f01059e0 <prof_stop+0x35>
+		kclock_stop();
+f01059cf:	e8 18 e3 ff ff       	call   f0103cec <kclock_stop>
+	prof_running = 0;
+f01059d4:	c6 83 7d e6 02 00 00 	movb   $0x0,0x2e67d(%ebx)
+}
+f01059db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01059de:	c9                   	leave
+f01059df:	c3                   	ret
+		perf_sample_stop();
+f01059e0:	e8 38 0f 00 00       	call   f010691d <perf_sample_stop>
+f01059e5:	eb ed                	jmp    f01059d4 <prof_stop+0x29>
+
+f01059e7 <prof_start>:
+{
+f01059e7:	55                   	push   %ebp
+f01059e8:	89 e5                	mov    %esp,%ebp
+f01059ea:	57                   	push   %edi
+f01059eb:	56                   	push   %esi
+f01059ec:	53                   	push   %ebx
+f01059ed:	83 ec 0c             	sub    $0xc,%esp
+f01059f0:	e8 5a a9 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01059f5:	81 c3 97 fa 00 00    	add    $0xfa97,%ebx
+f01059fb:	8b 75 08             	mov    0x8(%ebp),%esi
+f01059fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	prof_stop();
+f0105a01:	e8 a5 ff ff ff       	call   f01059ab <prof_stop>
+	memset(hists, 0, sizeof(hists));
+f0105a06:	83 ec 04             	sub    $0x4,%esp
+f0105a09:	68 40 00 01 00       	push   $0x10040
+f0105a0e:	6a 00                	push   $0x0
+f0105a10:	8d 83 94 e6 02 00    	lea    0x2e694(%ebx),%eax
+f0105a16:	50                   	push   %eax
+f0105a17:	e8 cd 26 00 00       	call   f01080e9 <memset>
+	prof_hz = hz;
+f0105a1c:	89 b3 78 e6 02 00    	mov    %esi,0x2e678(%ebx)
+	prof_event = -1;
+f0105a22:	c7 83 c0 ff ff ff ff 	movl   $0xffffffff,-0x40(%ebx)
+f0105a29:	ff ff ff 
+	prof_callers = callers;
+f0105a2c:	89 f8                	mov    %edi,%eax
+f0105a2e:	88 83 7c e6 02 00    	mov    %al,0x2e67c(%ebx)
+	prof_running = 1;
+f0105a34:	c6 83 7d e6 02 00 01 	movb   $0x1,0x2e67d(%ebx)
+	kclock_start(hz);
+f0105a3b:	89 34 24             	mov    %esi,(%esp)
+f0105a3e:	e8 32 e2 ff ff       	call   f0103c75 <kclock_start>
+}
+f0105a43:	83 c4 10             	add    $0x10,%esp
+f0105a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105a49:	5b                   	pop    %ebx
+f0105a4a:	5e                   	pop    %esi
+f0105a4b:	5f                   	pop    %edi
+f0105a4c:	5d                   	pop    %ebp
+f0105a4d:	c3                   	ret
+
+f0105a4e <prof_start_event>:
+{
+f0105a4e:	55                   	push   %ebp
+f0105a4f:	89 e5                	mov    %esp,%ebp
+f0105a51:	57                   	push   %edi
+f0105a52:	56                   	push   %esi
+f0105a53:	53                   	push   %ebx
+f0105a54:	83 ec 0c             	sub    $0xc,%esp
+f0105a57:	e8 f3 a8 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0105a5c:	81 c3 30 fa 00 00    	add    $0xfa30,%ebx
+f0105a62:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0105a65:	8b 75 10             	mov    0x10(%ebp),%esi
+	prof_stop();
+f0105a68:	e8 3e ff ff ff       	call   f01059ab <prof_stop>
+	memset(hists, 0, sizeof(hists));
+f0105a6d:	83 ec 04             	sub    $0x4,%esp
+f0105a70:	68 40 00 01 00       	push   $0x10040
+f0105a75:	6a 00                	push   $0x0
+f0105a77:	8d 83 94 e6 02 00    	lea    0x2e694(%ebx),%eax
+f0105a7d:	50                   	push   %eax
+f0105a7e:	e8 66 26 00 00       	call   f01080e9 <memset>
+	prof_event = event;
+f0105a83:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105a86:	89 83 c0 ff ff ff    	mov    %eax,-0x40(%ebx)
+	prof_period = period;
+f0105a8c:	89 bb 74 e6 02 00    	mov    %edi,0x2e674(%ebx)
+	prof_callers = callers;
+f0105a92:	89 f0                	mov    %esi,%eax
+f0105a94:	88 83 7c e6 02 00    	mov    %al,0x2e67c(%ebx)
+	prof_running = 1;
+f0105a9a:	c6 83 7d e6 02 00 01 	movb   $0x1,0x2e67d(%ebx)
+	if ((r = perf_sample_start(event, period)) < 0)
+f0105aa1:	83 c4 08             	add    $0x8,%esp
+f0105aa4:	57                   	push   %edi
+f0105aa5:	ff 75 08             	push   0x8(%ebp)
+f0105aa8:	e8 62 0d 00 00       	call   f010680f <perf_sample_start>
+f0105aad:	83 c4 10             	add    $0x10,%esp
+f0105ab0:	85 c0                	test   %eax,%eax
+f0105ab2:	78 08                	js     f0105abc <prof_start_event+0x6e>
+}
+f0105ab4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105ab7:	5b                   	pop    %ebx
+f0105ab8:	5e                   	pop    %esi
+f0105ab9:	5f                   	pop    %edi
+f0105aba:	5d                   	pop    %ebp
+f0105abb:	c3                   	ret
+		prof_running = 0;
+f0105abc:	c6 83 7d e6 02 00 00 	movb   $0x0,0x2e67d(%ebx)
+	return r;
+f0105ac3:	eb ef                	jmp    f0105ab4 <prof_start_event+0x66>
+
+f0105ac5 <prof_report>:
+
+// Print the 'n' functions with the most samples of their own.
+void
+prof_report(int n)
+{
+f0105ac5:	55                   	push   %ebp
+f0105ac6:	89 e5                	mov    %esp,%ebp
+f0105ac8:	57                   	push   %edi
+f0105ac9:	56                   	push   %esi
+f0105aca:	53                   	push   %ebx
+f0105acb:	83 ec 3c             	sub    $0x3c,%esp
+f0105ace:	e8 13 b5 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0105ad3:	81 c1 b9 f9 00 00    	add    $0xf9b9,%ecx
+f0105ad9:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+	uint32_t nsample, ndropped;
+	int cpu, i, j, nfns;
+	bool running;
+
+	// keep the histograms still while we read them
+	running = prof_running;
+f0105adc:	0f b6 99 7d e6 02 00 	movzbl 0x2e67d(%ecx),%ebx
+	prof_running = 0;
+f0105ae3:	c6 81 7d e6 02 00 00 	movb   $0x0,0x2e67d(%ecx)
+
+	nfns = 0;
+f0105aea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0105af1:	8d 81 94 e6 02 00    	lea    0x2e694(%ecx),%eax
+f0105af7:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+f0105afd:	05 40 10 01 00       	add    $0x11040,%eax
+f0105b02:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	nsample = ndropped = 0;
+f0105b05:	be 00 00 00 00       	mov    $0x0,%esi
+f0105b0a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+	for (cpu = 0; cpu < NCPU; cpu++) {
+		nsample += hists[cpu].nsample;
+		ndropped += hists[cpu].ndropped;
+		for (i = 0; i < PROF_NBUCKET; i++) {
+			struct Profbucket *b = &hists[cpu].self[i];
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc))) {
+f0105b11:	8d 81 74 d6 02 00    	lea    0x2d674(%ecx),%eax
+f0105b17:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0105b1a:	88 5d bc             	mov    %bl,-0x44(%ebp)
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f0105b1d:	eb 60                	jmp    f0105b7f <prof_report+0xba>
+				f->pf_self += b->pb_count;
+				f->pf_total += b->pb_count;
+			}
+			b = &hists[cpu].callers[i];
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc)))
+f0105b1f:	83 be 04 10 00 00 00 	cmpl   $0x0,0x1004(%esi)
+f0105b26:	75 2e                	jne    f0105b56 <prof_report+0x91>
+f0105b28:	83 c3 08             	add    $0x8,%ebx
+		for (i = 0; i < PROF_NBUCKET; i++) {
+f0105b2b:	39 fb                	cmp    %edi,%ebx
+f0105b2d:	74 47                	je     f0105b76 <prof_report+0xb1>
+f0105b2f:	89 de                	mov    %ebx,%esi
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc))) {
+f0105b31:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+f0105b35:	74 e8                	je     f0105b1f <prof_report+0x5a>
+f0105b37:	8b 0b                	mov    (%ebx),%ecx
+f0105b39:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0105b3c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105b3f:	e8 c9 fc ff ff       	call   f010580d <fn_add>
+f0105b44:	85 c0                	test   %eax,%eax
+f0105b46:	74 d7                	je     f0105b1f <prof_report+0x5a>
+				f->pf_self += b->pb_count;
+f0105b48:	8b 53 04             	mov    0x4(%ebx),%edx
+f0105b4b:	01 50 08             	add    %edx,0x8(%eax)
+				f->pf_total += b->pb_count;
+f0105b4e:	8b 53 04             	mov    0x4(%ebx),%edx
+f0105b51:	01 50 0c             	add    %edx,0xc(%eax)
+f0105b54:	eb c9                	jmp    f0105b1f <prof_report+0x5a>
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc)))
+f0105b56:	8b 8e 00 10 00 00    	mov    0x1000(%esi),%ecx
+f0105b5c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0105b5f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105b62:	e8 a6 fc ff ff       	call   f010580d <fn_add>
+f0105b67:	85 c0                	test   %eax,%eax
+f0105b69:	74 bd                	je     f0105b28 <prof_report+0x63>
+				f->pf_total += b->pb_count;
+f0105b6b:	8b 96 04 10 00 00    	mov    0x1004(%esi),%edx
+f0105b71:	01 50 0c             	add    %edx,0xc(%eax)
+f0105b74:	eb b2                	jmp    f0105b28 <prof_report+0x63>
+f0105b76:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0105b79:	81 c7 08 20 00 00    	add    $0x2008,%edi
+	for (cpu = 0; cpu < NCPU; cpu++) {
+f0105b7f:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0105b82:	39 c7                	cmp    %eax,%edi
+f0105b84:	74 20                	je     f0105ba6 <prof_report+0xe1>
+		nsample += hists[cpu].nsample;
+f0105b86:	8b 8f 00 10 00 00    	mov    0x1000(%edi),%ecx
+f0105b8c:	01 4d cc             	add    %ecx,-0x34(%ebp)
+		ndropped += hists[cpu].ndropped;
+f0105b8f:	03 b7 04 10 00 00    	add    0x1004(%edi),%esi
+f0105b95:	8d 9f 00 f0 ff ff    	lea    -0x1000(%edi),%ebx
+			if (b->pb_count && (f = fn_add(fns, &nfns, b->pb_pc))) {
+f0105b9b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105b9e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0105ba1:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+		for (i = 0; i < PROF_NBUCKET; i++) {
+f0105ba4:	eb 85                	jmp    f0105b2b <prof_report+0x66>
+		}
+	}
+
+	prof_running = running;
+f0105ba6:	0f b6 5d bc          	movzbl -0x44(%ebp),%ebx
+f0105baa:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0105bad:	88 9f 7d e6 02 00    	mov    %bl,0x2e67d(%edi)
+
+	if (prof_event >= 0)
+f0105bb3:	8b 87 c0 ff ff ff    	mov    -0x40(%edi),%eax
+f0105bb9:	85 c0                	test   %eax,%eax
+f0105bbb:	0f 88 93 00 00 00    	js     f0105c54 <prof_report+0x18f>
+		cprintf("%u samples, one per %u %s", nsample, prof_period,
+f0105bc1:	83 ec 0c             	sub    $0xc,%esp
+f0105bc4:	50                   	push   %eax
+f0105bc5:	89 fb                	mov    %edi,%ebx
+f0105bc7:	e8 ff 04 00 00       	call   f01060cb <perf_event_name>
+f0105bcc:	50                   	push   %eax
+f0105bcd:	ff b7 74 e6 02 00    	push   0x2e674(%edi)
+f0105bd3:	ff 75 cc             	push   -0x34(%ebp)
+f0105bd6:	8d 87 38 5d ff ff    	lea    -0xa2c8(%edi),%eax
+f0105bdc:	50                   	push   %eax
+f0105bdd:	e8 b0 e4 ff ff       	call   f0104092 <cprintf>
+f0105be2:	83 c4 20             	add    $0x20,%esp
+			perf_event_name(prof_event));
+	else
+		cprintf("%u samples at %d Hz", nsample, prof_hz);
+	if (ndropped)
+f0105be5:	85 f6                	test   %esi,%esi
+f0105be7:	0f 85 8a 00 00 00    	jne    f0105c77 <prof_report+0x1b2>
+		cprintf(", %u not counted", ndropped);
+	cprintf("\n");
+f0105bed:	83 ec 0c             	sub    $0xc,%esp
+f0105bf0:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0105bf3:	8d 87 09 66 ff ff    	lea    -0x99f7(%edi),%eax
+f0105bf9:	50                   	push   %eax
+f0105bfa:	89 fb                	mov    %edi,%ebx
+f0105bfc:	e8 91 e4 ff ff       	call   f0104092 <cprintf>
+	if (nsample == 0)
+f0105c01:	83 c4 10             	add    $0x10,%esp
+f0105c04:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+f0105c08:	0f 84 a6 01 00 00    	je     f0105db4 <prof_report+0x2ef>
+		return;
+	cprintf(prof_callers ? "    self        total\n" : "    self\n");
+f0105c0e:	8d 87 2e 5d ff ff    	lea    -0xa2d2(%edi),%eax
+f0105c14:	80 bf 7c e6 02 00 00 	cmpb   $0x0,0x2e67c(%edi)
+f0105c1b:	74 06                	je     f0105c23 <prof_report+0x15e>
+f0105c1d:	8d 87 17 5d ff ff    	lea    -0xa2e9(%edi),%eax
+f0105c23:	83 ec 0c             	sub    $0xc,%esp
+f0105c26:	50                   	push   %eax
+f0105c27:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105c2a:	e8 63 e4 ff ff       	call   f0104092 <cprintf>
+f0105c2f:	8d b3 84 d6 02 00    	lea    0x2d684(%ebx),%esi
+
+	// selection sort of the top n
+	for (i = 0; i < n && i < nfns; i++) {
+f0105c35:	83 c4 10             	add    $0x10,%esp
+f0105c38:	bf 00 00 00 00       	mov    $0x0,%edi
+f0105c3d:	8d 8b 74 d6 02 00    	lea    0x2d674(%ebx),%ecx
+f0105c43:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+				t = fns[i];
+				fns[i] = fns[j];
+				fns[j] = t;
+			}
+		f = &fns[i];
+		cprintf_cached("  %6u %3u.%u%%", f->pf_self,
+f0105c46:	8d 83 94 0d 00 00    	lea    0xd94(%ebx),%eax
+f0105c4c:	89 45 bc             	mov    %eax,-0x44(%ebp)
+	for (i = 0; i < n && i < nfns; i++) {
+f0105c4f:	e9 f6 00 00 00       	jmp    f0105d4a <prof_report+0x285>
+		cprintf("%u samples at %d Hz", nsample, prof_hz);
+f0105c54:	83 ec 04             	sub    $0x4,%esp
+f0105c57:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105c5a:	ff b3 78 e6 02 00    	push   0x2e678(%ebx)
+f0105c60:	ff 75 cc             	push   -0x34(%ebp)
+f0105c63:	8d 83 52 5d ff ff    	lea    -0xa2ae(%ebx),%eax
+f0105c69:	50                   	push   %eax
+f0105c6a:	e8 23 e4 ff ff       	call   f0104092 <cprintf>
+f0105c6f:	83 c4 10             	add    $0x10,%esp
+f0105c72:	e9 6e ff ff ff       	jmp    f0105be5 <prof_report+0x120>
+		cprintf(", %u not counted", ndropped);
+f0105c77:	83 ec 08             	sub    $0x8,%esp
+f0105c7a:	56                   	push   %esi
+f0105c7b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105c7e:	8d 83 66 5d ff ff    	lea    -0xa29a(%ebx),%eax
+f0105c84:	50                   	push   %eax
+f0105c85:	e8 08 e4 ff ff       	call   f0104092 <cprintf>
+f0105c8a:	83 c4 10             	add    $0x10,%esp
+f0105c8d:	e9 5b ff ff ff       	jmp    f0105bed <prof_report+0x128>
+f0105c92:	83 c0 10             	add    $0x10,%eax
+		for (j = i + 1; j < nfns; j++)
+f0105c95:	39 c8                	cmp    %ecx,%eax
+f0105c97:	74 41                	je     f0105cda <prof_report+0x215>
+			if (fns[j].pf_self > fns[i].pf_self) {
+f0105c99:	8b 56 f8             	mov    -0x8(%esi),%edx
+f0105c9c:	3b 50 08             	cmp    0x8(%eax),%edx
+f0105c9f:	73 f1                	jae    f0105c92 <prof_report+0x1cd>
+				t = fns[i];
+f0105ca1:	8b 7e f0             	mov    -0x10(%esi),%edi
+f0105ca4:	8b 5e f4             	mov    -0xc(%esi),%ebx
+f0105ca7:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0105caa:	8b 5e fc             	mov    -0x4(%esi),%ebx
+f0105cad:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+				fns[i] = fns[j];
+f0105cb0:	8b 18                	mov    (%eax),%ebx
+f0105cb2:	89 5e f0             	mov    %ebx,-0x10(%esi)
+f0105cb5:	8b 58 04             	mov    0x4(%eax),%ebx
+f0105cb8:	89 5e f4             	mov    %ebx,-0xc(%esi)
+f0105cbb:	8b 58 08             	mov    0x8(%eax),%ebx
+f0105cbe:	89 5e f8             	mov    %ebx,-0x8(%esi)
+f0105cc1:	8b 58 0c             	mov    0xc(%eax),%ebx
+f0105cc4:	89 5e fc             	mov    %ebx,-0x4(%esi)
+				fns[j] = t;
+f0105cc7:	89 38                	mov    %edi,(%eax)
+f0105cc9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0105ccc:	89 78 04             	mov    %edi,0x4(%eax)
+f0105ccf:	89 50 08             	mov    %edx,0x8(%eax)
+f0105cd2:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0105cd5:	89 58 0c             	mov    %ebx,0xc(%eax)
+f0105cd8:	eb b8                	jmp    f0105c92 <prof_report+0x1cd>
+f0105cda:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0105cdd:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+		cprintf_cached("  %6u %3u.%u%%", f->pf_self,
+f0105ce0:	8b 5e f8             	mov    -0x8(%esi),%ebx
+f0105ce3:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+f0105ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105cee:	f7 75 cc             	divl   -0x34(%ebp)
+f0105cf1:	89 c1                	mov    %eax,%ecx
+f0105cf3:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+f0105cf8:	f7 e2                	mul    %edx
+f0105cfa:	c1 ea 03             	shr    $0x3,%edx
+f0105cfd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f0105d00:	01 c0                	add    %eax,%eax
+f0105d02:	29 c1                	sub    %eax,%ecx
+f0105d04:	51                   	push   %ecx
+f0105d05:	6b c3 64             	imul   $0x64,%ebx,%eax
+f0105d08:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105d0d:	f7 75 cc             	divl   -0x34(%ebp)
+f0105d10:	50                   	push   %eax
+f0105d11:	53                   	push   %ebx
+f0105d12:	ff 75 bc             	push   -0x44(%ebp)
+f0105d15:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105d18:	e8 ee e3 ff ff       	call   f010410b <cprintfc>
+			f->pf_self * 100 / nsample,
+			f->pf_self * 1000 / nsample % 10);
+		if (prof_callers)
+f0105d1d:	83 c4 10             	add    $0x10,%esp
+f0105d20:	80 bb 7c e6 02 00 00 	cmpb   $0x0,0x2e67c(%ebx)
+f0105d27:	75 42                	jne    f0105d6b <prof_report+0x2a6>
+			cprintf_cached(" %6u %3u.%u%%", f->pf_total,
+				f->pf_total * 100 / nsample,
+				f->pf_total * 1000 / nsample % 10);
+		cprintf_cached("  %.*s\n", f->pf_namelen, f->pf_name);
+f0105d29:	83 ec 04             	sub    $0x4,%esp
+f0105d2c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0105d2f:	ff 70 f0             	push   -0x10(%eax)
+f0105d32:	ff 70 f4             	push   -0xc(%eax)
+f0105d35:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105d38:	8d 83 d4 0a 00 00    	lea    0xad4(%ebx),%eax
+f0105d3e:	50                   	push   %eax
+f0105d3f:	e8 c7 e3 ff ff       	call   f010410b <cprintfc>
+f0105d44:	83 c6 10             	add    $0x10,%esi
+f0105d47:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < n && i < nfns; i++) {
+f0105d4a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+f0105d4d:	7d 65                	jge    f0105db4 <prof_report+0x2ef>
+f0105d4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105d52:	39 f8                	cmp    %edi,%eax
+f0105d54:	7e 5e                	jle    f0105db4 <prof_report+0x2ef>
+		for (j = i + 1; j < nfns; j++)
+f0105d56:	83 c7 01             	add    $0x1,%edi
+f0105d59:	c1 e0 04             	shl    $0x4,%eax
+f0105d5c:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0105d5f:	01 c1                	add    %eax,%ecx
+f0105d61:	89 f0                	mov    %esi,%eax
+f0105d63:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0105d66:	e9 2a ff ff ff       	jmp    f0105c95 <prof_report+0x1d0>
+			cprintf_cached(" %6u %3u.%u%%", f->pf_total,
+f0105d6b:	8b 5e fc             	mov    -0x4(%esi),%ebx
+f0105d6e:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+f0105d74:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105d79:	f7 75 cc             	divl   -0x34(%ebp)
+f0105d7c:	89 c1                	mov    %eax,%ecx
+f0105d7e:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+f0105d83:	f7 e2                	mul    %edx
+f0105d85:	c1 ea 03             	shr    $0x3,%edx
+f0105d88:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f0105d8b:	01 c0                	add    %eax,%eax
+f0105d8d:	29 c1                	sub    %eax,%ecx
+f0105d8f:	51                   	push   %ecx
+f0105d90:	6b c3 64             	imul   $0x64,%ebx,%eax
+f0105d93:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105d98:	f7 75 cc             	divl   -0x34(%ebp)
+f0105d9b:	50                   	push   %eax
+f0105d9c:	53                   	push   %ebx
+f0105d9d:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0105da0:	8d 83 34 0c 00 00    	lea    0xc34(%ebx),%eax
+f0105da6:	50                   	push   %eax
+f0105da7:	e8 5f e3 ff ff       	call   f010410b <cprintfc>
+f0105dac:	83 c4 10             	add    $0x10,%esp
+f0105daf:	e9 75 ff ff ff       	jmp    f0105d29 <prof_report+0x264>
+	}
+}
+f0105db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105db7:	5b                   	pop    %ebx
+f0105db8:	5e                   	pop    %esi
+f0105db9:	5f                   	pop    %edi
+f0105dba:	5d                   	pop    %ebp
+f0105dbb:	c3                   	ret
+
+f0105dbc <pmu_disable>:
+}
+
+// Stop and unprogram all the counters of this CPU.
+static void
+pmu_disable(void)
+{
+f0105dbc:	55                   	push   %ebp
+f0105dbd:	89 e5                	mov    %esp,%ebp
+f0105dbf:	57                   	push   %edi
+f0105dc0:	56                   	push   %esi
+f0105dc1:	53                   	push   %ebx
+f0105dc2:	e8 27 b2 ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f0105dc7:	81 c7 c5 f6 00 00    	add    $0xf6c5,%edi
+	int i;
+
+	if (pmu.version >= 2)
+f0105dcd:	83 bf 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%edi)
+f0105dd4:	7e 11                	jle    f0105de7 <pmu_disable+0x2b>
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f0105dd6:	b9 8f 03 00 00       	mov    $0x38f,%ecx
+f0105ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105de0:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105de5:	0f 30                	wrmsr
+		wrmsr(MSR_GLOBAL_CTRL, 0);
+	for (i = 0; i < pmu.ngp; i++)
+f0105de7:	8b b7 18 e7 03 00    	mov    0x3e718(%edi),%esi
+f0105ded:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0105df2:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105df7:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105dfc:	eb 0b                	jmp    f0105e09 <pmu_disable+0x4d>
+f0105dfe:	8d 8b 86 01 00 00    	lea    0x186(%ebx),%ecx
+f0105e04:	0f 30                	wrmsr
+f0105e06:	83 c3 01             	add    $0x1,%ebx
+f0105e09:	39 de                	cmp    %ebx,%esi
+f0105e0b:	7f f1                	jg     f0105dfe <pmu_disable+0x42>
+		wrmsr(MSR_PERFEVTSEL0 + i, 0);
+	if (pmu.nfixed)
+f0105e0d:	83 bf 20 e7 03 00 00 	cmpl   $0x0,0x3e720(%edi)
+f0105e14:	74 11                	je     f0105e27 <pmu_disable+0x6b>
+f0105e16:	b9 8d 03 00 00       	mov    $0x38d,%ecx
+f0105e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105e20:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105e25:	0f 30                	wrmsr
+		wrmsr(MSR_FIXED_CTR_CTRL, 0);
+}
+f0105e27:	5b                   	pop    %ebx
+f0105e28:	5e                   	pop    %esi
+f0105e29:	5f                   	pop    %edi
+f0105e2a:	5d                   	pop    %ebp
+f0105e2b:	c3                   	ret
+
+f0105e2c <pmc0_overflowed>:
+}
+
+// Whether PMC0 has wrapped since it was last loaded with -period.
+static bool
+pmc0_overflowed(void)
+{
+f0105e2c:	55                   	push   %ebp
+f0105e2d:	89 e5                	mov    %esp,%ebp
+f0105e2f:	57                   	push   %edi
+f0105e30:	56                   	push   %esi
+f0105e31:	53                   	push   %ebx
+f0105e32:	e8 18 a5 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0105e37:	81 c3 55 f6 00 00    	add    $0xf655,%ebx
+	if (pmu.version >= 2)
+f0105e3d:	83 bb 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%ebx)
+f0105e44:	7f 37                	jg     f0105e7d <pmc0_overflowed+0x51>
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+f0105e46:	b9 c1 00 00 00       	mov    $0xc1,%ecx
+f0105e4b:	0f 32                	rdmsr
+f0105e4d:	89 c6                	mov    %eax,%esi
+f0105e4f:	89 d7                	mov    %edx,%edi
+		return rdmsr(MSR_GLOBAL_STATUS) & 1;
+	// the top bit stays set until the counter wraps
+	return !(rdmsr(MSR_PMC0) & (pmu.gpmask ^ (pmu.gpmask >> 1)));
+f0105e51:	8b 83 28 e7 03 00    	mov    0x3e728(%ebx),%eax
+f0105e57:	8b 93 2c e7 03 00    	mov    0x3e72c(%ebx),%edx
+f0105e5d:	89 c1                	mov    %eax,%ecx
+f0105e5f:	89 d3                	mov    %edx,%ebx
+f0105e61:	0f ac d9 01          	shrd   $0x1,%ebx,%ecx
+f0105e65:	d1 eb                	shr    %ebx
+f0105e67:	31 c1                	xor    %eax,%ecx
+f0105e69:	31 d3                	xor    %edx,%ebx
+f0105e6b:	89 c8                	mov    %ecx,%eax
+f0105e6d:	21 f0                	and    %esi,%eax
+f0105e6f:	89 da                	mov    %ebx,%edx
+f0105e71:	21 fa                	and    %edi,%edx
+f0105e73:	09 d0                	or     %edx,%eax
+f0105e75:	0f 94 c0             	sete   %al
+}
+f0105e78:	5b                   	pop    %ebx
+f0105e79:	5e                   	pop    %esi
+f0105e7a:	5f                   	pop    %edi
+f0105e7b:	5d                   	pop    %ebp
+f0105e7c:	c3                   	ret
+f0105e7d:	b9 8e 03 00 00       	mov    $0x38e,%ecx
+f0105e82:	0f 32                	rdmsr
+		return rdmsr(MSR_GLOBAL_STATUS) & 1;
+f0105e84:	83 e0 01             	and    $0x1,%eax
+f0105e87:	eb ef                	jmp    f0105e78 <pmc0_overflowed+0x4c>
+
+f0105e89 <perf_init>:
+{
+f0105e89:	55                   	push   %ebp
+f0105e8a:	89 e5                	mov    %esp,%ebp
+f0105e8c:	57                   	push   %edi
+f0105e8d:	56                   	push   %esi
+f0105e8e:	53                   	push   %ebx
+f0105e8f:	83 ec 14             	sub    $0x14,%esp
+f0105e92:	e8 53 b1 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f0105e97:	81 c6 f5 f5 00 00    	add    $0xf5f5,%esi
+	asm volatile("cpuid"
+f0105e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105ea2:	0f a2                	cpuid
+	if (vendor != 0x756e6547 || max < 0xA)	// "Genu"
+f0105ea4:	81 fb 47 65 6e 75    	cmp    $0x756e6547,%ebx
+f0105eaa:	0f 95 c2             	setne  %dl
+f0105ead:	83 f8 09             	cmp    $0x9,%eax
+f0105eb0:	0f 96 c0             	setbe  %al
+f0105eb3:	08 c2                	or     %al,%dl
+f0105eb5:	88 55 eb             	mov    %dl,-0x15(%ebp)
+f0105eb8:	74 08                	je     f0105ec2 <perf_init+0x39>
+}
+f0105eba:	83 c4 14             	add    $0x14,%esp
+f0105ebd:	5b                   	pop    %ebx
+f0105ebe:	5e                   	pop    %esi
+f0105ebf:	5f                   	pop    %edi
+f0105ec0:	5d                   	pop    %ebp
+f0105ec1:	c3                   	ret
+f0105ec2:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0105ec7:	0f a2                	cpuid
+f0105ec9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0105ecc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0105ecf:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+	if ((eax & 0xFF) == 0 || ((eax >> 8) & 0xFF) == 0)
+f0105ed2:	89 c7                	mov    %eax,%edi
+f0105ed4:	81 e7 ff 00 00 00    	and    $0xff,%edi
+f0105eda:	74 de                	je     f0105eba <perf_init+0x31>
+f0105edc:	0f b6 d4             	movzbl %ah,%edx
+f0105edf:	f6 c4 ff             	test   $0xff,%ah
+f0105ee2:	74 d6                	je     f0105eba <perf_init+0x31>
+	pmu.version = eax & 0xFF;
+f0105ee4:	89 be 14 e7 03 00    	mov    %edi,0x3e714(%esi)
+	pmu.ngp = MIN((int) (eax >> 8) & 0xFF, PERF_MAXGP);
+f0105eea:	b9 08 00 00 00       	mov    $0x8,%ecx
+f0105eef:	39 ca                	cmp    %ecx,%edx
+f0105ef1:	0f 4f d1             	cmovg  %ecx,%edx
+f0105ef4:	89 96 18 e7 03 00    	mov    %edx,0x3e718(%esi)
+	pmu.gpbits = (eax >> 16) & 0xFF;
+f0105efa:	89 c3                	mov    %eax,%ebx
+f0105efc:	c1 eb 10             	shr    $0x10,%ebx
+f0105eff:	0f b6 db             	movzbl %bl,%ebx
+f0105f02:	89 9e 1c e7 03 00    	mov    %ebx,0x3e71c(%esi)
+	return bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+f0105f08:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0105f0d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f0105f12:	83 fb 3f             	cmp    $0x3f,%ebx
+f0105f15:	7f 24                	jg     f0105f3b <perf_init+0xb2>
+f0105f17:	89 d9                	mov    %ebx,%ecx
+f0105f19:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105f23:	0f a5 c2             	shld   %cl,%eax,%edx
+f0105f26:	d3 e0                	shl    %cl,%eax
+f0105f28:	f6 c1 20             	test   $0x20,%cl
+f0105f2b:	74 04                	je     f0105f31 <perf_init+0xa8>
+f0105f2d:	89 c2                	mov    %eax,%edx
+f0105f2f:	31 c0                	xor    %eax,%eax
+f0105f31:	89 d1                	mov    %edx,%ecx
+f0105f33:	89 c2                	mov    %eax,%edx
+f0105f35:	83 c2 ff             	add    $0xffffffff,%edx
+f0105f38:	83 d1 ff             	adc    $0xffffffff,%ecx
+	pmu.gpmask = widthmask(pmu.gpbits);
+f0105f3b:	89 96 28 e7 03 00    	mov    %edx,0x3e728(%esi)
+f0105f41:	89 8e 2c e7 03 00    	mov    %ecx,0x3e72c(%esi)
+	if (pmu.version >= 2) {
+f0105f47:	83 ff 01             	cmp    $0x1,%edi
+f0105f4a:	7e 63                	jle    f0105faf <perf_init+0x126>
+		pmu.nfixed = MIN((int) edx & 0x1F, PERF_MAXFIXED);
+f0105f4c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0105f4f:	89 da                	mov    %ebx,%edx
+f0105f51:	83 e2 1f             	and    $0x1f,%edx
+f0105f54:	b9 03 00 00 00       	mov    $0x3,%ecx
+f0105f59:	39 ca                	cmp    %ecx,%edx
+f0105f5b:	0f 4f d1             	cmovg  %ecx,%edx
+f0105f5e:	89 96 20 e7 03 00    	mov    %edx,0x3e720(%esi)
+		pmu.fixedbits = (edx >> 5) & 0xFF;
+f0105f64:	c1 eb 05             	shr    $0x5,%ebx
+f0105f67:	0f b6 db             	movzbl %bl,%ebx
+f0105f6a:	89 9e 24 e7 03 00    	mov    %ebx,0x3e724(%esi)
+	return bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+f0105f70:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0105f75:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+f0105f7a:	83 fb 3f             	cmp    $0x3f,%ebx
+f0105f7d:	7f 24                	jg     f0105fa3 <perf_init+0x11a>
+f0105f7f:	89 d9                	mov    %ebx,%ecx
+f0105f81:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105f86:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105f8b:	0f a5 c2             	shld   %cl,%eax,%edx
+f0105f8e:	d3 e0                	shl    %cl,%eax
+f0105f90:	f6 c1 20             	test   $0x20,%cl
+f0105f93:	74 04                	je     f0105f99 <perf_init+0x110>
+f0105f95:	89 c2                	mov    %eax,%edx
+f0105f97:	31 c0                	xor    %eax,%eax
+f0105f99:	89 d1                	mov    %edx,%ecx
+f0105f9b:	89 c2                	mov    %eax,%edx
+f0105f9d:	83 c2 ff             	add    $0xffffffff,%edx
+f0105fa0:	83 d1 ff             	adc    $0xffffffff,%ecx
+		pmu.fixedmask = widthmask(pmu.fixedbits);
+f0105fa3:	89 96 30 e7 03 00    	mov    %edx,0x3e730(%esi)
+f0105fa9:	89 8e 34 e7 03 00    	mov    %ecx,0x3e734(%esi)
+	len = eax >> 24;
+f0105faf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0105fb2:	c1 e8 18             	shr    $0x18,%eax
+f0105fb5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0105fb8:	b8 01 00 00 00       	mov    $0x1,%eax
+f0105fbd:	0f a2                	cpuid
+		    : ((eax >> 8) & 0xF) == 6 && pmu.version >= 3)
+f0105fbf:	c1 e8 08             	shr    $0x8,%eax
+f0105fc2:	83 e0 0f             	and    $0xf,%eax
+f0105fc5:	83 f8 06             	cmp    $0x6,%eax
+f0105fc8:	0f 94 c2             	sete   %dl
+f0105fcb:	83 ff 02             	cmp    $0x2,%edi
+f0105fce:	0f 9f c0             	setg   %al
+f0105fd1:	21 c2                	and    %eax,%edx
+f0105fd3:	88 55 e0             	mov    %dl,-0x20(%ebp)
+f0105fd6:	8b 96 38 e7 03 00    	mov    0x3e738(%esi),%edx
+	for (i = 0; i < NPERFEVENT; i++)
+f0105fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105fe1:	eb 0e                	jmp    f0105ff1 <perf_init+0x168>
+		    : ((eax >> 8) & 0xF) == 6 && pmu.version >= 3)
+f0105fe3:	80 7d e0 00          	cmpb   $0x0,-0x20(%ebp)
+f0105fe7:	75 2a                	jne    f0106013 <perf_init+0x18a>
+	for (i = 0; i < NPERFEVENT; i++)
+f0105fe9:	83 c0 01             	add    $0x1,%eax
+f0105fec:	83 f8 05             	cmp    $0x5,%eax
+f0105fef:	74 33                	je     f0106024 <perf_init+0x19b>
+		if (events[i].archbit >= 0
+f0105ff1:	0f b6 8c c6 3a 01 00 	movzbl 0x13a(%esi,%eax,8),%ecx
+f0105ff8:	00 
+f0105ff9:	84 c9                	test   %cl,%cl
+f0105ffb:	78 e6                	js     f0105fe3 <perf_init+0x15a>
+		    ? events[i].archbit < len && !(ebx & (1 << events[i].archbit))
+f0105ffd:	0f be d9             	movsbl %cl,%ebx
+f0106000:	8b 7d ec             	mov    -0x14(%ebp),%edi
+f0106003:	39 fb                	cmp    %edi,%ebx
+f0106005:	7d e2                	jge    f0105fe9 <perf_init+0x160>
+f0106007:	bf 01 00 00 00       	mov    $0x1,%edi
+f010600c:	d3 e7                	shl    %cl,%edi
+f010600e:	85 7d e4             	test   %edi,-0x1c(%ebp)
+f0106011:	75 d6                	jne    f0105fe9 <perf_init+0x160>
+			pmu.avail |= 1 << i;
+f0106013:	bf 01 00 00 00       	mov    $0x1,%edi
+f0106018:	89 c1                	mov    %eax,%ecx
+f010601a:	d3 e7                	shl    %cl,%edi
+f010601c:	09 fa                	or     %edi,%edx
+f010601e:	c6 45 eb 01          	movb   $0x1,-0x15(%ebp)
+f0106022:	eb c5                	jmp    f0105fe9 <perf_init+0x160>
+f0106024:	80 7d eb 00          	cmpb   $0x0,-0x15(%ebp)
+f0106028:	0f 84 8c fe ff ff    	je     f0105eba <perf_init+0x31>
+f010602e:	89 96 38 e7 03 00    	mov    %edx,0x3e738(%esi)
+f0106034:	e9 81 fe ff ff       	jmp    f0105eba <perf_init+0x31>
+
+f0106039 <perf_available>:
+{
+f0106039:	e8 a0 af ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f010603e:	05 4e f4 00 00       	add    $0xf44e,%eax
+	return pmu.version != 0;
+f0106043:	83 b8 14 e7 03 00 00 	cmpl   $0x0,0x3e714(%eax)
+f010604a:	0f 95 c0             	setne  %al
+}
+f010604d:	c3                   	ret
+
+f010604e <perf_can_count>:
+{
+f010604e:	55                   	push   %ebp
+f010604f:	89 e5                	mov    %esp,%ebp
+f0106051:	e8 8c af ff ff       	call   f0100fe2 <__x86.get_pc_thunk.dx>
+f0106056:	81 c2 36 f4 00 00    	add    $0xf436,%edx
+f010605c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	return event >= 0 && event < NPERFEVENT && (pmu.avail & (1 << event));
+f010605f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106064:	83 f9 04             	cmp    $0x4,%ecx
+f0106067:	77 13                	ja     f010607c <perf_can_count+0x2e>
+f0106069:	b8 01 00 00 00       	mov    $0x1,%eax
+f010606e:	d3 e0                	shl    %cl,%eax
+f0106070:	23 82 38 e7 03 00    	and    0x3e738(%edx),%eax
+f0106076:	0f 95 c0             	setne  %al
+f0106079:	0f b6 c0             	movzbl %al,%eax
+f010607c:	83 e0 01             	and    $0x1,%eax
+}
+f010607f:	5d                   	pop    %ebp
+f0106080:	c3                   	ret
+
+f0106081 <perf_event_byname>:
+{
+f0106081:	55                   	push   %ebp
+f0106082:	89 e5                	mov    %esp,%ebp
+f0106084:	57                   	push   %edi
+f0106085:	56                   	push   %esi
+f0106086:	53                   	push   %ebx
+f0106087:	83 ec 0c             	sub    $0xc,%esp
+f010608a:	e8 c0 a2 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010608f:	81 c3 fd f3 00 00    	add    $0xf3fd,%ebx
+f0106095:	8b 7d 08             	mov    0x8(%ebp),%edi
+	for (i = 0; i < NPERFEVENT; i++)
+f0106098:	be 00 00 00 00       	mov    $0x0,%esi
+		if (strcmp(events[i].name, name) == 0)
+f010609d:	83 ec 08             	sub    $0x8,%esp
+f01060a0:	57                   	push   %edi
+f01060a1:	ff b4 f3 34 01 00 00 	push   0x134(%ebx,%esi,8)
+f01060a8:	e8 48 1f 00 00       	call   f0107ff5 <strcmp>
+f01060ad:	83 c4 10             	add    $0x10,%esp
+f01060b0:	85 c0                	test   %eax,%eax
+f01060b2:	74 0d                	je     f01060c1 <perf_event_byname+0x40>
+	for (i = 0; i < NPERFEVENT; i++)
+f01060b4:	83 c6 01             	add    $0x1,%esi
+f01060b7:	83 fe 05             	cmp    $0x5,%esi
+f01060ba:	75 e1                	jne    f010609d <perf_event_byname+0x1c>
+	return -1;
+f01060bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+}
+f01060c1:	89 f0                	mov    %esi,%eax
+f01060c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01060c6:	5b                   	pop    %ebx
+f01060c7:	5e                   	pop    %esi
+f01060c8:	5f                   	pop    %edi
+f01060c9:	5d                   	pop    %ebp
+f01060ca:	c3                   	ret
+
+f01060cb <perf_event_name>:
+{
+f01060cb:	55                   	push   %ebp
+f01060cc:	89 e5                	mov    %esp,%ebp
+f01060ce:	e8 0b af ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f01060d3:	05 b9 f3 00 00       	add    $0xf3b9,%eax
+	return events[event].name;
+f01060d8:	8b 55 08             	mov    0x8(%ebp),%edx
+f01060db:	8b 84 d0 34 01 00 00 	mov    0x134(%eax,%edx,8),%eax
+}
+f01060e2:	5d                   	pop    %ebp
+f01060e3:	c3                   	ret
+
+f01060e4 <perf_print_info>:
+{
+f01060e4:	55                   	push   %ebp
+f01060e5:	89 e5                	mov    %esp,%ebp
+f01060e7:	57                   	push   %edi
+f01060e8:	56                   	push   %esi
+f01060e9:	53                   	push   %ebx
+f01060ea:	83 ec 1c             	sub    $0x1c,%esp
+f01060ed:	e8 5d a2 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01060f2:	81 c3 9a f3 00 00    	add    $0xf39a,%ebx
+	if (!pmu.version) {
+f01060f8:	8b 83 14 e7 03 00    	mov    0x3e714(%ebx),%eax
+f01060fe:	85 c0                	test   %eax,%eax
+f0106100:	0f 84 87 00 00 00    	je     f010618d <perf_print_info+0xa9>
+	cprintf("Performance monitoring version %d: %d counters of %d bits",
+f0106106:	ff b3 1c e7 03 00    	push   0x3e71c(%ebx)
+f010610c:	ff b3 18 e7 03 00    	push   0x3e718(%ebx)
+f0106112:	50                   	push   %eax
+f0106113:	8d 83 94 5e ff ff    	lea    -0xa16c(%ebx),%eax
+f0106119:	50                   	push   %eax
+f010611a:	e8 73 df ff ff       	call   f0104092 <cprintf>
+	if (pmu.nfixed)
+f010611f:	8b 83 20 e7 03 00    	mov    0x3e720(%ebx),%eax
+f0106125:	83 c4 10             	add    $0x10,%esp
+f0106128:	85 c0                	test   %eax,%eax
+f010612a:	75 75                	jne    f01061a1 <perf_print_info+0xbd>
+	cprintf("\n");
+f010612c:	83 ec 0c             	sub    $0xc,%esp
+f010612f:	8d 83 09 66 ff ff    	lea    -0x99f7(%ebx),%eax
+f0106135:	50                   	push   %eax
+f0106136:	e8 57 df ff ff       	call   f0104092 <cprintf>
+f010613b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPERFEVENT; i++)
+f010613e:	be 00 00 00 00       	mov    $0x0,%esi
+		cprintf("  %-14s %s\n", events[i].name,
+f0106143:	8d bb 8e 5d ff ff    	lea    -0xa272(%ebx),%edi
+f0106149:	8d 83 92 5d ff ff    	lea    -0xa26e(%ebx),%eax
+f010614f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			perf_can_count(i) ? "yes" : "not supported");
+f0106152:	83 ec 0c             	sub    $0xc,%esp
+f0106155:	56                   	push   %esi
+f0106156:	e8 f3 fe ff ff       	call   f010604e <perf_can_count>
+f010615b:	83 c4 0c             	add    $0xc,%esp
+		cprintf("  %-14s %s\n", events[i].name,
+f010615e:	84 c0                	test   %al,%al
+f0106160:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106163:	0f 45 c7             	cmovne %edi,%eax
+f0106166:	50                   	push   %eax
+f0106167:	ff b4 f3 34 01 00 00 	push   0x134(%ebx,%esi,8)
+f010616e:	8d 83 b6 5d ff ff    	lea    -0xa24a(%ebx),%eax
+f0106174:	50                   	push   %eax
+f0106175:	e8 18 df ff ff       	call   f0104092 <cprintf>
+	for (i = 0; i < NPERFEVENT; i++)
+f010617a:	83 c6 01             	add    $0x1,%esi
+f010617d:	83 c4 10             	add    $0x10,%esp
+f0106180:	83 fe 05             	cmp    $0x5,%esi
+f0106183:	75 cd                	jne    f0106152 <perf_print_info+0x6e>
+}
+f0106185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106188:	5b                   	pop    %ebx
+f0106189:	5e                   	pop    %esi
+f010618a:	5f                   	pop    %edi
+f010618b:	5d                   	pop    %ebp
+f010618c:	c3                   	ret
+		cprintf("No architectural performance counters\n");
+f010618d:	83 ec 0c             	sub    $0xc,%esp
+f0106190:	8d 83 6c 5e ff ff    	lea    -0xa194(%ebx),%eax
+f0106196:	50                   	push   %eax
+f0106197:	e8 f6 de ff ff       	call   f0104092 <cprintf>
+		return;
+f010619c:	83 c4 10             	add    $0x10,%esp
+f010619f:	eb e4                	jmp    f0106185 <perf_print_info+0xa1>
+		cprintf(", %d fixed of %d bits", pmu.nfixed, pmu.fixedbits);
+f01061a1:	83 ec 04             	sub    $0x4,%esp
+f01061a4:	ff b3 24 e7 03 00    	push   0x3e724(%ebx)
+f01061aa:	50                   	push   %eax
+f01061ab:	8d 83 a0 5d ff ff    	lea    -0xa260(%ebx),%eax
+f01061b1:	50                   	push   %eax
+f01061b2:	e8 db de ff ff       	call   f0104092 <cprintf>
+f01061b7:	83 c4 10             	add    $0x10,%esp
+f01061ba:	e9 6d ff ff ff       	jmp    f010612c <perf_print_info+0x48>
+
+f01061bf <perf_stat_start>:
+{
+f01061bf:	55                   	push   %ebp
+f01061c0:	89 e5                	mov    %esp,%ebp
+f01061c2:	57                   	push   %edi
+f01061c3:	56                   	push   %esi
+f01061c4:	53                   	push   %ebx
+f01061c5:	83 ec 2c             	sub    $0x2c,%esp
+f01061c8:	e8 82 a1 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01061cd:	81 c3 bf f2 00 00    	add    $0xf2bf,%ebx
+	if (stat_running || sample_period)
+f01061d3:	80 bb e4 e6 03 00 00 	cmpb   $0x0,0x3e6e4(%ebx)
+f01061da:	0f 85 d9 01 00 00    	jne    f01063b9 <perf_stat_start+0x1fa>
+f01061e0:	8b 83 d4 e6 03 00    	mov    0x3e6d4(%ebx),%eax
+f01061e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01061e9:	85 c0                	test   %eax,%eax
+f01061eb:	0f 85 cf 01 00 00    	jne    f01063c0 <perf_stat_start+0x201>
+	pmu_disable();
+f01061f1:	e8 c6 fb ff ff       	call   f0105dbc <pmu_disable>
+		gpevent[i] = -1;
+f01061f6:	c7 83 f4 e6 03 00 ff 	movl   $0xffffffff,0x3e6f4(%ebx)
+f01061fd:	ff ff ff 
+f0106200:	c7 83 f8 e6 03 00 ff 	movl   $0xffffffff,0x3e6f8(%ebx)
+f0106207:	ff ff ff 
+f010620a:	c7 83 fc e6 03 00 ff 	movl   $0xffffffff,0x3e6fc(%ebx)
+f0106211:	ff ff ff 
+f0106214:	c7 83 00 e7 03 00 ff 	movl   $0xffffffff,0x3e700(%ebx)
+f010621b:	ff ff ff 
+f010621e:	c7 83 04 e7 03 00 ff 	movl   $0xffffffff,0x3e704(%ebx)
+f0106225:	ff ff ff 
+f0106228:	c7 83 08 e7 03 00 ff 	movl   $0xffffffff,0x3e708(%ebx)
+f010622f:	ff ff ff 
+f0106232:	c7 83 0c e7 03 00 ff 	movl   $0xffffffff,0x3e70c(%ebx)
+f0106239:	ff ff ff 
+f010623c:	c7 83 10 e7 03 00 ff 	movl   $0xffffffff,0x3e710(%ebx)
+f0106243:	ff ff ff 
+		fixedevent[i] = -1;
+f0106246:	c7 83 e8 e6 03 00 ff 	movl   $0xffffffff,0x3e6e8(%ebx)
+f010624d:	ff ff ff 
+f0106250:	c7 83 ec e6 03 00 ff 	movl   $0xffffffff,0x3e6ec(%ebx)
+f0106257:	ff ff ff 
+f010625a:	c7 83 f0 e6 03 00 ff 	movl   $0xffffffff,0x3e6f0(%ebx)
+f0106261:	ff ff ff 
+		if ((i = events[ev].fixed) >= 0 && i < pmu.nfixed) {
+f0106264:	8b 83 20 e7 03 00    	mov    0x3e720(%ebx),%eax
+f010626a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		} else if (gp < pmu.ngp) {
+f010626d:	8b 83 18 e7 03 00    	mov    0x3e718(%ebx),%eax
+f0106273:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	int ev, i, gp = 0;
+f0106276:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (ev = 0; ev < NPERFEVENT; ev++) {
+f010627d:	bf 00 00 00 00       	mov    $0x0,%edi
+	uint64_t global = 0;
+f0106282:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+f0106289:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+			gpevent[gp] = ev;
+f0106290:	8d 83 f4 e6 03 00    	lea    0x3e6f4(%ebx),%eax
+f0106296:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f0106299:	eb 60                	jmp    f01062fb <perf_stat_start+0x13c>
+		} else if (gp < pmu.ngp) {
+f010629b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f010629e:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+f01062a1:	7e 50                	jle    f01062f3 <perf_stat_start+0x134>
+			gpevent[gp] = ev;
+f01062a3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01062a6:	89 3c b0             	mov    %edi,(%eax,%esi,4)
+			wrmsr(MSR_PMC0 + gp, 0);
+f01062a9:	8d 8e c1 00 00 00    	lea    0xc1(%esi),%ecx
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f01062af:	b8 00 00 00 00       	mov    $0x0,%eax
+f01062b4:	ba 00 00 00 00       	mov    $0x0,%edx
+f01062b9:	0f 30                	wrmsr
+			wrmsr(MSR_PERFEVTSEL0 + gp, events[ev].evsel
+f01062bb:	8d 8e 86 01 00 00    	lea    0x186(%esi),%ecx
+f01062c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01062c4:	0f b7 84 c3 38 01 00 	movzwl 0x138(%ebx,%eax,8),%eax
+f01062cb:	00 
+			      | EVTSEL_USR | EVTSEL_OS | EVTSEL_EN);
+f01062cc:	0d 00 00 43 00       	or     $0x430000,%eax
+			wrmsr(MSR_PERFEVTSEL0 + gp, events[ev].evsel
+f01062d1:	99                   	cltd
+f01062d2:	0f 30                	wrmsr
+			global |= 1ULL << gp;
+f01062d4:	89 f1                	mov    %esi,%ecx
+f01062d6:	31 c0                	xor    %eax,%eax
+f01062d8:	31 d2                	xor    %edx,%edx
+f01062da:	f6 c1 20             	test   $0x20,%cl
+f01062dd:	0f 94 c0             	sete   %al
+f01062e0:	0f 95 c2             	setne  %dl
+f01062e3:	d3 e0                	shl    %cl,%eax
+f01062e5:	d3 e2                	shl    %cl,%edx
+f01062e7:	09 45 d8             	or     %eax,-0x28(%ebp)
+f01062ea:	09 55 dc             	or     %edx,-0x24(%ebp)
+			gp++;
+f01062ed:	83 c6 01             	add    $0x1,%esi
+f01062f0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+	for (ev = 0; ev < NPERFEVENT; ev++) {
+f01062f3:	83 c7 01             	add    $0x1,%edi
+f01062f6:	83 ff 05             	cmp    $0x5,%edi
+f01062f9:	74 6e                	je     f0106369 <perf_stat_start+0x1aa>
+		if (!perf_can_count(ev))
+f01062fb:	83 ec 0c             	sub    $0xc,%esp
+f01062fe:	57                   	push   %edi
+f01062ff:	e8 4a fd ff ff       	call   f010604e <perf_can_count>
+f0106304:	83 c4 10             	add    $0x10,%esp
+f0106307:	84 c0                	test   %al,%al
+f0106309:	74 e8                	je     f01062f3 <perf_stat_start+0x134>
+f010630b:	89 7d e0             	mov    %edi,-0x20(%ebp)
+		if ((i = events[ev].fixed) >= 0 && i < pmu.nfixed) {
+f010630e:	0f be b4 fb 3b 01 00 	movsbl 0x13b(%ebx,%edi,8),%esi
+f0106315:	00 
+f0106316:	85 f6                	test   %esi,%esi
+f0106318:	78 81                	js     f010629b <perf_stat_start+0xdc>
+f010631a:	39 75 cc             	cmp    %esi,-0x34(%ebp)
+f010631d:	0f 8e 78 ff ff ff    	jle    f010629b <perf_stat_start+0xdc>
+			fixedevent[i] = ev;
+f0106323:	89 bc b3 e8 e6 03 00 	mov    %edi,0x3e6e8(%ebx,%esi,4)
+			wrmsr(MSR_FIXED_CTR0 + i, 0);
+f010632a:	8d 8e 09 03 00 00    	lea    0x309(%esi),%ecx
+f0106330:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106335:	ba 00 00 00 00       	mov    $0x0,%edx
+f010633a:	0f 30                	wrmsr
+			fixedctrl |= FIXED_OS_USR << (4 * i);
+f010633c:	8d 0c b5 00 00 00 00 	lea    0x0(,%esi,4),%ecx
+f0106343:	b8 03 00 00 00       	mov    $0x3,%eax
+f0106348:	d3 e0                	shl    %cl,%eax
+f010634a:	09 45 d0             	or     %eax,-0x30(%ebp)
+			global |= 1ULL << (32 + i);
+f010634d:	8d 4e 20             	lea    0x20(%esi),%ecx
+f0106350:	31 c0                	xor    %eax,%eax
+f0106352:	31 d2                	xor    %edx,%edx
+f0106354:	f6 c1 20             	test   $0x20,%cl
+f0106357:	0f 94 c0             	sete   %al
+f010635a:	0f 95 c2             	setne  %dl
+f010635d:	d3 e0                	shl    %cl,%eax
+f010635f:	d3 e2                	shl    %cl,%edx
+f0106361:	09 45 d8             	or     %eax,-0x28(%ebp)
+f0106364:	09 55 dc             	or     %edx,-0x24(%ebp)
+f0106367:	eb 8a                	jmp    f01062f3 <perf_stat_start+0x134>
+	if (fixedctrl)
+f0106369:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010636c:	85 c0                	test   %eax,%eax
+f010636e:	74 0c                	je     f010637c <perf_stat_start+0x1bd>
+		wrmsr(MSR_FIXED_CTR_CTRL, fixedctrl);
+f0106370:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106375:	b9 8d 03 00 00       	mov    $0x38d,%ecx
+f010637a:	0f 30                	wrmsr
+	stat_running = 1;
+f010637c:	c6 83 e4 e6 03 00 01 	movb   $0x1,0x3e6e4(%ebx)
+	asm volatile("rdtsc" : "=A" (tsc));
+f0106383:	0f 31                	rdtsc
+	stat_tsc = read_tsc();
+f0106385:	89 83 dc e6 03 00    	mov    %eax,0x3e6dc(%ebx)
+f010638b:	89 93 e0 e6 03 00    	mov    %edx,0x3e6e0(%ebx)
+	return 0;
+f0106391:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pmu.version >= 2)
+f0106396:	83 bb 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%ebx)
+f010639d:	7e 12                	jle    f01063b1 <perf_stat_start+0x1f2>
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f010639f:	b9 8f 03 00 00       	mov    $0x38f,%ecx
+f01063a4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01063a7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01063aa:	0f 30                	wrmsr
+	return 0;
+f01063ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01063b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01063b4:	5b                   	pop    %ebx
+f01063b5:	5e                   	pop    %esi
+f01063b6:	5f                   	pop    %edi
+f01063b7:	5d                   	pop    %ebp
+f01063b8:	c3                   	ret
+		return -E_INVAL;
+f01063b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01063be:	eb f1                	jmp    f01063b1 <perf_stat_start+0x1f2>
+f01063c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01063c5:	eb ea                	jmp    f01063b1 <perf_stat_start+0x1f2>
+
+f01063c7 <perf_stat_stop>:
+{
+f01063c7:	55                   	push   %ebp
+f01063c8:	89 e5                	mov    %esp,%ebp
+f01063ca:	57                   	push   %edi
+f01063cb:	56                   	push   %esi
+f01063cc:	53                   	push   %ebx
+f01063cd:	83 ec 2c             	sub    $0x2c,%esp
+f01063d0:	e8 15 ac ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f01063d5:	81 c6 b7 f0 00 00    	add    $0xf0b7,%esi
+f01063db:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01063de:	8b 7d 08             	mov    0x8(%ebp),%edi
+	pmu_disable();
+f01063e1:	e8 d6 f9 ff ff       	call   f0105dbc <pmu_disable>
+	asm volatile("rdtsc" : "=A" (tsc));
+f01063e6:	0f 31                	rdtsc
+	ps->ps_tsc = read_tsc() - stat_tsc;
+f01063e8:	2b 86 dc e6 03 00    	sub    0x3e6dc(%esi),%eax
+f01063ee:	1b 96 e0 e6 03 00    	sbb    0x3e6e0(%esi),%edx
+f01063f4:	89 07                	mov    %eax,(%edi)
+f01063f6:	89 57 04             	mov    %edx,0x4(%edi)
+	ps->ps_counted = 0;
+f01063f9:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+	for (i = 0; i < pmu.ngp; i++)
+f0106400:	8b 96 18 e7 03 00    	mov    0x3e718(%esi),%edx
+f0106406:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			ps->ps_count[gpevent[i]] = rdmsr(MSR_PMC0 + i) & pmu.gpmask;
+f0106409:	8b 96 28 e7 03 00    	mov    0x3e728(%esi),%edx
+f010640f:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f0106412:	8b 86 2c e7 03 00    	mov    0x3e72c(%esi),%eax
+f0106418:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < pmu.ngp; i++)
+f010641b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106420:	eb 2f                	jmp    f0106451 <perf_stat_stop+0x8a>
+	asm volatile("rdmsr" : "=A" (val) : "c" (msr));
+f0106422:	8d 8b c1 00 00 00    	lea    0xc1(%ebx),%ecx
+f0106428:	0f 32                	rdmsr
+			ps->ps_count[gpevent[i]] = rdmsr(MSR_PMC0 + i) & pmu.gpmask;
+f010642a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010642d:	21 c1                	and    %eax,%ecx
+f010642f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106432:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0106435:	21 d1                	and    %edx,%ecx
+f0106437:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010643a:	89 54 f7 0c          	mov    %edx,0xc(%edi,%esi,8)
+f010643e:	89 4c f7 10          	mov    %ecx,0x10(%edi,%esi,8)
+			ps->ps_counted |= 1 << gpevent[i];
+f0106442:	b8 01 00 00 00       	mov    $0x1,%eax
+f0106447:	89 f1                	mov    %esi,%ecx
+f0106449:	d3 e0                	shl    %cl,%eax
+f010644b:	09 47 08             	or     %eax,0x8(%edi)
+	for (i = 0; i < pmu.ngp; i++)
+f010644e:	83 c3 01             	add    $0x1,%ebx
+f0106451:	39 5d e0             	cmp    %ebx,-0x20(%ebp)
+f0106454:	7e 10                	jle    f0106466 <perf_stat_stop+0x9f>
+		if (gpevent[i] >= 0) {
+f0106456:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106459:	8b b4 98 f4 e6 03 00 	mov    0x3e6f4(%eax,%ebx,4),%esi
+f0106460:	85 f6                	test   %esi,%esi
+f0106462:	79 be                	jns    f0106422 <perf_stat_stop+0x5b>
+f0106464:	eb e8                	jmp    f010644e <perf_stat_stop+0x87>
+	for (i = 0; i < pmu.nfixed; i++)
+f0106466:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106469:	8b 90 20 e7 03 00    	mov    0x3e720(%eax),%edx
+f010646f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+				rdmsr(MSR_FIXED_CTR0 + i) & pmu.fixedmask;
+f0106472:	8b 90 30 e7 03 00    	mov    0x3e730(%eax),%edx
+f0106478:	89 55 d8             	mov    %edx,-0x28(%ebp)
+f010647b:	8b 80 34 e7 03 00    	mov    0x3e734(%eax),%eax
+f0106481:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	for (i = 0; i < pmu.nfixed; i++)
+f0106484:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106489:	eb 03                	jmp    f010648e <perf_stat_stop+0xc7>
+f010648b:	83 c3 01             	add    $0x1,%ebx
+f010648e:	39 5d e0             	cmp    %ebx,-0x20(%ebp)
+f0106491:	7e 3c                	jle    f01064cf <perf_stat_stop+0x108>
+		if (fixedevent[i] >= 0) {
+f0106493:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106496:	8b b4 98 e8 e6 03 00 	mov    0x3e6e8(%eax,%ebx,4),%esi
+f010649d:	85 f6                	test   %esi,%esi
+f010649f:	78 ea                	js     f010648b <perf_stat_stop+0xc4>
+f01064a1:	8d 8b 09 03 00 00    	lea    0x309(%ebx),%ecx
+f01064a7:	0f 32                	rdmsr
+				rdmsr(MSR_FIXED_CTR0 + i) & pmu.fixedmask;
+f01064a9:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f01064ac:	21 c1                	and    %eax,%ecx
+f01064ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01064b1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f01064b4:	21 d1                	and    %edx,%ecx
+f01064b6:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01064b9:	89 54 f7 0c          	mov    %edx,0xc(%edi,%esi,8)
+f01064bd:	89 4c f7 10          	mov    %ecx,0x10(%edi,%esi,8)
+			ps->ps_counted |= 1 << fixedevent[i];
+f01064c1:	b8 01 00 00 00       	mov    $0x1,%eax
+f01064c6:	89 f1                	mov    %esi,%ecx
+f01064c8:	d3 e0                	shl    %cl,%eax
+f01064ca:	09 47 08             	or     %eax,0x8(%edi)
+f01064cd:	eb bc                	jmp    f010648b <perf_stat_stop+0xc4>
+	stat_running = 0;
+f01064cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01064d2:	c6 80 e4 e6 03 00 00 	movb   $0x0,0x3e6e4(%eax)
+}
+f01064d9:	83 c4 2c             	add    $0x2c,%esp
+f01064dc:	5b                   	pop    %ebx
+f01064dd:	5e                   	pop    %esi
+f01064de:	5f                   	pop    %edi
+f01064df:	5d                   	pop    %ebp
+f01064e0:	c3                   	ret
+
+f01064e1 <perf_stat_print>:
+{
+f01064e1:	55                   	push   %ebp
+f01064e2:	89 e5                	mov    %esp,%ebp
+f01064e4:	57                   	push   %edi
+f01064e5:	56                   	push   %esi
+f01064e6:	53                   	push   %ebx
+f01064e7:	83 ec 3c             	sub    $0x3c,%esp
+f01064ea:	e8 ff aa ff ff       	call   f0100fee <__x86.get_pc_thunk.di>
+f01064ef:	81 c7 9d ef 00 00    	add    $0xef9d,%edi
+	if (ps->ps_counted & (1 << PERF_CYCLES))
+f01064f5:	8b 45 08             	mov    0x8(%ebp),%eax
+f01064f8:	8b 40 08             	mov    0x8(%eax),%eax
+	uint64_t cycles = 0, instrs = 0, x;
+f01064fb:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+f0106502:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+	if (ps->ps_counted & (1 << PERF_CYCLES))
+f0106509:	a8 01                	test   $0x1,%al
+f010650b:	74 0f                	je     f010651c <perf_stat_print+0x3b>
+		cycles = ps->ps_count[PERF_CYCLES];
+f010650d:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106510:	8b 5e 0c             	mov    0xc(%esi),%ebx
+f0106513:	8b 76 10             	mov    0x10(%esi),%esi
+f0106516:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0106519:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+	uint64_t cycles = 0, instrs = 0, x;
+f010651c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0106523:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	if (ps->ps_counted & (1 << PERF_INSTRS))
+f010652a:	a8 02                	test   $0x2,%al
+f010652c:	74 0f                	je     f010653d <perf_stat_print+0x5c>
+		instrs = ps->ps_count[PERF_INSTRS];
+f010652e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106531:	8b 50 18             	mov    0x18(%eax),%edx
+f0106534:	8b 40 14             	mov    0x14(%eax),%eax
+f0106537:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010653a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (i = 0; i < NPERFEVENT; i++) {
+f010653d:	be 00 00 00 00       	mov    $0x0,%esi
+		} else if (i != PERF_CYCLES && instrs) {
+f0106542:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106545:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0106548:	89 c1                	mov    %eax,%ecx
+f010654a:	09 d1                	or     %edx,%ecx
+f010654c:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+		if (i == PERF_INSTRS && cycles) {
+f010654f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0106552:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0106555:	89 c3                	mov    %eax,%ebx
+f0106557:	09 d3                	or     %edx,%ebx
+f0106559:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f010655c:	e9 3c 02 00 00       	jmp    f010679d <perf_stat_print+0x2bc>
+f0106561:	89 75 d8             	mov    %esi,-0x28(%ebp)
+		cprintf("  %14llu  %s", ps->ps_count[i], events[i].name);
+f0106564:	ff b4 f7 34 01 00 00 	push   0x134(%edi,%esi,8)
+f010656b:	8b 45 08             	mov    0x8(%ebp),%eax
+f010656e:	ff 74 f0 10          	push   0x10(%eax,%esi,8)
+f0106572:	ff 74 f0 0c          	push   0xc(%eax,%esi,8)
+f0106576:	8d 87 ec 5d ff ff    	lea    -0xa214(%edi),%eax
+f010657c:	50                   	push   %eax
+f010657d:	89 fb                	mov    %edi,%ebx
+f010657f:	e8 0e db ff ff       	call   f0104092 <cprintf>
+		if (i == PERF_INSTRS && cycles) {
+f0106584:	83 c4 10             	add    $0x10,%esp
+f0106587:	83 fe 01             	cmp    $0x1,%esi
+f010658a:	75 0a                	jne    f0106596 <perf_stat_print+0xb5>
+f010658c:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+f0106590:	0f 85 09 01 00 00    	jne    f010669f <perf_stat_print+0x1be>
+		} else if (i != PERF_CYCLES && instrs) {
+f0106596:	85 f6                	test   %esi,%esi
+f0106598:	0f 84 e3 01 00 00    	je     f0106781 <perf_stat_print+0x2a0>
+f010659e:	83 7d bc 00          	cmpl   $0x0,-0x44(%ebp)
+f01065a2:	0f 84 d9 01 00 00    	je     f0106781 <perf_stat_print+0x2a0>
+			x = ps->ps_count[i] * 100000 / instrs;
+f01065a8:	8b 45 08             	mov    0x8(%ebp),%eax
+f01065ab:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f01065ae:	69 4c d8 10 a0 86 01 	imul   $0x186a0,0x10(%eax,%ebx,8),%ecx
+f01065b5:	00 
+f01065b6:	b8 a0 86 01 00       	mov    $0x186a0,%eax
+f01065bb:	8b 55 08             	mov    0x8(%ebp),%edx
+f01065be:	f7 64 da 0c          	mull   0xc(%edx,%ebx,8)
+f01065c2:	01 ca                	add    %ecx,%edx
+f01065c4:	ff 75 e4             	push   -0x1c(%ebp)
+f01065c7:	ff 75 e0             	push   -0x20(%ebp)
+f01065ca:	52                   	push   %edx
+f01065cb:	50                   	push   %eax
+f01065cc:	89 fb                	mov    %edi,%ebx
+f01065ce:	e8 0b 34 00 00       	call   f01099de <__udivdi3>
+			cprintf("  # %llu.%02llu per 1000 instructions",
+f01065d3:	89 c3                	mov    %eax,%ebx
+f01065d5:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f01065db:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01065de:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01065e1:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+f01065e5:	c1 ea 14             	shr    $0x14,%edx
+f01065e8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01065ed:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+f01065f0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01065f3:	c1 ea 08             	shr    $0x8,%edx
+f01065f6:	89 d0                	mov    %edx,%eax
+f01065f8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01065fd:	01 c1                	add    %eax,%ecx
+f01065ff:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0106602:	c1 e8 1c             	shr    $0x1c,%eax
+f0106605:	01 c1                	add    %eax,%ecx
+f0106607:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+f010660c:	89 c8                	mov    %ecx,%eax
+f010660e:	f7 e2                	mul    %edx
+f0106610:	c1 ea 03             	shr    $0x3,%edx
+f0106613:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f0106616:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106619:	29 c1                	sub    %eax,%ecx
+f010661b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106620:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0106623:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0106626:	29 c8                	sub    %ecx,%eax
+f0106628:	19 da                	sbb    %ebx,%edx
+f010662a:	89 c1                	mov    %eax,%ecx
+f010662c:	89 d3                	mov    %edx,%ebx
+f010662e:	69 d2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%edx
+f0106634:	69 c0 f5 28 5c 8f    	imul   $0x8f5c28f5,%eax,%eax
+f010663a:	01 c2                	add    %eax,%edx
+f010663c:	89 55 c8             	mov    %edx,-0x38(%ebp)
+f010663f:	b8 29 5c 8f c2       	mov    $0xc28f5c29,%eax
+f0106644:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0106647:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f010664a:	f7 65 c0             	mull   -0x40(%ebp)
+f010664d:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0106650:	01 da                	add    %ebx,%edx
+f0106652:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+f0106656:	c1 ea 02             	shr    $0x2,%edx
+f0106659:	6b ca 64             	imul   $0x64,%edx,%ecx
+f010665c:	bb 64 00 00 00       	mov    $0x64,%ebx
+f0106661:	f7 e3                	mul    %ebx
+f0106663:	01 ca                	add    %ecx,%edx
+f0106665:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0106668:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f010666b:	29 c1                	sub    %eax,%ecx
+f010666d:	19 d3                	sbb    %edx,%ebx
+f010666f:	89 1c 24             	mov    %ebx,(%esp)
+f0106672:	51                   	push   %ecx
+f0106673:	b8 29 5c 8f c2       	mov    $0xc28f5c29,%eax
+f0106678:	f7 65 c0             	mull   -0x40(%ebp)
+f010667b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f010667e:	01 da                	add    %ebx,%edx
+f0106680:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+f0106684:	c1 ea 02             	shr    $0x2,%edx
+f0106687:	52                   	push   %edx
+f0106688:	50                   	push   %eax
+f0106689:	8d 87 d0 5e ff ff    	lea    -0xa130(%edi),%eax
+f010668f:	50                   	push   %eax
+f0106690:	89 fb                	mov    %edi,%ebx
+f0106692:	e8 fb d9 ff ff       	call   f0104092 <cprintf>
+f0106697:	83 c4 20             	add    $0x20,%esp
+f010669a:	e9 e2 00 00 00       	jmp    f0106781 <perf_stat_print+0x2a0>
+			x = instrs * 100 / cycles;
+f010669f:	6b 4d e4 64          	imul   $0x64,-0x1c(%ebp),%ecx
+f01066a3:	b8 64 00 00 00       	mov    $0x64,%eax
+f01066a8:	f7 65 e0             	mull   -0x20(%ebp)
+f01066ab:	01 ca                	add    %ecx,%edx
+f01066ad:	ff 75 d4             	push   -0x2c(%ebp)
+f01066b0:	ff 75 d0             	push   -0x30(%ebp)
+f01066b3:	52                   	push   %edx
+f01066b4:	50                   	push   %eax
+f01066b5:	e8 24 33 00 00       	call   f01099de <__udivdi3>
+			cprintf("  # %llu.%02llu per cycle", x / 100, x % 100);
+f01066ba:	89 c3                	mov    %eax,%ebx
+f01066bc:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f01066c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01066c5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01066c8:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+f01066cc:	c1 ea 14             	shr    $0x14,%edx
+f01066cf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01066d4:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+f01066d7:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f01066da:	c1 eb 08             	shr    $0x8,%ebx
+f01066dd:	89 d8                	mov    %ebx,%eax
+f01066df:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01066e4:	01 c1                	add    %eax,%ecx
+f01066e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01066e9:	c1 e8 1c             	shr    $0x1c,%eax
+f01066ec:	01 c1                	add    %eax,%ecx
+f01066ee:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+f01066f3:	89 c8                	mov    %ecx,%eax
+f01066f5:	f7 e2                	mul    %edx
+f01066f7:	c1 ea 03             	shr    $0x3,%edx
+f01066fa:	8d 04 92             	lea    (%edx,%edx,4),%eax
+f01066fd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106700:	29 c1                	sub    %eax,%ecx
+f0106702:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106707:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010670a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f010670d:	29 c8                	sub    %ecx,%eax
+f010670f:	19 da                	sbb    %ebx,%edx
+f0106711:	89 c1                	mov    %eax,%ecx
+f0106713:	89 d3                	mov    %edx,%ebx
+f0106715:	69 d2 29 5c 8f c2    	imul   $0xc28f5c29,%edx,%edx
+f010671b:	69 c0 f5 28 5c 8f    	imul   $0x8f5c28f5,%eax,%eax
+f0106721:	01 c2                	add    %eax,%edx
+f0106723:	89 55 c8             	mov    %edx,-0x38(%ebp)
+f0106726:	b8 29 5c 8f c2       	mov    $0xc28f5c29,%eax
+f010672b:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f010672e:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+f0106731:	f7 65 c0             	mull   -0x40(%ebp)
+f0106734:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0106737:	01 da                	add    %ebx,%edx
+f0106739:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+f010673d:	c1 ea 02             	shr    $0x2,%edx
+f0106740:	6b ca 64             	imul   $0x64,%edx,%ecx
+f0106743:	bb 64 00 00 00       	mov    $0x64,%ebx
+f0106748:	f7 e3                	mul    %ebx
+f010674a:	01 ca                	add    %ecx,%edx
+f010674c:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f010674f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+f0106752:	29 c1                	sub    %eax,%ecx
+f0106754:	19 d3                	sbb    %edx,%ebx
+f0106756:	89 1c 24             	mov    %ebx,(%esp)
+f0106759:	51                   	push   %ecx
+f010675a:	b8 29 5c 8f c2       	mov    $0xc28f5c29,%eax
+f010675f:	f7 65 c0             	mull   -0x40(%ebp)
+f0106762:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0106765:	01 da                	add    %ebx,%edx
+f0106767:	0f ac d0 02          	shrd   $0x2,%edx,%eax
+f010676b:	c1 ea 02             	shr    $0x2,%edx
+f010676e:	52                   	push   %edx
+f010676f:	50                   	push   %eax
+f0106770:	8d 87 f9 5d ff ff    	lea    -0xa207(%edi),%eax
+f0106776:	50                   	push   %eax
+f0106777:	89 fb                	mov    %edi,%ebx
+f0106779:	e8 14 d9 ff ff       	call   f0104092 <cprintf>
+f010677e:	83 c4 20             	add    $0x20,%esp
+		cprintf("\n");
+f0106781:	83 ec 0c             	sub    $0xc,%esp
+f0106784:	8d 87 09 66 ff ff    	lea    -0x99f7(%edi),%eax
+f010678a:	50                   	push   %eax
+f010678b:	89 fb                	mov    %edi,%ebx
+f010678d:	e8 00 d9 ff ff       	call   f0104092 <cprintf>
+f0106792:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPERFEVENT; i++) {
+f0106795:	83 c6 01             	add    $0x1,%esi
+f0106798:	83 fe 05             	cmp    $0x5,%esi
+f010679b:	74 4e                	je     f01067eb <perf_stat_print+0x30a>
+		if (!(ps->ps_counted & (1 << i))) {
+f010679d:	b8 01 00 00 00       	mov    $0x1,%eax
+f01067a2:	89 f1                	mov    %esi,%ecx
+f01067a4:	d3 e0                	shl    %cl,%eax
+f01067a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01067a9:	23 43 08             	and    0x8(%ebx),%eax
+f01067ac:	0f 85 af fd ff ff    	jne    f0106561 <perf_stat_print+0x80>
+				events[i].name);
+f01067b2:	8b 9c f7 34 01 00 00 	mov    0x134(%edi,%esi,8),%ebx
+			cprintf("  %14s  %s\n", perf_can_count(i)
+f01067b9:	83 ec 0c             	sub    $0xc,%esp
+f01067bc:	56                   	push   %esi
+f01067bd:	e8 8c f8 ff ff       	call   f010604e <perf_can_count>
+f01067c2:	83 c4 0c             	add    $0xc,%esp
+f01067c5:	84 c0                	test   %al,%al
+f01067c7:	8d 87 d0 5d ff ff    	lea    -0xa230(%edi),%eax
+f01067cd:	8d 97 c2 5d ff ff    	lea    -0xa23e(%edi),%edx
+f01067d3:	0f 45 c2             	cmovne %edx,%eax
+f01067d6:	53                   	push   %ebx
+f01067d7:	50                   	push   %eax
+f01067d8:	8d 87 e0 5d ff ff    	lea    -0xa220(%edi),%eax
+f01067de:	50                   	push   %eax
+f01067df:	89 fb                	mov    %edi,%ebx
+f01067e1:	e8 ac d8 ff ff       	call   f0104092 <cprintf>
+			continue;
+f01067e6:	83 c4 10             	add    $0x10,%esp
+f01067e9:	eb aa                	jmp    f0106795 <perf_stat_print+0x2b4>
+	cprintf("  %14llu  TSC ticks elapsed\n", ps->ps_tsc);
+f01067eb:	83 ec 04             	sub    $0x4,%esp
+f01067ee:	8b 45 08             	mov    0x8(%ebp),%eax
+f01067f1:	ff 70 04             	push   0x4(%eax)
+f01067f4:	ff 30                	push   (%eax)
+f01067f6:	8d 87 13 5e ff ff    	lea    -0xa1ed(%edi),%eax
+f01067fc:	50                   	push   %eax
+f01067fd:	89 fb                	mov    %edi,%ebx
+f01067ff:	e8 8e d8 ff ff       	call   f0104092 <cprintf>
+}
+f0106804:	83 c4 10             	add    $0x10,%esp
+f0106807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010680a:	5b                   	pop    %ebx
+f010680b:	5e                   	pop    %esi
+f010680c:	5f                   	pop    %edi
+f010680d:	5d                   	pop    %ebp
+f010680e:	c3                   	ret
+
+f010680f <perf_sample_start>:
+{
+f010680f:	55                   	push   %ebp
+f0106810:	89 e5                	mov    %esp,%ebp
+f0106812:	57                   	push   %edi
+f0106813:	56                   	push   %esi
+f0106814:	53                   	push   %ebx
+f0106815:	83 ec 18             	sub    $0x18,%esp
+f0106818:	e8 32 9b ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010681d:	81 c3 6f ec 00 00    	add    $0xec6f,%ebx
+	if (!perf_can_count(event) || period == 0 || period > 0x7FFFFFFF
+f0106823:	ff 75 08             	push   0x8(%ebp)
+f0106826:	e8 23 f8 ff ff       	call   f010604e <perf_can_count>
+f010682b:	83 c4 10             	add    $0x10,%esp
+f010682e:	84 c0                	test   %al,%al
+f0106830:	0f 84 c4 00 00 00    	je     f01068fa <perf_sample_start+0xeb>
+f0106836:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f010683a:	0f 8e c1 00 00 00    	jle    f0106901 <perf_sample_start+0xf2>
+	    || stat_running || sample_period)
+f0106840:	80 bb e4 e6 03 00 00 	cmpb   $0x0,0x3e6e4(%ebx)
+f0106847:	0f 85 bb 00 00 00    	jne    f0106908 <perf_sample_start+0xf9>
+f010684d:	83 bb d4 e6 03 00 00 	cmpl   $0x0,0x3e6d4(%ebx)
+f0106854:	0f 85 b5 00 00 00    	jne    f010690f <perf_sample_start+0x100>
+	pmu_disable();
+f010685a:	e8 5d f5 ff ff       	call   f0105dbc <pmu_disable>
+	if (lapic_perfint(1) < 0)
+f010685f:	83 ec 0c             	sub    $0xc,%esp
+f0106862:	6a 01                	push   $0x1
+f0106864:	e8 fd 1f 00 00       	call   f0108866 <lapic_perfint>
+f0106869:	83 c4 10             	add    $0x10,%esp
+f010686c:	85 c0                	test   %eax,%eax
+f010686e:	0f 88 a2 00 00 00    	js     f0106916 <perf_sample_start+0x107>
+	sample_cpu = cpunum();
+f0106874:	e8 46 20 00 00       	call   f01088bf <cpunum>
+f0106879:	89 83 c4 ff ff ff    	mov    %eax,-0x3c(%ebx)
+	sample_period = period;
+f010687f:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106882:	89 83 d4 e6 03 00    	mov    %eax,0x3e6d4(%ebx)
+	wrmsr(MSR_PMC0, -(uint64_t) period & pmu.gpmask);
+f0106888:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010688b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106890:	f7 d8                	neg    %eax
+f0106892:	83 d2 00             	adc    $0x0,%edx
+f0106895:	f7 da                	neg    %edx
+f0106897:	89 c1                	mov    %eax,%ecx
+f0106899:	23 8b 28 e7 03 00    	and    0x3e728(%ebx),%ecx
+f010689f:	89 ce                	mov    %ecx,%esi
+f01068a1:	89 d0                	mov    %edx,%eax
+f01068a3:	23 83 2c e7 03 00    	and    0x3e72c(%ebx),%eax
+f01068a9:	89 c7                	mov    %eax,%edi
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f01068ab:	b9 c1 00 00 00       	mov    $0xc1,%ecx
+f01068b0:	89 f0                	mov    %esi,%eax
+f01068b2:	89 fa                	mov    %edi,%edx
+f01068b4:	0f 30                	wrmsr
+	wrmsr(MSR_PERFEVTSEL0, events[event].evsel | EVTSEL_USR
+f01068b6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01068b9:	0f b7 84 c3 38 01 00 	movzwl 0x138(%ebx,%eax,8),%eax
+f01068c0:	00 
+	      | EVTSEL_OS | EVTSEL_INT | EVTSEL_EN);
+f01068c1:	0d 00 00 53 00       	or     $0x530000,%eax
+	wrmsr(MSR_PERFEVTSEL0, events[event].evsel | EVTSEL_USR
+f01068c6:	99                   	cltd
+f01068c7:	b9 86 01 00 00       	mov    $0x186,%ecx
+f01068cc:	0f 30                	wrmsr
+	return 0;
+f01068ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pmu.version >= 2)
+f01068d3:	83 bb 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%ebx)
+f01068da:	7e 16                	jle    f01068f2 <perf_sample_start+0xe3>
+f01068dc:	b9 8f 03 00 00       	mov    $0x38f,%ecx
+f01068e1:	b8 01 00 00 00       	mov    $0x1,%eax
+f01068e6:	ba 00 00 00 00       	mov    $0x0,%edx
+f01068eb:	0f 30                	wrmsr
+	return 0;
+f01068ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01068f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01068f5:	5b                   	pop    %ebx
+f01068f6:	5e                   	pop    %esi
+f01068f7:	5f                   	pop    %edi
+f01068f8:	5d                   	pop    %ebp
+f01068f9:	c3                   	ret
+		return -E_INVAL;
+f01068fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01068ff:	eb f1                	jmp    f01068f2 <perf_sample_start+0xe3>
+f0106901:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106906:	eb ea                	jmp    f01068f2 <perf_sample_start+0xe3>
+f0106908:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010690d:	eb e3                	jmp    f01068f2 <perf_sample_start+0xe3>
+f010690f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106914:	eb dc                	jmp    f01068f2 <perf_sample_start+0xe3>
+		return -E_INVAL;
+f0106916:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010691b:	eb d5                	jmp    f01068f2 <perf_sample_start+0xe3>
+
+f010691d <perf_sample_stop>:
+
+// Must run on the CPU that called perf_sample_start().
+void
+perf_sample_stop(void)
+{
+f010691d:	55                   	push   %ebp
+f010691e:	89 e5                	mov    %esp,%ebp
+f0106920:	53                   	push   %ebx
+f0106921:	83 ec 04             	sub    $0x4,%esp
+f0106924:	e8 26 9a ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0106929:	81 c3 63 eb 00 00    	add    $0xeb63,%ebx
+	if (!sample_period)
+f010692f:	83 bb d4 e6 03 00 00 	cmpl   $0x0,0x3e6d4(%ebx)
+f0106936:	75 05                	jne    f010693d <perf_sample_stop+0x20>
+	// ours can still be on its way, and the rest are someone else's.
+	if (!pmc0_overflowed())
+		sample_cpu = -1;
+	if (pmu.version >= 2)
+		wrmsr(MSR_GLOBAL_OVF_CTRL, 1);
+}
+f0106938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010693b:	c9                   	leave
+f010693c:	c3                   	ret
+	sample_period = 0;
+f010693d:	c7 83 d4 e6 03 00 00 	movl   $0x0,0x3e6d4(%ebx)
+f0106944:	00 00 00 
+	pmu_disable();
+f0106947:	e8 70 f4 ff ff       	call   f0105dbc <pmu_disable>
+	lapic_perfint(0);
+f010694c:	83 ec 0c             	sub    $0xc,%esp
+f010694f:	6a 00                	push   $0x0
+f0106951:	e8 10 1f 00 00       	call   f0108866 <lapic_perfint>
+	if (!pmc0_overflowed())
+f0106956:	e8 d1 f4 ff ff       	call   f0105e2c <pmc0_overflowed>
+f010695b:	83 c4 10             	add    $0x10,%esp
+f010695e:	84 c0                	test   %al,%al
+f0106960:	75 0a                	jne    f010696c <perf_sample_stop+0x4f>
+		sample_cpu = -1;
+f0106962:	c7 83 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebx)
+f0106969:	ff ff ff 
+	if (pmu.version >= 2)
+f010696c:	83 bb 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%ebx)
+f0106973:	7e c3                	jle    f0106938 <perf_sample_stop+0x1b>
+f0106975:	b9 90 03 00 00       	mov    $0x390,%ecx
+f010697a:	b8 01 00 00 00       	mov    $0x1,%eax
+f010697f:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106984:	0f 30                	wrmsr
+}
+f0106986:	eb b0                	jmp    f0106938 <perf_sample_stop+0x1b>
+
+f0106988 <perf_intr>:
+
+// Called for an NMI.  Returns 1 if it was a counter overflow.
+int
+perf_intr(struct Trapframe *tf)
+{
+f0106988:	55                   	push   %ebp
+f0106989:	89 e5                	mov    %esp,%ebp
+f010698b:	57                   	push   %edi
+f010698c:	56                   	push   %esi
+f010698d:	53                   	push   %ebx
+f010698e:	83 ec 0c             	sub    $0xc,%esp
+f0106991:	e8 b9 99 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0106996:	81 c3 f6 ea 00 00    	add    $0xeaf6,%ebx
+	if (sample_cpu != cpunum())
+f010699c:	e8 1e 1f 00 00       	call   f01088bf <cpunum>
+f01069a1:	89 c2                	mov    %eax,%edx
+		return 0;
+f01069a3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (sample_cpu != cpunum())
+f01069a8:	3b 93 c4 ff ff ff    	cmp    -0x3c(%ebx),%edx
+f01069ae:	75 18                	jne    f01069c8 <perf_intr+0x40>
+	// The one overflow that was on its way as sampling stopped
+	if (!sample_period) {
+f01069b0:	83 bb d4 e6 03 00 00 	cmpl   $0x0,0x3e6d4(%ebx)
+f01069b7:	75 17                	jne    f01069d0 <perf_intr+0x48>
+		sample_cpu = -1;
+f01069b9:	c7 83 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebx)
+f01069c0:	ff ff ff 
+		return 1;
+f01069c3:	b8 01 00 00 00       	mov    $0x1,%eax
+	prof_tick(tf);
+	wrmsr(MSR_PMC0, -(uint64_t) sample_period & pmu.gpmask);
+	// delivering the interrupt masked it in the local APIC
+	lapic_perfint(1);
+	return 1;
+}
+f01069c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01069cb:	5b                   	pop    %ebx
+f01069cc:	5e                   	pop    %esi
+f01069cd:	5f                   	pop    %edi
+f01069ce:	5d                   	pop    %ebp
+f01069cf:	c3                   	ret
+	if (!pmc0_overflowed())
+f01069d0:	e8 57 f4 ff ff       	call   f0105e2c <pmc0_overflowed>
+f01069d5:	89 c2                	mov    %eax,%edx
+		return 0;
+f01069d7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!pmc0_overflowed())
+f01069dc:	84 d2                	test   %dl,%dl
+f01069de:	74 e8                	je     f01069c8 <perf_intr+0x40>
+	if (pmu.version >= 2)
+f01069e0:	83 bb 14 e7 03 00 01 	cmpl   $0x1,0x3e714(%ebx)
+f01069e7:	7e 11                	jle    f01069fa <perf_intr+0x72>
+	asm volatile("wrmsr" : : "c" (msr), "A" (val));
+f01069e9:	b9 90 03 00 00       	mov    $0x390,%ecx
+f01069ee:	b8 01 00 00 00       	mov    $0x1,%eax
+f01069f3:	ba 00 00 00 00       	mov    $0x0,%edx
+f01069f8:	0f 30                	wrmsr
+	prof_tick(tf);
+f01069fa:	83 ec 0c             	sub    $0xc,%esp
+f01069fd:	ff 75 08             	push   0x8(%ebp)
+f0106a00:	e8 cf ee ff ff       	call   f01058d4 <prof_tick>
+	wrmsr(MSR_PMC0, -(uint64_t) sample_period & pmu.gpmask);
+f0106a05:	8b 83 d4 e6 03 00    	mov    0x3e6d4(%ebx),%eax
+f0106a0b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106a10:	f7 d8                	neg    %eax
+f0106a12:	83 d2 00             	adc    $0x0,%edx
+f0106a15:	f7 da                	neg    %edx
+f0106a17:	89 c1                	mov    %eax,%ecx
+f0106a19:	23 8b 28 e7 03 00    	and    0x3e728(%ebx),%ecx
+f0106a1f:	89 ce                	mov    %ecx,%esi
+f0106a21:	89 d0                	mov    %edx,%eax
+f0106a23:	23 83 2c e7 03 00    	and    0x3e72c(%ebx),%eax
+f0106a29:	89 c7                	mov    %eax,%edi
+f0106a2b:	b9 c1 00 00 00       	mov    $0xc1,%ecx
+f0106a30:	89 f0                	mov    %esi,%eax
+f0106a32:	89 fa                	mov    %edi,%edx
+f0106a34:	0f 30                	wrmsr
+	lapic_perfint(1);
+f0106a36:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0106a3d:	e8 24 1e 00 00       	call   f0108866 <lapic_perfint>
+	return 1;
+f0106a42:	83 c4 10             	add    $0x10,%esp
+f0106a45:	b8 01 00 00 00       	mov    $0x1,%eax
+f0106a4a:	e9 79 ff ff ff       	jmp    f01069c8 <perf_intr+0x40>
+
+f0106a4f <selected>:
+static char *bufa, *bufb;
+static volatile int sinkhole;	// keeps memcmp's result alive
+
+static bool
+selected(const char *name)
+{
+f0106a4f:	55                   	push   %ebp
+f0106a50:	89 e5                	mov    %esp,%ebp
+f0106a52:	56                   	push   %esi
+f0106a53:	53                   	push   %ebx
+f0106a54:	e8 f6 98 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0106a59:	81 c3 33 ea 00 00    	add    $0xea33,%ebx
+f0106a5f:	89 c6                	mov    %eax,%esi
+	return !prefix || strncmp(name, prefix, strlen(prefix)) == 0;
+f0106a61:	8b 83 48 e7 03 00    	mov    0x3e748(%ebx),%eax
+f0106a67:	85 c0                	test   %eax,%eax
+f0106a69:	74 2e                	je     f0106a99 <selected+0x4a>
+f0106a6b:	83 ec 0c             	sub    $0xc,%esp
+f0106a6e:	50                   	push   %eax
+f0106a6f:	e8 68 14 00 00       	call   f0107edc <strlen>
+f0106a74:	83 c4 0c             	add    $0xc,%esp
+f0106a77:	50                   	push   %eax
+f0106a78:	ff b3 48 e7 03 00    	push   0x3e748(%ebx)
+f0106a7e:	56                   	push   %esi
+f0106a7f:	e8 97 15 00 00       	call   f010801b <strncmp>
+f0106a84:	83 c4 10             	add    $0x10,%esp
+f0106a87:	85 c0                	test   %eax,%eax
+f0106a89:	0f 94 c0             	sete   %al
+f0106a8c:	0f b6 c0             	movzbl %al,%eax
+f0106a8f:	83 e0 01             	and    $0x1,%eax
+}
+f0106a92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0106a95:	5b                   	pop    %ebx
+f0106a96:	5e                   	pop    %esi
+f0106a97:	5d                   	pop    %ebp
+f0106a98:	c3                   	ret
+	return !prefix || strncmp(name, prefix, strlen(prefix)) == 0;
+f0106a99:	b8 01 00 00 00       	mov    $0x1,%eax
+f0106a9e:	eb ef                	jmp    f0106a8f <selected+0x40>
+
+f0106aa0 <bench_run>:
+
+// Run the benchmarks whose names start with 'pfx', or all of them if
+// it is NULL.
+void
+bench_run(const char *pfx)
+{
+f0106aa0:	55                   	push   %ebp
+f0106aa1:	89 e5                	mov    %esp,%ebp
+f0106aa3:	57                   	push   %edi
+f0106aa4:	56                   	push   %esi
+f0106aa5:	53                   	push   %ebx
+f0106aa6:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+f0106aac:	e8 9e 98 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0106ab1:	81 c3 db e9 00 00    	add    $0xe9db,%ebx
+	struct PageInfo *pa, *pb;
+
+	pa = page_alloc_order(BENCH_ORDER, 0);
+f0106ab7:	6a 00                	push   $0x0
+f0106ab9:	6a 03                	push   $0x3
+f0106abb:	e8 53 b6 ff ff       	call   f0102113 <page_alloc_order>
+f0106ac0:	89 c7                	mov    %eax,%edi
+f0106ac2:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+	pb = page_alloc_order(BENCH_ORDER, 0);
+f0106ac8:	83 c4 08             	add    $0x8,%esp
+f0106acb:	6a 00                	push   $0x0
+f0106acd:	6a 03                	push   $0x3
+f0106acf:	e8 3f b6 ff ff       	call   f0102113 <page_alloc_order>
+f0106ad4:	89 85 58 ff ff ff    	mov    %eax,-0xa8(%ebp)
+	if (!pa || !pb) {
+f0106ada:	83 c4 10             	add    $0x10,%esp
+f0106add:	85 ff                	test   %edi,%edi
+f0106adf:	0f 84 a3 00 00 00    	je     f0106b88 <bench_run+0xe8>
+f0106ae5:	85 c0                	test   %eax,%eax
+f0106ae7:	0f 84 9b 00 00 00    	je     f0106b88 <bench_run+0xe8>
+	return (pp - pages) << PGSHIFT;
+f0106aed:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f0106af3:	8b 30                	mov    (%eax),%esi
+f0106af5:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+f0106afb:	29 f0                	sub    %esi,%eax
+f0106afd:	c1 f8 02             	sar    $0x2,%eax
+f0106b00:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106b06:	89 c2                	mov    %eax,%edx
+f0106b08:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0106b0b:	c7 c1 0c 43 15 f0    	mov    $0xf015430c,%ecx
+f0106b11:	8b 09                	mov    (%ecx),%ecx
+f0106b13:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0106b18:	39 c8                	cmp    %ecx,%eax
+f0106b1a:	0f 83 af 00 00 00    	jae    f0106bcf <bench_run+0x12f>
+	return (void *)(pa + KERNBASE);
+f0106b20:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0106b26:	89 93 44 e7 03 00    	mov    %edx,0x3e744(%ebx)
+	return (pp - pages) << PGSHIFT;
+f0106b2c:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f0106b32:	29 f0                	sub    %esi,%eax
+f0106b34:	c1 f8 02             	sar    $0x2,%eax
+f0106b37:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106b3d:	89 c2                	mov    %eax,%edx
+f0106b3f:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0106b42:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0106b47:	39 c8                	cmp    %ecx,%eax
+f0106b49:	0f 83 96 00 00 00    	jae    f0106be5 <bench_run+0x145>
+	return (void *)(pa + KERNBASE);
+f0106b4f:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0106b55:	89 93 40 e7 03 00    	mov    %edx,0x3e740(%ebx)
+			page_free(pb);
+		return;
+	}
+	bufa = page2kva(pa);
+	bufb = page2kva(pb);
+	prefix = pfx;
+f0106b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106b5e:	89 83 48 e7 03 00    	mov    %eax,0x3e748(%ebx)
+f0106b64:	8d 83 5c 01 00 00    	lea    0x15c(%ebx),%eax
+f0106b6a:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+	for (op = 0; op < ARRAY_SIZE(opnames); op++)
+f0106b70:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+				snprintf(name, sizeof(name), "%s/%u/%d,%d",
+f0106b77:	8d 83 0c 5f ff ff    	lea    -0xa0f4(%ebx),%eax
+f0106b7d:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+f0106b83:	e9 b3 02 00 00       	jmp    f0106e3b <bench_run+0x39b>
+		cprintf("bench: out of memory\n");
+f0106b88:	83 ec 0c             	sub    $0xc,%esp
+f0106b8b:	8d 83 f6 5e ff ff    	lea    -0xa10a(%ebx),%eax
+f0106b91:	50                   	push   %eax
+f0106b92:	e8 fb d4 ff ff       	call   f0104092 <cprintf>
+		if (pa)
+f0106b97:	83 c4 10             	add    $0x10,%esp
+f0106b9a:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+f0106ba0:	85 c0                	test   %eax,%eax
+f0106ba2:	74 0c                	je     f0106bb0 <bench_run+0x110>
+			page_free(pa);
+f0106ba4:	83 ec 0c             	sub    $0xc,%esp
+f0106ba7:	50                   	push   %eax
+f0106ba8:	e8 36 b6 ff ff       	call   f01021e3 <page_free>
+f0106bad:	83 c4 10             	add    $0x10,%esp
+		if (pb)
+f0106bb0:	8b 85 58 ff ff ff    	mov    -0xa8(%ebp),%eax
+f0106bb6:	85 c0                	test   %eax,%eax
+f0106bb8:	0f 84 dc 04 00 00    	je     f010709a <bench_run+0x5fa>
+			page_free(pb);
+f0106bbe:	83 ec 0c             	sub    $0xc,%esp
+f0106bc1:	50                   	push   %eax
+f0106bc2:	e8 1c b6 ff ff       	call   f01021e3 <page_free>
+f0106bc7:	83 c4 10             	add    $0x10,%esp
+f0106bca:	e9 cb 04 00 00       	jmp    f010709a <bench_run+0x5fa>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106bcf:	52                   	push   %edx
+f0106bd0:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0106bd6:	50                   	push   %eax
+f0106bd7:	6a 53                	push   $0x53
+f0106bd9:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0106bdf:	50                   	push   %eax
+f0106be0:	e8 13 95 ff ff       	call   f01000f8 <_panic>
+f0106be5:	52                   	push   %edx
+f0106be6:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0106bec:	50                   	push   %eax
+f0106bed:	6a 53                	push   $0x53
+f0106bef:	8d 83 2c 51 ff ff    	lea    -0xaed4(%ebx),%eax
+f0106bf5:	50                   	push   %eax
+f0106bf6:	e8 fd 94 ff ff       	call   f01000f8 <_panic>
+		switch (op) {
+f0106bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106c00:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+f0106c06:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0106c0c:	89 c7                	mov    %eax,%edi
+				memmove(dst, src, n);
+f0106c0e:	83 ec 04             	sub    $0x4,%esp
+f0106c11:	ff 75 94             	push   -0x6c(%ebp)
+f0106c14:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+f0106c1a:	ff 75 88             	push   -0x78(%ebp)
+f0106c1d:	e8 21 15 00 00       	call   f0108143 <memmove>
+			for (i = 0; i < iters; i++)
+f0106c22:	83 c7 01             	add    $0x1,%edi
+f0106c25:	83 c4 10             	add    $0x10,%esp
+f0106c28:	39 7d 8c             	cmp    %edi,-0x74(%ebp)
+f0106c2b:	7f e1                	jg     f0106c0e <bench_run+0x16e>
+f0106c2d:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+f0106c33:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+	asm volatile("rdtsc" : "=A" (tsc));
+f0106c39:	0f 31                	rdtsc
+		t = read_tsc() - t;
+f0106c3b:	2b 45 a0             	sub    -0x60(%ebp),%eax
+f0106c3e:	1b 55 a4             	sbb    -0x5c(%ebp),%edx
+		best = MIN(best, t);
+f0106c41:	39 f0                	cmp    %esi,%eax
+f0106c43:	89 d1                	mov    %edx,%ecx
+f0106c45:	19 f9                	sbb    %edi,%ecx
+f0106c47:	0f 42 f0             	cmovb  %eax,%esi
+f0106c4a:	0f 42 fa             	cmovb  %edx,%edi
+	for (trial = 0; trial < BENCH_NTRIAL; trial++) {
+f0106c4d:	83 6d 90 01          	subl   $0x1,-0x70(%ebp)
+f0106c51:	0f 84 99 00 00 00    	je     f0106cf0 <bench_run+0x250>
+f0106c57:	0f 31                	rdtsc
+f0106c59:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0106c5c:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+		switch (op) {
+f0106c5f:	8b 45 98             	mov    -0x68(%ebp),%eax
+f0106c62:	83 f8 01             	cmp    $0x1,%eax
+f0106c65:	74 94                	je     f0106bfb <bench_run+0x15b>
+f0106c67:	83 f8 02             	cmp    $0x2,%eax
+f0106c6a:	74 3b                	je     f0106ca7 <bench_run+0x207>
+f0106c6c:	85 c0                	test   %eax,%eax
+f0106c6e:	75 c9                	jne    f0106c39 <bench_run+0x199>
+f0106c70:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+f0106c76:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0106c7c:	89 c7                	mov    %eax,%edi
+				memset(dst, 0, n);
+f0106c7e:	83 ec 04             	sub    $0x4,%esp
+f0106c81:	ff 75 94             	push   -0x6c(%ebp)
+f0106c84:	6a 00                	push   $0x0
+f0106c86:	ff 75 88             	push   -0x78(%ebp)
+f0106c89:	e8 5b 14 00 00       	call   f01080e9 <memset>
+			for (i = 0; i < iters; i++)
+f0106c8e:	83 c7 01             	add    $0x1,%edi
+f0106c91:	83 c4 10             	add    $0x10,%esp
+f0106c94:	39 7d 8c             	cmp    %edi,-0x74(%ebp)
+f0106c97:	7f e5                	jg     f0106c7e <bench_run+0x1de>
+f0106c99:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+f0106c9f:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+f0106ca5:	eb 92                	jmp    f0106c39 <bench_run+0x199>
+		switch (op) {
+f0106ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106cac:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+f0106cb2:	89 bd 74 ff ff ff    	mov    %edi,-0x8c(%ebp)
+f0106cb8:	89 c7                	mov    %eax,%edi
+				sinkhole = memcmp(dst, src, n);
+f0106cba:	83 ec 04             	sub    $0x4,%esp
+f0106cbd:	ff 75 94             	push   -0x6c(%ebp)
+f0106cc0:	ff b5 7c ff ff ff    	push   -0x84(%ebp)
+f0106cc6:	ff 75 88             	push   -0x78(%ebp)
+f0106cc9:	e8 1c 15 00 00       	call   f01081ea <memcmp>
+f0106cce:	89 83 3c e7 03 00    	mov    %eax,0x3e73c(%ebx)
+			for (i = 0; i < iters; i++)
+f0106cd4:	83 c7 01             	add    $0x1,%edi
+f0106cd7:	83 c4 10             	add    $0x10,%esp
+f0106cda:	39 7d 8c             	cmp    %edi,-0x74(%ebp)
+f0106cdd:	7f db                	jg     f0106cba <bench_run+0x21a>
+f0106cdf:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+f0106ce5:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+f0106ceb:	e9 49 ff ff ff       	jmp    f0106c39 <bench_run+0x199>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f0106cf0:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+f0106cf6:	50                   	push   %eax
+f0106cf7:	9d                   	popf
+	return best / iters;
+f0106cf8:	8b 45 8c             	mov    -0x74(%ebp),%eax
+f0106cfb:	99                   	cltd
+f0106cfc:	52                   	push   %edx
+f0106cfd:	50                   	push   %eax
+f0106cfe:	57                   	push   %edi
+f0106cff:	56                   	push   %esi
+f0106d00:	e8 d9 2c 00 00       	call   f01099de <__udivdi3>
+f0106d05:	83 c4 10             	add    $0x10,%esp
+	cprintf("bench: %s %llu\n", name, cycles);
+f0106d08:	52                   	push   %edx
+f0106d09:	50                   	push   %eax
+f0106d0a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f0106d0d:	50                   	push   %eax
+f0106d0e:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+f0106d14:	e8 79 d3 ff ff       	call   f0104092 <cprintf>
+}
+f0106d19:	83 c4 10             	add    $0x10,%esp
+f0106d1c:	83 45 9c 08          	addl   $0x8,-0x64(%ebp)
+			for (a = 0; a < ARRAY_SIZE(aligns); a++) {
+f0106d20:	8b 4d 84             	mov    -0x7c(%ebp),%ecx
+f0106d23:	39 4d 9c             	cmp    %ecx,-0x64(%ebp)
+f0106d26:	0f 84 cd 00 00 00    	je     f0106df9 <bench_run+0x359>
+				if (op == B_MEMSET && aligns[a][1])
+f0106d2c:	83 7d 98 00          	cmpl   $0x0,-0x68(%ebp)
+f0106d30:	75 09                	jne    f0106d3b <bench_run+0x29b>
+f0106d32:	8b 45 9c             	mov    -0x64(%ebp),%eax
+f0106d35:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0106d39:	75 e1                	jne    f0106d1c <bench_run+0x27c>
+					 aligns[a][0], aligns[a][1]);
+f0106d3b:	8b 45 9c             	mov    -0x64(%ebp),%eax
+f0106d3e:	8b 48 04             	mov    0x4(%eax),%ecx
+f0106d41:	8b 38                	mov    (%eax),%edi
+					 opnames[op], sizes[s],
+f0106d43:	8b 45 80             	mov    -0x80(%ebp),%eax
+f0106d46:	8b 00                	mov    (%eax),%eax
+				snprintf(name, sizeof(name), "%s/%u/%d,%d",
+f0106d48:	83 ec 04             	sub    $0x4,%esp
+f0106d4b:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+f0106d4e:	51                   	push   %ecx
+f0106d4f:	57                   	push   %edi
+f0106d50:	89 45 94             	mov    %eax,-0x6c(%ebp)
+f0106d53:	50                   	push   %eax
+f0106d54:	8b b5 78 ff ff ff    	mov    -0x88(%ebp),%esi
+f0106d5a:	ff 36                	push   (%esi)
+f0106d5c:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+f0106d62:	6a 20                	push   $0x20
+f0106d64:	8d 75 c8             	lea    -0x38(%ebp),%esi
+f0106d67:	56                   	push   %esi
+f0106d68:	e8 18 10 00 00       	call   f0107d85 <snprintf>
+				if (!selected(name))
+f0106d6d:	83 c4 20             	add    $0x20,%esp
+f0106d70:	89 f0                	mov    %esi,%eax
+f0106d72:	e8 d8 fc ff ff       	call   f0106a4f <selected>
+f0106d77:	84 c0                	test   %al,%al
+f0106d79:	74 a1                	je     f0106d1c <bench_run+0x27c>
+				memset(bufa, 0, PGSIZE << BENCH_ORDER);
+f0106d7b:	83 ec 04             	sub    $0x4,%esp
+f0106d7e:	68 00 80 00 00       	push   $0x8000
+f0106d83:	6a 00                	push   $0x0
+f0106d85:	ff b3 44 e7 03 00    	push   0x3e744(%ebx)
+f0106d8b:	e8 59 13 00 00       	call   f01080e9 <memset>
+				memset(bufb, 0, PGSIZE << BENCH_ORDER);
+f0106d90:	83 c4 0c             	add    $0xc,%esp
+f0106d93:	68 00 80 00 00       	push   $0x8000
+f0106d98:	6a 00                	push   $0x0
+f0106d9a:	ff b3 40 e7 03 00    	push   0x3e740(%ebx)
+f0106da0:	e8 44 13 00 00       	call   f01080e9 <memset>
+	char *dst = bufa + da, *src = bufb + sa;
+f0106da5:	03 bb 44 e7 03 00    	add    0x3e744(%ebx),%edi
+f0106dab:	89 7d 88             	mov    %edi,-0x78(%ebp)
+f0106dae:	8b 55 a0             	mov    -0x60(%ebp),%edx
+f0106db1:	03 93 40 e7 03 00    	add    0x3e740(%ebx),%edx
+f0106db7:	89 95 7c ff ff ff    	mov    %edx,-0x84(%ebp)
+	iters = MAX(BENCH_BATCH / n, 16);
+f0106dbd:	b8 00 00 01 00       	mov    $0x10000,%eax
+f0106dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+f0106dc7:	f7 75 94             	divl   -0x6c(%ebp)
+f0106dca:	ba 10 00 00 00       	mov    $0x10,%edx
+f0106dcf:	39 d0                	cmp    %edx,%eax
+f0106dd1:	0f 43 d0             	cmovae %eax,%edx
+f0106dd4:	89 55 8c             	mov    %edx,-0x74(%ebp)
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0106dd7:	9c                   	pushf
+f0106dd8:	58                   	pop    %eax
+f0106dd9:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+	asm volatile("cli");
+f0106ddf:	fa                   	cli
+	for (trial = 0; trial < BENCH_NTRIAL; trial++) {
+f0106de0:	83 c4 10             	add    $0x10,%esp
+f0106de3:	c7 45 90 06 00 00 00 	movl   $0x6,-0x70(%ebp)
+	uint64_t t, best = ~0ULL;
+f0106dea:	be ff ff ff ff       	mov    $0xffffffff,%esi
+f0106def:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	for (trial = 0; trial < BENCH_NTRIAL; trial++) {
+f0106df4:	e9 54 fe ff ff       	jmp    f0106c4d <bench_run+0x1ad>
+f0106df9:	83 45 80 04          	addl   $0x4,-0x80(%ebp)
+		for (s = 0; s < ARRAY_SIZE(sizes); s++)
+f0106dfd:	8b 95 60 ff ff ff    	mov    -0xa0(%ebp),%edx
+f0106e03:	39 55 80             	cmp    %edx,-0x80(%ebp)
+f0106e06:	74 20                	je     f0106e28 <bench_run+0x388>
+f0106e08:	8d 83 90 5f ff ff    	lea    -0xa070(%ebx),%eax
+f0106e0e:	89 45 9c             	mov    %eax,-0x64(%ebp)
+f0106e11:	83 c0 18             	add    $0x18,%eax
+f0106e14:	89 45 84             	mov    %eax,-0x7c(%ebp)
+	cprintf("bench: %s %llu\n", name, cycles);
+f0106e17:	8d 83 18 5f ff ff    	lea    -0xa0e8(%ebx),%eax
+f0106e1d:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+f0106e23:	e9 f8 fe ff ff       	jmp    f0106d20 <bench_run+0x280>
+	for (op = 0; op < ARRAY_SIZE(opnames); op++)
+f0106e28:	83 45 98 01          	addl   $0x1,-0x68(%ebp)
+f0106e2c:	8b 45 98             	mov    -0x68(%ebp),%eax
+f0106e2f:	83 85 78 ff ff ff 04 	addl   $0x4,-0x88(%ebp)
+f0106e36:	83 f8 03             	cmp    $0x3,%eax
+f0106e39:	74 14                	je     f0106e4f <bench_run+0x3af>
+f0106e3b:	8d 83 a8 5f ff ff    	lea    -0xa058(%ebx),%eax
+f0106e41:	89 45 80             	mov    %eax,-0x80(%ebp)
+f0106e44:	83 c0 18             	add    $0x18,%eax
+f0106e47:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+f0106e4d:	eb ae                	jmp    f0106dfd <bench_run+0x35d>
+		(uintptr_t) mon_backtrace + 8, (uintptr_t) vprintfmt + 16,
+f0106e4f:	c7 c0 65 11 10 f0    	mov    $0xf0101165,%eax
+f0106e55:	8d 70 08             	lea    0x8(%eax),%esi
+	const uintptr_t eips[] = {
+f0106e58:	89 75 c8             	mov    %esi,-0x38(%ebp)
+		(uintptr_t) mon_backtrace + 8, (uintptr_t) vprintfmt + 16,
+f0106e5b:	c7 c0 27 7b 10 f0    	mov    $0xf0107b27,%eax
+f0106e61:	83 c0 10             	add    $0x10,%eax
+f0106e64:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		(uintptr_t) memset + 4, (uintptr_t) debuginfo_eip + 32,
+f0106e67:	c7 c0 e9 80 10 f0    	mov    $0xf01080e9,%eax
+f0106e6d:	83 c0 04             	add    $0x4,%eax
+f0106e70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106e73:	c7 c0 0e 4a 10 f0    	mov    $0xf0104a0e,%eax
+f0106e79:	83 c0 20             	add    $0x20,%eax
+f0106e7c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		(uintptr_t) page_alloc + 8, (uintptr_t) print_trapframe + 12,
+f0106e7f:	c7 c0 85 1f 10 f0    	mov    $0xf0101f85,%eax
+f0106e85:	83 c0 08             	add    $0x8,%eax
+f0106e88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106e8b:	c7 c0 49 43 10 f0    	mov    $0xf0104349,%eax
+f0106e91:	83 c0 0c             	add    $0xc,%eax
+f0106e94:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		(uintptr_t) cons_write + 4, (uintptr_t) bench_run + 8,
+f0106e97:	c7 c0 26 0c 10 f0    	mov    $0xf0100c26,%eax
+f0106e9d:	83 c0 04             	add    $0x4,%eax
+f0106ea0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106ea3:	8d 83 1c 16 ff ff    	lea    -0xe9e4(%ebx),%eax
+f0106ea9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (!selected("debuginfo_eip"))
+f0106eac:	8d 83 28 5f ff ff    	lea    -0xa0d8(%ebx),%eax
+f0106eb2:	e8 98 fb ff ff       	call   f0106a4f <selected>
+f0106eb7:	84 c0                	test   %al,%al
+f0106eb9:	0f 85 37 01 00 00    	jne    f0106ff6 <bench_run+0x556>
+	mask = cons_getsinks();
+f0106ebf:	e8 ea 9d ff ff       	call   f0100cae <cons_getsinks>
+f0106ec4:	89 45 8c             	mov    %eax,-0x74(%ebp)
+	for (i = -1; i < NCONSSINK; i++) {
+f0106ec7:	c7 45 94 ff ff ff ff 	movl   $0xffffffff,-0x6c(%ebp)
+		snprintf(name, sizeof(name), "cprintf/%s",
+f0106ece:	8d 83 4e 5f ff ff    	lea    -0xa0b2(%ebx),%eax
+f0106ed4:	89 45 88             	mov    %eax,-0x78(%ebp)
+f0106ed7:	8d 83 36 5f ff ff    	lea    -0xa0ca(%ebx),%eax
+f0106edd:	89 45 90             	mov    %eax,-0x70(%ebp)
+f0106ee0:	ff 75 88             	push   -0x78(%ebp)
+f0106ee3:	ff 75 90             	push   -0x70(%ebp)
+f0106ee6:	6a 20                	push   $0x20
+f0106ee8:	8d 75 c8             	lea    -0x38(%ebp),%esi
+f0106eeb:	56                   	push   %esi
+f0106eec:	e8 94 0e 00 00       	call   f0107d85 <snprintf>
+		if (!selected(name))
+f0106ef1:	89 f0                	mov    %esi,%eax
+f0106ef3:	e8 57 fb ff ff       	call   f0106a4f <selected>
+f0106ef8:	83 c4 10             	add    $0x10,%esp
+f0106efb:	8b 75 94             	mov    -0x6c(%ebp),%esi
+f0106efe:	84 c0                	test   %al,%al
+f0106f00:	0f 84 92 00 00 00    	je     f0106f98 <bench_run+0x4f8>
+		cons_setsinks(i < 0 ? 0 : 1 << i);
+f0106f06:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106f0b:	83 ec 0c             	sub    $0xc,%esp
+f0106f0e:	50                   	push   %eax
+f0106f0f:	e8 ab 9d ff ff       	call   f0100cbf <cons_setsinks>
+	asm volatile("rdtsc" : "=A" (tsc));
+f0106f14:	0f 31                	rdtsc
+f0106f16:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0106f19:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+f0106f1c:	83 c4 10             	add    $0x10,%esp
+		for (line = 0; line < BENCH_NLINE; line++)
+f0106f1f:	be 00 00 00 00       	mov    $0x0,%esi
+f0106f24:	bf 00 00 00 00       	mov    $0x0,%edi
+			cprintf("# bench line %2d: %08x %08x %5d %s\n", line,
+f0106f29:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f0106f2c:	89 45 9c             	mov    %eax,-0x64(%ebp)
+f0106f2f:	8d 83 6c 5f ff ff    	lea    -0xa094(%ebx),%eax
+f0106f35:	89 45 98             	mov    %eax,-0x68(%ebp)
+f0106f38:	83 ec 08             	sub    $0x8,%esp
+f0106f3b:	ff 75 9c             	push   -0x64(%ebp)
+f0106f3e:	57                   	push   %edi
+f0106f3f:	ff b3 44 e7 03 00    	push   0x3e744(%ebx)
+f0106f45:	ff 75 a0             	push   -0x60(%ebp)
+f0106f48:	56                   	push   %esi
+f0106f49:	ff 75 98             	push   -0x68(%ebp)
+f0106f4c:	e8 41 d1 ff ff       	call   f0104092 <cprintf>
+		for (line = 0; line < BENCH_NLINE; line++)
+f0106f51:	83 c6 01             	add    $0x1,%esi
+f0106f54:	81 c7 e8 03 00 00    	add    $0x3e8,%edi
+f0106f5a:	83 c4 20             	add    $0x20,%esp
+f0106f5d:	83 fe 40             	cmp    $0x40,%esi
+f0106f60:	75 d6                	jne    f0106f38 <bench_run+0x498>
+f0106f62:	0f 31                	rdtsc
+		t = read_tsc() - t;
+f0106f64:	2b 45 a0             	sub    -0x60(%ebp),%eax
+f0106f67:	1b 55 a4             	sbb    -0x5c(%ebp),%edx
+f0106f6a:	89 c6                	mov    %eax,%esi
+f0106f6c:	89 d7                	mov    %edx,%edi
+		cons_setsinks(mask);
+f0106f6e:	83 ec 0c             	sub    $0xc,%esp
+f0106f71:	ff 75 8c             	push   -0x74(%ebp)
+f0106f74:	e8 46 9d ff ff       	call   f0100cbf <cons_setsinks>
+		report(name, t / BENCH_NLINE);
+f0106f79:	0f ac fe 06          	shrd   $0x6,%edi,%esi
+f0106f7d:	c1 ef 06             	shr    $0x6,%edi
+	cprintf("bench: %s %llu\n", name, cycles);
+f0106f80:	57                   	push   %edi
+f0106f81:	56                   	push   %esi
+f0106f82:	8d 45 c8             	lea    -0x38(%ebp),%eax
+f0106f85:	50                   	push   %eax
+f0106f86:	8d 83 18 5f ff ff    	lea    -0xa0e8(%ebx),%eax
+f0106f8c:	50                   	push   %eax
+f0106f8d:	e8 00 d1 ff ff       	call   f0104092 <cprintf>
+}
+f0106f92:	83 c4 20             	add    $0x20,%esp
+f0106f95:	8b 75 94             	mov    -0x6c(%ebp),%esi
+	for (i = -1; i < NCONSSINK; i++) {
+f0106f98:	83 c6 01             	add    $0x1,%esi
+f0106f9b:	83 fe 03             	cmp    $0x3,%esi
+f0106f9e:	0f 84 c8 00 00 00    	je     f010706c <bench_run+0x5cc>
+		if (i >= 0 && !cons_sink(i)->cs_present)
+f0106fa4:	85 f6                	test   %esi,%esi
+f0106fa6:	0f 88 f6 00 00 00    	js     f01070a2 <bench_run+0x602>
+f0106fac:	83 ec 0c             	sub    $0xc,%esp
+f0106faf:	56                   	push   %esi
+f0106fb0:	e8 47 9d ff ff       	call   f0100cfc <cons_sink>
+f0106fb5:	83 c4 10             	add    $0x10,%esp
+f0106fb8:	80 78 04 00          	cmpb   $0x0,0x4(%eax)
+f0106fbc:	74 da                	je     f0106f98 <bench_run+0x4f8>
+			 i < 0 ? "none" : cons_sink(i)->cs_name);
+f0106fbe:	83 ec 0c             	sub    $0xc,%esp
+f0106fc1:	56                   	push   %esi
+f0106fc2:	e8 35 9d ff ff       	call   f0100cfc <cons_sink>
+		snprintf(name, sizeof(name), "cprintf/%s",
+f0106fc7:	ff 30                	push   (%eax)
+f0106fc9:	ff 75 90             	push   -0x70(%ebp)
+f0106fcc:	6a 20                	push   $0x20
+f0106fce:	8d 7d c8             	lea    -0x38(%ebp),%edi
+f0106fd1:	57                   	push   %edi
+f0106fd2:	e8 ae 0d 00 00       	call   f0107d85 <snprintf>
+		if (!selected(name))
+f0106fd7:	83 c4 20             	add    $0x20,%esp
+f0106fda:	89 f8                	mov    %edi,%eax
+f0106fdc:	e8 6e fa ff ff       	call   f0106a4f <selected>
+f0106fe1:	84 c0                	test   %al,%al
+f0106fe3:	74 b3                	je     f0106f98 <bench_run+0x4f8>
+		cons_setsinks(i < 0 ? 0 : 1 << i);
+f0106fe5:	89 75 94             	mov    %esi,-0x6c(%ebp)
+f0106fe8:	b8 01 00 00 00       	mov    $0x1,%eax
+f0106fed:	89 f1                	mov    %esi,%ecx
+f0106fef:	d3 e0                	shl    %cl,%eax
+f0106ff1:	e9 15 ff ff ff       	jmp    f0106f0b <bench_run+0x46b>
+	debuginfo_eip(eips[0], &info);
+f0106ff6:	83 ec 08             	sub    $0x8,%esp
+f0106ff9:	8d 45 b0             	lea    -0x50(%ebp),%eax
+f0106ffc:	50                   	push   %eax
+f0106ffd:	56                   	push   %esi
+f0106ffe:	e8 0b da ff ff       	call   f0104a0e <debuginfo_eip>
+f0107003:	0f 31                	rdtsc
+f0107005:	89 45 a0             	mov    %eax,-0x60(%ebp)
+f0107008:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+f010700b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < BENCH_NLOOKUP; i++)
+f010700e:	be 00 00 00 00       	mov    $0x0,%esi
+		debuginfo_eip(eips[i % ARRAY_SIZE(eips)], &info);
+f0107013:	8d 7d b0             	lea    -0x50(%ebp),%edi
+f0107016:	83 ec 08             	sub    $0x8,%esp
+f0107019:	57                   	push   %edi
+f010701a:	89 f0                	mov    %esi,%eax
+f010701c:	83 e0 07             	and    $0x7,%eax
+f010701f:	ff 74 85 c8          	push   -0x38(%ebp,%eax,4)
+f0107023:	e8 e6 d9 ff ff       	call   f0104a0e <debuginfo_eip>
+	for (i = 0; i < BENCH_NLOOKUP; i++)
+f0107028:	83 c6 01             	add    $0x1,%esi
+f010702b:	83 c4 10             	add    $0x10,%esp
+f010702e:	81 fe e8 03 00 00    	cmp    $0x3e8,%esi
+f0107034:	75 e0                	jne    f0107016 <bench_run+0x576>
+f0107036:	0f 31                	rdtsc
+	t = read_tsc() - t;
+f0107038:	2b 45 a0             	sub    -0x60(%ebp),%eax
+f010703b:	1b 55 a4             	sbb    -0x5c(%ebp),%edx
+	report("debuginfo_eip", t / BENCH_NLOOKUP);
+f010703e:	6a 00                	push   $0x0
+f0107040:	68 e8 03 00 00       	push   $0x3e8
+f0107045:	52                   	push   %edx
+f0107046:	50                   	push   %eax
+f0107047:	e8 92 29 00 00       	call   f01099de <__udivdi3>
+f010704c:	83 c4 10             	add    $0x10,%esp
+	cprintf("bench: %s %llu\n", name, cycles);
+f010704f:	52                   	push   %edx
+f0107050:	50                   	push   %eax
+f0107051:	8d 83 28 5f ff ff    	lea    -0xa0d8(%ebx),%eax
+f0107057:	50                   	push   %eax
+f0107058:	8d 83 18 5f ff ff    	lea    -0xa0e8(%ebx),%eax
+f010705e:	50                   	push   %eax
+f010705f:	e8 2e d0 ff ff       	call   f0104092 <cprintf>
+f0107064:	83 c4 10             	add    $0x10,%esp
+f0107067:	e9 53 fe ff ff       	jmp    f0106ebf <bench_run+0x41f>
+
+	bench_string();
+	bench_debuginfo();
+	bench_cprintf();
+	cprintf("bench: done\n");
+f010706c:	83 ec 0c             	sub    $0xc,%esp
+f010706f:	8d 83 41 5f ff ff    	lea    -0xa0bf(%ebx),%eax
+f0107075:	50                   	push   %eax
+f0107076:	e8 17 d0 ff ff       	call   f0104092 <cprintf>
+
+	page_free(pa);
+f010707b:	83 c4 04             	add    $0x4,%esp
+f010707e:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+f0107084:	e8 5a b1 ff ff       	call   f01021e3 <page_free>
+	page_free(pb);
+f0107089:	83 c4 04             	add    $0x4,%esp
+f010708c:	ff b5 58 ff ff ff    	push   -0xa8(%ebp)
+f0107092:	e8 4c b1 ff ff       	call   f01021e3 <page_free>
+f0107097:	83 c4 10             	add    $0x10,%esp
+}
+f010709a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010709d:	5b                   	pop    %ebx
+f010709e:	5e                   	pop    %esi
+f010709f:	5f                   	pop    %edi
+f01070a0:	5d                   	pop    %ebp
+f01070a1:	c3                   	ret
+f01070a2:	89 75 94             	mov    %esi,-0x6c(%ebp)
+f01070a5:	e9 36 fe ff ff       	jmp    f0106ee0 <bench_run+0x440>
+
+f01070aa <print_time>:
+
+// Print 'cycles' in milliseconds, or in cycles if the TSC's rate is
+// unknown.
+static void
+print_time(uint64_t cycles)
+{
+f01070aa:	55                   	push   %ebp
+f01070ab:	89 e5                	mov    %esp,%ebp
+f01070ad:	57                   	push   %edi
+f01070ae:	56                   	push   %esi
+f01070af:	53                   	push   %ebx
+f01070b0:	83 ec 1c             	sub    $0x1c,%esp
+f01070b3:	e8 97 92 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01070b8:	81 c3 d4 e3 00 00    	add    $0xe3d4,%ebx
+f01070be:	89 d1                	mov    %edx,%ecx
+f01070c0:	89 c2                	mov    %eax,%edx
+	uint64_t us;
+
+	if (!hz) {
+f01070c2:	8b b3 54 e7 03 00    	mov    0x3e754(%ebx),%esi
+f01070c8:	8b bb 58 e7 03 00    	mov    0x3e758(%ebx),%edi
+f01070ce:	89 f8                	mov    %edi,%eax
+f01070d0:	09 f0                	or     %esi,%eax
+f01070d2:	74 64                	je     f0107138 <print_time+0x8e>
+		cprintf(" %12llu", cycles);
+		return;
+	}
+	us = cycles * 1000000 / hz;
+f01070d4:	89 d0                	mov    %edx,%eax
+f01070d6:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+f01070dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f01070df:	b9 40 42 0f 00       	mov    $0xf4240,%ecx
+f01070e4:	f7 e1                	mul    %ecx
+f01070e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01070e9:	01 ca                	add    %ecx,%edx
+f01070eb:	57                   	push   %edi
+f01070ec:	56                   	push   %esi
+f01070ed:	52                   	push   %edx
+f01070ee:	50                   	push   %eax
+f01070ef:	e8 ea 28 00 00       	call   f01099de <__udivdi3>
+f01070f4:	89 c6                	mov    %eax,%esi
+f01070f6:	89 d7                	mov    %edx,%edi
+	cprintf(" %8llu.%03llu", us / 1000, us % 1000);
+f01070f8:	6a 00                	push   $0x0
+f01070fa:	68 e8 03 00 00       	push   $0x3e8
+f01070ff:	52                   	push   %edx
+f0107100:	50                   	push   %eax
+f0107101:	e8 9e 29 00 00       	call   f0109aa4 <__umoddi3>
+f0107106:	83 c4 14             	add    $0x14,%esp
+f0107109:	52                   	push   %edx
+f010710a:	50                   	push   %eax
+f010710b:	83 ec 0c             	sub    $0xc,%esp
+f010710e:	6a 00                	push   $0x0
+f0107110:	68 e8 03 00 00       	push   $0x3e8
+f0107115:	57                   	push   %edi
+f0107116:	56                   	push   %esi
+f0107117:	e8 c2 28 00 00       	call   f01099de <__udivdi3>
+f010711c:	83 c4 1c             	add    $0x1c,%esp
+f010711f:	52                   	push   %edx
+f0107120:	50                   	push   %eax
+f0107121:	8d 83 c8 5f ff ff    	lea    -0xa038(%ebx),%eax
+f0107127:	50                   	push   %eax
+f0107128:	e8 65 cf ff ff       	call   f0104092 <cprintf>
+f010712d:	83 c4 20             	add    $0x20,%esp
+}
+f0107130:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107133:	5b                   	pop    %ebx
+f0107134:	5e                   	pop    %esi
+f0107135:	5f                   	pop    %edi
+f0107136:	5d                   	pop    %ebp
+f0107137:	c3                   	ret
+		cprintf(" %12llu", cycles);
+f0107138:	83 ec 04             	sub    $0x4,%esp
+f010713b:	51                   	push   %ecx
+f010713c:	52                   	push   %edx
+f010713d:	8d 83 c0 5f ff ff    	lea    -0xa040(%ebx),%eax
+f0107143:	50                   	push   %eax
+f0107144:	e8 49 cf ff ff       	call   f0104092 <cprintf>
+		return;
+f0107149:	83 c4 10             	add    $0x10,%esp
+f010714c:	eb e2                	jmp    f0107130 <print_time+0x86>
+
+f010714e <print_step>:
+
+static void
+print_step(const char *name, int n, uint64_t tsc)
+{
+f010714e:	55                   	push   %ebp
+f010714f:	89 e5                	mov    %esp,%ebp
+f0107151:	57                   	push   %edi
+f0107152:	56                   	push   %esi
+f0107153:	53                   	push   %ebx
+f0107154:	83 ec 2c             	sub    $0x2c,%esp
+f0107157:	e8 f3 91 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010715c:	81 c3 30 e3 00 00    	add    $0xe330,%ebx
+f0107162:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107165:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	char buf[24];
+
+	if (n)
+f0107168:	85 d2                	test   %edx,%edx
+f010716a:	74 70                	je     f01071dc <print_step+0x8e>
+		snprintf(buf, sizeof(buf), "%s %d", name, n);
+f010716c:	83 ec 0c             	sub    $0xc,%esp
+f010716f:	52                   	push   %edx
+f0107170:	50                   	push   %eax
+f0107171:	8d 83 d6 5f ff ff    	lea    -0xa02a(%ebx),%eax
+f0107177:	50                   	push   %eax
+f0107178:	6a 18                	push   $0x18
+f010717a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010717d:	50                   	push   %eax
+f010717e:	e8 02 0c 00 00       	call   f0107d85 <snprintf>
+f0107183:	83 c4 20             	add    $0x20,%esp
+	else
+		snprintf(buf, sizeof(buf), "%s", name);
+	cprintf("  %-18s", buf);
+f0107186:	83 ec 08             	sub    $0x8,%esp
+f0107189:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f010718c:	50                   	push   %eax
+f010718d:	8d 83 dc 5f ff ff    	lea    -0xa024(%ebx),%eax
+f0107193:	50                   	push   %eax
+f0107194:	e8 f9 ce ff ff       	call   f0104092 <cprintf>
+	print_time(tsc);
+f0107199:	89 f0                	mov    %esi,%eax
+f010719b:	89 fa                	mov    %edi,%edx
+f010719d:	e8 08 ff ff ff       	call   f01070aa <print_time>
+	print_time(tsc - last);
+f01071a2:	89 f0                	mov    %esi,%eax
+f01071a4:	89 fa                	mov    %edi,%edx
+f01071a6:	2b 83 4c e7 03 00    	sub    0x3e74c(%ebx),%eax
+f01071ac:	1b 93 50 e7 03 00    	sbb    0x3e750(%ebx),%edx
+f01071b2:	e8 f3 fe ff ff       	call   f01070aa <print_time>
+	cprintf("\n");
+f01071b7:	8d 83 09 66 ff ff    	lea    -0x99f7(%ebx),%eax
+f01071bd:	89 04 24             	mov    %eax,(%esp)
+f01071c0:	e8 cd ce ff ff       	call   f0104092 <cprintf>
+	last = tsc;
+f01071c5:	89 b3 4c e7 03 00    	mov    %esi,0x3e74c(%ebx)
+f01071cb:	89 bb 50 e7 03 00    	mov    %edi,0x3e750(%ebx)
+}
+f01071d1:	83 c4 10             	add    $0x10,%esp
+f01071d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01071d7:	5b                   	pop    %ebx
+f01071d8:	5e                   	pop    %esi
+f01071d9:	5f                   	pop    %edi
+f01071da:	5d                   	pop    %ebp
+f01071db:	c3                   	ret
+		snprintf(buf, sizeof(buf), "%s", name);
+f01071dc:	50                   	push   %eax
+f01071dd:	8d 83 f6 5d ff ff    	lea    -0xa20a(%ebx),%eax
+f01071e3:	50                   	push   %eax
+f01071e4:	6a 18                	push   $0x18
+f01071e6:	8d 45 d0             	lea    -0x30(%ebp),%eax
+f01071e9:	50                   	push   %eax
+f01071ea:	e8 96 0b 00 00       	call   f0107d85 <snprintf>
+f01071ef:	83 c4 10             	add    $0x10,%esp
+f01071f2:	eb 92                	jmp    f0107186 <print_step+0x38>
+
+f01071f4 <boottime_print>:
+
+// Print the time from reset to each stamp, and since the one before.
+void
+boottime_print(void)
+{
+f01071f4:	55                   	push   %ebp
+f01071f5:	89 e5                	mov    %esp,%ebp
+f01071f7:	57                   	push   %edi
+f01071f8:	56                   	push   %esi
+f01071f9:	53                   	push   %ebx
+f01071fa:	83 ec 2c             	sub    $0x2c,%esp
+f01071fd:	e8 4d 91 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0107202:	81 c3 8a e2 00 00    	add    $0xe28a,%ebx
+	struct Bootinfo *bi = (struct Bootinfo *) (KERNBASE + BOOTINFO_PA);
+	uint32_t ntsc, zidx, i;
+	uint64_t tsc;
+
+	hz = kclock_tsc_hz();
+f0107208:	e8 0e cb ff ff       	call   f0103d1b <kclock_tsc_hz>
+f010720d:	89 c6                	mov    %eax,%esi
+f010720f:	89 83 54 e7 03 00    	mov    %eax,0x3e754(%ebx)
+f0107215:	89 93 58 e7 03 00    	mov    %edx,0x3e758(%ebx)
+	if (hz)
+f010721b:	89 d0                	mov    %edx,%eax
+f010721d:	09 f0                	or     %esi,%eax
+f010721f:	0f 84 2c 01 00 00    	je     f0107351 <boottime_print+0x15d>
+f0107225:	89 d7                	mov    %edx,%edi
+		cprintf("TSC runs at %llu.%03llu MHz (timed against the PIT)\n",
+f0107227:	83 ec 10             	sub    $0x10,%esp
+			hz / 1000000, hz / 1000 % 1000);
+f010722a:	6a 00                	push   $0x0
+f010722c:	68 e8 03 00 00       	push   $0x3e8
+f0107231:	52                   	push   %edx
+f0107232:	56                   	push   %esi
+f0107233:	e8 a6 27 00 00       	call   f01099de <__udivdi3>
+f0107238:	83 c4 10             	add    $0x10,%esp
+		cprintf("TSC runs at %llu.%03llu MHz (timed against the PIT)\n",
+f010723b:	6a 00                	push   $0x0
+f010723d:	68 e8 03 00 00       	push   $0x3e8
+f0107242:	52                   	push   %edx
+f0107243:	50                   	push   %eax
+f0107244:	e8 5b 28 00 00       	call   f0109aa4 <__umoddi3>
+f0107249:	83 c4 14             	add    $0x14,%esp
+f010724c:	52                   	push   %edx
+f010724d:	50                   	push   %eax
+f010724e:	83 ec 0c             	sub    $0xc,%esp
+f0107251:	6a 00                	push   $0x0
+f0107253:	68 40 42 0f 00       	push   $0xf4240
+f0107258:	57                   	push   %edi
+f0107259:	56                   	push   %esi
+f010725a:	e8 7f 27 00 00       	call   f01099de <__udivdi3>
+f010725f:	83 c4 1c             	add    $0x1c,%esp
+f0107262:	52                   	push   %edx
+f0107263:	50                   	push   %eax
+f0107264:	8d 83 88 60 ff ff    	lea    -0x9f78(%ebx),%eax
+f010726a:	50                   	push   %eax
+f010726b:	e8 22 ce ff ff       	call   f0104092 <cprintf>
+f0107270:	83 c4 20             	add    $0x20,%esp
+	else
+		cprintf("TSC rate unknown; times are in cycles\n");
+	cprintf("  %-18s %12s %12s\n", "step", hz ? "at ms" : "at",
+f0107273:	8b 83 58 e7 03 00    	mov    0x3e758(%ebx),%eax
+f0107279:	0b 83 54 e7 03 00    	or     0x3e754(%ebx),%eax
+f010727f:	0f 85 e3 00 00 00    	jne    f0107368 <boottime_print+0x174>
+f0107285:	8d 93 e4 5f ff ff    	lea    -0xa01c(%ebx),%edx
+f010728b:	8d 83 02 4b ff ff    	lea    -0xb4fe(%ebx),%eax
+f0107291:	52                   	push   %edx
+f0107292:	50                   	push   %eax
+f0107293:	8d 83 f7 5f ff ff    	lea    -0xa009(%ebx),%eax
+f0107299:	50                   	push   %eax
+f010729a:	8d 83 fc 5f ff ff    	lea    -0xa004(%ebx),%eax
+f01072a0:	50                   	push   %eax
+f01072a1:	e8 ec cd ff ff       	call   f0104092 <cprintf>
+		hz ? "took ms" : "took");
+
+	last = 0;
+f01072a6:	c7 83 4c e7 03 00 00 	movl   $0x0,0x3e74c(%ebx)
+f01072ad:	00 00 00 
+f01072b0:	c7 83 50 e7 03 00 00 	movl   $0x0,0x3e750(%ebx)
+f01072b7:	00 00 00 
+	if (bi->bi_magic == BOOTINFO_MAGIC && (bi->bi_flags & BI_TSC)) {
+f01072ba:	83 c4 10             	add    $0x10,%esp
+f01072bd:	81 3d 00 60 00 f0 42 	cmpl   $0x544f4f42,0xf0006000
+f01072c4:	4f 4f 54 
+f01072c7:	0f 85 06 01 00 00    	jne    f01073d3 <boottime_print+0x1df>
+f01072cd:	a1 04 60 00 f0       	mov    0xf0006004,%eax
+f01072d2:	a8 04                	test   $0x4,%al
+f01072d4:	0f 84 f9 00 00 00    	je     f01073d3 <boottime_print+0x1df>
+		ntsc = (bi->bi_tscend - BOOTINFO_PA
+			- offsetof(struct Bootinfo, bi_tsc)) / sizeof(uint32_t);
+f01072da:	8b 0d 14 60 00 f0    	mov    0xf0006014,%ecx
+f01072e0:	8d b1 e8 9f ff ff    	lea    -0x6018(%ecx),%esi
+		ntsc = (bi->bi_tscend - BOOTINFO_PA
+f01072e6:	c1 ee 02             	shr    $0x2,%esi
+		ntsc = MIN(ntsc, BI_NTSC);
+f01072e9:	ba 10 00 00 00       	mov    $0x10,%edx
+f01072ee:	39 d6                	cmp    %edx,%esi
+f01072f0:	0f 47 f2             	cmova  %edx,%esi
+		zidx = (bi->bi_flags & BI_ZBOOT) ? bi->bi_zbootidx : ntsc;
+f01072f3:	89 f7                	mov    %esi,%edi
+f01072f5:	a8 08                	test   $0x8,%al
+f01072f7:	74 06                	je     f01072ff <boottime_print+0x10b>
+f01072f9:	8b 3d 58 60 00 f0    	mov    0xf0006058,%edi
+
+		print_step("bootmain", 0, bi->bi_tsc0);
+f01072ff:	83 ec 08             	sub    $0x8,%esp
+f0107302:	ff 35 10 60 00 f0    	push   0xf0006010
+f0107308:	ff 35 0c 60 00 f0    	push   0xf000600c
+f010730e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107313:	8d 83 0f 60 ff ff    	lea    -0x9ff1(%ebx),%eax
+f0107319:	e8 30 fe ff ff       	call   f010714e <print_step>
+		// The loaders keep only the low 32 bits, which is enough
+		// as long as each step takes under 2^32 cycles.
+		tsc = bi->bi_tsc0;
+f010731e:	a1 0c 60 00 f0       	mov    0xf000600c,%eax
+f0107323:	8b 15 10 60 00 f0    	mov    0xf0006010,%edx
+f0107329:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010732c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f010732f:	8d 46 01             	lea    0x1(%esi),%eax
+f0107332:	89 45 dc             	mov    %eax,-0x24(%ebp)
+		for (i = 0; i < ntsc; i++) {
+f0107335:	83 c4 10             	add    $0x10,%esp
+f0107338:	be 01 00 00 00       	mov    $0x1,%esi
+			tsc += (uint32_t) (bi->bi_tsc[i] - (uint32_t) tsc);
+			if (i < zidx)
+				print_step("boot read", i + 1, tsc);
+			else
+				print_step("zboot segment", i - zidx + 1, tsc);
+f010733d:	8d 83 22 60 ff ff    	lea    -0x9fde(%ebx),%eax
+f0107343:	89 45 d8             	mov    %eax,-0x28(%ebp)
+				print_step("boot read", i + 1, tsc);
+f0107346:	8d 83 18 60 ff ff    	lea    -0x9fe8(%ebx),%eax
+f010734c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		for (i = 0; i < ntsc; i++) {
+f010734f:	eb 43                	jmp    f0107394 <boottime_print+0x1a0>
+		cprintf("TSC rate unknown; times are in cycles\n");
+f0107351:	83 ec 0c             	sub    $0xc,%esp
+f0107354:	8d 83 c0 60 ff ff    	lea    -0x9f40(%ebx),%eax
+f010735a:	50                   	push   %eax
+f010735b:	e8 32 cd ff ff       	call   f0104092 <cprintf>
+f0107360:	83 c4 10             	add    $0x10,%esp
+f0107363:	e9 0b ff ff ff       	jmp    f0107273 <boottime_print+0x7f>
+	cprintf("  %-18s %12s %12s\n", "step", hz ? "at ms" : "at",
+f0107368:	8d 93 e9 5f ff ff    	lea    -0xa017(%ebx),%edx
+f010736e:	8d 83 f1 5f ff ff    	lea    -0xa00f(%ebx),%eax
+f0107374:	e9 18 ff ff ff       	jmp    f0107291 <boottime_print+0x9d>
+				print_step("zboot segment", i - zidx + 1, tsc);
+f0107379:	89 f2                	mov    %esi,%edx
+f010737b:	29 fa                	sub    %edi,%edx
+f010737d:	83 ec 08             	sub    $0x8,%esp
+f0107380:	ff 75 e4             	push   -0x1c(%ebp)
+f0107383:	ff 75 e0             	push   -0x20(%ebp)
+f0107386:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0107389:	e8 c0 fd ff ff       	call   f010714e <print_step>
+f010738e:	83 c4 10             	add    $0x10,%esp
+f0107391:	83 c6 01             	add    $0x1,%esi
+f0107394:	8d 4e ff             	lea    -0x1(%esi),%ecx
+		for (i = 0; i < ntsc; i++) {
+f0107397:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f010739a:	39 c6                	cmp    %eax,%esi
+f010739c:	74 47                	je     f01073e5 <boottime_print+0x1f1>
+			tsc += (uint32_t) (bi->bi_tsc[i] - (uint32_t) tsc);
+f010739e:	8b 04 8d 18 60 00 f0 	mov    -0xfff9fe8(,%ecx,4),%eax
+f01073a5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f01073a8:	29 d0                	sub    %edx,%eax
+f01073aa:	ba 00 00 00 00       	mov    $0x0,%edx
+f01073af:	01 45 e0             	add    %eax,-0x20(%ebp)
+f01073b2:	11 55 e4             	adc    %edx,-0x1c(%ebp)
+f01073b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01073b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+			if (i < zidx)
+f01073bb:	39 f9                	cmp    %edi,%ecx
+f01073bd:	73 ba                	jae    f0107379 <boottime_print+0x185>
+				print_step("boot read", i + 1, tsc);
+f01073bf:	83 ec 08             	sub    $0x8,%esp
+f01073c2:	52                   	push   %edx
+f01073c3:	50                   	push   %eax
+f01073c4:	89 f2                	mov    %esi,%edx
+f01073c6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01073c9:	e8 80 fd ff ff       	call   f010714e <print_step>
+f01073ce:	83 c4 10             	add    $0x10,%esp
+f01073d1:	eb be                	jmp    f0107391 <boottime_print+0x19d>
+		}
+	} else
+		cprintf("  (no loader timestamps)\n");
+f01073d3:	83 ec 0c             	sub    $0xc,%esp
+f01073d6:	8d 83 30 60 ff ff    	lea    -0x9fd0(%ebx),%eax
+f01073dc:	50                   	push   %eax
+f01073dd:	e8 b0 cc ff ff       	call   f0104092 <cprintf>
+f01073e2:	83 c4 10             	add    $0x10,%esp
+f01073e5:	8d b3 68 01 00 00    	lea    0x168(%ebx),%esi
+f01073eb:	8d 9b d4 ff ff ff    	lea    -0x2c(%ebx),%ebx
+f01073f1:	8d 7e 14             	lea    0x14(%esi),%edi
+f01073f4:	eb 06                	jmp    f01073fc <boottime_print+0x208>
+f01073f6:	83 c6 04             	add    $0x4,%esi
+f01073f9:	83 c3 08             	add    $0x8,%ebx
+
+	for (i = 0; i < NBOOTTSC; i++)
+f01073fc:	39 fe                	cmp    %edi,%esi
+f01073fe:	74 21                	je     f0107421 <boottime_print+0x22d>
+		if (boot_tsc[i])
+f0107400:	8b 13                	mov    (%ebx),%edx
+f0107402:	8b 4b 04             	mov    0x4(%ebx),%ecx
+f0107405:	89 c8                	mov    %ecx,%eax
+f0107407:	09 d0                	or     %edx,%eax
+f0107409:	74 eb                	je     f01073f6 <boottime_print+0x202>
+			print_step(phasenames[i], 0, boot_tsc[i]);
+f010740b:	8b 06                	mov    (%esi),%eax
+f010740d:	83 ec 08             	sub    $0x8,%esp
+f0107410:	51                   	push   %ecx
+f0107411:	52                   	push   %edx
+f0107412:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107417:	e8 32 fd ff ff       	call   f010714e <print_step>
+f010741c:	83 c4 10             	add    $0x10,%esp
+f010741f:	eb d5                	jmp    f01073f6 <boottime_print+0x202>
+}
+f0107421:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107424:	5b                   	pop    %ebx
+f0107425:	5e                   	pop    %esi
+f0107426:	5f                   	pop    %edi
+f0107427:	5d                   	pop    %ebp
+f0107428:	c3                   	ret
+
+f0107429 <parsespec>:
+// which of the ps_nstar arguments will supply the width or precision.
+// This fails, returning NULL, if where later characters of the
+// specification go would depend on an argument's value.
+static const char *
+parsespec(const char *fmt, struct Printfspec *ps, va_list *ap)
+{
+f0107429:	55                   	push   %ebp
+f010742a:	89 e5                	mov    %esp,%ebp
+f010742c:	57                   	push   %edi
+f010742d:	56                   	push   %esi
+f010742e:	53                   	push   %ebx
+f010742f:	83 ec 04             	sub    $0x4,%esp
+f0107432:	e8 18 8f ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0107437:	81 c3 55 e0 00 00    	add    $0xe055,%ebx
+f010743d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+	int ch;
+
+	ps->ps_padc = ' ';
+f0107440:	c6 42 01 20          	movb   $0x20,0x1(%edx)
+	ps->ps_width = -1;
+f0107444:	c7 42 04 ff ff ff ff 	movl   $0xffffffff,0x4(%edx)
+	ps->ps_precision = -1;
+f010744b:	c7 42 08 ff ff ff ff 	movl   $0xffffffff,0x8(%edx)
+	ps->ps_lflag = 0;
+f0107452:	c6 42 02 00          	movb   $0x0,0x2(%edx)
+	ps->ps_altflag = 0;
+f0107456:	c6 42 03 00          	movb   $0x0,0x3(%edx)
+	ps->ps_nstar = ps->ps_wstar = ps->ps_pstar = 0;
+f010745a:	c6 42 0e 00          	movb   $0x0,0xe(%edx)
+f010745e:	c6 42 0d 00          	movb   $0x0,0xd(%edx)
+f0107462:	c6 42 0c 00          	movb   $0x0,0xc(%edx)
+reswitch:
+	switch (ch = *(unsigned char *) fmt++) {
+f0107466:	8d 70 01             	lea    0x1(%eax),%esi
+f0107469:	0f b6 00             	movzbl (%eax),%eax
+f010746c:	3c 39                	cmp    $0x39,%al
+f010746e:	77 1a                	ja     f010748a <parsespec+0x61>
+f0107470:	3c 22                	cmp    $0x22,%al
+f0107472:	76 3a                	jbe    f01074ae <.L5>
+f0107474:	8d 48 dd             	lea    -0x23(%eax),%ecx
+f0107477:	80 f9 16             	cmp    $0x16,%cl
+f010747a:	77 32                	ja     f01074ae <.L5>
+f010747c:	0f b6 c9             	movzbl %cl,%ecx
+f010747f:	89 df                	mov    %ebx,%edi
+f0107481:	03 bc 8b e8 60 ff ff 	add    -0x9f18(%ebx,%ecx,4),%edi
+f0107488:	ff e7                	jmp    *%edi
+f010748a:	8d 48 9d             	lea    -0x63(%eax),%ecx
+f010748d:	80 f9 15             	cmp    $0x15,%cl
+f0107490:	77 1c                	ja     f01074ae <.L5>
+f0107492:	bf 01 00 00 00       	mov    $0x1,%edi
+f0107497:	d3 e7                	shl    %cl,%edi
+f0107499:	f7 c7 07 34 25 00    	test   $0x253407,%edi
+f010749f:	0f 85 f3 00 00 00    	jne    f0107598 <.L6>
+f01074a5:	80 f9 09             	cmp    $0x9,%cl
+f01074a8:	0f 84 df 00 00 00    	je     f010758d <.L14+0xb>
+
+f01074ae <.L5>:
+		ps->ps_conv = ch;
+		return fmt;
+
+	// unrecognized escape sequence
+	default:
+		if (!ap && ps->ps_nstar)
+f01074ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+f01074b2:	0f 84 ec 00 00 00    	je     f01075a4 <.L6+0xc>
+			return NULL;
+		ps->ps_conv = 0;
+f01074b8:	c6 02 00             	movb   $0x0,(%edx)
+		return fmt;
+f01074bb:	e9 da 00 00 00       	jmp    f010759a <.L6+0x2>
+
+f01074c0 <.L12>:
+		ps->ps_padc = '-';
+f01074c0:	c6 42 01 2d          	movb   $0x2d,0x1(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f01074c4:	89 f0                	mov    %esi,%eax
+		goto reswitch;
+f01074c6:	eb 9e                	jmp    f0107466 <parsespec+0x3d>
+
+f01074c8 <.L10>:
+		ps->ps_padc = '0';
+f01074c8:	c6 42 01 30          	movb   $0x30,0x1(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f01074cc:	89 f0                	mov    %esi,%eax
+		goto reswitch;
+f01074ce:	eb 96                	jmp    f0107466 <parsespec+0x3d>
+
+f01074d0 <.L8>:
+		if (ps->ps_wstar)
+f01074d0:	80 7a 0d 00          	cmpb   $0x0,0xd(%edx)
+f01074d4:	0f 85 d9 00 00 00    	jne    f01075b3 <.L6+0x1b>
+	switch (ch = *(unsigned char *) fmt++) {
+f01074da:	0f b6 c0             	movzbl %al,%eax
+		for (ps->ps_precision = 0; ; ++fmt) {
+f01074dd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+			ps->ps_precision = ps->ps_precision * 10 + ch - '0';
+f01074e4:	8b 4a 08             	mov    0x8(%edx),%ecx
+f01074e7:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+f01074ea:	8d 44 48 d0          	lea    -0x30(%eax,%ecx,2),%eax
+f01074ee:	89 42 08             	mov    %eax,0x8(%edx)
+			ch = *fmt;
+f01074f1:	0f be 06             	movsbl (%esi),%eax
+			if (ch < '0' || ch > '9')
+f01074f4:	8d 48 d0             	lea    -0x30(%eax),%ecx
+f01074f7:	83 f9 09             	cmp    $0x9,%ecx
+f01074fa:	77 05                	ja     f0107501 <.L8+0x31>
+		for (ps->ps_precision = 0; ; ++fmt) {
+f01074fc:	83 c6 01             	add    $0x1,%esi
+			ps->ps_precision = ps->ps_precision * 10 + ch - '0';
+f01074ff:	eb e3                	jmp    f01074e4 <.L8+0x14>
+		ps->ps_pstar = 0;
+f0107501:	c6 42 0e 00          	movb   $0x0,0xe(%edx)
+		goto process_precision;
+f0107505:	89 f0                	mov    %esi,%eax
+		if (ps->ps_width < 0)
+f0107507:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+f010750b:	0f 89 55 ff ff ff    	jns    f0107466 <parsespec+0x3d>
+			ps->ps_width = ps->ps_precision, ps->ps_precision = -1;
+f0107511:	8b 4a 08             	mov    0x8(%edx),%ecx
+f0107514:	89 4a 04             	mov    %ecx,0x4(%edx)
+f0107517:	c7 42 08 ff ff ff ff 	movl   $0xffffffff,0x8(%edx)
+f010751e:	e9 43 ff ff ff       	jmp    f0107466 <parsespec+0x3d>
+
+f0107523 <.L13>:
+		if (ap) {
+f0107523:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0107526:	85 ff                	test   %edi,%edi
+f0107528:	74 10                	je     f010753a <.L13+0x17>
+			ps->ps_precision = va_arg(*ap, int);
+f010752a:	8b 07                	mov    (%edi),%eax
+f010752c:	8d 48 04             	lea    0x4(%eax),%ecx
+f010752f:	89 0f                	mov    %ecx,(%edi)
+f0107531:	8b 00                	mov    (%eax),%eax
+f0107533:	89 42 08             	mov    %eax,0x8(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f0107536:	89 f0                	mov    %esi,%eax
+			goto process_precision;
+f0107538:	eb cd                	jmp    f0107507 <.L8+0x37>
+		if (ps->ps_wstar)
+f010753a:	80 7a 0d 00          	cmpb   $0x0,0xd(%edx)
+f010753e:	75 7a                	jne    f01075ba <.L6+0x22>
+		ps->ps_nstar++;
+f0107540:	0f b6 42 0c          	movzbl 0xc(%edx),%eax
+f0107544:	83 c0 01             	add    $0x1,%eax
+f0107547:	88 42 0c             	mov    %al,0xc(%edx)
+		if (ps->ps_width < 0)
+f010754a:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+f010754e:	78 0a                	js     f010755a <.L13+0x37>
+			ps->ps_pstar = ps->ps_nstar;
+f0107550:	88 42 0e             	mov    %al,0xe(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f0107553:	89 f0                	mov    %esi,%eax
+f0107555:	e9 0c ff ff ff       	jmp    f0107466 <parsespec+0x3d>
+			ps->ps_wstar = ps->ps_nstar;
+f010755a:	88 42 0d             	mov    %al,0xd(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f010755d:	89 f0                	mov    %esi,%eax
+f010755f:	e9 02 ff ff ff       	jmp    f0107466 <parsespec+0x3d>
+
+f0107564 <.L11>:
+		if (ps->ps_wstar)
+f0107564:	80 7a 0d 00          	cmpb   $0x0,0xd(%edx)
+f0107568:	75 55                	jne    f01075bf <.L6+0x27>
+	switch (ch = *(unsigned char *) fmt++) {
+f010756a:	89 f0                	mov    %esi,%eax
+		if (ps->ps_width < 0)
+f010756c:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+f0107570:	0f 89 f0 fe ff ff    	jns    f0107466 <parsespec+0x3d>
+			ps->ps_width = 0;
+f0107576:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+f010757d:	e9 e4 fe ff ff       	jmp    f0107466 <parsespec+0x3d>
+
+f0107582 <.L14>:
+		ps->ps_altflag = 1;
+f0107582:	c6 42 03 01          	movb   $0x1,0x3(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f0107586:	89 f0                	mov    %esi,%eax
+		goto reswitch;
+f0107588:	e9 d9 fe ff ff       	jmp    f0107466 <parsespec+0x3d>
+		ps->ps_lflag++;
+f010758d:	80 42 02 01          	addb   $0x1,0x2(%edx)
+	switch (ch = *(unsigned char *) fmt++) {
+f0107591:	89 f0                	mov    %esi,%eax
+		goto reswitch;
+f0107593:	e9 ce fe ff ff       	jmp    f0107466 <parsespec+0x3d>
+
+f0107598 <.L6>:
+		ps->ps_conv = ch;
+f0107598:	88 02                	mov    %al,(%edx)
+	}
+}
+f010759a:	89 f0                	mov    %esi,%eax
+f010759c:	83 c4 04             	add    $0x4,%esp
+f010759f:	5b                   	pop    %ebx
+f01075a0:	5e                   	pop    %esi
+f01075a1:	5f                   	pop    %edi
+f01075a2:	5d                   	pop    %ebp
+f01075a3:	c3                   	ret
+		if (!ap && ps->ps_nstar)
+f01075a4:	80 7a 0c 00          	cmpb   $0x0,0xc(%edx)
+f01075a8:	0f 84 0a ff ff ff    	je     f01074b8 <.L5+0xa>
+			return NULL;
+f01075ae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f01075b1:	eb e7                	jmp    f010759a <.L6+0x2>
+			return NULL;
+f01075b3:	be 00 00 00 00       	mov    $0x0,%esi
+f01075b8:	eb e0                	jmp    f010759a <.L6+0x2>
+			return NULL;
+f01075ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f01075bd:	eb db                	jmp    f010759a <.L6+0x2>
+			return NULL;
+f01075bf:	be 00 00 00 00       	mov    $0x0,%esi
+f01075c4:	eb d4                	jmp    f010759a <.L6+0x2>
+
+f01075c6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f01075c6:	55                   	push   %ebp
+f01075c7:	89 e5                	mov    %esp,%ebp
+f01075c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+f01075cc:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+f01075d0:	8b 10                	mov    (%eax),%edx
+f01075d2:	3b 50 04             	cmp    0x4(%eax),%edx
+f01075d5:	73 0a                	jae    f01075e1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+f01075d7:	8d 4a 01             	lea    0x1(%edx),%ecx
+f01075da:	89 08                	mov    %ecx,(%eax)
+f01075dc:	8b 45 08             	mov    0x8(%ebp),%eax
+f01075df:	88 02                	mov    %al,(%edx)
+}
+f01075e1:	5d                   	pop    %ebp
+f01075e2:	c3                   	ret
+
+f01075e3 <printfmt>:
+{
+f01075e3:	55                   	push   %ebp
+f01075e4:	89 e5                	mov    %esp,%ebp
+f01075e6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+f01075e9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+f01075ec:	50                   	push   %eax
+f01075ed:	ff 75 10             	push   0x10(%ebp)
+f01075f0:	ff 75 0c             	push   0xc(%ebp)
+f01075f3:	ff 75 08             	push   0x8(%ebp)
+f01075f6:	e8 2c 05 00 00       	call   f0107b27 <vprintfmt>
+}
+f01075fb:	83 c4 10             	add    $0x10,%esp
+f01075fe:	c9                   	leave
+f01075ff:	c3                   	ret
+
+f0107600 <printspec>:
+{
+f0107600:	55                   	push   %ebp
+f0107601:	89 e5                	mov    %esp,%ebp
+f0107603:	57                   	push   %edi
+f0107604:	56                   	push   %esi
+f0107605:	53                   	push   %ebx
+f0107606:	83 ec 5c             	sub    $0x5c,%esp
+f0107609:	e8 dc 99 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f010760e:	81 c6 7e de 00 00    	add    $0xde7e,%esi
+f0107614:	89 75 b4             	mov    %esi,-0x4c(%ebp)
+f0107617:	89 45 bc             	mov    %eax,-0x44(%ebp)
+f010761a:	89 55 b0             	mov    %edx,-0x50(%ebp)
+f010761d:	89 ca                	mov    %ecx,%edx
+f010761f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	padc = ps->ps_padc;
+f0107622:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+f0107626:	88 45 a7             	mov    %al,-0x59(%ebp)
+	width = ps->ps_width;
+f0107629:	8b 41 04             	mov    0x4(%ecx),%eax
+f010762c:	89 45 b8             	mov    %eax,-0x48(%ebp)
+	precision = ps->ps_precision;
+f010762f:	8b 71 08             	mov    0x8(%ecx),%esi
+	lflag = ps->ps_lflag;
+f0107632:	0f b6 49 02          	movzbl 0x2(%ecx),%ecx
+	altflag = ps->ps_altflag;
+f0107636:	0f b6 42 03          	movzbl 0x3(%edx),%eax
+f010763a:	88 45 a8             	mov    %al,-0x58(%ebp)
+	for (i = 1; i <= ps->ps_nstar; i++) {
+f010763d:	b8 01 00 00 00       	mov    $0x1,%eax
+f0107642:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+f0107645:	eb 06                	jmp    f010764d <printspec+0x4d>
+			width = ch;
+f0107647:	89 4d b8             	mov    %ecx,-0x48(%ebp)
+	for (i = 1; i <= ps->ps_nstar; i++) {
+f010764a:	83 c0 01             	add    $0x1,%eax
+f010764d:	0f b6 4a 0c          	movzbl 0xc(%edx),%ecx
+f0107651:	39 c1                	cmp    %eax,%ecx
+f0107653:	7c 1c                	jl     f0107671 <printspec+0x71>
+		ch = va_arg(*ap, int);
+f0107655:	8b 0b                	mov    (%ebx),%ecx
+f0107657:	8d 79 04             	lea    0x4(%ecx),%edi
+f010765a:	89 3b                	mov    %edi,(%ebx)
+f010765c:	8b 09                	mov    (%ecx),%ecx
+		if (i == ps->ps_wstar)
+f010765e:	0f b6 7a 0d          	movzbl 0xd(%edx),%edi
+f0107662:	39 c7                	cmp    %eax,%edi
+f0107664:	74 e1                	je     f0107647 <printspec+0x47>
+		else if (i == ps->ps_pstar)
+f0107666:	0f b6 7a 0e          	movzbl 0xe(%edx),%edi
+			precision = ch;
+f010766a:	39 c7                	cmp    %eax,%edi
+f010766c:	0f 44 f1             	cmove  %ecx,%esi
+f010766f:	eb d9                	jmp    f010764a <printspec+0x4a>
+	switch (ps->ps_conv) {
+f0107671:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0107674:	0f b6 02             	movzbl (%edx),%eax
+f0107677:	3c 25                	cmp    $0x25,%al
+f0107679:	0f 84 96 04 00 00    	je     f0107b15 <.L42+0x8>
+f010767f:	8d 50 9d             	lea    -0x63(%eax),%edx
+f0107682:	80 fa 15             	cmp    $0x15,%dl
+f0107685:	0f 87 82 04 00 00    	ja     f0107b0d <.L42>
+f010768b:	0f 87 7c 04 00 00    	ja     f0107b0d <.L42>
+f0107691:	0f b6 c2             	movzbl %dl,%eax
+f0107694:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+f0107697:	89 fa                	mov    %edi,%edx
+f0107699:	03 94 87 44 61 ff ff 	add    -0x9ebc(%edi,%eax,4),%edx
+f01076a0:	ff e2                	jmp    *%edx
+
+f01076a2 <.L57>:
+		putch(va_arg(*ap, int), putdat);
+f01076a2:	8b 03                	mov    (%ebx),%eax
+f01076a4:	8d 50 04             	lea    0x4(%eax),%edx
+f01076a7:	89 13                	mov    %edx,(%ebx)
+f01076a9:	83 ec 08             	sub    $0x8,%esp
+f01076ac:	ff 75 b0             	push   -0x50(%ebp)
+f01076af:	ff 30                	push   (%eax)
+f01076b1:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f01076b4:	ff d0                	call   *%eax
+		break;
+f01076b6:	83 c4 10             	add    $0x10,%esp
+f01076b9:	e9 4f 04 00 00       	jmp    f0107b0d <.L42>
+
+f01076be <.L55>:
+		err = va_arg(*ap, int);
+f01076be:	8b 03                	mov    (%ebx),%eax
+f01076c0:	8d 50 04             	lea    0x4(%eax),%edx
+f01076c3:	89 13                	mov    %edx,(%ebx)
+		if (err < 0)
+f01076c5:	8b 10                	mov    (%eax),%edx
+f01076c7:	89 d0                	mov    %edx,%eax
+f01076c9:	f7 d8                	neg    %eax
+f01076cb:	0f 48 c2             	cmovs  %edx,%eax
+		if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f01076ce:	83 f8 07             	cmp    $0x7,%eax
+f01076d1:	7f 2c                	jg     f01076ff <.L55+0x41>
+f01076d3:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+f01076d6:	8b 94 86 94 01 00 00 	mov    0x194(%esi,%eax,4),%edx
+f01076dd:	85 d2                	test   %edx,%edx
+f01076df:	74 1e                	je     f01076ff <.L55+0x41>
+			printfmt(putch, putdat, "%s", p);
+f01076e1:	52                   	push   %edx
+f01076e2:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f01076e5:	8d 80 f6 5d ff ff    	lea    -0xa20a(%eax),%eax
+f01076eb:	50                   	push   %eax
+f01076ec:	ff 75 b0             	push   -0x50(%ebp)
+f01076ef:	ff 75 bc             	push   -0x44(%ebp)
+f01076f2:	e8 ec fe ff ff       	call   f01075e3 <printfmt>
+f01076f7:	83 c4 10             	add    $0x10,%esp
+f01076fa:	e9 0e 04 00 00       	jmp    f0107b0d <.L42>
+			printfmt(putch, putdat, "error %d", err);
+f01076ff:	50                   	push   %eax
+f0107700:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f0107703:	8d 80 a3 61 ff ff    	lea    -0x9e5d(%eax),%eax
+f0107709:	50                   	push   %eax
+f010770a:	ff 75 b0             	push   -0x50(%ebp)
+f010770d:	ff 75 bc             	push   -0x44(%ebp)
+f0107710:	e8 ce fe ff ff       	call   f01075e3 <printfmt>
+f0107715:	83 c4 10             	add    $0x10,%esp
+f0107718:	e9 f0 03 00 00       	jmp    f0107b0d <.L42>
+
+f010771d <.L51>:
+		if ((p = va_arg(*ap, char *)) == NULL)
+f010771d:	8b 03                	mov    (%ebx),%eax
+f010771f:	8d 50 04             	lea    0x4(%eax),%edx
+f0107722:	89 13                	mov    %edx,(%ebx)
+f0107724:	8b 38                	mov    (%eax),%edi
+			p = "(null)";
+f0107726:	85 ff                	test   %edi,%edi
+f0107728:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f010772b:	8d 80 9c 61 ff ff    	lea    -0x9e64(%eax),%eax
+f0107731:	0f 44 f8             	cmove  %eax,%edi
+		if (width > 0 && padc != '-')
+f0107734:	83 7d b8 00          	cmpl   $0x0,-0x48(%ebp)
+f0107738:	7e 06                	jle    f0107740 <.L51+0x23>
+f010773a:	80 7d a7 2d          	cmpb   $0x2d,-0x59(%ebp)
+f010773e:	75 0a                	jne    f010774a <.L51+0x2d>
+			for (width -= strnlen(p, precision); width > 0; width--)
+f0107740:	89 f9                	mov    %edi,%ecx
+f0107742:	89 7d c0             	mov    %edi,-0x40(%ebp)
+f0107745:	8b 7d bc             	mov    -0x44(%ebp),%edi
+f0107748:	eb 69                	jmp    f01077b3 <.L51+0x96>
+f010774a:	83 ec 08             	sub    $0x8,%esp
+f010774d:	56                   	push   %esi
+f010774e:	57                   	push   %edi
+f010774f:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f0107752:	e8 ca 07 00 00       	call   f0107f21 <strnlen>
+f0107757:	89 c2                	mov    %eax,%edx
+f0107759:	8b 45 b8             	mov    -0x48(%ebp),%eax
+f010775c:	29 d0                	sub    %edx,%eax
+f010775e:	83 c4 10             	add    $0x10,%esp
+f0107761:	89 c3                	mov    %eax,%ebx
+				putch(padc, putdat);
+f0107763:	0f be 55 a7          	movsbl -0x59(%ebp),%edx
+f0107767:	89 7d c0             	mov    %edi,-0x40(%ebp)
+f010776a:	89 75 b8             	mov    %esi,-0x48(%ebp)
+f010776d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+f0107770:	8b 75 b0             	mov    -0x50(%ebp),%esi
+f0107773:	89 d7                	mov    %edx,%edi
+			for (width -= strnlen(p, precision); width > 0; width--)
+f0107775:	eb 10                	jmp    f0107787 <.L51+0x6a>
+				putch(padc, putdat);
+f0107777:	83 ec 08             	sub    $0x8,%esp
+f010777a:	56                   	push   %esi
+f010777b:	57                   	push   %edi
+f010777c:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f010777f:	ff d0                	call   *%eax
+			for (width -= strnlen(p, precision); width > 0; width--)
+f0107781:	83 eb 01             	sub    $0x1,%ebx
+f0107784:	83 c4 10             	add    $0x10,%esp
+f0107787:	85 db                	test   %ebx,%ebx
+f0107789:	7f ec                	jg     f0107777 <.L51+0x5a>
+f010778b:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f010778e:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0107791:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f0107794:	85 c0                	test   %eax,%eax
+f0107796:	ba 00 00 00 00       	mov    $0x0,%edx
+f010779b:	0f 49 d0             	cmovns %eax,%edx
+f010779e:	29 d0                	sub    %edx,%eax
+f01077a0:	89 45 b8             	mov    %eax,-0x48(%ebp)
+f01077a3:	eb 9b                	jmp    f0107740 <.L51+0x23>
+				putch(ch, putdat);
+f01077a5:	83 ec 08             	sub    $0x8,%esp
+f01077a8:	ff 75 b0             	push   -0x50(%ebp)
+f01077ab:	52                   	push   %edx
+f01077ac:	ff d7                	call   *%edi
+f01077ae:	83 c4 10             	add    $0x10,%esp
+		for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f01077b1:	89 d9                	mov    %ebx,%ecx
+f01077b3:	8d 59 01             	lea    0x1(%ecx),%ebx
+f01077b6:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+f01077ba:	0f be d0             	movsbl %al,%edx
+f01077bd:	85 d2                	test   %edx,%edx
+f01077bf:	74 29                	je     f01077ea <.L51+0xcd>
+f01077c1:	85 f6                	test   %esi,%esi
+f01077c3:	78 05                	js     f01077ca <.L51+0xad>
+f01077c5:	83 ee 01             	sub    $0x1,%esi
+f01077c8:	78 32                	js     f01077fc <.L51+0xdf>
+			if (altflag && (ch < ' ' || ch > '~'))
+f01077ca:	80 7d a8 00          	cmpb   $0x0,-0x58(%ebp)
+f01077ce:	74 d5                	je     f01077a5 <.L51+0x88>
+f01077d0:	0f be c0             	movsbl %al,%eax
+f01077d3:	83 e8 20             	sub    $0x20,%eax
+f01077d6:	83 f8 5e             	cmp    $0x5e,%eax
+f01077d9:	76 ca                	jbe    f01077a5 <.L51+0x88>
+				putch('?', putdat);
+f01077db:	83 ec 08             	sub    $0x8,%esp
+f01077de:	ff 75 b0             	push   -0x50(%ebp)
+f01077e1:	6a 3f                	push   $0x3f
+f01077e3:	ff d7                	call   *%edi
+f01077e5:	83 c4 10             	add    $0x10,%esp
+f01077e8:	eb c7                	jmp    f01077b1 <.L51+0x94>
+f01077ea:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01077ed:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+f01077f0:	01 fb                	add    %edi,%ebx
+f01077f2:	29 cb                	sub    %ecx,%ebx
+f01077f4:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f01077f7:	8b 7d b0             	mov    -0x50(%ebp),%edi
+f01077fa:	eb 13                	jmp    f010780f <.L51+0xf2>
+f01077fc:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f01077ff:	eb ec                	jmp    f01077ed <.L51+0xd0>
+			putch(' ', putdat);
+f0107801:	83 ec 08             	sub    $0x8,%esp
+f0107804:	57                   	push   %edi
+f0107805:	6a 20                	push   $0x20
+f0107807:	ff d6                	call   *%esi
+		for (; width > 0; width--)
+f0107809:	83 eb 01             	sub    $0x1,%ebx
+f010780c:	83 c4 10             	add    $0x10,%esp
+f010780f:	85 db                	test   %ebx,%ebx
+f0107811:	7f ee                	jg     f0107801 <.L51+0xe4>
+f0107813:	e9 f5 02 00 00       	jmp    f0107b0d <.L42>
+
+f0107818 <.L56>:
+	if (lflag >= 2)
+f0107818:	83 f9 01             	cmp    $0x1,%ecx
+f010781b:	7f 14                	jg     f0107831 <.L56+0x19>
+	else if (lflag)
+f010781d:	85 c9                	test   %ecx,%ecx
+f010781f:	74 2e                	je     f010784f <.L56+0x37>
+		return va_arg(*ap, long);
+f0107821:	8b 03                	mov    (%ebx),%eax
+f0107823:	8d 50 04             	lea    0x4(%eax),%edx
+f0107826:	89 13                	mov    %edx,(%ebx)
+f0107828:	8b 30                	mov    (%eax),%esi
+f010782a:	89 f7                	mov    %esi,%edi
+f010782c:	c1 ff 1f             	sar    $0x1f,%edi
+f010782f:	eb 0c                	jmp    f010783d <.L56+0x25>
+		return va_arg(*ap, long long);
+f0107831:	8b 03                	mov    (%ebx),%eax
+f0107833:	8d 50 08             	lea    0x8(%eax),%edx
+f0107836:	89 13                	mov    %edx,(%ebx)
+f0107838:	8b 30                	mov    (%eax),%esi
+f010783a:	8b 78 04             	mov    0x4(%eax),%edi
+		num = getint(ap, lflag);
+f010783d:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0107840:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+		if ((long long) num < 0) {
+f0107843:	85 ff                	test   %edi,%edi
+f0107845:	78 18                	js     f010785f <.L56+0x47>
+f0107847:	8d 75 df             	lea    -0x21(%ebp),%esi
+f010784a:	e9 20 02 00 00       	jmp    f0107a6f <.L48+0x7c>
+		return va_arg(*ap, int);
+f010784f:	8b 03                	mov    (%ebx),%eax
+f0107851:	8d 50 04             	lea    0x4(%eax),%edx
+f0107854:	89 13                	mov    %edx,(%ebx)
+f0107856:	8b 30                	mov    (%eax),%esi
+f0107858:	89 f7                	mov    %esi,%edi
+f010785a:	c1 ff 1f             	sar    $0x1f,%edi
+f010785d:	eb de                	jmp    f010783d <.L56+0x25>
+			putch('-', putdat);
+f010785f:	83 ec 08             	sub    $0x8,%esp
+f0107862:	ff 75 b0             	push   -0x50(%ebp)
+f0107865:	6a 2d                	push   $0x2d
+f0107867:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f010786a:	ff d0                	call   *%eax
+			num = -(long long) num;
+f010786c:	f7 de                	neg    %esi
+f010786e:	83 d7 00             	adc    $0x0,%edi
+f0107871:	f7 df                	neg    %edi
+f0107873:	89 75 c0             	mov    %esi,-0x40(%ebp)
+f0107876:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0107879:	83 c4 10             	add    $0x10,%esp
+f010787c:	eb c9                	jmp    f0107847 <.L56+0x2f>
+
+f010787e <.L50>:
+	if (lflag >= 2)
+f010787e:	83 f9 01             	cmp    $0x1,%ecx
+f0107881:	7f 1a                	jg     f010789d <.L50+0x1f>
+	else if (lflag)
+f0107883:	85 c9                	test   %ecx,%ecx
+f0107885:	74 2a                	je     f01078b1 <.L50+0x33>
+		return va_arg(*ap, unsigned long);
+f0107887:	8b 03                	mov    (%ebx),%eax
+f0107889:	8d 50 04             	lea    0x4(%eax),%edx
+f010788c:	89 13                	mov    %edx,(%ebx)
+f010788e:	8b 00                	mov    (%eax),%eax
+f0107890:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107895:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0107898:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f010789b:	eb aa                	jmp    f0107847 <.L56+0x2f>
+		return va_arg(*ap, unsigned long long);
+f010789d:	8b 03                	mov    (%ebx),%eax
+f010789f:	8d 50 08             	lea    0x8(%eax),%edx
+f01078a2:	89 13                	mov    %edx,(%ebx)
+f01078a4:	8b 50 04             	mov    0x4(%eax),%edx
+f01078a7:	8b 00                	mov    (%eax),%eax
+f01078a9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f01078ac:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f01078af:	eb 96                	jmp    f0107847 <.L56+0x2f>
+		return va_arg(*ap, unsigned int);
+f01078b1:	8b 03                	mov    (%ebx),%eax
+f01078b3:	8d 50 04             	lea    0x4(%eax),%edx
+f01078b6:	89 13                	mov    %edx,(%ebx)
+f01078b8:	8b 00                	mov    (%eax),%eax
+f01078ba:	ba 00 00 00 00       	mov    $0x0,%edx
+f01078bf:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f01078c2:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+f01078c5:	eb 80                	jmp    f0107847 <.L56+0x2f>
+
+f01078c7 <.L53>:
+	if (lflag >= 2)
+f01078c7:	83 f9 01             	cmp    $0x1,%ecx
+f01078ca:	7f 1a                	jg     f01078e6 <.L53+0x1f>
+	else if (lflag)
+f01078cc:	85 c9                	test   %ecx,%ecx
+f01078ce:	74 38                	je     f0107908 <.L53+0x41>
+		return va_arg(*ap, unsigned long);
+f01078d0:	8b 03                	mov    (%ebx),%eax
+f01078d2:	8d 50 04             	lea    0x4(%eax),%edx
+f01078d5:	89 13                	mov    %edx,(%ebx)
+f01078d7:	8b 00                	mov    (%eax),%eax
+f01078d9:	ba 00 00 00 00       	mov    $0x0,%edx
+f01078de:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f01078e1:	89 55 ac             	mov    %edx,-0x54(%ebp)
+f01078e4:	eb 12                	jmp    f01078f8 <.L53+0x31>
+		return va_arg(*ap, unsigned long long);
+f01078e6:	8b 03                	mov    (%ebx),%eax
+f01078e8:	8d 50 08             	lea    0x8(%eax),%edx
+f01078eb:	89 13                	mov    %edx,(%ebx)
+f01078ed:	8b 50 04             	mov    0x4(%eax),%edx
+f01078f0:	8b 00                	mov    (%eax),%eax
+f01078f2:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f01078f5:	89 55 ac             	mov    %edx,-0x54(%ebp)
+		printnum(putch, putdat, num, base, width, padc);
+f01078f8:	0f be 5d a7          	movsbl -0x59(%ebp),%ebx
+f01078fc:	b8 08 00 00 00       	mov    $0x8,%eax
+		shift = (base == 16 ? 4 : 3);
+f0107901:	b9 03 00 00 00       	mov    $0x3,%ecx
+f0107906:	eb 51                	jmp    f0107959 <.L52+0x3b>
+		return va_arg(*ap, unsigned int);
+f0107908:	8b 03                	mov    (%ebx),%eax
+f010790a:	8d 50 04             	lea    0x4(%eax),%edx
+f010790d:	89 13                	mov    %edx,(%ebx)
+f010790f:	8b 00                	mov    (%eax),%eax
+f0107911:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107916:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107919:	89 55 ac             	mov    %edx,-0x54(%ebp)
+f010791c:	eb da                	jmp    f01078f8 <.L53+0x31>
+
+f010791e <.L52>:
+		putch('0', putdat);
+f010791e:	83 ec 08             	sub    $0x8,%esp
+f0107921:	8b 7d b0             	mov    -0x50(%ebp),%edi
+f0107924:	57                   	push   %edi
+f0107925:	6a 30                	push   $0x30
+f0107927:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f010792a:	ff d6                	call   *%esi
+		putch('x', putdat);
+f010792c:	83 c4 08             	add    $0x8,%esp
+f010792f:	57                   	push   %edi
+f0107930:	6a 78                	push   $0x78
+f0107932:	ff d6                	call   *%esi
+			(uintptr_t) va_arg(*ap, void *);
+f0107934:	8b 03                	mov    (%ebx),%eax
+f0107936:	8d 50 04             	lea    0x4(%eax),%edx
+f0107939:	89 13                	mov    %edx,(%ebx)
+		num = (unsigned long long)
+f010793b:	8b 00                	mov    (%eax),%eax
+f010793d:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107942:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107945:	89 55 ac             	mov    %edx,-0x54(%ebp)
+		goto number;
+f0107948:	83 c4 10             	add    $0x10,%esp
+		printnum(putch, putdat, num, base, width, padc);
+f010794b:	0f be 5d a7          	movsbl -0x59(%ebp),%ebx
+f010794f:	b8 10 00 00 00       	mov    $0x10,%eax
+		shift = (base == 16 ? 4 : 3);
+f0107954:	b9 04 00 00 00       	mov    $0x4,%ecx
+	char *p = buf + sizeof(buf);
+f0107959:	8d 7d e8             	lea    -0x18(%ebp),%edi
+			*--p = "0123456789abcdef"[num & (base - 1)];
+f010795c:	83 e8 01             	sub    $0x1,%eax
+f010795f:	89 45 c0             	mov    %eax,-0x40(%ebp)
+f0107962:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+f0107969:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f010796c:	8d 90 ac 61 ff ff    	lea    -0x9e54(%eax),%edx
+f0107972:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+f0107975:	89 d6                	mov    %edx,%esi
+f0107977:	8b 45 a8             	mov    -0x58(%ebp),%eax
+f010797a:	8b 55 ac             	mov    -0x54(%ebp),%edx
+f010797d:	83 ef 01             	sub    $0x1,%edi
+f0107980:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+f0107983:	21 c3                	and    %eax,%ebx
+f0107985:	0f b6 1c 1e          	movzbl (%esi,%ebx,1),%ebx
+f0107989:	88 1f                	mov    %bl,(%edi)
+			num >>= shift;
+f010798b:	0f ad d0             	shrd   %cl,%edx,%eax
+f010798e:	d3 ea                	shr    %cl,%edx
+f0107990:	f6 c1 20             	test   $0x20,%cl
+f0107993:	74 04                	je     f0107999 <.L52+0x7b>
+f0107995:	89 d0                	mov    %edx,%eax
+f0107997:	31 d2                	xor    %edx,%edx
+		} while (num);
+f0107999:	89 d3                	mov    %edx,%ebx
+f010799b:	09 c3                	or     %eax,%ebx
+f010799d:	75 de                	jne    f010797d <.L52+0x5f>
+f010799f:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+	for (width -= buf + sizeof(buf) - p; width > 0; width--)
+f01079a2:	8d 45 e8             	lea    -0x18(%ebp),%eax
+f01079a5:	29 f8                	sub    %edi,%eax
+f01079a7:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f01079aa:	29 c6                	sub    %eax,%esi
+f01079ac:	89 7d c0             	mov    %edi,-0x40(%ebp)
+f01079af:	8b 7d b0             	mov    -0x50(%ebp),%edi
+f01079b2:	e9 2f 01 00 00       	jmp    f0107ae6 <.L48+0xf3>
+
+f01079b7 <.L54>:
+	if (lflag >= 2)
+f01079b7:	83 f9 01             	cmp    $0x1,%ecx
+f01079ba:	7f 11                	jg     f01079cd <.L54+0x16>
+	else if (lflag)
+f01079bc:	85 c9                	test   %ecx,%ecx
+f01079be:	74 26                	je     f01079e6 <.L54+0x2f>
+		return va_arg(*ap, long);
+f01079c0:	8b 03                	mov    (%ebx),%eax
+f01079c2:	8d 50 04             	lea    0x4(%eax),%edx
+f01079c5:	89 13                	mov    %edx,(%ebx)
+f01079c7:	8b 00                	mov    (%eax),%eax
+f01079c9:	89 c6                	mov    %eax,%esi
+f01079cb:	eb 09                	jmp    f01079d6 <.L54+0x1f>
+		return va_arg(*ap, long long);
+f01079cd:	8b 03                	mov    (%ebx),%eax
+f01079cf:	8d 50 08             	lea    0x8(%eax),%edx
+f01079d2:	89 13                	mov    %edx,(%ebx)
+f01079d4:	8b 30                	mov    (%eax),%esi
+		cons_c = num;
+f01079d6:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+f01079d9:	c7 c2 08 43 15 f0    	mov    $0xf0154308,%edx
+f01079df:	89 32                	mov    %esi,(%edx)
+		break;
+f01079e1:	e9 27 01 00 00       	jmp    f0107b0d <.L42>
+		return va_arg(*ap, int);
+f01079e6:	8b 03                	mov    (%ebx),%eax
+f01079e8:	8d 50 04             	lea    0x4(%eax),%edx
+f01079eb:	89 13                	mov    %edx,(%ebx)
+f01079ed:	8b 00                	mov    (%eax),%eax
+f01079ef:	89 c6                	mov    %eax,%esi
+f01079f1:	eb e3                	jmp    f01079d6 <.L54+0x1f>
+
+f01079f3 <.L48>:
+	if (lflag >= 2)
+f01079f3:	83 f9 01             	cmp    $0x1,%ecx
+f01079f6:	7f 1d                	jg     f0107a15 <.L48+0x22>
+	else if (lflag)
+f01079f8:	85 c9                	test   %ecx,%ecx
+f01079fa:	74 30                	je     f0107a2c <.L48+0x39>
+		return va_arg(*ap, unsigned long);
+f01079fc:	8b 03                	mov    (%ebx),%eax
+f01079fe:	8d 50 04             	lea    0x4(%eax),%edx
+f0107a01:	89 13                	mov    %edx,(%ebx)
+f0107a03:	8b 00                	mov    (%eax),%eax
+f0107a05:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107a0a:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107a0d:	89 55 ac             	mov    %edx,-0x54(%ebp)
+f0107a10:	e9 36 ff ff ff       	jmp    f010794b <.L52+0x2d>
+		return va_arg(*ap, unsigned long long);
+f0107a15:	8b 03                	mov    (%ebx),%eax
+f0107a17:	8d 50 08             	lea    0x8(%eax),%edx
+f0107a1a:	89 13                	mov    %edx,(%ebx)
+f0107a1c:	8b 50 04             	mov    0x4(%eax),%edx
+f0107a1f:	8b 00                	mov    (%eax),%eax
+f0107a21:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107a24:	89 55 ac             	mov    %edx,-0x54(%ebp)
+f0107a27:	e9 1f ff ff ff       	jmp    f010794b <.L52+0x2d>
+		return va_arg(*ap, unsigned int);
+f0107a2c:	8b 03                	mov    (%ebx),%eax
+f0107a2e:	8d 50 04             	lea    0x4(%eax),%edx
+f0107a31:	89 13                	mov    %edx,(%ebx)
+f0107a33:	8b 00                	mov    (%eax),%eax
+f0107a35:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107a3a:	89 45 a8             	mov    %eax,-0x58(%ebp)
+f0107a3d:	89 55 ac             	mov    %edx,-0x54(%ebp)
+f0107a40:	e9 06 ff ff ff       	jmp    f010794b <.L52+0x2d>
+	return ((uint64_t) n * 0xCCCCCCCDU) >> 35;
+f0107a45:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+f0107a4a:	f7 e1                	mul    %ecx
+f0107a4c:	89 d0                	mov    %edx,%eax
+f0107a4e:	c1 e8 03             	shr    $0x3,%eax
+				*--p = '0' + (n - q * 10);
+f0107a51:	83 ef 01             	sub    $0x1,%edi
+f0107a54:	83 c1 30             	add    $0x30,%ecx
+f0107a57:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0107a5a:	01 d2                	add    %edx,%edx
+f0107a5c:	29 d1                	sub    %edx,%ecx
+f0107a5e:	88 0f                	mov    %cl,(%edi)
+			for (i = 0; i < 9; i++, n = q) {
+f0107a60:	89 c1                	mov    %eax,%ecx
+f0107a62:	39 f7                	cmp    %esi,%edi
+f0107a64:	75 df                	jne    f0107a45 <.L48+0x52>
+f0107a66:	83 ee 09             	sub    $0x9,%esi
+			num = hi;
+f0107a69:	8b 45 a8             	mov    -0x58(%ebp),%eax
+f0107a6c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0107a6f:	8d 7e 09             	lea    0x9(%esi),%edi
+		while (num > 0xFFFFFFFFU) {
+f0107a72:	83 7d c4 00          	cmpl   $0x0,-0x3c(%ebp)
+f0107a76:	76 2d                	jbe    f0107aa5 <.L48+0xb2>
+			hi = num / 1000000000;
+f0107a78:	6a 00                	push   $0x0
+f0107a7a:	68 00 ca 9a 3b       	push   $0x3b9aca00
+f0107a7f:	ff 75 c4             	push   -0x3c(%ebp)
+f0107a82:	ff 75 c0             	push   -0x40(%ebp)
+f0107a85:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+f0107a88:	e8 51 1f 00 00       	call   f01099de <__udivdi3>
+f0107a8d:	83 c4 10             	add    $0x10,%esp
+f0107a90:	89 c3                	mov    %eax,%ebx
+f0107a92:	89 55 a8             	mov    %edx,-0x58(%ebp)
+			n = num - hi * 1000000000;
+f0107a95:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+f0107a9b:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0107a9e:	29 c1                	sub    %eax,%ecx
+f0107aa0:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+			for (i = 0; i < 9; i++, n = q) {
+f0107aa3:	eb bd                	jmp    f0107a62 <.L48+0x6f>
+		n = num;
+f0107aa5:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+	return ((uint64_t) n * 0xCCCCCCCDU) >> 35;
+f0107aa8:	89 c8                	mov    %ecx,%eax
+f0107aaa:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+f0107aaf:	f7 e6                	mul    %esi
+f0107ab1:	c1 ea 03             	shr    $0x3,%edx
+f0107ab4:	89 c8                	mov    %ecx,%eax
+f0107ab6:	89 d1                	mov    %edx,%ecx
+			*--p = '0' + (n - q * 10);
+f0107ab8:	83 ef 01             	sub    $0x1,%edi
+f0107abb:	83 c0 30             	add    $0x30,%eax
+f0107abe:	8d 34 92             	lea    (%edx,%edx,4),%esi
+f0107ac1:	01 f6                	add    %esi,%esi
+f0107ac3:	89 f3                	mov    %esi,%ebx
+f0107ac5:	29 d8                	sub    %ebx,%eax
+f0107ac7:	88 07                	mov    %al,(%edi)
+		} while (n);
+f0107ac9:	85 d2                	test   %edx,%edx
+f0107acb:	75 db                	jne    f0107aa8 <.L48+0xb5>
+		printnum(putch, putdat, num, base, width, padc);
+f0107acd:	0f be 5d a7          	movsbl -0x59(%ebp),%ebx
+f0107ad1:	e9 cc fe ff ff       	jmp    f01079a2 <.L52+0x84>
+		putch(padc, putdat);
+f0107ad6:	83 ec 08             	sub    $0x8,%esp
+f0107ad9:	57                   	push   %edi
+f0107ada:	53                   	push   %ebx
+f0107adb:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0107ade:	ff d0                	call   *%eax
+	for (width -= buf + sizeof(buf) - p; width > 0; width--)
+f0107ae0:	83 ee 01             	sub    $0x1,%esi
+f0107ae3:	83 c4 10             	add    $0x10,%esp
+f0107ae6:	85 f6                	test   %esi,%esi
+f0107ae8:	7f ec                	jg     f0107ad6 <.L48+0xe3>
+f0107aea:	8b 7d c0             	mov    -0x40(%ebp),%edi
+f0107aed:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0107af0:	8b 75 b0             	mov    -0x50(%ebp),%esi
+f0107af3:	eb 11                	jmp    f0107b06 <.L48+0x113>
+		putch(*p++, putdat);
+f0107af5:	83 c7 01             	add    $0x1,%edi
+f0107af8:	83 ec 08             	sub    $0x8,%esp
+f0107afb:	56                   	push   %esi
+f0107afc:	0f be 47 ff          	movsbl -0x1(%edi),%eax
+f0107b00:	50                   	push   %eax
+f0107b01:	ff d3                	call   *%ebx
+f0107b03:	83 c4 10             	add    $0x10,%esp
+	while (p < buf + sizeof(buf))
+f0107b06:	8d 45 e8             	lea    -0x18(%ebp),%eax
+f0107b09:	39 c7                	cmp    %eax,%edi
+f0107b0b:	72 e8                	jb     f0107af5 <.L48+0x102>
+
+f0107b0d <.L42>:
+}
+f0107b0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b10:	5b                   	pop    %ebx
+f0107b11:	5e                   	pop    %esi
+f0107b12:	5f                   	pop    %edi
+f0107b13:	5d                   	pop    %ebp
+f0107b14:	c3                   	ret
+		putch('%', putdat);
+f0107b15:	83 ec 08             	sub    $0x8,%esp
+f0107b18:	ff 75 b0             	push   -0x50(%ebp)
+f0107b1b:	6a 25                	push   $0x25
+f0107b1d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0107b20:	ff d0                	call   *%eax
+		break;
+f0107b22:	83 c4 10             	add    $0x10,%esp
+}
+f0107b25:	eb e6                	jmp    f0107b0d <.L42>
+
+f0107b27 <vprintfmt>:
+{
+f0107b27:	55                   	push   %ebp
+f0107b28:	89 e5                	mov    %esp,%ebp
+f0107b2a:	57                   	push   %edi
+f0107b2b:	56                   	push   %esi
+f0107b2c:	53                   	push   %ebx
+f0107b2d:	83 ec 2c             	sub    $0x2c,%esp
+f0107b30:	e8 a9 94 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0107b35:	05 57 d9 00 00       	add    $0xd957,%eax
+f0107b3a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0107b3d:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107b40:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0107b43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+		fmt = parsespec(fmt, &ps, &ap);
+f0107b46:	8d 45 14             	lea    0x14(%ebp),%eax
+f0107b49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0107b4c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0107b4f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0107b52:	83 c3 01             	add    $0x1,%ebx
+f0107b55:	0f b6 43 ff          	movzbl -0x1(%ebx),%eax
+f0107b59:	83 f8 25             	cmp    $0x25,%eax
+f0107b5c:	74 27                	je     f0107b85 <vprintfmt+0x5e>
+			if (ch == '\0') {
+f0107b5e:	85 c0                	test   %eax,%eax
+f0107b60:	74 0c                	je     f0107b6e <vprintfmt+0x47>
+			putch(ch, putdat);
+f0107b62:	83 ec 08             	sub    $0x8,%esp
+f0107b65:	57                   	push   %edi
+f0107b66:	50                   	push   %eax
+f0107b67:	ff d6                	call   *%esi
+f0107b69:	83 c4 10             	add    $0x10,%esp
+f0107b6c:	eb e4                	jmp    f0107b52 <vprintfmt+0x2b>
+				cons_c = 0x0700;
+f0107b6e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0107b71:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f0107b77:	c7 00 00 07 00 00    	movl   $0x700,(%eax)
+}
+f0107b7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107b80:	5b                   	pop    %ebx
+f0107b81:	5e                   	pop    %esi
+f0107b82:	5f                   	pop    %edi
+f0107b83:	5d                   	pop    %ebp
+f0107b84:	c3                   	ret
+		fmt = parsespec(fmt, &ps, &ap);
+f0107b85:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0107b88:	8b 55 d0             	mov    -0x30(%ebp),%edx
+f0107b8b:	89 d8                	mov    %ebx,%eax
+f0107b8d:	e8 97 f8 ff ff       	call   f0107429 <parsespec>
+f0107b92:	89 45 c8             	mov    %eax,-0x38(%ebp)
+		if (ps.ps_conv == 0) {
+f0107b95:	80 7d d8 00          	cmpb   $0x0,-0x28(%ebp)
+f0107b99:	75 0d                	jne    f0107ba8 <vprintfmt+0x81>
+			putch('%', putdat);
+f0107b9b:	83 ec 08             	sub    $0x8,%esp
+f0107b9e:	57                   	push   %edi
+f0107b9f:	6a 25                	push   $0x25
+f0107ba1:	ff d6                	call   *%esi
+			continue;
+f0107ba3:	83 c4 10             	add    $0x10,%esp
+f0107ba6:	eb aa                	jmp    f0107b52 <vprintfmt+0x2b>
+		printspec(putch, putdat, &ps, &ap);
+f0107ba8:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+f0107bab:	83 ec 0c             	sub    $0xc,%esp
+f0107bae:	8d 45 14             	lea    0x14(%ebp),%eax
+f0107bb1:	50                   	push   %eax
+f0107bb2:	89 fa                	mov    %edi,%edx
+f0107bb4:	89 f0                	mov    %esi,%eax
+f0107bb6:	e8 45 fa ff ff       	call   f0107600 <printspec>
+f0107bbb:	83 c4 10             	add    $0x10,%esp
+		fmt = parsespec(fmt, &ps, &ap);
+f0107bbe:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+f0107bc1:	eb 8f                	jmp    f0107b52 <vprintfmt+0x2b>
+
+f0107bc3 <vprintfmtc>:
+{
+f0107bc3:	55                   	push   %ebp
+f0107bc4:	89 e5                	mov    %esp,%ebp
+f0107bc6:	57                   	push   %edi
+f0107bc7:	56                   	push   %esi
+f0107bc8:	53                   	push   %ebx
+f0107bc9:	83 ec 1c             	sub    $0x1c,%esp
+f0107bcc:	e8 0d 94 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0107bd1:	05 bb d8 00 00       	add    $0xd8bb,%eax
+f0107bd6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	if (pf->pf_nops == 0)
+f0107bd9:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107bdc:	8b 70 04             	mov    0x4(%eax),%esi
+f0107bdf:	85 f6                	test   %esi,%esi
+f0107be1:	74 30                	je     f0107c13 <vprintfmtc+0x50>
+	if (pf->pf_nops < 0) {
+f0107be3:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107be6:	8b 40 04             	mov    0x4(%eax),%eax
+f0107be9:	85 c0                	test   %eax,%eax
+f0107beb:	0f 88 b8 00 00 00    	js     f0107ca9 <vprintfmtc+0xe6>
+	last = &pf->pf_ops[pf->pf_nops - 1];
+f0107bf1:	8d 44 80 fb          	lea    -0x5(%eax,%eax,4),%eax
+f0107bf5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0107bf8:	8d 44 81 08          	lea    0x8(%ecx,%eax,4),%eax
+f0107bfc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (op = pf->pf_ops; ; op++) {
+f0107bff:	8d 79 08             	lea    0x8(%ecx),%edi
+		printspec(putch, putdat, &op->po_spec, &ap);
+f0107c02:	8d 45 14             	lea    0x14(%ebp),%eax
+f0107c05:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0107c08:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0107c0b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0107c0e:	e9 e9 00 00 00       	jmp    f0107cfc <vprintfmtc+0x139>
+	lit = fmt = pf->pf_fmt;
+f0107c13:	8b 38                	mov    (%eax),%edi
+f0107c15:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0107c18:	89 f8                	mov    %edi,%eax
+f0107c1a:	eb 03                	jmp    f0107c1f <vprintfmtc+0x5c>
+			fmt++;
+f0107c1c:	83 c0 01             	add    $0x1,%eax
+		while (*fmt != '%' && *fmt != '\0')
+f0107c1f:	0f b6 10             	movzbl (%eax),%edx
+f0107c22:	80 fa 25             	cmp    $0x25,%dl
+f0107c25:	74 04                	je     f0107c2b <vprintfmtc+0x68>
+f0107c27:	84 d2                	test   %dl,%dl
+f0107c29:	75 f1                	jne    f0107c1c <vprintfmtc+0x59>
+		if (n == PRINTFMT_MAXOPS || fmt - pf->pf_fmt > 0xFFFF)
+f0107c2b:	83 fe 10             	cmp    $0x10,%esi
+f0107c2e:	74 6f                	je     f0107c9f <vprintfmtc+0xdc>
+f0107c30:	8b 55 10             	mov    0x10(%ebp),%edx
+f0107c33:	8b 0a                	mov    (%edx),%ecx
+f0107c35:	89 c2                	mov    %eax,%edx
+f0107c37:	29 ca                	sub    %ecx,%edx
+f0107c39:	81 fa ff ff 00 00    	cmp    $0xffff,%edx
+f0107c3f:	7f 5e                	jg     f0107c9f <vprintfmtc+0xdc>
+f0107c41:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+f0107c44:	c1 e2 02             	shl    $0x2,%edx
+f0107c47:	89 d3                	mov    %edx,%ebx
+f0107c49:	03 5d 10             	add    0x10(%ebp),%ebx
+		op->po_off = lit - pf->pf_fmt;
+f0107c4c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107c4f:	29 cf                	sub    %ecx,%edi
+f0107c51:	66 89 7b 08          	mov    %di,0x8(%ebx)
+		op->po_len = fmt - lit;
+f0107c55:	89 c1                	mov    %eax,%ecx
+f0107c57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0107c5a:	29 f9                	sub    %edi,%ecx
+f0107c5c:	66 89 4b 0a          	mov    %cx,0xa(%ebx)
+		if (*fmt == '\0')
+f0107c60:	80 38 00             	cmpb   $0x0,(%eax)
+f0107c63:	74 2c                	je     f0107c91 <vprintfmtc+0xce>
+		spec = ++fmt;
+f0107c65:	8d 78 01             	lea    0x1(%eax),%edi
+		if ((fmt = parsespec(fmt, &op->po_spec, NULL)) == NULL)
+f0107c68:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107c6b:	8d 54 10 0c          	lea    0xc(%eax,%edx,1),%edx
+f0107c6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107c74:	89 f8                	mov    %edi,%eax
+f0107c76:	e8 ae f7 ff ff       	call   f0107429 <parsespec>
+f0107c7b:	85 c0                	test   %eax,%eax
+f0107c7d:	74 20                	je     f0107c9f <vprintfmtc+0xdc>
+		if (op->po_spec.ps_conv == 0) {
+f0107c7f:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+f0107c83:	74 08                	je     f0107c8d <vprintfmtc+0xca>
+		n++;
+f0107c85:	83 c6 01             	add    $0x1,%esi
+		lit = fmt;
+f0107c88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107c8b:	eb 92                	jmp    f0107c1f <vprintfmtc+0x5c>
+			fmt = spec;
+f0107c8d:	89 f8                	mov    %edi,%eax
+f0107c8f:	eb 8e                	jmp    f0107c1f <vprintfmtc+0x5c>
+	pf->pf_nops = n + 1;
+f0107c91:	8d 46 01             	lea    0x1(%esi),%eax
+f0107c94:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0107c97:	89 41 04             	mov    %eax,0x4(%ecx)
+	return;
+f0107c9a:	e9 44 ff ff ff       	jmp    f0107be3 <vprintfmtc+0x20>
+	pf->pf_nops = -1;
+f0107c9f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107ca2:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%eax)
+		vprintfmt(putch, putdat, pf->pf_fmt, ap);
+f0107ca9:	ff 75 14             	push   0x14(%ebp)
+f0107cac:	8b 45 10             	mov    0x10(%ebp),%eax
+f0107caf:	ff 30                	push   (%eax)
+f0107cb1:	ff 75 0c             	push   0xc(%ebp)
+f0107cb4:	ff 75 08             	push   0x8(%ebp)
+f0107cb7:	e8 6b fe ff ff       	call   f0107b27 <vprintfmt>
+		return;
+f0107cbc:	83 c4 10             	add    $0x10,%esp
+f0107cbf:	eb 5d                	jmp    f0107d1e <vprintfmtc+0x15b>
+			putch(*(unsigned char *) p, putdat);
+f0107cc1:	83 ec 08             	sub    $0x8,%esp
+f0107cc4:	57                   	push   %edi
+f0107cc5:	0f b6 03             	movzbl (%ebx),%eax
+f0107cc8:	50                   	push   %eax
+f0107cc9:	ff 55 08             	call   *0x8(%ebp)
+		for (ep = p + op->po_len; p < ep; p++)
+f0107ccc:	83 c3 01             	add    $0x1,%ebx
+f0107ccf:	83 c4 10             	add    $0x10,%esp
+f0107cd2:	39 f3                	cmp    %esi,%ebx
+f0107cd4:	72 eb                	jb     f0107cc1 <vprintfmtc+0xfe>
+		if (op == last)
+f0107cd6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0107cd9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107cdc:	39 c6                	cmp    %eax,%esi
+f0107cde:	74 2f                	je     f0107d0f <vprintfmtc+0x14c>
+		printspec(putch, putdat, &op->po_spec, &ap);
+f0107ce0:	8d 4e 04             	lea    0x4(%esi),%ecx
+f0107ce3:	83 ec 0c             	sub    $0xc,%esp
+f0107ce6:	ff 75 dc             	push   -0x24(%ebp)
+f0107ce9:	89 fa                	mov    %edi,%edx
+f0107ceb:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107cee:	e8 0d f9 ff ff       	call   f0107600 <printspec>
+	for (op = pf->pf_ops; ; op++) {
+f0107cf3:	83 c6 14             	add    $0x14,%esi
+f0107cf6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+		p = pf->pf_fmt + op->po_off;
+f0107cf9:	83 c4 10             	add    $0x10,%esp
+f0107cfc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107cff:	0f b7 18             	movzwl (%eax),%ebx
+f0107d02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0107d05:	03 19                	add    (%ecx),%ebx
+		for (ep = p + op->po_len; p < ep; p++)
+f0107d07:	0f b7 70 02          	movzwl 0x2(%eax),%esi
+f0107d0b:	01 de                	add    %ebx,%esi
+f0107d0d:	eb c3                	jmp    f0107cd2 <vprintfmtc+0x10f>
+	cons_c = 0x0700;
+f0107d0f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f0107d12:	c7 c0 08 43 15 f0    	mov    $0xf0154308,%eax
+f0107d18:	c7 00 00 07 00 00    	movl   $0x700,(%eax)
+}
+f0107d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107d21:	5b                   	pop    %ebx
+f0107d22:	5e                   	pop    %esi
+f0107d23:	5f                   	pop    %edi
+f0107d24:	5d                   	pop    %ebp
+f0107d25:	c3                   	ret
+
+f0107d26 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f0107d26:	55                   	push   %ebp
+f0107d27:	89 e5                	mov    %esp,%ebp
+f0107d29:	53                   	push   %ebx
+f0107d2a:	83 ec 14             	sub    $0x14,%esp
+f0107d2d:	e8 1d 86 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0107d32:	81 c3 5a d7 00 00    	add    $0xd75a,%ebx
+f0107d38:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107d3b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+f0107d3e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f0107d41:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f0107d45:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f0107d48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+f0107d4f:	85 c0                	test   %eax,%eax
+f0107d51:	74 2b                	je     f0107d7e <vsnprintf+0x58>
+f0107d53:	85 d2                	test   %edx,%edx
+f0107d55:	7e 27                	jle    f0107d7e <vsnprintf+0x58>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+f0107d57:	ff 75 14             	push   0x14(%ebp)
+f0107d5a:	ff 75 10             	push   0x10(%ebp)
+f0107d5d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f0107d60:	50                   	push   %eax
+f0107d61:	8d 83 3a 21 ff ff    	lea    -0xdec6(%ebx),%eax
+f0107d67:	50                   	push   %eax
+f0107d68:	e8 ba fd ff ff       	call   f0107b27 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+f0107d6d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f0107d70:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+f0107d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0107d76:	83 c4 10             	add    $0x10,%esp
+}
+f0107d79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107d7c:	c9                   	leave
+f0107d7d:	c3                   	ret
+		return -E_INVAL;
+f0107d7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0107d83:	eb f4                	jmp    f0107d79 <vsnprintf+0x53>
+
+f0107d85 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f0107d85:	55                   	push   %ebp
+f0107d86:	89 e5                	mov    %esp,%ebp
+f0107d88:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+f0107d8b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+f0107d8e:	50                   	push   %eax
+f0107d8f:	ff 75 10             	push   0x10(%ebp)
+f0107d92:	ff 75 0c             	push   0xc(%ebp)
+f0107d95:	ff 75 08             	push   0x8(%ebp)
+f0107d98:	e8 89 ff ff ff       	call   f0107d26 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+f0107d9d:	c9                   	leave
+f0107d9e:	c3                   	ret
+
+f0107d9f <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0107d9f:	55                   	push   %ebp
+f0107da0:	89 e5                	mov    %esp,%ebp
+f0107da2:	57                   	push   %edi
+f0107da3:	56                   	push   %esi
+f0107da4:	53                   	push   %ebx
+f0107da5:	83 ec 1c             	sub    $0x1c,%esp
+f0107da8:	e8 a2 85 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0107dad:	81 c3 df d6 00 00    	add    $0xd6df,%ebx
+f0107db3:	8b 45 08             	mov    0x8(%ebp),%eax
+	int i, c, echoing;
+
+	if (prompt != NULL)
+f0107db6:	85 c0                	test   %eax,%eax
+f0107db8:	74 13                	je     f0107dcd <readline+0x2e>
+		cprintf("%s", prompt);
+f0107dba:	83 ec 08             	sub    $0x8,%esp
+f0107dbd:	50                   	push   %eax
+f0107dbe:	8d 83 f6 5d ff ff    	lea    -0xa20a(%ebx),%eax
+f0107dc4:	50                   	push   %eax
+f0107dc5:	e8 c8 c2 ff ff       	call   f0104092 <cprintf>
+f0107dca:	83 c4 10             	add    $0x10,%esp
+
+	i = 0;
+	echoing = iscons(0);
+f0107dcd:	83 ec 0c             	sub    $0xc,%esp
+f0107dd0:	6a 00                	push   $0x0
+f0107dd2:	e8 01 92 ff ff       	call   f0100fd8 <iscons>
+f0107dd7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107dda:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+f0107ddd:	bf 00 00 00 00       	mov    $0x0,%edi
+				cputchar('\b');
+			i--;
+		} else if (c >= ' ' && i < BUFLEN-1) {
+			if (echoing)
+				cputchar(c);
+			buf[i++] = c;
+f0107de2:	8d 83 74 e7 03 00    	lea    0x3e774(%ebx),%eax
+f0107de8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107deb:	eb 45                	jmp    f0107e32 <readline+0x93>
+			cprintf("read error: %e\n", c);
+f0107ded:	83 ec 08             	sub    $0x8,%esp
+f0107df0:	50                   	push   %eax
+f0107df1:	8d 83 22 62 ff ff    	lea    -0x9dde(%ebx),%eax
+f0107df7:	50                   	push   %eax
+f0107df8:	e8 95 c2 ff ff       	call   f0104092 <cprintf>
+			return NULL;
+f0107dfd:	83 c4 10             	add    $0x10,%esp
+f0107e00:	b8 00 00 00 00       	mov    $0x0,%eax
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+f0107e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107e08:	5b                   	pop    %ebx
+f0107e09:	5e                   	pop    %esi
+f0107e0a:	5f                   	pop    %edi
+f0107e0b:	5d                   	pop    %ebp
+f0107e0c:	c3                   	ret
+			if (echoing)
+f0107e0d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0107e11:	75 05                	jne    f0107e18 <readline+0x79>
+			i--;
+f0107e13:	83 ef 01             	sub    $0x1,%edi
+f0107e16:	eb 1a                	jmp    f0107e32 <readline+0x93>
+				cputchar('\b');
+f0107e18:	83 ec 0c             	sub    $0xc,%esp
+f0107e1b:	6a 08                	push   $0x8
+f0107e1d:	e8 0c 91 ff ff       	call   f0100f2e <cputchar>
+f0107e22:	83 c4 10             	add    $0x10,%esp
+f0107e25:	eb ec                	jmp    f0107e13 <readline+0x74>
+			buf[i++] = c;
+f0107e27:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0107e2a:	89 f0                	mov    %esi,%eax
+f0107e2c:	88 04 39             	mov    %al,(%ecx,%edi,1)
+f0107e2f:	8d 7f 01             	lea    0x1(%edi),%edi
+		c = getchar();
+f0107e32:	e8 64 91 ff ff       	call   f0100f9b <getchar>
+f0107e37:	89 c6                	mov    %eax,%esi
+		if (c < 0) {
+f0107e39:	85 c0                	test   %eax,%eax
+f0107e3b:	78 b0                	js     f0107ded <readline+0x4e>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+f0107e3d:	83 f8 08             	cmp    $0x8,%eax
+f0107e40:	0f 94 c0             	sete   %al
+f0107e43:	83 fe 7f             	cmp    $0x7f,%esi
+f0107e46:	0f 94 c2             	sete   %dl
+f0107e49:	08 d0                	or     %dl,%al
+f0107e4b:	74 04                	je     f0107e51 <readline+0xb2>
+f0107e4d:	85 ff                	test   %edi,%edi
+f0107e4f:	7f bc                	jg     f0107e0d <readline+0x6e>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+f0107e51:	83 fe 1f             	cmp    $0x1f,%esi
+f0107e54:	7e 1c                	jle    f0107e72 <readline+0xd3>
+f0107e56:	81 ff fe 03 00 00    	cmp    $0x3fe,%edi
+f0107e5c:	7f 14                	jg     f0107e72 <readline+0xd3>
+			if (echoing)
+f0107e5e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0107e62:	74 c3                	je     f0107e27 <readline+0x88>
+				cputchar(c);
+f0107e64:	83 ec 0c             	sub    $0xc,%esp
+f0107e67:	56                   	push   %esi
+f0107e68:	e8 c1 90 ff ff       	call   f0100f2e <cputchar>
+f0107e6d:	83 c4 10             	add    $0x10,%esp
+f0107e70:	eb b5                	jmp    f0107e27 <readline+0x88>
+		} else if (c == '\n' || c == '\r') {
+f0107e72:	83 fe 0a             	cmp    $0xa,%esi
+f0107e75:	74 05                	je     f0107e7c <readline+0xdd>
+f0107e77:	83 fe 0d             	cmp    $0xd,%esi
+f0107e7a:	75 b6                	jne    f0107e32 <readline+0x93>
+			if (echoing)
+f0107e7c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0107e80:	75 13                	jne    f0107e95 <readline+0xf6>
+			buf[i] = 0;
+f0107e82:	c6 84 3b 74 e7 03 00 	movb   $0x0,0x3e774(%ebx,%edi,1)
+f0107e89:	00 
+			return buf;
+f0107e8a:	8d 83 74 e7 03 00    	lea    0x3e774(%ebx),%eax
+f0107e90:	e9 70 ff ff ff       	jmp    f0107e05 <readline+0x66>
+				cputchar('\n');
+f0107e95:	83 ec 0c             	sub    $0xc,%esp
+f0107e98:	6a 0a                	push   $0xa
+f0107e9a:	e8 8f 90 ff ff       	call   f0100f2e <cputchar>
+f0107e9f:	83 c4 10             	add    $0x10,%esp
+f0107ea2:	eb de                	jmp    f0107e82 <readline+0xe3>
+
+f0107ea4 <string_init>:
+// least as fast as the word ones, at any alignment.
+static bool erms;
+
+void
+string_init(void)
+{
+f0107ea4:	55                   	push   %ebp
+f0107ea5:	89 e5                	mov    %esp,%ebp
+f0107ea7:	56                   	push   %esi
+f0107ea8:	53                   	push   %ebx
+f0107ea9:	e8 3c 91 ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f0107eae:	81 c6 de d5 00 00    	add    $0xd5de,%esi
+	asm volatile("cpuid"
+f0107eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107eb9:	0f a2                	cpuid
+	uint32_t max, ebx;
+
+	cpuid(0, &max, NULL, NULL, NULL);
+	if (max >= 7) {
+f0107ebb:	83 f8 06             	cmp    $0x6,%eax
+f0107ebe:	76 18                	jbe    f0107ed8 <string_init+0x34>
+		// leaf 7 takes a subleaf in ecx
+		asm volatile("cpuid" : "=b" (ebx) : "a" (7), "c" (0) : "edx");
+f0107ec0:	b8 07 00 00 00       	mov    $0x7,%eax
+f0107ec5:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107eca:	0f a2                	cpuid
+		erms = (ebx >> 9) & 1;
+f0107ecc:	c1 eb 09             	shr    $0x9,%ebx
+f0107ecf:	83 e3 01             	and    $0x1,%ebx
+f0107ed2:	88 9e 74 eb 03 00    	mov    %bl,0x3eb74(%esi)
+	}
+}
+f0107ed8:	5b                   	pop    %ebx
+f0107ed9:	5e                   	pop    %esi
+f0107eda:	5d                   	pop    %ebp
+f0107edb:	c3                   	ret
+
+f0107edc <strlen>:
+
+int
+strlen(const char *s)
+{
+f0107edc:	55                   	push   %ebp
+f0107edd:	89 e5                	mov    %esp,%ebp
+f0107edf:	53                   	push   %ebx
+f0107ee0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	const char *p;
+	const word_t *w;
+
+	// bytes up to a word boundary, then whole words
+	for (p = s; (uintptr_t) p % 4; p++)
+f0107ee3:	89 c8                	mov    %ecx,%eax
+f0107ee5:	eb 03                	jmp    f0107eea <strlen+0xe>
+f0107ee7:	83 c0 01             	add    $0x1,%eax
+f0107eea:	a8 03                	test   $0x3,%al
+f0107eec:	74 09                	je     f0107ef7 <strlen+0x1b>
+		if (*p == '\0')
+f0107eee:	80 38 00             	cmpb   $0x0,(%eax)
+f0107ef1:	75 f4                	jne    f0107ee7 <strlen+0xb>
+			return p - s;
+f0107ef3:	29 c8                	sub    %ecx,%eax
+f0107ef5:	eb 25                	jmp    f0107f1c <strlen+0x40>
+	for (w = (const word_t *) p; !HASZERO(*w); w++)
+f0107ef7:	8b 10                	mov    (%eax),%edx
+f0107ef9:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+f0107eff:	f7 d2                	not    %edx
+f0107f01:	21 da                	and    %ebx,%edx
+f0107f03:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+f0107f09:	75 05                	jne    f0107f10 <strlen+0x34>
+f0107f0b:	83 c0 04             	add    $0x4,%eax
+f0107f0e:	eb e7                	jmp    f0107ef7 <strlen+0x1b>
+		/* do nothing */;
+	for (p = (const char *) w; *p != '\0'; p++)
+f0107f10:	80 38 00             	cmpb   $0x0,(%eax)
+f0107f13:	74 05                	je     f0107f1a <strlen+0x3e>
+f0107f15:	83 c0 01             	add    $0x1,%eax
+f0107f18:	eb f6                	jmp    f0107f10 <strlen+0x34>
+		/* do nothing */;
+	return p - s;
+f0107f1a:	29 c8                	sub    %ecx,%eax
+}
+f0107f1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107f1f:	c9                   	leave
+f0107f20:	c3                   	ret
+
+f0107f21 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0107f21:	55                   	push   %ebp
+f0107f22:	89 e5                	mov    %esp,%ebp
+f0107f24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107f27:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107f2f:	eb 03                	jmp    f0107f34 <strnlen+0x13>
+		n++;
+f0107f31:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f0107f34:	39 d0                	cmp    %edx,%eax
+f0107f36:	74 08                	je     f0107f40 <strnlen+0x1f>
+f0107f38:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0107f3c:	75 f3                	jne    f0107f31 <strnlen+0x10>
+f0107f3e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+f0107f40:	89 d0                	mov    %edx,%eax
+f0107f42:	5d                   	pop    %ebp
+f0107f43:	c3                   	ret
+
+f0107f44 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f0107f44:	55                   	push   %ebp
+f0107f45:	89 e5                	mov    %esp,%ebp
+f0107f47:	53                   	push   %ebx
+f0107f48:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107f4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+f0107f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107f53:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f0107f57:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0107f5a:	83 c0 01             	add    $0x1,%eax
+f0107f5d:	84 d2                	test   %dl,%dl
+f0107f5f:	75 f2                	jne    f0107f53 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+f0107f61:	89 c8                	mov    %ecx,%eax
+f0107f63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107f66:	c9                   	leave
+f0107f67:	c3                   	ret
+
+f0107f68 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f0107f68:	55                   	push   %ebp
+f0107f69:	89 e5                	mov    %esp,%ebp
+f0107f6b:	53                   	push   %ebx
+f0107f6c:	83 ec 10             	sub    $0x10,%esp
+f0107f6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+f0107f72:	53                   	push   %ebx
+f0107f73:	e8 64 ff ff ff       	call   f0107edc <strlen>
+f0107f78:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+f0107f7b:	ff 75 0c             	push   0xc(%ebp)
+f0107f7e:	01 d8                	add    %ebx,%eax
+f0107f80:	50                   	push   %eax
+f0107f81:	e8 be ff ff ff       	call   f0107f44 <strcpy>
+	return dst;
+}
+f0107f86:	89 d8                	mov    %ebx,%eax
+f0107f88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107f8b:	c9                   	leave
+f0107f8c:	c3                   	ret
+
+f0107f8d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+f0107f8d:	55                   	push   %ebp
+f0107f8e:	89 e5                	mov    %esp,%ebp
+f0107f90:	56                   	push   %esi
+f0107f91:	53                   	push   %ebx
+f0107f92:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107f95:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107f98:	89 f3                	mov    %esi,%ebx
+f0107f9a:	03 5d 10             	add    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+f0107f9d:	89 f0                	mov    %esi,%eax
+f0107f9f:	eb 0f                	jmp    f0107fb0 <strncpy+0x23>
+		*dst++ = *src;
+f0107fa1:	83 c0 01             	add    $0x1,%eax
+f0107fa4:	0f b6 0a             	movzbl (%edx),%ecx
+f0107fa7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+f0107faa:	80 f9 01             	cmp    $0x1,%cl
+f0107fad:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+f0107fb0:	39 d8                	cmp    %ebx,%eax
+f0107fb2:	75 ed                	jne    f0107fa1 <strncpy+0x14>
+	}
+	return ret;
+}
+f0107fb4:	89 f0                	mov    %esi,%eax
+f0107fb6:	5b                   	pop    %ebx
+f0107fb7:	5e                   	pop    %esi
+f0107fb8:	5d                   	pop    %ebp
+f0107fb9:	c3                   	ret
+
+f0107fba <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f0107fba:	55                   	push   %ebp
+f0107fbb:	89 e5                	mov    %esp,%ebp
+f0107fbd:	56                   	push   %esi
+f0107fbe:	53                   	push   %ebx
+f0107fbf:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0107fc5:	8b 55 10             	mov    0x10(%ebp),%edx
+f0107fc8:	89 f0                	mov    %esi,%eax
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+f0107fca:	85 d2                	test   %edx,%edx
+f0107fcc:	74 21                	je     f0107fef <strlcpy+0x35>
+f0107fce:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f0107fd2:	89 f2                	mov    %esi,%edx
+f0107fd4:	eb 09                	jmp    f0107fdf <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+f0107fd6:	83 c1 01             	add    $0x1,%ecx
+f0107fd9:	83 c2 01             	add    $0x1,%edx
+f0107fdc:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+f0107fdf:	39 c2                	cmp    %eax,%edx
+f0107fe1:	74 09                	je     f0107fec <strlcpy+0x32>
+f0107fe3:	0f b6 19             	movzbl (%ecx),%ebx
+f0107fe6:	84 db                	test   %bl,%bl
+f0107fe8:	75 ec                	jne    f0107fd6 <strlcpy+0x1c>
+f0107fea:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+f0107fec:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+f0107fef:	29 f0                	sub    %esi,%eax
+}
+f0107ff1:	5b                   	pop    %ebx
+f0107ff2:	5e                   	pop    %esi
+f0107ff3:	5d                   	pop    %ebp
+f0107ff4:	c3                   	ret
+
+f0107ff5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f0107ff5:	55                   	push   %ebp
+f0107ff6:	89 e5                	mov    %esp,%ebp
+f0107ff8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107ffb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+f0107ffe:	eb 06                	jmp    f0108006 <strcmp+0x11>
+		p++, q++;
+f0108000:	83 c1 01             	add    $0x1,%ecx
+f0108003:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+f0108006:	0f b6 01             	movzbl (%ecx),%eax
+f0108009:	84 c0                	test   %al,%al
+f010800b:	74 04                	je     f0108011 <strcmp+0x1c>
+f010800d:	3a 02                	cmp    (%edx),%al
+f010800f:	74 ef                	je     f0108000 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+f0108011:	0f b6 c0             	movzbl %al,%eax
+f0108014:	0f b6 12             	movzbl (%edx),%edx
+f0108017:	29 d0                	sub    %edx,%eax
+}
+f0108019:	5d                   	pop    %ebp
+f010801a:	c3                   	ret
+
+f010801b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f010801b:	55                   	push   %ebp
+f010801c:	89 e5                	mov    %esp,%ebp
+f010801e:	53                   	push   %ebx
+f010801f:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0108025:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+f0108028:	eb 09                	jmp    f0108033 <strncmp+0x18>
+		n--, p++, q++;
+f010802a:	83 ea 01             	sub    $0x1,%edx
+f010802d:	83 c0 01             	add    $0x1,%eax
+f0108030:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+f0108033:	85 d2                	test   %edx,%edx
+f0108035:	74 18                	je     f010804f <strncmp+0x34>
+f0108037:	0f b6 18             	movzbl (%eax),%ebx
+f010803a:	84 db                	test   %bl,%bl
+f010803c:	74 04                	je     f0108042 <strncmp+0x27>
+f010803e:	3a 19                	cmp    (%ecx),%bl
+f0108040:	74 e8                	je     f010802a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+f0108042:	0f b6 00             	movzbl (%eax),%eax
+f0108045:	0f b6 11             	movzbl (%ecx),%edx
+f0108048:	29 d0                	sub    %edx,%eax
+}
+f010804a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010804d:	c9                   	leave
+f010804e:	c3                   	ret
+		return 0;
+f010804f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108054:	eb f4                	jmp    f010804a <strncmp+0x2f>
+
+f0108056 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f0108056:	55                   	push   %ebp
+f0108057:	89 e5                	mov    %esp,%ebp
+f0108059:	57                   	push   %edi
+f010805a:	56                   	push   %esi
+f010805b:	53                   	push   %ebx
+f010805c:	8b 45 08             	mov    0x8(%ebp),%eax
+f010805f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0108062:	89 cb                	mov    %ecx,%ebx
+	const word_t *w;
+	uint32_t cs;
+
+	for (; (uintptr_t) s % 4; s++) {
+f0108064:	eb 03                	jmp    f0108069 <strchr+0x13>
+f0108066:	83 c0 01             	add    $0x1,%eax
+f0108069:	a8 03                	test   $0x3,%al
+f010806b:	74 0d                	je     f010807a <strchr+0x24>
+		if (*s == '\0')
+f010806d:	0f b6 10             	movzbl (%eax),%edx
+f0108070:	84 d2                	test   %dl,%dl
+f0108072:	74 4f                	je     f01080c3 <strchr+0x6d>
+			return 0;
+		if (*s == c)
+f0108074:	38 da                	cmp    %bl,%dl
+f0108076:	75 ee                	jne    f0108066 <strchr+0x10>
+f0108078:	eb 4e                	jmp    f01080c8 <strchr+0x72>
+			return (char *) s;
+	}
+	// skip words with neither a null nor a 'c'
+	cs = (uint8_t) c * ONES;
+f010807a:	0f b6 f1             	movzbl %cl,%esi
+f010807d:	69 f6 01 01 01 01    	imul   $0x1010101,%esi,%esi
+	for (w = (const word_t *) s; !HASZERO(*w) && !HASZERO(*w ^ cs); w++)
+f0108083:	8b 10                	mov    (%eax),%edx
+f0108085:	89 d1                	mov    %edx,%ecx
+f0108087:	31 f1                	xor    %esi,%ecx
+f0108089:	8d ba ff fe fe fe    	lea    -0x1010101(%edx),%edi
+f010808f:	f7 d2                	not    %edx
+f0108091:	21 fa                	and    %edi,%edx
+f0108093:	8d b9 ff fe fe fe    	lea    -0x1010101(%ecx),%edi
+f0108099:	f7 d1                	not    %ecx
+f010809b:	21 cf                	and    %ecx,%edi
+f010809d:	09 fa                	or     %edi,%edx
+f010809f:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+f01080a5:	75 05                	jne    f01080ac <strchr+0x56>
+f01080a7:	83 c0 04             	add    $0x4,%eax
+f01080aa:	eb d7                	jmp    f0108083 <strchr+0x2d>
+		/* do nothing */;
+	for (s = (const char *) w; *s; s++)
+f01080ac:	0f b6 10             	movzbl (%eax),%edx
+f01080af:	84 d2                	test   %dl,%dl
+f01080b1:	74 09                	je     f01080bc <strchr+0x66>
+		if (*s == c)
+f01080b3:	38 da                	cmp    %bl,%dl
+f01080b5:	74 11                	je     f01080c8 <strchr+0x72>
+	for (s = (const char *) w; *s; s++)
+f01080b7:	83 c0 01             	add    $0x1,%eax
+f01080ba:	eb f0                	jmp    f01080ac <strchr+0x56>
+			return (char *) s;
+	return 0;
+f01080bc:	b8 00 00 00 00       	mov    $0x0,%eax
+f01080c1:	eb 05                	jmp    f01080c8 <strchr+0x72>
+			return 0;
+f01080c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01080c8:	5b                   	pop    %ebx
+f01080c9:	5e                   	pop    %esi
+f01080ca:	5f                   	pop    %edi
+f01080cb:	5d                   	pop    %ebp
+f01080cc:	c3                   	ret
+
+f01080cd <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f01080cd:	55                   	push   %ebp
+f01080ce:	89 e5                	mov    %esp,%ebp
+f01080d0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01080d3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+f01080d7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+f01080da:	38 ca                	cmp    %cl,%dl
+f01080dc:	74 09                	je     f01080e7 <strfind+0x1a>
+f01080de:	84 d2                	test   %dl,%dl
+f01080e0:	74 05                	je     f01080e7 <strfind+0x1a>
+	for (; *s; s++)
+f01080e2:	83 c0 01             	add    $0x1,%eax
+f01080e5:	eb f0                	jmp    f01080d7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+f01080e7:	5d                   	pop    %ebp
+f01080e8:	c3                   	ret
+
+f01080e9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f01080e9:	55                   	push   %ebp
+f01080ea:	89 e5                	mov    %esp,%ebp
+f01080ec:	57                   	push   %edi
+f01080ed:	56                   	push   %esi
+f01080ee:	53                   	push   %ebx
+f01080ef:	e8 ea 8e ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f01080f4:	05 98 d3 00 00       	add    $0xd398,%eax
+f01080f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f01080fc:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *p;
+	size_t m;
+
+	if (n == 0)
+f01080ff:	85 d2                	test   %edx,%edx
+f0108101:	74 39                	je     f010813c <memset+0x53>
+		return v;
+	p = v;
+	c &= 0xFF;
+f0108103:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+	p = v;
+f0108107:	89 df                	mov    %ebx,%edi
+	if (n >= 16 && !erms) {
+f0108109:	83 fa 0f             	cmp    $0xf,%edx
+f010810c:	76 27                	jbe    f0108135 <memset+0x4c>
+f010810e:	80 b8 74 eb 03 00 00 	cmpb   $0x0,0x3eb74(%eax)
+f0108115:	75 1e                	jne    f0108135 <memset+0x4c>
+		// bytes up to a word boundary, words, then the rest
+		m = -(uintptr_t) p % 4;
+f0108117:	89 d9                	mov    %ebx,%ecx
+f0108119:	f7 d9                	neg    %ecx
+f010811b:	83 e1 03             	and    $0x3,%ecx
+		n -= m;
+f010811e:	29 ca                	sub    %ecx,%edx
+		asm volatile("cld; rep stosb\n"
+f0108120:	89 f0                	mov    %esi,%eax
+f0108122:	fc                   	cld
+f0108123:	f3 aa                	rep stos %al,%es:(%edi)
+			: "+D" (p), "+c" (m) : "a" (c)
+			: "cc", "memory");
+		m = n/4;
+f0108125:	89 d1                	mov    %edx,%ecx
+f0108127:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("rep stosl\n"
+			: "+D" (p), "+c" (m) : "a" (c * ONES)
+f010812a:	69 c6 01 01 01 01    	imul   $0x1010101,%esi,%eax
+		asm volatile("rep stosl\n"
+f0108130:	f3 ab                	rep stos %eax,%es:(%edi)
+			: "cc", "memory");
+		n %= 4;
+f0108132:	83 e2 03             	and    $0x3,%edx
+	}
+	asm volatile("cld; rep stosb\n"
+f0108135:	89 d1                	mov    %edx,%ecx
+f0108137:	89 f0                	mov    %esi,%eax
+f0108139:	fc                   	cld
+f010813a:	f3 aa                	rep stos %al,%es:(%edi)
+		: "+D" (p), "+c" (n) : "a" (c)
+		: "cc", "memory");
+	return v;
+}
+f010813c:	89 d8                	mov    %ebx,%eax
+f010813e:	5b                   	pop    %ebx
+f010813f:	5e                   	pop    %esi
+f0108140:	5f                   	pop    %edi
+f0108141:	5d                   	pop    %ebp
+f0108142:	c3                   	ret
+
+f0108143 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f0108143:	55                   	push   %ebp
+f0108144:	89 e5                	mov    %esp,%ebp
+f0108146:	57                   	push   %edi
+f0108147:	56                   	push   %esi
+f0108148:	53                   	push   %ebx
+f0108149:	e8 98 8e ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f010814e:	81 c1 3e d3 00 00    	add    $0xd33e,%ecx
+f0108154:	8b 45 08             	mov    0x8(%ebp),%eax
+f0108157:	8b 75 0c             	mov    0xc(%ebp),%esi
+f010815a:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *d;
+	size_t m;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+f010815d:	39 c6                	cmp    %eax,%esi
+f010815f:	73 43                	jae    f01081a4 <memmove+0x61>
+f0108161:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+f0108164:	39 d8                	cmp    %ebx,%eax
+f0108166:	73 3c                	jae    f01081a4 <memmove+0x61>
+		// Backwards, from the last byte.  Nothing speeds up
+		// rep movsb with DF set, so always align for rep movsl.
+		// Each asm sets DF itself and clears it again, since
+		// GCC assumes DF is clear between them.
+		s += n - 1;
+f0108168:	8d 7a ff             	lea    -0x1(%edx),%edi
+f010816b:	01 fe                	add    %edi,%esi
+		d += n - 1;
+f010816d:	01 c7                	add    %eax,%edi
+		if (n >= 16) {
+f010816f:	83 fa 0f             	cmp    $0xf,%edx
+f0108172:	76 28                	jbe    f010819c <memmove+0x59>
+			m = (uintptr_t) (d + 1) % 4;
+f0108174:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+f0108177:	89 cb                	mov    %ecx,%ebx
+f0108179:	83 e3 03             	and    $0x3,%ebx
+			n -= m;
+f010817c:	29 da                	sub    %ebx,%edx
+			asm volatile("std; rep movsb; cld\n"
+f010817e:	89 d9                	mov    %ebx,%ecx
+f0108180:	fd                   	std
+f0108181:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f0108183:	fc                   	cld
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			// rep movsl takes the address of the word's first byte
+			d -= 3;
+f0108184:	83 ef 03             	sub    $0x3,%edi
+			s -= 3;
+f0108187:	83 ee 03             	sub    $0x3,%esi
+			m = n/4;
+f010818a:	89 d1                	mov    %edx,%ecx
+f010818c:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl; cld\n"
+f010818f:	fd                   	std
+f0108190:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0108192:	fc                   	cld
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			d += 3;
+f0108193:	83 c7 03             	add    $0x3,%edi
+			s += 3;
+f0108196:	83 c6 03             	add    $0x3,%esi
+			n %= 4;
+f0108199:	83 e2 03             	and    $0x3,%edx
+		}
+		asm volatile("std; rep movsb; cld\n"
+f010819c:	89 d1                	mov    %edx,%ecx
+f010819e:	fd                   	std
+f010819f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+f01081a1:	fc                   	cld
+f01081a2:	eb 2b                	jmp    f01081cf <memmove+0x8c>
+	d = dst;
+f01081a4:	89 c7                	mov    %eax,%edi
+			: "+D" (d), "+S" (s), "+c" (n) :: "cc", "memory");
+	} else {
+		if (n >= 16 && !erms) {
+f01081a6:	83 fa 0f             	cmp    $0xf,%edx
+f01081a9:	76 1f                	jbe    f01081ca <memmove+0x87>
+f01081ab:	80 b9 74 eb 03 00 00 	cmpb   $0x0,0x3eb74(%ecx)
+f01081b2:	75 16                	jne    f01081ca <memmove+0x87>
+			// Align the destination; x86 doesn't mind
+			// unaligned loads nearly as much.
+			m = -(uintptr_t) d % 4;
+f01081b4:	89 c1                	mov    %eax,%ecx
+f01081b6:	f7 d9                	neg    %ecx
+f01081b8:	83 e1 03             	and    $0x3,%ecx
+			n -= m;
+f01081bb:	29 ca                	sub    %ecx,%edx
+			asm volatile("cld; rep movsb\n"
+f01081bd:	fc                   	cld
+f01081be:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			m = n/4;
+f01081c0:	89 d1                	mov    %edx,%ecx
+f01081c2:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("rep movsl\n"
+f01081c5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+				: "+D" (d), "+S" (s), "+c" (m) :: "cc", "memory");
+			n %= 4;
+f01081c7:	83 e2 03             	and    $0x3,%edx
+		}
+		asm volatile("cld; rep movsb\n"
+f01081ca:	89 d1                	mov    %edx,%ecx
+f01081cc:	fc                   	cld
+f01081cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+			: "+D" (d), "+S" (s), "+c" (n) :: "cc", "memory");
+	}
+	return dst;
+}
+f01081cf:	5b                   	pop    %ebx
+f01081d0:	5e                   	pop    %esi
+f01081d1:	5f                   	pop    %edi
+f01081d2:	5d                   	pop    %ebp
+f01081d3:	c3                   	ret
+
+f01081d4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f01081d4:	55                   	push   %ebp
+f01081d5:	89 e5                	mov    %esp,%ebp
+f01081d7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+f01081da:	ff 75 10             	push   0x10(%ebp)
+f01081dd:	ff 75 0c             	push   0xc(%ebp)
+f01081e0:	ff 75 08             	push   0x8(%ebp)
+f01081e3:	e8 5b ff ff ff       	call   f0108143 <memmove>
+}
+f01081e8:	c9                   	leave
+f01081e9:	c3                   	ret
+
+f01081ea <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f01081ea:	55                   	push   %ebp
+f01081eb:	89 e5                	mov    %esp,%ebp
+f01081ed:	57                   	push   %edi
+f01081ee:	56                   	push   %esi
+f01081ef:	53                   	push   %ebx
+f01081f0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01081f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01081f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+f01081f9:	89 da                	mov    %ebx,%edx
+f01081fb:	83 e2 fc             	and    $0xfffffffc,%edx
+f01081fe:	01 f2                	add    %esi,%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+f0108200:	89 f1                	mov    %esi,%ecx
+
+	// skip equal words, then find the difference byte by byte
+	for (; n >= 4 && *(const word_t *) s1 == *(const word_t *) s2; n -= 4)
+f0108202:	eb 06                	jmp    f010820a <memcmp+0x20>
+		s1 += 4, s2 += 4;
+f0108204:	83 c0 04             	add    $0x4,%eax
+f0108207:	83 c1 04             	add    $0x4,%ecx
+	for (; n >= 4 && *(const word_t *) s1 == *(const word_t *) s2; n -= 4)
+f010820a:	39 d1                	cmp    %edx,%ecx
+f010820c:	74 08                	je     f0108216 <memcmp+0x2c>
+f010820e:	8b 39                	mov    (%ecx),%edi
+f0108210:	39 38                	cmp    %edi,(%eax)
+f0108212:	74 f0                	je     f0108204 <memcmp+0x1a>
+f0108214:	89 ca                	mov    %ecx,%edx
+f0108216:	01 de                	add    %ebx,%esi
+f0108218:	29 ce                	sub    %ecx,%esi
+f010821a:	01 c6                	add    %eax,%esi
+	while (n-- > 0) {
+f010821c:	39 f0                	cmp    %esi,%eax
+f010821e:	74 1c                	je     f010823c <memcmp+0x52>
+		if (*s1 != *s2)
+f0108220:	0f b6 08             	movzbl (%eax),%ecx
+f0108223:	0f b6 1a             	movzbl (%edx),%ebx
+f0108226:	38 d9                	cmp    %bl,%cl
+f0108228:	75 08                	jne    f0108232 <memcmp+0x48>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+f010822a:	83 c0 01             	add    $0x1,%eax
+f010822d:	83 c2 01             	add    $0x1,%edx
+f0108230:	eb ea                	jmp    f010821c <memcmp+0x32>
+			return (int) *s1 - (int) *s2;
+f0108232:	0f b6 c1             	movzbl %cl,%eax
+f0108235:	0f b6 db             	movzbl %bl,%ebx
+f0108238:	29 d8                	sub    %ebx,%eax
+f010823a:	eb 05                	jmp    f0108241 <memcmp+0x57>
+	}
+
+	return 0;
+f010823c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0108241:	5b                   	pop    %ebx
+f0108242:	5e                   	pop    %esi
+f0108243:	5f                   	pop    %edi
+f0108244:	5d                   	pop    %ebp
+f0108245:	c3                   	ret
+
+f0108246 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0108246:	55                   	push   %ebp
+f0108247:	89 e5                	mov    %esp,%ebp
+f0108249:	57                   	push   %edi
+f010824a:	56                   	push   %esi
+f010824b:	53                   	push   %ebx
+f010824c:	83 ec 04             	sub    $0x4,%esp
+f010824f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0108252:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0108255:	8b 45 10             	mov    0x10(%ebp),%eax
+	const void *ends = (const char *) s + n;
+f0108258:	8d 3c 01             	lea    (%ecx,%eax,1),%edi
+	uint32_t cs = (uint8_t) c * ONES;
+f010825b:	89 da                	mov    %ebx,%edx
+f010825d:	0f b6 db             	movzbl %bl,%ebx
+f0108260:	69 f3 01 01 01 01    	imul   $0x1010101,%ebx,%esi
+f0108266:	83 e0 fc             	and    $0xfffffffc,%eax
+f0108269:	01 c8                	add    %ecx,%eax
+f010826b:	89 7d f0             	mov    %edi,-0x10(%ebp)
+
+	// skip words with no 'c'
+	for (; n >= 4 && !HASZERO(*(const word_t *) s ^ cs); n -= 4)
+f010826e:	eb 03                	jmp    f0108273 <memfind+0x2d>
+		s += 4;
+f0108270:	83 c1 04             	add    $0x4,%ecx
+	for (; n >= 4 && !HASZERO(*(const word_t *) s ^ cs); n -= 4)
+f0108273:	39 c1                	cmp    %eax,%ecx
+f0108275:	74 1d                	je     f0108294 <memfind+0x4e>
+f0108277:	89 f3                	mov    %esi,%ebx
+f0108279:	33 19                	xor    (%ecx),%ebx
+f010827b:	8d bb ff fe fe fe    	lea    -0x1010101(%ebx),%edi
+f0108281:	f7 d3                	not    %ebx
+f0108283:	21 df                	and    %ebx,%edi
+f0108285:	f7 c7 80 80 80 80    	test   $0x80808080,%edi
+f010828b:	74 e3                	je     f0108270 <memfind+0x2a>
+f010828d:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0108290:	89 c8                	mov    %ecx,%eax
+f0108292:	eb 03                	jmp    f0108297 <memfind+0x51>
+f0108294:	8b 7d f0             	mov    -0x10(%ebp),%edi
+	for (; s < ends; s++)
+f0108297:	39 f8                	cmp    %edi,%eax
+f0108299:	73 09                	jae    f01082a4 <memfind+0x5e>
+		if (*(const unsigned char *) s == (unsigned char) c)
+f010829b:	3a 10                	cmp    (%eax),%dl
+f010829d:	74 05                	je     f01082a4 <memfind+0x5e>
+	for (; s < ends; s++)
+f010829f:	83 c0 01             	add    $0x1,%eax
+f01082a2:	eb f3                	jmp    f0108297 <memfind+0x51>
+			break;
+	return (void *) s;
+}
+f01082a4:	83 c4 04             	add    $0x4,%esp
+f01082a7:	5b                   	pop    %ebx
+f01082a8:	5e                   	pop    %esi
+f01082a9:	5f                   	pop    %edi
+f01082aa:	5d                   	pop    %ebp
+f01082ab:	c3                   	ret
+
+f01082ac <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f01082ac:	55                   	push   %ebp
+f01082ad:	89 e5                	mov    %esp,%ebp
+f01082af:	57                   	push   %edi
+f01082b0:	56                   	push   %esi
+f01082b1:	53                   	push   %ebx
+f01082b2:	8b 55 08             	mov    0x8(%ebp),%edx
+f01082b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+f01082b8:	eb 03                	jmp    f01082bd <strtol+0x11>
+		s++;
+f01082ba:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+f01082bd:	0f b6 02             	movzbl (%edx),%eax
+f01082c0:	3c 20                	cmp    $0x20,%al
+f01082c2:	74 f6                	je     f01082ba <strtol+0xe>
+f01082c4:	3c 09                	cmp    $0x9,%al
+f01082c6:	74 f2                	je     f01082ba <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+f01082c8:	3c 2b                	cmp    $0x2b,%al
+f01082ca:	74 2a                	je     f01082f6 <strtol+0x4a>
+	int neg = 0;
+f01082cc:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+f01082d1:	3c 2d                	cmp    $0x2d,%al
+f01082d3:	74 2b                	je     f0108300 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01082d5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f01082db:	75 0f                	jne    f01082ec <strtol+0x40>
+f01082dd:	80 3a 30             	cmpb   $0x30,(%edx)
+f01082e0:	74 28                	je     f010830a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+f01082e2:	85 db                	test   %ebx,%ebx
+f01082e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01082e9:	0f 44 d8             	cmove  %eax,%ebx
+f01082ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01082f1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f01082f4:	eb 46                	jmp    f010833c <strtol+0x90>
+		s++;
+f01082f6:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+f01082f9:	bf 00 00 00 00       	mov    $0x0,%edi
+f01082fe:	eb d5                	jmp    f01082d5 <strtol+0x29>
+		s++, neg = 1;
+f0108300:	83 c2 01             	add    $0x1,%edx
+f0108303:	bf 01 00 00 00       	mov    $0x1,%edi
+f0108308:	eb cb                	jmp    f01082d5 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f010830a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f010830e:	74 0e                	je     f010831e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+f0108310:	85 db                	test   %ebx,%ebx
+f0108312:	75 d8                	jne    f01082ec <strtol+0x40>
+		s++, base = 8;
+f0108314:	83 c2 01             	add    $0x1,%edx
+f0108317:	bb 08 00 00 00       	mov    $0x8,%ebx
+f010831c:	eb ce                	jmp    f01082ec <strtol+0x40>
+		s += 2, base = 16;
+f010831e:	83 c2 02             	add    $0x2,%edx
+f0108321:	bb 10 00 00 00       	mov    $0x10,%ebx
+f0108326:	eb c4                	jmp    f01082ec <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+f0108328:	0f be c0             	movsbl %al,%eax
+f010832b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+f010832e:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0108331:	7d 3a                	jge    f010836d <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+f0108333:	83 c2 01             	add    $0x1,%edx
+f0108336:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f010833a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+f010833c:	0f b6 02             	movzbl (%edx),%eax
+f010833f:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0108342:	89 f3                	mov    %esi,%ebx
+f0108344:	80 fb 09             	cmp    $0x9,%bl
+f0108347:	76 df                	jbe    f0108328 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+f0108349:	8d 70 9f             	lea    -0x61(%eax),%esi
+f010834c:	89 f3                	mov    %esi,%ebx
+f010834e:	80 fb 19             	cmp    $0x19,%bl
+f0108351:	77 08                	ja     f010835b <strtol+0xaf>
+			dig = *s - 'a' + 10;
+f0108353:	0f be c0             	movsbl %al,%eax
+f0108356:	83 e8 57             	sub    $0x57,%eax
+f0108359:	eb d3                	jmp    f010832e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+f010835b:	8d 70 bf             	lea    -0x41(%eax),%esi
+f010835e:	89 f3                	mov    %esi,%ebx
+f0108360:	80 fb 19             	cmp    $0x19,%bl
+f0108363:	77 08                	ja     f010836d <strtol+0xc1>
+			dig = *s - 'A' + 10;
+f0108365:	0f be c0             	movsbl %al,%eax
+f0108368:	83 e8 37             	sub    $0x37,%eax
+f010836b:	eb c1                	jmp    f010832e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+f010836d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0108371:	74 05                	je     f0108378 <strtol+0xcc>
+		*endptr = (char *) s;
+f0108373:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0108376:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+f0108378:	89 c8                	mov    %ecx,%eax
+f010837a:	f7 d8                	neg    %eax
+f010837c:	85 ff                	test   %edi,%edi
+f010837e:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0108381:	89 c8                	mov    %ecx,%eax
+f0108383:	5b                   	pop    %ebx
+f0108384:	5e                   	pop    %esi
+f0108385:	5f                   	pop    %edi
+f0108386:	5d                   	pop    %ebp
+f0108387:	c3                   	ret
+
+f0108388 <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16
+.globl mpentry_start
+mpentry_start:
+	cli
+f0108388:	fa                   	cli
+
+	xorw    %ax, %ax
+f0108389:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f010838b:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f010838d:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f010838f:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0108391:	0f 01 16             	lgdtl  (%esi)
+f0108394:	7c 70                	jl     f0108406 <gdtdesc+0x2>
+	movl    %cr0, %eax
+f0108396:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f0108399:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f010839d:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f01083a0:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f01083a6:	08 00                	or     %al,(%eax)
+
+f01083a8 <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f01083a8:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f01083ac:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f01083ae:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f01083b0:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f01083b2:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f01083b6:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f01083b8:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table.  entry_pgdir uses 4MB and global
+	# pages, as in entry.S.
+	movl    %cr4, %eax
+f01083ba:	0f 20 e0             	mov    %cr4,%eax
+	orl     $(CR4_PSE|CR4_PGE), %eax
+f01083bd:	0d 90 00 00 00       	or     $0x90,%eax
+	movl    %eax, %cr4
+f01083c2:	0f 22 e0             	mov    %eax,%cr4
+	movl    $(RELOC(entry_pgdir)), %eax
+f01083c5:	b8 00 40 11 00       	mov    $0x114000,%eax
+	movl    %eax, %cr3
+f01083ca:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f01083cd:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f01083d0:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f01083d5:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f01083d8:	8b 25 04 43 15 f0    	mov    0xf0154304,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f01083de:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f01083e3:	b8 be 00 10 f0       	mov    $0xf01000be,%eax
+	call    *%eax
+f01083e8:	ff d0                	call   *%eax
+
+f01083ea <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f01083ea:	eb fe                	jmp    f01083ea <spin>
+
+f01083ec <gdt>:
+	...
+f01083f4:	ff                   	(bad)
+f01083f5:	ff 00                	incl   (%eax)
+f01083f7:	00 00                	add    %al,(%eax)
+f01083f9:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f0108400:	00                   	.byte 0x0
+f0108401:	92                   	xchg   %eax,%edx
+f0108402:	cf                   	iret
+	...
+
+f0108404 <gdtdesc>:
+f0108404:	17                   	pop    %ss
+f0108405:	00 64 70 00          	add    %ah,0x0(%eax,%esi,2)
+	...
+
+f010840a <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f010840a:	90                   	nop
+
+f010840b <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f010840b:	55                   	push   %ebp
+f010840c:	89 e5                	mov    %esp,%ebp
+f010840e:	57                   	push   %edi
+f010840f:	56                   	push   %esi
+f0108410:	53                   	push   %ebx
+f0108411:	83 ec 1c             	sub    $0x1c,%esp
+f0108414:	e8 36 7f ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108419:	81 c3 73 d0 00 00    	add    $0xd073,%ebx
+f010841f:	89 c6                	mov    %eax,%esi
+f0108421:	89 d0                	mov    %edx,%eax
+	if (PGNUM(pa) >= npages)
+f0108423:	c7 c2 0c 43 15 f0    	mov    $0xf015430c,%edx
+f0108429:	8b 12                	mov    (%edx),%edx
+f010842b:	89 f1                	mov    %esi,%ecx
+f010842d:	c1 e9 0c             	shr    $0xc,%ecx
+f0108430:	39 d1                	cmp    %edx,%ecx
+f0108432:	73 2a                	jae    f010845e <mpsearch1+0x53>
+	return (void *)(pa + KERNBASE);
+f0108434:	8d be 00 00 00 f0    	lea    -0x10000000(%esi),%edi
+	struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f010843a:	01 f0                	add    %esi,%eax
+	if (PGNUM(pa) >= npages)
+f010843c:	89 c1                	mov    %eax,%ecx
+f010843e:	c1 e9 0c             	shr    $0xc,%ecx
+f0108441:	39 d1                	cmp    %edx,%ecx
+f0108443:	73 2f                	jae    f0108474 <mpsearch1+0x69>
+	return (void *)(pa + KERNBASE);
+f0108445:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f010844a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010844d:	81 ee f0 ff ff 0f    	sub    $0xffffff0,%esi
+
+	for (; mp < end; mp++)
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0108453:	8d 83 d1 63 ff ff    	lea    -0x9c2f(%ebx),%eax
+f0108459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	for (; mp < end; mp++)
+f010845c:	eb 42                	jmp    f01084a0 <mpsearch1+0x95>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010845e:	56                   	push   %esi
+f010845f:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0108465:	50                   	push   %eax
+f0108466:	6a 57                	push   $0x57
+f0108468:	8d 83 c1 63 ff ff    	lea    -0x9c3f(%ebx),%eax
+f010846e:	50                   	push   %eax
+f010846f:	e8 84 7c ff ff       	call   f01000f8 <_panic>
+f0108474:	50                   	push   %eax
+f0108475:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f010847b:	50                   	push   %eax
+f010847c:	6a 57                	push   $0x57
+f010847e:	8d 83 c1 63 ff ff    	lea    -0x9c3f(%ebx),%eax
+f0108484:	50                   	push   %eax
+f0108485:	e8 6e 7c ff ff       	call   f01000f8 <_panic>
+		sum += ((uint8_t *)addr)[i];
+f010848a:	0f b6 0a             	movzbl (%edx),%ecx
+f010848d:	01 c8                	add    %ecx,%eax
+f010848f:	83 c2 01             	add    $0x1,%edx
+	for (i = 0; i < len; i++)
+f0108492:	39 f2                	cmp    %esi,%edx
+f0108494:	75 f4                	jne    f010848a <mpsearch1+0x7f>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0108496:	84 c0                	test   %al,%al
+f0108498:	74 2b                	je     f01084c5 <mpsearch1+0xba>
+	for (; mp < end; mp++)
+f010849a:	83 c7 10             	add    $0x10,%edi
+f010849d:	83 c6 10             	add    $0x10,%esi
+f01084a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01084a3:	39 c7                	cmp    %eax,%edi
+f01084a5:	73 19                	jae    f01084c0 <mpsearch1+0xb5>
+		if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f01084a7:	83 ec 04             	sub    $0x4,%esp
+f01084aa:	6a 04                	push   $0x4
+f01084ac:	ff 75 e0             	push   -0x20(%ebp)
+f01084af:	57                   	push   %edi
+f01084b0:	e8 35 fd ff ff       	call   f01081ea <memcmp>
+f01084b5:	83 c4 10             	add    $0x10,%esp
+f01084b8:	89 fa                	mov    %edi,%edx
+f01084ba:	85 c0                	test   %eax,%eax
+f01084bc:	74 d4                	je     f0108492 <mpsearch1+0x87>
+f01084be:	eb da                	jmp    f010849a <mpsearch1+0x8f>
+		    sum(mp, sizeof(*mp)) == 0)
+			return mp;
+	return NULL;
+f01084c0:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+f01084c5:	89 f8                	mov    %edi,%eax
+f01084c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01084ca:	5b                   	pop    %ebx
+f01084cb:	5e                   	pop    %esi
+f01084cc:	5f                   	pop    %edi
+f01084cd:	5d                   	pop    %ebp
+f01084ce:	c3                   	ret
+
+f01084cf <mp_init>:
+	return conf;
+}
+
+void
+mp_init(void)
+{
+f01084cf:	55                   	push   %ebp
+f01084d0:	89 e5                	mov    %esp,%ebp
+f01084d2:	57                   	push   %edi
+f01084d3:	56                   	push   %esi
+f01084d4:	53                   	push   %ebx
+f01084d5:	83 ec 1c             	sub    $0x1c,%esp
+f01084d8:	e8 72 7e ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01084dd:	81 c3 af cf 00 00    	add    $0xcfaf,%ebx
+	struct mpconf *conf;
+	struct mpproc *proc;
+	uint8_t *p;
+	unsigned int i;
+
+	bootcpu = &cpus[0];
+f01084e3:	c7 c0 a0 53 15 f0    	mov    $0xf01553a0,%eax
+f01084e9:	c7 c2 20 50 15 f0    	mov    $0xf0155020,%edx
+f01084ef:	89 10                	mov    %edx,(%eax)
+	if (PGNUM(pa) >= npages)
+f01084f1:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f01084f7:	83 38 00             	cmpl   $0x0,(%eax)
+f01084fa:	0f 84 9b 00 00 00    	je     f010859b <mp_init+0xcc>
+	if ((p = *(uint16_t *) (bda + 0x0E))) {
+f0108500:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f0108507:	85 c0                	test   %eax,%eax
+f0108509:	0f 84 a6 00 00 00    	je     f01085b5 <mp_init+0xe6>
+		p <<= 4;	// Translate from segment to PA
+f010850f:	c1 e0 04             	shl    $0x4,%eax
+		if ((mp = mpsearch1(p, 1024)))
+f0108512:	ba 00 04 00 00       	mov    $0x400,%edx
+f0108517:	e8 ef fe ff ff       	call   f010840b <mpsearch1>
+f010851c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f010851f:	85 c0                	test   %eax,%eax
+f0108521:	75 1a                	jne    f010853d <mp_init+0x6e>
+	return mpsearch1(0xF0000, 0x10000);
+f0108523:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108528:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f010852d:	e8 d9 fe ff ff       	call   f010840b <mpsearch1>
+f0108532:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	if ((mp = mpsearch()) == 0)
+f0108535:	85 c0                	test   %eax,%eax
+f0108537:	0f 84 b3 00 00 00    	je     f01085f0 <mp_init+0x121>
+	if (mp->physaddr == 0 || mp->type != 0) {
+f010853d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0108540:	8b 70 04             	mov    0x4(%eax),%esi
+f0108543:	85 f6                	test   %esi,%esi
+f0108545:	0f 84 93 00 00 00    	je     f01085de <mp_init+0x10f>
+f010854b:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f010854f:	0f 85 89 00 00 00    	jne    f01085de <mp_init+0x10f>
+f0108555:	89 f2                	mov    %esi,%edx
+f0108557:	c1 ea 0c             	shr    $0xc,%edx
+f010855a:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0108560:	3b 10                	cmp    (%eax),%edx
+f0108562:	0f 83 a8 00 00 00    	jae    f0108610 <mp_init+0x141>
+	return (void *)(pa + KERNBASE);
+f0108568:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f010856e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+	if (memcmp(conf, "PCMP", 4) != 0) {
+f0108571:	83 ec 04             	sub    $0x4,%esp
+f0108574:	6a 04                	push   $0x4
+f0108576:	8d 83 d6 63 ff ff    	lea    -0x9c2a(%ebx),%eax
+f010857c:	50                   	push   %eax
+f010857d:	56                   	push   %esi
+f010857e:	e8 67 fc ff ff       	call   f01081ea <memcmp>
+f0108583:	83 c4 10             	add    $0x10,%esp
+f0108586:	85 c0                	test   %eax,%eax
+f0108588:	0f 85 9b 00 00 00    	jne    f0108629 <mp_init+0x15a>
+f010858e:	0f b7 7e 04          	movzwl 0x4(%esi),%edi
+f0108592:	01 f7                	add    %esi,%edi
+	sum = 0;
+f0108594:	89 c2                	mov    %eax,%edx
+	for (i = 0; i < len; i++)
+f0108596:	e9 aa 00 00 00       	jmp    f0108645 <mp_init+0x176>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010859b:	68 00 04 00 00       	push   $0x400
+f01085a0:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f01085a6:	50                   	push   %eax
+f01085a7:	6a 6f                	push   $0x6f
+f01085a9:	8d 83 c1 63 ff ff    	lea    -0x9c3f(%ebx),%eax
+f01085af:	50                   	push   %eax
+f01085b0:	e8 43 7b ff ff       	call   f01000f8 <_panic>
+		p = *(uint16_t *) (bda + 0x13) * 1024;
+f01085b5:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f01085bc:	c1 e0 0a             	shl    $0xa,%eax
+		if ((mp = mpsearch1(p - 1024, 1024)))
+f01085bf:	2d 00 04 00 00       	sub    $0x400,%eax
+f01085c4:	ba 00 04 00 00       	mov    $0x400,%edx
+f01085c9:	e8 3d fe ff ff       	call   f010840b <mpsearch1>
+f01085ce:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f01085d1:	85 c0                	test   %eax,%eax
+f01085d3:	0f 85 64 ff ff ff    	jne    f010853d <mp_init+0x6e>
+f01085d9:	e9 45 ff ff ff       	jmp    f0108523 <mp_init+0x54>
+		cprintf("SMP: Default configurations not implemented\n");
+f01085de:	83 ec 0c             	sub    $0xc,%esp
+f01085e1:	8d 83 34 62 ff ff    	lea    -0x9dcc(%ebx),%eax
+f01085e7:	50                   	push   %eax
+f01085e8:	e8 a5 ba ff ff       	call   f0104092 <cprintf>
+		return NULL;
+f01085ed:	83 c4 10             	add    $0x10,%esp
+	if ((conf = mpconfig(&mp)) == 0) {
+		ncpu = 1;
+f01085f0:	c7 c0 a4 53 15 f0    	mov    $0xf01553a4,%eax
+f01085f6:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+		bootcpu->cpu_status = CPU_STARTED;
+f01085fc:	c7 c0 a0 53 15 f0    	mov    $0xf01553a0,%eax
+f0108602:	8b 00                	mov    (%eax),%eax
+f0108604:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+		return;
+f010860b:	e9 d1 01 00 00       	jmp    f01087e1 <mp_init+0x312>
+f0108610:	56                   	push   %esi
+f0108611:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0108617:	50                   	push   %eax
+f0108618:	68 90 00 00 00       	push   $0x90
+f010861d:	8d 83 c1 63 ff ff    	lea    -0x9c3f(%ebx),%eax
+f0108623:	50                   	push   %eax
+f0108624:	e8 cf 7a ff ff       	call   f01000f8 <_panic>
+		cprintf("SMP: Incorrect MP configuration table signature\n");
+f0108629:	83 ec 0c             	sub    $0xc,%esp
+f010862c:	8d 83 64 62 ff ff    	lea    -0x9d9c(%ebx),%eax
+f0108632:	50                   	push   %eax
+f0108633:	e8 5a ba ff ff       	call   f0104092 <cprintf>
+		return NULL;
+f0108638:	83 c4 10             	add    $0x10,%esp
+f010863b:	eb b3                	jmp    f01085f0 <mp_init+0x121>
+		sum += ((uint8_t *)addr)[i];
+f010863d:	0f b6 0e             	movzbl (%esi),%ecx
+f0108640:	01 ca                	add    %ecx,%edx
+f0108642:	83 c6 01             	add    $0x1,%esi
+	for (i = 0; i < len; i++)
+f0108645:	39 fe                	cmp    %edi,%esi
+f0108647:	75 f4                	jne    f010863d <mp_init+0x16e>
+	if (sum(conf, conf->length) != 0) {
+f0108649:	84 d2                	test   %dl,%dl
+f010864b:	75 1c                	jne    f0108669 <mp_init+0x19a>
+	if (conf->version != 1 && conf->version != 4) {
+f010864d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0108650:	0f b6 51 06          	movzbl 0x6(%ecx),%edx
+f0108654:	80 fa 01             	cmp    $0x1,%dl
+f0108657:	74 05                	je     f010865e <mp_init+0x18f>
+f0108659:	80 fa 04             	cmp    $0x4,%dl
+f010865c:	75 22                	jne    f0108680 <mp_init+0x1b1>
+f010865e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0108661:	0f b7 4f 28          	movzwl 0x28(%edi),%ecx
+f0108665:	01 f1                	add    %esi,%ecx
+	for (i = 0; i < len; i++)
+f0108667:	eb 3a                	jmp    f01086a3 <mp_init+0x1d4>
+		cprintf("SMP: Bad MP configuration checksum\n");
+f0108669:	83 ec 0c             	sub    $0xc,%esp
+f010866c:	8d 83 98 62 ff ff    	lea    -0x9d68(%ebx),%eax
+f0108672:	50                   	push   %eax
+f0108673:	e8 1a ba ff ff       	call   f0104092 <cprintf>
+		return NULL;
+f0108678:	83 c4 10             	add    $0x10,%esp
+f010867b:	e9 70 ff ff ff       	jmp    f01085f0 <mp_init+0x121>
+		cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f0108680:	83 ec 08             	sub    $0x8,%esp
+f0108683:	0f b6 d2             	movzbl %dl,%edx
+f0108686:	52                   	push   %edx
+f0108687:	8d 83 bc 62 ff ff    	lea    -0x9d44(%ebx),%eax
+f010868d:	50                   	push   %eax
+f010868e:	e8 ff b9 ff ff       	call   f0104092 <cprintf>
+		return NULL;
+f0108693:	83 c4 10             	add    $0x10,%esp
+f0108696:	e9 55 ff ff ff       	jmp    f01085f0 <mp_init+0x121>
+		sum += ((uint8_t *)addr)[i];
+f010869b:	0f b6 16             	movzbl (%esi),%edx
+f010869e:	01 d0                	add    %edx,%eax
+f01086a0:	83 c6 01             	add    $0x1,%esi
+	for (i = 0; i < len; i++)
+f01086a3:	39 f1                	cmp    %esi,%ecx
+f01086a5:	75 f4                	jne    f010869b <mp_init+0x1cc>
+	if ((sum((uint8_t *)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f01086a7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01086aa:	02 41 2a             	add    0x2a(%ecx),%al
+f01086ad:	75 36                	jne    f01086e5 <mp_init+0x216>
+	}
+	ismp = 1;
+f01086af:	c7 c0 00 50 15 f0    	mov    $0xf0155000,%eax
+f01086b5:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	lapicaddr = conf->lapicaddr;
+f01086bb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01086be:	8b 51 24             	mov    0x24(%ecx),%edx
+f01086c1:	c7 c0 00 60 19 f0    	mov    $0xf0196000,%eax
+f01086c7:	89 10                	mov    %edx,(%eax)
+
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01086c9:	8d 79 2c             	lea    0x2c(%ecx),%edi
+f01086cc:	be 00 00 00 00       	mov    $0x0,%esi
+		switch (*p) {
+		case MPPROC:
+			proc = (struct mpproc *)p;
+			if (proc->flags & MPPROC_BOOT)
+				bootcpu = &cpus[ncpu];
+			if (ncpu < NCPU) {
+f01086d1:	c7 c0 a4 53 15 f0    	mov    $0xf01553a4,%eax
+f01086d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+				cpus[ncpu].cpu_id = ncpu;
+f01086da:	c7 c0 20 50 15 f0    	mov    $0xf0155020,%eax
+f01086e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f01086e3:	eb 58                	jmp    f010873d <mp_init+0x26e>
+		cprintf("SMP: Bad MP configuration extended checksum\n");
+f01086e5:	83 ec 0c             	sub    $0xc,%esp
+f01086e8:	8d 83 dc 62 ff ff    	lea    -0x9d24(%ebx),%eax
+f01086ee:	50                   	push   %eax
+f01086ef:	e8 9e b9 ff ff       	call   f0104092 <cprintf>
+		return NULL;
+f01086f4:	83 c4 10             	add    $0x10,%esp
+f01086f7:	e9 f4 fe ff ff       	jmp    f01085f0 <mp_init+0x121>
+			if (proc->flags & MPPROC_BOOT)
+f01086fc:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0108700:	74 17                	je     f0108719 <mp_init+0x24a>
+				bootcpu = &cpus[ncpu];
+f0108702:	c7 c0 a4 53 15 f0    	mov    $0xf01553a4,%eax
+f0108708:	6b 00 70             	imul   $0x70,(%eax),%eax
+f010870b:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+f0108711:	c7 c2 a0 53 15 f0    	mov    $0xf01553a0,%edx
+f0108717:	89 02                	mov    %eax,(%edx)
+			if (ncpu < NCPU) {
+f0108719:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010871c:	8b 00                	mov    (%eax),%eax
+f010871e:	83 f8 07             	cmp    $0x7,%eax
+f0108721:	7f 39                	jg     f010875c <mp_init+0x28d>
+				cpus[ncpu].cpu_id = ncpu;
+f0108723:	6b d0 70             	imul   $0x70,%eax,%edx
+f0108726:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+f0108729:	88 04 11             	mov    %al,(%ecx,%edx,1)
+				ncpu++;
+f010872c:	83 c0 01             	add    $0x1,%eax
+f010872f:	c7 c2 a4 53 15 f0    	mov    $0xf01553a4,%edx
+f0108735:	89 02                	mov    %eax,(%edx)
+			} else {
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+					proc->apicid);
+			}
+			p += sizeof(struct mpproc);
+f0108737:	83 c7 14             	add    $0x14,%edi
+	for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f010873a:	83 c6 01             	add    $0x1,%esi
+f010873d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108740:	0f b7 40 22          	movzwl 0x22(%eax),%eax
+f0108744:	39 c6                	cmp    %eax,%esi
+f0108746:	73 58                	jae    f01087a0 <mp_init+0x2d1>
+		switch (*p) {
+f0108748:	0f b6 07             	movzbl (%edi),%eax
+f010874b:	84 c0                	test   %al,%al
+f010874d:	74 ad                	je     f01086fc <mp_init+0x22d>
+f010874f:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0108752:	80 fa 03             	cmp    $0x3,%dl
+f0108755:	77 1e                	ja     f0108775 <mp_init+0x2a6>
+			continue;
+		case MPBUS:
+		case MPIOAPIC:
+		case MPIOINTR:
+		case MPLINTR:
+			p += 8;
+f0108757:	83 c7 08             	add    $0x8,%edi
+			continue;
+f010875a:	eb de                	jmp    f010873a <mp_init+0x26b>
+				cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f010875c:	83 ec 08             	sub    $0x8,%esp
+f010875f:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0108763:	50                   	push   %eax
+f0108764:	8d 83 0c 63 ff ff    	lea    -0x9cf4(%ebx),%eax
+f010876a:	50                   	push   %eax
+f010876b:	e8 22 b9 ff ff       	call   f0104092 <cprintf>
+f0108770:	83 c4 10             	add    $0x10,%esp
+f0108773:	eb c2                	jmp    f0108737 <mp_init+0x268>
+		default:
+			cprintf("mpinit: unknown config type %x\n", *p);
+f0108775:	83 ec 08             	sub    $0x8,%esp
+		switch (*p) {
+f0108778:	0f b6 c0             	movzbl %al,%eax
+			cprintf("mpinit: unknown config type %x\n", *p);
+f010877b:	50                   	push   %eax
+f010877c:	8d 83 34 63 ff ff    	lea    -0x9ccc(%ebx),%eax
+f0108782:	50                   	push   %eax
+f0108783:	e8 0a b9 ff ff       	call   f0104092 <cprintf>
+			ismp = 0;
+f0108788:	c7 c0 00 50 15 f0    	mov    $0xf0155000,%eax
+f010878e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+			i = conf->entry;
+f0108794:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108797:	0f b7 70 22          	movzwl 0x22(%eax),%esi
+f010879b:	83 c4 10             	add    $0x10,%esp
+f010879e:	eb 9a                	jmp    f010873a <mp_init+0x26b>
+		}
+	}
+
+	bootcpu->cpu_status = CPU_STARTED;
+f01087a0:	c7 c0 a0 53 15 f0    	mov    $0xf01553a0,%eax
+f01087a6:	8b 00                	mov    (%eax),%eax
+f01087a8:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+	if (!ismp) {
+f01087af:	c7 c2 00 50 15 f0    	mov    $0xf0155000,%edx
+f01087b5:	83 3a 00             	cmpl   $0x0,(%edx)
+f01087b8:	74 2f                	je     f01087e9 <mp_init+0x31a>
+		ncpu = 1;
+		lapicaddr = 0;
+		cprintf("SMP: configuration not found, SMP disabled\n");
+		return;
+	}
+	cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id, ncpu);
+f01087ba:	83 ec 04             	sub    $0x4,%esp
+f01087bd:	c7 c2 a4 53 15 f0    	mov    $0xf01553a4,%edx
+f01087c3:	ff 32                	push   (%edx)
+f01087c5:	0f b6 00             	movzbl (%eax),%eax
+f01087c8:	50                   	push   %eax
+f01087c9:	8d 83 db 63 ff ff    	lea    -0x9c25(%ebx),%eax
+f01087cf:	50                   	push   %eax
+f01087d0:	e8 bd b8 ff ff       	call   f0104092 <cprintf>
+
+	if (mp->imcrp) {
+f01087d5:	83 c4 10             	add    $0x10,%esp
+f01087d8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01087db:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f01087df:	75 34                	jne    f0108815 <mp_init+0x346>
+		// switch to getting interrupts from the LAPIC.
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+		outb(0x22, 0x70);   // Select IMCR
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+	}
+}
+f01087e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01087e4:	5b                   	pop    %ebx
+f01087e5:	5e                   	pop    %esi
+f01087e6:	5f                   	pop    %edi
+f01087e7:	5d                   	pop    %ebp
+f01087e8:	c3                   	ret
+		ncpu = 1;
+f01087e9:	c7 c0 a4 53 15 f0    	mov    $0xf01553a4,%eax
+f01087ef:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+		lapicaddr = 0;
+f01087f5:	c7 c0 00 60 19 f0    	mov    $0xf0196000,%eax
+f01087fb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+		cprintf("SMP: configuration not found, SMP disabled\n");
+f0108801:	83 ec 0c             	sub    $0xc,%esp
+f0108804:	8d 83 54 63 ff ff    	lea    -0x9cac(%ebx),%eax
+f010880a:	50                   	push   %eax
+f010880b:	e8 82 b8 ff ff       	call   f0104092 <cprintf>
+		return;
+f0108810:	83 c4 10             	add    $0x10,%esp
+f0108813:	eb cc                	jmp    f01087e1 <mp_init+0x312>
+		cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f0108815:	83 ec 0c             	sub    $0xc,%esp
+f0108818:	8d 83 80 63 ff ff    	lea    -0x9c80(%ebx),%eax
+f010881e:	50                   	push   %eax
+f010881f:	e8 6e b8 ff ff       	call   f0104092 <cprintf>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0108824:	b8 70 00 00 00       	mov    $0x70,%eax
+f0108829:	ba 22 00 00 00       	mov    $0x22,%edx
+f010882e:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f010882f:	ba 23 00 00 00       	mov    $0x23,%edx
+f0108834:	ec                   	in     (%dx),%al
+		outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+f0108835:	83 c8 01             	or     $0x1,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0108838:	ee                   	out    %al,(%dx)
+}
+f0108839:	83 c4 10             	add    $0x10,%esp
+f010883c:	eb a3                	jmp    f01087e1 <mp_init+0x312>
+
+f010883e <lapicw>:
+physaddr_t lapicaddr;        // Initialized in mpconfig.c
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+f010883e:	55                   	push   %ebp
+f010883f:	89 e5                	mov    %esp,%ebp
+f0108841:	53                   	push   %ebx
+f0108842:	e8 9f 87 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0108847:	81 c1 45 cc 00 00    	add    $0xcc45,%ecx
+f010884d:	89 c3                	mov    %eax,%ebx
+	lapic[index] = value;
+f010884f:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f0108855:	8b 08                	mov    (%eax),%ecx
+f0108857:	8d 0c 99             	lea    (%ecx,%ebx,4),%ecx
+f010885a:	89 11                	mov    %edx,(%ecx)
+	lapic[ID];  // wait for write to finish, by reading
+f010885c:	8b 00                	mov    (%eax),%eax
+f010885e:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f0108861:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108864:	c9                   	leave
+f0108865:	c3                   	ret
+
+f0108866 <lapic_perfint>:
+
+// Deliver performance counter overflow interrupts to this CPU as NMIs,
+// or stop delivering them.  Returns -1 if the local APIC can't.
+int
+lapic_perfint(bool on)
+{
+f0108866:	55                   	push   %ebp
+f0108867:	89 e5                	mov    %esp,%ebp
+f0108869:	83 ec 08             	sub    $0x8,%esp
+f010886c:	e8 6d 87 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0108871:	05 1b cc 00 00       	add    $0xcc1b,%eax
+f0108876:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (!lapic || ((lapic[VER]>>16) & 0xFF) < 4)
+f0108879:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f010887f:	8b 00                	mov    (%eax),%eax
+f0108881:	85 c0                	test   %eax,%eax
+f0108883:	74 2c                	je     f01088b1 <lapic_perfint+0x4b>
+f0108885:	8b 40 30             	mov    0x30(%eax),%eax
+f0108888:	c1 e8 10             	shr    $0x10,%eax
+f010888b:	a8 fc                	test   $0xfc,%al
+f010888d:	74 29                	je     f01088b8 <lapic_perfint+0x52>
+		return -1;
+	lapicw(PCINT, on ? NMI : MASKED);
+f010888f:	80 fa 01             	cmp    $0x1,%dl
+f0108892:	19 d2                	sbb    %edx,%edx
+f0108894:	81 e2 00 fc 00 00    	and    $0xfc00,%edx
+f010889a:	81 c2 00 04 00 00    	add    $0x400,%edx
+f01088a0:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f01088a5:	e8 94 ff ff ff       	call   f010883e <lapicw>
+	return 0;
+f01088aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f01088af:	c9                   	leave
+f01088b0:	c3                   	ret
+		return -1;
+f01088b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01088b6:	eb f7                	jmp    f01088af <lapic_perfint+0x49>
+f01088b8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f01088bd:	eb f0                	jmp    f01088af <lapic_perfint+0x49>
+
+f01088bf <cpunum>:
+
+int
+cpunum(void)
+{
+f01088bf:	e8 1a 87 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f01088c4:	05 c8 cb 00 00       	add    $0xcbc8,%eax
+	if (lapic)
+f01088c9:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f01088cf:	8b 10                	mov    (%eax),%edx
+		return lapic[ID] >> 24;
+	return 0;
+f01088d1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (lapic)
+f01088d6:	85 d2                	test   %edx,%edx
+f01088d8:	74 06                	je     f01088e0 <cpunum+0x21>
+		return lapic[ID] >> 24;
+f01088da:	8b 42 20             	mov    0x20(%edx),%eax
+f01088dd:	c1 e8 18             	shr    $0x18,%eax
+}
+f01088e0:	c3                   	ret
+
+f01088e1 <lapic_init>:
+{
+f01088e1:	55                   	push   %ebp
+f01088e2:	89 e5                	mov    %esp,%ebp
+f01088e4:	53                   	push   %ebx
+f01088e5:	83 ec 04             	sub    $0x4,%esp
+f01088e8:	e8 62 7a ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01088ed:	81 c3 9f cb 00 00    	add    $0xcb9f,%ebx
+	if (!lapicaddr)
+f01088f3:	c7 c0 00 60 19 f0    	mov    $0xf0196000,%eax
+f01088f9:	8b 00                	mov    (%eax),%eax
+f01088fb:	85 c0                	test   %eax,%eax
+f01088fd:	0f 84 f5 00 00 00    	je     f01089f8 <lapic_init+0x117>
+	if (!lapic)
+f0108903:	c7 c2 04 60 19 f0    	mov    $0xf0196004,%edx
+f0108909:	83 3a 00             	cmpl   $0x0,(%edx)
+f010890c:	0f 84 eb 00 00 00    	je     f01089fd <lapic_init+0x11c>
+	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0108912:	ba 27 01 00 00       	mov    $0x127,%edx
+f0108917:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f010891c:	e8 1d ff ff ff       	call   f010883e <lapicw>
+	lapicw(TIMER, MASKED);
+f0108921:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108926:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f010892b:	e8 0e ff ff ff       	call   f010883e <lapicw>
+	if (thiscpu != bootcpu)
+f0108930:	e8 8a ff ff ff       	call   f01088bf <cpunum>
+f0108935:	6b c0 70             	imul   $0x70,%eax,%eax
+f0108938:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+f010893e:	c7 c2 a0 53 15 f0    	mov    $0xf01553a0,%edx
+f0108944:	39 02                	cmp    %eax,(%edx)
+f0108946:	74 0f                	je     f0108957 <lapic_init+0x76>
+		lapicw(LINT0, MASKED);
+f0108948:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010894d:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0108952:	e8 e7 fe ff ff       	call   f010883e <lapicw>
+	lapicw(LINT1, MASKED);
+f0108957:	ba 00 00 01 00       	mov    $0x10000,%edx
+f010895c:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0108961:	e8 d8 fe ff ff       	call   f010883e <lapicw>
+	if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0108966:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f010896c:	8b 00                	mov    (%eax),%eax
+f010896e:	8b 40 30             	mov    0x30(%eax),%eax
+f0108971:	c1 e8 10             	shr    $0x10,%eax
+f0108974:	a8 fc                	test   $0xfc,%al
+f0108976:	0f 85 a1 00 00 00    	jne    f0108a1d <lapic_init+0x13c>
+	lapicw(ERROR, MASKED | (IRQ_OFFSET + IRQ_ERROR));
+f010897c:	ba 33 00 01 00       	mov    $0x10033,%edx
+f0108981:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0108986:	e8 b3 fe ff ff       	call   f010883e <lapicw>
+	lapicw(ESR, 0);
+f010898b:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108990:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0108995:	e8 a4 fe ff ff       	call   f010883e <lapicw>
+	lapicw(ESR, 0);
+f010899a:	ba 00 00 00 00       	mov    $0x0,%edx
+f010899f:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f01089a4:	e8 95 fe ff ff       	call   f010883e <lapicw>
+	lapicw(EOI, 0);
+f01089a9:	ba 00 00 00 00       	mov    $0x0,%edx
+f01089ae:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f01089b3:	e8 86 fe ff ff       	call   f010883e <lapicw>
+	lapicw(ICRHI, 0);
+f01089b8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01089bd:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f01089c2:	e8 77 fe ff ff       	call   f010883e <lapicw>
+	lapicw(ICRLO, BCAST | INIT | LEVEL);
+f01089c7:	ba 00 85 08 00       	mov    $0x88500,%edx
+f01089cc:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f01089d1:	e8 68 fe ff ff       	call   f010883e <lapicw>
+	while(lapic[ICRLO] & DELIVS)
+f01089d6:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f01089dc:	8b 10                	mov    (%eax),%edx
+f01089de:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f01089e4:	f6 c4 10             	test   $0x10,%ah
+f01089e7:	75 f5                	jne    f01089de <lapic_init+0xfd>
+	lapicw(TPR, 0);
+f01089e9:	ba 00 00 00 00       	mov    $0x0,%edx
+f01089ee:	b8 20 00 00 00       	mov    $0x20,%eax
+f01089f3:	e8 46 fe ff ff       	call   f010883e <lapicw>
+}
+f01089f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01089fb:	c9                   	leave
+f01089fc:	c3                   	ret
+		lapic = mmio_map_region(lapicaddr, 4096);
+f01089fd:	83 ec 08             	sub    $0x8,%esp
+f0108a00:	68 00 10 00 00       	push   $0x1000
+f0108a05:	50                   	push   %eax
+f0108a06:	e8 d7 a2 ff ff       	call   f0102ce2 <mmio_map_region>
+f0108a0b:	89 c2                	mov    %eax,%edx
+f0108a0d:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f0108a13:	89 10                	mov    %edx,(%eax)
+f0108a15:	83 c4 10             	add    $0x10,%esp
+f0108a18:	e9 f5 fe ff ff       	jmp    f0108912 <lapic_init+0x31>
+		lapicw(PCINT, MASKED);
+f0108a1d:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0108a22:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0108a27:	e8 12 fe ff ff       	call   f010883e <lapicw>
+f0108a2c:	e9 4b ff ff ff       	jmp    f010897c <lapic_init+0x9b>
+
+f0108a31 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+f0108a31:	e8 a8 85 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0108a36:	05 56 ca 00 00       	add    $0xca56,%eax
+	if (lapic)
+f0108a3b:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f0108a41:	83 38 00             	cmpl   $0x0,(%eax)
+f0108a44:	74 17                	je     f0108a5d <lapic_eoi+0x2c>
+{
+f0108a46:	55                   	push   %ebp
+f0108a47:	89 e5                	mov    %esp,%ebp
+f0108a49:	83 ec 08             	sub    $0x8,%esp
+		lapicw(EOI, 0);
+f0108a4c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0108a51:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0108a56:	e8 e3 fd ff ff       	call   f010883e <lapicw>
+}
+f0108a5b:	c9                   	leave
+f0108a5c:	c3                   	ret
+f0108a5d:	c3                   	ret
+
+f0108a5e <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0108a5e:	55                   	push   %ebp
+f0108a5f:	89 e5                	mov    %esp,%ebp
+f0108a61:	57                   	push   %edi
+f0108a62:	56                   	push   %esi
+f0108a63:	53                   	push   %ebx
+f0108a64:	83 ec 14             	sub    $0x14,%esp
+f0108a67:	e8 e3 78 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108a6c:	81 c3 20 ca 00 00    	add    $0xca20,%ebx
+f0108a72:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0108a75:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint16_t *wrv;
+
+	// "The BSP must initialize CMOS shutdown code to 0AH
+	// and the warm reset vector (DWORD based at 40:67) to point at
+	// the AP startup code prior to the [universal startup algorithm]."
+	mc146818_write(0xF, 0x0A);  // offset 0xF is shutdown code
+f0108a78:	6a 0a                	push   $0xa
+f0108a7a:	6a 0f                	push   $0xf
+f0108a7c:	e8 98 b3 ff ff       	call   f0103e19 <mc146818_write>
+	if (PGNUM(pa) >= npages)
+f0108a81:	83 c4 10             	add    $0x10,%esp
+f0108a84:	c7 c0 0c 43 15 f0    	mov    $0xf015430c,%eax
+f0108a8a:	83 38 00             	cmpl   $0x0,(%eax)
+f0108a8d:	74 3e                	je     f0108acd <lapic_startap+0x6f>
+	wrv = (uint16_t *)KADDR((0x40 << 4 | 0x67));  // Warm reset vector
+	wrv[0] = 0;
+f0108a8f:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0108a96:	00 00 
+	wrv[1] = addr >> 4;
+f0108a98:	89 f0                	mov    %esi,%eax
+f0108a9a:	c1 e8 04             	shr    $0x4,%eax
+f0108a9d:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+	// "Universal startup algorithm."
+	// Send INIT (level-triggered) interrupt to reset other CPU.
+	lapicw(ICRHI, apicid << 24);
+f0108aa3:	c1 e7 18             	shl    $0x18,%edi
+f0108aa6:	89 fa                	mov    %edi,%edx
+f0108aa8:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108aad:	e8 8c fd ff ff       	call   f010883e <lapicw>
+	lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f0108ab2:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f0108ab7:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108abc:	e8 7d fd ff ff       	call   f010883e <lapicw>
+	while (us-- > 0)
+f0108ac1:	b9 c9 00 00 00       	mov    $0xc9,%ecx
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0108ac6:	ba 84 00 00 00       	mov    $0x84,%edx
+f0108acb:	eb 1e                	jmp    f0108aeb <lapic_startap+0x8d>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0108acd:	68 67 04 00 00       	push   $0x467
+f0108ad2:	8d 83 5c 47 ff ff    	lea    -0xb8a4(%ebx),%eax
+f0108ad8:	50                   	push   %eax
+f0108ad9:	68 9d 00 00 00       	push   $0x9d
+f0108ade:	8d 83 f8 63 ff ff    	lea    -0x9c08(%ebx),%eax
+f0108ae4:	50                   	push   %eax
+f0108ae5:	e8 0e 76 ff ff       	call   f01000f8 <_panic>
+f0108aea:	ec                   	in     (%dx),%al
+f0108aeb:	83 e9 01             	sub    $0x1,%ecx
+f0108aee:	75 fa                	jne    f0108aea <lapic_startap+0x8c>
+	microdelay(200);
+	lapicw(ICRLO, INIT | LEVEL);
+f0108af0:	ba 00 85 00 00       	mov    $0x8500,%edx
+f0108af5:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108afa:	e8 3f fd ff ff       	call   f010883e <lapicw>
+f0108aff:	b9 65 00 00 00       	mov    $0x65,%ecx
+f0108b04:	ba 84 00 00 00       	mov    $0x84,%edx
+f0108b09:	eb 01                	jmp    f0108b0c <lapic_startap+0xae>
+f0108b0b:	ec                   	in     (%dx),%al
+	while (us-- > 0)
+f0108b0c:	83 e9 01             	sub    $0x1,%ecx
+f0108b0f:	75 fa                	jne    f0108b0b <lapic_startap+0xad>
+	// state due to an INIT.  So the second should be ignored, but it is
+	// part of the official Intel algorithm.
+	// Bochs complains about the second one.  Too bad for Bochs.
+	for (i = 0; i < 2; i++) {
+		lapicw(ICRHI, apicid << 24);
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108b11:	c1 ee 0c             	shr    $0xc,%esi
+f0108b14:	81 ce 00 06 00 00    	or     $0x600,%esi
+		lapicw(ICRHI, apicid << 24);
+f0108b1a:	89 fa                	mov    %edi,%edx
+f0108b1c:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108b21:	e8 18 fd ff ff       	call   f010883e <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108b26:	89 f2                	mov    %esi,%edx
+f0108b28:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108b2d:	e8 0c fd ff ff       	call   f010883e <lapicw>
+f0108b32:	b9 c9 00 00 00       	mov    $0xc9,%ecx
+f0108b37:	ba 84 00 00 00       	mov    $0x84,%edx
+f0108b3c:	eb 01                	jmp    f0108b3f <lapic_startap+0xe1>
+f0108b3e:	ec                   	in     (%dx),%al
+	while (us-- > 0)
+f0108b3f:	83 e9 01             	sub    $0x1,%ecx
+f0108b42:	75 fa                	jne    f0108b3e <lapic_startap+0xe0>
+		lapicw(ICRHI, apicid << 24);
+f0108b44:	89 fa                	mov    %edi,%edx
+f0108b46:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0108b4b:	e8 ee fc ff ff       	call   f010883e <lapicw>
+		lapicw(ICRLO, STARTUP | (addr >> 12));
+f0108b50:	89 f2                	mov    %esi,%edx
+f0108b52:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108b57:	e8 e2 fc ff ff       	call   f010883e <lapicw>
+f0108b5c:	b9 c9 00 00 00       	mov    $0xc9,%ecx
+f0108b61:	ba 84 00 00 00       	mov    $0x84,%edx
+f0108b66:	eb 01                	jmp    f0108b69 <lapic_startap+0x10b>
+f0108b68:	ec                   	in     (%dx),%al
+	while (us-- > 0)
+f0108b69:	83 e9 01             	sub    $0x1,%ecx
+f0108b6c:	75 fa                	jne    f0108b68 <lapic_startap+0x10a>
+		microdelay(200);
+	}
+}
+f0108b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108b71:	5b                   	pop    %ebx
+f0108b72:	5e                   	pop    %esi
+f0108b73:	5f                   	pop    %edi
+f0108b74:	5d                   	pop    %ebp
+f0108b75:	c3                   	ret
+
+f0108b76 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0108b76:	55                   	push   %ebp
+f0108b77:	89 e5                	mov    %esp,%ebp
+f0108b79:	53                   	push   %ebx
+f0108b7a:	83 ec 04             	sub    $0x4,%esp
+f0108b7d:	e8 cd 77 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108b82:	81 c3 0a c9 00 00    	add    $0xc90a,%ebx
+	lapicw(ICRLO, OTHERS | FIXED | vector);
+f0108b88:	8b 55 08             	mov    0x8(%ebp),%edx
+f0108b8b:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0108b91:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0108b96:	e8 a3 fc ff ff       	call   f010883e <lapicw>
+	while (lapic[ICRLO] & DELIVS)
+f0108b9b:	c7 c0 04 60 19 f0    	mov    $0xf0196004,%eax
+f0108ba1:	8b 10                	mov    (%eax),%edx
+f0108ba3:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0108ba9:	f6 c4 10             	test   $0x10,%ah
+f0108bac:	75 f5                	jne    f0108ba3 <lapic_ipi+0x2d>
+		;
+}
+f0108bae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0108bb1:	c9                   	leave
+f0108bb2:	c3                   	ret
+
+f0108bb3 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0108bb3:	55                   	push   %ebp
+f0108bb4:	89 e5                	mov    %esp,%ebp
+f0108bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+	lk->locked = 0;
+f0108bb9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+	lk->name = name;
+f0108bbf:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0108bc2:	89 50 04             	mov    %edx,0x4(%eax)
+	lk->cpu = 0;
+f0108bc5:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f0108bcc:	5d                   	pop    %ebp
+f0108bcd:	c3                   	ret
+
+f0108bce <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f0108bce:	55                   	push   %ebp
+f0108bcf:	89 e5                	mov    %esp,%ebp
+f0108bd1:	57                   	push   %edi
+f0108bd2:	56                   	push   %esi
+f0108bd3:	53                   	push   %ebx
+f0108bd4:	83 ec 0c             	sub    $0xc,%esp
+f0108bd7:	e8 73 77 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108bdc:	81 c3 b0 c8 00 00    	add    $0xc8b0,%ebx
+f0108be2:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0108be5:	83 3e 00             	cmpl   $0x0,(%esi)
+f0108be8:	75 07                	jne    f0108bf1 <spin_lock+0x23>
+	asm volatile("lock; xchgl %0, %1"
+f0108bea:	ba 01 00 00 00       	mov    $0x1,%edx
+f0108bef:	eb 39                	jmp    f0108c2a <spin_lock+0x5c>
+f0108bf1:	8b 7e 08             	mov    0x8(%esi),%edi
+f0108bf4:	e8 c6 fc ff ff       	call   f01088bf <cpunum>
+f0108bf9:	6b c0 70             	imul   $0x70,%eax,%eax
+f0108bfc:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+#ifdef DEBUG_SPINLOCK
+	if (holding(lk))
+f0108c02:	39 c7                	cmp    %eax,%edi
+f0108c04:	75 e4                	jne    f0108bea <spin_lock+0x1c>
+		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f0108c06:	8b 76 04             	mov    0x4(%esi),%esi
+f0108c09:	e8 b1 fc ff ff       	call   f01088bf <cpunum>
+f0108c0e:	83 ec 0c             	sub    $0xc,%esp
+f0108c11:	56                   	push   %esi
+f0108c12:	50                   	push   %eax
+f0108c13:	8d 83 08 64 ff ff    	lea    -0x9bf8(%ebx),%eax
+f0108c19:	50                   	push   %eax
+f0108c1a:	6a 3a                	push   $0x3a
+f0108c1c:	8d 83 6a 64 ff ff    	lea    -0x9b96(%ebx),%eax
+f0108c22:	50                   	push   %eax
+f0108c23:	e8 d0 74 ff ff       	call   f01000f8 <_panic>
+
+	// The xchg is atomic.
+	// It also serializes, so that reads after acquire are not
+	// reordered before it.
+	while (xchg(&lk->locked, 1) != 0)
+		asm volatile ("pause");
+f0108c28:	f3 90                	pause
+f0108c2a:	89 d0                	mov    %edx,%eax
+f0108c2c:	f0 87 06             	lock xchg %eax,(%esi)
+	while (xchg(&lk->locked, 1) != 0)
+f0108c2f:	85 c0                	test   %eax,%eax
+f0108c31:	75 f5                	jne    f0108c28 <spin_lock+0x5a>
+
+	// Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
+f0108c33:	e8 87 fc ff ff       	call   f01088bf <cpunum>
+f0108c38:	6b c0 70             	imul   $0x70,%eax,%eax
+f0108c3b:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+f0108c41:	89 46 08             	mov    %eax,0x8(%esi)
+	asm volatile("movl %%ebp,%0" : "=r" (ebp));
+f0108c44:	89 ea                	mov    %ebp,%edx
+	for (i = 0; i < 10; i++){
+f0108c46:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ebp == 0 || ebp < (uint32_t *)KERNBASE)
+f0108c4b:	83 f8 09             	cmp    $0x9,%eax
+f0108c4e:	7f 21                	jg     f0108c71 <spin_lock+0xa3>
+f0108c50:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0108c56:	76 19                	jbe    f0108c71 <spin_lock+0xa3>
+		pcs[i] = ebp[1];          // saved %eip
+f0108c58:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0108c5b:	89 4c 86 0c          	mov    %ecx,0xc(%esi,%eax,4)
+		ebp = (uint32_t *)ebp[0]; // saved %ebp
+f0108c5f:	8b 12                	mov    (%edx),%edx
+	for (i = 0; i < 10; i++){
+f0108c61:	83 c0 01             	add    $0x1,%eax
+f0108c64:	eb e5                	jmp    f0108c4b <spin_lock+0x7d>
+		pcs[i] = 0;
+f0108c66:	c7 44 86 0c 00 00 00 	movl   $0x0,0xc(%esi,%eax,4)
+f0108c6d:	00 
+	for (; i < 10; i++)
+f0108c6e:	83 c0 01             	add    $0x1,%eax
+f0108c71:	83 f8 09             	cmp    $0x9,%eax
+f0108c74:	7e f0                	jle    f0108c66 <spin_lock+0x98>
+	get_caller_pcs(lk->pcs);
+#endif
+}
+f0108c76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108c79:	5b                   	pop    %ebx
+f0108c7a:	5e                   	pop    %esi
+f0108c7b:	5f                   	pop    %edi
+f0108c7c:	5d                   	pop    %ebp
+f0108c7d:	c3                   	ret
+
+f0108c7e <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f0108c7e:	55                   	push   %ebp
+f0108c7f:	89 e5                	mov    %esp,%ebp
+f0108c81:	57                   	push   %edi
+f0108c82:	56                   	push   %esi
+f0108c83:	53                   	push   %ebx
+f0108c84:	83 ec 5c             	sub    $0x5c,%esp
+f0108c87:	e8 c3 76 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108c8c:	81 c3 00 c8 00 00    	add    $0xc800,%ebx
+f0108c92:	8b 75 08             	mov    0x8(%ebp),%esi
+	return lock->locked && lock->cpu == thiscpu;
+f0108c95:	83 3e 00             	cmpl   $0x0,(%esi)
+f0108c98:	75 4e                	jne    f0108ce8 <spin_unlock+0x6a>
+#ifdef DEBUG_SPINLOCK
+	if (!holding(lk)) {
+		int i;
+		uint32_t pcs[10];
+		// Nab the acquiring EIP chain before it gets released
+		memmove(pcs, lk->pcs, sizeof pcs);
+f0108c9a:	83 ec 04             	sub    $0x4,%esp
+f0108c9d:	6a 28                	push   $0x28
+f0108c9f:	8d 46 0c             	lea    0xc(%esi),%eax
+f0108ca2:	50                   	push   %eax
+f0108ca3:	8d 7d c0             	lea    -0x40(%ebp),%edi
+f0108ca6:	57                   	push   %edi
+f0108ca7:	e8 97 f4 ff ff       	call   f0108143 <memmove>
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+			cpunum(), lk->name, lk->cpu->cpu_id);
+f0108cac:	8b 46 08             	mov    0x8(%esi),%eax
+		cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+f0108caf:	0f b6 00             	movzbl (%eax),%eax
+f0108cb2:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+f0108cb5:	8b 76 04             	mov    0x4(%esi),%esi
+f0108cb8:	e8 02 fc ff ff       	call   f01088bf <cpunum>
+f0108cbd:	ff 75 a4             	push   -0x5c(%ebp)
+f0108cc0:	56                   	push   %esi
+f0108cc1:	50                   	push   %eax
+f0108cc2:	8d 83 34 64 ff ff    	lea    -0x9bcc(%ebx),%eax
+f0108cc8:	50                   	push   %eax
+f0108cc9:	e8 c4 b3 ff ff       	call   f0104092 <cprintf>
+f0108cce:	8d 75 e8             	lea    -0x18(%ebp),%esi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0108cd1:	83 c4 20             	add    $0x20,%esp
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+					info.eip_file, info.eip_line,
+					info.eip_fn_namelen, info.eip_fn_name,
+					pcs[i] - info.eip_fn_addr);
+			else
+				cprintf("  %08x\n", pcs[i]);
+f0108cd4:	8d 83 91 64 ff ff    	lea    -0x9b6f(%ebx),%eax
+f0108cda:	89 45 a0             	mov    %eax,-0x60(%ebp)
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f0108cdd:	8d 83 7a 64 ff ff    	lea    -0x9b86(%ebx),%eax
+f0108ce3:	89 45 9c             	mov    %eax,-0x64(%ebp)
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0108ce6:	eb 49                	jmp    f0108d31 <spin_unlock+0xb3>
+	return lock->locked && lock->cpu == thiscpu;
+f0108ce8:	8b 7e 08             	mov    0x8(%esi),%edi
+f0108ceb:	e8 cf fb ff ff       	call   f01088bf <cpunum>
+f0108cf0:	6b c0 70             	imul   $0x70,%eax,%eax
+f0108cf3:	81 c0 20 50 15 f0    	add    $0xf0155020,%eax
+	if (!holding(lk)) {
+f0108cf9:	39 c7                	cmp    %eax,%edi
+f0108cfb:	75 9d                	jne    f0108c9a <spin_unlock+0x1c>
+		}
+		panic("spin_unlock");
+	}
+
+	lk->pcs[0] = 0;
+f0108cfd:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+	lk->cpu = 0;
+f0108d04:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+	asm volatile("lock; xchgl %0, %1"
+f0108d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0108d10:	f0 87 06             	lock xchg %eax,(%esi)
+	// respect to any other instruction which references the same memory.
+	// x86 CPUs will not reorder loads/stores across locked instructions
+	// (vol 3, 8.2.2). Because xchg() is implemented using asm volatile,
+	// gcc will not reorder C statements across the xchg.
+	xchg(&lk->locked, 0);
+}
+f0108d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108d16:	5b                   	pop    %ebx
+f0108d17:	5e                   	pop    %esi
+f0108d18:	5f                   	pop    %edi
+f0108d19:	5d                   	pop    %ebp
+f0108d1a:	c3                   	ret
+				cprintf("  %08x\n", pcs[i]);
+f0108d1b:	83 ec 08             	sub    $0x8,%esp
+f0108d1e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0108d21:	ff 30                	push   (%eax)
+f0108d23:	ff 75 a0             	push   -0x60(%ebp)
+f0108d26:	e8 67 b3 ff ff       	call   f0104092 <cprintf>
+f0108d2b:	83 c4 10             	add    $0x10,%esp
+f0108d2e:	83 c7 04             	add    $0x4,%edi
+		for (i = 0; i < 10 && pcs[i]; i++) {
+f0108d31:	39 f7                	cmp    %esi,%edi
+f0108d33:	74 45                	je     f0108d7a <spin_unlock+0xfc>
+f0108d35:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+f0108d38:	8b 07                	mov    (%edi),%eax
+f0108d3a:	85 c0                	test   %eax,%eax
+f0108d3c:	74 3c                	je     f0108d7a <spin_unlock+0xfc>
+			if (debuginfo_eip(pcs[i], &info) >= 0)
+f0108d3e:	83 ec 08             	sub    $0x8,%esp
+f0108d41:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0108d44:	52                   	push   %edx
+f0108d45:	50                   	push   %eax
+f0108d46:	e8 c3 bc ff ff       	call   f0104a0e <debuginfo_eip>
+f0108d4b:	83 c4 10             	add    $0x10,%esp
+f0108d4e:	85 c0                	test   %eax,%eax
+f0108d50:	78 c9                	js     f0108d1b <spin_unlock+0x9d>
+					pcs[i] - info.eip_fn_addr);
+f0108d52:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0108d55:	8b 00                	mov    (%eax),%eax
+				cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f0108d57:	83 ec 04             	sub    $0x4,%esp
+f0108d5a:	89 c2                	mov    %eax,%edx
+f0108d5c:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f0108d5f:	52                   	push   %edx
+f0108d60:	ff 75 b0             	push   -0x50(%ebp)
+f0108d63:	ff 75 b4             	push   -0x4c(%ebp)
+f0108d66:	ff 75 ac             	push   -0x54(%ebp)
+f0108d69:	ff 75 a8             	push   -0x58(%ebp)
+f0108d6c:	50                   	push   %eax
+f0108d6d:	ff 75 9c             	push   -0x64(%ebp)
+f0108d70:	e8 1d b3 ff ff       	call   f0104092 <cprintf>
+f0108d75:	83 c4 20             	add    $0x20,%esp
+f0108d78:	eb b4                	jmp    f0108d2e <spin_unlock+0xb0>
+		panic("spin_unlock");
+f0108d7a:	83 ec 04             	sub    $0x4,%esp
+f0108d7d:	8d 83 99 64 ff ff    	lea    -0x9b67(%ebx),%eax
+f0108d83:	50                   	push   %eax
+f0108d84:	6a 60                	push   $0x60
+f0108d86:	8d 83 6a 64 ff ff    	lea    -0x9b96(%ebx),%eax
+f0108d8c:	50                   	push   %eax
+f0108d8d:	e8 66 73 ff ff       	call   f01000f8 <_panic>
+
+f0108d92 <ide_wait_ready>:
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0108d92:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f0108d97:	ec                   	in     (%dx),%al
+static int
+ide_wait_ready(void)
+{
+	int r;
+
+	while (((r = inb(IDE_CMD)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+f0108d98:	89 c1                	mov    %eax,%ecx
+f0108d9a:	83 e1 c0             	and    $0xffffffc0,%ecx
+f0108d9d:	80 f9 40             	cmp    $0x40,%cl
+f0108da0:	75 f5                	jne    f0108d97 <ide_wait_ready+0x5>
+		/* do nothing */;
+	return (r & (IDE_DF|IDE_ERR)) ? -E_IO : 0;
+f0108da2:	83 e0 21             	and    $0x21,%eax
+f0108da5:	f6 d8                	neg    %al
+f0108da7:	19 c0                	sbb    %eax,%eax
+f0108da9:	83 e0 f9             	and    $0xfffffff9,%eax
+}
+f0108dac:	c3                   	ret
+
+f0108dad <ide_identify>:
+
+// Ask the drive for its parameters.  Fills in nsectors and returns
+// whether the drive can do DMA, or -E_IO if there is no drive.
+static int
+ide_identify(void)
+{
+f0108dad:	55                   	push   %ebp
+f0108dae:	89 e5                	mov    %esp,%ebp
+f0108db0:	57                   	push   %edi
+f0108db1:	56                   	push   %esi
+f0108db2:	53                   	push   %ebx
+f0108db3:	81 ec 00 02 00 00    	sub    $0x200,%esp
+f0108db9:	e8 91 75 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108dbe:	81 c3 ce c6 00 00    	add    $0xc6ce,%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0108dc4:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+f0108dc9:	ba f6 01 00 00       	mov    $0x1f6,%edx
+f0108dce:	ee                   	out    %al,(%dx)
+f0108dcf:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+f0108dd4:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f0108dd9:	ee                   	out    %al,(%dx)
+
+	outb(IDE_DRIVE, 0xE0);
+	outb(IDE_CMD, IDE_CMD_IDENTIFY);
+	// An empty channel reads as 0 or, with nothing driving the bus,
+	// as 0xFF, which looks busy forever.
+	for (i = 0; i < 100000 && ((r = inb(IDE_CMD)) & IDE_BSY); i++)
+f0108dda:	b9 a1 86 01 00       	mov    $0x186a1,%ecx
+	int i, r = 0;
+f0108ddf:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < 100000 && ((r = inb(IDE_CMD)) & IDE_BSY); i++)
+f0108de4:	83 e9 01             	sub    $0x1,%ecx
+f0108de7:	74 08                	je     f0108df1 <ide_identify+0x44>
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0108de9:	ec                   	in     (%dx),%al
+f0108dea:	0f b6 f0             	movzbl %al,%esi
+f0108ded:	84 c0                	test   %al,%al
+f0108def:	78 f3                	js     f0108de4 <ide_identify+0x37>
+		/* do nothing */;
+	if ((r & (IDE_BSY|IDE_DF|IDE_ERR)) || !(r & IDE_DRQ))
+f0108df1:	81 e6 a9 00 00 00    	and    $0xa9,%esi
+f0108df7:	83 fe 08             	cmp    $0x8,%esi
+f0108dfa:	75 42                	jne    f0108e3e <ide_identify+0x91>
+	asm volatile("cld\n\trepne\n\tinsw"
+f0108dfc:	8d bd f4 fd ff ff    	lea    -0x20c(%ebp),%edi
+f0108e02:	b9 00 01 00 00       	mov    $0x100,%ecx
+f0108e07:	ba f0 01 00 00       	mov    $0x1f0,%edx
+f0108e0c:	fc                   	cld
+f0108e0d:	f2 66 6d             	repnz insw (%dx),%es:(%edi)
+		return -E_IO;
+	insw(IDE_DATA, id, 256);
+
+	// Words 60-61 count the sectors reachable with 28-bit LBA;
+	// bit 8 of word 49 says the drive supports DMA.
+	nsectors = id[60] | (uint32_t) id[61] << 16;
+f0108e10:	0f b7 85 6e fe ff ff 	movzwl -0x192(%ebp),%eax
+f0108e17:	c1 e0 10             	shl    $0x10,%eax
+f0108e1a:	0f b7 95 6c fe ff ff 	movzwl -0x194(%ebp),%edx
+f0108e21:	09 d0                	or     %edx,%eax
+f0108e23:	89 83 80 ec 03 00    	mov    %eax,0x3ec80(%ebx)
+	return (id[49] & 0x100) != 0;
+f0108e29:	0f b6 85 57 fe ff ff 	movzbl -0x1a9(%ebp),%eax
+f0108e30:	83 e0 01             	and    $0x1,%eax
+}
+f0108e33:	81 c4 00 02 00 00    	add    $0x200,%esp
+f0108e39:	5b                   	pop    %ebx
+f0108e3a:	5e                   	pop    %esi
+f0108e3b:	5f                   	pop    %edi
+f0108e3c:	5d                   	pop    %ebp
+f0108e3d:	c3                   	ret
+		return -E_IO;
+f0108e3e:	b8 f9 ff ff ff       	mov    $0xfffffff9,%eax
+f0108e43:	eb ee                	jmp    f0108e33 <ide_identify+0x86>
+
+f0108e45 <ide_lock>:
+{
+f0108e45:	55                   	push   %ebp
+f0108e46:	89 e5                	mov    %esp,%ebp
+f0108e48:	56                   	push   %esi
+f0108e49:	53                   	push   %ebx
+f0108e4a:	e8 00 75 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f0108e4f:	81 c3 3d c6 00 00    	add    $0xc63d,%ebx
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0108e55:	9c                   	pushf
+f0108e56:	5e                   	pop    %esi
+	asm volatile("cli");
+f0108e57:	fa                   	cli
+	spin_lock(&ide_spinlock);
+f0108e58:	83 ec 0c             	sub    $0xc,%esp
+f0108e5b:	8d 83 f4 0e 00 00    	lea    0xef4(%ebx),%eax
+f0108e61:	50                   	push   %eax
+f0108e62:	e8 67 fd ff ff       	call   f0108bce <spin_lock>
+}
+f0108e67:	89 f0                	mov    %esi,%eax
+f0108e69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0108e6c:	5b                   	pop    %ebx
+f0108e6d:	5e                   	pop    %esi
+f0108e6e:	5d                   	pop    %ebp
+f0108e6f:	c3                   	ret
+
+f0108e70 <prd_fill>:
+
+// Describe req's buffer in prdt[] from entry n on.  Returns the
+// number of entries now in use, or -1 if the buffer does not fit.
+static int
+prd_fill(int n, struct Idereq *req)
+{
+f0108e70:	55                   	push   %ebp
+f0108e71:	89 e5                	mov    %esp,%ebp
+f0108e73:	57                   	push   %edi
+f0108e74:	56                   	push   %esi
+f0108e75:	53                   	push   %ebx
+f0108e76:	83 ec 0c             	sub    $0xc,%esp
+f0108e79:	e8 68 81 ff ff       	call   f0100fe6 <__x86.get_pc_thunk.cx>
+f0108e7e:	81 c1 0e c6 00 00    	add    $0xc60e,%ecx
+	physaddr_t pa = PADDR(req->ir_buf);
+f0108e84:	8b 5a 08             	mov    0x8(%edx),%ebx
+	if ((uint32_t)kva < KERNBASE)
+f0108e87:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0108e8d:	76 45                	jbe    f0108ed4 <prd_fill+0x64>
+f0108e8f:	89 c6                	mov    %eax,%esi
+	return (physaddr_t)kva - KERNBASE;
+f0108e91:	81 c3 00 00 00 10    	add    $0x10000000,%ebx
+	uint32_t len, left = req->ir_nsecs * SECTSIZE;
+f0108e97:	8b 52 04             	mov    0x4(%edx),%edx
+f0108e9a:	c1 e2 09             	shl    $0x9,%edx
+f0108e9d:	8d 8c c1 74 ed 03 00 	lea    0x3ed74(%ecx,%eax,8),%ecx
+
+	for (; left > 0; n++, pa += len, left -= len) {
+f0108ea4:	85 d2                	test   %edx,%edx
+f0108ea6:	74 4c                	je     f0108ef4 <prd_fill+0x84>
+		if (n == IDE_NPRD)
+f0108ea8:	83 fe 20             	cmp    $0x20,%esi
+f0108eab:	74 42                	je     f0108eef <prd_fill+0x7f>
+			return -1;
+		len = MIN(left, 0x10000 - (pa & 0xFFFF));
+f0108ead:	0f b7 fb             	movzwl %bx,%edi
+f0108eb0:	b8 00 00 01 00       	mov    $0x10000,%eax
+f0108eb5:	29 f8                	sub    %edi,%eax
+f0108eb7:	39 d0                	cmp    %edx,%eax
+f0108eb9:	0f 47 c2             	cmova  %edx,%eax
+		prdt[n].prd_pa = pa;
+f0108ebc:	89 19                	mov    %ebx,(%ecx)
+		prdt[n].prd_count = len;	// 64KB truncates to 0
+f0108ebe:	66 89 41 04          	mov    %ax,0x4(%ecx)
+		prdt[n].prd_flags = 0;
+f0108ec2:	66 c7 41 06 00 00    	movw   $0x0,0x6(%ecx)
+	for (; left > 0; n++, pa += len, left -= len) {
+f0108ec8:	83 c6 01             	add    $0x1,%esi
+f0108ecb:	01 c3                	add    %eax,%ebx
+f0108ecd:	29 c2                	sub    %eax,%edx
+f0108ecf:	83 c1 08             	add    $0x8,%ecx
+f0108ed2:	eb d0                	jmp    f0108ea4 <prd_fill+0x34>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0108ed4:	53                   	push   %ebx
+f0108ed5:	8d 81 e8 52 ff ff    	lea    -0xad18(%ecx),%eax
+f0108edb:	50                   	push   %eax
+f0108edc:	68 f7 00 00 00       	push   $0xf7
+f0108ee1:	8d 81 6b 65 ff ff    	lea    -0x9a95(%ecx),%eax
+f0108ee7:	50                   	push   %eax
+f0108ee8:	89 cb                	mov    %ecx,%ebx
+f0108eea:	e8 09 72 ff ff       	call   f01000f8 <_panic>
+			return -1;
+f0108eef:	be ff ff ff ff       	mov    $0xffffffff,%esi
+	}
+	return n;
+}
+f0108ef4:	89 f0                	mov    %esi,%eax
+f0108ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0108ef9:	5b                   	pop    %ebx
+f0108efa:	5e                   	pop    %esi
+f0108efb:	5f                   	pop    %edi
+f0108efc:	5d                   	pop    %ebp
+f0108efd:	c3                   	ret
+
+f0108efe <ide_start>:
+// command for the request at the head of the queue and the ones that
+// follow it on disk; with PIO it works through the whole queue.
+// Called with the lock held.
+static void
+ide_start(void)
+{
+f0108efe:	55                   	push   %ebp
+f0108eff:	89 e5                	mov    %esp,%ebp
+f0108f01:	57                   	push   %edi
+f0108f02:	56                   	push   %esi
+f0108f03:	53                   	push   %ebx
+f0108f04:	83 ec 2c             	sub    $0x2c,%esp
+f0108f07:	e8 d2 80 ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0108f0c:	05 80 c5 00 00       	add    $0xc580,%eax
+f0108f11:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if ((uint32_t)kva < KERNBASE)
+f0108f14:	8d 80 74 ed 03 00    	lea    0x3ed74(%eax),%eax
+f0108f1a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f0108f1d:	05 00 00 00 10       	add    $0x10000000,%eax
+f0108f22:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	struct Idereq *req, *last;
+	uint32_t secno, nsecs;
+	int n, nprd, write;
+
+	while (!active && queue) {
+f0108f25:	eb 65                	jmp    f0108f8c <ide_start+0x8e>
+	asm volatile("cld\n\trepne\n\tinsl"
+f0108f27:	8b 7d dc             	mov    -0x24(%ebp),%edi
+f0108f2a:	b9 80 00 00 00       	mov    $0x80,%ecx
+f0108f2f:	ba f0 01 00 00       	mov    $0x1f0,%edx
+f0108f34:	fc                   	cld
+f0108f35:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (i = 0; i < req->ir_nsecs; i++, p += SECTSIZE) {
+f0108f37:	83 c3 01             	add    $0x1,%ebx
+f0108f3a:	81 45 dc 00 02 00 00 	addl   $0x200,-0x24(%ebp)
+f0108f41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108f44:	3b 58 04             	cmp    0x4(%eax),%ebx
+f0108f47:	73 24                	jae    f0108f6d <ide_start+0x6f>
+		if ((r = ide_wait_ready()) < 0)
+f0108f49:	e8 44 fe ff ff       	call   f0108d92 <ide_wait_ready>
+f0108f4e:	85 c0                	test   %eax,%eax
+f0108f50:	78 2b                	js     f0108f7d <ide_start+0x7f>
+		if (req->ir_write)
+f0108f52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0108f55:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+f0108f59:	74 cc                	je     f0108f27 <ide_start+0x29>
+	asm volatile("cld\n\trepne\n\toutsl"
+f0108f5b:	8b 75 dc             	mov    -0x24(%ebp),%esi
+f0108f5e:	b9 80 00 00 00       	mov    $0x80,%ecx
+f0108f63:	ba f0 01 00 00       	mov    $0x1f0,%edx
+f0108f68:	fc                   	cld
+f0108f69:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+}
+f0108f6b:	eb ca                	jmp    f0108f37 <ide_start+0x39>
+	return req->ir_write ? ide_wait_ready() : 0;
+f0108f6d:	89 c6                	mov    %eax,%esi
+f0108f6f:	8b 40 0c             	mov    0xc(%eax),%eax
+f0108f72:	85 c0                	test   %eax,%eax
+f0108f74:	74 0a                	je     f0108f80 <ide_start+0x82>
+f0108f76:	e8 17 fe ff ff       	call   f0108d92 <ide_wait_ready>
+f0108f7b:	eb 03                	jmp    f0108f80 <ide_start+0x82>
+f0108f7d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+f0108f80:	89 f2                	mov    %esi,%edx
+		next = req->ir_next;
+f0108f82:	8b 76 14             	mov    0x14(%esi),%esi
+		req->ir_status = r;
+f0108f85:	89 42 10             	mov    %eax,0x10(%edx)
+	for (; req; req = next) {
+f0108f88:	85 f6                	test   %esi,%esi
+f0108f8a:	75 f4                	jne    f0108f80 <ide_start+0x82>
+	while (!active && queue) {
+f0108f8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0108f8f:	83 b8 78 ec 03 00 00 	cmpl   $0x0,0x3ec78(%eax)
+f0108f96:	0f 85 5c 02 00 00    	jne    f01091f8 <ide_start+0x2fa>
+f0108f9c:	8b b0 7c ec 03 00    	mov    0x3ec7c(%eax),%esi
+f0108fa2:	85 f6                	test   %esi,%esi
+f0108fa4:	0f 84 4e 02 00 00    	je     f01091f8 <ide_start+0x2fa>
+		req = active = last = queue;
+f0108faa:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0108fad:	89 b1 78 ec 03 00    	mov    %esi,0x3ec78(%ecx)
+		queue = req->ir_next;
+f0108fb3:	8b 46 14             	mov    0x14(%esi),%eax
+f0108fb6:	89 81 7c ec 03 00    	mov    %eax,0x3ec7c(%ecx)
+		req->ir_next = NULL;
+f0108fbc:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+		secno = req->ir_secno;
+f0108fc3:	8b 3e                	mov    (%esi),%edi
+		nsecs = req->ir_nsecs;
+f0108fc5:	8b 5e 04             	mov    0x4(%esi),%ebx
+		write = req->ir_write;
+f0108fc8:	8b 46 0c             	mov    0xc(%esi),%eax
+f0108fcb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+		headpos = secno + nsecs;
+f0108fce:	89 7d d8             	mov    %edi,-0x28(%ebp)
+f0108fd1:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+f0108fd4:	89 81 74 ec 03 00    	mov    %eax,0x3ec74(%ecx)
+
+		if (!bmbase) {
+f0108fda:	0f b7 b9 84 ec 03 00 	movzwl 0x3ec84(%ecx),%edi
+f0108fe1:	66 85 ff             	test   %di,%di
+f0108fe4:	75 74                	jne    f010905a <ide_start+0x15c>
+			active = NULL;
+f0108fe6:	c7 81 78 ec 03 00 00 	movl   $0x0,0x3ec78(%ecx)
+f0108fed:	00 00 00 
+	uint8_t *p = req->ir_buf;
+f0108ff0:	8b 56 08             	mov    0x8(%esi),%edx
+f0108ff3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	if ((r = ide_wait_ready()) < 0)
+f0108ff6:	e8 97 fd ff ff       	call   f0108d92 <ide_wait_ready>
+f0108ffb:	85 c0                	test   %eax,%eax
+f0108ffd:	78 81                	js     f0108f80 <ide_start+0x82>
+	ide_command(req->ir_secno, req->ir_nsecs,
+f0108fff:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+f0109003:	19 c9                	sbb    %ecx,%ecx
+f0109005:	83 e1 f0             	and    $0xfffffff0,%ecx
+f0109008:	83 c1 30             	add    $0x30,%ecx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010900b:	ba f2 01 00 00       	mov    $0x1f2,%edx
+f0109010:	89 d8                	mov    %ebx,%eax
+f0109012:	ee                   	out    %al,(%dx)
+f0109013:	ba f3 01 00 00       	mov    $0x1f3,%edx
+f0109018:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f010901b:	89 f8                	mov    %edi,%eax
+f010901d:	ee                   	out    %al,(%dx)
+	outb(IDE_LBA1, secno >> 8);
+f010901e:	89 f8                	mov    %edi,%eax
+f0109020:	c1 e8 08             	shr    $0x8,%eax
+f0109023:	ba f4 01 00 00       	mov    $0x1f4,%edx
+f0109028:	ee                   	out    %al,(%dx)
+	outb(IDE_LBA2, secno >> 16);
+f0109029:	89 f8                	mov    %edi,%eax
+f010902b:	c1 e8 10             	shr    $0x10,%eax
+f010902e:	ba f5 01 00 00       	mov    $0x1f5,%edx
+f0109033:	ee                   	out    %al,(%dx)
+	outb(IDE_DRIVE, 0xE0 | ((secno >> 24) & 0x0F));
+f0109034:	89 f8                	mov    %edi,%eax
+f0109036:	c1 e8 18             	shr    $0x18,%eax
+f0109039:	83 e0 0f             	and    $0xf,%eax
+f010903c:	83 c8 e0             	or     $0xffffffe0,%eax
+f010903f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+f0109044:	ee                   	out    %al,(%dx)
+f0109045:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f010904a:	89 c8                	mov    %ecx,%eax
+f010904c:	ee                   	out    %al,(%dx)
+	for (i = 0; i < req->ir_nsecs; i++, p += SECTSIZE) {
+f010904d:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0109052:	89 75 e0             	mov    %esi,-0x20(%ebp)
+}
+f0109055:	e9 e7 fe ff ff       	jmp    f0108f41 <ide_start+0x43>
+			ide_complete(req, ide_pio(req));
+			continue;
+		}
+
+		nprd = prd_fill(0, req);
+f010905a:	89 f2                	mov    %esi,%edx
+f010905c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109061:	e8 0a fe ff ff       	call   f0108e70 <prd_fill>
+		assert(nprd > 0);
+f0109066:	85 c0                	test   %eax,%eax
+f0109068:	7e 0e                	jle    f0109078 <ide_start+0x17a>
+		req = active = last = queue;
+f010906a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+f010906d:	66 89 7d dc          	mov    %di,-0x24(%ebp)
+f0109071:	89 c7                	mov    %eax,%edi
+f0109073:	89 75 d0             	mov    %esi,-0x30(%ebp)
+f0109076:	eb 43                	jmp    f01090bb <ide_start+0x1bd>
+		assert(nprd > 0);
+f0109078:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f010907b:	8d 83 76 65 ff ff    	lea    -0x9a8a(%ebx),%eax
+f0109081:	50                   	push   %eax
+f0109082:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0109088:	50                   	push   %eax
+f0109089:	68 2c 01 00 00       	push   $0x12c
+f010908e:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109094:	50                   	push   %eax
+f0109095:	e8 5e 70 ff ff       	call   f01000f8 <_panic>
+		while ((req = queue) && req->ir_secno == secno + nsecs
+		       && req->ir_write == write
+		       && nsecs + req->ir_nsecs <= IDE_MAXSECTS
+		       && (n = prd_fill(nprd, req)) > 0) {
+			queue = req->ir_next;
+f010909a:	8b 56 14             	mov    0x14(%esi),%edx
+f010909d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01090a0:	89 91 7c ec 03 00    	mov    %edx,0x3ec7c(%ecx)
+			req->ir_next = NULL;
+f01090a6:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+			last = last->ir_next = req;
+f01090ad:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01090b0:	89 71 14             	mov    %esi,0x14(%ecx)
+			nsecs += req->ir_nsecs;
+f01090b3:	03 5e 04             	add    0x4(%esi),%ebx
+			nprd = n;
+f01090b6:	89 c7                	mov    %eax,%edi
+			last = last->ir_next = req;
+f01090b8:	89 75 e0             	mov    %esi,-0x20(%ebp)
+		while ((req = queue) && req->ir_secno == secno + nsecs
+f01090bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01090be:	8b b0 7c ec 03 00    	mov    0x3ec7c(%eax),%esi
+		       && (n = prd_fill(nprd, req)) > 0) {
+f01090c4:	85 f6                	test   %esi,%esi
+f01090c6:	74 2a                	je     f01090f2 <ide_start+0x1f4>
+		while ((req = queue) && req->ir_secno == secno + nsecs
+f01090c8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01090cb:	01 d8                	add    %ebx,%eax
+f01090cd:	39 06                	cmp    %eax,(%esi)
+f01090cf:	75 21                	jne    f01090f2 <ide_start+0x1f4>
+		       && req->ir_write == write
+f01090d1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f01090d4:	39 46 0c             	cmp    %eax,0xc(%esi)
+f01090d7:	75 19                	jne    f01090f2 <ide_start+0x1f4>
+		       && nsecs + req->ir_nsecs <= IDE_MAXSECTS
+f01090d9:	89 d8                	mov    %ebx,%eax
+f01090db:	03 46 04             	add    0x4(%esi),%eax
+f01090de:	3d 00 01 00 00       	cmp    $0x100,%eax
+f01090e3:	77 0d                	ja     f01090f2 <ide_start+0x1f4>
+		       && (n = prd_fill(nprd, req)) > 0) {
+f01090e5:	89 f2                	mov    %esi,%edx
+f01090e7:	89 f8                	mov    %edi,%eax
+f01090e9:	e8 82 fd ff ff       	call   f0108e70 <prd_fill>
+f01090ee:	85 c0                	test   %eax,%eax
+f01090f0:	7f a8                	jg     f010909a <ide_start+0x19c>
+		}
+		prdt[nprd - 1].prd_flags = PRD_EOT;
+f01090f2:	89 fa                	mov    %edi,%edx
+f01090f4:	0f b7 7d dc          	movzwl -0x24(%ebp),%edi
+f01090f8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f01090fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01090fe:	66 c7 84 d1 72 ed 03 	movw   $0x8000,0x3ed72(%ecx,%edx,8)
+f0109105:	00 00 80 
+		headpos = secno + nsecs;
+f0109108:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f010910b:	01 d8                	add    %ebx,%eax
+f010910d:	89 81 74 ec 03 00    	mov    %eax,0x3ec74(%ecx)
+
+		if (ide_wait_ready() < 0) {
+f0109113:	e8 7a fc ff ff       	call   f0108d92 <ide_wait_ready>
+f0109118:	85 c0                	test   %eax,%eax
+f010911a:	0f 88 94 00 00 00    	js     f01091b4 <ide_start+0x2b6>
+	if ((uint32_t)kva < KERNBASE)
+f0109120:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0109127:	0f 86 a9 00 00 00    	jbe    f01091d6 <ide_start+0x2d8>
+			req = active;
+			active = NULL;
+			ide_complete(req, -E_IO);
+			continue;
+		}
+		outl(bmbase + BM_PRDT, PADDR(prdt));
+f010912d:	0f b7 ff             	movzwl %di,%edi
+f0109130:	8d 57 04             	lea    0x4(%edi),%edx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0109133:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f0109136:	ef                   	out    %eax,(%dx)
+		outb(bmbase + BM_CMD, write ? 0 : BM_CMD_READ);
+f0109137:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f010913a:	85 c9                	test   %ecx,%ecx
+f010913c:	0f 94 c0             	sete   %al
+f010913f:	0f b6 c0             	movzbl %al,%eax
+f0109142:	c1 e0 03             	shl    $0x3,%eax
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0109145:	89 fa                	mov    %edi,%edx
+f0109147:	ee                   	out    %al,(%dx)
+		outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+f0109148:	8d 57 02             	lea    0x2(%edi),%edx
+f010914b:	b8 06 00 00 00       	mov    $0x6,%eax
+f0109150:	ee                   	out    %al,(%dx)
+		ide_command(secno, nsecs,
+f0109151:	83 f9 01             	cmp    $0x1,%ecx
+f0109154:	19 f6                	sbb    %esi,%esi
+f0109156:	83 e6 fe             	and    $0xfffffffe,%esi
+f0109159:	81 c6 ca 00 00 00    	add    $0xca,%esi
+f010915f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+f0109164:	89 d8                	mov    %ebx,%eax
+f0109166:	ee                   	out    %al,(%dx)
+f0109167:	ba f3 01 00 00       	mov    $0x1f3,%edx
+f010916c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+f010916f:	89 d8                	mov    %ebx,%eax
+f0109171:	ee                   	out    %al,(%dx)
+	outb(IDE_LBA1, secno >> 8);
+f0109172:	89 d8                	mov    %ebx,%eax
+f0109174:	c1 e8 08             	shr    $0x8,%eax
+f0109177:	ba f4 01 00 00       	mov    $0x1f4,%edx
+f010917c:	ee                   	out    %al,(%dx)
+	outb(IDE_LBA2, secno >> 16);
+f010917d:	89 d8                	mov    %ebx,%eax
+f010917f:	c1 e8 10             	shr    $0x10,%eax
+f0109182:	ba f5 01 00 00       	mov    $0x1f5,%edx
+f0109187:	ee                   	out    %al,(%dx)
+	outb(IDE_DRIVE, 0xE0 | ((secno >> 24) & 0x0F));
+f0109188:	89 d8                	mov    %ebx,%eax
+f010918a:	c1 e8 18             	shr    $0x18,%eax
+f010918d:	83 e0 0f             	and    $0xf,%eax
+f0109190:	83 c8 e0             	or     $0xffffffe0,%eax
+f0109193:	ba f6 01 00 00       	mov    $0x1f6,%edx
+f0109198:	ee                   	out    %al,(%dx)
+f0109199:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f010919e:	89 f0                	mov    %esi,%eax
+f01091a0:	ee                   	out    %al,(%dx)
+			    write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+		outb(bmbase + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+f01091a1:	83 f9 01             	cmp    $0x1,%ecx
+f01091a4:	19 c0                	sbb    %eax,%eax
+f01091a6:	83 e0 08             	and    $0x8,%eax
+f01091a9:	83 c0 01             	add    $0x1,%eax
+f01091ac:	89 fa                	mov    %edi,%edx
+f01091ae:	ee                   	out    %al,(%dx)
+}
+f01091af:	e9 d8 fd ff ff       	jmp    f0108f8c <ide_start+0x8e>
+			active = NULL;
+f01091b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01091b7:	c7 80 78 ec 03 00 00 	movl   $0x0,0x3ec78(%eax)
+f01091be:	00 00 00 
+f01091c1:	89 f0                	mov    %esi,%eax
+		next = req->ir_next;
+f01091c3:	8b 76 14             	mov    0x14(%esi),%esi
+		req->ir_status = r;
+f01091c6:	c7 40 10 f9 ff ff ff 	movl   $0xfffffff9,0x10(%eax)
+	for (; req; req = next) {
+f01091cd:	85 f6                	test   %esi,%esi
+f01091cf:	75 f0                	jne    f01091c1 <ide_start+0x2c3>
+f01091d1:	e9 b6 fd ff ff       	jmp    f0108f8c <ide_start+0x8e>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01091d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01091d9:	8d 83 74 ed 03 00    	lea    0x3ed74(%ebx),%eax
+f01091df:	50                   	push   %eax
+f01091e0:	8d 83 e8 52 ff ff    	lea    -0xad18(%ebx),%eax
+f01091e6:	50                   	push   %eax
+f01091e7:	68 40 01 00 00       	push   $0x140
+f01091ec:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f01091f2:	50                   	push   %eax
+f01091f3:	e8 00 6f ff ff       	call   f01000f8 <_panic>
+	}
+}
+f01091f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01091fb:	5b                   	pop    %ebx
+f01091fc:	5e                   	pop    %esi
+f01091fd:	5f                   	pop    %edi
+f01091fe:	5d                   	pop    %ebp
+f01091ff:	c3                   	ret
+
+f0109200 <ide_poll>:
+
+// Finish the command in progress if the drive has signalled that it
+// is done, and start the next one.  Called with the lock held.
+static void
+ide_poll(void)
+{
+f0109200:	55                   	push   %ebp
+f0109201:	89 e5                	mov    %esp,%ebp
+f0109203:	57                   	push   %edi
+f0109204:	56                   	push   %esi
+f0109205:	53                   	push   %ebx
+f0109206:	83 ec 1c             	sub    $0x1c,%esp
+f0109209:	e8 dc 7d ff ff       	call   f0100fea <__x86.get_pc_thunk.si>
+f010920e:	81 c6 7e c2 00 00    	add    $0xc27e,%esi
+	struct Idereq *req;
+	uint8_t bmst, st;
+
+	if (!bmbase)
+f0109214:	0f b7 9e 84 ec 03 00 	movzwl 0x3ec84(%esi),%ebx
+f010921b:	66 85 db             	test   %bx,%bx
+f010921e:	74 60                	je     f0109280 <ide_poll+0x80>
+		return;
+	if (!active) {
+f0109220:	8b 8e 78 ec 03 00    	mov    0x3ec78(%esi),%ecx
+f0109226:	85 c9                	test   %ecx,%ecx
+f0109228:	74 5e                	je     f0109288 <ide_poll+0x88>
+		// Nothing to finish; just acknowledge the drive.
+		inb(IDE_CMD);
+		return;
+	}
+	if (!((bmst = inb(bmbase + BM_STATUS)) & BM_ST_IRQ))
+f010922a:	0f b7 db             	movzwl %bx,%ebx
+f010922d:	8d 7b 02             	lea    0x2(%ebx),%edi
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109230:	89 fa                	mov    %edi,%edx
+f0109232:	ec                   	in     (%dx),%al
+f0109233:	88 45 e7             	mov    %al,-0x19(%ebp)
+f0109236:	a8 04                	test   $0x4,%al
+f0109238:	74 46                	je     f0109280 <ide_poll+0x80>
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010923a:	b8 00 00 00 00       	mov    $0x0,%eax
+f010923f:	89 da                	mov    %ebx,%edx
+f0109241:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109242:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f0109247:	ec                   	in     (%dx),%al
+f0109248:	89 c3                	mov    %eax,%ebx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010924a:	b8 06 00 00 00       	mov    $0x6,%eax
+f010924f:	89 fa                	mov    %edi,%edx
+f0109251:	ee                   	out    %al,(%dx)
+	outb(bmbase + BM_CMD, 0);
+	st = inb(IDE_CMD);	// also acknowledges the drive's interrupt
+	outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+
+	req = active;
+	active = NULL;
+f0109252:	c7 86 78 ec 03 00 00 	movl   $0x0,0x3ec78(%esi)
+f0109259:	00 00 00 
+	ide_complete(req, (bmst & BM_ST_ERR) || (st & (IDE_DF|IDE_ERR))
+f010925c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0109260:	83 e0 02             	and    $0x2,%eax
+f0109263:	83 e3 21             	and    $0x21,%ebx
+f0109266:	09 c3                	or     %eax,%ebx
+f0109268:	f6 db                	neg    %bl
+f010926a:	19 d2                	sbb    %edx,%edx
+f010926c:	83 e2 f9             	and    $0xfffffff9,%edx
+f010926f:	89 c8                	mov    %ecx,%eax
+		next = req->ir_next;
+f0109271:	8b 49 14             	mov    0x14(%ecx),%ecx
+		req->ir_status = r;
+f0109274:	89 50 10             	mov    %edx,0x10(%eax)
+	for (; req; req = next) {
+f0109277:	85 c9                	test   %ecx,%ecx
+f0109279:	75 f4                	jne    f010926f <ide_poll+0x6f>
+		     ? -E_IO : 0);
+	ide_start();
+f010927b:	e8 7e fc ff ff       	call   f0108efe <ide_start>
+}
+f0109280:	83 c4 1c             	add    $0x1c,%esp
+f0109283:	5b                   	pop    %ebx
+f0109284:	5e                   	pop    %esi
+f0109285:	5f                   	pop    %edi
+f0109286:	5d                   	pop    %ebp
+f0109287:	c3                   	ret
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109288:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f010928d:	ec                   	in     (%dx),%al
+		return;
+f010928e:	eb f0                	jmp    f0109280 <ide_poll+0x80>
+
+f0109290 <ide_intr>:
+
+// Called on IRQ_IDE
+void
+ide_intr(void)
+{
+f0109290:	55                   	push   %ebp
+f0109291:	89 e5                	mov    %esp,%ebp
+f0109293:	56                   	push   %esi
+f0109294:	53                   	push   %ebx
+f0109295:	e8 b5 70 ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f010929a:	81 c3 f2 c1 00 00    	add    $0xc1f2,%ebx
+	uint32_t eflags = ide_lock();
+f01092a0:	e8 a0 fb ff ff       	call   f0108e45 <ide_lock>
+f01092a5:	89 c6                	mov    %eax,%esi
+
+	ide_poll();
+f01092a7:	e8 54 ff ff ff       	call   f0109200 <ide_poll>
+	spin_unlock(&ide_spinlock);
+f01092ac:	83 ec 0c             	sub    $0xc,%esp
+f01092af:	8d 83 f4 0e 00 00    	lea    0xef4(%ebx),%eax
+f01092b5:	50                   	push   %eax
+f01092b6:	e8 c3 f9 ff ff       	call   f0108c7e <spin_unlock>
+	asm volatile("pushl %0; popfl" : : "r" (eflags));
+f01092bb:	56                   	push   %esi
+f01092bc:	9d                   	popf
+	ide_unlock(eflags);
+}
+f01092bd:	83 c4 10             	add    $0x10,%esp
+f01092c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01092c3:	5b                   	pop    %ebx
+f01092c4:	5e                   	pop    %esi
+f01092c5:	5d                   	pop    %ebp
+f01092c6:	c3                   	ret
+
+f01092c7 <ide_submit>:
+	return a->ir_secno <= b->ir_secno;
+}
+
+void
+ide_submit(struct Idereq *req)
+{
+f01092c7:	55                   	push   %ebp
+f01092c8:	89 e5                	mov    %esp,%ebp
+f01092ca:	57                   	push   %edi
+f01092cb:	56                   	push   %esi
+f01092cc:	53                   	push   %ebx
+f01092cd:	83 ec 1c             	sub    $0x1c,%esp
+f01092d0:	e8 09 7d ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f01092d5:	05 b7 c1 00 00       	add    $0xc1b7,%eax
+f01092da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01092dd:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct Idereq **pp;
+	uint32_t eflags;
+
+	assert(req->ir_nsecs >= 1 && req->ir_nsecs <= IDE_MAXSECTS);
+f01092e0:	8b 56 04             	mov    0x4(%esi),%edx
+f01092e3:	8d 42 ff             	lea    -0x1(%edx),%eax
+f01092e6:	3d ff 00 00 00       	cmp    $0xff,%eax
+f01092eb:	77 2a                	ja     f0109317 <ide_submit+0x50>
+	assert(((uintptr_t) req->ir_buf & 1) == 0);
+f01092ed:	f6 46 08 01          	testb  $0x1,0x8(%esi)
+f01092f1:	75 46                	jne    f0109339 <ide_submit+0x72>
+
+	if (req->ir_secno >= nsectors
+f01092f3:	8b 0e                	mov    (%esi),%ecx
+f01092f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01092f8:	8b 80 80 ec 03 00    	mov    0x3ec80(%eax),%eax
+f01092fe:	39 c1                	cmp    %eax,%ecx
+f0109300:	73 06                	jae    f0109308 <ide_submit+0x41>
+	    || req->ir_nsecs > nsectors - req->ir_secno) {
+f0109302:	29 c8                	sub    %ecx,%eax
+f0109304:	39 d0                	cmp    %edx,%eax
+f0109306:	73 53                	jae    f010935b <ide_submit+0x94>
+		req->ir_status = -E_INVAL;
+f0109308:	c7 46 10 fd ff ff ff 	movl   $0xfffffffd,0x10(%esi)
+		/* do nothing */;
+	req->ir_next = *pp;
+	*pp = req;
+	ide_start();
+	ide_unlock(eflags);
+}
+f010930f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0109312:	5b                   	pop    %ebx
+f0109313:	5e                   	pop    %esi
+f0109314:	5f                   	pop    %edi
+f0109315:	5d                   	pop    %ebp
+f0109316:	c3                   	ret
+	assert(req->ir_nsecs >= 1 && req->ir_nsecs <= IDE_MAXSECTS);
+f0109317:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010931a:	8d 83 a8 64 ff ff    	lea    -0x9b58(%ebx),%eax
+f0109320:	50                   	push   %eax
+f0109321:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0109327:	50                   	push   %eax
+f0109328:	68 81 01 00 00       	push   $0x181
+f010932d:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109333:	50                   	push   %eax
+f0109334:	e8 bf 6d ff ff       	call   f01000f8 <_panic>
+	assert(((uintptr_t) req->ir_buf & 1) == 0);
+f0109339:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f010933c:	8d 83 dc 64 ff ff    	lea    -0x9b24(%ebx),%eax
+f0109342:	50                   	push   %eax
+f0109343:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0109349:	50                   	push   %eax
+f010934a:	68 82 01 00 00       	push   $0x182
+f010934f:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109355:	50                   	push   %eax
+f0109356:	e8 9d 6d ff ff       	call   f01000f8 <_panic>
+	req->ir_status = IDE_PENDING;
+f010935b:	c7 46 10 01 00 00 00 	movl   $0x1,0x10(%esi)
+	eflags = ide_lock();
+f0109362:	e8 de fa ff ff       	call   f0108e45 <ide_lock>
+f0109367:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	bool apassed = a->ir_secno < headpos, bpassed = b->ir_secno < headpos;
+f010936a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010936d:	8b 88 74 ec 03 00    	mov    0x3ec74(%eax),%ecx
+	for (pp = &queue; *pp && ide_before(*pp, req); pp = &(*pp)->ir_next)
+f0109373:	8d b8 7c ec 03 00    	lea    0x3ec7c(%eax),%edi
+f0109379:	89 75 08             	mov    %esi,0x8(%ebp)
+f010937c:	eb 07                	jmp    f0109385 <ide_submit+0xbe>
+f010937e:	39 ce                	cmp    %ecx,%esi
+f0109380:	73 29                	jae    f01093ab <ide_submit+0xe4>
+f0109382:	8d 78 14             	lea    0x14(%eax),%edi
+f0109385:	8b 07                	mov    (%edi),%eax
+f0109387:	85 c0                	test   %eax,%eax
+f0109389:	74 25                	je     f01093b0 <ide_submit+0xe9>
+	bool apassed = a->ir_secno < headpos, bpassed = b->ir_secno < headpos;
+f010938b:	8b 10                	mov    (%eax),%edx
+f010938d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0109390:	8b 33                	mov    (%ebx),%esi
+f0109392:	39 ca                	cmp    %ecx,%edx
+f0109394:	0f 92 45 e7          	setb   -0x19(%ebp)
+f0109398:	39 ce                	cmp    %ecx,%esi
+f010939a:	0f 92 c3             	setb   %bl
+	if (apassed != bpassed)
+f010939d:	38 5d e7             	cmp    %bl,-0x19(%ebp)
+f01093a0:	75 dc                	jne    f010937e <ide_submit+0xb7>
+	for (pp = &queue; *pp && ide_before(*pp, req); pp = &(*pp)->ir_next)
+f01093a2:	39 d6                	cmp    %edx,%esi
+f01093a4:	73 dc                	jae    f0109382 <ide_submit+0xbb>
+f01093a6:	8b 75 08             	mov    0x8(%ebp),%esi
+f01093a9:	eb 08                	jmp    f01093b3 <ide_submit+0xec>
+f01093ab:	8b 75 08             	mov    0x8(%ebp),%esi
+f01093ae:	eb 03                	jmp    f01093b3 <ide_submit+0xec>
+f01093b0:	8b 75 08             	mov    0x8(%ebp),%esi
+	req->ir_next = *pp;
+f01093b3:	89 46 14             	mov    %eax,0x14(%esi)
+	*pp = req;
+f01093b6:	89 37                	mov    %esi,(%edi)
+	ide_start();
+f01093b8:	e8 41 fb ff ff       	call   f0108efe <ide_start>
+	spin_unlock(&ide_spinlock);
+f01093bd:	83 ec 0c             	sub    $0xc,%esp
+f01093c0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f01093c3:	8d 83 f4 0e 00 00    	lea    0xef4(%ebx),%eax
+f01093c9:	50                   	push   %eax
+f01093ca:	e8 af f8 ff ff       	call   f0108c7e <spin_unlock>
+f01093cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01093d2:	50                   	push   %eax
+f01093d3:	9d                   	popf
+}
+f01093d4:	83 c4 10             	add    $0x10,%esp
+f01093d7:	e9 33 ff ff ff       	jmp    f010930f <ide_submit+0x48>
+
+f01093dc <ide_wait>:
+
+// Wait for req to be done and return its status.
+int
+ide_wait(struct Idereq *req)
+{
+f01093dc:	55                   	push   %ebp
+f01093dd:	89 e5                	mov    %esp,%ebp
+f01093df:	57                   	push   %edi
+f01093e0:	56                   	push   %esi
+f01093e1:	53                   	push   %ebx
+f01093e2:	83 ec 1c             	sub    $0x1c,%esp
+f01093e5:	e8 65 6f ff ff       	call   f010034f <__x86.get_pc_thunk.bx>
+f01093ea:	81 c3 a2 c0 00 00    	add    $0xc0a2,%ebx
+f01093f0:	8b 75 08             	mov    0x8(%ebp),%esi
+	spin_unlock(&ide_spinlock);
+f01093f3:	8d bb f4 0e 00 00    	lea    0xef4(%ebx),%edi
+	uint32_t eflags;
+
+	while (req->ir_status == IDE_PENDING) {
+f01093f9:	eb 22                	jmp    f010941d <ide_wait+0x41>
+			// As in cons_wait, sti takes effect only after
+			// the hlt has started, so a completion that comes
+			// in after the check still ends it.
+			asm volatile("cli");
+			if (req->ir_status == IDE_PENDING)
+				asm volatile("sti; hlt");
+f01093fb:	fb                   	sti
+f01093fc:	f4                   	hlt
+f01093fd:	eb 1e                	jmp    f010941d <ide_wait+0x41>
+			else
+				asm volatile("sti");
+		} else {
+			// Nobody will take the interrupt; look for
+			// ourselves.
+			eflags = ide_lock();
+f01093ff:	e8 41 fa ff ff       	call   f0108e45 <ide_lock>
+f0109404:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			ide_poll();
+f0109407:	e8 f4 fd ff ff       	call   f0109200 <ide_poll>
+	spin_unlock(&ide_spinlock);
+f010940c:	83 ec 0c             	sub    $0xc,%esp
+f010940f:	57                   	push   %edi
+f0109410:	e8 69 f8 ff ff       	call   f0108c7e <spin_unlock>
+f0109415:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0109418:	50                   	push   %eax
+f0109419:	9d                   	popf
+}
+f010941a:	83 c4 10             	add    $0x10,%esp
+	while (req->ir_status == IDE_PENDING) {
+f010941d:	8b 46 10             	mov    0x10(%esi),%eax
+f0109420:	83 f8 01             	cmp    $0x1,%eax
+f0109423:	75 13                	jne    f0109438 <ide_wait+0x5c>
+	asm volatile("pushfl; popl %0" : "=r" (eflags));
+f0109425:	9c                   	pushf
+f0109426:	58                   	pop    %eax
+		if (read_eflags() & FL_IF) {
+f0109427:	f6 c4 02             	test   $0x2,%ah
+f010942a:	74 d3                	je     f01093ff <ide_wait+0x23>
+			asm volatile("cli");
+f010942c:	fa                   	cli
+			if (req->ir_status == IDE_PENDING)
+f010942d:	8b 46 10             	mov    0x10(%esi),%eax
+f0109430:	83 f8 01             	cmp    $0x1,%eax
+f0109433:	74 c6                	je     f01093fb <ide_wait+0x1f>
+				asm volatile("sti");
+f0109435:	fb                   	sti
+f0109436:	eb e5                	jmp    f010941d <ide_wait+0x41>
+			ide_unlock(eflags);
+		}
+	}
+	return req->ir_status;
+f0109438:	8b 46 10             	mov    0x10(%esi),%eax
+}
+f010943b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010943e:	5b                   	pop    %ebx
+f010943f:	5e                   	pop    %esi
+f0109440:	5f                   	pop    %edi
+f0109441:	5d                   	pop    %ebp
+f0109442:	c3                   	ret
+
+f0109443 <ide_rw>:
+
+static int
+ide_rw(uint32_t secno, uint8_t *buf, size_t nsecs, int write)
+{
+f0109443:	55                   	push   %ebp
+f0109444:	89 e5                	mov    %esp,%ebp
+f0109446:	57                   	push   %edi
+f0109447:	56                   	push   %esi
+f0109448:	53                   	push   %ebx
+f0109449:	81 ec ec 00 00 00    	sub    $0xec,%esp
+f010944f:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+f0109455:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%ebp)
+f010945b:	89 ce                	mov    %ecx,%esi
+	struct Idereq req[IDE_NBATCH];
+	int i, n, r, err = 0;
+
+	while (nsecs > 0) {
+f010945d:	e9 a8 00 00 00       	jmp    f010950a <ide_rw+0xc7>
+		for (n = 0; n < IDE_NBATCH && nsecs > 0; n++) {
+			req[n].ir_secno = secno;
+f0109462:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+f0109468:	89 03                	mov    %eax,(%ebx)
+			req[n].ir_nsecs = MIN(nsecs, IDE_MAXSECTS);
+f010946a:	b8 00 01 00 00       	mov    $0x100,%eax
+f010946f:	39 c6                	cmp    %eax,%esi
+f0109471:	0f 46 c6             	cmovbe %esi,%eax
+f0109474:	89 43 04             	mov    %eax,0x4(%ebx)
+			req[n].ir_buf = buf;
+f0109477:	8b 95 20 ff ff ff    	mov    -0xe0(%ebp),%edx
+f010947d:	89 53 08             	mov    %edx,0x8(%ebx)
+			req[n].ir_write = write;
+f0109480:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109483:	89 43 0c             	mov    %eax,0xc(%ebx)
+			ide_submit(&req[n]);
+f0109486:	83 ec 0c             	sub    $0xc,%esp
+f0109489:	53                   	push   %ebx
+f010948a:	e8 38 fe ff ff       	call   f01092c7 <ide_submit>
+			secno += req[n].ir_nsecs;
+f010948f:	8b 43 04             	mov    0x4(%ebx),%eax
+f0109492:	01 85 24 ff ff ff    	add    %eax,-0xdc(%ebp)
+			buf += req[n].ir_nsecs * SECTSIZE;
+f0109498:	89 c2                	mov    %eax,%edx
+f010949a:	c1 e2 09             	shl    $0x9,%edx
+f010949d:	01 95 20 ff ff ff    	add    %edx,-0xe0(%ebp)
+			nsecs -= req[n].ir_nsecs;
+f01094a3:	29 c6                	sub    %eax,%esi
+		for (n = 0; n < IDE_NBATCH && nsecs > 0; n++) {
+f01094a5:	83 c7 01             	add    $0x1,%edi
+f01094a8:	83 c3 18             	add    $0x18,%ebx
+f01094ab:	83 c4 10             	add    $0x10,%esp
+f01094ae:	83 ff 07             	cmp    $0x7,%edi
+f01094b1:	7f 04                	jg     f01094b7 <ide_rw+0x74>
+f01094b3:	85 f6                	test   %esi,%esi
+f01094b5:	75 ab                	jne    f0109462 <ide_rw+0x1f>
+f01094b7:	b8 00 00 00 00       	mov    $0x0,%eax
+		}
+		// The requests live on this stack: wait for all of them.
+		for (i = 0; i < n; i++)
+f01094bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01094c1:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%ebp)
+f01094c7:	89 c7                	mov    %eax,%edi
+f01094c9:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%ebp)
+f01094cf:	8b b5 18 ff ff ff    	mov    -0xe8(%ebp),%esi
+f01094d5:	eb 06                	jmp    f01094dd <ide_rw+0x9a>
+f01094d7:	83 c3 01             	add    $0x1,%ebx
+f01094da:	83 c6 18             	add    $0x18,%esi
+f01094dd:	8b 85 1c ff ff ff    	mov    -0xe4(%ebp),%eax
+f01094e3:	39 c3                	cmp    %eax,%ebx
+f01094e5:	7d 17                	jge    f01094fe <ide_rw+0xbb>
+			if ((r = ide_wait(&req[i])) < 0 && !err)
+f01094e7:	83 ec 0c             	sub    $0xc,%esp
+f01094ea:	56                   	push   %esi
+f01094eb:	e8 ec fe ff ff       	call   f01093dc <ide_wait>
+f01094f0:	83 c4 10             	add    $0x10,%esp
+f01094f3:	85 ff                	test   %edi,%edi
+f01094f5:	75 e0                	jne    f01094d7 <ide_rw+0x94>
+				err = r;
+f01094f7:	85 c0                	test   %eax,%eax
+f01094f9:	0f 48 f8             	cmovs  %eax,%edi
+f01094fc:	eb d9                	jmp    f01094d7 <ide_rw+0x94>
+		if (err)
+f01094fe:	89 f8                	mov    %edi,%eax
+f0109500:	8b b5 14 ff ff ff    	mov    -0xec(%ebp),%esi
+f0109506:	85 ff                	test   %edi,%edi
+f0109508:	75 1e                	jne    f0109528 <ide_rw+0xe5>
+	while (nsecs > 0) {
+f010950a:	85 f6                	test   %esi,%esi
+f010950c:	74 15                	je     f0109523 <ide_rw+0xe0>
+f010950e:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+f0109514:	89 85 18 ff ff ff    	mov    %eax,-0xe8(%ebp)
+f010951a:	89 c3                	mov    %eax,%ebx
+		for (n = 0; n < IDE_NBATCH && nsecs > 0; n++) {
+f010951c:	bf 00 00 00 00       	mov    $0x0,%edi
+f0109521:	eb 8b                	jmp    f01094ae <ide_rw+0x6b>
+			return err;
+	}
+	return 0;
+f0109523:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0109528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010952b:	5b                   	pop    %ebx
+f010952c:	5e                   	pop    %esi
+f010952d:	5f                   	pop    %edi
+f010952e:	5d                   	pop    %ebp
+f010952f:	c3                   	ret
+
+f0109530 <ide_read>:
+
+// Read nsecs sectors starting at secno into dst.
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+f0109530:	55                   	push   %ebp
+f0109531:	89 e5                	mov    %esp,%ebp
+f0109533:	83 ec 14             	sub    $0x14,%esp
+	return ide_rw(secno, dst, nsecs, 0);
+f0109536:	6a 00                	push   $0x0
+f0109538:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f010953b:	8b 55 0c             	mov    0xc(%ebp),%edx
+f010953e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109541:	e8 fd fe ff ff       	call   f0109443 <ide_rw>
+}
+f0109546:	c9                   	leave
+f0109547:	c3                   	ret
+
+f0109548 <ide_write>:
+
+// Write nsecs sectors from src to the disk, starting at secno.
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+f0109548:	55                   	push   %ebp
+f0109549:	89 e5                	mov    %esp,%ebp
+f010954b:	83 ec 14             	sub    $0x14,%esp
+	return ide_rw(secno, (uint8_t *) src, nsecs, 1);
+f010954e:	6a 01                	push   $0x1
+f0109550:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0109553:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0109556:	8b 45 08             	mov    0x8(%ebp),%eax
+f0109559:	e8 e5 fe ff ff       	call   f0109443 <ide_rw>
+}
+f010955e:	c9                   	leave
+f010955f:	c3                   	ret
+
+f0109560 <ide_nsectors>:
+
+uint32_t
+ide_nsectors(void)
+{
+f0109560:	e8 79 7a ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0109565:	05 27 bf 00 00       	add    $0xbf27,%eax
+	return nsectors;
+f010956a:	8b 80 80 ec 03 00    	mov    0x3ec80(%eax),%eax
+}
+f0109570:	c3                   	ret
+
+f0109571 <ide_init>:
+	cprintf("check_ide() succeeded!\n");
+}
+
+void
+ide_init(void)
+{
+f0109571:	55                   	push   %ebp
+f0109572:	89 e5                	mov    %esp,%ebp
+f0109574:	57                   	push   %edi
+f0109575:	56                   	push   %esi
+f0109576:	53                   	push   %ebx
+f0109577:	81 ec dc 00 00 00    	sub    $0xdc,%esp
+f010957d:	e8 5c 7a ff ff       	call   f0100fde <__x86.get_pc_thunk.ax>
+f0109582:	05 0a bf 00 00       	add    $0xbf0a,%eax
+f0109587:	89 85 20 ff ff ff    	mov    %eax,-0xe0(%ebp)
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010958d:	b8 02 00 00 00       	mov    $0x2,%eax
+f0109592:	ba f6 03 00 00       	mov    $0x3f6,%edx
+f0109597:	ee                   	out    %al,(%dx)
+	int dma;
+
+	// Keep the drive quiet while we look at it.
+	outb(IDE_CTL, IDE_CTL_NIEN);
+	if ((dma = ide_identify()) < 0) {
+f0109598:	e8 10 f8 ff ff       	call   f0108dad <ide_identify>
+f010959d:	85 c0                	test   %eax,%eax
+f010959f:	0f 88 87 01 00 00    	js     f010972c <ide_init+0x1bb>
+		cprintf("IDE: no boot disk\n");
+		return;
+	}
+
+	if (dma && (bmbase = pci_find_busmaster())) {
+f01095a5:	0f 85 9e 01 00 00    	jne    f0109749 <ide_init+0x1d8>
+		outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+		inb(IDE_CMD);
+		outb(IDE_CTL, 0);
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_IDE));
+	}
+	cprintf("IDE: boot disk has %u sectors, %s\n", nsectors,
+f01095ab:	8b 8d 20 ff ff ff    	mov    -0xe0(%ebp),%ecx
+f01095b1:	8d 81 8e 65 ff ff    	lea    -0x9a72(%ecx),%eax
+f01095b7:	66 83 b9 84 ec 03 00 	cmpw   $0x0,0x3ec84(%ecx)
+f01095be:	00 
+f01095bf:	74 06                	je     f01095c7 <ide_init+0x56>
+f01095c1:	8d 81 7f 65 ff ff    	lea    -0x9a81(%ecx),%eax
+f01095c7:	83 ec 04             	sub    $0x4,%esp
+f01095ca:	50                   	push   %eax
+f01095cb:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f01095d1:	ff b3 80 ec 03 00    	push   0x3ec80(%ebx)
+f01095d7:	8d 83 00 65 ff ff    	lea    -0x9b00(%ebx),%eax
+f01095dd:	50                   	push   %eax
+f01095de:	e8 af aa ff ff       	call   f0104092 <cprintf>
+	assert((pp = page_alloc_order(1, 0)));
+f01095e3:	83 c4 08             	add    $0x8,%esp
+f01095e6:	6a 00                	push   $0x0
+f01095e8:	6a 01                	push   $0x1
+f01095ea:	e8 24 8b ff ff       	call   f0102113 <page_alloc_order>
+f01095ef:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+f01095f5:	83 c4 10             	add    $0x10,%esp
+f01095f8:	85 c0                	test   %eax,%eax
+f01095fa:	0f 84 c5 02 00 00    	je     f01098c5 <ide_init+0x354>
+	return (pp - pages) << PGSHIFT;
+f0109600:	8b 8d 20 ff ff ff    	mov    -0xe0(%ebp),%ecx
+f0109606:	c7 c0 14 43 15 f0    	mov    $0xf0154314,%eax
+f010960c:	8b bd 24 ff ff ff    	mov    -0xdc(%ebp),%edi
+f0109612:	2b 38                	sub    (%eax),%edi
+f0109614:	89 f8                	mov    %edi,%eax
+f0109616:	c1 f8 02             	sar    $0x2,%eax
+f0109619:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f010961f:	89 c7                	mov    %eax,%edi
+f0109621:	c1 e7 0c             	shl    $0xc,%edi
+	if (PGNUM(pa) >= npages)
+f0109624:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0109629:	c7 c2 0c 43 15 f0    	mov    $0xf015430c,%edx
+f010962f:	3b 02                	cmp    (%edx),%eax
+f0109631:	0f 83 b3 02 00 00    	jae    f01098ea <ide_init+0x379>
+	return (void *)(pa + KERNBASE);
+f0109637:	8d 87 00 00 00 f0    	lea    -0x10000000(%edi),%eax
+f010963d:	89 85 18 ff ff ff    	mov    %eax,-0xe8(%ebp)
+	many = one + PGSIZE;
+f0109643:	8d 8f 00 10 00 f0    	lea    -0xffff000(%edi),%ecx
+f0109649:	89 8d 1c ff ff ff    	mov    %ecx,-0xe4(%ebp)
+	assert(ide_read(0, one, 8) == 0);
+f010964f:	83 ec 04             	sub    $0x4,%esp
+f0109652:	6a 08                	push   $0x8
+f0109654:	50                   	push   %eax
+f0109655:	6a 00                	push   $0x0
+f0109657:	e8 d4 fe ff ff       	call   f0109530 <ide_read>
+f010965c:	83 c4 10             	add    $0x10,%esp
+f010965f:	85 c0                	test   %eax,%eax
+f0109661:	0f 85 9b 02 00 00    	jne    f0109902 <ide_init+0x391>
+	assert(one[510] == 0x55 && one[511] == 0xAA);
+f0109667:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+f010966d:	80 b8 fe 01 00 00 55 	cmpb   $0x55,0x1fe(%eax)
+f0109674:	0f 85 ad 02 00 00    	jne    f0109927 <ide_init+0x3b6>
+f010967a:	80 b8 ff 01 00 00 aa 	cmpb   $0xaa,0x1ff(%eax)
+f0109681:	0f 85 a0 02 00 00    	jne    f0109927 <ide_init+0x3b6>
+	memset(many, 0, PGSIZE);
+f0109687:	83 ec 04             	sub    $0x4,%esp
+f010968a:	68 00 10 00 00       	push   $0x1000
+f010968f:	6a 00                	push   $0x0
+f0109691:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+f0109697:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f010969d:	e8 47 ea ff ff       	call   f01080e9 <memset>
+f01096a2:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+f01096a5:	81 ef 00 e2 ff 0f    	sub    $0xfffe200,%edi
+f01096ab:	83 c4 10             	add    $0x10,%esp
+	for (i = 7; i >= 0; i--) {
+f01096ae:	be 07 00 00 00       	mov    $0x7,%esi
+		req[i].ir_secno = i;
+f01096b3:	89 33                	mov    %esi,(%ebx)
+		req[i].ir_nsecs = 1;
+f01096b5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+		req[i].ir_buf = many + i * SECTSIZE;
+f01096bc:	89 7b 08             	mov    %edi,0x8(%ebx)
+		req[i].ir_write = 0;
+f01096bf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		ide_submit(&req[i]);
+f01096c6:	83 ec 0c             	sub    $0xc,%esp
+f01096c9:	53                   	push   %ebx
+f01096ca:	e8 f8 fb ff ff       	call   f01092c7 <ide_submit>
+	for (i = 7; i >= 0; i--) {
+f01096cf:	83 ee 01             	sub    $0x1,%esi
+f01096d2:	83 eb 18             	sub    $0x18,%ebx
+f01096d5:	81 ef 00 02 00 00    	sub    $0x200,%edi
+f01096db:	83 c4 10             	add    $0x10,%esp
+f01096de:	83 fe ff             	cmp    $0xffffffff,%esi
+f01096e1:	75 d0                	jne    f01096b3 <ide_init+0x142>
+f01096e3:	8d 9d 28 ff ff ff    	lea    -0xd8(%ebp),%ebx
+f01096e9:	8d 75 e8             	lea    -0x18(%ebp),%esi
+	for (i = 0; i < 8; i++)
+f01096ec:	39 de                	cmp    %ebx,%esi
+f01096ee:	0f 84 58 02 00 00    	je     f010994c <ide_init+0x3db>
+		assert(ide_wait(&req[i]) == 0);
+f01096f4:	83 ec 0c             	sub    $0xc,%esp
+f01096f7:	53                   	push   %ebx
+f01096f8:	e8 df fc ff ff       	call   f01093dc <ide_wait>
+f01096fd:	83 c3 18             	add    $0x18,%ebx
+f0109700:	83 c4 10             	add    $0x10,%esp
+f0109703:	85 c0                	test   %eax,%eax
+f0109705:	74 e5                	je     f01096ec <ide_init+0x17b>
+f0109707:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f010970d:	8d 83 dc 65 ff ff    	lea    -0x9a24(%ebx),%eax
+f0109713:	50                   	push   %eax
+f0109714:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010971a:	50                   	push   %eax
+f010971b:	68 fa 01 00 00       	push   $0x1fa
+f0109720:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109726:	50                   	push   %eax
+f0109727:	e8 cc 69 ff ff       	call   f01000f8 <_panic>
+		cprintf("IDE: no boot disk\n");
+f010972c:	83 ec 0c             	sub    $0xc,%esp
+f010972f:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f0109735:	8d 83 92 65 ff ff    	lea    -0x9a6e(%ebx),%eax
+f010973b:	50                   	push   %eax
+f010973c:	e8 51 a9 ff ff       	call   f0104092 <cprintf>
+		return;
+f0109741:	83 c4 10             	add    $0x10,%esp
+f0109744:	e9 4e 02 00 00       	jmp    f0109997 <ide_init+0x426>
+f0109749:	be 00 00 00 00       	mov    $0x0,%esi
+f010974e:	e9 d7 00 00 00       	jmp    f010982a <ide_init+0x2b9>
+f0109753:	81 c1 00 01 00 00    	add    $0x100,%ecx
+		for (func = 0; func < nfunc; func++) {
+f0109759:	39 8d 24 ff ff ff    	cmp    %ecx,-0xdc(%ebp)
+f010975f:	0f 84 b3 00 00 00    	je     f0109818 <ide_init+0x2a7>
+f0109765:	89 cb                	mov    %ecx,%ebx
+f0109767:	09 f3                	or     %esi,%ebx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0109769:	89 d8                	mov    %ebx,%eax
+f010976b:	0d 00 00 00 80       	or     $0x80000000,%eax
+f0109770:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f0109775:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0109776:	89 fa                	mov    %edi,%edx
+f0109778:	ed                   	in     (%dx),%eax
+			if ((pci_conf_read(dev, func, PCI_ID) & 0xFFFF) == 0xFFFF)
+f0109779:	66 83 f8 ff          	cmp    $0xffff,%ax
+f010977d:	74 d4                	je     f0109753 <ide_init+0x1e2>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f010977f:	89 d8                	mov    %ebx,%eax
+f0109781:	0d 08 00 00 80       	or     $0x80000008,%eax
+f0109786:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010978b:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f010978c:	89 fa                	mov    %edi,%edx
+f010978e:	ed                   	in     (%dx),%eax
+			if ((class >> 16) != 0x0101 || !(class & 0x8000)
+f010978f:	89 c2                	mov    %eax,%edx
+f0109791:	c1 ea 10             	shr    $0x10,%edx
+f0109794:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+f010979a:	75 b7                	jne    f0109753 <ide_init+0x1e2>
+			    || (class & 0x100))
+f010979c:	25 00 81 00 00       	and    $0x8100,%eax
+f01097a1:	3d 00 80 00 00       	cmp    $0x8000,%eax
+f01097a6:	75 ab                	jne    f0109753 <ide_init+0x1e2>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f01097a8:	89 d8                	mov    %ebx,%eax
+f01097aa:	0d 20 00 00 80       	or     $0x80000020,%eax
+f01097af:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f01097b4:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f01097b5:	89 fa                	mov    %edi,%edx
+f01097b7:	ed                   	in     (%dx),%eax
+			if (!(bar & 1) || !(bar & 0xFFFC))
+f01097b8:	a8 01                	test   $0x1,%al
+f01097ba:	74 97                	je     f0109753 <ide_init+0x1e2>
+f01097bc:	a9 fc ff 00 00       	test   $0xfffc,%eax
+f01097c1:	74 90                	je     f0109753 <ide_init+0x1e2>
+f01097c3:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+f01097c9:	81 cb 04 00 00 80    	or     $0x80000004,%ebx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f01097cf:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+f01097d4:	89 d8                	mov    %ebx,%eax
+f01097d6:	89 fa                	mov    %edi,%edx
+f01097d8:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f01097d9:	be fc 0c 00 00       	mov    $0xcfc,%esi
+f01097de:	89 f2                	mov    %esi,%edx
+f01097e0:	ed                   	in     (%dx),%eax
+f01097e1:	89 c1                	mov    %eax,%ecx
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f01097e3:	89 d8                	mov    %ebx,%eax
+f01097e5:	89 fa                	mov    %edi,%edx
+f01097e7:	ef                   	out    %eax,(%dx)
+					& 0xFFFF) | PCI_CMD_IO | PCI_CMD_MASTER);
+f01097e8:	0f b7 c1             	movzwl %cx,%eax
+			pci_conf_write(dev, func, PCI_COMMAND,
+f01097eb:	83 c8 05             	or     $0x5,%eax
+f01097ee:	89 f2                	mov    %esi,%edx
+f01097f0:	ef                   	out    %eax,(%dx)
+			return bar & 0xFFFC;
+f01097f1:	0f b7 85 24 ff ff ff 	movzwl -0xdc(%ebp),%eax
+f01097f8:	83 e0 fc             	and    $0xfffffffc,%eax
+	if (dma && (bmbase = pci_find_busmaster())) {
+f01097fb:	8b bd 20 ff ff ff    	mov    -0xe0(%ebp),%edi
+f0109801:	66 89 87 84 ec 03 00 	mov    %ax,0x3ec84(%edi)
+f0109808:	66 85 c0             	test   %ax,%ax
+f010980b:	75 71                	jne    f010987e <ide_init+0x30d>
+	cprintf("IDE: boot disk has %u sectors, %s\n", nsectors,
+f010980d:	8d 87 8e 65 ff ff    	lea    -0x9a72(%edi),%eax
+f0109813:	e9 af fd ff ff       	jmp    f01095c7 <ide_init+0x56>
+f0109818:	81 c6 00 08 00 00    	add    $0x800,%esi
+	for (dev = 0; dev < 32; dev++) {
+f010981e:	81 fe 00 00 01 00    	cmp    $0x10000,%esi
+f0109824:	0f 84 9a 01 00 00    	je     f01099c4 <ide_init+0x453>
+f010982a:	89 f0                	mov    %esi,%eax
+f010982c:	0d 00 00 00 80       	or     $0x80000000,%eax
+f0109831:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f0109836:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0109837:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f010983c:	ed                   	in     (%dx),%eax
+		if ((pci_conf_read(dev, 0, PCI_ID) & 0xFFFF) == 0xFFFF)
+f010983d:	66 83 f8 ff          	cmp    $0xffff,%ax
+f0109841:	74 d5                	je     f0109818 <ide_init+0x2a7>
+	asm volatile("outl %0,%w1" : : "a" (data), "d" (port));
+f0109843:	89 f0                	mov    %esi,%eax
+f0109845:	0d 0c 00 00 80       	or     $0x8000000c,%eax
+f010984a:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+f010984f:	ef                   	out    %eax,(%dx)
+	asm volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+f0109850:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+f0109855:	ed                   	in     (%dx),%eax
+		nfunc = pci_conf_read(dev, 0, PCI_HEADER) & PCI_HDR_MULTIFN
+f0109856:	25 00 00 80 00       	and    $0x800000,%eax
+			? 8 : 1;
+f010985b:	83 f8 01             	cmp    $0x1,%eax
+f010985e:	19 c0                	sbb    %eax,%eax
+f0109860:	83 e0 f9             	and    $0xfffffff9,%eax
+f0109863:	83 c0 08             	add    $0x8,%eax
+f0109866:	c1 e0 08             	shl    $0x8,%eax
+f0109869:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+f010986f:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0109874:	bf fc 0c 00 00       	mov    $0xcfc,%edi
+f0109879:	e9 e7 fe ff ff       	jmp    f0109765 <ide_init+0x1f4>
+		outb(bmbase + BM_CMD, 0);
+f010987e:	0f b7 d0             	movzwl %ax,%edx
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0109881:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0109886:	89 c8                	mov    %ecx,%eax
+f0109888:	ee                   	out    %al,(%dx)
+		outb(bmbase + BM_STATUS, BM_ST_ERR | BM_ST_IRQ);
+f0109889:	83 c2 02             	add    $0x2,%edx
+f010988c:	b8 06 00 00 00       	mov    $0x6,%eax
+f0109891:	ee                   	out    %al,(%dx)
+	asm volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0109892:	ba f7 01 00 00       	mov    $0x1f7,%edx
+f0109897:	ec                   	in     (%dx),%al
+	asm volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0109898:	ba f6 03 00 00       	mov    $0x3f6,%edx
+f010989d:	89 c8                	mov    %ecx,%eax
+f010989f:	ee                   	out    %al,(%dx)
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_IDE));
+f01098a0:	83 ec 0c             	sub    $0xc,%esp
+f01098a3:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f01098a9:	c7 c0 08 53 11 f0    	mov    $0xf0115308,%eax
+f01098af:	0f b7 00             	movzwl (%eax),%eax
+f01098b2:	25 ff bf 00 00       	and    $0xbfff,%eax
+f01098b7:	50                   	push   %eax
+f01098b8:	e8 73 a5 ff ff       	call   f0103e30 <irq_setmask_8259A>
+f01098bd:	83 c4 10             	add    $0x10,%esp
+f01098c0:	e9 e6 fc ff ff       	jmp    f01095ab <ide_init+0x3a>
+	assert((pp = page_alloc_order(1, 0)));
+f01098c5:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f01098cb:	8d 83 a5 65 ff ff    	lea    -0x9a5b(%ebx),%eax
+f01098d1:	50                   	push   %eax
+f01098d2:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01098d8:	50                   	push   %eax
+f01098d9:	68 e9 01 00 00       	push   $0x1e9
+f01098de:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f01098e4:	50                   	push   %eax
+f01098e5:	e8 0e 68 ff ff       	call   f01000f8 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01098ea:	57                   	push   %edi
+f01098eb:	89 cb                	mov    %ecx,%ebx
+f01098ed:	8d 81 5c 47 ff ff    	lea    -0xb8a4(%ecx),%eax
+f01098f3:	50                   	push   %eax
+f01098f4:	6a 53                	push   $0x53
+f01098f6:	8d 81 2c 51 ff ff    	lea    -0xaed4(%ecx),%eax
+f01098fc:	50                   	push   %eax
+f01098fd:	e8 f6 67 ff ff       	call   f01000f8 <_panic>
+	assert(ide_read(0, one, 8) == 0);
+f0109902:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f0109908:	8d 83 c3 65 ff ff    	lea    -0x9a3d(%ebx),%eax
+f010990e:	50                   	push   %eax
+f010990f:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f0109915:	50                   	push   %eax
+f0109916:	68 ed 01 00 00       	push   $0x1ed
+f010991b:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109921:	50                   	push   %eax
+f0109922:	e8 d1 67 ff ff       	call   f01000f8 <_panic>
+	assert(one[510] == 0x55 && one[511] == 0xAA);
+f0109927:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f010992d:	8d 83 24 65 ff ff    	lea    -0x9adc(%ebx),%eax
+f0109933:	50                   	push   %eax
+f0109934:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f010993a:	50                   	push   %eax
+f010993b:	68 ef 01 00 00       	push   $0x1ef
+f0109940:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f0109946:	50                   	push   %eax
+f0109947:	e8 ac 67 ff ff       	call   f01000f8 <_panic>
+	assert(memcmp(one, many, PGSIZE) == 0);
+f010994c:	83 ec 04             	sub    $0x4,%esp
+f010994f:	68 00 10 00 00       	push   $0x1000
+f0109954:	ff b5 1c ff ff ff    	push   -0xe4(%ebp)
+f010995a:	ff b5 18 ff ff ff    	push   -0xe8(%ebp)
+f0109960:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f0109966:	e8 7f e8 ff ff       	call   f01081ea <memcmp>
+f010996b:	83 c4 10             	add    $0x10,%esp
+f010996e:	85 c0                	test   %eax,%eax
+f0109970:	75 2d                	jne    f010999f <ide_init+0x42e>
+	page_free(pp);
+f0109972:	83 ec 0c             	sub    $0xc,%esp
+f0109975:	ff b5 24 ff ff ff    	push   -0xdc(%ebp)
+f010997b:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f0109981:	e8 5d 88 ff ff       	call   f01021e3 <page_free>
+	cprintf("check_ide() succeeded!\n");
+f0109986:	8d 83 f3 65 ff ff    	lea    -0x9a0d(%ebx),%eax
+f010998c:	89 04 24             	mov    %eax,(%esp)
+f010998f:	e8 fe a6 ff ff       	call   f0104092 <cprintf>
+}
+f0109994:	83 c4 10             	add    $0x10,%esp
+		bmbase ? "bus-master DMA" : "PIO");
+
+	check_ide();
+}
+f0109997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f010999a:	5b                   	pop    %ebx
+f010999b:	5e                   	pop    %esi
+f010999c:	5f                   	pop    %edi
+f010999d:	5d                   	pop    %ebp
+f010999e:	c3                   	ret
+	assert(memcmp(one, many, PGSIZE) == 0);
+f010999f:	8b 9d 20 ff ff ff    	mov    -0xe0(%ebp),%ebx
+f01099a5:	8d 83 4c 65 ff ff    	lea    -0x9ab4(%ebx),%eax
+f01099ab:	50                   	push   %eax
+f01099ac:	8d 83 a9 47 ff ff    	lea    -0xb857(%ebx),%eax
+f01099b2:	50                   	push   %eax
+f01099b3:	68 fb 01 00 00       	push   $0x1fb
+f01099b8:	8d 83 6b 65 ff ff    	lea    -0x9a95(%ebx),%eax
+f01099be:	50                   	push   %eax
+f01099bf:	e8 34 67 ff ff       	call   f01000f8 <_panic>
+	if (dma && (bmbase = pci_find_busmaster())) {
+f01099c4:	8b 85 20 ff ff ff    	mov    -0xe0(%ebp),%eax
+f01099ca:	66 c7 80 84 ec 03 00 	movw   $0x0,0x3ec84(%eax)
+f01099d1:	00 00 
+	cprintf("IDE: boot disk has %u sectors, %s\n", nsectors,
+f01099d3:	8d 80 8e 65 ff ff    	lea    -0x9a72(%eax),%eax
+f01099d9:	e9 e9 fb ff ff       	jmp    f01095c7 <ide_init+0x56>
+
+f01099de <__udivdi3>:
+f01099de:	57                   	push   %edi
+f01099df:	56                   	push   %esi
+f01099e0:	53                   	push   %ebx
+f01099e1:	83 ec 20             	sub    $0x20,%esp
+f01099e4:	8b 44 24 30          	mov    0x30(%esp),%eax
+f01099e8:	8b 54 24 34          	mov    0x34(%esp),%edx
+f01099ec:	89 44 24 08          	mov    %eax,0x8(%esp)
+f01099f0:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f01099f4:	8b 44 24 38          	mov    0x38(%esp),%eax
+f01099f8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f01099fc:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0109a00:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0109a04:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0109a09:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109a0e:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109a13:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+f0109a1a:	00 
+f0109a1b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+f0109a22:	00 
+f0109a23:	eb 08                	jmp    f0109a2d <__udivdi3+0x4f>
+f0109a25:	83 e9 01             	sub    $0x1,%ecx
+f0109a28:	83 f9 ff             	cmp    $0xffffffff,%ecx
+f0109a2b:	74 68                	je     f0109a95 <__udivdi3+0xb7>
+f0109a2d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0109a31:	01 c0                	add    %eax,%eax
+f0109a33:	89 c6                	mov    %eax,%esi
+f0109a35:	89 d7                	mov    %edx,%edi
+f0109a37:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0109a3b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0109a3f:	0f ad d0             	shrd   %cl,%edx,%eax
+f0109a42:	d3 ea                	shr    %cl,%edx
+f0109a44:	f6 c1 20             	test   $0x20,%cl
+f0109a47:	74 04                	je     f0109a4d <__udivdi3+0x6f>
+f0109a49:	89 d0                	mov    %edx,%eax
+f0109a4b:	31 d2                	xor    %edx,%edx
+f0109a4d:	83 e0 01             	and    $0x1,%eax
+f0109a50:	89 04 24             	mov    %eax,(%esp)
+f0109a53:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+f0109a5a:	00 
+f0109a5b:	8b 04 24             	mov    (%esp),%eax
+f0109a5e:	8b 54 24 04          	mov    0x4(%esp),%edx
+f0109a62:	09 f0                	or     %esi,%eax
+f0109a64:	09 fa                	or     %edi,%edx
+f0109a66:	8b 74 24 10          	mov    0x10(%esp),%esi
+f0109a6a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+f0109a6e:	39 f0                	cmp    %esi,%eax
+f0109a70:	89 d3                	mov    %edx,%ebx
+f0109a72:	19 fb                	sbb    %edi,%ebx
+f0109a74:	72 af                	jb     f0109a25 <__udivdi3+0x47>
+f0109a76:	29 f0                	sub    %esi,%eax
+f0109a78:	19 fa                	sbb    %edi,%edx
+f0109a7a:	89 cf                	mov    %ecx,%edi
+f0109a7c:	c1 ef 05             	shr    $0x5,%edi
+f0109a7f:	83 e7 01             	and    $0x1,%edi
+f0109a82:	89 fe                	mov    %edi,%esi
+f0109a84:	83 f6 01             	xor    $0x1,%esi
+f0109a87:	d3 e6                	shl    %cl,%esi
+f0109a89:	d3 e7                	shl    %cl,%edi
+f0109a8b:	09 74 24 18          	or     %esi,0x18(%esp)
+f0109a8f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+f0109a93:	eb 90                	jmp    f0109a25 <__udivdi3+0x47>
+f0109a95:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0109a99:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0109a9d:	83 c4 20             	add    $0x20,%esp
+f0109aa0:	5b                   	pop    %ebx
+f0109aa1:	5e                   	pop    %esi
+f0109aa2:	5f                   	pop    %edi
+f0109aa3:	c3                   	ret
+
+f0109aa4 <__umoddi3>:
+f0109aa4:	55                   	push   %ebp
+f0109aa5:	57                   	push   %edi
+f0109aa6:	56                   	push   %esi
+f0109aa7:	53                   	push   %ebx
+f0109aa8:	83 ec 1c             	sub    $0x1c,%esp
+f0109aab:	8b 44 24 30          	mov    0x30(%esp),%eax
+f0109aaf:	8b 54 24 34          	mov    0x34(%esp),%edx
+f0109ab3:	89 44 24 08          	mov    %eax,0x8(%esp)
+f0109ab7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+f0109abb:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0109abf:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0109ac3:	89 44 24 10          	mov    %eax,0x10(%esp)
+f0109ac7:	89 54 24 14          	mov    %edx,0x14(%esp)
+f0109acb:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0109ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0109ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+f0109ada:	89 4c 24 04          	mov    %ecx,0x4(%esp)
+f0109ade:	eb 0e                	jmp    f0109aee <__umoddi3+0x4a>
+f0109ae0:	83 6c 24 04 01       	subl   $0x1,0x4(%esp)
+f0109ae5:	8b 74 24 04          	mov    0x4(%esp),%esi
+f0109ae9:	83 fe ff             	cmp    $0xffffffff,%esi
+f0109aec:	74 49                	je     f0109b37 <__umoddi3+0x93>
+f0109aee:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+f0109af2:	01 c0                	add    %eax,%eax
+f0109af4:	89 c3                	mov    %eax,%ebx
+f0109af6:	89 d6                	mov    %edx,%esi
+f0109af8:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0109afc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0109b00:	0f b6 4c 24 04       	movzbl 0x4(%esp),%ecx
+f0109b05:	0f ad d0             	shrd   %cl,%edx,%eax
+f0109b08:	d3 ea                	shr    %cl,%edx
+f0109b0a:	f6 c1 20             	test   $0x20,%cl
+f0109b0d:	74 04                	je     f0109b13 <__umoddi3+0x6f>
+f0109b0f:	89 d0                	mov    %edx,%eax
+f0109b11:	31 d2                	xor    %edx,%edx
+f0109b13:	83 e0 01             	and    $0x1,%eax
+f0109b16:	bd 00 00 00 00       	mov    $0x0,%ebp
+f0109b1b:	89 ea                	mov    %ebp,%edx
+f0109b1d:	09 d8                	or     %ebx,%eax
+f0109b1f:	09 f2                	or     %esi,%edx
+f0109b21:	8b 5c 24 10          	mov    0x10(%esp),%ebx
+f0109b25:	8b 74 24 14          	mov    0x14(%esp),%esi
+f0109b29:	39 d8                	cmp    %ebx,%eax
+f0109b2b:	89 d1                	mov    %edx,%ecx
+f0109b2d:	19 f1                	sbb    %esi,%ecx
+f0109b2f:	72 af                	jb     f0109ae0 <__umoddi3+0x3c>
+f0109b31:	29 d8                	sub    %ebx,%eax
+f0109b33:	19 f2                	sbb    %esi,%edx
+f0109b35:	eb a9                	jmp    f0109ae0 <__umoddi3+0x3c>
+f0109b37:	83 c4 1c             	add    $0x1c,%esp
+f0109b3a:	5b                   	pop    %ebx
+f0109b3b:	5e                   	pop    %esi
+f0109b3c:	5f                   	pop    %edi
+f0109b3d:	5d                   	pop    %ebp
+f0109b3e:	c3                   	ret